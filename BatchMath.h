@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstddef>
+
+#if defined(_M_X64) || defined(_M_IX86)
+#include <intrin.h>
+#include <immintrin.h>
+#define SPACECAL_BATCH_AVX2 1
+#endif
+
+/**
+ * Kernels over structure-of-arrays data, applying one rotation to n vectors, for the loops
+ * that have many samples and one transform, like the solver's sensitivity. Input and output
+ * may alias. No project is built with /arch:AVX2, so both SteamVR's driver and the client
+ * keep running on older CPUs: the AVX2 and FMA path is picked at run time, four vectors per
+ * step, and the scalar loops stay for the rest and CPUs without. Neither needs OpenVR, so the
+ * solver can use them too.
+ */
+struct Vector3Array
+{
+	double *x, *y, *z;
+};
+
+// out[i] = m in[i], from element first on.
+inline void matrixRotateVectorsScalar(const double (&m)[3][3], Vector3Array in, Vector3Array out, size_t n, size_t first = 0)
+{
+	for (size_t i = first; i < n; i++)
+	{
+		double x = in.x[i], y = in.y[i], z = in.z[i];
+		out.x[i] = m[0][0] * x + m[0][1] * y + m[0][2] * z;
+		out.y[i] = m[1][0] * x + m[1][1] * y + m[1][2] * z;
+		out.z[i] = m[2][0] * x + m[2][1] * y + m[2][2] * z;
+	}
+}
+
+#ifdef SPACECAL_BATCH_AVX2
+
+// AVX2 and FMA on the CPU, and the OS saving the upper halves of the registers.
+inline bool batchAvx2Supported()
+{
+	static const bool supported = [] {
+		int info[4];
+		__cpuid(info, 0);
+		if (info[0] < 7)
+			return false;
+
+		__cpuid(info, 1);
+		bool fma = (info[2] & (1 << 12)) != 0, osxsave = (info[2] & (1 << 27)) != 0, avx = (info[2] & (1 << 28)) != 0;
+		if (!fma || !osxsave || !avx || (_xgetbv(0) & 6) != 6)
+			return false;
+
+		__cpuidex(info, 7, 0);
+		return (info[1] & (1 << 5)) != 0;
+	}();
+	return supported;
+}
+
+// Only call where batchAvx2Supported.
+inline void matrixRotateVectorsAvx2(const double (&m)[3][3], Vector3Array in, Vector3Array out, size_t n)
+{
+	__m256d m00 = _mm256_set1_pd(m[0][0]), m01 = _mm256_set1_pd(m[0][1]), m02 = _mm256_set1_pd(m[0][2]);
+	__m256d m10 = _mm256_set1_pd(m[1][0]), m11 = _mm256_set1_pd(m[1][1]), m12 = _mm256_set1_pd(m[1][2]);
+	__m256d m20 = _mm256_set1_pd(m[2][0]), m21 = _mm256_set1_pd(m[2][1]), m22 = _mm256_set1_pd(m[2][2]);
+
+	size_t i = 0;
+	for (; i + 4 <= n; i += 4)
+	{
+		__m256d x = _mm256_loadu_pd(in.x + i), y = _mm256_loadu_pd(in.y + i), z = _mm256_loadu_pd(in.z + i);
+		_mm256_storeu_pd(out.x + i, _mm256_fmadd_pd(m00, x, _mm256_fmadd_pd(m01, y, _mm256_mul_pd(m02, z))));
+		_mm256_storeu_pd(out.y + i, _mm256_fmadd_pd(m10, x, _mm256_fmadd_pd(m11, y, _mm256_mul_pd(m12, z))));
+		_mm256_storeu_pd(out.z + i, _mm256_fmadd_pd(m20, x, _mm256_fmadd_pd(m21, y, _mm256_mul_pd(m22, z))));
+	}
+
+	// The SSE code the rest is compiled to would pay for dirty upper halves.
+	_mm256_zeroupper();
+	matrixRotateVectorsScalar(m, in, out, n, i);
+}
+
+#endif
+
+// Picks the AVX2 path where there is one. Its fused multiply-adds round once instead of twice,
+// so results differ from the scalar loop's in the last bit or so.
+inline void matrixRotateVectors(const double (&m)[3][3], Vector3Array in, Vector3Array out, size_t n)
+{
+#ifdef SPACECAL_BATCH_AVX2
+	if (batchAvx2Supported())
+	{
+		matrixRotateVectorsAvx2(m, in, out, n);
+		return;
+	}
+#endif
+	matrixRotateVectorsScalar(m, in, out, n);
+}
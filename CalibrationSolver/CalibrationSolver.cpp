@@ -0,0 +1,1196 @@
+#include "CalibrationSolver.h"
+#include "../BatchMath.h"
+#include "../Instrumentation.h"
+
+#include <Eigen/Dense>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <thread>
+
+double PoseQuality(bool tracking, double linearSpeed, double angularSpeed)
+{
+	if (!tracking)
+		return 0.0;
+
+	return 1.0 / (1.0 + linearSpeed / 2.0 + angularSpeed / (2.0 * EIGEN_PI));
+}
+
+Eigen::Vector3d AxisFromRotationMatrix3(Eigen::Matrix3d rot)
+{
+	return Eigen::Vector3d(rot(2,1) - rot(1,2), rot(0,2) - rot(2,0), rot(1,0) - rot(0,1));
+}
+
+double AngleFromRotationMatrix3(Eigen::Matrix3d rot)
+{
+	return acos((rot(0,0) + rot(1,1) + rot(2,2) - 1.0) / 2.0);
+}
+
+static const double MinSampleRotation = 0.05; // radians
+static const double MinSampleTranslation = 0.01; // meters
+
+bool MovedEnough(const Sample &last, const Sample &sample)
+{
+	if (!last.valid)
+		return true;
+
+	double refAngle = AngleFromRotationMatrix3(sample.ref.rot * last.ref.rot.transpose());
+	double targetAngle = AngleFromRotationMatrix3(sample.target.rot * last.target.rot.transpose());
+	if (std::max(refAngle, targetAngle) >= MinSampleRotation)
+		return true;
+
+	return (sample.ref.trans - last.ref.trans).norm() >= MinSampleTranslation ||
+		(sample.target.trans - last.target.trans).norm() >= MinSampleTranslation;
+}
+
+DSample DeltaRotationSamples(const Sample &s1, const Sample &s2)
+{
+	// Difference in rotation between samples.
+	auto dref = s1.ref.rot * s2.ref.rot.transpose();
+	auto dtarget = s1.target.rot * s2.target.rot.transpose();
+
+	// When stuck together, the two tracked objects rotate as a pair,
+	// therefore their axes of rotation must be equal between any given pair of samples.
+	DSample ds;
+	ds.ref = AxisFromRotationMatrix3(dref);
+	ds.target = AxisFromRotationMatrix3(dtarget);
+
+	// Reject samples that were too close to each other.
+	auto refA = AngleFromRotationMatrix3(dref);
+	auto targetA = AngleFromRotationMatrix3(dtarget);
+	ds.valid = refA > 0.4 && targetA > 0.4 && ds.ref.norm() > 0.01 && ds.target.norm() > 0.01;
+
+	// The axis is read from the skew part of the delta, whose magnitude is 2 sin(angle). Pose
+	// noise tilts it by roughly noise / sin(angle), so barely rotated pairs, and ones close to a
+	// half turn, say less about the axis than quarter turns. Poorly tracked samples count less too.
+	ds.weight = std::min(sin(refA), sin(targetA)) * std::min(s1.quality, s2.quality);
+	ds.valid = ds.valid && ds.weight > 0.0;
+
+	ds.ref.normalize();
+	ds.target.normalize();
+	return ds;
+}
+
+CompactRotations::Entry CompactRotations::FromSample(const Sample &sample)
+{
+	Eigen::Quaterniond ref(sample.ref.rot), target(sample.target.rot);
+	return {
+		{ (float) ref.w(), (float) ref.x(), (float) ref.y(), (float) ref.z() },
+		{ (float) target.w(), (float) target.x(), (float) target.y(), (float) target.z() },
+		(float) sample.quality
+	};
+}
+
+void CompactRotations::Reserve(size_t count)
+{
+	for (auto *component : { &refW, &refX, &refY, &refZ, &targetW, &targetX, &targetY, &targetZ, &quality })
+		component->reserve(count);
+}
+
+void CompactRotations::Clear()
+{
+	for (auto *component : { &refW, &refX, &refY, &refZ, &targetW, &targetX, &targetY, &targetZ, &quality })
+		component->clear();
+}
+
+void CompactRotations::Assign(const std::vector<Sample> &samples)
+{
+	Clear();
+	for (auto &sample : samples)
+		Push(sample);
+}
+
+void CompactRotations::Push(const Entry &entry)
+{
+	refW.push_back(entry.ref[0]); refX.push_back(entry.ref[1]); refY.push_back(entry.ref[2]); refZ.push_back(entry.ref[3]);
+	targetW.push_back(entry.target[0]); targetX.push_back(entry.target[1]); targetY.push_back(entry.target[2]); targetZ.push_back(entry.target[3]);
+	quality.push_back(entry.quality);
+}
+
+void CompactRotations::Set(size_t i, const Entry &entry)
+{
+	refW[i] = entry.ref[0]; refX[i] = entry.ref[1]; refY[i] = entry.ref[2]; refZ[i] = entry.ref[3];
+	targetW[i] = entry.target[0]; targetX[i] = entry.target[1]; targetY[i] = entry.target[2]; targetZ[i] = entry.target[3];
+	quality[i] = entry.quality;
+}
+
+/**
+ * Rotation from b to a as a * conj(b), turned to the hemisphere where it rotates by at most a
+ * half turn. Its vector part then points along the axis AxisFromRotationMatrix3 gives for the
+ * matrix delta, and its length is sin(angle / 2).
+ */
+static void QuaternionDelta(float aw, float ax, float ay, float az, float bw, float bx, float by, float bz, Eigen::Vector3d &axis, double &angle)
+{
+	float w = aw * bw + ax * bx + ay * by + az * bz;
+	float x = bw * ax - aw * bx - ay * bz + az * by;
+	float y = bw * ay - aw * by - az * bx + ax * bz;
+	float z = bw * az - aw * bz - ax * by + ay * bx;
+	if (w < 0)
+	{
+		w = -w; x = -x; y = -y; z = -z;
+	}
+
+	axis = Eigen::Vector3d(x, y, z);
+	angle = 2.0 * atan2(axis.norm(), (double) w);
+}
+
+DSample CompactRotations::Delta(const Entry &entry, size_t i) const
+{
+	DSample ds;
+	double refA, targetA;
+	QuaternionDelta(entry.ref[0], entry.ref[1], entry.ref[2], entry.ref[3], refW[i], refX[i], refY[i], refZ[i], ds.ref, refA);
+	QuaternionDelta(entry.target[0], entry.target[1], entry.target[2], entry.target[3], targetW[i], targetX[i], targetY[i], targetZ[i], ds.target, targetA);
+
+	// The same tests and weight as DeltaRotationSamples, whose skew axis is 2 sin(angle) long.
+	ds.valid = refA > 0.4 && targetA > 0.4 && 2.0 * sin(refA) > 0.01 && 2.0 * sin(targetA) > 0.01;
+	ds.weight = std::min(sin(refA), sin(targetA)) * std::min(entry.quality, quality[i]);
+	ds.valid = ds.valid && ds.weight > 0.0;
+
+	ds.ref.normalize();
+	ds.target.normalize();
+	return ds;
+}
+
+Eigen::Matrix3d RotationAccumulator::CrossCovariance() const
+{
+	if (sumWeight <= 0.0)
+		return Eigen::Matrix3d::Zero();
+
+	return sumRefTarget - sumRef * sumTarget.transpose() / sumWeight;
+}
+
+double RotationAccumulator::AxisCoverage() const
+{
+	if (sumWeight <= 0.0)
+		return 0.0;
+
+	Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> spread(sumTargetTarget / sumWeight, Eigen::EigenvaluesOnly);
+	return std::min(std::max(spread.eigenvalues()(0) * 3.0, 0.0), 1.0);
+}
+
+// From the sums alone: the axes are unit vectors, so |ref - rot * target|^2 = 2 - 2 ref . (rot * target).
+double RotationAccumulator::AxisErrorRMS(const Eigen::Matrix3d &rot) const
+{
+	if (sumWeight <= 0.0)
+		return 0.0;
+
+	double chordSquared = 2.0 - 2.0 * (rot * sumRefTarget.transpose()).trace() / sumWeight;
+	return 2.0 * asin(std::min(sqrt(std::max(chordSquared, 0.0)) / 2.0, 1.0));
+}
+
+// Below this the threads cost more than the pairs.
+static const size_t MinParallelSamples = 200;
+static const unsigned MaxPairWorkers = 8;
+
+/**
+ * Runs fn(accumulator, i) for every sample index, split over the available cores, and merges
+ * the per-worker accumulators at the end. Pair work grows with the index up to the stride
+ * limit, so workers take interleaved indices instead of contiguous ranges to stay balanced.
+ * Merging in worker order keeps the result the same from run to run on one machine.
+ */
+template<typename Accumulator, typename Fn>
+static Accumulator AccumulateParallel(size_t count, Fn fn)
+{
+	unsigned workers = 1;
+	if (count >= MinParallelSamples)
+		workers = std::min(std::max(std::thread::hardware_concurrency(), 1u), MaxPairWorkers);
+
+	std::vector<Accumulator> partial(workers);
+	std::vector<std::thread> threads;
+	threads.reserve(workers - 1);
+	for (unsigned w = 1; w < workers; w++)
+	{
+		threads.emplace_back([&, w]() {
+			for (size_t i = w; i < count; i += workers)
+				fn(partial[w], i);
+		});
+	}
+
+	for (size_t i = 0; i < count; i += workers)
+		fn(partial[0], i);
+
+	for (auto &thread : threads)
+		thread.join();
+	for (unsigned w = 1; w < workers; w++)
+		partial[0].Merge(partial[w]);
+	return partial[0];
+}
+
+RotationAccumulator AccumulateAllRotationPairs(const CompactRotations &rotations)
+{
+	return AccumulateParallel<RotationAccumulator>(rotations.size(), [&](RotationAccumulator &acc, size_t i) {
+		AccumulateRotationPairs(acc, rotations, i);
+	});
+}
+
+Eigen::Matrix3d SolveRotation(const RotationAccumulator &acc)
+{
+	Eigen::Matrix3d crossCV = acc.CrossCovariance();
+
+	Eigen::JacobiSVD<Eigen::Matrix3d> svd(crossCV, Eigen::ComputeFullU | Eigen::ComputeFullV);
+
+	Eigen::Matrix3d i = Eigen::Matrix3d::Identity();
+	if ((svd.matrixU() * svd.matrixV().transpose()).determinant() < 0)
+	{
+		i(2,2) = -1;
+	}
+
+	Eigen::Matrix3d rot = svd.matrixV() * i * svd.matrixU().transpose();
+	rot.transposeInPlace();
+	return rot;
+}
+
+Eigen::Quaterniond SolveRotationQuaternion(const RotationAccumulator &acc)
+{
+	// Horn sums target * ref^T, the transpose of the cross-covariance.
+	Eigen::Matrix3d s = acc.CrossCovariance().transpose();
+
+	Eigen::Matrix4d n;
+	n << s(0, 0) + s(1, 1) + s(2, 2), s(1, 2) - s(2, 1), s(2, 0) - s(0, 2), s(0, 1) - s(1, 0),
+		s(1, 2) - s(2, 1), s(0, 0) - s(1, 1) - s(2, 2), s(0, 1) + s(1, 0), s(2, 0) + s(0, 2),
+		s(2, 0) - s(0, 2), s(0, 1) + s(1, 0), -s(0, 0) + s(1, 1) - s(2, 2), s(1, 2) + s(2, 1),
+		s(0, 1) - s(1, 0), s(2, 0) + s(0, 2), s(1, 2) + s(2, 1), -s(0, 0) - s(1, 1) + s(2, 2);
+
+	// Eigenvalues come in increasing order.
+	Eigen::SelfAdjointEigenSolver<Eigen::Matrix4d> eigen(n);
+	Eigen::Vector4d q = eigen.eigenvectors().col(3);
+	return Eigen::Quaterniond(q(0), q(1), q(2), q(3)).normalized();
+}
+
+Eigen::Matrix3d SolveYaw(const RotationAccumulator &acc)
+{
+	// Maximizes the sum of w * ref . (R target) = trace(R^T C), which for R about Y is
+	// cos * (C00 + C22) + sin * (C02 - C20) + C11.
+	Eigen::Matrix3d crossCV = acc.CrossCovariance();
+	double yaw = atan2(crossCV(0, 2) - crossCV(2, 0), crossCV(0, 0) + crossCV(2, 2));
+	return Eigen::AngleAxisd(yaw, Eigen::Vector3d::UnitY()).toRotationMatrix();
+}
+
+static Eigen::Matrix3d SolveRotation(const RotationAccumulator &acc, RotationModel model)
+{
+	return model == RotationModel::GravityAligned ? SolveYaw(acc) : SolveRotation(acc);
+}
+
+// Euler angles as CalibrationSolution holds them. A yaw is kept as one, where decomposing its
+// matrix could give the equivalent angles with roll and pitch at 180 degrees.
+static Eigen::Vector3d SolutionEuler(const Eigen::Matrix3d &rot, RotationModel model)
+{
+	if (model == RotationModel::GravityAligned)
+		return Eigen::Vector3d(0.0, atan2(rot(0, 2), rot(0, 0)) * 180.0 / EIGEN_PI, 0.0);
+	return rot.eulerAngles(2, 1, 0) * 180.0 / EIGEN_PI;
+}
+
+static Eigen::Vector3d CalibrateRotation(std::string &log, const RotationAccumulator &acc, size_t sampleCount, RotationModel model)
+{
+	SPACECAL_ZONE("Solve: rotation");
+	char buf[256];
+	snprintf(buf, sizeof buf, "Got %zd samples with %zd delta samples, mean weight %.2f\n", sampleCount, acc.count, acc.count ? acc.sumWeight / acc.count : 0.0);
+	log += buf;
+
+	Eigen::Matrix3d rot = SolveRotation(acc, model);
+	Eigen::Vector3d euler = SolutionEuler(rot, model);
+
+	snprintf(buf, sizeof buf, "Calibrated rotation: yaw=%.2f pitch=%.2f roll=%.2f\n", euler[1], euler[2], euler[0]);
+	log += buf;
+	return euler;
+}
+
+// RANSAC over rotation hypotheses solved from small random subsets. Each sample is checked
+// against a few fixed partners, and is an inlier when most of its pairs agree with the hypothesis.
+static const int RansacIterations = 32;
+static const size_t RansacSubsetSize = 20;
+static const size_t RansacPairsPerSample = 8;
+static const double RansacInlierAngle = 3.0 * EIGEN_PI / 180.0;
+
+void SolveWorkspace::Reserve(size_t sampleCount)
+{
+	samples.reserve(sampleCount);
+	rotations.Reserve(sampleCount);
+	ransacPairs.reserve(sampleCount * RansacPairsPerSample);
+	indices.reserve(sampleCount);
+	agree.reserve(sampleCount);
+	total.reserve(sampleCount);
+	inliers.reserve(sampleCount);
+	bestInliers.reserve(sampleCount);
+	kept.reserve(sampleCount);
+	keptRotations.Reserve(sampleCount);
+	refRotT.reserve(sampleCount);
+	targetRotT.reserve(sampleCount);
+	refOffset.reserve(sampleCount);
+	targetOffset.reserve(sampleCount);
+	robustWeights.reserve(sampleCount);
+	robustResiduals.reserve(sampleCount);
+	robustSorted.reserve(sampleCount);
+	refRot.reserve(sampleCount);
+	refTrans.reserve(sampleCount);
+	targetTrans.reserve(sampleCount);
+	quality.reserve(sampleCount);
+	batch.reserve(sampleCount * 9);
+}
+
+// Leaves only the inliers in workspace.samples, returns whether any were rejected.
+static bool RejectRotationOutliers(std::string &log, SolveWorkspace &workspace, RotationModel model)
+{
+	SPACECAL_ZONE("Solve: rotation outliers");
+	auto &samples = workspace.samples;
+	auto &rotations = workspace.rotations;
+	size_t n = samples.size();
+	if (n < RansacSubsetSize * 2)
+		return false;
+
+	// Pair axes don't depend on the hypothesis, so they are computed once.
+	auto &pairs = workspace.ransacPairs;
+	pairs.clear();
+	for (size_t i = 0; i < n; i++)
+	{
+		for (size_t k = 1; k <= RansacPairsPerSample; k++)
+		{
+			size_t j = (i + k * n / (RansacPairsPerSample + 1)) % n;
+			auto delta = rotations.Delta(rotations[i], j);
+			if (delta.valid)
+				pairs.push_back({ i, j, delta });
+		}
+	}
+
+	std::mt19937 rng((unsigned) n);
+	auto &indices = workspace.indices;
+	indices.resize(n);
+	for (size_t i = 0; i < n; i++)
+		indices[i] = i;
+
+	auto &agree = workspace.agree, &total = workspace.total;
+	auto &inliers = workspace.inliers, &bestInliers = workspace.bestInliers;
+	agree.resize(n);
+	total.resize(n);
+	inliers.resize(n);
+	bestInliers.assign(n, true);
+	double bestScore = -1.0;
+	size_t bestCount = n;
+
+	for (int iteration = 0; iteration < RansacIterations; iteration++)
+	{
+		for (size_t i = 0; i < RansacSubsetSize; i++)
+			std::swap(indices[i], indices[i + rng() % (n - i)]);
+
+		RotationAccumulator subset;
+		for (size_t i = 0; i < RansacSubsetSize; i++)
+		{
+			for (size_t j = 0; j < i; j++)
+			{
+				auto delta = rotations.Delta(rotations[indices[i]], indices[j]);
+				if (delta.valid)
+					subset.Add(delta);
+			}
+		}
+		if (subset.count < 3)
+			continue;
+
+		Eigen::Matrix3d rot = SolveRotation(subset, model);
+
+		std::fill(agree.begin(), agree.end(), 0);
+		std::fill(total.begin(), total.end(), 0);
+		for (auto &pair : pairs)
+		{
+			double cosAngle = pair.delta.ref.dot(rot * pair.delta.target);
+			int ok = cosAngle > cos(RansacInlierAngle) ? 1 : 0;
+			agree[pair.a] += ok; total[pair.a]++;
+			agree[pair.b] += ok; total[pair.b]++;
+		}
+
+		double score = 0.0;
+		size_t count = 0;
+		for (size_t i = 0; i < n; i++)
+		{
+			// A sample without any usable pair can't be judged, so keep it.
+			inliers[i] = agree[i] * 2 >= total[i];
+			if (inliers[i])
+			{
+				score += samples[i].quality;
+				count++;
+			}
+		}
+
+		if (score > bestScore)
+		{
+			bestScore = score;
+			bestInliers = inliers;
+			bestCount = count;
+		}
+	}
+
+	// Without a clear majority, rejecting anything would just be guessing.
+	if (bestCount == n || bestCount * 2 < n)
+		return false;
+
+	// Swapped rather than copied back, so both buffers keep their capacity.
+	auto &kept = workspace.kept;
+	auto &keptRotations = workspace.keptRotations;
+	kept.clear();
+	keptRotations.Clear();
+	for (size_t i = 0; i < n; i++)
+	{
+		if (bestInliers[i])
+		{
+			kept.push_back(samples[i]);
+			keptRotations.Push(rotations[i]);
+		}
+	}
+	samples.swap(kept);
+	std::swap(rotations, keptRotations);
+
+	char buf[256];
+	snprintf(buf, sizeof buf, "Rejected %zd of %zd samples as outliers\n", n - bestCount, n);
+	log += buf;
+	return true;
+}
+
+// Normal equations of the stacked pairwise translation system.
+struct TranslationAccumulator
+{
+	Eigen::Matrix3d normal = Eigen::Matrix3d::Zero();
+	Eigen::Vector3d rhs = Eigen::Vector3d::Zero();
+
+	void Merge(const TranslationAccumulator &other)
+	{
+		normal += other.normal;
+		rhs += other.rhs;
+	}
+};
+
+// Accumulated as pairs are visited, so memory use does not depend on the number of pairs. A
+// pair weighs the product of its samples' weights, all 1 without any.
+static TranslationAccumulator AccumulateTranslationPairs(const SolveWorkspace &workspace, const std::vector<double> *weights)
+{
+	auto &QA = workspace.refRotT, &QB = workspace.targetRotT;
+	auto &CA = workspace.refOffset, &CB = workspace.targetOffset;
+	return AccumulateParallel<TranslationAccumulator>(QA.size(), [&](TranslationAccumulator &partial, size_t i) {
+		auto &normal = partial.normal;
+		auto &rhs = partial.rhs;
+		size_t stride = SamplePairStride(i);
+		for (size_t j = i % stride; j < i; j += stride)
+		{
+			double w = weights ? (*weights)[i] * (*weights)[j] : 1.0;
+			if (w <= 0.0)
+				continue;
+
+			Eigen::Matrix3d dQA = QA[j] - QA[i];
+			normal.noalias() += w * dQA.transpose() * dQA;
+			rhs.noalias() += w * dQA.transpose() * (CA[j] - CA[i]);
+
+			Eigen::Matrix3d dQB = QB[j] - QB[i];
+			normal.noalias() += w * dQB.transpose() * dQB;
+			rhs.noalias() += w * dQB.transpose() * (CB[j] - CB[i]);
+		}
+	});
+}
+
+// SVD rather than a Cholesky factorization so a degenerate motion set still yields the minimum-norm solution.
+static Eigen::Vector3d SolveTranslationPairs(const TranslationAccumulator &acc)
+{
+	return Eigen::JacobiSVD<Eigen::Matrix3d>(acc.normal, Eigen::ComputeFullU | Eigen::ComputeFullV).solve(acc.rhs);
+}
+
+static const int MaxRobustIterations = 10;
+static const double RobustConvergence = 1e-5; // m the translation may still move by.
+static const double MinRobustSigma = 0.001; // m, so a near perfect fit doesn't treat plain noise as outliers.
+static const double HuberThreshold = 1.345, TukeyThreshold = 4.685; // In sigmas, the usual 95% efficiency tunings.
+
+/**
+ * Iteratively reweighted least squares on the same pairs. With the translation right, every
+ * sample puts the target at one offset from each device, QA t - CA and QB t - CB, so a sample's
+ * residual is how far it puts it from the weighted mean offsets. Each iteration only sums the
+ * 3x3 normal equations again, so it costs about what the first solve did.
+ */
+static Eigen::Vector3d ReweightTranslation(std::string &log, SolveWorkspace &workspace, Eigen::Vector3d trans)
+{
+	SPACECAL_ZONE("Solve: robust translation");
+	auto &QA = workspace.refRotT, &QB = workspace.targetRotT;
+	auto &CA = workspace.refOffset, &CB = workspace.targetOffset;
+	auto &weights = workspace.robustWeights, &residuals = workspace.robustResiduals;
+	size_t n = QA.size();
+	weights.assign(n, 1.0);
+	residuals.resize(n);
+
+	int iteration = 0;
+	double sigma = 0.0;
+	while (iteration < MaxRobustIterations)
+	{
+		iteration++;
+		Eigen::Vector3d meanA = Eigen::Vector3d::Zero(), meanB = Eigen::Vector3d::Zero();
+		double total = 0.0;
+		for (size_t i = 0; i < n; i++)
+		{
+			meanA += weights[i] * (QA[i] * trans - CA[i]);
+			meanB += weights[i] * (QB[i] * trans - CB[i]);
+			total += weights[i];
+		}
+		if (total <= 0.0)
+			break;
+		meanA /= total;
+		meanB /= total;
+
+		for (size_t i = 0; i < n; i++)
+			residuals[i] = sqrt((QA[i] * trans - CA[i] - meanA).squaredNorm() + (QB[i] * trans - CB[i] - meanB).squaredNorm());
+
+		// The median goes through a copy, the residuals are still needed in sample order.
+		workspace.robustSorted.assign(residuals.begin(), residuals.end());
+		auto middle = workspace.robustSorted.begin() + n / 2;
+		std::nth_element(workspace.robustSorted.begin(), middle, workspace.robustSorted.end());
+		sigma = std::max(1.4826 * *middle, MinRobustSigma);
+
+		for (size_t i = 0; i < n; i++)
+		{
+			double r = residuals[i] / sigma;
+			if (workspace.robustLoss == RobustLoss::Huber)
+			{
+				weights[i] = r <= HuberThreshold ? 1.0 : HuberThreshold / r;
+			}
+			else
+			{
+				double u = 1.0 - (r / TukeyThreshold) * (r / TukeyThreshold);
+				weights[i] = r < TukeyThreshold ? u * u : 0.0;
+			}
+		}
+
+		Eigen::Vector3d next = SolveTranslationPairs(AccumulateTranslationPairs(workspace, &weights));
+		double moved = (next - trans).norm();
+		trans = next;
+		if (moved < RobustConvergence)
+			break;
+	}
+
+	size_t downweighted = 0;
+	for (double weight : weights)
+		downweighted += weight < 0.5 ? 1 : 0;
+
+	char buf[256];
+	snprintf(buf, sizeof buf, "%s weights after %d iterations: sigma %.2f mm, %zd of %zd samples below half weight\n",
+		workspace.robustLoss == RobustLoss::Huber ? "Huber" : "Tukey", iteration, sigma * 1000.0, downweighted, n);
+	log += buf;
+	return trans;
+}
+
+static Eigen::Vector3d CalibrateTranslation(std::string &log, SolveWorkspace &workspace, const Eigen::Matrix3d &rotMat)
+{
+	SPACECAL_ZONE("Solve: translation");
+	auto &samples = workspace.samples;
+	auto &QA = workspace.refRotT, &QB = workspace.targetRotT;
+	auto &CA = workspace.refOffset, &CB = workspace.targetOffset;
+	workspace.robustWeights.clear();
+
+	// The per sample factors of every pair term, with the target rotated by the solved rotation.
+	size_t n = samples.size();
+	QA.resize(n);
+	QB.resize(n);
+	CA.resize(n);
+	CB.resize(n);
+	for (size_t i = 0; i < n; i++)
+	{
+		Eigen::Vector3d offset = samples[i].ref.trans - rotMat * samples[i].target.trans;
+		QA[i] = samples[i].ref.rot.transpose();
+		QB[i] = (rotMat * samples[i].target.rot).transpose();
+		CA[i] = QA[i] * offset;
+		CB[i] = QB[i] * offset;
+	}
+
+	Eigen::Vector3d trans = SolveTranslationPairs(AccumulateTranslationPairs(workspace, nullptr));
+	if (workspace.robustLoss != RobustLoss::None && n > 0)
+		trans = ReweightTranslation(log, workspace, trans);
+	auto transcm = trans * 100.0;
+
+	char buf[256];
+	snprintf(buf, sizeof buf, "Calibrated translation x=%.2f y=%.2f z=%.2f\n", transcm[0], transcm[1], transcm[2]);
+	log += buf;
+	return transcm;
+}
+
+Eigen::Quaterniond EulerQuat(Eigen::Vector3d eulerdeg)
+{
+	auto euler = eulerdeg * EIGEN_PI / 180.0;
+
+	return Eigen::AngleAxisd(euler(0), Eigen::Vector3d::UnitZ()) *
+		Eigen::AngleAxisd(euler(1), Eigen::Vector3d::UnitY()) *
+		Eigen::AngleAxisd(euler(2), Eigen::Vector3d::UnitX());
+}
+
+Eigen::Vector3d EulerFromQuat(const Eigen::Quaterniond &quat)
+{
+	return quat.toRotationMatrix().eulerAngles(2, 1, 0) * 180.0 / EIGEN_PI;
+}
+
+// The valid samples split into the arrays refinement and sensitivity read, in the workspace's buffers.
+struct SensitivitySamples
+{
+	std::vector<Eigen::Matrix3d> &refRot;
+	std::vector<Eigen::Vector3d> &refTrans;
+	std::vector<Eigen::Vector3d> &targetTrans;
+	std::vector<double> &quality;
+	std::vector<double> &batch; // Target positions as x, then y, then z, and room for RetargetingErrorRMS.
+
+	explicit SensitivitySamples(SolveWorkspace &workspace) :
+		refRot(workspace.refRot), refTrans(workspace.refTrans), targetTrans(workspace.targetTrans), quality(workspace.quality),
+		batch(workspace.batch)
+	{
+		refRot.clear();
+		refTrans.clear();
+		targetTrans.clear();
+		quality.clear();
+
+		auto &samples = workspace.samples;
+		bool weighted = workspace.robustWeights.size() == samples.size();
+		for (size_t i = 0; i < samples.size(); i++)
+		{
+			auto &sample = samples[i];
+			if (!sample.valid) continue;
+			refRot.push_back(sample.ref.rot);
+			refTrans.push_back(sample.ref.trans);
+			targetTrans.push_back(sample.target.trans);
+			quality.push_back(weighted ? sample.quality * workspace.robustWeights[i] : sample.quality);
+		}
+
+		size_t n = targetTrans.size();
+		batch.resize(n * 9);
+		for (size_t s = 0; s < n; s++)
+		{
+			for (int axis = 0; axis < 3; axis++)
+				batch[axis * n + s] = targetTrans[s](axis);
+		}
+	}
+
+	size_t size() const { return refRot.size(); }
+
+	// Part 0 holds the target positions, 1 and 2 are scratch space, even for a const sample set.
+	Vector3Array Batch(size_t part) const
+	{
+		size_t n = size();
+		double *first = batch.data() + part * 3 * n;
+		return { first, first + n, first + 2 * n };
+	}
+};
+
+/**
+ * RMS position error of the samples for each of count candidate rotations. The reference side
+ * doesn't depend on the rotation, so it's only computed once per sample, and each candidate
+ * then rotates every target position in one batch. The first candidate's error is also split
+ * by axis, and kept per sample when residuals is set.
+ */
+static void RetargetingErrorRMS(
+	const SensitivitySamples& samples,
+	const Eigen::Vector3d &hmdToTargetPos,
+	const Eigen::Vector3d &trans,
+	const Eigen::Matrix3d *rotMats,
+	double scale,
+	double *errors,
+	size_t count,
+	Eigen::Vector3d &axisErrors,
+	std::vector<SampleResidual> *residuals
+) {
+	for (size_t i = 0; i < count; i++)
+		errors[i] = 0;
+	axisErrors.setZero();
+	if (residuals)
+		residuals->clear();
+
+	size_t n = samples.size();
+	Vector3Array target = samples.Batch(0), world = samples.Batch(1), rotated = samples.Batch(2);
+	for (size_t s = 0; s < n; s++) {
+		// Compute it based on the HMD pose offset
+		const Eigen::Vector3d hmdToWorld = samples.refRot[s] * hmdToTargetPos + samples.refTrans[s] - trans;
+		world.x[s] = hmdToWorld(0);
+		world.y[s] = hmdToWorld(1);
+		world.z[s] = hmdToWorld(2);
+	}
+
+	// Compute error term against each transformation
+	for (size_t i = 0; i < count; i++) {
+		double m[3][3];
+		for (int row = 0; row < 3; row++)
+			for (int col = 0; col < 3; col++)
+				m[row][col] = rotMats[i](row, col);
+		matrixRotateVectors(m, target, rotated, n);
+
+		double error = 0;
+		for (size_t s = 0; s < n; s++) {
+			double dx = world.x[s] - scale * rotated.x[s];
+			double dy = world.y[s] - scale * rotated.y[s];
+			double dz = world.z[s] - scale * rotated.z[s];
+			error += dx * dx + dy * dy + dz * dz;
+			if (i == 0) {
+				Eigen::Vector3d base(dx, dy, dz);
+				axisErrors += base.cwiseAbs2();
+				if (residuals)
+					residuals->push_back({ samples.refTrans[s], base, samples.refRot[s].transpose() * base, samples.quality[s] });
+			}
+		}
+		errors[i] = error;
+	}
+
+	for (size_t i = 0; i < count; i++)
+		errors[i] = sqrt(errors[i] / samples.size());
+	axisErrors = (axisErrors / (double) samples.size()).cwiseSqrt();
+}
+
+static Eigen::Vector3d DeriveRefToTargetOffset(
+	const SensitivitySamples& samples,
+	const Eigen::Vector3d &trans,
+	const Eigen::Matrix3d &rotMat,
+	double scale
+) {
+	Eigen::Vector3d accum = Eigen::Vector3d::Zero();
+
+	for (size_t s = 0; s < samples.size(); s++) {
+		// Apply transformation
+		const Eigen::Vector3d targetToWorld = trans + scale * (rotMat * samples.targetTrans[s]);
+
+		// Now move the transform from world to HMD space, the reference pose is rigid so its inverse is the transpose
+		accum += samples.refRot[s].transpose() * (targetToWorld - samples.refTrans[s]);
+	}
+
+	return accum / (double) samples.size();
+}
+
+static const int RefineMaxIterations = 20;
+static const double RefineMinStep = 1e-9; // Squared norm of the parameter step.
+
+// How far a prior is expected to be off after drift, as one standard deviation. A result
+// further than PriorGate of them away means the prior was wrong rather than drifted.
+static const double PriorRotationSigma = 0.15; // degrees
+static const double PriorTranslationSigma = 0.15; // cm
+static const double PriorGate = 3.0;
+
+// Floor of the data noise the prior is weighed against, so noiseless data still uses it.
+static const double MinPriorNoise = 1e-4; // meters
+
+// The rotation step that would take the prior onto rot, as an axis scaled by its angle.
+static Eigen::Vector3d PriorRotationResidual(const Eigen::Matrix3d &rot, const Eigen::Matrix3d &prior)
+{
+	Eigen::AngleAxisd difference(rot * prior.transpose());
+	return difference.angle() * difference.axis();
+}
+
+static Eigen::Matrix3d Skew(const Eigen::Vector3d &v)
+{
+	Eigen::Matrix3d m;
+	m << 0, -v(2), v(1),
+		v(2), 0, -v(0),
+		-v(1), v(0), 0;
+	return m;
+}
+
+// Weighted sum of squared RetargetingErrorRMS residuals.
+static double RefineCost(const SensitivitySamples &samples, const Eigen::Matrix3d &rot, const Eigen::Vector3d &trans, const Eigen::Vector3d &offset, double scale)
+{
+	double cost = 0.0;
+	for (size_t s = 0; s < samples.size(); s++)
+	{
+		Eigen::Vector3d r = samples.refRot[s] * offset + samples.refTrans[s] - trans - scale * (rot * samples.targetTrans[s]);
+		cost += samples.quality[s] * r.squaredNorm();
+	}
+	return cost;
+}
+
+// Scale mismatches beyond this are treated as a failed estimate rather than real.
+static const double MaxScaleDeviation = 0.2;
+
+/**
+ * With the rotation fixed, the residual is linear in offset, translation and scale, so they
+ * have a closed form least squares solution, the same idea as Umeyama's alignment with the
+ * offset standing in for the unknown correspondence. Gives the joint refinement its scale to
+ * start from. Returns false if the motion doesn't pin the scale down.
+ */
+static bool EstimateScale(const SensitivitySamples &samples, const Eigen::Matrix3d &rot, Eigen::Vector3d &trans, Eigen::Vector3d &offset, double &scale)
+{
+	typedef Eigen::Matrix<double, 7, 7> Matrix7d;
+	typedef Eigen::Matrix<double, 7, 1> Vector7d;
+
+	// Unknowns offset, translation, scale: refRot * offset - trans - scale * rot * targetTrans = -refTrans.
+	Matrix7d normal = Matrix7d::Zero();
+	Vector7d rhs = Vector7d::Zero();
+	for (size_t s = 0; s < samples.size(); s++)
+	{
+		Eigen::Matrix<double, 3, 7> J;
+		J.block<3, 3>(0, 0) = samples.refRot[s];
+		J.block<3, 3>(0, 3) = -Eigen::Matrix3d::Identity();
+		J.col(6) = -(rot * samples.targetTrans[s]);
+
+		double w = samples.quality[s];
+		normal.noalias() += w * J.transpose() * J;
+		rhs.noalias() -= w * J.transpose() * samples.refTrans[s];
+	}
+
+	Eigen::JacobiSVD<Matrix7d> svd(normal, Eigen::ComputeFullU | Eigen::ComputeFullV);
+	auto &singular = svd.singularValues();
+	if (singular(6) <= singular(0) * 1e-9)
+		return false;
+
+	Vector7d x = svd.solve(rhs);
+	if (std::abs(x(6) - 1.0) > MaxScaleDeviation)
+		return false;
+
+	offset = x.head<3>();
+	trans = x.segment<3>(3);
+	scale = x(6);
+	return true;
+}
+
+/**
+ * Levenberg-Marquardt over rotation, translation and the reference to target offset at once,
+ * minimizing the same position residual ComputeSensitivity reports. The separate rotation and
+ * translation solves give the starting point, so it only has to remove the error the second
+ * solve inherited from the first, which takes a few iterations. Rotation steps are applied on
+ * the left as exp(w) * rot, so the normal equations stay small and fixed-size. With solveScale
+ * the scale is a tenth parameter, otherwise it stays at its given value. A gravity aligned
+ * solve only steps about Y, which keeps the rotation a yaw. A prior adds a residual for each of
+ * its rotation and translation, weighted by the noise of the data at the starting point over
+ * the prior's sigma, so the two combine as independent measurements would. The normal matrix
+ * at the solution, scaled by the residual variance, gives the covariance for uncertainty.
+ */
+static bool RefineCalibration(std::string &log, const SensitivitySamples &valid, Eigen::Matrix3d &rotation, Eigen::Vector3d &translation, double &scale, bool solveScale,
+	RotationModel model, const CalibrationPrior *prior, SolveUncertainty &uncertainty)
+{
+	SPACECAL_ZONE("Solve: refinement");
+	typedef Eigen::Matrix<double, 10, 10> Matrix10d;
+	typedef Eigen::Matrix<double, 10, 1> Vector10d;
+
+	if (valid.size() < 3)
+		return false;
+
+	Eigen::Matrix3d rot = rotation;
+	Eigen::Vector3d trans = translation;
+	Eigen::Vector3d offset = DeriveRefToTargetOffset(valid, trans, rot, scale);
+
+	double weight = 0.0;
+	for (double quality : valid.quality)
+		weight += quality;
+
+	double priorRotationWeight = 0.0, priorTranslationWeight = 0.0;
+	Eigen::Matrix3d priorRot = Eigen::Matrix3d::Identity();
+	Eigen::Vector3d priorTrans = Eigen::Vector3d::Zero();
+	if (prior)
+	{
+		double noise = std::max(RefineCost(valid, rot, trans, offset, scale) / (3.0 * weight), MinPriorNoise * MinPriorNoise);
+		double rotationSigma = PriorRotationSigma * EIGEN_PI / 180.0, translationSigma = PriorTranslationSigma * 0.01;
+		priorRotationWeight = noise / (rotationSigma * rotationSigma);
+		priorTranslationWeight = noise / (translationSigma * translationSigma);
+		priorRot = prior->rotation;
+		priorTrans = prior->translation * 0.01;
+	}
+
+	auto totalCost = [&](const Eigen::Matrix3d &atRot, const Eigen::Vector3d &atTrans, const Eigen::Vector3d &atOffset, double atScale) {
+		double cost = RefineCost(valid, atRot, atTrans, atOffset, atScale);
+		if (prior)
+			cost += priorRotationWeight * PriorRotationResidual(atRot, priorRot).squaredNorm() + priorTranslationWeight * (atTrans - priorTrans).squaredNorm();
+		return cost;
+	};
+
+	double initialCost = totalCost(rot, trans, offset, scale), initialScale = scale;
+
+	if (solveScale)
+	{
+		Eigen::Vector3d scaledTrans = trans, scaledOffset = offset;
+		double estimated = scale;
+		if (EstimateScale(valid, rot, scaledTrans, scaledOffset, estimated))
+		{
+			trans = scaledTrans;
+			offset = scaledOffset;
+			scale = estimated;
+		}
+		else
+		{
+			log += "Motion doesn't determine the scale, keeping it\n";
+			solveScale = false;
+		}
+	}
+
+	double cost = totalCost(rot, trans, offset, scale);
+	double lambda = 1e-3;
+	int iteration = 0;
+
+	Matrix10d H;
+	Vector10d g;
+
+	// Residual r = refRot * offset + refTrans - trans - scale * rot * targetTrans, Jacobian
+	// columns for the rotation step, translation, offset and scale in that order.
+	auto buildNormalEquations = [&]() {
+		H.setZero();
+		g.setZero();
+		for (size_t s = 0; s < valid.size(); s++)
+		{
+			Eigen::Vector3d rotated = rot * valid.targetTrans[s];
+			Eigen::Vector3d r = valid.refRot[s] * offset + valid.refTrans[s] - trans - scale * rotated;
+
+			Eigen::Matrix<double, 3, 10> J;
+			J.block<3, 3>(0, 0) = scale * Skew(rotated);
+			J.block<3, 3>(0, 3) = -Eigen::Matrix3d::Identity();
+			J.block<3, 3>(0, 6) = valid.refRot[s];
+			J.col(9) = -rotated;
+
+			double w = valid.quality[s];
+			H.noalias() += w * J.transpose() * J;
+			g.noalias() += w * J.transpose() * r;
+		}
+
+		// The prior's residuals move one for one with the rotation step and the translation.
+		if (prior)
+		{
+			H.block<3, 3>(0, 0).diagonal().array() += priorRotationWeight;
+			g.head<3>() += priorRotationWeight * PriorRotationResidual(rot, priorRot);
+			H.block<3, 3>(3, 3).diagonal().array() += priorTranslationWeight;
+			g.segment<3>(3) += priorTranslationWeight * (trans - priorTrans);
+		}
+
+		// Fixed parameters get an identity row, so their step solves to zero.
+		auto fix = [&](int parameter) {
+			H.row(parameter).setZero();
+			H.col(parameter).setZero();
+			H(parameter, parameter) = 1.0;
+			g(parameter) = 0.0;
+		};
+		if (!solveScale)
+			fix(9);
+		if (model == RotationModel::GravityAligned)
+		{
+			fix(0);
+			fix(2);
+		}
+	};
+
+	for (; iteration < RefineMaxIterations; iteration++)
+	{
+		buildNormalEquations();
+
+		bool improved = false;
+		Vector10d step;
+		while (lambda < 1e10)
+		{
+			Matrix10d damped = H;
+			damped.diagonal() += lambda * H.diagonal();
+			step = damped.ldlt().solve(-g);
+
+			Eigen::Vector3d w = step.head<3>();
+			Eigen::Matrix3d stepRot = w.norm() > 0.0 ? Eigen::AngleAxisd(w.norm(), w.normalized()).toRotationMatrix() : Eigen::Matrix3d::Identity();
+			Eigen::Matrix3d newRot = stepRot * rot;
+			Eigen::Vector3d newTrans = trans + step.segment<3>(3);
+			Eigen::Vector3d newOffset = offset + step.segment<3>(6);
+			double newScale = scale + step(9);
+
+			double newCost = totalCost(newRot, newTrans, newOffset, newScale);
+			if (newCost < cost)
+			{
+				rot = newRot;
+				trans = newTrans;
+				offset = newOffset;
+				scale = newScale;
+				cost = newCost;
+				lambda = std::max(lambda * 0.1, 1e-12);
+				improved = true;
+				break;
+			}
+			lambda *= 10.0;
+		}
+
+		if (!improved || step.squaredNorm() < RefineMinStep)
+			break;
+	}
+
+	if (!(cost < initialCost) || (solveScale && std::abs(scale - 1.0) > MaxScaleDeviation))
+	{
+		scale = initialScale;
+		return false;
+	}
+
+	// Re-orthonormalized, the accumulated steps drift slightly off a rotation.
+	rotation = Eigen::Quaterniond(rot).normalized().toRotationMatrix();
+	translation = trans;
+
+	bool yawOnly = model == RotationModel::GravityAligned;
+	int freeParameters = (solveScale ? 10 : 9) - (yawOnly ? 2 : 0);
+	int residuals = 3 * (int) valid.size() + (prior ? 6 : 0);
+	if (residuals > freeParameters)
+	{
+		buildNormalEquations();
+		Eigen::FullPivLU<Matrix10d> lu(H);
+		if (lu.isInvertible())
+		{
+			Matrix10d covariance = lu.inverse() * (cost / (residuals - freeParameters));
+			Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> rotationSpread(covariance.block<3, 3>(0, 0), Eigen::EigenvaluesOnly);
+			Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> translationSpread(covariance.block<3, 3>(3, 3), Eigen::EigenvaluesOnly);
+
+			// The fixed rows only hold the identity, the yaw is all there is.
+			double rotationVariance = yawOnly ? covariance(1, 1) : rotationSpread.eigenvalues()(2);
+			uncertainty.rotation = sqrt(std::max(rotationVariance, 0.0)) * 180.0 / EIGEN_PI;
+			uncertainty.translation = sqrt(std::max(translationSpread.eigenvalues()(2), 0.0)) * 100.0;
+		}
+	}
+
+	char buf[256];
+	snprintf(buf, sizeof buf, "Joint refinement: weighted RMS error %.4f -> %.4f in %d iterations\n",
+		sqrt(initialCost / weight), sqrt(cost / weight), iteration + 1);
+	log += buf;
+	if (solveScale)
+	{
+		snprintf(buf, sizeof buf, "Calibrated scale: %.5f\n", scale);
+		log += buf;
+	}
+	snprintf(buf, sizeof buf, "Uncertainty: rotation %.3f deg, translation %.3f cm\n", uncertainty.rotation, uncertainty.translation);
+	log += buf;
+	return true;
+}
+
+/**
+ * Determines how sensitive the sampled data is to changes in the calibrated rot/trans values.
+ */
+static bool ComputeSensitivity(
+	std::string &log,
+	const SensitivitySamples& valid,
+	const Eigen::Vector3d &trans,
+	const Eigen::Matrix3d &rot,
+	double scale,
+	RotationModel model,
+	double &positionError,
+	Eigen::Vector3d &sensitivity,
+	Eigen::Vector3d &axisError,
+	std::vector<SampleResidual> *residuals
+) {
+	SPACECAL_ZONE("Solve: sensitivity");
+	bool reject = false;
+	const auto posOffset = DeriveRefToTargetOffset(valid, trans, rot, scale);
+	char buf[256];
+
+	snprintf(buf, sizeof buf, "HMD to target offset: (%.2f, %.2f, %.2f)\n", posOffset(0), posOffset(1), posOffset(2));
+	log += buf;
+
+	// Base rotation, then the +10 and -10 degree perturbations about each axis.
+	Eigen::Matrix3d rotations[7] = { rot };
+	for (int axis = 0; axis < 3; axis++)
+	{
+		Eigen::Vector3d perturbation = Eigen::Vector3d::Zero();
+		perturbation(axis) = 10;
+		rotations[1 + axis * 2] = EulerQuat(perturbation).toRotationMatrix() * rot;
+		rotations[2 + axis * 2] = EulerQuat(-perturbation).toRotationMatrix() * rot;
+	}
+
+	double errors[7];
+	RetargetingErrorRMS(valid, posOffset, trans, rotations, scale, errors, 7, axisError, residuals);
+
+	double baseError = errors[0];
+	positionError = baseError;
+	snprintf(buf, sizeof buf, "Position error (RMS error): %.2f\n", baseError);
+	log += buf;
+	snprintf(buf, sizeof buf, "Position error per axis (RMS mm): X %.1f, Y %.1f, Z %.1f\n", axisError(0) * 1000.0, axisError(1) * 1000.0, axisError(2) * 1000.0);
+	log += buf;
+	if (baseError > 0.1) reject = true;
+
+	// Compute errors with rotation perturbations. Only the positive direction decides rejection,
+	// the negative one is reported to show whether the error surface is lopsided. A gravity
+	// aligned solve never moves pitch or roll, so the motion needn't pin them down.
+	const char axisNames[] = "XYZ";
+	for (int axis = 0; axis < 3; axis++)
+	{
+		double deltaError = errors[1 + axis * 2] - baseError;
+		double negativeDeltaError = errors[2 + axis * 2] - baseError;
+		sensitivity(axis) = deltaError;
+		bool solved = model == RotationModel::Full || axis == 1;
+		if (deltaError < 0.2 && solved) reject = true;
+
+		snprintf(buf, sizeof buf, "Sensitivity rotation %c (RMS error delta): %.2f (%.2f at -10 deg)\n", axisNames[axis], deltaError, negativeDeltaError);
+		log += buf;
+	}
+
+	return reject;
+}
+
+CalibrationSolution SolveCalibration(SolveWorkspace &workspace, RotationAccumulator rotation, bool estimateScale, std::atomic<int> *stage, RotationModel model,
+	const CalibrationPrior &prior)
+{
+	CalibrationSolution solution;
+	auto advance = [stage]() {
+		if (stage)
+			(*stage)++;
+	};
+
+	workspace.rotations.Assign(workspace.samples);
+	if (RejectRotationOutliers(solution.log, workspace, model))
+		rotation = AccumulateAllRotationPairs(workspace.rotations);
+
+	solution.rotation = CalibrateRotation(solution.log, rotation, workspace.samples.size(), model);
+	Eigen::Matrix3d rotMat = EulerQuat(solution.rotation).toRotationMatrix();
+	advance();
+
+	solution.translation = CalibrateTranslation(solution.log, workspace, rotMat);
+	Eigen::Vector3d trans = solution.translation * 0.01;
+	advance();
+
+	// Both stages after this one work on the same valid samples.
+	const SensitivitySamples valid(workspace);
+	CalibrationPrior fitted = prior;
+	if (fitted.valid && model == RotationModel::GravityAligned)
+		fitted.rotation = Eigen::AngleAxisd(atan2(prior.rotation(0, 2), prior.rotation(0, 0)), Eigen::Vector3d::UnitY()).toRotationMatrix();
+
+	// A short motion can leave the separate solves far off, then the prior is the better start.
+	Eigen::Matrix3d refinedRot = rotMat;
+	Eigen::Vector3d refinedTrans = trans;
+	if (fitted.valid && valid.size() > 0)
+	{
+		Eigen::Vector3d priorTrans = fitted.translation * 0.01;
+		double solvedCost = RefineCost(valid, rotMat, trans, DeriveRefToTargetOffset(valid, trans, rotMat, solution.scale), solution.scale);
+		double priorCost = RefineCost(valid, fitted.rotation, priorTrans, DeriveRefToTargetOffset(valid, priorTrans, fitted.rotation, solution.scale), solution.scale);
+		if (priorCost < solvedCost)
+		{
+			refinedRot = fitted.rotation;
+			refinedTrans = priorTrans;
+		}
+	}
+
+	double scale = solution.scale;
+	SolveUncertainty uncertainty;
+	bool refined = RefineCalibration(solution.log, valid, refinedRot, refinedTrans, scale, estimateScale, model, fitted.valid ? &fitted : nullptr, uncertainty);
+	if (refined && fitted.valid)
+	{
+		double rotationChange = Eigen::AngleAxisd(refinedRot * fitted.rotation.transpose()).angle() * 180.0 / EIGEN_PI;
+		double translationChange = (refinedTrans * 100.0 - fitted.translation).norm();
+		char buf[256];
+		if (rotationChange > PriorGate * PriorRotationSigma || translationChange > PriorGate * PriorTranslationSigma)
+		{
+			snprintf(buf, sizeof buf, "Moved %.2f deg and %.2f cm from the prior, solving without it\n", rotationChange, translationChange);
+			refinedRot = rotMat;
+			refinedTrans = trans;
+			scale = solution.scale;
+			uncertainty = SolveUncertainty();
+			refined = RefineCalibration(solution.log, valid, refinedRot, refinedTrans, scale, estimateScale, model, nullptr, uncertainty);
+		}
+		else
+		{
+			snprintf(buf, sizeof buf, "Corrected the prior by %.3f deg and %.3f cm\n", rotationChange, translationChange);
+		}
+		solution.log += buf;
+	}
+
+	if (refined)
+	{
+		rotMat = refinedRot;
+		trans = refinedTrans;
+		solution.scale = scale;
+		solution.uncertainty = uncertainty;
+		solution.rotation = SolutionEuler(rotMat, model);
+		solution.translation = trans * 100.0;
+	}
+	advance();
+
+	solution.reject = ComputeSensitivity(solution.log, valid, trans, rotMat, solution.scale, model, solution.positionError, solution.sensitivity,
+		solution.axisError, workspace.keepResiduals ? &workspace.residuals : nullptr);
+	advance();
+
+	return solution;
+}
+
+CalibrationSolution SolveCalibration(const std::vector<Sample> &samples, RotationAccumulator rotation, bool estimateScale, std::atomic<int> *stage, RotationModel model,
+	const CalibrationPrior &prior)
+{
+	SolveWorkspace workspace;
+	workspace.Reserve(samples.size());
+	workspace.samples = samples;
+	return SolveCalibration(workspace, rotation, estimateScale, stage, model, prior);
+}
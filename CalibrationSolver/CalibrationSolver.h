@@ -0,0 +1,393 @@
+#pragma once
+
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <string>
+#include <vector>
+
+/**
+ * Solver for the transform between two tracking systems from pose samples of a pair of devices
+ * moved together. Depends on nothing but Eigen and the standard library, so the client, its
+ * benchmark and the driver can all link it. Positions are in meters, reported translations in
+ * cm and rotations as Euler angles in degrees, see EulerQuat.
+ */
+
+struct Pose
+{
+	Eigen::Matrix3d rot;
+	Eigen::Vector3d trans;
+
+	Pose() { }
+	Pose(const Eigen::Matrix3d &rot, const Eigen::Vector3d &trans) : rot(rot), trans(trans) { }
+	Pose(double x, double y, double z) : trans(Eigen::Vector3d(x,y,z)) { }
+};
+
+struct Sample
+{
+	Pose ref, target;
+	bool valid;
+	double quality; // 0 to 1, see PoseQuality.
+	Sample() : valid(false), quality(0) { }
+	Sample(Pose ref, Pose target, double quality = 1.0) : valid(true), ref(ref), target(target), quality(quality) { }
+};
+
+// 1 for a device at rest, falling towards 0 as it moves faster, since fast motion magnifies
+// any timing mismatch between the two tracking systems. 0 unless the pose is tracking.
+double PoseQuality(bool tracking, double linearSpeed, double angularSpeed);
+
+struct DSample
+{
+	bool valid;
+	Eigen::Vector3d ref, target;
+	double weight; // See DeltaRotationSamples.
+};
+
+Eigen::Vector3d AxisFromRotationMatrix3(Eigen::Matrix3d rot);
+double AngleFromRotationMatrix3(Eigen::Matrix3d rot);
+
+// Whether the devices have moved far enough from the last recorded sample for a new one to
+// be worth recording, so a session isn't filled with near-duplicates.
+bool MovedEnough(const Sample &last, const Sample &sample);
+
+DSample DeltaRotationSamples(const Sample &s1, const Sample &s2);
+
+/**
+ * Running sums for the weighted Kabsch cross-covariance of rotation axis pairs. Deltas are
+ * folded in as samples arrive, so solving never needs the pairs themselves.
+ */
+struct RotationAccumulator
+{
+	Eigen::Matrix3d sumRefTarget;
+	Eigen::Matrix3d sumTargetTarget; // Spread of the target axes, see AxisCoverage.
+	Eigen::Vector3d sumRef, sumTarget;
+	double sumWeight;
+	size_t count;
+
+	RotationAccumulator() { Reset(); }
+
+	void Reset()
+	{
+		sumRefTarget.setZero();
+		sumTargetTarget.setZero();
+		sumRef.setZero();
+		sumTarget.setZero();
+		sumWeight = 0.0;
+		count = 0;
+	}
+
+	void Add(const DSample &delta)
+	{
+		sumRefTarget.noalias() += delta.weight * delta.ref * delta.target.transpose();
+		sumTargetTarget.noalias() += delta.weight * delta.target * delta.target.transpose();
+		sumRef += delta.weight * delta.ref;
+		sumTarget += delta.weight * delta.target;
+		sumWeight += delta.weight;
+		count++;
+	}
+
+	void Merge(const RotationAccumulator &other)
+	{
+		sumRefTarget += other.sumRefTarget;
+		sumTargetTarget += other.sumTargetTarget;
+		sumRef += other.sumRef;
+		sumTarget += other.sumTarget;
+		sumWeight += other.sumWeight;
+		count += other.count;
+	}
+
+	// Equal to the sum of w * (ref - refCentroid) * (target - targetCentroid)^T over all
+	// deltas, with weighted centroids.
+	Eigen::Matrix3d CrossCovariance() const;
+
+	// Smallest eigenvalue of the axes' scatter relative to an even spread, where each is a third.
+	double AxisCoverage() const;
+
+	// RMS angle between reference axes and rotated target axes, in radians.
+	double AxisErrorRMS(const Eigen::Matrix3d &rot) const;
+};
+
+// A sample is paired with every earlier one while the history is small, and with an evenly
+// strided subset once it grows, so the work per sample stays bounded for large sample counts.
+static const size_t MaxPairsPerSample = 500;
+
+inline size_t SamplePairStride(size_t index)
+{
+	if (index > MaxPairsPerSample)
+		return (index + MaxPairsPerSample - 1) / MaxPairsPerSample;
+	return 1;
+}
+
+/**
+ * The orientations of samples as pair generation reads them: float quaternions, one array per
+ * component, 36 bytes a sample against the two double matrices of a Sample. Pairing a sample
+ * with its history runs along each array instead of striding over whole Samples, so far larger
+ * histories stay in cache. Deltas come out in double and are accumulated in double, float only
+ * limits the axes to about 1e-7, well below tracking noise.
+ */
+class CompactRotations
+{
+public:
+	struct Entry
+	{
+		float ref[4], target[4]; // w, x, y, z
+		float quality;
+	};
+
+	static Entry FromSample(const Sample &sample);
+
+	void Reserve(size_t count);
+	void Clear();
+	void Assign(const std::vector<Sample> &samples);
+	void Push(const Sample &sample) { Push(FromSample(sample)); }
+	void Push(const Entry &entry);
+	void Set(size_t i, const Entry &entry);
+	size_t size() const { return quality.size(); }
+
+	Entry operator[](size_t i) const
+	{
+		return { { refW[i], refX[i], refY[i], refZ[i] }, { targetW[i], targetX[i], targetY[i], targetZ[i] }, quality[i] };
+	}
+
+	// Same as DeltaRotationSamples of entry and the ith sample.
+	DSample Delta(const Entry &entry, size_t i) const;
+
+private:
+	std::vector<float> refW, refX, refY, refZ;
+	std::vector<float> targetW, targetX, targetY, targetZ;
+	std::vector<float> quality;
+};
+
+// Calls fn with each valid delta of sample paired with the history before index, which is
+// where sample sits or is about to be added.
+template<typename Fn>
+void ForEachRotationPair(const CompactRotations &history, const CompactRotations::Entry &sample, size_t index, Fn fn)
+{
+	size_t stride = SamplePairStride(index);
+
+	// Vary the starting offset so successive samples pair with different parts of the history.
+	for (size_t j = index % stride; j < index; j += stride)
+	{
+		auto delta = history.Delta(sample, j);
+		if (delta.valid)
+			fn(delta);
+	}
+}
+
+inline void AccumulateRotationPairs(RotationAccumulator &acc, const CompactRotations &rotations, size_t index)
+{
+	ForEachRotationPair(rotations, rotations[index], index, [&](const DSample &delta) { acc.Add(delta); });
+}
+
+// The pairs of every sample, the same sums as adding them one by one. Spread over the cores.
+RotationAccumulator AccumulateAllRotationPairs(const CompactRotations &rotations);
+
+/**
+ * Coarse spherical histogram of the rotation axes seen so far, by pair weight. An axis and
+ * its negation describe the same rotation, so axes are folded onto the three positive faces
+ * of a cube, each split into BinsPerSide x BinsPerSide cells.
+ */
+struct AxisHistogram
+{
+	static const int BinsPerSide = 4;
+	static const int BinCount = 3 * BinsPerSide * BinsPerSide;
+
+	// A direction counts as covered once a full weight pair has landed in it.
+	static constexpr double CoveredWeight = 1.0;
+
+	double weights[BinCount];
+	double total;
+
+	AxisHistogram() { Reset(); }
+
+	void Reset()
+	{
+		std::fill(weights, weights + BinCount, 0.0);
+		total = 0.0;
+	}
+
+	static int Bin(const Eigen::Vector3d &axis)
+	{
+		int face;
+		axis.cwiseAbs().maxCoeff(&face);
+		double scale = axis(face) < 0.0 ? -1.0 / axis(face) : 1.0 / axis(face);
+
+		// Both in [-1, 1] on the face.
+		double u = axis((face + 1) % 3) * scale, v = axis((face + 2) % 3) * scale;
+		int cellU = std::min((int) ((u + 1.0) * 0.5 * BinsPerSide), BinsPerSide - 1);
+		int cellV = std::min((int) ((v + 1.0) * 0.5 * BinsPerSide), BinsPerSide - 1);
+		return (face * BinsPerSide + cellU) * BinsPerSide + cellV;
+	}
+
+	void Add(const DSample &delta)
+	{
+		weights[Bin(delta.target)] += delta.weight;
+		total += delta.weight;
+	}
+
+	int Covered() const
+	{
+		int covered = 0;
+		for (double weight : weights)
+			covered += weight >= CoveredWeight ? 1 : 0;
+		return covered;
+	}
+
+	// Holds more than share times what an even split over the covered directions would give.
+	bool Crowded(const Eigen::Vector3d &axis, double share) const
+	{
+		int covered = Covered();
+		return covered > 0 && weights[Bin(axis)] > share * total / covered;
+	}
+};
+
+// Kabsch algorithm, the result maps target rotation axes onto reference axes.
+Eigen::Matrix3d SolveRotation(const RotationAccumulator &acc);
+
+// Horn's closed form of the same rotation, the eigenvector of the largest eigenvalue of a
+// symmetric 4x4 matrix built from the cross-covariance. Comes out as a unit quaternion and
+// never as a reflection, for callers that want one without going through a matrix.
+Eigen::Quaterniond SolveRotationQuaternion(const RotationAccumulator &acc);
+
+// Kabsch restricted to rotations about +Y, which has a closed form: the yaw is a single atan2
+// of the cross-covariance. Needs rotation axes with some horizontal component, turning the
+// devices about the vertical alone leaves the yaw undetermined.
+Eigen::Matrix3d SolveYaw(const RotationAccumulator &acc);
+
+// The rotation a solve may find between the two systems. Lighthouse, WMR, Quest and most other
+// systems level their worlds by gravity, so between them only the yaw is unknown, and solving
+// for nothing more needs less motion and leaves noise no pitch or roll to go into.
+enum class RotationModel
+{
+	Full,
+	GravityAligned, // Yaw and translation only, pitch and roll stay zero.
+};
+
+/**
+ * How the translation solve weighs samples by how far each is from the fit, for glitches such
+ * as a Lighthouse reflection or an inside-out tracking jump. None is plain least squares. The
+ * others solve again with each sample's pairs reweighted until the translation settles: Huber
+ * downweights samples beyond 1.345 sigma in proportion to their distance, Tukey gives them a
+ * weight tending to 0 at 4.685 sigma, where sigma comes from the median residual.
+ */
+enum class RobustLoss
+{
+	None,
+	Huber,
+	Tukey,
+};
+
+// Rotations are stored as Z, Y, X Euler angles in degrees.
+Eigen::Quaterniond EulerQuat(Eigen::Vector3d eulerdeg);
+Eigen::Vector3d EulerFromQuat(const Eigen::Quaterniond &quat);
+
+// One standard deviation along the worst determined axis, from the refinement's covariance.
+struct SolveUncertainty
+{
+	double rotation = std::numeric_limits<double>::infinity(); // degrees
+	double translation = std::numeric_limits<double>::infinity(); // cm
+};
+
+/**
+ * A calibration the solve can assume is nearly right, usually the profile being recalibrated,
+ * in the same terms as the solution. The refinement is pulled towards it with the strength of
+ * PriorRotationSigma and PriorTranslationSigma, so a brief motion that only pins down some of
+ * the axes still gives a certain result, the rest stay where the prior has them. A result
+ * further from the prior than those allow means it was off by more than drift, and the solve
+ * drops it again.
+ */
+struct CalibrationPrior
+{
+	bool valid = false;
+	Eigen::Matrix3d rotation = Eigen::Matrix3d::Identity();
+	Eigen::Vector3d translation = Eigen::Vector3d::Zero(); // cm
+};
+
+// What's left of one sample with the solution applied, from the solve's final evaluation.
+struct SampleResidual
+{
+	Eigen::Vector3d position; // Of the reference device, meters.
+	Eigen::Vector3d error; // Where the reference puts the target minus where the solution does, meters.
+	Eigen::Vector3d deviceError; // The same in the reference device's frame.
+	double quality;
+};
+
+// Maps target space positions into reference space as scale * rotation * p + translation.
+struct CalibrationSolution
+{
+	Eigen::Vector3d rotation = Eigen::Vector3d::Zero(); // degrees
+	Eigen::Vector3d translation = Eigen::Vector3d::Zero(); // cm
+	double scale = 1.0; // Only solved for with estimateScale.
+	SolveUncertainty uncertainty;
+	bool reject = false;
+	double positionError = 0;
+	Eigen::Vector3d sensitivity = Eigen::Vector3d::Zero(); // RMS error increase with each axis rotated 10 degrees.
+	Eigen::Vector3d axisError = Eigen::Vector3d::Zero(); // positionError along each reference space axis, meters.
+
+	// The solver's messages, one per line, for the caller to show or drop.
+	std::string log;
+};
+
+static const int SolveStageCount = 4;
+
+/**
+ * Every buffer a solve works in. Reserve sizes them once for a session's sample count, and
+ * later solves only refill them, so a solve on a workspace that fits makes no allocations
+ * that grow with the samples. A workspace belongs to one solve at a time.
+ */
+struct SolveWorkspace
+{
+	// The solve's input, filled by the caller. Outlier rejection leaves only the inliers.
+	std::vector<Sample> samples;
+	CompactRotations rotations; // Of samples, for pairing them.
+
+	// Rotation outlier rejection.
+	struct RansacPair
+	{
+		size_t a, b;
+		DSample delta;
+	};
+	std::vector<RansacPair> ransacPairs;
+	std::vector<size_t> indices;
+	std::vector<int> agree, total;
+	std::vector<bool> inliers, bestInliers;
+	std::vector<Sample> kept;
+	CompactRotations keptRotations;
+
+	// Translation, per sample with the solved rotation applied to the target. With robustLoss
+	// the final weights of the samples also scale their quality in the refinement.
+	std::vector<Eigen::Matrix3d> refRotT, targetRotT;
+	std::vector<Eigen::Vector3d> refOffset, targetOffset;
+	RobustLoss robustLoss = RobustLoss::None;
+	std::vector<double> robustWeights, robustResiduals, robustSorted;
+
+	// Refinement and sensitivity, the valid samples only. Sensitivity also lays out the target
+	// positions, where the reference puts them and those rotated by a candidate as arrays of
+	// x, y and z in batch, for matrixRotateVectors.
+	std::vector<Eigen::Matrix3d> refRot;
+	std::vector<Eigen::Vector3d> refTrans, targetTrans;
+	std::vector<double> quality;
+	std::vector<double> batch;
+
+	// One per valid sample in order, filled by the final evaluation while keepResiduals is set.
+	bool keepResiduals = false;
+	std::vector<SampleResidual> residuals;
+
+	void Reserve(size_t sampleCount);
+};
+
+/**
+ * Rejects rotation outliers, solves rotation then translation, refines both together and
+ * judges the result, on the samples in workspace. rotation must hold their pairs, see
+ * AccumulateRotationPairs and AccumulateAllRotationPairs. Safe to run on any thread, stage
+ * is optional and counts up to SolveStageCount as the solve progresses.
+ */
+CalibrationSolution SolveCalibration(SolveWorkspace &workspace, RotationAccumulator rotation, bool estimateScale, std::atomic<int> *stage = nullptr,
+	RotationModel model = RotationModel::Full, const CalibrationPrior &prior = CalibrationPrior());
+
+// For one-off solves, with a workspace of their own.
+CalibrationSolution SolveCalibration(const std::vector<Sample> &samples, RotationAccumulator rotation, bool estimateScale, std::atomic<int> *stage = nullptr,
+	RotationModel model = RotationModel::Full, const CalibrationPrior &prior = CalibrationPrior());
@@ -0,0 +1,462 @@
+#define _CRT_SECURE_NO_DEPRECATE
+#include "MockDriverContext.h"
+#include "DriverChecks.h"
+#include "ServerTrackedDeviceProvider.h"
+#include "InterfaceHookInjector.h"
+#include "Logging.h"
+#include "../Instrumentation.h"
+
+#include <intrin.h>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+SPACECAL_DEFINE_TRACE_PROVIDER
+
+/**
+ * Pushes synthetic poses through the driver's pose detour, the way SteamVR's driver threads
+ * would, and reports what each pose costs. The driver runs against MockDriverContext, so this
+ * needs neither SteamVR nor a headset, and must not run next to them: the driver's shared
+ * memory section and pipe have fixed names.
+ *
+ * Every configuration is run four times. "unhooked" calls the host with the hooks patched out
+ * and is the floor, "passthrough" goes through the detour with no transform enabled, and
+ * "transformed" has a transform enabled for every device. "apply" is transformed with every
+ * device's transform rewritten once per server frame, the way the client applies a profile
+ * edit, and also reports how long each edit took from the write into the table to the next
+ * pose of every device carrying it.
+ */
+
+static const uint32_t DefaultDeviceCounts[] = { 1, 4, 16, 64 };
+
+struct BenchmarkOptions
+{
+	std::vector<uint32_t> deviceCounts;
+	uint32_t threads = 4;
+	double rate = 0.0; // Poses per second per device, 0 sends them as fast as possible.
+	double seconds = 2.0; // Per pass.
+	const char *hookMethod = "inline"; // The driver's poseHookMethod setting.
+};
+
+enum BenchmarkMode
+{
+	ModeUnhooked,
+	ModePassthrough,
+	ModeTransformed,
+	ModeApply,
+};
+
+static const char *ModeNames[] = { "unhooked", "passthrough", "transformed", "apply" };
+
+// From an edit written into the table to every device's next pose, on top of the time until
+// that pose is due when poses are throttled. The client holds its part, from the edit to the
+// table, to the same budget, see ProfileApplyBudget.
+static const double EditBudget = 0.001; // seconds
+
+// An edit whose poses haven't all arrived by then counts as lost.
+static const double EditTimeout = 0.1; // seconds
+
+// Per-pose times in TSC ticks, which resolve single calls where QueryPerformanceCounter doesn't.
+// Slower poses all land in the last bucket.
+static const size_t LatencyBuckets = 1 << 14;
+
+struct ThreadResult
+{
+	uint64_t poses = 0;
+	uint64_t totalTicks = 0;
+	uint64_t maxTicks = 0;
+	std::vector<uint64_t> histogram;
+};
+
+struct PassResult
+{
+	uint64_t poses = 0;
+	double wallSeconds = 0.0;
+	double meanNanoseconds = 0.0, p50Nanoseconds = 0.0, p99Nanoseconds = 0.0, maxNanoseconds = 0.0;
+	bool p99Overflow = false;
+	bool verified = true;
+
+	std::vector<double> editMicroseconds; // Apply only, sorted.
+	uint32_t editsLost = 0;
+};
+
+static uint64_t QueryTicks()
+{
+	LARGE_INTEGER now;
+	QueryPerformanceCounter(&now);
+	return (uint64_t) now.QuadPart;
+}
+
+static double QueryFrequency()
+{
+	LARGE_INTEGER frequency;
+	QueryPerformanceFrequency(&frequency);
+	return (double) frequency.QuadPart;
+}
+
+static vr::DriverPose_t SyntheticPose(uint32_t openVRID)
+{
+	vr::DriverPose_t pose;
+	memset(&pose, 0, sizeof pose);
+	pose.qWorldFromDriverRotation.w = 1.0;
+	pose.qDriverFromHeadRotation.w = 1.0;
+	pose.qRotation.w = 1.0;
+	pose.vecPosition[0] = 0.1 * openVRID;
+	pose.vecPosition[1] = 1.0;
+	pose.result = vr::TrackingResult_Running_OK;
+	pose.poseIsValid = true;
+	pose.deviceIsConnected = true;
+	return pose;
+}
+
+// Moves the pose along a small circle, so no two poses of a device are the same.
+static void AdvancePose(vr::DriverPose_t &pose, uint64_t index)
+{
+	double angle = (double) (index & 1023) * (6.283185307179586 / 1024.0);
+	pose.vecPosition[2] = 0.05 * cos(angle);
+	pose.vecVelocity[0] = 0.05 * sin(angle);
+	pose.qRotation.w = cos(angle * 0.5);
+	pose.qRotation.y = sin(angle * 0.5);
+}
+
+// Devices are split between the threads, so each one is only posed from a single thread.
+static void RunPoseThread(vr::IVRServerDriverHost *host, uint32_t thread, uint32_t threads, uint32_t devices,
+	const BenchmarkOptions &options, double frequency, std::atomic<bool> &start, std::atomic<bool> &stop, ThreadResult &result)
+{
+	std::vector<vr::DriverPose_t> poses;
+	std::vector<uint32_t> ids;
+	for (uint32_t id = thread; id < devices; id += threads)
+	{
+		ids.push_back(id);
+		poses.push_back(SyntheticPose(id));
+	}
+
+	result.histogram.assign(LatencyBuckets, 0);
+	uint64_t period = options.rate > 0.0 ? (uint64_t) (frequency / options.rate) : 0;
+	uint64_t sleepThreshold = (uint64_t) (frequency * 0.002);
+
+	while (!start.load(std::memory_order_acquire))
+		YieldProcessor();
+
+	uint64_t next = QueryTicks();
+	uint64_t round = 0;
+	while (!stop.load(std::memory_order_relaxed))
+	{
+		for (size_t i = 0; i < ids.size(); i++)
+		{
+			AdvancePose(poses[i], round);
+
+			uint64_t begin = __rdtsc();
+			host->TrackedDevicePoseUpdated(ids[i], poses[i], sizeof(vr::DriverPose_t));
+			uint64_t ticks = __rdtsc() - begin;
+
+			result.poses++;
+			result.totalTicks += ticks;
+			result.maxTicks = std::max(result.maxTicks, ticks);
+			result.histogram[std::min<uint64_t>(ticks, LatencyBuckets - 1)]++;
+		}
+		round++;
+
+		if (!period)
+			continue;
+
+		// Sleeping is only accurate to a millisecond or so, the rest is waited out spinning.
+		next += period;
+		while (!stop.load(std::memory_order_relaxed))
+		{
+			uint64_t now = QueryTicks();
+			if (now >= next)
+				break;
+			if (next - now > sleepThreshold)
+				Sleep(1);
+			else
+				YieldProcessor();
+		}
+	}
+}
+
+// offset is the x of every translation, which the host sees change when an edit arrives.
+static void EnableTransforms(ServerTrackedDeviceProvider &provider, uint32_t devices, bool enabled, double offset = 0.3)
+{
+	static protocol::SetDeviceTransformBatch batch;
+	batch.count = devices;
+	for (uint32_t id = 0; id < devices; id++)
+	{
+		vr::HmdVector3d_t translation = { { offset, -0.1, 0.2 } };
+		vr::HmdQuaternion_t rotation = { cos(0.25), 0.0, sin(0.25), 0.0 };
+		batch.transforms[id] = enabled ? protocol::SetDeviceTransform(id, true, translation, rotation, 1.0) : protocol::SetDeviceTransform(id, false);
+	}
+	provider.SetDeviceTransforms(batch);
+}
+
+static double Percentile(const std::vector<uint64_t> &histogram, uint64_t count, double fraction, bool &overflow)
+{
+	uint64_t target = (uint64_t) ceil(fraction * (double) count);
+	uint64_t seen = 0;
+	for (size_t ticks = 0; ticks < histogram.size(); ticks++)
+	{
+		seen += histogram[ticks];
+		if (seen >= target)
+		{
+			overflow = ticks == histogram.size() - 1;
+			return (double) ticks;
+		}
+	}
+	overflow = true;
+	return (double) (histogram.size() - 1);
+}
+
+static PassResult RunPass(ServerTrackedDeviceProvider &provider, MockDriverContext &context, vr::IVRServerDriverHost *host,
+	BenchmarkMode mode, uint32_t devices, const BenchmarkOptions &options)
+{
+	SetPoseHooksEnabled(mode != ModeUnhooked);
+	EnableTransforms(provider, devices, mode == ModeTransformed || mode == ModeApply);
+	context.serverDriverHost.ResetDevices();
+
+	double frequency = QueryFrequency();
+	uint32_t threads = std::min(options.threads, devices);
+	std::vector<ThreadResult> results(threads);
+	std::vector<std::thread> workers;
+	std::atomic<bool> start(false), stop(false);
+
+	for (uint32_t i = 0; i < threads; i++)
+	{
+		workers.emplace_back(RunPoseThread, host, i, threads, devices, std::cref(options), frequency,
+			std::ref(start), std::ref(stop), std::ref(results[i]));
+	}
+
+	uint64_t beginTicks = QueryTicks(), beginTsc = __rdtsc();
+	start.store(true, std::memory_order_release);
+
+	PassResult pass;
+	uint64_t editTimeout = (uint64_t) ((EditTimeout + (options.rate > 0.0 ? 1.0 / options.rate : 0.0)) * frequency);
+	uint32_t edits = 0;
+
+	// SteamVR calls RunFrame from its main loop while the driver threads post poses.
+	uint64_t endTicks = beginTicks + (uint64_t) (options.seconds * frequency);
+	while (QueryTicks() < endTicks)
+	{
+		provider.RunFrame();
+		if (mode == ModeApply)
+		{
+			uint64_t edit = QueryTicks();
+			EnableTransforms(provider, devices, true, (edits++ & 1) ? 0.3 : 0.4);
+
+			// The edit has arrived once the last device's pose carried it.
+			uint64_t arrived = 0;
+			uint32_t waiting = devices;
+			while (waiting && QueryTicks() - edit < editTimeout)
+			{
+				waiting = 0;
+				for (uint32_t id = 0; id < devices; id++)
+				{
+					uint64_t moved = context.serverDriverHost.devices[id].movedTicks.load(std::memory_order_acquire);
+					if (moved < edit)
+						waiting++;
+					else
+						arrived = std::max(arrived, moved);
+				}
+				if (waiting)
+					YieldProcessor();
+			}
+
+			if (waiting)
+				pass.editsLost++;
+			else
+				pass.editMicroseconds.push_back((double) (arrived - edit) * 1e6 / frequency);
+		}
+		Sleep(11);
+	}
+	std::sort(pass.editMicroseconds.begin(), pass.editMicroseconds.end());
+
+	stop.store(true, std::memory_order_relaxed);
+	for (auto &worker : workers)
+		worker.join();
+	uint64_t finishTicks = QueryTicks(), finishTsc = __rdtsc();
+
+	pass.wallSeconds = (double) (finishTicks - beginTicks) / frequency;
+	double nanosecondsPerTsc = pass.wallSeconds * 1e9 / (double) (finishTsc - beginTsc);
+
+	std::vector<uint64_t> histogram(LatencyBuckets, 0);
+	uint64_t totalTicks = 0, maxTicks = 0;
+	for (auto &result : results)
+	{
+		pass.poses += result.poses;
+		totalTicks += result.totalTicks;
+		maxTicks = std::max(maxTicks, result.maxTicks);
+		for (size_t i = 0; i < LatencyBuckets; i++)
+			histogram[i] += result.histogram[i];
+	}
+
+	if (pass.poses)
+	{
+		bool overflow;
+		pass.meanNanoseconds = (double) totalTicks / (double) pass.poses * nanosecondsPerTsc;
+		pass.p50Nanoseconds = Percentile(histogram, pass.poses, 0.50, overflow) * nanosecondsPerTsc;
+		pass.p99Nanoseconds = Percentile(histogram, pass.poses, 0.99, pass.p99Overflow) * nanosecondsPerTsc;
+		pass.maxNanoseconds = (double) maxTicks * nanosecondsPerTsc;
+	}
+
+	// Every pose has to reach the host, and carry the transform exactly when one is enabled.
+	uint64_t arrived = 0;
+	for (uint32_t id = 0; id < devices; id++)
+	{
+		auto &device = context.serverDriverHost.devices[id];
+		arrived += device.poses;
+		if (device.transformed != (mode == ModeTransformed || mode == ModeApply ? device.poses : 0))
+			pass.verified = false;
+	}
+	if (arrived != pass.poses)
+		pass.verified = false;
+
+	return pass;
+}
+
+static double EditPercentile(const std::vector<double> &sorted, double fraction)
+{
+	if (sorted.empty())
+		return 0.0;
+	size_t index = (size_t) ceil(fraction * (double) sorted.size());
+	return sorted[std::min(std::max<size_t>(index, 1), sorted.size()) - 1];
+}
+
+// Returns false when the pass went over EditBudget or lost edits.
+static bool PrintEdits(const PassResult &pass, const BenchmarkOptions &options)
+{
+	const auto &edits = pass.editMicroseconds;
+	double total = 0.0;
+	for (double edit : edits)
+		total += edit;
+
+	double budget = (EditBudget + (options.rate > 0.0 ? 1.0 / options.rate : 0.0)) * 1e6;
+	double p99 = EditPercentile(edits, 0.99);
+	bool met = pass.editsLost == 0 && !edits.empty() && p99 <= budget;
+	printf("%8s %8s %-12s %10.1f %10.1f %10.1f %10.1f %12s  edit to pose in us, %zu edits, %u lost, budget %.0f us%s\n", "", "", "",
+		edits.empty() ? 0.0 : total / edits.size(), EditPercentile(edits, 0.5), p99, edits.empty() ? 0.0 : edits.back(), "",
+		edits.size(), pass.editsLost, budget, met ? "" : ", over budget");
+	return met;
+}
+
+static bool ParseOptions(int argc, char **argv, BenchmarkOptions &options)
+{
+	for (int i = 1; i < argc; i++)
+	{
+		const char *arg = argv[i];
+		const char *value = i + 1 < argc ? argv[i + 1] : nullptr;
+		if (!value)
+			return false;
+
+		if (strcmp(arg, "-devices") == 0)
+		{
+			options.deviceCounts.clear();
+			for (const char *p = value; *p; )
+			{
+				char *end;
+				unsigned long count = strtoul(p, &end, 10);
+				if (end == p || count == 0 || count > vr::k_unMaxTrackedDeviceCount)
+					return false;
+				options.deviceCounts.push_back((uint32_t) count);
+				p = *end == ',' ? end + 1 : end;
+				if (*end && *end != ',')
+					return false;
+			}
+		}
+		else if (strcmp(arg, "-threads") == 0)
+			options.threads = (uint32_t) strtoul(value, nullptr, 10);
+		else if (strcmp(arg, "-rate") == 0)
+			options.rate = atof(value);
+		else if (strcmp(arg, "-seconds") == 0)
+			options.seconds = atof(value);
+		else if (strcmp(arg, "-hook") == 0 && (strcmp(value, "inline") == 0 || strcmp(value, "vtable") == 0))
+			options.hookMethod = value;
+		else
+			return false;
+		i++;
+	}
+
+	if (options.deviceCounts.empty())
+		options.deviceCounts.assign(std::begin(DefaultDeviceCounts), std::end(DefaultDeviceCounts));
+	return options.threads > 0 && options.rate >= 0.0 && options.seconds > 0.0;
+}
+
+// The driver's own log would go to SteamVR's working directory, this one stays next to the results.
+static void OpenBenchmarkLog(const char *path)
+{
+	LogFile = fopen(path, "w");
+	if (!LogFile)
+		LogFile = stderr;
+}
+
+int main(int argc, char **argv)
+{
+	if (argc == 2 && strcmp(argv[1], "-check") == 0)
+	{
+		OpenBenchmarkLog("driver_checks.log");
+		return RunDriverChecks() ? 0 : 1;
+	}
+
+	BenchmarkOptions options;
+	if (!ParseOptions(argc, argv, options))
+	{
+		fprintf(stderr, "Usage: DriverBenchmark [-devices 1,4,16,64] [-threads 4] [-rate poses/s per device, 0 for unthrottled] [-seconds per pass] [-hook inline|vtable]\n"
+			"       DriverBenchmark -check\n");
+		return 1;
+	}
+
+	HANDLE existing = OpenFileMappingA(FILE_MAP_READ, FALSE, OPENVR_SPACECALIBRATOR_SHARED_MEMORY_NAME);
+	if (existing)
+	{
+		CloseHandle(existing);
+		fprintf(stderr, "The driver is already loaded, close SteamVR before running the benchmark.\n");
+		return 1;
+	}
+
+	OpenBenchmarkLog("driver_benchmark.log");
+
+	static MockDriverContext context;
+	static ServerTrackedDeviceProvider provider;
+	context.settings.poseHookMethod = options.hookMethod;
+	if (provider.Init(&context) != vr::VRInitError_None)
+	{
+		fprintf(stderr, "ServerTrackedDeviceProvider::Init failed\n");
+		return 1;
+	}
+
+	// Asked for through the hooked context, which is what hooks TrackedDevicePoseUpdated.
+	auto host = (vr::IVRServerDriverHost *) vr::VRDriverContext()->GetGenericInterface("IVRServerDriverHost_006", nullptr);
+
+	int status = 0;
+	if (options.rate > 0.0)
+		printf("%.0f poses/s per device, %u threads at most, %.1f s per pass, %s hooks\n", options.rate, options.threads, options.seconds, options.hookMethod);
+	else
+		printf("unthrottled, %u threads at most, %.1f s per pass, %s hooks\n", options.threads, options.seconds, options.hookMethod);
+	printf("%8s %8s %-12s %10s %10s %10s %10s %12s\n", "devices", "threads", "mode", "mean ns", "p50 ns", "p99 ns", "max ns", "poses/s");
+
+	for (uint32_t devices : options.deviceCounts)
+	{
+		for (int mode = ModeUnhooked; mode <= ModeApply; mode++)
+		{
+			PassResult pass = RunPass(provider, context, host, (BenchmarkMode) mode, devices, options);
+			printf("%8u %8u %-12s %10.1f %10.1f %9.1f%s %10.0f %12.0f%s\n", devices, std::min(options.threads, devices), ModeNames[mode],
+				pass.meanNanoseconds, pass.p50Nanoseconds, pass.p99Nanoseconds, pass.p99Overflow ? "+" : " ", pass.maxNanoseconds,
+				(double) pass.poses / pass.wallSeconds, pass.verified ? "" : "  poses lost or transformed wrongly");
+			if (!pass.verified)
+				status = 1;
+			if (mode == ModeApply && !PrintEdits(pass, options))
+				status = 1;
+		}
+	}
+
+	EnableTransforms(provider, vr::k_unMaxTrackedDeviceCount, false);
+	SetPoseHooksEnabled(true);
+	provider.Cleanup();
+	return status;
+}
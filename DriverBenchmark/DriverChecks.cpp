@@ -0,0 +1,232 @@
+#include "DriverChecks.h"
+#include "PoseFilters.h"
+#include "../BatchMath.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <vector>
+
+static bool Report(const char *name, bool passed, const char *detail)
+{
+	printf("%-24s %-6s %s\n", name, passed ? "ok" : "FAILED", detail);
+	return passed;
+}
+
+// The dispatched kernel against the scalar loop, over a count that leaves a tail after the
+// AVX2 steps, and in place.
+static bool CheckBatchRotation()
+{
+	const size_t n = 1027;
+	std::mt19937 random(22);
+	std::uniform_real_distribution<double> coordinate(-3.0, 3.0);
+	std::vector<double> input(n * 3), scalar(n * 3), batch(n * 3);
+	for (auto &value : input)
+		value = coordinate(random);
+
+	// A rotation by 50 degrees about (1, 2, 2) / 3.
+	double c = cos(0.87266), s = sin(0.87266), axis[3] = { 1.0 / 3, 2.0 / 3, 2.0 / 3 };
+	double m[3][3];
+	for (int row = 0; row < 3; row++)
+	{
+		for (int col = 0; col < 3; col++)
+			m[row][col] = (row == col ? c : 0.0) + (1.0 - c) * axis[row] * axis[col];
+	}
+	m[0][1] -= s * axis[2]; m[0][2] += s * axis[1];
+	m[1][0] += s * axis[2]; m[1][2] -= s * axis[0];
+	m[2][0] -= s * axis[1]; m[2][1] += s * axis[0];
+
+	Vector3Array in = { input.data(), input.data() + n, input.data() + 2 * n };
+	Vector3Array outScalar = { scalar.data(), scalar.data() + n, scalar.data() + 2 * n };
+	Vector3Array outBatch = { batch.data(), batch.data() + n, batch.data() + 2 * n };
+	matrixRotateVectorsScalar(m, in, outScalar, n);
+	matrixRotateVectors(m, in, outBatch, n);
+	matrixRotateVectors(m, in, in, n);
+
+	double difference = 0, aliased = 0;
+	for (size_t i = 0; i < n * 3; i++)
+	{
+		difference = std::max(difference, fabs(batch[i] - scalar[i]));
+		aliased = std::max(aliased, fabs(input[i] - batch[i]));
+	}
+
+#ifdef SPACECAL_BATCH_AVX2
+	const char *path = batchAvx2Supported() ? "AVX2" : "scalar, no AVX2 on this CPU";
+#else
+	const char *path = "scalar";
+#endif
+	char detail[128];
+	snprintf(detail, sizeof detail, "%s path, %.1e from the scalar loop, %.1e in place", path, difference, aliased);
+	return Report("batch rotation", difference <= 1e-12 && aliased == 0, detail);
+}
+
+// The chains below run on a device and a source 10 cm apart on one body part, the device is
+// where the source's pose moved by this says.
+static const uint32_t LinkedID = 1, LinkSourceID = 2;
+static const double LinkOffset = 0.1;
+static const double PoseInterval = 1.0 / 90;
+
+static vr::DriverPose_t TrackedPose(double x, double y)
+{
+	vr::DriverPose_t pose;
+	memset(&pose, 0, sizeof pose);
+	pose.qWorldFromDriverRotation = pose.qDriverFromHeadRotation = pose.qRotation = { 1, 0, 0, 0 };
+	pose.vecPosition[0] = x;
+	pose.vecPosition[1] = y;
+	pose.poseIsValid = pose.deviceIsConnected = true;
+	pose.result = vr::TrackingResult_Running_OK;
+	return pose;
+}
+
+static vr::DriverPose_t LostPose()
+{
+	auto pose = TrackedPose(0, 0);
+	pose.poseIsValid = false;
+	pose.result = vr::TrackingResult_Running_OutOfRange;
+	return pose;
+}
+
+static bool ConfigureLink(PoseFilters &filters, protocol::PoseFilterType type, double p0, double p1, double p2)
+{
+	protocol::SetPoseFilters config;
+	memset(&config, 0, sizeof config);
+	config.openVRID = LinkedID;
+	config.count = 1;
+	auto &stage = config.stages[0];
+	stage.type = type;
+	stage.sourceID = LinkSourceID;
+	stage.params[0] = p0;
+	stage.params[1] = p1;
+	stage.params[2] = p2;
+	stage.offsetTranslation = { 0, LinkOffset, 0 };
+	stage.offsetRotation = { 1, 0, 0, 0 };
+	return filters.Configure(config);
+}
+
+// Where the body part is at the step, swinging 30 cm along x at 0.5 Hz.
+static double LinkTruth(int step)
+{
+	return 0.3 * sin(3.14159265358979323846 * step * PoseInterval);
+}
+
+// Both at 4 mm of noise, so fusing them should take the error down by about sqrt(2) once the
+// filter settles, then the source stops and the device goes on alone, then the device loses
+// tracking and is carried on the source, and finally both are lost, which nothing can carry.
+static bool CheckFusion()
+{
+	std::unique_ptr<PoseFilters> filters(new PoseFilters);
+	if (!ConfigureLink(*filters, protocol::PoseFilterFusion, 0.004, 0.004, 10.0))
+		return Report("fusion", false, "stage rejected");
+
+	std::mt19937 random(94);
+	std::normal_distribution<double> noise(0.0, 0.004);
+	double rawError = 0, fusedError = 0, aloneError = 0, carriedError = 0;
+	int fused = 0, alone = 0, carried = 0;
+	bool carriedValid = true, bothLost = false;
+	for (int step = 0; step < 720; step++)
+	{
+		double time = step * PoseInterval, truth = LinkTruth(step);
+		bool sourceTracking = step < 360 || step >= 450, deviceTracking = step < 540 || step >= 700;
+		if (step >= 630 && step < 700)
+			sourceTracking = false;
+
+		if (sourceTracking)
+			filters->Record(LinkSourceID, TrackedPose(truth + noise(random), -LinkOffset + noise(random)), time);
+
+		double measuredX = truth + noise(random), measuredY = noise(random);
+		auto pose = deviceTracking ? TrackedPose(measuredX, measuredY) : LostPose();
+		filters->Apply(LinkedID, pose, time);
+
+		double error = sqrt((pose.vecPosition[0] - truth) * (pose.vecPosition[0] - truth) + pose.vecPosition[1] * pose.vecPosition[1]);
+		if (step >= 90 && step < 360)
+		{
+			rawError += (measuredX - truth) * (measuredX - truth) + measuredY * measuredY;
+			fusedError += error * error;
+			fused++;
+		}
+		else if (step >= 400 && step < 450)
+		{
+			aloneError += error * error;
+			alone++;
+		}
+		else if (step >= 540 && step < 630)
+		{
+			carriedValid &= pose.poseIsValid && pose.result == vr::TrackingResult_Running_OK;
+			carriedError = std::max(carriedError, error);
+			carried++;
+		}
+		else if (step >= 660 && step < 700)
+		{
+			bothLost |= pose.poseIsValid;
+		}
+	}
+	rawError = sqrt(rawError / fused);
+	fusedError = sqrt(fusedError / fused);
+	aloneError = sqrt(aloneError / alone);
+
+	char detail[160];
+	snprintf(detail, sizeof detail, "%.2f mm fused from %.2f mm raw, %.2f mm alone, %.2f mm at most carried",
+		fusedError * 1000, rawError * 1000, aloneError * 1000, carriedError * 1000);
+	bool passed = fusedError < 0.85 * rawError && aloneError < 2.0 * rawError && carriedValid && carriedError < 0.02 && !bothLost;
+	return Report("fusion", passed, detail);
+}
+
+// Noise free, so a stand in can be held to the pose the source implies. The device passes
+// unchanged while it tracks, and the straps slip 2 cm along z meanwhile, which the learned
+// offset has to have followed by the time the device is lost. A stale source leaves it lost.
+static bool CheckFallback()
+{
+	std::unique_ptr<PoseFilters> filters(new PoseFilters);
+	if (!ConfigureLink(*filters, protocol::PoseFilterFallback, 0.1, 0.05, 0))
+		return Report("fallback", false, "stage rejected");
+
+	const double slip = 0.02;
+	double standInError = 0;
+	bool passedThrough = true, standInValid = true, staleLost = true;
+	for (int step = 0; step < 450; step++)
+	{
+		double time = step * PoseInterval, truth = LinkTruth(step);
+		bool sourceTracking = step < 360, deviceTracking = step < 270;
+		double strap = step < 90 ? 0 : slip;
+
+		if (sourceTracking)
+			filters->Record(LinkSourceID, TrackedPose(truth, -LinkOffset), time);
+
+		auto pose = deviceTracking ? TrackedPose(truth, 0) : LostPose();
+		pose.vecPosition[2] = deviceTracking ? strap : 0;
+		auto before = pose;
+		filters->Apply(LinkedID, pose, time);
+
+		if (deviceTracking)
+		{
+			passedThrough &= memcmp(&pose, &before, sizeof pose) == 0;
+		}
+		else if (step < 360)
+		{
+			double dx = pose.vecPosition[0] - truth, dy = pose.vecPosition[1], dz = pose.vecPosition[2] - slip;
+			standInValid &= pose.poseIsValid && pose.result == vr::TrackingResult_Running_OK;
+			standInError = std::max(standInError, sqrt(dx * dx + dy * dy + dz * dz));
+		}
+		else if (step >= 370)
+		{
+			staleLost &= !pose.poseIsValid;
+		}
+	}
+
+	char detail[128];
+	snprintf(detail, sizeof detail, "%s while tracking, %.2f mm at most standing in",
+		passedThrough ? "unchanged" : "changed", standInError * 1000);
+	return Report("fallback", passedThrough && standInValid && standInError < 0.001 && staleLost, detail);
+}
+
+bool RunDriverChecks()
+{
+	bool passed = true;
+	passed &= CheckBatchRotation();
+	passed &= CheckFusion();
+	passed &= CheckFallback();
+	return passed;
+}
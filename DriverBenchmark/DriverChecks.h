@@ -0,0 +1,8 @@
+#pragma once
+
+/**
+ * What DriverBenchmark -check runs instead of the benchmark: checks of behaviour the timed
+ * passes don't look at, each printing one line. Needs no driver loaded, SteamVR may run.
+ * Returns false if any failed.
+ */
+bool RunDriverChecks();
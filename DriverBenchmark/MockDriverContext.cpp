@@ -0,0 +1,100 @@
+#include "MockDriverContext.h"
+
+#include <cstring>
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+MockServerDriverHost::MockServerDriverHost()
+{
+	ResetDevices();
+}
+
+void MockServerDriverHost::ResetDevices()
+{
+	memset(devices, 0, sizeof devices);
+}
+
+void MockServerDriverHost::TrackedDevicePoseUpdated(uint32_t unWhichDevice, const vr::DriverPose_t &newPose, uint32_t unPoseStructSize)
+{
+	if (unWhichDevice >= vr::k_unMaxTrackedDeviceCount)
+		return;
+
+	// Each device is only posed from one thread, like the drivers SteamVR loads.
+	auto &device = devices[unWhichDevice];
+	device.poses++;
+	if (newPose.vecWorldFromDriverTranslation[0] != 0.0)
+		device.transformed++;
+	for (int i = 0; i < 3; i++)
+		device.lastPosition[i] = newPose.vecPosition[i];
+
+	// Only when it changes, so the counter isn't read with every pose.
+	if (newPose.vecWorldFromDriverTranslation[0] != device.lastWorldX)
+	{
+		device.lastWorldX = newPose.vecWorldFromDriverTranslation[0];
+		LARGE_INTEGER now;
+		QueryPerformanceCounter(&now);
+		device.movedTicks.store((uint64_t) now.QuadPart, std::memory_order_release);
+	}
+}
+
+void MockSettings::GetString(const char *pchSection, const char *pchSettingsKey, char *pchValue, uint32_t unValueLen, vr::EVRSettingsError *peError)
+{
+	if (pchValue && unValueLen)
+		pchValue[0] = 0;
+
+	if (poseHookMethod && strcmp(pchSettingsKey, "poseHookMethod") == 0 && pchValue && unValueLen > strlen(poseHookMethod))
+	{
+		strcpy_s(pchValue, unValueLen, poseHookMethod);
+		if (peError)
+			*peError = vr::VRSettingsError_None;
+		return;
+	}
+	SetError(peError);
+}
+
+vr::ETrackedPropertyError MockProperties::ReadPropertyBatch(vr::PropertyContainerHandle_t ulContainerHandle, vr::PropertyRead_t *pBatch, uint32_t unBatchEntryCount)
+{
+	for (uint32_t i = 0; i < unBatchEntryCount; i++)
+	{
+		pBatch[i].unTag = vr::k_unInvalidPropertyTag;
+		pBatch[i].unRequiredBufferSize = 0;
+		pBatch[i].eError = vr::TrackedProp_UnknownProperty;
+	}
+	return vr::TrackedProp_Success;
+}
+
+uint32_t MockDriverManager::GetDriverName(vr::DriverId_t nDriver, char *pchValue, uint32_t unBufferSize)
+{
+	if (pchValue && unBufferSize)
+		pchValue[0] = 0;
+	return 0;
+}
+
+uint32_t MockResources::GetResourceFullPath(const char *pchResourceName, const char *pchResourceTypeDirectory, char *pchPathBuffer, uint32_t unBufferLen)
+{
+	if (pchPathBuffer && unBufferLen)
+		pchPathBuffer[0] = 0;
+	return 0;
+}
+
+void *MockDriverContext::GetGenericInterface(const char *pchInterfaceVersion, vr::EVRInitError *peError)
+{
+	void *found = nullptr;
+	if (strcmp(pchInterfaceVersion, "IVRServerDriverHost_005") == 0 || strcmp(pchInterfaceVersion, "IVRServerDriverHost_006") == 0)
+		found = &serverDriverHost;
+	else if (strcmp(pchInterfaceVersion, vr::IVRSettings_Version) == 0)
+		found = &settings;
+	else if (strcmp(pchInterfaceVersion, vr::IVRProperties_Version) == 0)
+		found = &properties;
+	else if (strcmp(pchInterfaceVersion, vr::IVRDriverLog_Version) == 0)
+		found = &driverLog;
+	else if (strcmp(pchInterfaceVersion, vr::IVRDriverManager_Version) == 0)
+		found = &driverManager;
+	else if (strcmp(pchInterfaceVersion, vr::IVRResources_Version) == 0)
+		found = &resources;
+
+	if (peError)
+		*peError = found ? vr::VRInitError_None : vr::VRInitError_Init_InterfaceNotFound;
+	return found;
+}
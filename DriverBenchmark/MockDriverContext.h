@@ -0,0 +1,117 @@
+#pragma once
+
+#include <openvr_driver.h>
+#include <atomic>
+#include <cstdint>
+
+/**
+ * Just enough of vrserver for ServerTrackedDeviceProvider::Init to succeed and InjectHooks to
+ * hook the pose updates, without SteamVR. The server driver host keeps what reaches it per
+ * device, so the benchmark can check that every pose got through the detour. Properties are
+ * all unknown, which keeps the transform cache from saving anything for the synthetic devices.
+ */
+class MockServerDriverHost : public vr::IVRServerDriverHost
+{
+public:
+	struct alignas(64) DeviceSink
+	{
+		uint64_t poses;
+		uint64_t transformed; // Poses that arrived with a world-from-driver translation.
+		double lastPosition[3];
+
+		// QueryPerformanceCounter ticks when the world-from-driver translation last changed, read
+		// by the benchmark's main thread to see an edit arrive.
+		double lastWorldX;
+		std::atomic<uint64_t> movedTicks;
+	};
+
+	DeviceSink devices[vr::k_unMaxTrackedDeviceCount];
+
+	MockServerDriverHost();
+	void ResetDevices();
+
+	virtual bool TrackedDeviceAdded(const char *pchDeviceSerialNumber, vr::ETrackedDeviceClass eDeviceClass, vr::ITrackedDeviceServerDriver *pDriver) override { return false; }
+	// Never inlined, the detour is patched into its code and every call has to reach it.
+	__declspec(noinline) virtual void TrackedDevicePoseUpdated(uint32_t unWhichDevice, const vr::DriverPose_t &newPose, uint32_t unPoseStructSize) override;
+	virtual void VsyncEvent(double vsyncTimeOffsetSeconds) override { }
+	virtual void VendorSpecificEvent(uint32_t unWhichDevice, vr::EVREventType eventType, const vr::VREvent_Data_t &eventData, double eventTimeOffset) override { }
+	virtual bool IsExiting() override { return false; }
+	virtual bool PollNextEvent(vr::VREvent_t *pEvent, uint32_t uncbVREvent) override { return false; }
+	virtual void GetRawTrackedDevicePoses(float fPredictedSecondsFromNow, vr::TrackedDevicePose_t *pTrackedDevicePoseArray, uint32_t unTrackedDevicePoseArrayCount) override { }
+	virtual void TrackedDeviceDisplayTransformUpdated(uint32_t unWhichDevice, vr::HmdMatrix34_t eyeToHeadLeft, vr::HmdMatrix34_t eyeToHeadRight) override { }
+	virtual void RequestRestart(const char *pchLocalizedReason, const char *pchExecutableToStart, const char *pchArguments, const char *pchWorkingDirectory) override { }
+	virtual uint32_t GetFrameTimings(vr::Compositor_FrameTiming *pTiming, uint32_t nFrames) override { return 0; }
+};
+
+class MockSettings : public vr::IVRSettings
+{
+public:
+	const char *poseHookMethod = nullptr; // The driver's poseHookMethod, unset if null.
+
+	virtual const char *GetSettingsErrorNameFromEnum(vr::EVRSettingsError eError) override { return "mock"; }
+	virtual void SetBool(const char *pchSection, const char *pchSettingsKey, bool bValue, vr::EVRSettingsError *peError) override { SetError(peError); }
+	virtual void SetInt32(const char *pchSection, const char *pchSettingsKey, int32_t nValue, vr::EVRSettingsError *peError) override { SetError(peError); }
+	virtual void SetFloat(const char *pchSection, const char *pchSettingsKey, float flValue, vr::EVRSettingsError *peError) override { SetError(peError); }
+	virtual void SetString(const char *pchSection, const char *pchSettingsKey, const char *pchValue, vr::EVRSettingsError *peError) override { SetError(peError); }
+	virtual bool GetBool(const char *pchSection, const char *pchSettingsKey, vr::EVRSettingsError *peError) override { SetError(peError); return false; }
+	virtual int32_t GetInt32(const char *pchSection, const char *pchSettingsKey, vr::EVRSettingsError *peError) override { SetError(peError); return 0; }
+	virtual float GetFloat(const char *pchSection, const char *pchSettingsKey, vr::EVRSettingsError *peError) override { SetError(peError); return 0.0f; }
+	virtual void GetString(const char *pchSection, const char *pchSettingsKey, char *pchValue, uint32_t unValueLen, vr::EVRSettingsError *peError) override;
+	virtual void RemoveSection(const char *pchSection, vr::EVRSettingsError *peError) override { SetError(peError); }
+	virtual void RemoveKeyInSection(const char *pchSection, const char *pchSettingsKey, vr::EVRSettingsError *peError) override { SetError(peError); }
+
+private:
+	static void SetError(vr::EVRSettingsError *peError)
+	{
+		if (peError)
+			*peError = vr::VRSettingsError_ReadFailed;
+	}
+};
+
+class MockProperties : public vr::IVRProperties
+{
+public:
+	virtual vr::ETrackedPropertyError ReadPropertyBatch(vr::PropertyContainerHandle_t ulContainerHandle, vr::PropertyRead_t *pBatch, uint32_t unBatchEntryCount) override;
+	virtual vr::ETrackedPropertyError WritePropertyBatch(vr::PropertyContainerHandle_t ulContainerHandle, vr::PropertyWrite_t *pBatch, uint32_t unBatchEntryCount) override { return vr::TrackedProp_Success; }
+	virtual const char *GetPropErrorNameFromEnum(vr::ETrackedPropertyError error) override { return "mock"; }
+	virtual vr::PropertyContainerHandle_t TrackedDeviceToPropertyContainer(vr::TrackedDeviceIndex_t nDevice) override { return nDevice + 1; }
+};
+
+class MockDriverLog : public vr::IVRDriverLog
+{
+public:
+	virtual void Log(const char *pchLogMessage) override { }
+};
+
+class MockDriverManager : public vr::IVRDriverManager
+{
+public:
+	virtual uint32_t GetDriverCount() const override { return 0; }
+	virtual uint32_t GetDriverName(vr::DriverId_t nDriver, char *pchValue, uint32_t unBufferSize) override;
+	virtual vr::DriverHandle_t GetDriverHandle(const char *pchDriverName) override { return vr::k_ulInvalidPropertyContainer; }
+	virtual bool IsEnabled(vr::DriverId_t nDriver) const override { return false; }
+};
+
+class MockResources : public vr::IVRResources
+{
+public:
+	virtual uint32_t LoadSharedResource(const char *pchResourceName, char *pchBuffer, uint32_t unBufferLen) override { return 0; }
+	virtual uint32_t GetResourceFullPath(const char *pchResourceName, const char *pchResourceTypeDirectory, char *pchPathBuffer, uint32_t unBufferLen) override;
+};
+
+// Hands out the mocks above. The server driver host is returned for IVRServerDriverHost_005,
+// which Init asks for, and for IVRServerDriverHost_006, which the benchmark asks for through
+// the hooked GetGenericInterface to get TrackedDevicePoseUpdated hooked.
+class MockDriverContext : public vr::IVRDriverContext
+{
+public:
+	MockServerDriverHost serverDriverHost;
+	MockSettings settings;
+	MockProperties properties;
+	MockDriverLog driverLog;
+	MockDriverManager driverManager;
+	MockResources resources;
+
+	virtual void *GetGenericInterface(const char *pchInterfaceVersion, vr::EVRInitError *peError) override;
+	virtual vr::DriverHandle_t GetDriverHandle() override { return 1; }
+};
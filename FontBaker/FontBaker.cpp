@@ -0,0 +1,124 @@
+#define _CRT_SECURE_NO_DEPRECATE
+#include "EmbeddedFiles.h"
+
+#include <imgui/imgui.h>
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+/**
+ * Rasterizes the UI font the way ImGui would at startup and writes the result as
+ * OpenVR-SpaceCalibrator/BakedFontData.cpp, see BakedFont.h there. The client uploads the
+ * baked atlas as it is, so neither the TTF nor stb_truetype's rasterizer run when it starts.
+ * Run it again after changing the font, its size or ImGui:
+ *
+ *   FontBaker.exe OpenVR-SpaceCalibrator\BakedFontData.cpp
+ */
+
+static const float FontSize = 24.0f; // pixels
+
+// Shortest text that reads back as the same float, as a C++ float literal.
+static std::string FloatLiteral(float value)
+{
+	char text[32];
+	snprintf(text, sizeof text, "%.9g", value);
+	std::string literal = text;
+	if (literal.find_first_of(".e") == std::string::npos)
+		literal += ".0";
+	return literal + "f";
+}
+
+// Zero runs become a 0 and their length, up to 255, other bytes stay as they are. Most of
+// the atlas is the space between glyphs.
+static std::vector<unsigned char> EncodePixels(const unsigned char *pixels, size_t size)
+{
+	std::vector<unsigned char> encoded;
+	for (size_t i = 0; i < size;)
+	{
+		if (pixels[i])
+		{
+			encoded.push_back(pixels[i++]);
+			continue;
+		}
+
+		size_t run = 1;
+		while (i + run < size && run < 255 && !pixels[i + run])
+			run++;
+		encoded.push_back(0);
+		encoded.push_back((unsigned char) run);
+		i += run;
+	}
+	return encoded;
+}
+
+int main(int argc, char **argv)
+{
+	if (argc != 2)
+	{
+		fprintf(stderr, "Usage: FontBaker <output .cpp>\n");
+		return 1;
+	}
+
+	ImFontAtlas atlas;
+	ImFont *font = atlas.AddFontFromMemoryCompressedTTF(DroidSans_compressed_data, DroidSans_compressed_size, FontSize);
+	unsigned char *pixels;
+	int width, height;
+	atlas.GetTexDataAsAlpha8(&pixels, &width, &height);
+	if (!font || !pixels)
+	{
+		fprintf(stderr, "Couldn't build the font atlas\n");
+		return 1;
+	}
+
+	FILE *file = fopen(argv[1], "w");
+	if (!file)
+	{
+		fprintf(stderr, "Couldn't open %s\n", argv[1]);
+		return 1;
+	}
+
+	fprintf(file, "// Generated by FontBaker from DroidSans.ttf at %g px, don't edit.\n", FontSize);
+	fprintf(file, "#include \"BakedFont.h\"\n\n");
+	fprintf(file, "const BakedFontInfo BakedFont = { \"%s\", %s, %s, %s, %s, %s, %d, %d, { %s, %s } };\n\n", IMGUI_VERSION,
+		FloatLiteral(font->FontSize).c_str(), FloatLiteral(font->Ascent).c_str(), FloatLiteral(font->Descent).c_str(),
+		FloatLiteral(font->DisplayOffset.x).c_str(), FloatLiteral(font->DisplayOffset.y).c_str(), width, height,
+		FloatLiteral(atlas.TexUvWhitePixel.x).c_str(), FloatLiteral(atlas.TexUvWhitePixel.y).c_str());
+
+	// The tab glyph is made up again by ImFont::BuildLookupTable.
+	std::vector<const ImFontGlyph *> glyphs;
+	for (const auto &glyph : font->Glyphs)
+	{
+		if (glyph.Codepoint != '\t')
+			glyphs.push_back(&glyph);
+	}
+
+	fprintf(file, "const unsigned int BakedGlyphCount = %u;\n", (unsigned) glyphs.size());
+	fprintf(file, "const BakedGlyph BakedGlyphs[%u] =\n{\n", (unsigned) glyphs.size());
+	for (const ImFontGlyph *glyph : glyphs)
+	{
+		fprintf(file, "\t{ 0x%04x, %s, %s, %s, %s, %s, %s, %s, %s, %s },\n", glyph->Codepoint, FloatLiteral(glyph->AdvanceX).c_str(),
+			FloatLiteral(glyph->X0).c_str(), FloatLiteral(glyph->Y0).c_str(), FloatLiteral(glyph->X1).c_str(), FloatLiteral(glyph->Y1).c_str(),
+			FloatLiteral(glyph->U0).c_str(), FloatLiteral(glyph->V0).c_str(), FloatLiteral(glyph->U1).c_str(), FloatLiteral(glyph->V1).c_str());
+	}
+	fprintf(file, "};\n\n");
+
+	auto encoded = EncodePixels(pixels, (size_t) width * height);
+	fprintf(file, "const unsigned int BakedFontPixelsSize = %u;\n", (unsigned) encoded.size());
+	fprintf(file, "const unsigned char BakedFontPixels[%u] =\n{", (unsigned) encoded.size());
+	for (size_t i = 0; i < encoded.size(); i++)
+		fprintf(file, "%s0x%02x,", i % 24 ? " " : "\n\t", encoded[i]);
+	fprintf(file, "\n};\n");
+
+	bool ok = !ferror(file);
+	fclose(file);
+	if (!ok)
+	{
+		fprintf(stderr, "Couldn't write %s\n", argv[1]);
+		return 1;
+	}
+
+	printf("%dx%d atlas, %u glyphs, %u bytes encoded from %d\n", width, height, (unsigned) glyphs.size(), (unsigned) encoded.size(), width * height);
+	return 0;
+}
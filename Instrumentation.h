@@ -0,0 +1,74 @@
+#pragma once
+
+/**
+ * Optional profiler zones around the hot paths of the client, the driver and the solver, for
+ * lining the calibrator up with SteamVR's own timing in one timeline. A zone lasts until the
+ * end of the scope it's declared in, names must be string literals.
+ *
+ * Nothing is compiled in by default. Define SPACECAL_TRACY to send zones to a Tracy client,
+ * which needs Tracy's include directory and TracyClient.cpp added to the projects. Define
+ * SPACECAL_ETW to write them as TraceLogging start/stop events of the SpaceCalibrator
+ * provider, for capturing with WPR next to the compositor's events. ETW also needs
+ * SPACECAL_DEFINE_TRACE_PROVIDER in one file of each module, and the provider registered with
+ * SPACECAL_INSTRUMENTATION_START and SPACECAL_INSTRUMENTATION_STOP for the module's lifetime.
+ */
+
+#define SPACECAL_CONCAT_(a, b) a##b
+#define SPACECAL_CONCAT(a, b) SPACECAL_CONCAT_(a, b)
+
+#if defined(SPACECAL_TRACY)
+
+#include <tracy/Tracy.hpp>
+
+#define SPACECAL_ZONE(name) ZoneScopedN(name)
+#define SPACECAL_FRAME_MARK(name) FrameMarkNamed(name)
+#define SPACECAL_DEFINE_TRACE_PROVIDER
+#define SPACECAL_INSTRUMENTATION_START() ((void) 0)
+#define SPACECAL_INSTRUMENTATION_STOP() ((void) 0)
+
+#elif defined(SPACECAL_ETW)
+
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#include <TraceLoggingProvider.h>
+#include <winmeta.h>
+
+TRACELOGGING_DECLARE_PROVIDER(SpaceCalibratorTraceProvider);
+
+class SpaceCalibratorTraceZone
+{
+public:
+	explicit SpaceCalibratorTraceZone(const char *name) : name(name)
+	{
+		TraceLoggingWrite(SpaceCalibratorTraceProvider, "Zone", TraceLoggingOpcode(WINEVENT_OPCODE_START), TraceLoggingString(name, "Name"));
+	}
+
+	~SpaceCalibratorTraceZone()
+	{
+		TraceLoggingWrite(SpaceCalibratorTraceProvider, "Zone", TraceLoggingOpcode(WINEVENT_OPCODE_STOP), TraceLoggingString(name, "Name"));
+	}
+
+private:
+	const char *name;
+};
+
+#define SPACECAL_ZONE(name) SpaceCalibratorTraceZone SPACECAL_CONCAT(spacecalZone, __LINE__)(name)
+#define SPACECAL_FRAME_MARK(name) TraceLoggingWrite(SpaceCalibratorTraceProvider, "Frame", TraceLoggingString(name, "Name"))
+
+// {f7013200-e688-40e7-82eb-6952286727b6}
+#define SPACECAL_DEFINE_TRACE_PROVIDER TRACELOGGING_DEFINE_PROVIDER(SpaceCalibratorTraceProvider, "SpaceCalibrator", \
+	(0xf7013200, 0xe688, 0x40e7, 0x82, 0xeb, 0x69, 0x52, 0x28, 0x67, 0x27, 0xb6));
+#define SPACECAL_INSTRUMENTATION_START() TraceLoggingRegister(SpaceCalibratorTraceProvider)
+#define SPACECAL_INSTRUMENTATION_STOP() TraceLoggingUnregister(SpaceCalibratorTraceProvider)
+
+#else
+
+#define SPACECAL_ZONE(name) ((void) 0)
+#define SPACECAL_FRAME_MARK(name) ((void) 0)
+#define SPACECAL_DEFINE_TRACE_PROVIDER
+#define SPACECAL_INSTRUMENTATION_START() ((void) 0)
+#define SPACECAL_INSTRUMENTATION_STOP() ((void) 0)
+
+#endif
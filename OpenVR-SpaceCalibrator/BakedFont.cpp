@@ -0,0 +1,72 @@
+#include "stdafx.h"
+#include "BakedFont.h"
+
+#include <imgui/imgui.h>
+
+#include <cstring>
+#include <stdexcept>
+
+static unsigned char *DecodeBakedPixels()
+{
+	size_t size = (size_t) BakedFont.width * BakedFont.height, filled = 0;
+	auto pixels = (unsigned char *) ImGui::MemAlloc(size);
+	for (unsigned int i = 0; i < BakedFontPixelsSize && filled < size; i++)
+	{
+		unsigned char value = BakedFontPixels[i];
+		size_t run = value || i + 1 == BakedFontPixelsSize ? 1 : BakedFontPixels[++i];
+		run = run < size - filled ? run : size - filled;
+		memset(pixels + filled, value, run);
+		filled += run;
+	}
+	if (filled != size)
+	{
+		ImGui::MemFree(pixels);
+		throw std::runtime_error("The baked UI font's atlas is truncated, run FontBaker again");
+	}
+	return pixels;
+}
+
+void LoadBakedFont(ImFontAtlas *atlas)
+{
+	if (strcmp(BakedFont.imguiVersion, IMGUI_VERSION) != 0)
+		throw std::runtime_error("The baked UI font is from another ImGui version, run FontBaker again");
+
+	// What ImFontAtlas::Build would have left behind. Nothing else is read once TexPixelsAlpha8 is set.
+	atlas->TexPixelsAlpha8 = DecodeBakedPixels();
+	atlas->TexWidth = BakedFont.width;
+	atlas->TexHeight = BakedFont.height;
+	atlas->TexUvScale = ImVec2(1.0f / BakedFont.width, 1.0f / BakedFont.height);
+	atlas->TexUvWhitePixel = ImVec2(BakedFont.whitePixel[0], BakedFont.whitePixel[1]);
+
+	ImFont *font = IM_NEW(ImFont);
+	font->FontSize = BakedFont.size;
+	font->Ascent = BakedFont.ascent;
+	font->Descent = BakedFont.descent;
+	font->DisplayOffset = ImVec2(BakedFont.displayOffsetX, BakedFont.displayOffsetY);
+	font->ContainerAtlas = atlas;
+
+	font->Glyphs.resize((int) BakedGlyphCount);
+	for (unsigned int i = 0; i < BakedGlyphCount; i++)
+	{
+		const BakedGlyph &baked = BakedGlyphs[i];
+		ImFontGlyph &glyph = font->Glyphs[(int) i];
+		glyph.Codepoint = baked.codepoint;
+		glyph.AdvanceX = baked.advanceX;
+		glyph.X0 = baked.x0;
+		glyph.Y0 = baked.y0;
+		glyph.X1 = baked.x1;
+		glyph.Y1 = baked.y1;
+		glyph.U0 = baked.u0;
+		glyph.V0 = baked.v0;
+		glyph.U1 = baked.u1;
+		glyph.V1 = baked.v1;
+	}
+	font->BuildLookupTable();
+	atlas->Fonts.push_back(font);
+}
+
+void LoadBakedFontPixels(ImFontAtlas *atlas)
+{
+	if (!atlas->TexPixelsAlpha8 && !atlas->TexPixelsRGBA32)
+		atlas->TexPixelsAlpha8 = DecodeBakedPixels();
+}
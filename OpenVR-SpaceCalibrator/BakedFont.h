@@ -0,0 +1,43 @@
+#pragma once
+
+struct ImFontAtlas;
+
+/**
+ * The UI font as FontBaker rasterized it: ImGui's glyph metrics and its alpha atlas, which
+ * the client takes over as they are instead of loading the TTF and rasterizing it on every
+ * start. BakedFontData.cpp is generated, see FontBaker.cpp.
+ */
+struct BakedFontInfo
+{
+	const char *imguiVersion; // IMGUI_VERSION of the build that baked it, the glyph layout is ImGui's.
+	float size, ascent, descent;
+	float displayOffsetX, displayOffsetY;
+	int width, height; // Of the atlas, in pixels.
+	float whitePixel[2]; // Atlas coordinates.
+};
+
+struct BakedGlyph
+{
+	unsigned short codepoint;
+	float advanceX;
+	float x0, y0, x1, y1; // Pixels around the pen position.
+	float u0, v0, u1, v1; // Atlas coordinates.
+};
+
+extern const BakedFontInfo BakedFont;
+extern const unsigned int BakedGlyphCount;
+extern const BakedGlyph BakedGlyphs[];
+
+// The atlas, one alpha byte per pixel row by row. A zero is followed by how many pixels the
+// run of zeros it starts covers, 1 to 255, every other byte is one pixel.
+extern const unsigned int BakedFontPixelsSize;
+extern const unsigned char BakedFontPixels[];
+
+// Adds the baked font to an empty atlas together with its texture, which ImGui then uploads
+// without building anything. Throws std::runtime_error when the font was baked by a different
+// ImGui or its pixels don't fill the atlas.
+void LoadBakedFont(ImFontAtlas *atlas);
+
+// Decodes the atlas again after ImFontAtlas::ClearTexData, before ImGui next creates its font
+// texture. Does nothing while the atlas still has pixels.
+void LoadBakedFontPixels(ImFontAtlas *atlas);
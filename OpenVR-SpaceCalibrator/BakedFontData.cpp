@@ -0,0 +1,2584 @@
+// Generated by FontBaker from DroidSans.ttf at 24 px, don't edit.
+#include "BakedFont.h"
+
+const BakedFontInfo BakedFont = { "1.62", 24.0f, 20.0f, -5.0f, 0.0f, 0.0f, 512, 256, { 0.0009765625f, 0.001953125f } };
+
+const unsigned int BakedGlyphCount = 191;
+const BakedGlyph BakedGlyphs[191] =
+{
+	{ 0x0020, 5.35570431f, -0.333333343f, 20.0f, 0.333333343f, 20.0f, 0.21875f, 0.765625f, 0.22265625f, 0.765625f },
+	{ 0x0021, 5.54697943f, 1.0f, 5.0f, 4.66666651f, 21.0f, 0.001953125f, 0.4765625f, 0.0234375f, 0.5390625f },
+	{ 0x0022, 8.28523445f, 1.0f, 5.0f, 7.33333349f, 11.0f, 0.0625f, 0.765625f, 0.099609375f, 0.7890625f },
+	{ 0x0023, 13.3187914f, 0.0f, 5.0f, 13.333334f, 20.0f, 0.443359375f, 0.52734375f, 0.521484375f, 0.5859375f },
+	{ 0x0024, 11.3557043f, 0.666666627f, 4.0f, 10.333334f, 22.0f, 0.1796875f, 0.19140625f, 0.236328125f, 0.26171875f },
+	{ 0x0025, 17.013422f, 0.666666627f, 5.0f, 16.333334f, 21.0f, 0.83203125f, 0.390625f, 0.923828125f, 0.453125f },
+	{ 0x0026, 14.4765091f, 0.666666627f, 5.0f, 14.666667f, 21.0f, 0.240234375f, 0.39453125f, 0.322265625f, 0.45703125f },
+	{ 0x0027, 4.66107368f, 1.0f, 5.0f, 3.66666675f, 11.0f, 0.9765625f, 0.75390625f, 0.9921875f, 0.77734375f },
+	{ 0x0028, 6.20134211f, 0.333333343f, 5.0f, 6.0f, 24.0f, 0.080078125f, 0.19140625f, 0.11328125f, 0.265625f },
+	{ 0x0029, 6.20134211f, 0.0f, 5.0f, 6.0f, 24.0f, 0.04296875f, 0.19140625f, 0.078125f, 0.265625f },
+	{ 0x002a, 11.3557043f, 0.333333343f, 4.0f, 11.000001f, 14.0f, 0.291015625f, 0.76171875f, 0.353515625f, 0.80078125f },
+	{ 0x002b, 11.3557043f, 0.666666627f, 8.0f, 10.666667f, 18.0f, 0.35546875f, 0.76171875f, 0.4140625f, 0.80078125f },
+	{ 0x002c, 5.1543622f, 0.0f, 17.0f, 4.33333349f, 23.0f, 0.1015625f, 0.765625f, 0.126953125f, 0.7890625f },
+	{ 0x002d, 6.63422775f, 0.333333343f, 13.0f, 6.33333349f, 16.0f, 0.8515625f, 0.79296875f, 0.88671875f, 0.8046875f },
+	{ 0x002e, 5.52684546f, 1.0f, 17.0f, 4.66666651f, 21.0f, 0.033203125f, 0.76953125f, 0.0546875f, 0.78515625f },
+	{ 0x002f, 7.69127464f, -0.333333343f, 5.0f, 8.00000095f, 20.0f, 0.794921875f, 0.6484375f, 0.84375f, 0.70703125f },
+	{ 0x0030, 11.3557043f, 0.333333343f, 5.0f, 11.000001f, 21.0f, 0.001953125f, 0.41015625f, 0.064453125f, 0.47265625f },
+	{ 0x0031, 11.3557043f, 1.33333337f, 5.0f, 7.66666651f, 20.0f, 0.23046875f, 0.65234375f, 0.267578125f, 0.7109375f },
+	{ 0x0032, 11.3557043f, 0.333333343f, 5.0f, 10.666667f, 20.0f, 0.552734375f, 0.6484375f, 0.61328125f, 0.70703125f },
+	{ 0x0033, 11.3557043f, 0.333333343f, 5.0f, 10.666667f, 21.0f, 0.640625f, 0.45703125f, 0.701171875f, 0.51953125f },
+	{ 0x0034, 11.3557043f, -0.333333343f, 5.0f, 11.333334f, 20.0f, 0.896484375f, 0.5859375f, 0.96484375f, 0.64453125f },
+	{ 0x0035, 11.3557043f, 0.666666627f, 5.0f, 10.666667f, 21.0f, 0.828125f, 0.45703125f, 0.88671875f, 0.51953125f },
+	{ 0x0036, 11.3557043f, 0.666666627f, 5.0f, 11.000001f, 21.0f, 0.703125f, 0.45703125f, 0.763671875f, 0.51953125f },
+	{ 0x0037, 11.3557043f, 0.333333343f, 5.0f, 11.000001f, 20.0f, 0.359375f, 0.58984375f, 0.421875f, 0.6484375f },
+	{ 0x0038, 11.3557043f, 0.666666627f, 5.0f, 10.666667f, 21.0f, 0.888671875f, 0.45703125f, 0.947265625f, 0.51953125f },
+	{ 0x0039, 11.3557043f, 0.666666627f, 5.0f, 11.000001f, 21.0f, 0.765625f, 0.45703125f, 0.826171875f, 0.51953125f },
+	{ 0x003a, 5.52684546f, 1.0f, 8.0f, 4.66666651f, 21.0f, 0.505859375f, 0.70703125f, 0.52734375f, 0.7578125f },
+	{ 0x003b, 5.52684546f, 0.0f, 8.0f, 4.66666651f, 23.0f, 0.30859375f, 0.65234375f, 0.3359375f, 0.7109375f },
+	{ 0x003c, 11.3557043f, 0.666666627f, 7.0f, 10.666667f, 18.0f, 0.224609375f, 0.71484375f, 0.283203125f, 0.7578125f },
+	{ 0x003d, 11.3557043f, 0.666666627f, 9.0f, 10.666667f, 16.0f, 0.810546875f, 0.76171875f, 0.869140625f, 0.7890625f },
+	{ 0x003e, 11.3557043f, 0.666666627f, 7.0f, 10.666667f, 18.0f, 0.0625f, 0.71875f, 0.12109375f, 0.76171875f },
+	{ 0x003f, 8.77852345f, 0.0f, 5.0f, 8.66666698f, 21.0f, 0.423828125f, 0.4609375f, 0.474609375f, 0.5234375f },
+	{ 0x0040, 17.8590603f, 0.666666627f, 5.0f, 17.333334f, 22.0f, 0.515625f, 0.25f, 0.61328125f, 0.31640625f },
+	{ 0x0041, 12.5335569f, -0.333333343f, 5.0f, 13.000001f, 20.0f, 0.5234375f, 0.52734375f, 0.6015625f, 0.5859375f },
+	{ 0x0042, 12.8053684f, 1.66666663f, 5.0f, 12.333334f, 20.0f, 0.423828125f, 0.58984375f, 0.486328125f, 0.6484375f },
+	{ 0x0043, 12.4328852f, 0.666666627f, 5.0f, 12.333334f, 21.0f, 0.92578125f, 0.390625f, 0.994140625f, 0.453125f },
+	{ 0x0044, 14.1040258f, 1.66666663f, 5.0f, 13.333334f, 20.0f, 0.150390625f, 0.58984375f, 0.21875f, 0.6484375f },
+	{ 0x0045, 10.8825502f, 1.66666663f, 5.0f, 10.000001f, 20.0f, 0.845703125f, 0.6484375f, 0.89453125f, 0.70703125f },
+	{ 0x0046, 10.1275167f, 1.66666663f, 5.0f, 10.000001f, 20.0f, 0.896484375f, 0.6484375f, 0.9453125f, 0.70703125f },
+	{ 0x0047, 14.2248316f, 0.666666627f, 5.0f, 13.333334f, 21.0f, 0.115234375f, 0.40625f, 0.189453125f, 0.46875f },
+	{ 0x0048, 14.4563751f, 1.66666663f, 5.0f, 13.000001f, 20.0f, 0.001953125f, 0.54296875f, 0.068359375f, 0.6015625f },
+	{ 0x0049, 6.98657703f, 0.333333343f, 5.0f, 6.66666651f, 20.0f, 0.26953125f, 0.65234375f, 0.306640625f, 0.7109375f },
+	{ 0x004a, 5.58724833f, -2.33333325f, 5.0f, 4.33333349f, 24.0f, 0.001953125f, 0.19140625f, 0.041015625f, 0.265625f },
+	{ 0x004b, 11.9395971f, 1.66666663f, 5.0f, 12.333334f, 20.0f, 0.48828125f, 0.58984375f, 0.55078125f, 0.6484375f },
+	{ 0x004c, 10.1275167f, 1.66666663f, 5.0f, 10.000001f, 20.0f, 0.947265625f, 0.6484375f, 0.99609375f, 0.70703125f },
+	{ 0x004d, 17.9395962f, 1.66666663f, 5.0f, 16.333334f, 20.0f, 0.267578125f, 0.52734375f, 0.353515625f, 0.5859375f },
+	{ 0x004e, 15.030201f, 1.66666663f, 5.0f, 13.666667f, 20.0f, 0.6796875f, 0.5859375f, 0.75f, 0.64453125f },
+	{ 0x004f, 15.3020124f, 0.666666627f, 5.0f, 14.666667f, 21.0f, 0.32421875f, 0.39453125f, 0.40625f, 0.45703125f },
+	{ 0x0050, 11.8791943f, 1.66666663f, 5.0f, 11.333334f, 20.0f, 0.677734375f, 0.6484375f, 0.734375f, 0.70703125f },
+	{ 0x0051, 15.2818785f, 0.666666627f, 5.0f, 14.666667f, 25.0f, 0.43359375f, 0.08984375f, 0.515625f, 0.16796875f },
+	{ 0x0052, 12.1610737f, 1.66666663f, 5.0f, 12.333334f, 20.0f, 0.0703125f, 0.6015625f, 0.1328125f, 0.66015625f },
+	{ 0x0053, 10.7013416f, 0.666666627f, 5.0f, 10.333334f, 21.0f, 0.19140625f, 0.4609375f, 0.248046875f, 0.5234375f },
+	{ 0x0054, 10.7013416f, -0.333333343f, 5.0f, 11.000001f, 20.0f, 0.291015625f, 0.58984375f, 0.357421875f, 0.6484375f },
+	{ 0x0055, 14.3959723f, 1.33333337f, 5.0f, 13.000001f, 21.0f, 0.408203125f, 0.39453125f, 0.4765625f, 0.45703125f },
+	{ 0x0056, 11.7080536f, -0.333333343f, 5.0f, 12.333334f, 20.0f, 0.603515625f, 0.5859375f, 0.677734375f, 0.64453125f },
+	{ 0x0057, 18.2214756f, -0.333333343f, 5.0f, 18.666666f, 20.0f, 0.640625f, 0.5234375f, 0.751953125f, 0.58203125f },
+	{ 0x0058, 11.2751675f, -0.333333343f, 5.0f, 11.666667f, 20.0f, 0.751953125f, 0.5859375f, 0.822265625f, 0.64453125f },
+	{ 0x0059, 10.8624153f, -0.333333343f, 5.0f, 11.333334f, 20.0f, 0.220703125f, 0.58984375f, 0.2890625f, 0.6484375f },
+	{ 0x005a, 11.1140938f, 0.333333343f, 5.0f, 10.666667f, 20.0f, 0.615234375f, 0.6484375f, 0.67578125f, 0.70703125f },
+	{ 0x005b, 6.25167751f, 1.0f, 5.0f, 6.33333349f, 24.0f, 0.115234375f, 0.19140625f, 0.146484375f, 0.265625f },
+	{ 0x005c, 7.69127464f, -0.333333343f, 5.0f, 8.00000095f, 20.0f, 0.134765625f, 0.65234375f, 0.18359375f, 0.7109375f },
+	{ 0x005d, 6.25167751f, 0.0f, 5.0f, 5.0f, 24.0f, 0.1484375f, 0.19140625f, 0.177734375f, 0.265625f },
+	{ 0x005e, 10.9731541f, 0.0f, 5.0f, 11.000001f, 15.0f, 0.224609375f, 0.76171875f, 0.2890625f, 0.80078125f },
+	{ 0x005f, 8.47651005f, -0.666666687f, 21.0f, 9.00000095f, 24.0f, 0.072265625f, 0.79296875f, 0.12890625f, 0.8046875f },
+	{ 0x0060, 11.8993282f, 3.33333349f, 4.0f, 8.33333397f, 8.0f, 0.001953125f, 0.76953125f, 0.03125f, 0.78515625f },
+	{ 0x0061, 10.9429522f, 0.333333343f, 8.0f, 9.66666698f, 21.0f, 0.396484375f, 0.70703125f, 0.451171875f, 0.7578125f },
+	{ 0x0062, 12.0805368f, 1.33333337f, 4.0f, 11.333334f, 21.0f, 0.06640625f, 0.26953125f, 0.125f, 0.3359375f },
+	{ 0x0063, 9.54362392f, 0.666666627f, 8.0f, 9.33333397f, 21.0f, 0.5f, 0.65234375f, 0.55078125f, 0.703125f },
+	{ 0x0064, 12.0805368f, 0.666666627f, 4.0f, 10.666667f, 21.0f, 0.48828125f, 0.3203125f, 0.546875f, 0.38671875f },
+	{ 0x0065, 11.0335569f, 0.666666627f, 8.0f, 10.333334f, 21.0f, 0.337890625f, 0.70703125f, 0.39453125f, 0.7578125f },
+	{ 0x0066, 6.78523445f, -0.333333343f, 4.0f, 8.00000095f, 20.0f, 0.94921875f, 0.45703125f, 0.998046875f, 0.51953125f },
+	{ 0x0067, 10.6812077f, 0.0f, 8.0f, 10.666667f, 25.0f, 0.69921875f, 0.25f, 0.76171875f, 0.31640625f },
+	{ 0x0068, 12.1409388f, 1.33333337f, 4.0f, 11.000001f, 20.0f, 0.25f, 0.4609375f, 0.306640625f, 0.5234375f },
+	{ 0x0069, 5.33557034f, 1.0f, 4.0f, 4.33333349f, 20.0f, 0.048828125f, 0.4765625f, 0.068359375f, 0.5390625f },
+	{ 0x006a, 5.33557034f, -1.33333337f, 4.0f, 4.33333349f, 25.0f, 0.947265625f, 0.00390625f, 0.98046875f, 0.0859375f },
+	{ 0x006b, 10.2281876f, 1.33333337f, 4.0f, 10.666667f, 20.0f, 0.3671875f, 0.4609375f, 0.421875f, 0.5234375f },
+	{ 0x006c, 5.33557034f, 1.33333337f, 4.0f, 4.0f, 20.0f, 0.623046875f, 0.4609375f, 0.638671875f, 0.5234375f },
+	{ 0x006d, 18.4731541f, 1.33333337f, 8.0f, 17.333334f, 20.0f, 0.529296875f, 0.7109375f, 0.623046875f, 0.7578125f },
+	{ 0x006e, 12.1409388f, 1.33333337f, 8.0f, 11.000001f, 20.0f, 0.908203125f, 0.7109375f, 0.96484375f, 0.7578125f },
+	{ 0x006f, 11.8993282f, 0.666666627f, 8.0f, 11.333334f, 21.0f, 0.435546875f, 0.65234375f, 0.498046875f, 0.703125f },
+	{ 0x0070, 12.0805368f, 1.33333337f, 8.0f, 11.333334f, 25.0f, 0.548828125f, 0.3203125f, 0.607421875f, 0.38671875f },
+	{ 0x0071, 12.0805368f, 0.666666627f, 8.0f, 10.666667f, 25.0f, 0.609375f, 0.3203125f, 0.66796875f, 0.38671875f },
+	{ 0x0072, 8.22483158f, 1.33333337f, 8.0f, 8.33333397f, 20.0f, 0.181640625f, 0.71484375f, 0.22265625f, 0.76171875f },
+	{ 0x0073, 9.3020134f, 0.333333343f, 8.0f, 9.00000095f, 21.0f, 0.453125f, 0.70703125f, 0.50390625f, 0.7578125f },
+	{ 0x0074, 6.98657703f, -0.333333343f, 6.0f, 7.0f, 21.0f, 0.185546875f, 0.65234375f, 0.228515625f, 0.7109375f },
+	{ 0x0075, 12.1409388f, 1.0f, 8.0f, 11.000001f, 21.0f, 0.001953125f, 0.66796875f, 0.060546875f, 0.71875f },
+	{ 0x0076, 9.87583828f, -0.333333343f, 8.0f, 10.333334f, 20.0f, 0.720703125f, 0.7109375f, 0.783203125f, 0.7578125f },
+	{ 0x0077, 15.3825493f, -0.333333343f, 8.0f, 15.666667f, 20.0f, 0.625f, 0.7109375f, 0.71875f, 0.7578125f },
+	{ 0x0078, 10.3087244f, 0.0f, 8.0f, 10.333334f, 20.0f, 0.78515625f, 0.7109375f, 0.845703125f, 0.7578125f },
+	{ 0x0079, 10.0771809f, -0.333333343f, 8.0f, 10.333334f, 25.0f, 0.763671875f, 0.25f, 0.826171875f, 0.31640625f },
+	{ 0x007a, 9.09060383f, 0.333333343f, 8.0f, 8.66666698f, 20.0f, 0.130859375f, 0.71484375f, 0.1796875f, 0.76171875f },
+	{ 0x007b, 7.29865742f, 0.0f, 5.0f, 7.33333349f, 24.0f, 0.947265625f, 0.171875f, 0.990234375f, 0.24609375f },
+	{ 0x007c, 11.3557043f, 4.33333349f, 4.0f, 7.0f, 25.0f, 0.982421875f, 0.00390625f, 0.998046875f, 0.0859375f },
+	{ 0x007d, 7.29865742f, 0.0f, 5.0f, 7.33333349f, 24.0f, 0.341796875f, 0.17578125f, 0.384765625f, 0.25f },
+	{ 0x007e, 11.3557043f, 0.666666627f, 11.0f, 10.666667f, 15.0f, 0.158203125f, 0.765625f, 0.216796875f, 0.78125f },
+	{ 0x00a0, 5.35570431f, -0.333333343f, 20.0f, 0.333333343f, 20.0f, 0.21875f, 0.76953125f, 0.22265625f, 0.76953125f },
+	{ 0x00a1, 5.54697943f, 1.0f, 8.0f, 4.66666651f, 24.0f, 0.025390625f, 0.4765625f, 0.046875f, 0.5390625f },
+	{ 0x00a2, 11.3557043f, 1.33333337f, 5.0f, 10.000001f, 21.0f, 0.4765625f, 0.4609375f, 0.52734375f, 0.5234375f },
+	{ 0x00a3, 11.3557043f, 0.333333343f, 5.0f, 11.000001f, 20.0f, 0.001953125f, 0.60546875f, 0.064453125f, 0.6640625f },
+	{ 0x00a4, 11.3557043f, 0.666666627f, 8.0f, 10.666667f, 18.0f, 0.416015625f, 0.76171875f, 0.474609375f, 0.80078125f },
+	{ 0x00a5, 11.3557043f, -0.333333343f, 5.0f, 11.666667f, 20.0f, 0.82421875f, 0.5859375f, 0.89453125f, 0.64453125f },
+	{ 0x00a6, 11.3557043f, 4.33333349f, 4.0f, 7.0f, 25.0f, 0.416015625f, 0.08984375f, 0.431640625f, 0.171875f },
+	{ 0x00a7, 10.016778f, 0.666666627f, 4.0f, 9.33333397f, 21.0f, 0.53515625f, 0.390625f, 0.5859375f, 0.45703125f },
+	{ 0x00a8, 11.8993282f, 2.66666675f, 4.0f, 9.33333397f, 7.0f, 0.810546875f, 0.79296875f, 0.849609375f, 0.8046875f },
+	{ 0x00a9, 17.1543617f, 0.666666627f, 5.0f, 16.666666f, 21.0f, 0.640625f, 0.390625f, 0.734375f, 0.453125f },
+	{ 0x00aa, 6.82550287f, 0.333333343f, 5.0f, 6.33333349f, 13.0f, 0.7734375f, 0.76171875f, 0.80859375f, 0.79296875f },
+	{ 0x00ab, 10.036912f, 0.333333343f, 10.0f, 9.66666698f, 19.0f, 0.560546875f, 0.76171875f, 0.615234375f, 0.796875f },
+	{ 0x00ac, 11.3557043f, 0.666666627f, 11.0f, 10.666667f, 18.0f, 0.87109375f, 0.76171875f, 0.9296875f, 0.7890625f },
+	{ 0x00ad, 6.63422775f, 0.333333343f, 13.0f, 6.33333349f, 16.0f, 0.888671875f, 0.79296875f, 0.923828125f, 0.8046875f },
+	{ 0x00ae, 17.1543617f, 0.666666627f, 5.0f, 16.666666f, 21.0f, 0.736328125f, 0.390625f, 0.830078125f, 0.453125f },
+	{ 0x00af, 10.3087244f, -0.666666687f, 2.0f, 11.000001f, 5.0f, 0.001953125f, 0.79296875f, 0.0703125f, 0.8046875f },
+	{ 0x00b0, 8.82885838f, 0.666666627f, 5.0f, 8.00000095f, 12.0f, 0.931640625f, 0.76171875f, 0.974609375f, 0.7890625f },
+	{ 0x00b1, 11.3557043f, 0.666666627f, 8.0f, 10.666667f, 20.0f, 0.84765625f, 0.7109375f, 0.90625f, 0.7578125f },
+	{ 0x00b2, 6.82550287f, 0.0f, 5.0f, 6.66666651f, 15.0f, 0.51953125f, 0.76171875f, 0.55859375f, 0.80078125f },
+	{ 0x00b3, 6.82550287f, -0.333333343f, 5.0f, 6.66666651f, 15.0f, 0.4765625f, 0.76171875f, 0.517578125f, 0.80078125f },
+	{ 0x00b4, 11.8993282f, 3.33333349f, 4.0f, 8.33333397f, 8.0f, 0.158203125f, 0.78515625f, 0.1875f, 0.80078125f },
+	{ 0x00b5, 12.2516775f, 1.33333337f, 8.0f, 11.000001f, 25.0f, 0.912109375f, 0.3203125f, 0.96875f, 0.38671875f },
+	{ 0x00b6, 13.499999f, 0.666666627f, 4.0f, 12.000001f, 23.0f, 0.828125f, 0.171875f, 0.89453125f, 0.24609375f },
+	{ 0x00b7, 5.52684546f, 1.0f, 11.0f, 4.66666651f, 15.0f, 0.9765625f, 0.78125f, 0.998046875f, 0.796875f },
+	{ 0x00b8, 4.22818756f, 0.0f, 20.0f, 4.66666651f, 25.0f, 0.12890625f, 0.765625f, 0.15625f, 0.78515625f },
+	{ 0x00b9, 6.82550287f, 0.0f, 5.0f, 5.0f, 15.0f, 0.966796875f, 0.7109375f, 0.99609375f, 0.75f },
+	{ 0x00ba, 7.21812057f, 0.0f, 5.0f, 7.0f, 13.0f, 0.73046875f, 0.76171875f, 0.771484375f, 0.79296875f },
+	{ 0x00bb, 10.036912f, 0.333333343f, 10.0f, 9.66666698f, 19.0f, 0.6171875f, 0.76171875f, 0.671875f, 0.796875f },
+	{ 0x00bc, 15.1912746f, 0.0f, 5.0f, 14.666667f, 20.0f, 0.35546875f, 0.52734375f, 0.44140625f, 0.5859375f },
+	{ 0x00bd, 15.1912746f, 0.0f, 5.0f, 15.000001f, 20.0f, 0.177734375f, 0.52734375f, 0.265625f, 0.5859375f },
+	{ 0x00be, 15.1912746f, -0.333333343f, 5.0f, 15.333334f, 20.0f, 0.857421875f, 0.5234375f, 0.94921875f, 0.58203125f },
+	{ 0x00bf, 8.77852345f, 0.333333343f, 8.0f, 9.00000095f, 24.0f, 0.529296875f, 0.4609375f, 0.580078125f, 0.5234375f },
+	{ 0x00c0, 12.5335569f, -0.333333343f, 0.0f, 13.000001f, 20.0f, 0.685546875f, 0.08984375f, 0.763671875f, 0.16796875f },
+	{ 0x00c1, 12.5335569f, -0.333333343f, 0.0f, 13.000001f, 20.0f, 0.765625f, 0.08984375f, 0.84375f, 0.16796875f },
+	{ 0x00c2, 12.5335569f, -0.333333343f, 0.0f, 13.000001f, 20.0f, 0.845703125f, 0.08984375f, 0.923828125f, 0.16796875f },
+	{ 0x00c3, 12.5335569f, -0.333333343f, 1.0f, 13.000001f, 20.0f, 0.515625f, 0.171875f, 0.59375f, 0.24609375f },
+	{ 0x00c4, 12.5335569f, -0.333333343f, 1.0f, 13.000001f, 20.0f, 0.595703125f, 0.171875f, 0.673828125f, 0.24609375f },
+	{ 0x00c5, 12.5335569f, -0.333333343f, 1.0f, 13.000001f, 20.0f, 0.67578125f, 0.171875f, 0.75390625f, 0.24609375f },
+	{ 0x00c6, 17.5671139f, -0.666666687f, 5.0f, 16.666666f, 20.0f, 0.75390625f, 0.5234375f, 0.85546875f, 0.58203125f },
+	{ 0x00c7, 12.4328852f, 0.666666627f, 5.0f, 12.333334f, 25.0f, 0.92578125f, 0.08984375f, 0.994140625f, 0.16796875f },
+	{ 0x00c8, 10.8825502f, 1.66666663f, 0.0f, 10.000001f, 20.0f, 0.142578125f, 0.109375f, 0.19140625f, 0.1875f },
+	{ 0x00c9, 10.8825502f, 1.66666663f, 0.0f, 10.000001f, 20.0f, 0.193359375f, 0.109375f, 0.2421875f, 0.1875f },
+	{ 0x00ca, 10.8825502f, 1.66666663f, 0.0f, 10.000001f, 20.0f, 0.244140625f, 0.109375f, 0.29296875f, 0.1875f },
+	{ 0x00cb, 10.8825502f, 1.66666663f, 1.0f, 10.000001f, 20.0f, 0.896484375f, 0.171875f, 0.9453125f, 0.24609375f },
+	{ 0x00cc, 6.98657703f, 0.0f, 0.0f, 6.66666651f, 20.0f, 0.43359375f, 0.171875f, 0.47265625f, 0.25f },
+	{ 0x00cd, 6.98657703f, 0.333333343f, 0.0f, 7.0f, 20.0f, 0.474609375f, 0.171875f, 0.513671875f, 0.25f },
+	{ 0x00ce, 6.98657703f, -0.333333343f, 0.0f, 7.33333349f, 20.0f, 0.294921875f, 0.109375f, 0.33984375f, 0.1875f },
+	{ 0x00cf, 6.98657703f, 0.0f, 1.0f, 7.0f, 20.0f, 0.38671875f, 0.17578125f, 0.427734375f, 0.25f },
+	{ 0x00d0, 14.1040258f, 0.0f, 5.0f, 13.333334f, 20.0f, 0.0703125f, 0.5390625f, 0.1484375f, 0.59765625f },
+	{ 0x00d1, 15.030201f, 1.66666663f, 1.0f, 13.666667f, 20.0f, 0.755859375f, 0.171875f, 0.826171875f, 0.24609375f },
+	{ 0x00d2, 15.3020124f, 0.666666627f, 0.0f, 14.666667f, 21.0f, 0.35546875f, 0.00390625f, 0.4375f, 0.0859375f },
+	{ 0x00d3, 15.3020124f, 0.666666627f, 0.0f, 14.666667f, 21.0f, 0.439453125f, 0.00390625f, 0.521484375f, 0.0859375f },
+	{ 0x00d4, 15.3020124f, 0.666666627f, 0.0f, 14.666667f, 21.0f, 0.5234375f, 0.00390625f, 0.60546875f, 0.0859375f },
+	{ 0x00d5, 15.3020124f, 0.666666627f, 1.0f, 14.666667f, 21.0f, 0.517578125f, 0.08984375f, 0.599609375f, 0.16796875f },
+	{ 0x00d6, 15.3020124f, 0.666666627f, 1.0f, 14.666667f, 21.0f, 0.6015625f, 0.08984375f, 0.68359375f, 0.16796875f },
+	{ 0x00d7, 11.3557043f, 1.0f, 8.0f, 10.333334f, 17.0f, 0.673828125f, 0.76171875f, 0.728515625f, 0.796875f },
+	{ 0x00d8, 15.3020124f, 0.666666627f, 4.0f, 14.666667f, 21.0f, 0.615234375f, 0.25f, 0.697265625f, 0.31640625f },
+	{ 0x00d9, 14.3959723f, 1.33333337f, 0.0f, 13.000001f, 21.0f, 0.607421875f, 0.00390625f, 0.67578125f, 0.0859375f },
+	{ 0x00da, 14.3959723f, 1.33333337f, 0.0f, 13.000001f, 21.0f, 0.677734375f, 0.00390625f, 0.74609375f, 0.0859375f },
+	{ 0x00db, 14.3959723f, 1.33333337f, 0.0f, 13.000001f, 21.0f, 0.748046875f, 0.00390625f, 0.81640625f, 0.0859375f },
+	{ 0x00dc, 14.3959723f, 1.33333337f, 1.0f, 13.000001f, 21.0f, 0.001953125f, 0.109375f, 0.0703125f, 0.1875f },
+	{ 0x00dd, 10.8624153f, -0.333333343f, 0.0f, 11.333334f, 20.0f, 0.072265625f, 0.109375f, 0.140625f, 0.1875f },
+	{ 0x00de, 11.8791943f, 1.66666663f, 5.0f, 11.333334f, 20.0f, 0.736328125f, 0.6484375f, 0.79296875f, 0.70703125f },
+	{ 0x00df, 12.4127512f, 1.33333337f, 4.0f, 12.000001f, 21.0f, 0.828125f, 0.25f, 0.890625f, 0.31640625f },
+	{ 0x00e0, 10.9429522f, 0.333333343f, 4.0f, 9.66666698f, 21.0f, 0.126953125f, 0.3359375f, 0.181640625f, 0.40234375f },
+	{ 0x00e1, 10.9429522f, 0.333333343f, 4.0f, 9.66666698f, 21.0f, 0.18359375f, 0.3359375f, 0.23828125f, 0.40234375f },
+	{ 0x00e2, 10.9429522f, 0.333333343f, 4.0f, 9.66666698f, 21.0f, 0.001953125f, 0.33984375f, 0.056640625f, 0.40625f },
+	{ 0x00e3, 10.9429522f, 0.333333343f, 4.0f, 9.66666698f, 21.0f, 0.05859375f, 0.33984375f, 0.11328125f, 0.40625f },
+	{ 0x00e4, 10.9429522f, 0.333333343f, 4.0f, 9.66666698f, 21.0f, 0.478515625f, 0.390625f, 0.533203125f, 0.45703125f },
+	{ 0x00e5, 10.9429522f, 0.333333343f, 3.0f, 9.66666698f, 21.0f, 0.23828125f, 0.19140625f, 0.29296875f, 0.26171875f },
+	{ 0x00e6, 17.1744957f, 0.333333343f, 8.0f, 16.666666f, 21.0f, 0.337890625f, 0.65234375f, 0.43359375f, 0.703125f },
+	{ 0x00e7, 9.54362392f, 0.666666627f, 8.0f, 9.33333397f, 25.0f, 0.587890625f, 0.390625f, 0.638671875f, 0.45703125f },
+	{ 0x00e8, 11.0335569f, 0.666666627f, 4.0f, 10.333334f, 21.0f, 0.244140625f, 0.32421875f, 0.30078125f, 0.390625f },
+	{ 0x00e9, 11.0335569f, 0.666666627f, 4.0f, 10.333334f, 21.0f, 0.302734375f, 0.32421875f, 0.359375f, 0.390625f },
+	{ 0x00ea, 11.0335569f, 0.666666627f, 4.0f, 10.333334f, 21.0f, 0.361328125f, 0.32421875f, 0.41796875f, 0.390625f },
+	{ 0x00eb, 11.0335569f, 0.666666627f, 4.0f, 10.333334f, 21.0f, 0.419921875f, 0.32421875f, 0.4765625f, 0.390625f },
+	{ 0x00ec, 5.33557034f, -1.0f, 4.0f, 4.0f, 20.0f, 0.115234375f, 0.47265625f, 0.14453125f, 0.53515625f },
+	{ 0x00ed, 5.33557034f, 1.33333337f, 4.0f, 6.33333349f, 20.0f, 0.146484375f, 0.47265625f, 0.17578125f, 0.53515625f },
+	{ 0x00ee, 5.33557034f, -1.33333337f, 4.0f, 6.66666651f, 20.0f, 0.06640625f, 0.41015625f, 0.11328125f, 0.47265625f },
+	{ 0x00ef, 5.33557034f, -0.666666687f, 4.0f, 6.0f, 20.0f, 0.58203125f, 0.4609375f, 0.62109375f, 0.5234375f },
+	{ 0x00f0, 11.8993282f, 0.666666627f, 4.0f, 11.333334f, 21.0f, 0.892578125f, 0.25f, 0.955078125f, 0.31640625f },
+	{ 0x00f1, 12.1409388f, 1.33333337f, 4.0f, 11.000001f, 20.0f, 0.30859375f, 0.4609375f, 0.365234375f, 0.5234375f },
+	{ 0x00f2, 11.8993282f, 0.666666627f, 4.0f, 11.333334f, 21.0f, 0.294921875f, 0.25390625f, 0.357421875f, 0.3203125f },
+	{ 0x00f3, 11.8993282f, 0.666666627f, 4.0f, 11.333334f, 21.0f, 0.359375f, 0.25390625f, 0.421875f, 0.3203125f },
+	{ 0x00f4, 11.8993282f, 0.666666627f, 4.0f, 11.333334f, 21.0f, 0.423828125f, 0.25390625f, 0.486328125f, 0.3203125f },
+	{ 0x00f5, 11.8993282f, 0.666666627f, 4.0f, 11.333334f, 21.0f, 0.1796875f, 0.265625f, 0.2421875f, 0.33203125f },
+	{ 0x00f6, 11.8993282f, 0.666666627f, 4.0f, 11.333334f, 21.0f, 0.001953125f, 0.26953125f, 0.064453125f, 0.3359375f },
+	{ 0x00f7, 11.3557043f, 0.666666627f, 7.0f, 10.666667f, 18.0f, 0.001953125f, 0.72265625f, 0.060546875f, 0.765625f },
+	{ 0x00f8, 11.8993282f, 0.666666627f, 8.0f, 11.333334f, 21.0f, 0.06640625f, 0.6640625f, 0.12890625f, 0.71484375f },
+	{ 0x00f9, 12.1409388f, 1.0f, 4.0f, 11.000001f, 21.0f, 0.669921875f, 0.3203125f, 0.728515625f, 0.38671875f },
+	{ 0x00fa, 12.1409388f, 1.0f, 4.0f, 11.000001f, 21.0f, 0.73046875f, 0.3203125f, 0.7890625f, 0.38671875f },
+	{ 0x00fb, 12.1409388f, 1.0f, 4.0f, 11.000001f, 21.0f, 0.791015625f, 0.3203125f, 0.849609375f, 0.38671875f },
+	{ 0x00fc, 12.1409388f, 1.0f, 4.0f, 11.000001f, 21.0f, 0.8515625f, 0.3203125f, 0.91015625f, 0.38671875f },
+	{ 0x00fd, 10.0771809f, -0.333333343f, 4.0f, 10.333334f, 25.0f, 0.818359375f, 0.00390625f, 0.880859375f, 0.0859375f },
+	{ 0x00fe, 12.0805368f, 1.33333337f, 4.0f, 11.333334f, 25.0f, 0.35546875f, 0.08984375f, 0.4140625f, 0.171875f },
+	{ 0x00ff, 10.0771809f, -0.333333343f, 4.0f, 10.333334f, 25.0f, 0.8828125f, 0.00390625f, 0.9453125f, 0.0859375f },
+};
+
+const unsigned int BakedFontPixelsSize = 57096;
+const unsigned char BakedFontPixels[57096] =
+{
+	0xff, 0xff, 0x00, 0x66, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x05, 0xff, 0x00, 0x10, 0xff, 0x00, 0x0c, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0x00, 0x15, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0x00, 0x4c, 0xff, 0xff, 0x00, 0x0c, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0x00, 0x06, 0xff, 0x00, 0x10, 0xff, 0x00, 0x0d, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x17, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x0f, 0xff, 0x00,
+	0x05, 0xff, 0x00, 0x04, 0xff, 0x00, 0x01, 0xff, 0x00, 0x0e, 0xff, 0x00, 0x01, 0xff, 0x00, 0x0b, 0xff, 0x00, 0x05, 0xff, 0x00, 0x15, 0xff, 0x00,
+	0x05, 0xff, 0x00, 0x0c, 0x0a, 0x1a, 0x2b, 0x32, 0x32, 0x32, 0x32, 0x24, 0x13, 0x02, 0x00, 0x2b, 0x04, 0x14, 0x25, 0x32, 0x32, 0x32, 0x32, 0x2a,
+	0x19, 0x09, 0x00, 0x1d, 0x10, 0x21, 0x31, 0x32, 0x32, 0x32, 0x24, 0x13, 0x02, 0x00, 0x19, 0x05, 0x15, 0x26, 0x32, 0x32, 0x32, 0x32, 0x29, 0x18,
+	0x08, 0x00, 0x23, 0x01, 0x12, 0x22, 0x32, 0x32, 0x32, 0x32, 0x2d, 0x1c, 0x0b, 0x00, 0x16, 0x0a, 0x1b, 0x2b, 0x32, 0x32, 0x32, 0x2a, 0x1a, 0x09,
+	0x00, 0x1e, 0x0b, 0x46, 0x8a, 0xc2, 0xcb, 0xcb, 0xca, 0xb3, 0x73, 0x30, 0x03, 0x00, 0x0f, 0x03, 0x03, 0x03, 0x00, 0x08, 0x01, 0x05, 0x05, 0x04,
+	0x00, 0x12, 0x01, 0x0c, 0x1a, 0x1f, 0x14, 0x06, 0x00, 0x03, 0x0d, 0x45, 0x7d, 0xa9, 0xa9, 0x81, 0x49, 0x11, 0x00, 0x11, 0xff, 0x00, 0x07, 0xff,
+	0xff, 0xff, 0x00, 0x0e, 0xff, 0xff, 0xff, 0x00, 0x0c, 0xff, 0xff, 0xff, 0xff, 0x00, 0x19, 0xff, 0xff, 0xff, 0xff, 0x00, 0x0f, 0xff, 0xff, 0xff,
+	0x00, 0x01, 0xff, 0xff, 0xff, 0x00, 0x03, 0xff, 0x00, 0x03, 0xff, 0x00, 0x0c, 0xff, 0x00, 0x03, 0xff, 0x00, 0x0a, 0xff, 0x00, 0x04, 0xff, 0x00,
+	0x17, 0xff, 0x00, 0x04, 0xff, 0x00, 0x0c, 0x08, 0x36, 0x85, 0xd2, 0xf9, 0xff, 0xff, 0xf1, 0xb0, 0x5b, 0x13, 0x00, 0x29, 0x16, 0x60, 0xb5, 0xf4,
+	0xff, 0xff, 0xf7, 0xcc, 0x7e, 0x30, 0x06, 0x00, 0x1a, 0x01, 0x1c, 0x62, 0xb6, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xbf, 0x6c, 0x22, 0x02, 0x00,
+	0x17, 0x02, 0x23, 0x6b, 0xbe, 0xf1, 0xff, 0xff, 0xfa, 0xc9, 0x75, 0x24, 0x01, 0x00, 0x20, 0x0f, 0x53, 0xa8, 0xed, 0xff, 0xff, 0xfa, 0xd6, 0x8b,
+	0x3b, 0x0a, 0x00, 0x14, 0x0d, 0x41, 0x95, 0xdd, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xd9, 0x8f, 0x3b, 0x0a, 0x00, 0x1a, 0x02, 0x2b, 0x7d, 0xcf, 0xfb,
+	0xff, 0xfa, 0xd6, 0x91, 0x41, 0x0f, 0x00, 0x0e, 0x01, 0x32, 0x80, 0xd4, 0xf5, 0xf0, 0xb1, 0x5e, 0x15, 0x00, 0x03, 0x1b, 0x66, 0xb9, 0xf3, 0xf8,
+	0xd7, 0x82, 0x32, 0x00, 0x0e, 0x01, 0x39, 0x8d, 0xe1, 0xfe, 0xff, 0xee, 0x9f, 0x4a, 0x06, 0x00, 0x01, 0x13, 0x68, 0xbd, 0xff, 0xff, 0xc3, 0x6e,
+	0x19, 0x00, 0x11, 0xff, 0x00, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x0c, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x0b, 0xff, 0xff, 0xff, 0x00,
+	0x1b, 0xff, 0xff, 0xff, 0x00, 0x02, 0xff, 0x00, 0x0e, 0xff, 0x00, 0x01, 0xff, 0x00, 0x04, 0xff, 0x00, 0x05, 0xff, 0x00, 0x0a, 0xff, 0x00, 0x05,
+	0xff, 0x00, 0x09, 0xff, 0x00, 0x03, 0xff, 0x00, 0x19, 0xff, 0x00, 0x03, 0xff, 0x00, 0x0e, 0x03, 0x22, 0x61, 0xb3, 0xe8, 0xfe, 0xfe, 0xdf, 0x93,
+	0x3f, 0x09, 0x00, 0x25, 0x0b, 0x44, 0x99, 0xe2, 0xff, 0xfd, 0xe5, 0xac, 0x5a, 0x1d, 0x01, 0x00, 0x1a, 0x09, 0x31, 0x7c, 0xc8, 0xf4, 0xfd, 0xe7,
+	0xb6, 0x82, 0x7e, 0xad, 0xe3, 0xfc, 0xf7, 0xcf, 0x86, 0x39, 0x0c, 0x00, 0x18, 0x15, 0x4b, 0x9c, 0xdc, 0xfb, 0xff, 0xee, 0xad, 0x58, 0x14, 0x00,
+	0x1d, 0x06, 0x37, 0x8b, 0xd9, 0xfd, 0xfe, 0xeb, 0xb7, 0x66, 0x25, 0x04, 0x00, 0x13, 0x02, 0x1d, 0x5b, 0xad, 0xe7, 0xfe, 0xf4, 0xcd, 0x93, 0x79,
+	0x96, 0xd1, 0xf5, 0xfe, 0xe3, 0xa7, 0x55, 0x1a, 0x01, 0x00, 0x15, 0x01, 0x20, 0x6b, 0xbf, 0xf4, 0xfd, 0xe4, 0xac, 0x5c, 0x20, 0x03, 0x00, 0x11,
+	0x2a, 0x71, 0xc2, 0xe5, 0xdf, 0x9f, 0x52, 0x11, 0x00, 0x03, 0x15, 0x59, 0xa7, 0xe2, 0xe4, 0xb8, 0x68, 0x22, 0x00, 0x0f, 0x31, 0x80, 0xd4, 0xf8,
+	0xf9, 0xd8, 0x85, 0x36, 0x01, 0x00, 0x01, 0x13, 0x68, 0xbd, 0xff, 0xff, 0xc3, 0x6e, 0x19, 0x00, 0x11, 0xff, 0x00, 0x05, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0x00, 0x0a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x0a, 0xff, 0xff, 0x00, 0x01, 0xff, 0x00, 0x19, 0xff, 0x00, 0x01,
+	0xff, 0xff, 0x00, 0x02, 0xff, 0xff, 0x00, 0x0d, 0xff, 0x00, 0x01, 0xff, 0x00, 0x03, 0xff, 0x00, 0x07, 0xff, 0x00, 0x08, 0xff, 0x00, 0x07, 0xff,
+	0x00, 0x08, 0xff, 0x00, 0x02, 0xff, 0x00, 0x01, 0xff, 0x00, 0x17, 0xff, 0x00, 0x01, 0xff, 0x00, 0x02, 0xff, 0x00, 0x11, 0x09, 0x2f, 0x70, 0xba,
+	0xe9, 0xfa, 0xd5, 0x86, 0x34, 0x05, 0x00, 0x21, 0x07, 0x39, 0x8b, 0xd9, 0xfb, 0xe7, 0xb6, 0x6b, 0x2c, 0x07, 0x00, 0x1b, 0x1c, 0x58, 0xac, 0xe5,
+	0xf5, 0xd6, 0xa1, 0x5b, 0x26, 0x06, 0x00, 0x02, 0x04, 0x21, 0x53, 0x98, 0xd0, 0xf2, 0xea, 0xb7, 0x64, 0x23, 0x01, 0x00, 0x17, 0x03, 0x21, 0x59,
+	0xa6, 0xdd, 0xfa, 0xe6, 0xa0, 0x4b, 0x0f, 0x00, 0x19, 0x03, 0x2e, 0x7e, 0xd0, 0xf9, 0xec, 0xc0, 0x77, 0x34, 0x0b, 0x00, 0x14, 0x0c, 0x3c, 0x8a,
+	0xd2, 0xf5, 0xe6, 0xb9, 0x77, 0x38, 0x10, 0x00, 0x03, 0x13, 0x3d, 0x7c, 0xbc, 0xe7, 0xf4, 0xcf, 0x85, 0x39, 0x0b, 0x00, 0x13, 0x19, 0x44, 0x6f,
+	0x81, 0x72, 0x4c, 0x21, 0x04, 0x00, 0x38, 0x04, 0x09, 0x09, 0x04, 0x00, 0x04, 0x13, 0x68, 0xbd, 0xff, 0xff, 0xc3, 0x6e, 0x19, 0x00, 0x02, 0xff,
+	0x00, 0x0e, 0xff, 0x00, 0x08, 0xff, 0x00, 0x10, 0xff, 0x00, 0x0d, 0xff, 0x00, 0x03, 0xff, 0x00, 0x17, 0xff, 0x00, 0x03, 0xff, 0x00, 0x02, 0xff,
+	0x00, 0x01, 0xff, 0x00, 0x0c, 0xff, 0x00, 0x01, 0xff, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0x00, 0x08, 0xff,
+	0xff, 0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0x00, 0x08, 0xff, 0x00, 0x01, 0xff, 0x00, 0x01, 0xff, 0x00, 0x01, 0xff, 0x00, 0x15, 0xff,
+	0x00, 0x01, 0xff, 0x00, 0x01, 0xff, 0x00, 0x01, 0xff, 0x00, 0x14, 0x04, 0x0d, 0x16, 0x1b, 0x14, 0x0b, 0x02, 0x00, 0x21, 0x03, 0x0c, 0x15, 0x1b,
+	0x16, 0x0d, 0x04, 0x00, 0x1e, 0x08, 0x11, 0x1a, 0x1a, 0x11, 0x08, 0x00, 0x0a, 0x06, 0x0f, 0x18, 0x1b, 0x13, 0x0a, 0x01, 0x00, 0x1a, 0x02, 0x0b,
+	0x14, 0x1b, 0x17, 0x0e, 0x05, 0x00, 0x19, 0x01, 0x0a, 0x13, 0x1b, 0x17, 0x0e, 0x05, 0x00, 0x17, 0x05, 0x0e, 0x17, 0x1b, 0x14, 0x0b, 0x02, 0x00,
+	0x09, 0x03, 0x0c, 0x15, 0x1b, 0x16, 0x0d, 0x04, 0x00, 0x07, 0x03, 0x07, 0x0c, 0x0e, 0x0e, 0x0e, 0x09, 0x05, 0x00, 0x10, 0x03, 0x08, 0x0d, 0x0e,
+	0x0e, 0x0d, 0x08, 0x04, 0x00, 0x01, 0x03, 0x07, 0x0c, 0x0e, 0x0e, 0x0e, 0x09, 0x05, 0x00, 0x10, 0x03, 0x08, 0x0d, 0x0e, 0x0e, 0x0d, 0x08, 0x04,
+	0x00, 0x09, 0x03, 0x08, 0x0c, 0x0e, 0x0e, 0x0c, 0x08, 0x03, 0x00, 0x02, 0x13, 0x68, 0xbd, 0xff, 0xff, 0xc3, 0x6e, 0x19, 0x00, 0x02, 0xff, 0xff,
+	0x00, 0x0d, 0xff, 0x00, 0x08, 0xff, 0x00, 0x10, 0xff, 0x00, 0x12, 0xff, 0x00, 0x15, 0xff, 0x00, 0x07, 0xff, 0x00, 0x02, 0xff, 0x00, 0x0b, 0xff,
+	0x00, 0x01, 0xff, 0x00, 0x06, 0xff, 0x00, 0x01, 0xff, 0x00, 0x0e, 0xff, 0x00, 0x01, 0xff, 0x00, 0x0b, 0xff, 0xff, 0x00, 0x03, 0xff, 0x00, 0x01,
+	0xff, 0x00, 0x13, 0xff, 0x00, 0x01, 0xff, 0x00, 0x03, 0xff, 0xff, 0x00, 0x0b, 0x0e, 0x2f, 0x56, 0x76, 0x88, 0x99, 0xa9, 0xb9, 0xc9, 0xd9, 0xe4,
+	0xe4, 0xd9, 0xc8, 0xb7, 0xa6, 0x95, 0x85, 0x6f, 0x4a, 0x23, 0x07, 0x00, 0x15, 0x0e, 0x2f, 0x56, 0x76, 0x88, 0x99, 0xa9, 0xb9, 0xc9, 0xd9, 0xe4,
+	0xe4, 0xd9, 0xc8, 0xb7, 0xa6, 0x95, 0x85, 0x6f, 0x4a, 0x23, 0x07, 0x00, 0x15, 0x0e, 0x2f, 0x56, 0x76, 0x88, 0x99, 0xa9, 0xb9, 0xc9, 0xd9, 0xe4,
+	0xe4, 0xd9, 0xc8, 0xb7, 0xa6, 0x95, 0x85, 0x6f, 0x4a, 0x23, 0x07, 0x00, 0x0b, 0x1b, 0x58, 0x95, 0xb7, 0xb7, 0xb7, 0x86, 0x49, 0x0c, 0x00, 0x11,
+	0x01, 0x3f, 0x7e, 0xbc, 0xbc, 0xbc, 0xa3, 0x64, 0x25, 0x00, 0x01, 0x1b, 0x58, 0x95, 0xb7, 0xb7, 0xb7, 0x86, 0x49, 0x0c, 0x00, 0x11, 0x01, 0x3f,
+	0x7e, 0xbc, 0xbc, 0xbc, 0xa3, 0x64, 0x25, 0x00, 0x01, 0x1b, 0x58, 0x95, 0xb7, 0xb7, 0xb7, 0x86, 0x49, 0x0c, 0x00, 0x11, 0x01, 0x3f, 0x7e, 0xbc,
+	0xbc, 0xbc, 0xa3, 0x64, 0x25, 0x00, 0x01, 0x0f, 0x5b, 0xb0, 0xf6, 0xff, 0xff, 0xdb, 0x87, 0x32, 0x00, 0x0e, 0x1a, 0x6d, 0xc2, 0xfd, 0xff, 0xfd,
+	0xc7, 0x72, 0x1f, 0x00, 0x01, 0x0f, 0x5b, 0xb0, 0xf6, 0xff, 0xff, 0xdb, 0x87, 0x32, 0x00, 0x0e, 0x1a, 0x6d, 0xc2, 0xfd, 0xff, 0xfd, 0xc7, 0x72,
+	0x1f, 0x00, 0x09, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x02, 0x13, 0x68, 0xbd, 0xff, 0xff, 0xc3, 0x6e, 0x19, 0x00, 0x02, 0xff,
+	0xff, 0xff, 0x00, 0x0c, 0xff, 0x00, 0x08, 0xff, 0x00, 0x10, 0xff, 0x00, 0x13, 0xff, 0x00, 0x13, 0xff, 0x00, 0x08, 0xff, 0x00, 0x03, 0xff, 0x00,
+	0x0a, 0xff, 0x00, 0x01, 0xff, 0x00, 0x06, 0xff, 0x00, 0x01, 0xff, 0x00, 0x08, 0xff, 0xff, 0x00, 0x04, 0xff, 0x00, 0x01, 0xff, 0x00, 0x04, 0xff,
+	0xff, 0x00, 0x0b, 0xff, 0x00, 0x01, 0xff, 0x00, 0x11, 0xff, 0x00, 0x01, 0xff, 0x00, 0x0d, 0x0c, 0x2f, 0x66, 0xa7, 0xd9, 0xf7, 0xff, 0xff, 0xff,
+	0xfe, 0xfa, 0xef, 0xdf, 0xcd, 0xc1, 0xc1, 0xcd, 0xdf, 0xef, 0xfa, 0xfe, 0xff, 0xff, 0xfe, 0xef, 0xcb, 0x91, 0x50, 0x20, 0x05, 0x00, 0x0d, 0x0c,
+	0x2f, 0x66, 0xa7, 0xd9, 0xf7, 0xff, 0xff, 0xff, 0xfe, 0xfa, 0xef, 0xdf, 0xcd, 0xc1, 0xc1, 0xcd, 0xdf, 0xef, 0xfa, 0xfe, 0xff, 0xff, 0xfe, 0xef,
+	0xcb, 0x91, 0x50, 0x20, 0x05, 0x00, 0x0d, 0x0c, 0x2f, 0x66, 0xa7, 0xd9, 0xf7, 0xff, 0xff, 0xff, 0xfe, 0xfa, 0xef, 0xdf, 0xcd, 0xc1, 0xc1, 0xcd,
+	0xdf, 0xef, 0xfa, 0xfe, 0xff, 0xff, 0xfe, 0xef, 0xcb, 0x91, 0x50, 0x20, 0x05, 0x00, 0x07, 0x25, 0x7a, 0xcf, 0xff, 0xff, 0xff, 0xbb, 0x66, 0x11,
+	0x00, 0x11, 0x01, 0x56, 0xab, 0xff, 0xff, 0xff, 0xdd, 0x88, 0x33, 0x00, 0x01, 0x25, 0x7a, 0xcf, 0xff, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x11,
+	0x01, 0x56, 0xab, 0xff, 0xff, 0xff, 0xdd, 0x88, 0x33, 0x00, 0x01, 0x25, 0x7a, 0xcf, 0xff, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x11, 0x01, 0x56,
+	0xab, 0xff, 0xff, 0xff, 0xdd, 0x88, 0x33, 0x00, 0x02, 0x0a, 0x50, 0xa5, 0xf0, 0xff, 0xff, 0xdf, 0x8c, 0x37, 0x01, 0x00, 0x0b, 0x18, 0x6b, 0xc0,
+	0xfd, 0xff, 0xfd, 0xc3, 0x6e, 0x1b, 0x00, 0x03, 0x0a, 0x50, 0xa5, 0xf0, 0xff, 0xff, 0xdf, 0x8c, 0x37, 0x01, 0x00, 0x0b, 0x18, 0x6b, 0xc0, 0xfd,
+	0xff, 0xfd, 0xc3, 0x6e, 0x1b, 0x00, 0x0a, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x02, 0x13, 0x68, 0xbd, 0xff, 0xff, 0xc3, 0x6e,
+	0x19, 0x00, 0x02, 0xff, 0xff, 0xff, 0xff, 0x00, 0x0b, 0xff, 0x00, 0x08, 0xff, 0x00, 0x09, 0xff, 0x00, 0x06, 0xff, 0x00, 0x06, 0xff, 0x00, 0x0d,
+	0xff, 0x00, 0x11, 0xff, 0x00, 0x09, 0xff, 0x00, 0x04, 0xff, 0x00, 0x09, 0xff, 0x00, 0x01, 0xff, 0x00, 0x06, 0xff, 0x00, 0x01, 0xff, 0x00, 0x07,
+	0xff, 0x00, 0x01, 0xff, 0x00, 0x04, 0xff, 0x00, 0x01, 0xff, 0x00, 0x04, 0xff, 0x00, 0x01, 0xff, 0x00, 0x0b, 0xff, 0x00, 0x01, 0xff, 0x00, 0x0f,
+	0xff, 0x00, 0x01, 0xff, 0x00, 0x0c, 0x15, 0x5d, 0xb2, 0xf2, 0xff, 0xff, 0xff, 0xf1, 0xcb, 0x8e, 0x4d, 0x1f, 0x08, 0x01, 0x00, 0x06, 0x01, 0x08,
+	0x20, 0x4f, 0x90, 0xcd, 0xf2, 0xff, 0xff, 0xfe, 0xe2, 0x95, 0x41, 0x08, 0x00, 0x09, 0x15, 0x5d, 0xb2, 0xf2, 0xff, 0xff, 0xff, 0xf1, 0xcb, 0x8e,
+	0x4d, 0x1f, 0x08, 0x01, 0x00, 0x06, 0x01, 0x08, 0x20, 0x4f, 0x90, 0xcd, 0xf2, 0xff, 0xff, 0xfe, 0xe2, 0x95, 0x41, 0x08, 0x00, 0x09, 0x15, 0x5d,
+	0xb2, 0xf2, 0xff, 0xff, 0xff, 0xf1, 0xcb, 0x8e, 0x4d, 0x1f, 0x08, 0x01, 0x00, 0x06, 0x01, 0x08, 0x20, 0x4f, 0x90, 0xcd, 0xf2, 0xff, 0xff, 0xfe,
+	0xe2, 0x95, 0x41, 0x08, 0x00, 0x05, 0x25, 0x7a, 0xcf, 0xff, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x11, 0x01, 0x56, 0xab, 0xff, 0xff, 0xff, 0xdd,
+	0x88, 0x33, 0x00, 0x01, 0x25, 0x7a, 0xcf, 0xff, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x11, 0x01, 0x56, 0xab, 0xff, 0xff, 0xff, 0xdd, 0x88, 0x33,
+	0x00, 0x01, 0x25, 0x7a, 0xcf, 0xff, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x11, 0x01, 0x56, 0xab, 0xff, 0xff, 0xff, 0xdd, 0x88, 0x33, 0x00, 0x03,
+	0x05, 0x46, 0x9b, 0xea, 0xff, 0xff, 0xe3, 0x90, 0x3b, 0x02, 0x00, 0x09, 0x17, 0x69, 0xbe, 0xfc, 0xff, 0xfc, 0xbf, 0x6a, 0x18, 0x00, 0x05, 0x05,
+	0x46, 0x9b, 0xea, 0xff, 0xff, 0xe3, 0x90, 0x3b, 0x02, 0x00, 0x09, 0x17, 0x69, 0xbe, 0xfc, 0xff, 0xfc, 0xbf, 0x6a, 0x18, 0x00, 0x0b, 0x3f, 0x94,
+	0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x02, 0x13, 0x68, 0xbd, 0xff, 0xff, 0xc3, 0x6e, 0x19, 0x00, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
+	0x0a, 0xff, 0x00, 0x08, 0xff, 0x00, 0x08, 0xff, 0xff, 0x00, 0x06, 0xff, 0x00, 0x06, 0xff, 0xff, 0x00, 0x0d, 0xff, 0x00, 0x0f, 0xff, 0x00, 0x0a,
+	0xff, 0x00, 0x05, 0xff, 0x00, 0x08, 0xff, 0x00, 0x01, 0xff, 0x00, 0x06, 0xff, 0x00, 0x01, 0xff, 0x00, 0x06, 0xff, 0x00, 0x02, 0xff, 0x00, 0x04,
+	0xff, 0x00, 0x01, 0xff, 0x00, 0x04, 0xff, 0x00, 0x02, 0xff, 0x00, 0x0b, 0xff, 0x00, 0x01, 0xff, 0x00, 0x0d, 0xff, 0x00, 0x01, 0xff, 0x00, 0x0b,
+	0x03, 0x33, 0x87, 0xd9, 0xfe, 0xff, 0xff, 0xde, 0x93, 0x3e, 0x0a, 0x00, 0x10, 0x0b, 0x44, 0x99, 0xe2, 0xff, 0xff, 0xf9, 0xc3, 0x6e, 0x1f, 0x00,
+	0x06, 0x03, 0x33, 0x87, 0xd9, 0xfe, 0xff, 0xff, 0xde, 0x93, 0x3e, 0x0a, 0x00, 0x10, 0x0b, 0x44, 0x99, 0xe2, 0xff, 0xff, 0xf9, 0xc3, 0x6e, 0x1f,
+	0x00, 0x06, 0x03, 0x33, 0x87, 0xd9, 0xfe, 0xff, 0xff, 0xde, 0x93, 0x3e, 0x0a, 0x00, 0x10, 0x0b, 0x44, 0x99, 0xe2, 0xff, 0xff, 0xf9, 0xc3, 0x6e,
+	0x1f, 0x00, 0x04, 0x25, 0x7a, 0xcf, 0xff, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x11, 0x01, 0x56, 0xab, 0xff, 0xff, 0xff, 0xdd, 0x88, 0x33, 0x00,
+	0x01, 0x25, 0x7a, 0xcf, 0xff, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x11, 0x01, 0x56, 0xab, 0xff, 0xff, 0xff, 0xdd, 0x88, 0x33, 0x00, 0x01, 0x25,
+	0x7a, 0xcf, 0xff, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x11, 0x01, 0x56, 0xab, 0xff, 0xff, 0xff, 0xdd, 0x88, 0x33, 0x00, 0x04, 0x02, 0x3b, 0x90,
+	0xe2, 0xff, 0xff, 0xe6, 0x94, 0x3f, 0x03, 0x00, 0x07, 0x16, 0x68, 0xbd, 0xfc, 0xff, 0xfa, 0xbb, 0x66, 0x15, 0x00, 0x07, 0x02, 0x3b, 0x90, 0xe2,
+	0xff, 0xff, 0xe6, 0x94, 0x3f, 0x03, 0x00, 0x07, 0x16, 0x68, 0xbd, 0xfc, 0xff, 0xfa, 0xbb, 0x66, 0x15, 0x00, 0x0c, 0x3f, 0x94, 0xe9, 0xff, 0xff,
+	0xea, 0x95, 0x40, 0x00, 0x02, 0x13, 0x68, 0xbd, 0xff, 0xff, 0xc3, 0x6e, 0x19, 0x00, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x09, 0xff,
+	0x00, 0x08, 0xff, 0x00, 0x07, 0xff, 0xff, 0xff, 0x00, 0x06, 0xff, 0x00, 0x06, 0xff, 0xff, 0xff, 0x00, 0x0d, 0xff, 0x00, 0x0d, 0xff, 0x00, 0x0b,
+	0xff, 0x00, 0x06, 0xff, 0x00, 0x07, 0xff, 0x00, 0x01, 0xff, 0x00, 0x06, 0xff, 0x00, 0x01, 0xff, 0x00, 0x05, 0xff, 0x00, 0x03, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x03, 0xff, 0x00, 0x0b, 0xff, 0x00, 0x01, 0xff, 0x00, 0x03, 0xff, 0xff,
+	0x00, 0x01, 0xff, 0xff, 0x00, 0x03, 0xff, 0x00, 0x01, 0xff, 0x00, 0x0b, 0x07, 0x4f, 0xa4, 0xf2, 0xff, 0xff, 0xfb, 0xc6, 0x71, 0x20, 0x00, 0x14,
+	0x27, 0x7a, 0xcf, 0xfd, 0xff, 0xff, 0xe4, 0x8f, 0x3a, 0x00, 0x04, 0x07, 0x4f, 0xa4, 0xf2, 0xff, 0xff, 0xfb, 0xc6, 0x71, 0x20, 0x00, 0x14, 0x27,
+	0x7a, 0xcf, 0xfd, 0xff, 0xff, 0xe4, 0x8f, 0x3a, 0x00, 0x04, 0x07, 0x4f, 0xa4, 0xf2, 0xff, 0xff, 0xfb, 0xc6, 0x71, 0x20, 0x00, 0x14, 0x27, 0x7a,
+	0xcf, 0xfd, 0xff, 0xff, 0xe4, 0x8f, 0x3a, 0x00, 0x03, 0x25, 0x7a, 0xcf, 0xff, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x11, 0x01, 0x56, 0xab, 0xff,
+	0xff, 0xff, 0xdd, 0x88, 0x33, 0x00, 0x01, 0x25, 0x7a, 0xcf, 0xff, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x11, 0x01, 0x56, 0xab, 0xff, 0xff, 0xff,
+	0xdd, 0x88, 0x33, 0x00, 0x01, 0x25, 0x7a, 0xcf, 0xff, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x11, 0x01, 0x56, 0xab, 0xff, 0xff, 0xff, 0xdd, 0x88,
+	0x33, 0x00, 0x06, 0x30, 0x85, 0xd9, 0xff, 0xff, 0xe9, 0x99, 0x44, 0x04, 0x00, 0x05, 0x14, 0x65, 0xba, 0xfb, 0xff, 0xf9, 0xb7, 0x62, 0x12, 0x00,
+	0x0a, 0x30, 0x85, 0xd9, 0xff, 0xff, 0xe9, 0x99, 0x44, 0x04, 0x00, 0x05, 0x14, 0x65, 0xba, 0xfb, 0xff, 0xf9, 0xb7, 0x62, 0x12, 0x00, 0x0d, 0x3f,
+	0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x02, 0x13, 0x68, 0xbd, 0xff, 0xff, 0xc3, 0x6e, 0x19, 0x00, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0x00, 0x08, 0xff, 0x00, 0x08, 0xff, 0x00, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x0d, 0xff, 0x00, 0x03, 0xff, 0x00, 0x03, 0xff, 0x00, 0x03, 0xff, 0x00, 0x0c, 0xff, 0x00, 0x07,
+	0xff, 0x00, 0x06, 0xff, 0x00, 0x01, 0xff, 0x00, 0x06, 0xff, 0x00, 0x01, 0xff, 0x00, 0x04, 0xff, 0x00, 0x15, 0xff, 0x00, 0x0b, 0xff, 0x00, 0x01,
+	0xff, 0x00, 0x01, 0xff, 0x00, 0x01, 0xff, 0x00, 0x01, 0xff, 0x00, 0x01, 0xff, 0x00, 0x01, 0xff, 0x00, 0x01, 0xff, 0x00, 0x0c, 0x26, 0x7b, 0xd0,
+	0xff, 0xff, 0xff, 0xcc, 0x77, 0x22, 0x00, 0x16, 0x2d, 0x82, 0xd7, 0xff, 0xff, 0xff, 0xbd, 0x68, 0x13, 0x00, 0x03, 0x26, 0x7b, 0xd0, 0xff, 0xff,
+	0xff, 0xcc, 0x77, 0x22, 0x00, 0x16, 0x2d, 0x82, 0xd7, 0xff, 0xff, 0xff, 0xbd, 0x68, 0x13, 0x00, 0x03, 0x26, 0x7b, 0xd0, 0xff, 0xff, 0xff, 0xcc,
+	0x77, 0x22, 0x00, 0x16, 0x2d, 0x82, 0xd7, 0xff, 0xff, 0xff, 0xbd, 0x68, 0x13, 0x00, 0x02, 0x25, 0x7a, 0xcf, 0xff, 0xff, 0xff, 0xbb, 0x66, 0x11,
+	0x00, 0x11, 0x01, 0x56, 0xab, 0xff, 0xff, 0xff, 0xdd, 0x88, 0x33, 0x00, 0x01, 0x25, 0x7a, 0xcf, 0xff, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x11,
+	0x01, 0x56, 0xab, 0xff, 0xff, 0xff, 0xdd, 0x88, 0x33, 0x00, 0x01, 0x25, 0x7a, 0xcf, 0xff, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x11, 0x01, 0x56,
+	0xab, 0xff, 0xff, 0xff, 0xdd, 0x88, 0x33, 0x00, 0x07, 0x26, 0x7a, 0xcf, 0xfe, 0xff, 0xec, 0x9d, 0x48, 0x05, 0x00, 0x03, 0x13, 0x63, 0xb8, 0xfa,
+	0xff, 0xf7, 0xb2, 0x5d, 0x10, 0x00, 0x0c, 0x26, 0x7a, 0xcf, 0xfe, 0xff, 0xec, 0x9d, 0x48, 0x05, 0x00, 0x03, 0x13, 0x63, 0xb8, 0xfa, 0xff, 0xf7,
+	0xb2, 0x5d, 0x10, 0x00, 0x0e, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x02, 0x13, 0x68, 0xbd, 0xff, 0xff, 0xc3, 0x6e, 0x19, 0x00,
+	0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x07, 0xff, 0x00, 0x08, 0xff, 0x00, 0x07, 0xff, 0xff, 0xff, 0x00, 0x06, 0xff, 0x00,
+	0x06, 0xff, 0xff, 0xff, 0x00, 0x0f, 0xff, 0x00, 0x01, 0xff, 0xff, 0x00, 0x03, 0xff, 0xff, 0x00, 0x01, 0xff, 0x00, 0x0d, 0xff, 0x00, 0x08, 0xff,
+	0x00, 0x05, 0xff, 0x00, 0x01, 0xff, 0x00, 0x06, 0xff, 0x00, 0x01, 0xff, 0x00, 0x05, 0xff, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
+	0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x03, 0xff, 0x00, 0x0d, 0xff, 0x00, 0x01, 0xff, 0x00, 0x02, 0xff, 0x00, 0x01, 0xff, 0x00, 0x02,
+	0xff, 0x00, 0x01, 0xff, 0x00, 0x0d, 0x45, 0x9a, 0xef, 0xff, 0xff, 0xfe, 0xb0, 0x5b, 0x07, 0x00, 0x16, 0x12, 0x67, 0xbc, 0xff, 0xff, 0xff, 0xdf,
+	0x8a, 0x35, 0x00, 0x03, 0x45, 0x9a, 0xef, 0xff, 0xff, 0xfe, 0xb0, 0x5b, 0x07, 0x00, 0x16, 0x12, 0x67, 0xbc, 0xff, 0xff, 0xff, 0xdf, 0x8a, 0x35,
+	0x00, 0x03, 0x45, 0x9a, 0xef, 0xff, 0xff, 0xfe, 0xb0, 0x5b, 0x07, 0x00, 0x16, 0x12, 0x67, 0xbc, 0xff, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x02,
+	0x25, 0x7a, 0xcf, 0xff, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x11, 0x01, 0x56, 0xab, 0xff, 0xff, 0xff, 0xdd, 0x88, 0x33, 0x00, 0x01, 0x25, 0x7a,
+	0xcf, 0xff, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x11, 0x01, 0x56, 0xab, 0xff, 0xff, 0xff, 0xdd, 0x88, 0x33, 0x00, 0x01, 0x25, 0x7a, 0xcf, 0xff,
+	0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x11, 0x01, 0x56, 0xab, 0xff, 0xff, 0xff, 0xdd, 0x88, 0x33, 0x00, 0x08, 0x1d, 0x70, 0xc5, 0xfc, 0xff, 0xef,
+	0xa0, 0x4b, 0x06, 0x00, 0x01, 0x11, 0x61, 0xb6, 0xfa, 0xff, 0xf6, 0xae, 0x59, 0x0d, 0x00, 0x0e, 0x1d, 0x70, 0xc5, 0xfc, 0xff, 0xef, 0xa0, 0x4b,
+	0x06, 0x00, 0x01, 0x11, 0x61, 0xb6, 0xfa, 0xff, 0xf6, 0xae, 0x59, 0x0d, 0x00, 0x0f, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x02,
+	0x13, 0x68, 0xbd, 0xff, 0xff, 0xc3, 0x6e, 0x19, 0x00, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x06, 0xff, 0x00, 0x08,
+	0xff, 0x00, 0x08, 0xff, 0xff, 0x00, 0x06, 0xff, 0x00, 0x06, 0xff, 0xff, 0x00, 0x11, 0xff, 0xff, 0xff, 0x00, 0x03, 0xff, 0xff, 0xff, 0x00, 0x0e,
+	0xff, 0x00, 0x09, 0xff, 0x00, 0x02, 0xff, 0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0xff, 0x00, 0x04, 0xff, 0x00, 0x01, 0xff, 0x00, 0x06, 0xff, 0x00,
+	0x02, 0xff, 0x00, 0x04, 0xff, 0x00, 0x01, 0xff, 0x00, 0x04, 0xff, 0x00, 0x02, 0xff, 0x00, 0x0f, 0xff, 0x00, 0x03, 0xff, 0x00, 0x01, 0xff, 0x00,
+	0x03, 0xff, 0x00, 0x0d, 0x0b, 0x60, 0xb5, 0xff, 0xff, 0xff, 0xee, 0x99, 0x44, 0x00, 0x18, 0x51, 0xa6, 0xfb, 0xff, 0xff, 0xfb, 0xa7, 0x52, 0x01,
+	0x00, 0x01, 0x0b, 0x60, 0xb5, 0xff, 0xff, 0xff, 0xee, 0x99, 0x44, 0x00, 0x18, 0x51, 0xa6, 0xfb, 0xff, 0xff, 0xfb, 0xa7, 0x52, 0x01, 0x00, 0x01,
+	0x0b, 0x60, 0xb5, 0xff, 0xff, 0xff, 0xee, 0x99, 0x44, 0x00, 0x18, 0x51, 0xa6, 0xfb, 0xff, 0xff, 0xfb, 0xa7, 0x52, 0x01, 0x00, 0x01, 0x25, 0x7a,
+	0xcf, 0xff, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x11, 0x01, 0x56, 0xab, 0xff, 0xff, 0xff, 0xdd, 0x88, 0x33, 0x00, 0x01, 0x25, 0x7a, 0xcf, 0xff,
+	0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x11, 0x01, 0x56, 0xab, 0xff, 0xff, 0xff, 0xdd, 0x88, 0x33, 0x00, 0x01, 0x25, 0x7a, 0xcf, 0xff, 0xff, 0xff,
+	0xbb, 0x66, 0x11, 0x00, 0x11, 0x01, 0x56, 0xab, 0xff, 0xff, 0xff, 0xdd, 0x88, 0x33, 0x00, 0x09, 0x15, 0x65, 0xba, 0xf9, 0xff, 0xed, 0x9c, 0x47,
+	0x10, 0x5a, 0xaf, 0xf8, 0xff, 0xf4, 0xaa, 0x55, 0x0b, 0x00, 0x10, 0x15, 0x65, 0xba, 0xf9, 0xff, 0xed, 0x9c, 0x47, 0x10, 0x5a, 0xaf, 0xf8, 0xff,
+	0xf4, 0xaa, 0x55, 0x0b, 0x00, 0x10, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x02, 0x13, 0x68, 0xbd, 0xff, 0xff, 0xc3, 0x6e, 0x19,
+	0x00, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x06, 0xff, 0x00, 0x09,
+	0xff, 0x00, 0x06, 0xff, 0x00, 0x06, 0xff, 0x00, 0x11, 0xff, 0xff, 0xff, 0xff, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0x00, 0x0d, 0xff, 0x00, 0x0a,
+	0xff, 0x00, 0x01, 0xff, 0x00, 0x05, 0xff, 0x00, 0x04, 0xff, 0x00, 0x01, 0xff, 0x00, 0x07, 0xff, 0x00, 0x01, 0xff, 0x00, 0x04, 0xff, 0x00, 0x01,
+	0xff, 0x00, 0x04, 0xff, 0x00, 0x01, 0xff, 0x00, 0x0f, 0xff, 0x00, 0x04, 0xff, 0x00, 0x01, 0xff, 0x00, 0x04, 0xff, 0x00, 0x0d, 0x4c, 0xa1, 0xf5,
+	0xff, 0xff, 0xfb, 0xaa, 0x55, 0x03, 0x00, 0x16, 0x0c, 0x61, 0xb6, 0xff, 0xff, 0xff, 0xe7, 0x92, 0x3d, 0x00, 0x03, 0x4c, 0xa1, 0xf5, 0xff, 0xff,
+	0xfb, 0xaa, 0x55, 0x03, 0x00, 0x16, 0x0c, 0x61, 0xb6, 0xff, 0xff, 0xff, 0xe7, 0x92, 0x3d, 0x00, 0x03, 0x4c, 0xa1, 0xf5, 0xff, 0xff, 0xfb, 0xaa,
+	0x55, 0x03, 0x00, 0x16, 0x0c, 0x61, 0xb6, 0xff, 0xff, 0xff, 0xe7, 0x92, 0x3d, 0x00, 0x02, 0x25, 0x7a, 0xcf, 0xff, 0xff, 0xff, 0xbb, 0x66, 0x11,
+	0x00, 0x11, 0x01, 0x56, 0xab, 0xff, 0xff, 0xff, 0xdd, 0x88, 0x33, 0x00, 0x01, 0x25, 0x7a, 0xcf, 0xff, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x11,
+	0x01, 0x56, 0xab, 0xff, 0xff, 0xff, 0xdd, 0x88, 0x33, 0x00, 0x01, 0x25, 0x7a, 0xcf, 0xff, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x11, 0x01, 0x56,
+	0xab, 0xff, 0xff, 0xff, 0xdd, 0x88, 0x33, 0x00, 0x0a, 0x0e, 0x5a, 0xaf, 0xf5, 0xff, 0xe2, 0x91, 0x83, 0xa0, 0xf1, 0xff, 0xf2, 0xa6, 0x51, 0x09,
+	0x00, 0x12, 0x0e, 0x5a, 0xaf, 0xf5, 0xff, 0xe2, 0x91, 0x83, 0xa0, 0xf1, 0xff, 0xf2, 0xa6, 0x51, 0x09, 0x00, 0x11, 0x3f, 0x94, 0xe9, 0xff, 0xff,
+	0xea, 0x95, 0x40, 0x00, 0x02, 0x13, 0x68, 0xbd, 0xff, 0xff, 0xc3, 0x6e, 0x19, 0x00, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x12, 0xff,
+	0x00, 0x10, 0xff, 0x00, 0x17, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x0c, 0xff, 0x00, 0x06, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x04, 0xff, 0x00, 0x01, 0xff, 0x00, 0x08, 0xff, 0xff, 0x00, 0x04,
+	0xff, 0x00, 0x01, 0xff, 0x00, 0x04, 0xff, 0xff, 0x00, 0x0f, 0xff, 0x00, 0x05, 0xff, 0x00, 0x01, 0xff, 0x00, 0x05, 0xff, 0x00, 0x0c, 0x2c, 0x81,
+	0xd6, 0xff, 0xff, 0xff, 0xc5, 0x70, 0x1b, 0x00, 0x16, 0x26, 0x7b, 0xd0, 0xff, 0xff, 0xff, 0xc5, 0x70, 0x1b, 0x00, 0x03, 0x2c, 0x81, 0xd6, 0xff,
+	0xff, 0xff, 0xc5, 0x70, 0x1b, 0x00, 0x16, 0x26, 0x7b, 0xd0, 0xff, 0xff, 0xff, 0xc5, 0x70, 0x1b, 0x00, 0x03, 0x2c, 0x81, 0xd6, 0xff, 0xff, 0xff,
+	0xc5, 0x70, 0x1b, 0x00, 0x16, 0x26, 0x7b, 0xd0, 0xff, 0xff, 0xff, 0xc5, 0x70, 0x1b, 0x00, 0x02, 0x24, 0x79, 0xce, 0xff, 0xff, 0xff, 0xbc, 0x67,
+	0x12, 0x00, 0x11, 0x02, 0x57, 0xac, 0xff, 0xff, 0xff, 0xdc, 0x87, 0x32, 0x00, 0x01, 0x24, 0x79, 0xce, 0xff, 0xff, 0xff, 0xbc, 0x67, 0x12, 0x00,
+	0x11, 0x02, 0x57, 0xac, 0xff, 0xff, 0xff, 0xdc, 0x87, 0x32, 0x00, 0x01, 0x24, 0x79, 0xce, 0xff, 0xff, 0xff, 0xbc, 0x67, 0x12, 0x00, 0x11, 0x02,
+	0x57, 0xac, 0xff, 0xff, 0xff, 0xdc, 0x87, 0x32, 0x00, 0x0b, 0x09, 0x4f, 0xa4, 0xf0, 0xff, 0xec, 0xec, 0xec, 0xff, 0xef, 0xa2, 0x4d, 0x07, 0x00,
+	0x14, 0x09, 0x4f, 0xa4, 0xf0, 0xff, 0xec, 0xec, 0xec, 0xff, 0xef, 0xa2, 0x4d, 0x07, 0x00, 0x12, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40,
+	0x00, 0x02, 0x13, 0x68, 0xbd, 0xff, 0xff, 0xc3, 0x6e, 0x19, 0x00, 0x02, 0xff, 0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0x00, 0x12, 0xff, 0x00, 0x10,
+	0xff, 0x00, 0x30, 0xff, 0x00, 0x03, 0xff, 0x00, 0x02, 0xff, 0x00, 0x10, 0xff, 0x00, 0x01, 0xff, 0x00, 0x0e, 0xff, 0x00, 0x01, 0xff, 0x00, 0x15,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x0c, 0x0d, 0x5f, 0xb4, 0xfc, 0xff, 0xff,
+	0xf2, 0xab, 0x56, 0x0e, 0x00, 0x14, 0x14, 0x61, 0xb6, 0xf7, 0xff, 0xff, 0xf3, 0x9f, 0x4a, 0x01, 0x00, 0x03, 0x0d, 0x5f, 0xb4, 0xfc, 0xff, 0xff,
+	0xf2, 0xab, 0x56, 0x0e, 0x00, 0x14, 0x14, 0x61, 0xb6, 0xf7, 0xff, 0xff, 0xf3, 0x9f, 0x4a, 0x01, 0x00, 0x03, 0x0d, 0x5f, 0xb4, 0xfc, 0xff, 0xff,
+	0xf2, 0xab, 0x56, 0x0e, 0x00, 0x14, 0x14, 0x61, 0xb6, 0xf7, 0xff, 0xff, 0xf3, 0x9f, 0x4a, 0x01, 0x00, 0x02, 0x0a, 0x5e, 0xb3, 0xfd, 0xff, 0xff,
+	0xeb, 0x99, 0x44, 0x03, 0x00, 0x10, 0x19, 0x6e, 0xc3, 0xff, 0xff, 0xff, 0xc1, 0x6c, 0x17, 0x00, 0x01, 0x0a, 0x5e, 0xb3, 0xfd, 0xff, 0xff, 0xeb,
+	0x99, 0x44, 0x03, 0x00, 0x10, 0x19, 0x6e, 0xc3, 0xff, 0xff, 0xff, 0xc1, 0x6c, 0x17, 0x00, 0x01, 0x0a, 0x5e, 0xb3, 0xfd, 0xff, 0xff, 0xeb, 0x99,
+	0x44, 0x03, 0x00, 0x10, 0x19, 0x6e, 0xc3, 0xff, 0xff, 0xff, 0xc1, 0x6c, 0x17, 0x00, 0x0c, 0x05, 0x45, 0x9a, 0xe9, 0xff, 0xff, 0xff, 0xed, 0x9e,
+	0x49, 0x06, 0x00, 0x16, 0x05, 0x45, 0x9a, 0xe9, 0xff, 0xff, 0xff, 0xed, 0x9e, 0x49, 0x06, 0x00, 0x13, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95,
+	0x40, 0x00, 0x02, 0x13, 0x68, 0xbd, 0xff, 0xff, 0xc3, 0x6e, 0x19, 0x00, 0x02, 0xff, 0xff, 0x00, 0x03, 0xff, 0xff, 0x00, 0x11, 0xff, 0x00, 0x10,
+	0xff, 0x00, 0x30, 0xff, 0x00, 0x02, 0xff, 0x00, 0x01, 0xff, 0x00, 0x02, 0xff, 0x00, 0x0c, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0xff,
+	0xff, 0x00, 0x08, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0x00, 0x2e, 0x0d, 0x4f, 0xa4, 0xec, 0xff, 0xff, 0xfb, 0xc2, 0x6d,
+	0x1c, 0x00, 0x12, 0x24, 0x77, 0xcc, 0xfd, 0xff, 0xfe, 0xdd, 0x8c, 0x38, 0x04, 0x00, 0x05, 0x0d, 0x4f, 0xa4, 0xec, 0xff, 0xff, 0xfb, 0xc2, 0x6d,
+	0x1c, 0x00, 0x12, 0x24, 0x77, 0xcc, 0xfd, 0xff, 0xfe, 0xdd, 0x8c, 0x38, 0x04, 0x00, 0x05, 0x0d, 0x4f, 0xa4, 0xec, 0xff, 0xff, 0xfb, 0xc2, 0x6d,
+	0x1c, 0x00, 0x12, 0x24, 0x77, 0xcc, 0xfd, 0xff, 0xfe, 0xdd, 0x8c, 0x38, 0x04, 0x00, 0x04, 0x37, 0x8c, 0xe1, 0xff, 0xff, 0xff, 0xe8, 0x95, 0x40,
+	0x02, 0x00, 0x0e, 0x0c, 0x51, 0xa6, 0xef, 0xff, 0xff, 0xee, 0x99, 0x44, 0x00, 0x03, 0x37, 0x8c, 0xe1, 0xff, 0xff, 0xff, 0xe8, 0x95, 0x40, 0x02,
+	0x00, 0x0e, 0x0c, 0x51, 0xa6, 0xef, 0xff, 0xff, 0xee, 0x99, 0x44, 0x00, 0x03, 0x37, 0x8c, 0xe1, 0xff, 0xff, 0xff, 0xe8, 0x95, 0x40, 0x02, 0x00,
+	0x0e, 0x0c, 0x51, 0xa6, 0xef, 0xff, 0xff, 0xee, 0x99, 0x44, 0x00, 0x0e, 0x30, 0x85, 0xda, 0xff, 0xff, 0xea, 0x99, 0x44, 0x04, 0x00, 0x18, 0x30,
+	0x85, 0xda, 0xff, 0xff, 0xea, 0x99, 0x44, 0x04, 0x00, 0x14, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x02, 0x13, 0x68, 0xbd, 0xff,
+	0xff, 0xc3, 0x6e, 0x19, 0x00, 0x02, 0xff, 0x00, 0x04, 0xff, 0xff, 0x00, 0x0e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x0a, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x2d, 0xff, 0x00, 0x01, 0xff, 0x00, 0x02, 0xff, 0x00, 0x02, 0xff, 0x00, 0x0c, 0xff, 0x00, 0x07, 0xff, 0x00,
+	0x08, 0xff, 0x00, 0x07, 0xff, 0x00, 0x0c, 0xff, 0xff, 0x00, 0x0b, 0xff, 0xff, 0x00, 0x14, 0x01, 0x2a, 0x7d, 0xd1, 0xfd, 0xff, 0xff, 0xf2, 0xcc,
+	0x8f, 0x49, 0x1a, 0x02, 0x00, 0x0a, 0x04, 0x1e, 0x51, 0x98, 0xd2, 0xf5, 0xff, 0xff, 0xf4, 0xb6, 0x61, 0x16, 0x00, 0x08, 0x01, 0x2a, 0x7d, 0xd1,
+	0xfd, 0xff, 0xff, 0xf2, 0xcc, 0x8f, 0x49, 0x1a, 0x02, 0x00, 0x0a, 0x04, 0x1e, 0x51, 0x98, 0xd2, 0xf5, 0xff, 0xff, 0xf4, 0xb6, 0x61, 0x16, 0x00,
+	0x08, 0x01, 0x2a, 0x7d, 0xd1, 0xfd, 0xff, 0xff, 0xf2, 0xcc, 0x8f, 0x49, 0x1a, 0x02, 0x00, 0x0a, 0x04, 0x1e, 0x51, 0x98, 0xd2, 0xf5, 0xff, 0xff,
+	0xf4, 0xb6, 0x61, 0x16, 0x00, 0x06, 0x04, 0x30, 0x82, 0xd3, 0xfc, 0xff, 0xff, 0xe6, 0xad, 0x69, 0x33, 0x17, 0x06, 0x00, 0x08, 0x02, 0x16, 0x42,
+	0x92, 0xd3, 0xfc, 0xff, 0xfd, 0xd8, 0x89, 0x36, 0x06, 0x00, 0x03, 0x04, 0x30, 0x82, 0xd3, 0xfc, 0xff, 0xff, 0xe6, 0xad, 0x69, 0x33, 0x17, 0x06,
+	0x00, 0x08, 0x02, 0x16, 0x42, 0x92, 0xd3, 0xfc, 0xff, 0xfd, 0xd8, 0x89, 0x36, 0x06, 0x00, 0x03, 0x04, 0x30, 0x82, 0xd3, 0xfc, 0xff, 0xff, 0xe6,
+	0xad, 0x69, 0x33, 0x17, 0x06, 0x00, 0x08, 0x02, 0x16, 0x42, 0x92, 0xd3, 0xfc, 0xff, 0xfd, 0xd8, 0x89, 0x36, 0x06, 0x00, 0x0c, 0x02, 0x36, 0x8b,
+	0xde, 0xff, 0xff, 0xe4, 0x93, 0x3e, 0x03, 0x00, 0x17, 0x02, 0x36, 0x8b, 0xde, 0xff, 0xff, 0xe4, 0x93, 0x3e, 0x03, 0x00, 0x15, 0x40, 0x95, 0xea,
+	0xff, 0xff, 0xe7, 0x92, 0x3d, 0x00, 0x02, 0x13, 0x68, 0xbd, 0xff, 0xff, 0xc3, 0x6e, 0x19, 0x00, 0x08, 0xff, 0xff, 0x00, 0x0e, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0x00, 0x0c, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x0e, 0xff, 0x00, 0x0d, 0xff, 0x00, 0x11, 0xff, 0xff, 0x00, 0x04, 0xff, 0x00, 0x02,
+	0xff, 0x00, 0x0c, 0xff, 0x00, 0x05, 0xff, 0x00, 0x0a, 0xff, 0x00, 0x05, 0xff, 0x00, 0x0c, 0xff, 0x00, 0x01, 0xff, 0x00, 0x0b, 0xff, 0x00, 0x01,
+	0xff, 0x00, 0x15, 0x0a, 0x2b, 0x63, 0xa5, 0xd9, 0xf7, 0xff, 0xff, 0xfb, 0xeb, 0xd5, 0xbd, 0xab, 0x9a, 0x89, 0x7e, 0x7f, 0x8b, 0x9c, 0xad, 0xbf,
+	0xd8, 0xed, 0xfc, 0xff, 0xfe, 0xee, 0xc8, 0x8d, 0x4c, 0x1c, 0x03, 0x00, 0x0b, 0x0a, 0x2b, 0x63, 0xa5, 0xd9, 0xf7, 0xff, 0xff, 0xfb, 0xeb, 0xd5,
+	0xbd, 0xab, 0x9a, 0x89, 0x7e, 0x7f, 0x8b, 0x9c, 0xad, 0xbf, 0xd8, 0xed, 0xfc, 0xff, 0xfe, 0xee, 0xc8, 0x8d, 0x4c, 0x1c, 0x03, 0x00, 0x0b, 0x0a,
+	0x2b, 0x63, 0xa5, 0xd9, 0xf7, 0xff, 0xff, 0xfb, 0xeb, 0xd5, 0xbd, 0xab, 0x9a, 0x89, 0x7e, 0x7f, 0x8b, 0x9c, 0xad, 0xbf, 0xd8, 0xed, 0xfc, 0xff,
+	0xfe, 0xee, 0xc8, 0x8d, 0x4c, 0x1c, 0x03, 0x00, 0x09, 0x0a, 0x3f, 0x8c, 0xd7, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xec, 0xd4, 0xb5, 0x96, 0x83,
+	0x80, 0x8b, 0x9a, 0xac, 0xcb, 0xe7, 0xfc, 0xff, 0xff, 0xf6, 0xd7, 0x8f, 0x43, 0x0d, 0x00, 0x07, 0x0a, 0x3f, 0x8c, 0xd7, 0xf7, 0xff, 0xff, 0xff,
+	0xff, 0xfb, 0xec, 0xd4, 0xb5, 0x96, 0x83, 0x80, 0x8b, 0x9a, 0xac, 0xcb, 0xe7, 0xfc, 0xff, 0xff, 0xf6, 0xd7, 0x8f, 0x43, 0x0d, 0x00, 0x07, 0x0a,
+	0x3f, 0x8c, 0xd7, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xec, 0xd4, 0xb5, 0x96, 0x83, 0x80, 0x8b, 0x9a, 0xac, 0xcb, 0xe7, 0xfc, 0xff, 0xff, 0xf6,
+	0xd7, 0x8f, 0x43, 0x0d, 0x00, 0x0c, 0x01, 0x1a, 0x5f, 0xb3, 0xee, 0xff, 0xfe, 0xd3, 0x7e, 0x2a, 0x00, 0x17, 0x01, 0x1a, 0x5f, 0xb3, 0xee, 0xff,
+	0xfe, 0xd3, 0x7e, 0x2a, 0x00, 0x16, 0x0f, 0x61, 0xb6, 0xfc, 0xff, 0xff, 0xcd, 0x78, 0x23, 0x00, 0x02, 0x13, 0x68, 0xbd, 0xff, 0xff, 0xc3, 0x6e,
+	0x19, 0x00, 0x08, 0xff, 0xff, 0x00, 0x0f, 0xff, 0xff, 0xff, 0x00, 0x0e, 0xff, 0xff, 0xff, 0x00, 0x0e, 0xff, 0xff, 0x00, 0x0d, 0xff, 0xff, 0x00,
+	0x16, 0xff, 0x00, 0x02, 0xff, 0x00, 0x0d, 0xff, 0x00, 0x03, 0xff, 0x00, 0x0c, 0xff, 0x00, 0x03, 0xff, 0x00, 0x0c, 0xff, 0x00, 0x02, 0xff, 0x00,
+	0x0b, 0xff, 0x00, 0x02, 0xff, 0x00, 0x18, 0x0e, 0x32, 0x69, 0x98, 0xb8, 0xc9, 0xda, 0xea, 0xf6, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf4, 0xe6,
+	0xd5, 0xc4, 0xae, 0x88, 0x53, 0x22, 0x06, 0x00, 0x13, 0x0e, 0x32, 0x69, 0x98, 0xb8, 0xc9, 0xda, 0xea, 0xf6, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfc,
+	0xf4, 0xe6, 0xd5, 0xc4, 0xae, 0x88, 0x53, 0x22, 0x06, 0x00, 0x13, 0x0e, 0x32, 0x69, 0x98, 0xb8, 0xc9, 0xda, 0xea, 0xf6, 0xfd, 0xff, 0xff, 0xff,
+	0xff, 0xfc, 0xf4, 0xe6, 0xd5, 0xc4, 0xae, 0x88, 0x53, 0x22, 0x06, 0x00, 0x10, 0x0b, 0x29, 0x5a, 0x92, 0xbd, 0xdb, 0xec, 0xf7, 0xfd, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xfc, 0xf4, 0xe7, 0xd6, 0xba, 0x8f, 0x58, 0x27, 0x0a, 0x00, 0x0d, 0x0b, 0x29, 0x5a, 0x92, 0xbd, 0xdb, 0xec, 0xf7, 0xfd, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xfc, 0xf4, 0xe7, 0xd6, 0xba, 0x8f, 0x58, 0x27, 0x0a, 0x00, 0x0d, 0x0b, 0x29, 0x5a, 0x92, 0xbd, 0xdb, 0xec, 0xf7, 0xfd,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf4, 0xe7, 0xd6, 0xba, 0x8f, 0x58, 0x27, 0x0a, 0x00, 0x07, 0x0a, 0x41, 0x73, 0x99, 0x92, 0x94, 0x9a, 0xac,
+	0xc9, 0xe7, 0xfa, 0xff, 0xfd, 0xdd, 0x95, 0x42, 0x0d, 0x00, 0x10, 0x0a, 0x41, 0x73, 0x99, 0x92, 0x94, 0x9a, 0xac, 0xc9, 0xe7, 0xfa, 0xff, 0xfd,
+	0xdd, 0x95, 0x42, 0x0d, 0x00, 0x10, 0x03, 0x42, 0x78, 0xa7, 0x9b, 0x9a, 0xa9, 0xca, 0xea, 0xfd, 0xff, 0xfc, 0xd0, 0x7c, 0x2a, 0x01, 0x00, 0x02,
+	0x13, 0x68, 0xbd, 0xff, 0xff, 0xc3, 0x6e, 0x19, 0x00, 0x1a, 0xff, 0x00, 0x10, 0xff, 0x00, 0x0e, 0xff, 0xff, 0xff, 0x00, 0x0d, 0xff, 0xff, 0xff,
+	0x00, 0x16, 0xff, 0xff, 0x00, 0x0f, 0xff, 0x00, 0x01, 0xff, 0x00, 0x0e, 0xff, 0x00, 0x01, 0xff, 0x00, 0x0c, 0xff, 0x00, 0x03, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x03, 0xff, 0x00, 0x1f, 0x04, 0x0d, 0x1c, 0x26, 0x25, 0x19, 0x0b, 0x03, 0x00,
+	0x23, 0x04, 0x0d, 0x1c, 0x26, 0x25, 0x19, 0x0b, 0x03, 0x00, 0x23, 0x04, 0x0d, 0x1c, 0x26, 0x25, 0x19, 0x0b, 0x03, 0x00, 0x1f, 0x03, 0x0b, 0x18,
+	0x24, 0x28, 0x22, 0x14, 0x09, 0x02, 0x00, 0x1b, 0x03, 0x0b, 0x18, 0x24, 0x28, 0x22, 0x14, 0x09, 0x02, 0x00, 0x1b, 0x03, 0x0b, 0x18, 0x24, 0x28,
+	0x22, 0x14, 0x09, 0x02, 0x00, 0x0e, 0x0c, 0x52, 0x9d, 0xdf, 0xe8, 0xed, 0xeb, 0xe3, 0xd5, 0xc5, 0xaa, 0x80, 0x49, 0x1d, 0x05, 0x00, 0x12, 0x0c,
+	0x52, 0x9d, 0xdf, 0xe8, 0xed, 0xeb, 0xe3, 0xd5, 0xc5, 0xaa, 0x80, 0x49, 0x1d, 0x05, 0x00, 0x12, 0x03, 0x44, 0x8e, 0xd8, 0xe6, 0xeb, 0xe7, 0xdc,
+	0xcd, 0xb4, 0x8b, 0x53, 0x22, 0x07, 0x00, 0x04, 0x12, 0x63, 0xb4, 0xf3, 0xf3, 0xba, 0x69, 0x18, 0x00, 0x39, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x27, 0xff, 0x00, 0x10, 0xff, 0x00, 0x0c, 0xff,
+	0x00, 0x15, 0xff, 0x00, 0xff, 0x00, 0x91, 0xff, 0xff, 0xff, 0x00, 0x0d, 0xff, 0xff, 0xff, 0x00, 0x47, 0xff, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x03, 0xff, 0x00, 0x0e, 0x2a, 0x62, 0x9a, 0xa9, 0xa9, 0x9b, 0x62, 0x2a, 0x00, 0x17,
+	0x0d, 0x45, 0x7d, 0xa9, 0xa9, 0x81, 0x49, 0x11, 0x00, 0x0b, 0x0e, 0x2f, 0x56, 0x76, 0x88, 0x99, 0xa9, 0xb9, 0xc9, 0xd9, 0xe4, 0xe4, 0xd9, 0xc8,
+	0xb7, 0xa6, 0x95, 0x85, 0x6f, 0x4a, 0x23, 0x07, 0x00, 0x16, 0x09, 0x26, 0x4c, 0x6f, 0x7d, 0x7d, 0x6f, 0x54, 0x32, 0x14, 0x03, 0x00, 0x04, 0x0d,
+	0x3d, 0x6e, 0x91, 0x66, 0x36, 0x05, 0x00, 0x16, 0x14, 0x34, 0x59, 0x61, 0x4a, 0x25, 0x09, 0x00, 0x04, 0x0b, 0x28, 0x4e, 0x66, 0x5d, 0x38, 0x14,
+	0x00, 0x16, 0x02, 0x13, 0x24, 0x32, 0x32, 0x32, 0x32, 0x2b, 0x1b, 0x0a, 0x00, 0x2b, 0x0d, 0x1d, 0x2e, 0x32, 0x32, 0x32, 0x32, 0x21, 0x10, 0x00,
+	0x1a, 0x05, 0x16, 0x26, 0x32, 0x32, 0x32, 0x2f, 0x1e, 0x0e, 0x00, 0x1c, 0x10, 0x31, 0x57, 0x73, 0x84, 0x94, 0xa4, 0xb5, 0xc5, 0xd5, 0xe1, 0xe4,
+	0xdf, 0xd6, 0xcd, 0xc4, 0xb8, 0xa5, 0x8b, 0x6d, 0x4e, 0x2e, 0x14, 0x04, 0x00, 0x3d, 0xff, 0xff, 0x00, 0x0d, 0xff, 0xff, 0x00, 0x49, 0xff, 0x00,
+	0x02, 0xff, 0x00, 0x0b, 0xff, 0x00, 0x02, 0xff, 0x00, 0x0f, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x17, 0x13, 0x68, 0xbd, 0xff,
+	0xff, 0xc3, 0x6e, 0x19, 0x00, 0x07, 0x0c, 0x2f, 0x66, 0xa7, 0xd9, 0xf7, 0xff, 0xff, 0xff, 0xfe, 0xfa, 0xef, 0xdf, 0xcd, 0xc1, 0xc1, 0xcd, 0xdf,
+	0xef, 0xfa, 0xfe, 0xff, 0xff, 0xfe, 0xef, 0xcb, 0x91, 0x50, 0x20, 0x05, 0x00, 0x10, 0x11, 0x53, 0xa8, 0xec, 0xfe, 0xfd, 0xfc, 0xfc, 0xfe, 0xff,
+	0xfe, 0xf3, 0xd8, 0xb2, 0x90, 0x80, 0x87, 0xb0, 0xdb, 0xfa, 0xd6, 0x81, 0x2d, 0x00, 0x16, 0x1b, 0x70, 0xc5, 0xff, 0xff, 0xf6, 0xa6, 0x51, 0x04,
+	0x00, 0x02, 0x05, 0x54, 0xa9, 0xf9, 0xff, 0xff, 0xc6, 0x71, 0x1c, 0x00, 0x16, 0x1c, 0x5f, 0xb4, 0xed, 0xff, 0xff, 0xfd, 0xd3, 0x80, 0x2d, 0x02,
+	0x00, 0x27, 0x05, 0x39, 0x8d, 0xdd, 0xfe, 0xff, 0xfe, 0xe5, 0xa5, 0x51, 0x15, 0x00, 0x18, 0x06, 0x2e, 0x7d, 0xcc, 0xf9, 0xff, 0xff, 0xff, 0xff,
+	0xe8, 0xa7, 0x52, 0x14, 0x00, 0x15, 0x01, 0x13, 0x39, 0x73, 0xb0, 0xdf, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf3, 0xe4, 0xd2, 0xc5, 0xc2, 0xca,
+	0xd5, 0xe1, 0xee, 0xf8, 0xfe, 0xff, 0xfe, 0xde, 0x8e, 0x39, 0x05, 0x00, 0x3e, 0xff, 0x00, 0x0d, 0xff, 0x00, 0x4b, 0xff, 0x00, 0x01, 0xff, 0x00,
+	0x0b, 0xff, 0x00, 0x01, 0xff, 0x00, 0x10, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x17, 0x13, 0x68, 0xbd, 0xff, 0xff, 0xc3, 0x6e,
+	0x19, 0x00, 0x05, 0x15, 0x5d, 0xb2, 0xf2, 0xff, 0xff, 0xff, 0xf1, 0xcb, 0x8e, 0x4d, 0x1f, 0x08, 0x01, 0x00, 0x06, 0x01, 0x08, 0x20, 0x4f, 0x90,
+	0xcd, 0xf2, 0xff, 0xff, 0xfe, 0xe2, 0x95, 0x41, 0x08, 0x00, 0x0d, 0x0a, 0x5c, 0xb1, 0xfb, 0xd3, 0x8a, 0x37, 0x0d, 0x09, 0x1b, 0x3c, 0x66, 0x92,
+	0xbd, 0xdf, 0xf5, 0xfd, 0xfb, 0xef, 0xcc, 0x8d, 0x45, 0x13, 0x00, 0x18, 0x1e, 0x47, 0x76, 0x7e, 0x65, 0x36, 0x10, 0x00, 0x04, 0x12, 0x38, 0x68,
+	0x7e, 0x73, 0x43, 0x1a, 0x00, 0x19, 0x10, 0x42, 0x90, 0xd5, 0xf8, 0xff, 0xf3, 0xb8, 0x63, 0x1a, 0x00, 0x24, 0x01, 0x23, 0x71, 0xc5, 0xf8, 0xff,
+	0xf4, 0xcb, 0x81, 0x36, 0x0a, 0x00, 0x18, 0x12, 0x46, 0x97, 0xda, 0xfb, 0xf9, 0xdb, 0xa2, 0x7b, 0x89, 0xc1, 0xee, 0xff, 0xee, 0xbb, 0x6b, 0x27,
+	0x05, 0x00, 0x10, 0x04, 0x33, 0x83, 0xd4, 0xfa, 0xff, 0xff, 0xfe, 0xee, 0xc7, 0x8b, 0x4f, 0x24, 0x0c, 0x03, 0x00, 0x07, 0x02, 0x0f, 0x27, 0x48,
+	0x53, 0x3a, 0x17, 0x00, 0x9b, 0xff, 0xff, 0x00, 0x0b, 0xff, 0xff, 0x00, 0x11, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x17, 0x13,
+	0x68, 0xbd, 0xff, 0xff, 0xc3, 0x6e, 0x19, 0x00, 0x03, 0x03, 0x33, 0x87, 0xd9, 0xfe, 0xff, 0xff, 0xde, 0x93, 0x3e, 0x0a, 0x00, 0x10, 0x0b, 0x44,
+	0x99, 0xe2, 0xff, 0xff, 0xf9, 0xc3, 0x6e, 0x1f, 0x00, 0x0c, 0x03, 0x0c, 0x15, 0x19, 0x10, 0x07, 0x00, 0x09, 0x05, 0x08, 0x08, 0x03, 0x00, 0x49,
+	0x02, 0x1b, 0x50, 0x9c, 0xd7, 0xf7, 0xeb, 0xab, 0x56, 0x15, 0x00, 0x21, 0x1c, 0x64, 0xb9, 0xf1, 0xf5, 0xd1, 0x90, 0x46, 0x15, 0x00, 0x18, 0x05,
+	0x2b, 0x72, 0xc2, 0xef, 0xee, 0xc8, 0x8b, 0x48, 0x19, 0x02, 0x00, 0x02, 0x0b, 0x2e, 0x68, 0xac, 0xdd, 0xf5, 0xdd, 0x9d, 0x4b, 0x14, 0x00, 0x0d,
+	0x1b, 0x66, 0xbb, 0xf5, 0xff, 0xff, 0xf8, 0xc5, 0x76, 0x27, 0x06, 0x00, 0xce, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x03, 0x04,
+	0x10, 0x1f, 0x2e, 0x36, 0x34, 0x2a, 0x18, 0x0a, 0x02, 0x00, 0x0a, 0x13, 0x68, 0xbd, 0xff, 0xff, 0xc3, 0x6e, 0x19, 0x00, 0x02, 0x07, 0x4f, 0xa4,
+	0xf2, 0xff, 0xff, 0xfb, 0xc6, 0x71, 0x20, 0x00, 0x14, 0x27, 0x7a, 0xcf, 0xfd, 0xff, 0xff, 0xe4, 0x8f, 0x3a, 0x00, 0x0d, 0x0e, 0x2f, 0x56, 0x76,
+	0x88, 0x99, 0xa9, 0xb9, 0xc9, 0xd9, 0xe4, 0xe4, 0xd9, 0xc8, 0xb7, 0xa6, 0x95, 0x85, 0x6f, 0x4a, 0x23, 0x07, 0x00, 0x15, 0x0e, 0x2f, 0x56, 0x76,
+	0x88, 0x99, 0xa9, 0xb9, 0xc9, 0xd9, 0xe4, 0xe4, 0xd9, 0xc8, 0xb7, 0xa6, 0x95, 0x85, 0x6f, 0x4a, 0x23, 0x07, 0x00, 0x1d, 0x09, 0x12, 0x1a, 0x18,
+	0x0f, 0x06, 0x00, 0x21, 0x07, 0x10, 0x19, 0x1a, 0x11, 0x08, 0x00, 0x1b, 0x02, 0x0b, 0x14, 0x1b, 0x17, 0x0e, 0x05, 0x00, 0x0a, 0x09, 0x12, 0x1a,
+	0x19, 0x10, 0x07, 0x00, 0x0b, 0x01, 0x3c, 0x91, 0xe5, 0xff, 0xff, 0xff, 0xe2, 0x94, 0x3f, 0x07, 0x00, 0x23, 0x04, 0x1e, 0x42, 0x5f, 0x5e, 0x3c,
+	0x1a, 0x02, 0x00, 0x04, 0x15, 0x35, 0x5c, 0x66, 0x51, 0x2a, 0x0a, 0x00, 0x1b, 0x09, 0x19, 0x2a, 0x32, 0x32, 0x32, 0x32, 0x25, 0x14, 0x03, 0x00,
+	0x0b, 0x05, 0x16, 0x27, 0x32, 0x32, 0x32, 0x32, 0x28, 0x17, 0x07, 0x00, 0x19, 0x02, 0x12, 0x23, 0x32, 0x32, 0x32, 0x32, 0x2c, 0x1b, 0x0a, 0x00,
+	0x0c, 0x0c, 0x1c, 0x2d, 0x32, 0x32, 0x32, 0x28, 0x18, 0x07, 0x00, 0x10, 0x09, 0x19, 0x2a, 0x32, 0x32, 0x32, 0x2b, 0x1b, 0x0a, 0x00, 0x0f, 0x3f,
+	0x94, 0xe9, 0xff, 0xff, 0xe2, 0x8e, 0x4f, 0x43, 0x84, 0xbb, 0xe3, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xee, 0xcb, 0x94, 0x51, 0x1f,
+	0x05, 0x00, 0x05, 0x13, 0x68, 0xbd, 0xff, 0xff, 0xc3, 0x6e, 0x19, 0x00, 0x02, 0x26, 0x7b, 0xd0, 0xff, 0xff, 0xff, 0xcc, 0x77, 0x22, 0x00, 0x16,
+	0x2d, 0x82, 0xd7, 0xff, 0xff, 0xff, 0xbd, 0x68, 0x13, 0x00, 0x08, 0x0c, 0x2f, 0x66, 0xa7, 0xd9, 0xf7, 0xff, 0xff, 0xff, 0xfe, 0xfa, 0xef, 0xdf,
+	0xcd, 0xc1, 0xc1, 0xcd, 0xdf, 0xef, 0xfa, 0xfe, 0xff, 0xff, 0xfe, 0xef, 0xcb, 0x91, 0x50, 0x20, 0x05, 0x00, 0x0d, 0x0c, 0x2f, 0x66, 0xa7, 0xd9,
+	0xf7, 0xff, 0xff, 0xff, 0xfe, 0xfa, 0xef, 0xdf, 0xcd, 0xc1, 0xc1, 0xcd, 0xdf, 0xef, 0xfa, 0xfe, 0xff, 0xff, 0xfe, 0xef, 0xcb, 0x91, 0x50, 0x20,
+	0x05, 0x00, 0x16, 0x0f, 0x50, 0x92, 0xc5, 0xc7, 0xc7, 0xb6, 0x76, 0x33, 0x01, 0x00, 0x1f, 0x0f, 0x50, 0x92, 0xc5, 0xc7, 0xc7, 0xb6, 0x76, 0x33,
+	0x01, 0x00, 0x1f, 0x0f, 0x50, 0x92, 0xc5, 0xc7, 0xc7, 0xb6, 0x76, 0x33, 0x01, 0x00, 0x11, 0x1b, 0x70, 0xc5, 0xff, 0xff, 0xff, 0xdd, 0x88, 0x33,
+	0x00, 0x25, 0x3a, 0x8f, 0xe4, 0xff, 0xff, 0xdc, 0x87, 0x32, 0x00, 0x03, 0x1e, 0x73, 0xc8, 0xff, 0xff, 0xf9, 0xa8, 0x53, 0x03, 0x00, 0x18, 0x01,
+	0x29, 0x7b, 0xce, 0xfc, 0xff, 0xff, 0xee, 0xb7, 0x63, 0x1f, 0x01, 0x00, 0x0b, 0x02, 0x26, 0x6f, 0xc1, 0xf3, 0xff, 0xff, 0xf9, 0xc5, 0x71, 0x21,
+	0x00, 0x17, 0x11, 0x57, 0xac, 0xef, 0xff, 0xff, 0xf9, 0xd3, 0x87, 0x37, 0x09, 0x00, 0x0a, 0x10, 0x4a, 0x9e, 0xe3, 0xfe, 0xff, 0xff, 0xff, 0xfb,
+	0xd3, 0x86, 0x34, 0x08, 0x00, 0x0c, 0x0b, 0x3c, 0x8f, 0xd9, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xdd, 0x94, 0x40, 0x0c, 0x00, 0x0d, 0x3f, 0x94, 0xe9,
+	0xff, 0xff, 0xef, 0xe4, 0xe4, 0xf0, 0xe2, 0xb7, 0x8a, 0x6d, 0x5d, 0x54, 0x5f, 0x7d, 0xa9, 0xd2, 0xef, 0xfd, 0xff, 0xff, 0xfd, 0xe2, 0x95, 0x41,
+	0x08, 0x00, 0x03, 0x13, 0x68, 0xbd, 0xff, 0xff, 0xc3, 0x6e, 0x19, 0x00, 0x02, 0x45, 0x9a, 0xef, 0xff, 0xff, 0xfe, 0xb0, 0x5b, 0x07, 0x00, 0x16,
+	0x12, 0x67, 0xbc, 0xff, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x06, 0x15, 0x5d, 0xb2, 0xf2, 0xff, 0xff, 0xff, 0xf1, 0xcb, 0x8e, 0x4d, 0x1f, 0x08,
+	0x01, 0x00, 0x06, 0x01, 0x08, 0x20, 0x4f, 0x90, 0xcd, 0xf2, 0xff, 0xff, 0xfe, 0xe2, 0x95, 0x41, 0x08, 0x00, 0x09, 0x15, 0x5d, 0xb2, 0xf2, 0xff,
+	0xff, 0xff, 0xf1, 0xcb, 0x8e, 0x4d, 0x1f, 0x08, 0x01, 0x00, 0x06, 0x01, 0x08, 0x20, 0x4f, 0x90, 0xcd, 0xf2, 0xff, 0xff, 0xfe, 0xe2, 0x95, 0x41,
+	0x08, 0x00, 0x13, 0x15, 0x65, 0xba, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x95, 0x40, 0x03, 0x00, 0x1d, 0x15, 0x65, 0xba, 0xfa, 0xff, 0xff, 0xff,
+	0xff, 0xe6, 0x95, 0x40, 0x03, 0x00, 0x1d, 0x15, 0x65, 0xba, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x95, 0x40, 0x03, 0x00, 0x10, 0x3f, 0x94, 0xe9,
+	0xff, 0xff, 0xff, 0xb9, 0x64, 0x0f, 0x00, 0x25, 0x08, 0x2b, 0x59, 0x7d, 0x7c, 0x53, 0x27, 0x05, 0x00, 0x03, 0x01, 0x1f, 0x49, 0x77, 0x7e, 0x62,
+	0x33, 0x0e, 0x00, 0x18, 0x17, 0x5e, 0xb3, 0xf0, 0xff, 0xf9, 0xd7, 0x93, 0x44, 0x11, 0x00, 0x11, 0x16, 0x4e, 0x9f, 0xde, 0xfb, 0xff, 0xec, 0xa9,
+	0x54, 0x12, 0x00, 0x13, 0x08, 0x3b, 0x8f, 0xdc, 0xfe, 0xfe, 0xe9, 0xb4, 0x63, 0x23, 0x03, 0x00, 0x09, 0x03, 0x22, 0x63, 0xb5, 0xeb, 0xff, 0xf1,
+	0xc7, 0x8d, 0x7a, 0x9c, 0xd6, 0xf8, 0xfd, 0xde, 0x9f, 0x4c, 0x16, 0x00, 0x07, 0x01, 0x1a, 0x55, 0xa8, 0xe4, 0xfe, 0xf5, 0xd0, 0x96, 0x79, 0x93,
+	0xcd, 0xf4, 0xfe, 0xe6, 0xac, 0x5a, 0x1d, 0x02, 0x00, 0x0a, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xff, 0xfc, 0xc9, 0x76, 0x24, 0x02, 0x00, 0x07, 0x02,
+	0x11, 0x4c, 0x9f, 0xe5, 0xff, 0xff, 0xf8, 0xbe, 0x69, 0x1b, 0x00, 0x02, 0x13, 0x68, 0xbd, 0xff, 0xff, 0xc3, 0x6e, 0x19, 0x00, 0x01, 0x0b, 0x60,
+	0xb5, 0xff, 0xff, 0xff, 0xee, 0x99, 0x44, 0x00, 0x18, 0x51, 0xa6, 0xfb, 0xff, 0xff, 0xfb, 0xa7, 0x52, 0x01, 0x00, 0x03, 0x03, 0x33, 0x87, 0xd9,
+	0xfe, 0xff, 0xff, 0xde, 0x93, 0x3e, 0x0a, 0x00, 0x10, 0x0b, 0x44, 0x99, 0xe2, 0xff, 0xff, 0xf9, 0xc3, 0x6e, 0x1f, 0x00, 0x06, 0x03, 0x33, 0x87,
+	0xd9, 0xfe, 0xff, 0xff, 0xde, 0x93, 0x3e, 0x0a, 0x00, 0x10, 0x0b, 0x44, 0x99, 0xe2, 0xff, 0xff, 0xf9, 0xc3, 0x6e, 0x1f, 0x00, 0x11, 0x1a, 0x6d,
+	0xc2, 0xfc, 0xff, 0xdf, 0xd8, 0xd8, 0xf8, 0xff, 0xec, 0x9d, 0x48, 0x06, 0x00, 0x1b, 0x1a, 0x6d, 0xc2, 0xfc, 0xff, 0xdf, 0xd8, 0xd8, 0xf8, 0xff,
+	0xec, 0x9d, 0x48, 0x06, 0x00, 0x1b, 0x1a, 0x6d, 0xc2, 0xfc, 0xff, 0xdf, 0xd8, 0xd8, 0xf8, 0xff, 0xec, 0x9d, 0x48, 0x06, 0x00, 0x0e, 0x0a, 0x5f,
+	0xb4, 0xff, 0xff, 0xff, 0xf0, 0x9b, 0x46, 0x00, 0x4f, 0x12, 0x51, 0xa6, 0xe9, 0xf9, 0xdb, 0xa1, 0x54, 0x1d, 0x02, 0x00, 0x15, 0x04, 0x23, 0x5d,
+	0xa9, 0xdf, 0xfa, 0xe3, 0x9c, 0x47, 0x0d, 0x00, 0x0f, 0x04, 0x31, 0x82, 0xd3, 0xfa, 0xeb, 0xbe, 0x74, 0x32, 0x0a, 0x00, 0x0a, 0x10, 0x43, 0x93,
+	0xd8, 0xf5, 0xe2, 0xb3, 0x70, 0x33, 0x0d, 0x00, 0x02, 0x01, 0x16, 0x42, 0x84, 0xc2, 0xeb, 0xf2, 0xc9, 0x7c, 0x32, 0x08, 0x00, 0x02, 0x0a, 0x38,
+	0x84, 0xce, 0xf4, 0xe8, 0xbc, 0x7b, 0x3c, 0x12, 0x00, 0x03, 0x11, 0x39, 0x77, 0xb9, 0xe5, 0xf5, 0xd3, 0x8b, 0x3d, 0x0d, 0x00, 0x08, 0x3f, 0x94,
+	0xe9, 0xff, 0xff, 0xff, 0xc3, 0x6e, 0x19, 0x00, 0x0b, 0x08, 0x58, 0xad, 0xfa, 0xff, 0xff, 0xfe, 0xb3, 0x5e, 0x0a, 0x00, 0x01, 0x03, 0x13, 0x23,
+	0x30, 0x30, 0x24, 0x14, 0x04, 0x00, 0x02, 0x4c, 0xa1, 0xf5, 0xff, 0xff, 0xfb, 0xaa, 0x55, 0x03, 0x00, 0x16, 0x0c, 0x61, 0xb6, 0xff, 0xff, 0xff,
+	0xee, 0x99, 0x44, 0x00, 0x03, 0x07, 0x4f, 0xa4, 0xf2, 0xff, 0xff, 0xfb, 0xc6, 0x71, 0x20, 0x00, 0x14, 0x27, 0x7a, 0xcf, 0xfd, 0xff, 0xff, 0xe4,
+	0x8f, 0x3a, 0x00, 0x04, 0x07, 0x4f, 0xa4, 0xf2, 0xff, 0xff, 0xfb, 0xc6, 0x71, 0x20, 0x00, 0x14, 0x27, 0x7a, 0xcf, 0xfd, 0xff, 0xff, 0xe4, 0x8f,
+	0x3a, 0x00, 0x0f, 0x21, 0x75, 0xca, 0xfe, 0xff, 0xe7, 0x93, 0x51, 0x66, 0xb9, 0xfb, 0xff, 0xf1, 0xa6, 0x51, 0x0a, 0x00, 0x19, 0x21, 0x75, 0xca,
+	0xfe, 0xff, 0xe7, 0x93, 0x51, 0x66, 0xb9, 0xfb, 0xff, 0xf1, 0xa6, 0x51, 0x0a, 0x00, 0x19, 0x21, 0x75, 0xca, 0xfe, 0xff, 0xe7, 0x93, 0x51, 0x66,
+	0xb9, 0xfb, 0xff, 0xf1, 0xa6, 0x51, 0x0a, 0x00, 0x0e, 0x4c, 0xa1, 0xf5, 0xff, 0xff, 0xfc, 0xac, 0x57, 0x04, 0x00, 0x1d, 0x1b, 0x58, 0x95, 0xb7,
+	0xb7, 0xb7, 0x86, 0x49, 0x0c, 0x00, 0x11, 0x01, 0x3f, 0x7e, 0xbc, 0xbc, 0xbc, 0xa3, 0x64, 0x25, 0x00, 0x0e, 0x05, 0x0e, 0x17, 0x1b, 0x13, 0x0a,
+	0x01, 0x00, 0x1b, 0x02, 0x0b, 0x14, 0x1b, 0x16, 0x0d, 0x04, 0x00, 0x0f, 0x02, 0x0b, 0x14, 0x1b, 0x17, 0x0e, 0x05, 0x00, 0x0d, 0x06, 0x0f, 0x18,
+	0x1b, 0x13, 0x0a, 0x01, 0x00, 0x09, 0x04, 0x0d, 0x16, 0x1b, 0x15, 0x0c, 0x03, 0x00, 0x02, 0x04, 0x0d, 0x16, 0x1b, 0x15, 0x0c, 0x03, 0x00, 0x09,
+	0x02, 0x0b, 0x14, 0x1b, 0x17, 0x0e, 0x05, 0x00, 0x08, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xf7, 0xa3, 0x4e, 0x00, 0x0d, 0x24, 0x79, 0xce, 0xff, 0xff,
+	0xff, 0xd2, 0x7d, 0x28, 0x00, 0x0b, 0x2c, 0x81, 0xd6, 0xff, 0xff, 0xff, 0xc5, 0x70, 0x1b, 0x00, 0x16, 0x26, 0x7b, 0xd0, 0xff, 0xff, 0xff, 0xd4,
+	0x7f, 0x2a, 0x00, 0x03, 0x26, 0x7b, 0xd0, 0xff, 0xff, 0xff, 0xcc, 0x77, 0x22, 0x00, 0x16, 0x2d, 0x82, 0xd7, 0xff, 0xff, 0xff, 0xbd, 0x68, 0x13,
+	0x00, 0x03, 0x26, 0x7b, 0xd0, 0xff, 0xff, 0xff, 0xcc, 0x77, 0x22, 0x00, 0x16, 0x2d, 0x82, 0xd7, 0xff, 0xff, 0xff, 0xbd, 0x68, 0x13, 0x00, 0x0d,
+	0x28, 0x7d, 0xd2, 0xfe, 0xff, 0xe8, 0x96, 0x41, 0x03, 0x17, 0x68, 0xbd, 0xfb, 0xff, 0xf5, 0xaf, 0x5a, 0x0e, 0x00, 0x17, 0x28, 0x7d, 0xd2, 0xfe,
+	0xff, 0xe8, 0x96, 0x41, 0x03, 0x17, 0x68, 0xbd, 0xfb, 0xff, 0xf5, 0xaf, 0x5a, 0x0e, 0x00, 0x17, 0x28, 0x7d, 0xd2, 0xfe, 0xff, 0xe8, 0x96, 0x41,
+	0x03, 0x17, 0x68, 0xbd, 0xfb, 0xff, 0xf5, 0xaf, 0x5a, 0x0e, 0x00, 0x0d, 0x2d, 0x82, 0xd7, 0xff, 0xff, 0xff, 0xc9, 0x74, 0x1f, 0x00, 0x1d, 0x25,
+	0x7a, 0xcf, 0xff, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x11, 0x01, 0x56, 0xab, 0xff, 0xff, 0xff, 0xdd, 0x88, 0x33, 0x00, 0x01, 0x1c, 0x59, 0x96,
+	0xb7, 0xb7, 0xb7, 0x9f, 0x63, 0x26, 0x00, 0x10, 0x06, 0x39, 0x76, 0xad, 0xb7, 0xb7, 0xb0, 0x7d, 0x40, 0x09, 0x00, 0x01, 0x3c, 0x79, 0xb6, 0xb7,
+	0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb3, 0x76, 0x39, 0x00, 0x01, 0x3c,
+	0x79, 0xb6, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb3, 0x76, 0x39,
+	0x00, 0x01, 0x3c, 0x79, 0xb6, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7,
+	0xb3, 0x76, 0x39, 0x00, 0x03, 0x20, 0x5d, 0x9a, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0x97, 0x5a, 0x1d,
+	0x00, 0x0a, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xec, 0x97, 0x42, 0x00, 0x0d, 0x03, 0x55, 0xaa, 0xfc, 0xff, 0xff, 0xe8, 0x93, 0x3e, 0x00, 0x0b, 0x0d,
+	0x5f, 0xb4, 0xfc, 0xff, 0xff, 0xf2, 0xab, 0x56, 0x0e, 0x00, 0x14, 0x14, 0x61, 0xb6, 0xf7, 0xff, 0xff, 0xed, 0x9e, 0x49, 0x06, 0x00, 0x03, 0x45,
+	0x9a, 0xef, 0xff, 0xff, 0xfe, 0xb0, 0x5b, 0x07, 0x00, 0x16, 0x12, 0x67, 0xbc, 0xff, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x03, 0x45, 0x9a, 0xef,
+	0xff, 0xff, 0xfe, 0xb0, 0x5b, 0x07, 0x00, 0x16, 0x12, 0x67, 0xbc, 0xff, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x0c, 0x31, 0x86, 0xda, 0xff, 0xff,
+	0xe6, 0x94, 0x3f, 0x02, 0x00, 0x02, 0x14, 0x64, 0xb9, 0xfa, 0xff, 0xf9, 0xb7, 0x62, 0x13, 0x00, 0x15, 0x31, 0x86, 0xda, 0xff, 0xff, 0xe6, 0x94,
+	0x3f, 0x02, 0x00, 0x02, 0x14, 0x64, 0xb9, 0xfa, 0xff, 0xf9, 0xb7, 0x62, 0x13, 0x00, 0x15, 0x31, 0x86, 0xda, 0xff, 0xff, 0xe6, 0x94, 0x3f, 0x02,
+	0x00, 0x02, 0x14, 0x64, 0xb9, 0xfa, 0xff, 0xf9, 0xb7, 0x62, 0x13, 0x00, 0x0c, 0x0d, 0x5f, 0xb4, 0xfc, 0xff, 0xff, 0xf4, 0xb2, 0x5d, 0x13, 0x00,
+	0x1c, 0x25, 0x7a, 0xcf, 0xff, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x11, 0x01, 0x56, 0xab, 0xff, 0xff, 0xff, 0xdd, 0x88, 0x33, 0x00, 0x02, 0x19,
+	0x65, 0xba, 0xf6, 0xff, 0xff, 0xe6, 0x98, 0x43, 0x07, 0x00, 0x0d, 0x15, 0x60, 0xb5, 0xf5, 0xff, 0xff, 0xe3, 0x95, 0x40, 0x07, 0x00, 0x02, 0x54,
+	0xa9, 0xfe, 0xff, 0xff, 0xfd, 0xf7, 0xf1, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe8, 0x99, 0x4a,
+	0x00, 0x01, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xfd, 0xf7, 0xf1, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+	0xe8, 0x99, 0x4a, 0x00, 0x01, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xfd, 0xf7, 0xf1, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+	0xee, 0xee, 0xee, 0xe8, 0x99, 0x4a, 0x00, 0x03, 0x0e, 0x2f, 0x57, 0x77, 0x8c, 0xa7, 0xce, 0xed, 0xff, 0xff, 0xff, 0xec, 0xcc, 0xa5, 0x8b, 0x77,
+	0x56, 0x2e, 0x0d, 0x00, 0x0a, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xfb, 0xa8, 0x53, 0x01, 0x00, 0x0c, 0x2a, 0x7f, 0xd4, 0xff, 0xff, 0xff, 0xd0, 0x7b,
+	0x26, 0x00, 0x0c, 0x0d, 0x4f, 0xa4, 0xec, 0xff, 0xff, 0xfb, 0xc2, 0x6d, 0x1c, 0x00, 0x12, 0x24, 0x77, 0xcc, 0xfd, 0xff, 0xff, 0xea, 0x99, 0x44,
+	0x04, 0x00, 0x03, 0x0b, 0x60, 0xb5, 0xff, 0xff, 0xff, 0xee, 0x99, 0x44, 0x00, 0x18, 0x51, 0xa6, 0xfb, 0xff, 0xff, 0xfb, 0xa7, 0x52, 0x01, 0x00,
+	0x01, 0x0b, 0x60, 0xb5, 0xff, 0xff, 0xff, 0xee, 0x99, 0x44, 0x00, 0x18, 0x51, 0xa6, 0xfb, 0xff, 0xff, 0xfb, 0xa7, 0x52, 0x01, 0x00, 0x09, 0x02,
+	0x39, 0x8e, 0xe1, 0xff, 0xff, 0xe5, 0x92, 0x3d, 0x02, 0x00, 0x04, 0x11, 0x60, 0xb5, 0xf9, 0xff, 0xfb, 0xbf, 0x6a, 0x19, 0x00, 0x12, 0x02, 0x39,
+	0x8e, 0xe1, 0xff, 0xff, 0xe5, 0x92, 0x3d, 0x02, 0x00, 0x04, 0x11, 0x60, 0xb5, 0xf9, 0xff, 0xfb, 0xbf, 0x6a, 0x19, 0x00, 0x12, 0x02, 0x39, 0x8e,
+	0xe1, 0xff, 0xff, 0xe5, 0x92, 0x3d, 0x02, 0x00, 0x04, 0x11, 0x60, 0xb5, 0xf9, 0xff, 0xfb, 0xbf, 0x6a, 0x19, 0x00, 0x0c, 0x0d, 0x4f, 0xa4, 0xec,
+	0xff, 0xff, 0xfe, 0xd5, 0x82, 0x2e, 0x02, 0x00, 0x1a, 0x25, 0x7a, 0xcf, 0xff, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x11, 0x01, 0x56, 0xab, 0xff,
+	0xff, 0xff, 0xdd, 0x88, 0x33, 0x00, 0x03, 0x06, 0x3c, 0x91, 0xe0, 0xff, 0xff, 0xf6, 0xb7, 0x62, 0x16, 0x00, 0x0a, 0x01, 0x2c, 0x80, 0xd4, 0xfe,
+	0xff, 0xf8, 0xc0, 0x6b, 0x1d, 0x00, 0x04, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x12, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a,
+	0x35, 0x00, 0x12, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x19, 0x1c, 0x71, 0xc6, 0xff, 0xff, 0xff, 0xc2, 0x6d, 0x18, 0x00, 0x0f,
+	0x3f, 0x94, 0xe9, 0xff, 0xff, 0xff, 0xcd, 0x78, 0x23, 0x00, 0x0b, 0x0c, 0x5f, 0xb4, 0xfc, 0xff, 0xff, 0xfd, 0xb1, 0x5c, 0x08, 0x00, 0x0d, 0x01,
+	0x2a, 0x7d, 0xd1, 0xfd, 0xff, 0xff, 0xf2, 0xcc, 0x8f, 0x49, 0x1a, 0x02, 0x00, 0x0a, 0x04, 0x1e, 0x51, 0x98, 0xd2, 0xf5, 0xff, 0xff, 0xf2, 0xc0,
+	0x6d, 0x25, 0x02, 0x00, 0x05, 0x4c, 0xa1, 0xf5, 0xff, 0xff, 0xfb, 0xaa, 0x55, 0x03, 0x00, 0x16, 0x0c, 0x61, 0xb6, 0xff, 0xff, 0xff, 0xe7, 0x92,
+	0x3d, 0x00, 0x03, 0x4c, 0xa1, 0xf5, 0xff, 0xff, 0xfb, 0xaa, 0x55, 0x03, 0x00, 0x16, 0x0c, 0x61, 0xb6, 0xff, 0xff, 0xff, 0xe7, 0x92, 0x3d, 0x00,
+	0x09, 0x04, 0x41, 0x96, 0xe7, 0xff, 0xff, 0xe3, 0x90, 0x3b, 0x01, 0x00, 0x06, 0x0f, 0x5c, 0xb1, 0xf7, 0xff, 0xfd, 0xc8, 0x73, 0x1f, 0x00, 0x10,
+	0x04, 0x41, 0x96, 0xe7, 0xff, 0xff, 0xe3, 0x90, 0x3b, 0x01, 0x00, 0x06, 0x0f, 0x5c, 0xb1, 0xf7, 0xff, 0xfd, 0xc8, 0x73, 0x1f, 0x00, 0x10, 0x04,
+	0x41, 0x96, 0xe7, 0xff, 0xff, 0xe3, 0x90, 0x3b, 0x01, 0x00, 0x06, 0x0f, 0x5c, 0xb1, 0xf7, 0xff, 0xfd, 0xc8, 0x73, 0x1f, 0x00, 0x0c, 0x01, 0x2a,
+	0x7d, 0xd1, 0xfd, 0xff, 0xff, 0xf8, 0xdc, 0xa9, 0x68, 0x2f, 0x0c, 0x00, 0x17, 0x25, 0x7a, 0xcf, 0xff, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x11,
+	0x01, 0x56, 0xab, 0xff, 0xff, 0xff, 0xdd, 0x88, 0x33, 0x00, 0x05, 0x1b, 0x68, 0xbd, 0xf7, 0xff, 0xfe, 0xd5, 0x81, 0x2d, 0x01, 0x00, 0x07, 0x0a,
+	0x4c, 0xa1, 0xeb, 0xff, 0xff, 0xe3, 0x96, 0x41, 0x07, 0x00, 0x05, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x12, 0x54, 0xa9, 0xfe,
+	0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x12, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x19, 0x1c, 0x71, 0xc6, 0xff, 0xff, 0xff, 0xc2,
+	0x6d, 0x18, 0x00, 0x0f, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xff, 0xfe, 0xd5, 0x89, 0x34, 0x09, 0x00, 0x07, 0x08, 0x21, 0x62, 0xae, 0xeb, 0xff, 0xff,
+	0xf5, 0xb5, 0x60, 0x15, 0x00, 0x02, 0x12, 0x5f, 0xac, 0xe8, 0xe8, 0xb1, 0x64, 0x17, 0x00, 0x06, 0x0a, 0x2b, 0x63, 0xa5, 0xd9, 0xf7, 0xff, 0xff,
+	0xfb, 0xeb, 0xd5, 0xbd, 0xab, 0x9a, 0x89, 0x7e, 0x7f, 0x8b, 0x9c, 0xad, 0xbf, 0xd8, 0xed, 0xfc, 0xff, 0xff, 0xf8, 0xdf, 0xa3, 0x55, 0x19, 0x00,
+	0x08, 0x2c, 0x81, 0xd6, 0xff, 0xff, 0xff, 0xc5, 0x70, 0x1b, 0x00, 0x16, 0x26, 0x7b, 0xd0, 0xff, 0xff, 0xff, 0xc5, 0x70, 0x1b, 0x00, 0x03, 0x2c,
+	0x81, 0xd6, 0xff, 0xff, 0xff, 0xc5, 0x70, 0x1b, 0x00, 0x16, 0x26, 0x7b, 0xd0, 0xff, 0xff, 0xff, 0xc5, 0x70, 0x1b, 0x00, 0x08, 0x06, 0x49, 0x9e,
+	0xed, 0xff, 0xff, 0xef, 0xae, 0x6c, 0x39, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x45, 0x85, 0xc7, 0xfc, 0xff, 0xfe, 0xd0, 0x7b, 0x27,
+	0x00, 0x0e, 0x06, 0x49, 0x9e, 0xed, 0xff, 0xff, 0xef, 0xae, 0x6c, 0x39, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x45, 0x85, 0xc7, 0xfc,
+	0xff, 0xfe, 0xd0, 0x7b, 0x27, 0x00, 0x0e, 0x06, 0x49, 0x9e, 0xed, 0xff, 0xff, 0xef, 0xae, 0x6c, 0x39, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x45, 0x85, 0xc7, 0xfc, 0xff, 0xfe, 0xd0, 0x7b, 0x27, 0x00, 0x0d, 0x0a, 0x2b, 0x62, 0xa5, 0xd8, 0xf6, 0xff, 0xff, 0xff, 0xf6, 0xe4, 0xcc,
+	0xb8, 0xa8, 0x97, 0x87, 0x7b, 0x78, 0x7d, 0x85, 0x8e, 0x99, 0xa8, 0xbc, 0xd2, 0xd8, 0x92, 0x45, 0x00, 0x06, 0x25, 0x7a, 0xcf, 0xff, 0xff, 0xff,
+	0xbb, 0x66, 0x11, 0x00, 0x11, 0x01, 0x56, 0xab, 0xff, 0xff, 0xff, 0xdd, 0x88, 0x33, 0x00, 0x06, 0x07, 0x3f, 0x94, 0xe2, 0xff, 0xff, 0xeb, 0xa0,
+	0x4b, 0x0a, 0x00, 0x05, 0x1c, 0x6c, 0xc1, 0xf9, 0xff, 0xf8, 0xc0, 0x6b, 0x1d, 0x00, 0x07, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00,
+	0x12, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x12, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x19, 0x1c, 0x71, 0xc6,
+	0xff, 0xff, 0xff, 0xc2, 0x6d, 0x18, 0x00, 0x0f, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xed, 0xe3, 0xe3, 0xf4, 0xed, 0xc9, 0x9f, 0x80, 0x6f, 0x64, 0x6d,
+	0x8c, 0xbb, 0xe1, 0xf8, 0xff, 0xff, 0xff, 0xfb, 0xda, 0x8a, 0x39, 0x05, 0x00, 0x03, 0x13, 0x68, 0xbd, 0xff, 0xff, 0xc3, 0x6e, 0x19, 0x00, 0x0a,
+	0x0e, 0x32, 0x69, 0x98, 0xb8, 0xc9, 0xda, 0xea, 0xf6, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xd6, 0x9f, 0x5a, 0x2a, 0x0c,
+	0x00, 0x0b, 0x0d, 0x5f, 0xb4, 0xfc, 0xff, 0xff, 0xf2, 0xab, 0x56, 0x0e, 0x00, 0x14, 0x14, 0x61, 0xb6, 0xf7, 0xff, 0xff, 0xf3, 0x9f, 0x4a, 0x01,
+	0x00, 0x03, 0x0d, 0x5f, 0xb4, 0xfc, 0xff, 0xff, 0xf2, 0xab, 0x56, 0x0e, 0x00, 0x14, 0x14, 0x61, 0xb6, 0xf7, 0xff, 0xff, 0xf3, 0x9f, 0x4a, 0x01,
+	0x00, 0x07, 0x0a, 0x52, 0xa7, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xd8, 0x84, 0x2f, 0x00, 0x0c, 0x0a, 0x52, 0xa7, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0x84, 0x2f, 0x00, 0x0c, 0x0a, 0x52, 0xa7, 0xf1, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0x84, 0x2f, 0x00, 0x10, 0x0e,
+	0x31, 0x68, 0x98, 0xb7, 0xc9, 0xd9, 0xe9, 0xf5, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xef, 0xdb, 0xb8, 0x6e, 0x2e, 0x00,
+	0x06, 0x25, 0x7a, 0xcf, 0xff, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x11, 0x01, 0x56, 0xab, 0xff, 0xff, 0xff, 0xdd, 0x88, 0x33, 0x00, 0x08, 0x1d,
+	0x6c, 0xc1, 0xf8, 0xff, 0xf9, 0xbf, 0x6a, 0x1b, 0x00, 0x02, 0x03, 0x37, 0x8c, 0xde, 0xff, 0xff, 0xe3, 0x96, 0x41, 0x07, 0x00, 0x08, 0x54, 0xa9,
+	0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x12, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x12, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf,
+	0x8a, 0x35, 0x00, 0x19, 0x1c, 0x71, 0xc6, 0xff, 0xff, 0xff, 0xc2, 0x6d, 0x18, 0x00, 0x0f, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xde, 0x8a, 0x4b, 0x41,
+	0x7f, 0xb4, 0xdc, 0xf3, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf4, 0xe3, 0xbd, 0x86, 0x45, 0x17, 0x02, 0x00, 0x05, 0x13, 0x68, 0xbd, 0xff, 0xff,
+	0xc3, 0x6e, 0x19, 0x00, 0x12, 0x04, 0x0d, 0x1c, 0x28, 0x2e, 0x3b, 0x71, 0xb7, 0xf1, 0xff, 0xff, 0xef, 0xb5, 0x60, 0x1b, 0x00, 0x0d, 0x0d, 0x4f,
+	0xa4, 0xec, 0xff, 0xff, 0xfb, 0xc2, 0x6d, 0x1c, 0x00, 0x12, 0x24, 0x77, 0xcc, 0xfd, 0xff, 0xfe, 0xdd, 0x8c, 0x38, 0x04, 0x00, 0x05, 0x0d, 0x4f,
+	0xa4, 0xec, 0xff, 0xff, 0xfb, 0xc2, 0x6d, 0x1c, 0x00, 0x12, 0x24, 0x77, 0xcc, 0xfd, 0xff, 0xfe, 0xdd, 0x8c, 0x38, 0x04, 0x00, 0x07, 0x0e, 0x5a,
+	0xaf, 0xf5, 0xff, 0xff, 0xdc, 0xac, 0x7d, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x90, 0xbf, 0xef,
+	0xff, 0xff, 0xe0, 0x8c, 0x37, 0x01, 0x00, 0x09, 0x0e, 0x5a, 0xaf, 0xf5, 0xff, 0xff, 0xdc, 0xac, 0x7d, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
+	0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x90, 0xbf, 0xef, 0xff, 0xff, 0xe0, 0x8c, 0x37, 0x01, 0x00, 0x09, 0x0e, 0x5a, 0xaf, 0xf5, 0xff, 0xff,
+	0xdc, 0xac, 0x7d, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x90, 0xbf, 0xef, 0xff, 0xff, 0xe0, 0x8c,
+	0x37, 0x01, 0x00, 0x15, 0x0b, 0x4d, 0xa2, 0xec, 0xf6, 0xba, 0x74, 0x35, 0x27, 0x1e, 0x13, 0x08, 0x02, 0x00, 0x0a, 0x25, 0x7a, 0xcf, 0xff, 0xff,
+	0xff, 0xbb, 0x66, 0x11, 0x00, 0x11, 0x01, 0x56, 0xab, 0xff, 0xff, 0xff, 0xdd, 0x88, 0x33, 0x00, 0x09, 0x08, 0x43, 0x98, 0xe5, 0xff, 0xff, 0xdb,
+	0x89, 0x34, 0x13, 0x58, 0xad, 0xf1, 0xff, 0xf8, 0xc1, 0x6c, 0x1d, 0x00, 0x0a, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xef, 0xc6, 0x9d, 0x84, 0x84, 0x84,
+	0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x7a, 0x4e, 0x22, 0x00, 0x02, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xef, 0xc6, 0x9d, 0x84,
+	0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x7a, 0x4e, 0x22, 0x00, 0x02, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xef, 0xc6,
+	0x9d, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x7a, 0x4e, 0x22, 0x00, 0x09, 0x1c, 0x71, 0xc6, 0xff, 0xff,
+	0xff, 0xc2, 0x6d, 0x18, 0x00, 0x0f, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xe9, 0x94, 0x3f, 0x00, 0x03, 0x01, 0x09, 0x14, 0x21, 0x29, 0x27, 0x1c, 0x0d,
+	0x03, 0x00, 0x0b, 0x13, 0x68, 0xbd, 0xff, 0xff, 0xc3, 0x6e, 0x19, 0x00, 0x18, 0x01, 0x23, 0x70, 0xc3, 0xf6, 0xff, 0xff, 0xef, 0xbf, 0x77, 0x32,
+	0x0d, 0x00, 0x0b, 0x01, 0x2a, 0x7d, 0xd1, 0xfd, 0xff, 0xff, 0xf2, 0xcc, 0x8f, 0x49, 0x1a, 0x02, 0x00, 0x0a, 0x04, 0x1e, 0x51, 0x98, 0xd2, 0xf5,
+	0xff, 0xff, 0xf4, 0xb6, 0x61, 0x16, 0x00, 0x08, 0x01, 0x2a, 0x7d, 0xd1, 0xfd, 0xff, 0xff, 0xf2, 0xcc, 0x8f, 0x49, 0x1a, 0x02, 0x00, 0x0a, 0x04,
+	0x1e, 0x51, 0x98, 0xd2, 0xf5, 0xff, 0xff, 0xf4, 0xb6, 0x61, 0x16, 0x00, 0x08, 0x13, 0x62, 0xb7, 0xf9, 0xff, 0xfe, 0xcf, 0x7a, 0x25, 0x00, 0x0f,
+	0x05, 0x48, 0x9d, 0xec, 0xff, 0xff, 0xe6, 0x95, 0x40, 0x03, 0x00, 0x07, 0x13, 0x62, 0xb7, 0xf9, 0xff, 0xfe, 0xcf, 0x7a, 0x25, 0x00, 0x0f, 0x05,
+	0x48, 0x9d, 0xec, 0xff, 0xff, 0xe6, 0x95, 0x40, 0x03, 0x00, 0x07, 0x13, 0x62, 0xb7, 0xf9, 0xff, 0xfe, 0xcf, 0x7a, 0x25, 0x00, 0x0f, 0x05, 0x48,
+	0x9d, 0xec, 0xff, 0xff, 0xe6, 0x95, 0x40, 0x03, 0x00, 0x13, 0x15, 0x5d, 0xb1, 0xf1, 0xfc, 0xea, 0xcc, 0x9f, 0x6c, 0x35, 0x0e, 0x00, 0x0d, 0x25,
+	0x7a, 0xcf, 0xff, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x11, 0x01, 0x56, 0xab, 0xff, 0xff, 0xff, 0xdd, 0x88, 0x33, 0x00, 0x0b, 0x1f, 0x6f, 0xc4,
+	0xf9, 0xff, 0xef, 0xc4, 0xc2, 0xd1, 0xfc, 0xff, 0xe4, 0x96, 0x41, 0x07, 0x00, 0x0b, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0x97, 0x42, 0x00, 0x02, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0x97, 0x42, 0x00, 0x02, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0x97, 0x42, 0x00, 0x09, 0x1c, 0x71, 0xc6, 0xff,
+	0xff, 0xff, 0xc2, 0x6d, 0x18, 0x00, 0x0f, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x17, 0x13, 0x68, 0xbd, 0xff, 0xff, 0xc3, 0x6e,
+	0x19, 0x00, 0x1a, 0x04, 0x2a, 0x6c, 0xbc, 0xeb, 0xfe, 0xff, 0xff, 0xf5, 0xd4, 0x90, 0x45, 0x11, 0x00, 0x0a, 0x0a, 0x2b, 0x63, 0xa5, 0xd9, 0xf7,
+	0xff, 0xff, 0xfb, 0xeb, 0xd5, 0xbd, 0xab, 0x9a, 0x89, 0x7e, 0x7f, 0x8b, 0x9c, 0xad, 0xbf, 0xd8, 0xed, 0xfc, 0xff, 0xfe, 0xee, 0xc8, 0x8d, 0x4c,
+	0x1c, 0x03, 0x00, 0x0b, 0x0a, 0x2b, 0x63, 0xa5, 0xd9, 0xf7, 0xff, 0xff, 0xfb, 0xeb, 0xd5, 0xbd, 0xab, 0x9a, 0x89, 0x7e, 0x7f, 0x8b, 0x9c, 0xad,
+	0xbf, 0xd8, 0xed, 0xfc, 0xff, 0xfe, 0xee, 0xc8, 0x8d, 0x4c, 0x1c, 0x03, 0x00, 0x08, 0x19, 0x6a, 0xbf, 0xfb, 0xff, 0xfd, 0xc8, 0x73, 0x1f, 0x00,
+	0x11, 0x04, 0x43, 0x98, 0xe9, 0xff, 0xff, 0xec, 0x9d, 0x48, 0x06, 0x00, 0x05, 0x19, 0x6a, 0xbf, 0xfb, 0xff, 0xfd, 0xc8, 0x73, 0x1f, 0x00, 0x11,
+	0x04, 0x43, 0x98, 0xe9, 0xff, 0xff, 0xec, 0x9d, 0x48, 0x06, 0x00, 0x05, 0x19, 0x6a, 0xbf, 0xfb, 0xff, 0xfd, 0xc8, 0x73, 0x1f, 0x00, 0x11, 0x04,
+	0x43, 0x98, 0xe9, 0xff, 0xff, 0xec, 0x9d, 0x48, 0x06, 0x00, 0x14, 0x01, 0x0c, 0x2b, 0x76, 0xbf, 0xf6, 0xfe, 0xcc, 0x77, 0x22, 0x00, 0x0c, 0x24,
+	0x79, 0xce, 0xff, 0xff, 0xff, 0xbc, 0x67, 0x12, 0x00, 0x11, 0x02, 0x57, 0xac, 0xff, 0xff, 0xff, 0xdc, 0x87, 0x32, 0x00, 0x0c, 0x09, 0x46, 0x9b,
+	0xe7, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xc1, 0x6c, 0x1d, 0x00, 0x0d, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xe3, 0x97, 0x4c, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d,
+	0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1b, 0x11, 0x07, 0x00, 0x02, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xe3, 0x97, 0x4c, 0x1d, 0x1d, 0x1d,
+	0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1b, 0x11, 0x07, 0x00, 0x02, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xe3, 0x97, 0x4c, 0x1d,
+	0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1b, 0x11, 0x07, 0x00, 0x09, 0x1c, 0x71, 0xc6, 0xff, 0xff, 0xff, 0xc2,
+	0x6d, 0x18, 0x00, 0x0f, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x17, 0x13, 0x68, 0xbd, 0xff, 0xff, 0xc3, 0x6e, 0x19, 0x00, 0x1d,
+	0x07, 0x27, 0x60, 0xaa, 0xdc, 0xd8, 0x9b, 0x4a, 0x14, 0x00, 0x0f, 0x0e, 0x32, 0x69, 0x98, 0xb8, 0xc9, 0xda, 0xea, 0xf6, 0xfd, 0xff, 0xff, 0xff,
+	0xff, 0xfc, 0xf4, 0xe6, 0xd5, 0xc4, 0xae, 0x88, 0x53, 0x22, 0x06, 0x00, 0x13, 0x0e, 0x32, 0x69, 0x98, 0xb8, 0xc9, 0xda, 0xea, 0xf6, 0xfd, 0xff,
+	0xff, 0xff, 0xff, 0xfc, 0xf4, 0xe6, 0xd5, 0xc4, 0xae, 0x88, 0x53, 0x22, 0x06, 0x00, 0x0b, 0x1f, 0x73, 0xc8, 0xfd, 0xff, 0xfc, 0xc2, 0x6d, 0x1b,
+	0x00, 0x13, 0x02, 0x3d, 0x92, 0xe5, 0xff, 0xff, 0xf1, 0xa5, 0x50, 0x09, 0x00, 0x03, 0x1f, 0x73, 0xc8, 0xfd, 0xff, 0xfc, 0xc2, 0x6d, 0x1b, 0x00,
+	0x13, 0x02, 0x3d, 0x92, 0xe5, 0xff, 0xff, 0xf1, 0xa5, 0x50, 0x09, 0x00, 0x03, 0x1f, 0x73, 0xc8, 0xfd, 0xff, 0xfc, 0xc2, 0x6d, 0x1b, 0x00, 0x13,
+	0x02, 0x3d, 0x92, 0xe5, 0xff, 0xff, 0xf1, 0xa5, 0x50, 0x09, 0x00, 0x0f, 0x0a, 0x1a, 0x28, 0x2f, 0x37, 0x45, 0x64, 0xa1, 0xda, 0xfd, 0xe6, 0x99,
+	0x44, 0x07, 0x00, 0x0c, 0x0a, 0x5e, 0xb3, 0xfd, 0xff, 0xff, 0xeb, 0x99, 0x44, 0x03, 0x00, 0x10, 0x19, 0x6e, 0xc3, 0xff, 0xff, 0xff, 0xc1, 0x6c,
+	0x17, 0x00, 0x0e, 0x36, 0x8b, 0xdf, 0xff, 0xff, 0xff, 0xb8, 0x63, 0x0e, 0x00, 0x0e, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x12,
+	0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x12, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x19, 0x1c, 0x71, 0xc6, 0xff,
+	0xff, 0xff, 0xc2, 0x6d, 0x18, 0x00, 0x0f, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x17, 0x13, 0x68, 0xbd, 0xff, 0xff, 0xc3, 0x6e,
+	0x19, 0x00, 0x20, 0x02, 0x07, 0x07, 0x04, 0x00, 0x19, 0x04, 0x0d, 0x1c, 0x26, 0x25, 0x19, 0x0b, 0x03, 0x00, 0x23, 0x04, 0x0d, 0x1c, 0x26, 0x25,
+	0x19, 0x0b, 0x03, 0x00, 0x12, 0x26, 0x7b, 0xd0, 0xfe, 0xff, 0xfb, 0xbc, 0x67, 0x16, 0x00, 0x15, 0x01, 0x39, 0x8e, 0xe1, 0xff, 0xff, 0xf5, 0xae,
+	0x59, 0x0e, 0x00, 0x01, 0x26, 0x7b, 0xd0, 0xfe, 0xff, 0xfb, 0xbc, 0x67, 0x16, 0x00, 0x15, 0x01, 0x39, 0x8e, 0xe1, 0xff, 0xff, 0xf5, 0xae, 0x59,
+	0x0e, 0x00, 0x01, 0x26, 0x7b, 0xd0, 0xfe, 0xff, 0xfb, 0xbc, 0x67, 0x16, 0x00, 0x15, 0x01, 0x39, 0x8e, 0xe1, 0xff, 0xff, 0xf5, 0xae, 0x59, 0x0e,
+	0x00, 0x0e, 0x2d, 0x7b, 0xcb, 0xeb, 0xe2, 0xd1, 0xbc, 0xa7, 0x92, 0x77, 0x47, 0x1d, 0x00, 0x0f, 0x37, 0x8c, 0xe1, 0xff, 0xff, 0xff, 0xe8, 0x95,
+	0x40, 0x02, 0x00, 0x0e, 0x0c, 0x51, 0xa6, 0xef, 0xff, 0xff, 0xee, 0x99, 0x44, 0x00, 0x0f, 0x2d, 0x82, 0xd7, 0xff, 0xff, 0xff, 0xb4, 0x5f, 0x0a,
+	0x00, 0x0e, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x12, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x12, 0x54, 0xa9,
+	0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x19, 0x1c, 0x71, 0xc6, 0xff, 0xff, 0xff, 0xc2, 0x6d, 0x18, 0x00, 0x0f, 0x3c, 0x8d, 0xde, 0xf3, 0xf3,
+	0xdf, 0x8e, 0x3d, 0x00, 0x17, 0x12, 0x63, 0xb4, 0xf3, 0xf3, 0xba, 0x69, 0x18, 0x00, 0xff, 0x00, 0x26, 0x04, 0x30, 0x82, 0xd3, 0xfc, 0xff, 0xff,
+	0xe6, 0xad, 0x69, 0x33, 0x17, 0x06, 0x00, 0x08, 0x02, 0x16, 0x42, 0x92, 0xd3, 0xfc, 0xff, 0xfd, 0xd8, 0x89, 0x36, 0x06, 0x00, 0x0f, 0x2d, 0x82,
+	0xd7, 0xff, 0xff, 0xff, 0xb4, 0x5f, 0x0a, 0x00, 0x0e, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x12, 0x54, 0xa9, 0xfe, 0xff, 0xff,
+	0xdf, 0x8a, 0x35, 0x00, 0x12, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x19, 0x1c, 0x71, 0xc6, 0xff, 0xff, 0xff, 0xc2, 0x6d, 0x18,
+	0x00, 0x37, 0x02, 0x12, 0x23, 0x32, 0x32, 0x32, 0x32, 0x2c, 0x1b, 0x0a, 0x00, 0x15, 0x02, 0x13, 0x23, 0x32, 0x32, 0x32, 0x32, 0x2c, 0x1b, 0x0a,
+	0x00, 0x0b, 0x02, 0x19, 0x3c, 0x63, 0x7a, 0x7f, 0x77, 0x60, 0x40, 0x1f, 0x08, 0x00, 0x04, 0x01, 0x29, 0x5a, 0x89, 0x7a, 0x49, 0x19, 0x00, 0x14,
+	0x17, 0x39, 0x5d, 0x60, 0x45, 0x21, 0x06, 0x00, 0x04, 0x0f, 0x2d, 0x53, 0x67, 0x59, 0x32, 0x10, 0x00, 0x1d, 0x01, 0x06, 0x09, 0x08, 0x03, 0x00,
+	0x1b, 0x02, 0x18, 0x3b, 0x62, 0x79, 0x7e, 0x77, 0x60, 0x41, 0x20, 0x09, 0x00, 0x04, 0x01, 0x28, 0x59, 0x88, 0x7b, 0x4a, 0x1a, 0x00, 0x0d, 0x03,
+	0x15, 0x37, 0x5b, 0x73, 0x80, 0x8c, 0x98, 0xa1, 0xa7, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9,
+	0x71, 0x38, 0x00, 0x05, 0x07, 0x21, 0x46, 0x60, 0x5c, 0x38, 0x17, 0x00, 0x05, 0x17, 0x39, 0x5f, 0x66, 0x4c, 0x26, 0x08, 0x00, 0x0f, 0x01, 0x0e,
+	0x27, 0x4d, 0x6f, 0x89, 0x98, 0xa3, 0x85, 0x4f, 0x15, 0x00, 0x09, 0x0a, 0x3f, 0x8c, 0xd7, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xec, 0xd4, 0xb5,
+	0x96, 0x83, 0x80, 0x8b, 0x9a, 0xac, 0xcb, 0xe7, 0xfc, 0xff, 0xff, 0xf6, 0xd7, 0x8f, 0x43, 0x0d, 0x00, 0x11, 0x2d, 0x82, 0xd7, 0xff, 0xff, 0xff,
+	0xb4, 0x5f, 0x0a, 0x00, 0x0e, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x12, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00,
+	0x12, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x19, 0x1c, 0x71, 0xc6, 0xff, 0xff, 0xff, 0xc2, 0x6d, 0x18, 0x00, 0x08, 0x1b, 0x55,
+	0x8b, 0xa2, 0x97, 0x86, 0x6b, 0x47, 0x23, 0x0b, 0x00, 0x0e, 0x07, 0x22, 0x46, 0x61, 0x5c, 0x38, 0x17, 0x00, 0x04, 0x01, 0x18, 0x3a, 0x5f, 0x66,
+	0x4c, 0x26, 0x08, 0x00, 0x05, 0x1b, 0x5d, 0xb2, 0xec, 0xff, 0xff, 0xfd, 0xd4, 0x82, 0x2f, 0x03, 0x00, 0x12, 0x12, 0x58, 0xad, 0xf0, 0xff, 0xff,
+	0xf9, 0xd2, 0x86, 0x37, 0x08, 0x00, 0x09, 0x04, 0x34, 0x85, 0xd6, 0xfb, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xf9, 0xe4, 0xc2, 0x9d, 0x83, 0x82,
+	0x9d, 0xcb, 0xef, 0xf1, 0xa4, 0x4f, 0x08, 0x00, 0x13, 0x27, 0x7c, 0xd1, 0xff, 0xff, 0xee, 0x9a, 0x45, 0x00, 0x03, 0x0d, 0x60, 0xb5, 0xfd, 0xff,
+	0xfe, 0xba, 0x65, 0x11, 0x00, 0x17, 0x01, 0x1e, 0x55, 0x9c, 0xd0, 0xee, 0xf9, 0xfd, 0xfb, 0xf5, 0xdd, 0xb5, 0x72, 0x35, 0x0a, 0x00, 0x14, 0x03,
+	0x33, 0x84, 0xd6, 0xfb, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xf9, 0xe5, 0xc3, 0x9d, 0x84, 0x82, 0x9c, 0xca, 0xee, 0xf1, 0xa5, 0x50, 0x09, 0x00,
+	0x0a, 0x10, 0x44, 0x8a, 0xce, 0xee, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xf5, 0xef, 0xef, 0xef,
+	0xef, 0xf2, 0xf7, 0xfd, 0xff, 0xaa, 0x55, 0x00, 0x05, 0x43, 0x98, 0xec, 0xff, 0xff, 0xd3, 0x7e, 0x29, 0x00, 0x03, 0x27, 0x7c, 0xd1, 0xff, 0xff,
+	0xf3, 0x9e, 0x49, 0x00, 0x0d, 0x0c, 0x3b, 0x8a, 0xd3, 0xf9, 0xff, 0xff, 0xfb, 0xee, 0xde, 0xa5, 0x5d, 0x18, 0x00, 0x0c, 0x0b, 0x29, 0x5a, 0x92,
+	0xbd, 0xdb, 0xec, 0xf7, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf4, 0xe7, 0xd6, 0xba, 0x8f, 0x58, 0x27, 0x0a, 0x00, 0x14, 0x2d, 0x82, 0xd7,
+	0xff, 0xff, 0xff, 0xb4, 0x5f, 0x0a, 0x00, 0x0e, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xf4, 0xd6, 0xb8, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6,
+	0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa2, 0x6b, 0x33, 0x00, 0x01, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xf4, 0xd6, 0xb8, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6,
+	0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa2, 0x6b, 0x33, 0x00, 0x01, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xf4, 0xd6, 0xb8, 0xa6, 0xa6,
+	0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa2, 0x6b, 0x33, 0x00, 0x03, 0x02, 0x0b, 0x1b, 0x30, 0x44, 0x67, 0xa6,
+	0xdd, 0xff, 0xff, 0xff, 0xdb, 0xa3, 0x65, 0x43, 0x2f, 0x1a, 0x0b, 0x02, 0x00, 0x03, 0x1f, 0x64, 0xad, 0xe0, 0xf0, 0xfc, 0xff, 0xff, 0xf6, 0xcc,
+	0x80, 0x34, 0x09, 0x00, 0x0b, 0x43, 0x98, 0xed, 0xff, 0xff, 0xd2, 0x7d, 0x28, 0x00, 0x03, 0x28, 0x7d, 0xd2, 0xff, 0xff, 0xf2, 0x9e, 0x49, 0x00,
+	0x07, 0x0f, 0x40, 0x8e, 0xd3, 0xf8, 0xff, 0xf4, 0xbb, 0x66, 0x1c, 0x00, 0x0f, 0x08, 0x3c, 0x90, 0xdd, 0xfe, 0xfe, 0xe9, 0xb3, 0x62, 0x22, 0x03,
+	0x00, 0x0b, 0x39, 0x8e, 0xe3, 0xec, 0xa9, 0x59, 0x16, 0x09, 0x11, 0x2d, 0x54, 0x80, 0xac, 0xd2, 0xee, 0xfb, 0xfe, 0xf6, 0xdd, 0xac, 0x60, 0x25,
+	0x02, 0x00, 0x14, 0x02, 0x22, 0x4e, 0x7a, 0x7e, 0x5e, 0x30, 0x0c, 0x00, 0x04, 0x17, 0x3f, 0x6e, 0x7f, 0x6d, 0x3d, 0x15, 0x00, 0x18, 0x3c, 0x91,
+	0xe6, 0xf0, 0xaf, 0x61, 0x1b, 0x0c, 0x13, 0x44, 0x95, 0xdc, 0xfd, 0xbf, 0x6a, 0x16, 0x00, 0x13, 0x38, 0x8d, 0xe2, 0xed, 0xaa, 0x5a, 0x17, 0x09,
+	0x11, 0x2c, 0x53, 0x7f, 0xab, 0xd2, 0xed, 0xfb, 0xfe, 0xf7, 0xde, 0xad, 0x61, 0x25, 0x02, 0x00, 0x09, 0x07, 0x3a, 0x8e, 0xdc, 0xfe, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x60, 0x0b, 0x00, 0x03, 0x34, 0x89, 0xde, 0xff, 0xaa, 0x55,
+	0x00, 0x05, 0x0b, 0x30, 0x5e, 0x7e, 0x7a, 0x4e, 0x23, 0x02, 0x00, 0x03, 0x02, 0x23, 0x4e, 0x7a, 0x7d, 0x5d, 0x2f, 0x0b, 0x00, 0x0c, 0x05, 0x53,
+	0xa8, 0xf7, 0xff, 0xff, 0xe3, 0x9a, 0x45, 0x0c, 0x00, 0x17, 0x03, 0x0b, 0x18, 0x24, 0x28, 0x22, 0x14, 0x09, 0x02, 0x00, 0x1b, 0x2d, 0x82, 0xd7,
+	0xff, 0xff, 0xff, 0xb4, 0x5f, 0x0a, 0x00, 0x0e, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xa4, 0x4f, 0x00, 0x01, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xa4, 0x4f, 0x00, 0x01, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xa4, 0x4f, 0x00, 0x03, 0x2c, 0x81, 0xd6, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x7e, 0x29, 0x00, 0x07, 0x10, 0x4f, 0xa3, 0xe8, 0xff, 0xff, 0xf2, 0x9f, 0x4a, 0x02,
+	0x00, 0x0a, 0x0c, 0x30, 0x5e, 0x7e, 0x7a, 0x4e, 0x23, 0x02, 0x00, 0x03, 0x02, 0x23, 0x4e, 0x7a, 0x7d, 0x5d, 0x2f, 0x0b, 0x00, 0x09, 0x01, 0x1a,
+	0x4f, 0x9a, 0xd6, 0xf7, 0xec, 0xae, 0x59, 0x16, 0x00, 0x0b, 0x04, 0x32, 0x83, 0xd3, 0xfa, 0xeb, 0xbd, 0x73, 0x31, 0x0a, 0x00, 0x0e, 0x08, 0x11,
+	0x1a, 0x13, 0x0a, 0x01, 0x00, 0x08, 0x02, 0x07, 0x08, 0x06, 0x00, 0x44, 0x45, 0x9a, 0xef, 0xe4, 0x93, 0x3e, 0x04, 0x00, 0x01, 0x01, 0x25, 0x7a,
+	0xcd, 0xfe, 0xc8, 0x73, 0x1e, 0x00, 0x13, 0x08, 0x11, 0x1a, 0x13, 0x0a, 0x01, 0x00, 0x08, 0x02, 0x07, 0x08, 0x06, 0x00, 0x0e, 0x44, 0x99, 0xee,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x60, 0x0b, 0x00, 0x03, 0x34, 0x89,
+	0xde, 0xff, 0xaa, 0x55, 0x00, 0x24, 0x23, 0x78, 0xcd, 0xff, 0xff, 0xff, 0xb5, 0x60, 0x0b, 0x00, 0xbe, 0x14, 0x69, 0xbe, 0xff, 0xff, 0xff, 0xc4,
+	0x6f, 0x1a, 0x00, 0x2a, 0x09, 0x12, 0x1a, 0x18, 0x0f, 0x06, 0x00, 0x0b, 0x02, 0x0b, 0x14, 0x1b, 0x17, 0x0e, 0x05, 0x00, 0x18, 0x0f, 0x50, 0x92,
+	0xc5, 0xc7, 0xc7, 0xb6, 0x76, 0x33, 0x01, 0x00, 0x1f, 0x0f, 0x50, 0x92, 0xc5, 0xc7, 0xc7, 0xb6, 0x76, 0x33, 0x01, 0x00, 0x1c, 0x06, 0x32, 0x78,
+	0xc6, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xdc, 0x9d, 0x4f, 0x16, 0x00, 0x0e, 0x3c, 0x79, 0xb6, 0xb7, 0xb7, 0xb7, 0xaf, 0x7f, 0x42, 0x0c,
+	0x00, 0x11, 0x0a, 0x47, 0x84, 0xb7, 0xb7, 0xb7, 0x7f, 0x42, 0x05, 0x00, 0x01, 0x10, 0x65, 0xba, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x60, 0x0b, 0x00, 0x03, 0x34, 0x89, 0xde, 0xff, 0xaa, 0x55, 0x00, 0x02, 0x3c,
+	0x79, 0xb6, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb3, 0x76, 0x39,
+	0x00, 0x09, 0x24, 0x79, 0xce, 0xff, 0xff, 0xff, 0xb2, 0x5d, 0x08, 0x00, 0x16, 0x1b, 0x58, 0x95, 0xb7, 0xb7, 0xb7, 0x86, 0x49, 0x0c, 0x00, 0x02,
+	0x25, 0x62, 0x9f, 0xb7, 0xb7, 0xa3, 0x6b, 0x2e, 0x05, 0x00, 0x11, 0x10, 0x47, 0x84, 0xb0, 0xb7, 0xb4, 0x87, 0x4a, 0x10, 0x00, 0x01, 0x03, 0x40,
+	0x7d, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0x85, 0x48, 0x0b, 0x00, 0x01, 0x1c, 0x59, 0x96, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7,
+	0xb7, 0xb7, 0xb7, 0xb7, 0xab, 0x6e, 0x31, 0x00, 0x0c, 0x10, 0x46, 0x7d, 0xa4, 0x9d, 0x66, 0x30, 0x00, 0x15, 0x08, 0x29, 0x5a, 0x8c, 0xac, 0xbf,
+	0xc6, 0xc4, 0xb7, 0x9c, 0x75, 0x3f, 0x17, 0x00, 0x24, 0x11, 0x66, 0xbb, 0xff, 0xff, 0xff, 0xc5, 0x70, 0x1b, 0x00, 0x0a, 0x20, 0x5d, 0x9a, 0xb7,
+	0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0x97, 0x5a, 0x1d, 0x00, 0x05, 0x20, 0x5d, 0x9a, 0xb7, 0xb7, 0xb7, 0xb7,
+	0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0x97, 0x5a, 0x1d, 0x00, 0x01, 0x20, 0x5d, 0x9a, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7,
+	0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0x97, 0x5a, 0x1d, 0x00, 0x10, 0x15, 0x65, 0xba, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x95, 0x40, 0x03, 0x00,
+	0x1d, 0x15, 0x65, 0xba, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x95, 0x40, 0x03, 0x00, 0x1d, 0x15, 0x67, 0xbc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xe6,
+	0x95, 0x40, 0x03, 0x00, 0x0f, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xd8, 0x89, 0x36, 0x06, 0x00, 0x0f, 0x0e, 0x63, 0xb8, 0xff, 0xff,
+	0xff, 0xb1, 0x5c, 0x07, 0x00, 0x01, 0x29, 0x7e, 0xd3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xb5, 0x60, 0x0b, 0x00, 0x03, 0x34, 0x89, 0xde, 0xff, 0xaa, 0x55, 0x00, 0x02, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xfd, 0xf7, 0xf1,
+	0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe8, 0x99, 0x4a, 0x00, 0x09, 0x24, 0x79, 0xce, 0xff, 0xff,
+	0xff, 0xb2, 0x5d, 0x08, 0x00, 0x16, 0x25, 0x7a, 0xcf, 0xff, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x03, 0x20, 0x70, 0xc5, 0xf9, 0xff, 0xf9, 0xce,
+	0x7f, 0x2f, 0x05, 0x00, 0x0d, 0x12, 0x4d, 0xa2, 0xe5, 0xfe, 0xff, 0xeb, 0xa3, 0x4e, 0x0d, 0x00, 0x02, 0x04, 0x59, 0xae, 0xff, 0xff, 0xff, 0xf4,
+	0xe2, 0xcf, 0xc7, 0xc7, 0xc7, 0xc7, 0x91, 0x4e, 0x0c, 0x00, 0x01, 0x1e, 0x61, 0xa3, 0xc7, 0xc7, 0xc7, 0xc7, 0xd4, 0xe7, 0xfa, 0xff, 0xff, 0xee,
+	0x99, 0x44, 0x00, 0x0c, 0x18, 0x6d, 0xc2, 0xff, 0xf4, 0x9f, 0x4a, 0x00, 0x14, 0x26, 0x78, 0xcd, 0xf9, 0xd1, 0x9a, 0x5d, 0x4c, 0x52, 0x80, 0xbc,
+	0xec, 0xf2, 0xaa, 0x55, 0x0d, 0x00, 0x22, 0x11, 0x66, 0xbb, 0xff, 0xff, 0xff, 0xc5, 0x70, 0x1b, 0x00, 0x0a, 0x0e, 0x2f, 0x57, 0x77, 0x8c, 0xa7,
+	0xce, 0xed, 0xff, 0xff, 0xff, 0xec, 0xcc, 0xa5, 0x8b, 0x77, 0x56, 0x2e, 0x0d, 0x00, 0x05, 0x0e, 0x2f, 0x57, 0x77, 0x8c, 0xa7, 0xce, 0xed, 0xff,
+	0xff, 0xff, 0xec, 0xcc, 0xa5, 0x8b, 0x77, 0x56, 0x2e, 0x0d, 0x00, 0x01, 0x0e, 0x2f, 0x57, 0x77, 0x8c, 0xa7, 0xce, 0xed, 0xff, 0xff, 0xff, 0xec,
+	0xcc, 0xa5, 0x8b, 0x77, 0x56, 0x2e, 0x0d, 0x00, 0x0f, 0x1a, 0x6d, 0xc2, 0xfc, 0xff, 0xdf, 0xd8, 0xd8, 0xf8, 0xff, 0xec, 0x9d, 0x48, 0x06, 0x00,
+	0x1b, 0x1a, 0x6d, 0xc2, 0xfc, 0xff, 0xdf, 0xd8, 0xd8, 0xf8, 0xff, 0xec, 0x9d, 0x48, 0x06, 0x00, 0x1b, 0x1a, 0x6d, 0xc2, 0xfc, 0xff, 0xdf, 0xd8,
+	0xd8, 0xf8, 0xff, 0xec, 0x9d, 0x48, 0x06, 0x00, 0x0e, 0x54, 0xa9, 0xfe, 0xff, 0xfa, 0xf9, 0xf9, 0xfe, 0xff, 0xf9, 0xca, 0x77, 0x27, 0x02, 0x00,
+	0x0d, 0x0e, 0x63, 0xb8, 0xff, 0xff, 0xff, 0xb1, 0x5c, 0x07, 0x00, 0x01, 0x11, 0x66, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x60, 0x0b, 0x00, 0x03, 0x34, 0x89, 0xde, 0xff, 0xaa, 0x55, 0x00, 0x02, 0x54, 0xa9,
+	0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x1a, 0x2e, 0x83, 0xd8, 0xff, 0xff, 0xfd, 0xaf, 0x5a, 0x06, 0x00, 0x16, 0x25, 0x7a, 0xcf, 0xff, 0xff,
+	0xff, 0xbb, 0x66, 0x11, 0x00, 0x04, 0x09, 0x45, 0x9a, 0xe6, 0xff, 0xff, 0xfa, 0xc6, 0x71, 0x21, 0x00, 0x0a, 0x05, 0x3f, 0x94, 0xe4, 0xff, 0xff,
+	0xfc, 0xcd, 0x79, 0x27, 0x01, 0x00, 0x03, 0x04, 0x59, 0xae, 0xff, 0xff, 0xff, 0xd0, 0x7b, 0x26, 0x00, 0x0f, 0x3d, 0x92, 0xe7, 0xff, 0xff, 0xee,
+	0x99, 0x44, 0x00, 0x06, 0x07, 0x20, 0x48, 0x71, 0x8f, 0xa5, 0xbe, 0xdc, 0xf3, 0xff, 0xfd, 0xf0, 0xdf, 0xcb, 0xbf, 0xb3, 0xa6, 0x94, 0x7c, 0x60,
+	0x42, 0x22, 0x0c, 0x00, 0x0a, 0x49, 0x9e, 0xf3, 0xdd, 0x88, 0x33, 0x00, 0x03, 0x12, 0x66, 0xbb, 0xfe, 0xd3, 0x7e, 0x29, 0x00, 0x22, 0x0e, 0x62,
+	0xb7, 0xfe, 0xff, 0xff, 0xc9, 0x74, 0x1f, 0x00, 0x0f, 0x1c, 0x71, 0xc6, 0xff, 0xff, 0xff, 0xc2, 0x6d, 0x18, 0x00, 0x0f, 0x1c, 0x71, 0xc6, 0xff,
+	0xff, 0xff, 0xc2, 0x6d, 0x18, 0x00, 0x0b, 0x1c, 0x71, 0xc6, 0xff, 0xff, 0xff, 0xc2, 0x6d, 0x18, 0x00, 0x13, 0x21, 0x75, 0xca, 0xfe, 0xff, 0xe7,
+	0x93, 0x51, 0x66, 0xb9, 0xfb, 0xff, 0xf1, 0xa6, 0x51, 0x0a, 0x00, 0x19, 0x21, 0x75, 0xca, 0xfe, 0xff, 0xe7, 0x93, 0x51, 0x66, 0xb9, 0xfb, 0xff,
+	0xf1, 0xa6, 0x51, 0x0a, 0x00, 0x19, 0x21, 0x75, 0xca, 0xfe, 0xff, 0xe7, 0x93, 0x51, 0x66, 0xb9, 0xfb, 0xff, 0xf1, 0xa6, 0x51, 0x0a, 0x00, 0x0d,
+	0x54, 0xa9, 0xfe, 0xff, 0xeb, 0xa5, 0x8e, 0xa2, 0xe8, 0xff, 0xff, 0xf3, 0xb9, 0x64, 0x1b, 0x00, 0x0c, 0x0e, 0x63, 0xb8, 0xff, 0xff, 0xff, 0xb1,
+	0x5c, 0x07, 0x00, 0x02, 0x45, 0x9a, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xb5, 0x60, 0x0b, 0x00, 0x03, 0x34, 0x89, 0xde, 0xff, 0xaa, 0x55, 0x00, 0x02, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x18, 0x03,
+	0x38, 0x8d, 0xdf, 0xff, 0xff, 0xfb, 0xbf, 0x6a, 0x18, 0x00, 0x17, 0x25, 0x7a, 0xcf, 0xff, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x06, 0x1f, 0x6f,
+	0xc4, 0xf9, 0xff, 0xff, 0xde, 0x8b, 0x36, 0x02, 0x00, 0x07, 0x0f, 0x59, 0xae, 0xf3, 0xff, 0xff, 0xeb, 0xa2, 0x4d, 0x0c, 0x00, 0x05, 0x04, 0x59,
+	0xae, 0xff, 0xff, 0xff, 0xd0, 0x7b, 0x26, 0x00, 0x0f, 0x3d, 0x92, 0xe7, 0xff, 0xff, 0xee, 0x99, 0x44, 0x00, 0x03, 0x08, 0x36, 0x81, 0xcd, 0xf5,
+	0xff, 0xff, 0xfe, 0xf3, 0xe4, 0xe5, 0xef, 0xff, 0xfb, 0xe0, 0xcb, 0xbf, 0xcf, 0xe0, 0xf0, 0xfb, 0xff, 0xf8, 0xbc, 0x67, 0x19, 0x00, 0x0a, 0x12,
+	0x53, 0xa8, 0xea, 0xed, 0xd1, 0xab, 0x9c, 0xa2, 0xc4, 0xe5, 0xf5, 0xd2, 0x81, 0x31, 0x04, 0x00, 0x23, 0x20, 0x74, 0xc9, 0xfe, 0xff, 0xf1, 0xb1,
+	0x5d, 0x15, 0x00, 0x0e, 0x1c, 0x71, 0xc6, 0xff, 0xff, 0xff, 0xc2, 0x6d, 0x18, 0x00, 0x0f, 0x1c, 0x71, 0xc6, 0xff, 0xff, 0xff, 0xc2, 0x6d, 0x18,
+	0x00, 0x0b, 0x1c, 0x71, 0xc6, 0xff, 0xff, 0xff, 0xc2, 0x6d, 0x18, 0x00, 0x12, 0x28, 0x7d, 0xd2, 0xfe, 0xff, 0xe8, 0x96, 0x41, 0x03, 0x17, 0x68,
+	0xbd, 0xfb, 0xff, 0xf5, 0xaf, 0x5a, 0x0e, 0x00, 0x17, 0x28, 0x7d, 0xd2, 0xfe, 0xff, 0xe8, 0x96, 0x41, 0x03, 0x17, 0x68, 0xbd, 0xfb, 0xff, 0xf5,
+	0xaf, 0x5a, 0x0e, 0x00, 0x17, 0x28, 0x7d, 0xd2, 0xfe, 0xff, 0xe8, 0x96, 0x41, 0x03, 0x17, 0x68, 0xbd, 0xfb, 0xff, 0xf5, 0xaf, 0x5a, 0x0e, 0x00,
+	0x0c, 0x54, 0xa9, 0xfe, 0xff, 0xfa, 0xa5, 0x50, 0x19, 0x60, 0xb5, 0xf1, 0xff, 0xff, 0xea, 0xa7, 0x52, 0x11, 0x00, 0x0a, 0x0e, 0x63, 0xb8, 0xff,
+	0xff, 0xff, 0xb1, 0x5c, 0x07, 0x00, 0x02, 0x06, 0x3a, 0x8f, 0xdd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xb5, 0x60, 0x0b, 0x00, 0x03, 0x34, 0x89, 0xde, 0xff, 0xaa, 0x55, 0x00, 0x02, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35,
+	0x00, 0x12, 0x07, 0x37, 0x6d, 0xa3, 0xb6, 0xc9, 0xdd, 0xef, 0xf8, 0xee, 0xd2, 0xab, 0x76, 0x3d, 0x11, 0x00, 0x18, 0x25, 0x7a, 0xcf, 0xff, 0xff,
+	0xff, 0xbb, 0x66, 0x11, 0x00, 0x07, 0x08, 0x4d, 0xa2, 0xee, 0xff, 0xff, 0xed, 0x9d, 0x48, 0x04, 0x00, 0x05, 0x18, 0x6a, 0xbf, 0xfb, 0xff, 0xff,
+	0xd4, 0x80, 0x2b, 0x00, 0x07, 0x04, 0x59, 0xae, 0xff, 0xff, 0xff, 0xd0, 0x7b, 0x26, 0x00, 0x0f, 0x3d, 0x92, 0xe7, 0xff, 0xff, 0xee, 0x99, 0x44,
+	0x00, 0x02, 0x15, 0x68, 0xbd, 0xfc, 0xff, 0xff, 0xd9, 0x94, 0x42, 0x13, 0x1c, 0x6d, 0xc2, 0xff, 0xf4, 0x9f, 0x4a, 0x00, 0x03, 0x06, 0x16, 0x30,
+	0x33, 0x23, 0x09, 0x00, 0x0d, 0x06, 0x1c, 0x3e, 0x5d, 0x70, 0x77, 0x74, 0x68, 0x4e, 0x2c, 0x0e, 0x01, 0x00, 0x26, 0x16, 0x44, 0x7f, 0xb0, 0xd6,
+	0xf0, 0xf6, 0xe5, 0xc7, 0xab, 0x99, 0x8f, 0x5f, 0x2f, 0x02, 0x00, 0x07, 0x1c, 0x71, 0xc6, 0xff, 0xff, 0xff, 0xc2, 0x6d, 0x18, 0x00, 0x0f, 0x1c,
+	0x71, 0xc6, 0xff, 0xff, 0xff, 0xc2, 0x6d, 0x18, 0x00, 0x0b, 0x1c, 0x71, 0xc6, 0xff, 0xff, 0xff, 0xc2, 0x6d, 0x18, 0x00, 0x11, 0x31, 0x86, 0xda,
+	0xff, 0xff, 0xe6, 0x94, 0x3f, 0x02, 0x00, 0x02, 0x14, 0x64, 0xb9, 0xfa, 0xff, 0xf9, 0xb7, 0x62, 0x13, 0x00, 0x15, 0x31, 0x86, 0xda, 0xff, 0xff,
+	0xe6, 0x94, 0x3f, 0x02, 0x00, 0x02, 0x14, 0x64, 0xb9, 0xfa, 0xff, 0xf9, 0xb7, 0x62, 0x13, 0x00, 0x15, 0x31, 0x86, 0xda, 0xff, 0xff, 0xe6, 0x94,
+	0x3f, 0x02, 0x00, 0x02, 0x14, 0x64, 0xb9, 0xfa, 0xff, 0xf9, 0xb7, 0x62, 0x13, 0x00, 0x0b, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xb1, 0x5c, 0x07, 0x01,
+	0x24, 0x72, 0xc6, 0xf8, 0xff, 0xfe, 0xe0, 0x95, 0x40, 0x0a, 0x00, 0x08, 0x0e, 0x63, 0xb8, 0xff, 0xff, 0xff, 0xb1, 0x5c, 0x07, 0x00, 0x04, 0x13,
+	0x45, 0x89, 0xc9, 0xec, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x60, 0x0b, 0x00, 0x03, 0x34, 0x89,
+	0xde, 0xff, 0xaa, 0x55, 0x00, 0x02, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x12, 0x0d, 0x62, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xe8,
+	0xba, 0x7d, 0x49, 0x24, 0x0b, 0x00, 0x1a, 0x25, 0x7a, 0xcf, 0xff, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x08, 0x19, 0x6e, 0xc3, 0xff, 0xff, 0xff,
+	0xe0, 0x8b, 0x36, 0x00, 0x04, 0x08, 0x56, 0xab, 0xf8, 0xff, 0xff, 0xf4, 0xa1, 0x4c, 0x01, 0x00, 0x07, 0x04, 0x59, 0xae, 0xff, 0xff, 0xff, 0xd0,
+	0x7b, 0x26, 0x00, 0x0f, 0x3d, 0x92, 0xe7, 0xff, 0xff, 0xee, 0x99, 0x44, 0x00, 0x02, 0x38, 0x8d, 0xe2, 0xff, 0xff, 0xe3, 0x8e, 0x39, 0x00, 0x02,
+	0x18, 0x6d, 0xc2, 0xff, 0xf4, 0x9f, 0x4a, 0x00, 0x15, 0x03, 0x0a, 0x16, 0x22, 0x2f, 0x37, 0x37, 0x31, 0x27, 0x1d, 0x11, 0x08, 0x01, 0x00, 0x27,
+	0x01, 0x0e, 0x27, 0x4f, 0x84, 0xc0, 0xec, 0xff, 0xff, 0xff, 0xff, 0xae, 0x59, 0x04, 0x00, 0x07, 0x1c, 0x71, 0xc6, 0xff, 0xff, 0xff, 0xc2, 0x6d,
+	0x18, 0x00, 0x0f, 0x1c, 0x71, 0xc6, 0xff, 0xff, 0xff, 0xc2, 0x6d, 0x18, 0x00, 0x0b, 0x1c, 0x71, 0xc6, 0xff, 0xff, 0xff, 0xc2, 0x6d, 0x18, 0x00,
+	0x0f, 0x02, 0x39, 0x8e, 0xe1, 0xff, 0xff, 0xe5, 0x92, 0x3d, 0x02, 0x00, 0x04, 0x11, 0x60, 0xb5, 0xf9, 0xff, 0xfb, 0xbf, 0x6a, 0x19, 0x00, 0x12,
+	0x02, 0x39, 0x8e, 0xe1, 0xff, 0xff, 0xe5, 0x92, 0x3d, 0x02, 0x00, 0x04, 0x11, 0x60, 0xb5, 0xf9, 0xff, 0xfb, 0xbf, 0x6a, 0x19, 0x00, 0x12, 0x02,
+	0x39, 0x8e, 0xe1, 0xff, 0xff, 0xe5, 0x92, 0x3d, 0x02, 0x00, 0x04, 0x11, 0x60, 0xb5, 0xf9, 0xff, 0xfb, 0xbf, 0x6a, 0x19, 0x00, 0x0a, 0x54, 0xa9,
+	0xfe, 0xff, 0xff, 0xb8, 0x63, 0x0e, 0x00, 0x02, 0x05, 0x32, 0x85, 0xd5, 0xfc, 0xff, 0xfc, 0xd3, 0x82, 0x30, 0x04, 0x00, 0x06, 0x0e, 0x63, 0xb8,
+	0xff, 0xff, 0xff, 0xb1, 0x5c, 0x07, 0x00, 0x07, 0x03, 0x16, 0x32, 0x50, 0x61, 0x6d, 0x7a, 0x83, 0x84, 0x7e, 0x73, 0x85, 0xb4, 0xe6, 0xff, 0xb5,
+	0x60, 0x0b, 0x00, 0x03, 0x34, 0x89, 0xde, 0xff, 0xaa, 0x55, 0x00, 0x02, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xef, 0xc6, 0x9d, 0x84, 0x84, 0x84, 0x84,
+	0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x7a, 0x4e, 0x22, 0x00, 0x03, 0x09, 0x17, 0x2c, 0x3f, 0x52, 0x6a, 0xa1, 0xd4, 0xfc, 0xff,
+	0xfc, 0xdc, 0x88, 0x36, 0x01, 0x00, 0x17, 0x25, 0x7a, 0xcf, 0xff, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x09, 0x47, 0x9c, 0xf1, 0xff, 0xff, 0xff,
+	0xc7, 0x72, 0x1d, 0x00, 0x03, 0x3c, 0x91, 0xe6, 0xff, 0xff, 0xff, 0xcf, 0x7a, 0x25, 0x00, 0x08, 0x04, 0x59, 0xae, 0xff, 0xff, 0xff, 0xd0, 0x7b,
+	0x26, 0x00, 0x0f, 0x3d, 0x92, 0xe7, 0xff, 0xff, 0xee, 0x99, 0x44, 0x00, 0x02, 0x15, 0x67, 0xbc, 0xfb, 0xff, 0xfb, 0xcf, 0x87, 0x36, 0x0d, 0x18,
+	0x6d, 0xc2, 0xff, 0xf4, 0x9f, 0x4a, 0x00, 0x0f, 0x12, 0x3a, 0x6d, 0x9a, 0xbd, 0xdd, 0xf3, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xfd, 0xee, 0xd1, 0xa6, 0x6b, 0x34, 0x0b, 0x00, 0x21, 0x04, 0x40, 0x93, 0xe4, 0xfd, 0xff, 0xf9, 0xce, 0x9a, 0x65, 0x50, 0x3d, 0x2a, 0x16, 0x08,
+	0x00, 0x08, 0x1c, 0x71, 0xc6, 0xff, 0xff, 0xff, 0xc2, 0x6d, 0x18, 0x00, 0x0f, 0x1c, 0x71, 0xc6, 0xff, 0xff, 0xff, 0xc2, 0x6d, 0x18, 0x00, 0x0b,
+	0x1c, 0x71, 0xc6, 0xff, 0xff, 0xff, 0xc2, 0x6d, 0x18, 0x00, 0x0e, 0x04, 0x41, 0x96, 0xe7, 0xff, 0xff, 0xe3, 0x90, 0x3b, 0x01, 0x00, 0x06, 0x0f,
+	0x5c, 0xb1, 0xf7, 0xff, 0xfd, 0xc8, 0x73, 0x1f, 0x00, 0x10, 0x04, 0x41, 0x96, 0xe7, 0xff, 0xff, 0xe3, 0x90, 0x3b, 0x01, 0x00, 0x06, 0x0f, 0x5c,
+	0xb1, 0xf7, 0xff, 0xfd, 0xc8, 0x73, 0x1f, 0x00, 0x10, 0x04, 0x41, 0x96, 0xe7, 0xff, 0xff, 0xe3, 0x90, 0x3b, 0x01, 0x00, 0x06, 0x0f, 0x5c, 0xb1,
+	0xf7, 0xff, 0xfd, 0xc8, 0x73, 0x1f, 0x00, 0x09, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x04, 0x0a, 0x42, 0x97, 0xe1, 0xfe, 0xff,
+	0xf7, 0xc4, 0x70, 0x23, 0x01, 0x00, 0x04, 0x0e, 0x63, 0xb8, 0xff, 0xff, 0xff, 0xb1, 0x5c, 0x07, 0x00, 0x12, 0x2c, 0x81, 0xd6, 0xff, 0xb5, 0x60,
+	0x0b, 0x00, 0x03, 0x34, 0x89, 0xde, 0xff, 0xaa, 0x55, 0x00, 0x02, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0x97, 0x42, 0x00, 0x09, 0x10, 0x58, 0xad, 0xf2, 0xff, 0xff, 0xe6, 0x93, 0x3e, 0x02, 0x00,
+	0x16, 0x25, 0x7a, 0xcf, 0xff, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x09, 0x20, 0x75, 0xca, 0xff, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x02, 0x0a,
+	0x5f, 0xb4, 0xff, 0xff, 0xff, 0xf9, 0xa9, 0x54, 0x04, 0x00, 0x08, 0x04, 0x59, 0xae, 0xff, 0xff, 0xff, 0xd0, 0x7b, 0x26, 0x00, 0x0f, 0x3d, 0x92,
+	0xe7, 0xff, 0xff, 0xee, 0x99, 0x44, 0x00, 0x03, 0x08, 0x38, 0x82, 0xcf, 0xf4, 0xff, 0xff, 0xf8, 0xe5, 0xd0, 0xd6, 0xea, 0xff, 0xf5, 0xa2, 0x4d,
+	0x02, 0x00, 0x0e, 0x05, 0x3b, 0x90, 0xd7, 0xe1, 0xc1, 0x9f, 0x84, 0x71, 0x64, 0x57, 0x4e, 0x4d, 0x55, 0x6a, 0x8d, 0xc1, 0xe8, 0xfe, 0xff, 0xfd,
+	0xdb, 0x8c, 0x39, 0x05, 0x00, 0x1e, 0x04, 0x47, 0x9c, 0xec, 0xff, 0xff, 0xed, 0xa3, 0x4e, 0x0b, 0x00, 0x0e, 0x1c, 0x71, 0xc6, 0xff, 0xff, 0xff,
+	0xc2, 0x6d, 0x18, 0x00, 0x0f, 0x1c, 0x71, 0xc6, 0xff, 0xff, 0xff, 0xc2, 0x6d, 0x18, 0x00, 0x0b, 0x1c, 0x71, 0xc6, 0xff, 0xff, 0xff, 0xc2, 0x6d,
+	0x18, 0x00, 0x0d, 0x06, 0x49, 0x9e, 0xed, 0xff, 0xff, 0xef, 0xae, 0x6c, 0x39, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x45, 0x85, 0xc7,
+	0xfc, 0xff, 0xfe, 0xd0, 0x7b, 0x27, 0x00, 0x0e, 0x06, 0x49, 0x9e, 0xed, 0xff, 0xff, 0xef, 0xae, 0x6c, 0x39, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x45, 0x85, 0xc7, 0xfc, 0xff, 0xfe, 0xd0, 0x7b, 0x27, 0x00, 0x0e, 0x06, 0x49, 0x9e, 0xed, 0xff, 0xff, 0xef, 0xae, 0x6c, 0x39, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x45, 0x85, 0xc7, 0xfc, 0xff, 0xfe, 0xd0, 0x7b, 0x27, 0x00, 0x08, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xbb,
+	0x66, 0x11, 0x00, 0x06, 0x13, 0x55, 0xaa, 0xec, 0xff, 0xff, 0xf0, 0xb3, 0x5e, 0x17, 0x00, 0x03, 0x0e, 0x63, 0xb8, 0xff, 0xff, 0xff, 0xb1, 0x5c,
+	0x07, 0x00, 0x12, 0x2c, 0x81, 0xd6, 0xff, 0xb5, 0x60, 0x0b, 0x00, 0x03, 0x34, 0x89, 0xde, 0xff, 0xaa, 0x55, 0x00, 0x02, 0x54, 0xa9, 0xfe, 0xff,
+	0xff, 0xe3, 0x97, 0x4c, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1b, 0x11, 0x07, 0x00, 0x0a, 0x24, 0x79,
+	0xce, 0xff, 0xff, 0xff, 0xb2, 0x5d, 0x08, 0x00, 0x16, 0x25, 0x7a, 0xcf, 0xff, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x09, 0x02, 0x4f, 0xa4, 0xf6,
+	0xff, 0xff, 0xfb, 0xa7, 0x52, 0x01, 0x00, 0x01, 0x1c, 0x71, 0xc6, 0xff, 0xff, 0xff, 0xd7, 0x82, 0x2d, 0x00, 0x09, 0x04, 0x59, 0xae, 0xff, 0xff,
+	0xff, 0xd0, 0x7b, 0x26, 0x00, 0x0f, 0x3d, 0x92, 0xe7, 0xff, 0xff, 0xee, 0x99, 0x44, 0x00, 0x06, 0x09, 0x25, 0x52, 0x81, 0xa8, 0xca, 0xe7, 0xf9,
+	0xff, 0xff, 0xff, 0xfe, 0xf4, 0xde, 0xbd, 0x99, 0x6f, 0x40, 0x19, 0x03, 0x00, 0x0a, 0x03, 0x03, 0x03, 0x00, 0x0b, 0x11, 0x60, 0xb5, 0xf9, 0xff,
+	0xff, 0xd5, 0x80, 0x2b, 0x00, 0x1e, 0x11, 0x66, 0xbb, 0xff, 0xff, 0xff, 0xc5, 0x70, 0x1b, 0x00, 0x0f, 0x1c, 0x71, 0xc6, 0xff, 0xff, 0xff, 0xc2,
+	0x6d, 0x18, 0x00, 0x0f, 0x1c, 0x71, 0xc6, 0xff, 0xff, 0xff, 0xc2, 0x6d, 0x18, 0x00, 0x0b, 0x1c, 0x71, 0xc6, 0xff, 0xff, 0xff, 0xc2, 0x6d, 0x18,
+	0x00, 0x0c, 0x0a, 0x52, 0xa7, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xd8, 0x84, 0x2f, 0x00, 0x0c, 0x0a, 0x52, 0xa7, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0x84, 0x2f, 0x00, 0x0c, 0x0a, 0x52, 0xa7, 0xf1, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0x84, 0x2f, 0x00, 0x07, 0x54,
+	0xa9, 0xfe, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x08, 0x1d, 0x67, 0xbc, 0xf4, 0xff, 0xff, 0xe7, 0xa0, 0x4b, 0x0e, 0x00, 0x01, 0x0a, 0x5f, 0xb4,
+	0xff, 0xff, 0xff, 0xb1, 0x5c, 0x07, 0x00, 0x12, 0x2c, 0x81, 0xd6, 0xff, 0xb5, 0x60, 0x0b, 0x00, 0x03, 0x34, 0x89, 0xde, 0xff, 0xaa, 0x55, 0x00,
+	0x02, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x1a, 0x24, 0x79, 0xce, 0xff, 0xff, 0xff, 0xb2, 0x5d, 0x08, 0x00, 0x16, 0x25, 0x7a,
+	0xcf, 0xff, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x0a, 0x35, 0x8a, 0xdf, 0xff, 0xff, 0xff, 0xb2, 0x5d, 0x08, 0x00, 0x01, 0x27, 0x7c, 0xd1, 0xff,
+	0xff, 0xff, 0xbd, 0x68, 0x13, 0x00, 0x09, 0x04, 0x59, 0xae, 0xff, 0xff, 0xff, 0xd0, 0x7b, 0x26, 0x00, 0x0f, 0x3d, 0x92, 0xe7, 0xff, 0xff, 0xee,
+	0x99, 0x44, 0x00, 0x0c, 0x1b, 0x70, 0xc5, 0xff, 0xfb, 0xe1, 0xd3, 0xd5, 0xef, 0xfc, 0xff, 0xfd, 0xed, 0xbf, 0x71, 0x2c, 0x05, 0x00, 0x16, 0x31,
+	0x86, 0xdb, 0xff, 0xff, 0xf3, 0x9e, 0x49, 0x00, 0x1e, 0x11, 0x66, 0xbb, 0xff, 0xff, 0xff, 0xc5, 0x70, 0x1b, 0x00, 0x0f, 0x1c, 0x71, 0xc6, 0xff,
+	0xff, 0xff, 0xc2, 0x6d, 0x18, 0x00, 0x0f, 0x1c, 0x71, 0xc6, 0xff, 0xff, 0xff, 0xc2, 0x6d, 0x18, 0x00, 0x0b, 0x1c, 0x71, 0xc6, 0xff, 0xff, 0xff,
+	0xc2, 0x6d, 0x18, 0x00, 0x0b, 0x0e, 0x5a, 0xaf, 0xf5, 0xff, 0xff, 0xdc, 0xac, 0x7d, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
+	0x70, 0x70, 0x70, 0x70, 0x90, 0xbf, 0xef, 0xff, 0xff, 0xe0, 0x8c, 0x37, 0x01, 0x00, 0x09, 0x0e, 0x5a, 0xaf, 0xf5, 0xff, 0xff, 0xdc, 0xac, 0x7d,
+	0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x90, 0xbf, 0xef, 0xff, 0xff, 0xe0, 0x8c, 0x37, 0x01, 0x00,
+	0x09, 0x0e, 0x5a, 0xaf, 0xf5, 0xff, 0xff, 0xdc, 0xac, 0x7d, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
+	0x90, 0xbf, 0xef, 0xff, 0xff, 0xe0, 0x8c, 0x37, 0x01, 0x00, 0x05, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x09, 0x02, 0x2a, 0x7a,
+	0xcc, 0xfa, 0xff, 0xfe, 0xdb, 0x8e, 0x3a, 0x08, 0x54, 0xa9, 0xfd, 0xff, 0xff, 0xb1, 0x5c, 0x07, 0x00, 0x12, 0x2c, 0x81, 0xd6, 0xff, 0xb5, 0x60,
+	0x0b, 0x00, 0x03, 0x34, 0x89, 0xde, 0xff, 0xaa, 0x55, 0x00, 0x02, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x1a, 0x24, 0x79, 0xce,
+	0xff, 0xff, 0xff, 0xb2, 0x5d, 0x08, 0x00, 0x16, 0x25, 0x7a, 0xcf, 0xff, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x0a, 0x45, 0x9a, 0xef, 0xff, 0xff,
+	0xf6, 0xa1, 0x4c, 0x00, 0x02, 0x17, 0x6c, 0xc1, 0xff, 0xff, 0xff, 0xcd, 0x78, 0x23, 0x00, 0x09, 0x04, 0x59, 0xae, 0xff, 0xff, 0xff, 0xd0, 0x7b,
+	0x26, 0x00, 0x0f, 0x3d, 0x92, 0xe7, 0xff, 0xff, 0xee, 0x99, 0x44, 0x00, 0x0c, 0x18, 0x6d, 0xc2, 0xff, 0xf4, 0x9f, 0x4a, 0x02, 0x16, 0x47, 0x98,
+	0xd9, 0xfd, 0xff, 0xfa, 0xb6, 0x61, 0x10, 0x00, 0x08, 0x0b, 0x22, 0x3f, 0x56, 0x64, 0x6f, 0x7b, 0x86, 0x90, 0x97, 0x9c, 0x9f, 0xa3, 0xb4, 0xd3,
+	0xf0, 0xff, 0xff, 0xf7, 0xa2, 0x4d, 0x00, 0x1e, 0x11, 0x66, 0xbb, 0xff, 0xff, 0xff, 0xc5, 0x70, 0x1b, 0x00, 0x0f, 0x1c, 0x71, 0xc6, 0xff, 0xff,
+	0xff, 0xc2, 0x6d, 0x18, 0x00, 0x0f, 0x1c, 0x71, 0xc6, 0xff, 0xff, 0xff, 0xc2, 0x6d, 0x18, 0x00, 0x0b, 0x1c, 0x71, 0xc6, 0xff, 0xff, 0xff, 0xc2,
+	0x6d, 0x18, 0x00, 0x0a, 0x13, 0x62, 0xb7, 0xf9, 0xff, 0xfe, 0xcf, 0x7a, 0x25, 0x00, 0x0f, 0x05, 0x48, 0x9d, 0xec, 0xff, 0xff, 0xe6, 0x95, 0x40,
+	0x03, 0x00, 0x07, 0x13, 0x62, 0xb7, 0xf9, 0xff, 0xfe, 0xcf, 0x7a, 0x25, 0x00, 0x0f, 0x05, 0x48, 0x9d, 0xec, 0xff, 0xff, 0xe6, 0x95, 0x40, 0x03,
+	0x00, 0x07, 0x13, 0x62, 0xb7, 0xf9, 0xff, 0xfe, 0xcf, 0x7a, 0x25, 0x00, 0x0f, 0x05, 0x48, 0x9d, 0xec, 0xff, 0xff, 0xe6, 0x95, 0x40, 0x03, 0x00,
+	0x04, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x0b, 0x07, 0x38, 0x8c, 0xda, 0xfd, 0xff, 0xfa, 0xcd, 0x7b, 0x73, 0xa0, 0xf2, 0xff,
+	0xff, 0xb1, 0x5c, 0x07, 0x00, 0x12, 0x2c, 0x81, 0xd6, 0xff, 0xb5, 0x60, 0x0b, 0x00, 0x03, 0x34, 0x89, 0xde, 0xff, 0xaa, 0x55, 0x00, 0x02, 0x54,
+	0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x1a, 0x18, 0x6d, 0xc2, 0xff, 0xff, 0xff, 0xc0, 0x6b, 0x16, 0x00, 0x16, 0x25, 0x7a, 0xcf, 0xff,
+	0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x09, 0x06, 0x5a, 0xaf, 0xfe, 0xff, 0xff, 0xe3, 0x8e, 0x39, 0x00, 0x02, 0x05, 0x58, 0xad, 0xfd, 0xff, 0xff,
+	0xe2, 0x8d, 0x38, 0x00, 0x09, 0x04, 0x59, 0xae, 0xff, 0xff, 0xff, 0xd0, 0x7b, 0x26, 0x00, 0x0f, 0x3d, 0x92, 0xe7, 0xff, 0xff, 0xee, 0x99, 0x44,
+	0x00, 0x0c, 0x18, 0x6d, 0xc2, 0xff, 0xf4, 0x9f, 0x4a, 0x00, 0x03, 0x41, 0x96, 0xea, 0xff, 0xff, 0xdd, 0x88, 0x33, 0x00, 0x04, 0x09, 0x3e, 0x83,
+	0xcc, 0xeb, 0xfb, 0xff, 0xfe, 0xf4, 0xe5, 0xd3, 0xc7, 0xbb, 0xb1, 0xa9, 0xa4, 0x9f, 0xaf, 0xce, 0xf0, 0xff, 0xff, 0xf7, 0xa2, 0x4d, 0x00, 0x1e,
+	0x1f, 0x74, 0xc9, 0xff, 0xff, 0xfe, 0xb9, 0x64, 0x0f, 0x00, 0x0f, 0x1c, 0x71, 0xc6, 0xff, 0xff, 0xff, 0xc2, 0x6d, 0x18, 0x00, 0x0f, 0x1c, 0x71,
+	0xc6, 0xff, 0xff, 0xff, 0xc2, 0x6d, 0x18, 0x00, 0x0b, 0x1c, 0x71, 0xc6, 0xff, 0xff, 0xff, 0xc2, 0x6d, 0x18, 0x00, 0x09, 0x19, 0x6a, 0xbf, 0xfb,
+	0xff, 0xfd, 0xc8, 0x73, 0x1f, 0x00, 0x11, 0x04, 0x43, 0x98, 0xe9, 0xff, 0xff, 0xec, 0x9d, 0x48, 0x06, 0x00, 0x05, 0x19, 0x6a, 0xbf, 0xfb, 0xff,
+	0xfd, 0xc8, 0x73, 0x1f, 0x00, 0x11, 0x04, 0x43, 0x98, 0xe9, 0xff, 0xff, 0xec, 0x9d, 0x48, 0x06, 0x00, 0x05, 0x19, 0x6a, 0xbf, 0xfb, 0xff, 0xfd,
+	0xc8, 0x73, 0x1f, 0x00, 0x11, 0x04, 0x43, 0x98, 0xe9, 0xff, 0xff, 0xec, 0x9d, 0x48, 0x06, 0x00, 0x03, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xbb, 0x66,
+	0x11, 0x00, 0x0d, 0x0d, 0x49, 0x9e, 0xe6, 0xff, 0xff, 0xf5, 0xec, 0xec, 0xf6, 0xff, 0xff, 0xb1, 0x5c, 0x07, 0x00, 0x12, 0x2c, 0x81, 0xd6, 0xff,
+	0xb5, 0x60, 0x0b, 0x00, 0x03, 0x34, 0x89, 0xde, 0xff, 0xaa, 0x55, 0x00, 0x02, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x1b, 0x33,
+	0x87, 0xdc, 0xfe, 0xff, 0xfb, 0xd8, 0xa6, 0x70, 0x54, 0x39, 0x1f, 0x07, 0x00, 0x11, 0x25, 0x7a, 0xcf, 0xff, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00,
+	0x09, 0x36, 0x8b, 0xe0, 0xff, 0xff, 0xfb, 0xb3, 0x5e, 0x0d, 0x00, 0x03, 0x29, 0x7e, 0xd3, 0xff, 0xff, 0xfe, 0xbf, 0x6a, 0x15, 0x00, 0x08, 0x04,
+	0x59, 0xae, 0xff, 0xff, 0xff, 0xd0, 0x7b, 0x26, 0x00, 0x0f, 0x3d, 0x92, 0xe7, 0xff, 0xff, 0xee, 0x99, 0x44, 0x00, 0x01, 0x0a, 0x28, 0x39, 0x35,
+	0x18, 0x07, 0x00, 0x05, 0x18, 0x6d, 0xc2, 0xff, 0xf4, 0x9f, 0x4a, 0x03, 0x13, 0x4c, 0x9d, 0xe2, 0xff, 0xff, 0xfa, 0xb4, 0x5f, 0x0f, 0x00, 0x03,
+	0x1a, 0x68, 0xbd, 0xf8, 0xff, 0xee, 0xba, 0x74, 0x33, 0x12, 0x03, 0x00, 0x07, 0x33, 0x88, 0xdd, 0xff, 0xff, 0xf7, 0xa2, 0x4d, 0x00, 0x19, 0x0a,
+	0x21, 0x3c, 0x57, 0x76, 0xad, 0xde, 0xfc, 0xff, 0xfc, 0xd3, 0x7e, 0x2b, 0x00, 0x10, 0x1c, 0x71, 0xc6, 0xff, 0xff, 0xff, 0xc2, 0x6d, 0x18, 0x00,
+	0x0f, 0x1c, 0x71, 0xc6, 0xff, 0xff, 0xff, 0xc2, 0x6d, 0x18, 0x00, 0x0b, 0x1c, 0x71, 0xc6, 0xff, 0xff, 0xff, 0xc2, 0x6d, 0x18, 0x00, 0x08, 0x1f,
+	0x73, 0xc8, 0xfd, 0xff, 0xfc, 0xc2, 0x6d, 0x1b, 0x00, 0x13, 0x02, 0x3d, 0x92, 0xe5, 0xff, 0xff, 0xf1, 0xa5, 0x50, 0x09, 0x00, 0x03, 0x1f, 0x73,
+	0xc8, 0xfd, 0xff, 0xfc, 0xc2, 0x6d, 0x1b, 0x00, 0x13, 0x02, 0x3d, 0x92, 0xe5, 0xff, 0xff, 0xf1, 0xa5, 0x50, 0x09, 0x00, 0x03, 0x1f, 0x73, 0xc8,
+	0xfd, 0xff, 0xfc, 0xc2, 0x6d, 0x1b, 0x00, 0x13, 0x02, 0x3d, 0x92, 0xe5, 0xff, 0xff, 0xf1, 0xa5, 0x50, 0x09, 0x00, 0x02, 0x54, 0xa9, 0xfe, 0xff,
+	0xff, 0xbb, 0x66, 0x11, 0x00, 0x0f, 0x16, 0x5c, 0xb1, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb1, 0x5c, 0x07, 0x00, 0x12, 0x2c, 0x81, 0xd6,
+	0xff, 0xb5, 0x60, 0x0b, 0x00, 0x03, 0x34, 0x89, 0xde, 0xff, 0xaa, 0x55, 0x00, 0x02, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xf4, 0xd6, 0xb8, 0xa6, 0xa6,
+	0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa2, 0x6b, 0x33, 0x00, 0x0b, 0x0a, 0x34, 0x70, 0xae, 0xd8, 0xf1, 0xfd,
+	0xff, 0xff, 0xc8, 0x73, 0x1e, 0x00, 0x11, 0x25, 0x7a, 0xcf, 0xff, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x08, 0x1d, 0x72, 0xc7, 0xff, 0xff, 0xff,
+	0xcb, 0x76, 0x21, 0x00, 0x04, 0x01, 0x42, 0x97, 0xeb, 0xff, 0xff, 0xf5, 0xa5, 0x50, 0x05, 0x00, 0x07, 0x04, 0x59, 0xae, 0xff, 0xff, 0xff, 0xd0,
+	0x7b, 0x26, 0x00, 0x0f, 0x3d, 0x92, 0xe7, 0xff, 0xff, 0xee, 0x99, 0x44, 0x00, 0x01, 0x18, 0x6d, 0xc2, 0xff, 0xfc, 0xf1, 0xdf, 0xc9, 0xb5, 0xa5,
+	0x99, 0x9c, 0xbf, 0xe3, 0xff, 0xfb, 0xe4, 0xdb, 0xde, 0xf5, 0xfe, 0xff, 0xfe, 0xf1, 0xc5, 0x76, 0x2e, 0x05, 0x00, 0x02, 0x02, 0x32, 0x87, 0xda,
+	0xfe, 0xff, 0xec, 0x97, 0x42, 0x00, 0x0a, 0x05, 0x54, 0xa9, 0xf9, 0xff, 0xff, 0xf7, 0xa2, 0x4d, 0x00, 0x19, 0x27, 0x7c, 0xd1, 0xff, 0xff, 0xfc,
+	0xee, 0xd3, 0xa7, 0x67, 0x2d, 0x07, 0x00, 0x0c, 0x02, 0x0b, 0x1b, 0x30, 0x44, 0x67, 0xa6, 0xdd, 0xff, 0xff, 0xff, 0xdb, 0xa3, 0x65, 0x43, 0x2f,
+	0x1a, 0x0b, 0x02, 0x00, 0x05, 0x02, 0x0b, 0x1b, 0x30, 0x44, 0x67, 0xa6, 0xdd, 0xff, 0xff, 0xff, 0xdb, 0xa3, 0x65, 0x43, 0x2f, 0x1a, 0x0b, 0x02,
+	0x00, 0x01, 0x02, 0x0b, 0x1b, 0x30, 0x44, 0x67, 0xa6, 0xdd, 0xff, 0xff, 0xff, 0xdb, 0xa3, 0x65, 0x43, 0x2f, 0x1a, 0x0b, 0x02, 0x00, 0x02, 0x26,
+	0x7b, 0xd0, 0xfe, 0xff, 0xfb, 0xbc, 0x67, 0x16, 0x00, 0x15, 0x01, 0x39, 0x8e, 0xe1, 0xff, 0xff, 0xf5, 0xae, 0x59, 0x0e, 0x00, 0x01, 0x26, 0x7b,
+	0xd0, 0xfe, 0xff, 0xfb, 0xbc, 0x67, 0x16, 0x00, 0x15, 0x01, 0x39, 0x8e, 0xe1, 0xff, 0xff, 0xf5, 0xae, 0x59, 0x0e, 0x00, 0x01, 0x26, 0x7b, 0xd0,
+	0xfe, 0xff, 0xfb, 0xbc, 0x67, 0x16, 0x00, 0x15, 0x01, 0x39, 0x8e, 0xe1, 0xff, 0xff, 0xf5, 0xae, 0x59, 0x0e, 0x00, 0x01, 0x54, 0xa9, 0xfe, 0xff,
+	0xff, 0xbb, 0x66, 0x11, 0x00, 0x10, 0x01, 0x22, 0x6e, 0xc2, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xb1, 0x5c, 0x07, 0x00, 0x12, 0x1b, 0x4f, 0x84, 0x9d,
+	0x6f, 0x3b, 0x07, 0x00, 0x03, 0x20, 0x54, 0x89, 0x9d, 0x69, 0x34, 0x00, 0x02, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xa4, 0x4f, 0x00, 0x0f, 0x02, 0x0b, 0x18, 0x26, 0x30, 0x2b, 0x1b, 0x07,
+	0x00, 0x11, 0x25, 0x7a, 0xcf, 0xff, 0xff, 0xff, 0xba, 0x65, 0x10, 0x00, 0x07, 0x1b, 0x6d, 0xc2, 0xfb, 0xff, 0xfe, 0xd1, 0x7c, 0x28, 0x00, 0x06,
+	0x08, 0x49, 0x9e, 0xeb, 0xff, 0xff, 0xec, 0xa0, 0x4b, 0x08, 0x00, 0x06, 0x04, 0x59, 0xae, 0xff, 0xff, 0xff, 0xd0, 0x7b, 0x26, 0x00, 0x0f, 0x3d,
+	0x92, 0xe7, 0xff, 0xff, 0xee, 0x99, 0x44, 0x00, 0x01, 0x07, 0x27, 0x52, 0x7f, 0x9b, 0xb1, 0xc4, 0xd3, 0xdf, 0xe9, 0xf0, 0xf4, 0xf9, 0xfd, 0xff,
+	0xfd, 0xef, 0xd9, 0xbd, 0xa7, 0x8f, 0x6d, 0x42, 0x1b, 0x05, 0x00, 0x05, 0x01, 0x4a, 0x9f, 0xf2, 0xff, 0xff, 0xf9, 0xb7, 0x62, 0x13, 0x00, 0x08,
+	0x1b, 0x64, 0xb8, 0xf2, 0xff, 0xff, 0xff, 0xf7, 0xa2, 0x4d, 0x00, 0x19, 0x0a, 0x1d, 0x2c, 0x2f, 0x24, 0x16, 0x09, 0x01, 0x00, 0x10, 0x2c, 0x81,
+	0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x7e, 0x29, 0x00, 0x05, 0x2c, 0x81, 0xd6, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x7e, 0x29, 0x00, 0x01, 0x2c, 0x81, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x7e, 0x29, 0x00, 0xff, 0x00, 0x07, 0x3b, 0x90, 0xe5, 0xff, 0xff, 0xf2, 0x9e, 0x49, 0x01,
+	0x00, 0x06, 0x2b, 0x7f, 0xd4, 0xfe, 0xff, 0xf7, 0xb7, 0x62, 0x15, 0x00, 0x08, 0x01, 0x31, 0x85, 0xd9, 0xfe, 0xff, 0xf6, 0xb2, 0x5d, 0x11, 0x00,
+	0x05, 0x04, 0x59, 0xae, 0xff, 0xff, 0xff, 0xd0, 0x7b, 0x26, 0x00, 0x0f, 0x3d, 0x92, 0xe7, 0xff, 0xff, 0xee, 0x99, 0x44, 0x00, 0x0c, 0x18, 0x6d,
+	0xc2, 0xff, 0xf4, 0x9f, 0x4a, 0x00, 0x0d, 0x15, 0x5d, 0xb2, 0xf2, 0xff, 0xff, 0xfb, 0xdd, 0xb6, 0x8a, 0x6e, 0x5a, 0x55, 0x5e, 0x70, 0x8e, 0xb9,
+	0xe2, 0xef, 0xcf, 0xcd, 0xd6, 0xfc, 0xff, 0xf7, 0xa2, 0x4d, 0x00, 0x81, 0x04, 0x0f, 0x1e, 0x2f, 0x40, 0x50, 0x61, 0x71, 0x82, 0x92, 0xa2, 0xaa,
+	0xa8, 0x9c, 0x8d, 0x7d, 0x6e, 0x5f, 0x50, 0x3e, 0x24, 0x0f, 0x01, 0x00, 0x2c, 0x0a, 0x27, 0x35, 0x2c, 0x0e, 0x01, 0x00, 0x10, 0x04, 0x0d, 0x1a,
+	0x27, 0x33, 0x39, 0x39, 0x31, 0x24, 0x18, 0x10, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0d, 0x08, 0x03, 0x00, 0x01, 0x03, 0x07, 0x0c,
+	0x0e, 0x0e, 0x0e, 0x09, 0x05, 0x00, 0x10, 0x03, 0x08, 0x0d, 0x0e, 0x0e, 0x0d, 0x08, 0x04, 0x00, 0x05, 0x05, 0x18, 0x37, 0x5e, 0x7e, 0x96, 0xa3,
+	0xad, 0xb6, 0xbd, 0xbd, 0xb7, 0xae, 0xa4, 0x97, 0x81, 0x62, 0x3c, 0x1c, 0x07, 0x00, 0x11, 0x11, 0x4d, 0x84, 0x9a, 0x77, 0x48, 0x20, 0x08, 0x00,
+	0x04, 0x04, 0x18, 0x3e, 0x70, 0x7c, 0x58, 0x22, 0x01, 0x00, 0x24, 0x02, 0x15, 0x4c, 0x9f, 0xe1, 0xfe, 0xff, 0xfb, 0xc0, 0x6b, 0x1a, 0x00, 0x05,
+	0x0e, 0x4b, 0xa0, 0xe7, 0xff, 0xfc, 0xda, 0x8d, 0x3b, 0x08, 0x00, 0x0b, 0x18, 0x5c, 0xb1, 0xee, 0xff, 0xfc, 0xd0, 0x7f, 0x2d, 0x03, 0x00, 0x03,
+	0x04, 0x59, 0xae, 0xff, 0xff, 0xff, 0xdc, 0x9c, 0x5c, 0x3f, 0x3f, 0x3f, 0x3f, 0x2e, 0x19, 0x04, 0x00, 0x01, 0x09, 0x1e, 0x33, 0x3f, 0x3f, 0x3f,
+	0x3f, 0x6d, 0xad, 0xed, 0xff, 0xff, 0xee, 0x99, 0x44, 0x00, 0x0c, 0x18, 0x6d, 0xc2, 0xff, 0xf4, 0x9f, 0x4a, 0x00, 0x0e, 0x01, 0x1e, 0x51, 0x93,
+	0xc8, 0xea, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf5, 0xe1, 0xb9, 0x83, 0x44, 0x17, 0x24, 0x78, 0xcd, 0xff, 0xf7, 0xa2, 0x4d, 0x00, 0x08,
+	0x08, 0x3c, 0x80, 0xbb, 0xcb, 0xcb, 0xcb, 0xbc, 0x7e, 0x3a, 0x06, 0x00, 0x1e, 0x0b, 0x47, 0x8a, 0xc2, 0xcb, 0xcb, 0xca, 0xb3, 0x73, 0x2f, 0x03,
+	0x00, 0x11, 0x0b, 0x41, 0x85, 0xbd, 0xcb, 0xcb, 0xcb, 0xc6, 0x9a, 0x57, 0x17, 0x00, 0x25, 0x0f, 0x32, 0x69, 0xa5, 0xd7, 0xf5, 0xff, 0xff, 0xff,
+	0xfc, 0xf3, 0xe6, 0xd6, 0xc6, 0xb6, 0xaf, 0xb2, 0xbf, 0xcd, 0xdc, 0xeb, 0xf6, 0xfd, 0xff, 0xfa, 0xe5, 0xbd, 0x87, 0x51, 0x24, 0x09, 0x00, 0x13,
+	0x0e, 0x2f, 0x56, 0x76, 0x88, 0x99, 0xa9, 0xb9, 0xc9, 0xd9, 0xe5, 0xe8, 0xe3, 0xd8, 0xce, 0xc1, 0xad, 0x91, 0x70, 0x50, 0x5b, 0x93, 0xd7, 0xfc,
+	0xfb, 0xd5, 0x82, 0x31, 0x02, 0x00, 0x09, 0x0b, 0x2d, 0x61, 0x9a, 0xcc, 0xed, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0x99, 0x44, 0x00, 0x01, 0x0f, 0x5b, 0xb0, 0xf6, 0xff, 0xff, 0xdb, 0x87, 0x32, 0x00, 0x0e, 0x1a,
+	0x6d, 0xc2, 0xfd, 0xff, 0xfd, 0xc7, 0x72, 0x1f, 0x00, 0x02, 0x03, 0x24, 0x69, 0xbb, 0xef, 0xff, 0xff, 0xff, 0xfa, 0xeb, 0xda, 0xca, 0xc3, 0xc3,
+	0xc8, 0xd7, 0xe9, 0xf8, 0xff, 0xff, 0xff, 0xf1, 0xc3, 0x76, 0x2f, 0x08, 0x00, 0x0d, 0x0a, 0x3f, 0x86, 0xd1, 0xf0, 0xfe, 0xff, 0xf4, 0xd7, 0xa7,
+	0x81, 0x7f, 0xa1, 0xd0, 0xf0, 0xfe, 0xf9, 0xe3, 0xb0, 0x61, 0x22, 0x00, 0x1c, 0x2b, 0x74, 0xb8, 0xce, 0xc5, 0xc0, 0xc2, 0xcb, 0xdf, 0xf1, 0xfd,
+	0xff, 0xff, 0xfb, 0xd7, 0x89, 0x38, 0x07, 0x00, 0x04, 0x09, 0x3d, 0x91, 0xdd, 0xfe, 0xfb, 0xd6, 0x8a, 0x38, 0x09, 0x00, 0x0f, 0x17, 0x57, 0xac,
+	0xea, 0xff, 0xf6, 0xc3, 0x6f, 0x22, 0x01, 0x00, 0x01, 0x04, 0x59, 0xae, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb9, 0x64,
+	0x0f, 0x00, 0x01, 0x27, 0x7c, 0xd1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0x99, 0x44, 0x00, 0x0c, 0x05, 0x15, 0x26, 0x32,
+	0x30, 0x1f, 0x0e, 0x00, 0x13, 0x05, 0x0e, 0x1a, 0x26, 0x2b, 0x2a, 0x23, 0x17, 0x0b, 0x02, 0x00, 0x15, 0x17, 0x4f, 0xa2, 0xe0, 0xfd, 0xff, 0xf7,
+	0xc2, 0x6e, 0x20, 0x00, 0x1b, 0x02, 0x2c, 0x7d, 0xd0, 0xfb, 0xff, 0xfa, 0xd6, 0x91, 0x41, 0x0f, 0x00, 0x11, 0x14, 0x4d, 0xa0, 0xe1, 0xfd, 0xfc,
+	0xe4, 0xdc, 0xdf, 0xf6, 0xff, 0xed, 0xb7, 0x65, 0x21, 0x02, 0x00, 0x1e, 0x14, 0x3c, 0x77, 0xb3, 0xe0, 0xf9, 0xfa, 0xe3, 0xb8, 0x7d, 0x4c, 0x2a,
+	0x17, 0x0a, 0x02, 0x00, 0x0a, 0x04, 0x19, 0x40, 0x75, 0xab, 0xd9, 0xf5, 0xff, 0xf5, 0xd1, 0x85, 0x39, 0x08, 0x00, 0x0c, 0x0c, 0x2f, 0x66, 0xa7,
+	0xd9, 0xf7, 0xff, 0xff, 0xff, 0xfe, 0xfa, 0xef, 0xdf, 0xcd, 0xc0, 0xbd, 0xc2, 0xcd, 0xdd, 0xed, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
+	0xba, 0x65, 0x1a, 0x00, 0x09, 0x08, 0x3a, 0x8e, 0xda, 0xfd, 0xff, 0xf1, 0xcc, 0x9c, 0x6d, 0x4c, 0x30, 0x29, 0x38, 0x58, 0x79, 0xaf, 0xdc, 0xfd,
+	0xff, 0xfe, 0xd9, 0x9c, 0x5c, 0x3c, 0x30, 0x23, 0x13, 0x07, 0x00, 0x02, 0x0a, 0x50, 0xa5, 0xf0, 0xff, 0xff, 0xdf, 0x8c, 0x37, 0x01, 0x00, 0x0b,
+	0x18, 0x6b, 0xc0, 0xfd, 0xff, 0xfd, 0xc3, 0x6e, 0x1b, 0x00, 0x02, 0x05, 0x51, 0xa6, 0xf6, 0xff, 0xff, 0xec, 0xb5, 0x67, 0x24, 0x07, 0x00, 0x06,
+	0x05, 0x20, 0x63, 0xb3, 0xed, 0xff, 0xff, 0xf6, 0xa6, 0x51, 0x05, 0x00, 0x0f, 0x09, 0x35, 0x83, 0xce, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee,
+	0xb7, 0x6e, 0x2a, 0x0c, 0x00, 0x1f, 0x21, 0x62, 0xab, 0xd4, 0xdf, 0xe3, 0xe1, 0xd8, 0xcb, 0xbf, 0xac, 0x8d, 0x61, 0x31, 0x10, 0x01, 0x00, 0x06,
+	0x13, 0x29, 0x3f, 0x43, 0x43, 0x33, 0x1d, 0x07, 0x00, 0x13, 0x0f, 0x26, 0x3c, 0x43, 0x43, 0x37, 0x20, 0x0a, 0x00, 0x01, 0x01, 0x17, 0x2d, 0x43,
+	0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x30, 0x1a, 0x04, 0x00, 0x01, 0x0a, 0x20, 0x37, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+	0x43, 0x43, 0x3e, 0x28, 0x12, 0x00, 0x47, 0x06, 0x2a, 0x6b, 0xb9, 0xea, 0xfe, 0xee, 0xb1, 0x5c, 0x17, 0x00, 0x17, 0x01, 0x21, 0x6c, 0xbf, 0xf5,
+	0xfc, 0xe3, 0xab, 0x5b, 0x20, 0x03, 0x00, 0x10, 0x08, 0x2f, 0x77, 0xc3, 0xf1, 0xf8, 0xdb, 0xa2, 0x58, 0x20, 0x04, 0x14, 0x44, 0x8b, 0xcc, 0xf2,
+	0xf9, 0xd6, 0x92, 0x43, 0x11, 0x00, 0x1a, 0x13, 0x56, 0xab, 0xec, 0xfd, 0xe2, 0xb2, 0x70, 0x38, 0x12, 0x01, 0x00, 0x15, 0x08, 0x2e, 0x7d, 0xca,
+	0xf8, 0xfc, 0xd6, 0x88, 0x36, 0x07, 0x00, 0x08, 0x15, 0x5d, 0xb2, 0xf2, 0xff, 0xff, 0xff, 0xf1, 0xcb, 0x8e, 0x4d, 0x1f, 0x08, 0x01, 0x00, 0x07,
+	0x09, 0x3e, 0x93, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xd5, 0x85, 0x32, 0x04, 0x00, 0x08, 0x42, 0x97, 0xec, 0xff, 0xff, 0xf4, 0xa6, 0x51, 0x07,
+	0x00, 0x07, 0x20, 0x75, 0xca, 0xfe, 0xff, 0xfe, 0xc7, 0x72, 0x1e, 0x00, 0x07, 0x05, 0x46, 0x9b, 0xea, 0xff, 0xff, 0xe3, 0x90, 0x3b, 0x02, 0x00,
+	0x09, 0x17, 0x69, 0xbe, 0xfc, 0xff, 0xfc, 0xbf, 0x6a, 0x18, 0x00, 0x03, 0x2c, 0x81, 0xd6, 0xff, 0xff, 0xf8, 0xa7, 0x52, 0x04, 0x00, 0x0a, 0x18,
+	0x6d, 0xc2, 0xff, 0xff, 0xff, 0xc5, 0x70, 0x1b, 0x00, 0x0b, 0x11, 0x37, 0x6e, 0xa4, 0xd3, 0xf1, 0xfe, 0xfa, 0xe6, 0xc0, 0xa4, 0xb5, 0xdb, 0xfb,
+	0xff, 0xf4, 0xca, 0x7f, 0x34, 0x0a, 0x00, 0x81, 0x01, 0x09, 0x14, 0x18, 0x10, 0x05, 0x00, 0x08, 0x0a, 0x18, 0x27, 0x25, 0x16, 0x08, 0x00, 0x2d,
+	0x07, 0x28, 0x53, 0x76, 0x81, 0x68, 0x3d, 0x12, 0x00, 0x16, 0x1a, 0x45, 0x70, 0x81, 0x72, 0x4c, 0x21, 0x04, 0x00, 0x12, 0x0a, 0x34, 0x5f, 0x80,
+	0x7b, 0x60, 0x36, 0x10, 0x00, 0x07, 0x09, 0x28, 0x53, 0x75, 0x81, 0x6d, 0x42, 0x17, 0x00, 0x17, 0x0b, 0x44, 0x99, 0xe2, 0xfe, 0xe9, 0xa2, 0x4d,
+	0x0e, 0x00, 0x06, 0x08, 0x24, 0x49, 0x6a, 0x7e, 0x8e, 0x9f, 0xac, 0xb2, 0xb2, 0xac, 0xa4, 0x9a, 0x8c, 0x7c, 0x68, 0x46, 0x23, 0x07, 0x00, 0x02,
+	0x04, 0x2f, 0x80, 0xd0, 0xfa, 0xfb, 0xcd, 0x78, 0x27, 0x00, 0x05, 0x03, 0x33, 0x87, 0xd9, 0xfe, 0xff, 0xff, 0xde, 0x93, 0x3e, 0x0a, 0x00, 0x0b,
+	0x19, 0x5f, 0xb4, 0xf0, 0xff, 0xfa, 0xe6, 0xe6, 0xea, 0xff, 0xff, 0xf6, 0xc0, 0x6b, 0x1f, 0x00, 0x06, 0x0e, 0x63, 0xb8, 0xff, 0xff, 0xff, 0xc5,
+	0x70, 0x1b, 0x00, 0x09, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xe7, 0x92, 0x3d, 0x00, 0x08, 0x02, 0x3b, 0x90, 0xe2, 0xff, 0xff, 0xe6, 0x94, 0x3f, 0x03,
+	0x00, 0x07, 0x16, 0x68, 0xbd, 0xfc, 0xff, 0xfa, 0xbb, 0x66, 0x15, 0x00, 0x04, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x09, 0x0c,
+	0x37, 0x86, 0xcf, 0xf8, 0xff, 0xfa, 0xd0, 0x7b, 0x2b, 0x00, 0x0c, 0x07, 0x37, 0x85, 0xbd, 0xbc, 0x8d, 0x5a, 0x2c, 0x0e, 0x00, 0x02, 0x04, 0x27,
+	0x6b, 0xbb, 0xee, 0xff, 0xfe, 0xda, 0x8b, 0x37, 0x05, 0x00, 0x24, 0x02, 0x03, 0x03, 0x01, 0x00, 0x08, 0x04, 0x05, 0x05, 0x00, 0x0a, 0x2a, 0x62,
+	0x9a, 0xa9, 0xa9, 0x9b, 0x62, 0x2a, 0x00, 0x37, 0x13, 0x47, 0x92, 0xd4, 0xf4, 0xfe, 0xff, 0xfd, 0xf0, 0xd5, 0xae, 0x83, 0x58, 0x33, 0x1c, 0x1c,
+	0x3d, 0x8c, 0xd1, 0xfc, 0xba, 0x65, 0x11, 0x00, 0x2a, 0x03, 0x0c, 0x1a, 0x2a, 0x34, 0x33, 0x27, 0x16, 0x09, 0x01, 0x00, 0x17, 0x03, 0x0c, 0x1a,
+	0x2a, 0x34, 0x33, 0x27, 0x16, 0x09, 0x01, 0x00, 0x17, 0x03, 0x0c, 0x1a, 0x2a, 0x34, 0x33, 0x27, 0x16, 0x09, 0x01, 0x00, 0x1c, 0x2f, 0x81, 0xd6,
+	0xfc, 0xf5, 0xbd, 0x68, 0x1c, 0x00, 0x05, 0x1d, 0x52, 0x9c, 0xd4, 0xf3, 0xfe, 0xf2, 0xdf, 0xc5, 0xb1, 0xa2, 0x9b, 0x9e, 0xa9, 0xc1, 0xde, 0xf6,
+	0xff, 0xff, 0xbe, 0x69, 0x14, 0x00, 0x04, 0x10, 0x65, 0xba, 0xfe, 0xfe, 0xb8, 0x63, 0x0f, 0x00, 0x03, 0x07, 0x4f, 0xa4, 0xf2, 0xff, 0xff, 0xfb,
+	0xc6, 0x71, 0x20, 0x00, 0x0b, 0x12, 0x52, 0xa7, 0xea, 0xff, 0xfd, 0xd9, 0x8b, 0x3b, 0x53, 0xa1, 0xf3, 0xff, 0xff, 0xff, 0xe2, 0x8d, 0x38, 0x00,
+	0x05, 0x01, 0x46, 0x9b, 0xef, 0xff, 0xff, 0xf6, 0xad, 0x58, 0x0b, 0x00, 0x07, 0x26, 0x7b, 0xd0, 0xff, 0xff, 0xff, 0xc6, 0x71, 0x1c, 0x00, 0x0a,
+	0x30, 0x85, 0xd9, 0xff, 0xff, 0xe9, 0x99, 0x44, 0x04, 0x00, 0x05, 0x14, 0x65, 0xba, 0xfb, 0xff, 0xf9, 0xb7, 0x62, 0x12, 0x00, 0x05, 0x3f, 0x94,
+	0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x05, 0x02, 0x1a, 0x4b, 0x92, 0xcf, 0xf3, 0xff, 0xfc, 0xe3, 0xb0, 0x63, 0x27, 0x06, 0x00, 0x1b, 0x13,
+	0x5d, 0xb2, 0xf4, 0xff, 0xf7, 0xc1, 0x6c, 0x1f, 0x00, 0x21, 0x26, 0x72, 0xc6, 0xf4, 0xf3, 0xc0, 0x6c, 0x21, 0x00, 0x03, 0x11, 0x58, 0xab, 0xef,
+	0xf9, 0xe3, 0x91, 0x3f, 0x03, 0x00, 0x07, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x36, 0x27, 0x7b, 0xd0, 0xfb, 0xd8, 0xa9, 0x78,
+	0x6d, 0x77, 0x97, 0xbf, 0xe3, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xeb, 0xa8, 0x54, 0x12, 0x00, 0x25, 0x05, 0x1e, 0x4c, 0x89, 0xbe, 0xe3,
+	0xf5, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf0, 0xd4, 0xa7, 0x6d, 0x34, 0x10, 0x00, 0x0c, 0x05, 0x1e, 0x4c, 0x89, 0xbe, 0xe3, 0xf5,
+	0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf0, 0xd4, 0xa7, 0x6d, 0x34, 0x10, 0x00, 0x0c, 0x05, 0x1e, 0x4c, 0x89, 0xbe, 0xe3, 0xf5, 0xfd,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf0, 0xd4, 0xa7, 0x6d, 0x34, 0x10, 0x00, 0x16, 0x1c, 0x71, 0xc6, 0xff, 0xf9, 0xaa, 0x55, 0x05, 0x00,
+	0x04, 0x13, 0x56, 0xab, 0xed, 0xff, 0xf0, 0xbe, 0x72, 0x2c, 0x09, 0x00, 0x06, 0x37, 0x8c, 0xe1, 0xff, 0xff, 0xb0, 0x5b, 0x06, 0x00, 0x05, 0x38,
+	0x8d, 0xe2, 0xff, 0xe4, 0x8f, 0x3a, 0x00, 0x03, 0x26, 0x7b, 0xd0, 0xff, 0xff, 0xff, 0xcc, 0x77, 0x22, 0x00, 0x0a, 0x0c, 0x44, 0x99, 0xe2, 0xfe,
+	0xfe, 0xe2, 0x99, 0x44, 0x0c, 0x00, 0x01, 0x15, 0x6a, 0xbf, 0xfe, 0xff, 0xff, 0xfe, 0xb7, 0x62, 0x0d, 0x00, 0x05, 0x03, 0x31, 0x7f, 0xd1, 0xf8,
+	0xff, 0xf7, 0xdc, 0xb7, 0x8f, 0x70, 0x55, 0x4e, 0x5c, 0x7a, 0x99, 0xc5, 0xe7, 0xfe, 0xff, 0xeb, 0xaa, 0x55, 0x14, 0x00, 0x0c, 0x26, 0x7a, 0xcf,
+	0xfe, 0xff, 0xec, 0x9d, 0x48, 0x05, 0x00, 0x03, 0x13, 0x63, 0xb8, 0xfa, 0xff, 0xf7, 0xb2, 0x5d, 0x10, 0x00, 0x06, 0x3f, 0x94, 0xe9, 0xff, 0xff,
+	0xea, 0x95, 0x40, 0x00, 0x04, 0x2a, 0x79, 0xcd, 0xf8, 0xff, 0xf8, 0xd6, 0x9a, 0x4e, 0x1b, 0x03, 0x00, 0x10, 0x04, 0x19, 0x3f, 0x66, 0x81, 0x91,
+	0x9f, 0xae, 0xb8, 0xb9, 0xb1, 0xa3, 0x94, 0x84, 0x65, 0x40, 0x57, 0x99, 0xe7, 0xff, 0xff, 0xcd, 0x78, 0x23, 0x00, 0x20, 0x1f, 0x64, 0xb4, 0xe3,
+	0xe2, 0xae, 0x5f, 0x1b, 0x00, 0x03, 0x0c, 0x4c, 0x99, 0xdd, 0xe5, 0xc6, 0x75, 0x2e, 0x00, 0x08, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40,
+	0x00, 0x35, 0x01, 0x29, 0x54, 0x7e, 0x65, 0x3a, 0x0f, 0x00, 0x05, 0x08, 0x1e, 0x3d, 0x5a, 0x6b, 0x6d, 0x62, 0x42, 0x21, 0x07, 0x00, 0x25, 0x16,
+	0x5a, 0xae, 0xec, 0xfe, 0xff, 0xff, 0xf9, 0xe7, 0xc7, 0xa0, 0x78, 0x63, 0x68, 0x86, 0xae, 0xd4, 0xef, 0xfd, 0xff, 0xff, 0xf9, 0xd5, 0x86, 0x37,
+	0x06, 0x00, 0x07, 0x16, 0x5a, 0xae, 0xec, 0xfe, 0xff, 0xff, 0xf9, 0xe7, 0xc7, 0xa0, 0x78, 0x63, 0x68, 0x86, 0xae, 0xd4, 0xef, 0xfd, 0xff, 0xff,
+	0xf9, 0xd5, 0x86, 0x37, 0x06, 0x00, 0x07, 0x16, 0x5a, 0xae, 0xec, 0xfe, 0xff, 0xff, 0xf9, 0xe7, 0xc7, 0xa0, 0x78, 0x63, 0x68, 0x86, 0xae, 0xd4,
+	0xef, 0xfd, 0xff, 0xff, 0xf9, 0xd5, 0x86, 0x37, 0x06, 0x00, 0x13, 0x47, 0x9c, 0xf1, 0xff, 0xd7, 0x82, 0x2d, 0x00, 0x04, 0x0f, 0x64, 0xb9, 0xfe,
+	0xff, 0xe4, 0x92, 0x3d, 0x03, 0x00, 0x08, 0x45, 0x9a, 0xef, 0xff, 0xf6, 0xa1, 0x4c, 0x00, 0x06, 0x12, 0x67, 0xbc, 0xff, 0xfe, 0xb7, 0x62, 0x0e,
+	0x00, 0x02, 0x45, 0x9a, 0xef, 0xff, 0xff, 0xfe, 0xb0, 0x5b, 0x07, 0x00, 0x08, 0x07, 0x38, 0x8b, 0xd9, 0xfd, 0xff, 0xe9, 0xa6, 0x51, 0x11, 0x00,
+	0x04, 0x33, 0x88, 0xdd, 0xff, 0xff, 0xff, 0xdc, 0x87, 0x32, 0x00, 0x07, 0x02, 0x19, 0x47, 0x95, 0xd3, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf8,
+	0xef, 0xe1, 0xd2, 0xb6, 0x8d, 0x59, 0x29, 0x0b, 0x00, 0x0f, 0x1d, 0x70, 0xc5, 0xfc, 0xff, 0xef, 0xa0, 0x4b, 0x06, 0x00, 0x01, 0x11, 0x61, 0xb6,
+	0xfa, 0xff, 0xf6, 0xae, 0x59, 0x0d, 0x00, 0x07, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x03, 0x1c, 0x71, 0xc6, 0xff, 0xff, 0xfc,
+	0xaf, 0x5a, 0x08, 0x00, 0x10, 0x10, 0x42, 0x87, 0xca, 0xed, 0xfd, 0xff, 0xfe, 0xf8, 0xed, 0xde, 0xd0, 0xc7, 0xc9, 0xd6, 0xe6, 0xf4, 0xfc, 0xfb,
+	0xe4, 0xe0, 0xe4, 0xfa, 0xff, 0xfe, 0xc5, 0x70, 0x1b, 0x00, 0x3a, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x3d, 0x03, 0x0c, 0x1a,
+	0x2a, 0x34, 0x33, 0x27, 0x16, 0x09, 0x01, 0x00, 0x27, 0x08, 0x3f, 0x94, 0xe1, 0xff, 0xff, 0xf8, 0xb9, 0x6c, 0x1e, 0x08, 0x00, 0x07, 0x01, 0x0e,
+	0x35, 0x89, 0xd1, 0xff, 0xff, 0xf8, 0xc4, 0x70, 0x22, 0x00, 0x04, 0x08, 0x3f, 0x94, 0xe1, 0xff, 0xff, 0xf8, 0xb9, 0x6c, 0x1e, 0x08, 0x00, 0x07,
+	0x01, 0x0e, 0x35, 0x89, 0xd1, 0xff, 0xff, 0xf8, 0xc4, 0x70, 0x22, 0x00, 0x04, 0x08, 0x3f, 0x94, 0xe1, 0xff, 0xff, 0xf8, 0xb9, 0x6c, 0x1e, 0x08,
+	0x00, 0x07, 0x01, 0x0e, 0x35, 0x89, 0xd1, 0xff, 0xff, 0xf8, 0xc4, 0x70, 0x22, 0x00, 0x11, 0x1d, 0x72, 0xc7, 0xff, 0xfd, 0xb1, 0x5c, 0x09, 0x00,
+	0x04, 0x37, 0x8c, 0xe1, 0xff, 0xff, 0xb6, 0x61, 0x0c, 0x00, 0x08, 0x05, 0x58, 0xad, 0xfc, 0xff, 0xe8, 0x93, 0x3e, 0x00, 0x06, 0x1a, 0x6f, 0xc4,
+	0xff, 0xfe, 0xb0, 0x5b, 0x07, 0x00, 0x01, 0x0a, 0x5f, 0xb4, 0xff, 0xff, 0xff, 0xee, 0x99, 0x44, 0x00, 0x07, 0x03, 0x2d, 0x7e, 0xcf, 0xfa, 0xff,
+	0xef, 0xb3, 0x5e, 0x18, 0x00, 0x06, 0x05, 0x57, 0xac, 0xfc, 0xff, 0xff, 0xfa, 0xa6, 0x51, 0x01, 0x00, 0x06, 0x23, 0x64, 0xb8, 0xea, 0xf3, 0xc2,
+	0x79, 0x31, 0x11, 0x08, 0x07, 0x03, 0x00, 0x18, 0x15, 0x65, 0xba, 0xf9, 0xff, 0xed, 0x9c, 0x47, 0x10, 0x5a, 0xaf, 0xf8, 0xff, 0xf4, 0xaa, 0x55,
+	0x0b, 0x00, 0x08, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x03, 0x08, 0x4a, 0x9f, 0xec, 0xff, 0xff, 0xf4, 0xce, 0x92, 0x4d, 0x1e,
+	0x05, 0x00, 0x0b, 0x08, 0x3c, 0x90, 0xdd, 0xfe, 0xff, 0xfc, 0xd8, 0x9e, 0x52, 0x21, 0x06, 0x00, 0x06, 0x0d, 0x2f, 0x69, 0xb1, 0xe4, 0xfe, 0xff,
+	0xff, 0xff, 0xee, 0x99, 0x44, 0x00, 0x24, 0x03, 0x0c, 0x1a, 0x2a, 0x34, 0x33, 0x27, 0x16, 0x09, 0x01, 0x00, 0x0c, 0x3f, 0x94, 0xe9, 0xff, 0xff,
+	0xe8, 0x93, 0x3e, 0x00, 0x03, 0x05, 0x11, 0x21, 0x2f, 0x37, 0x35, 0x2a, 0x18, 0x0a, 0x02, 0x00, 0x2a, 0x05, 0x1e, 0x4c, 0x89, 0xbe, 0xe3, 0xf5,
+	0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf0, 0xd4, 0xa7, 0x6d, 0x34, 0x10, 0x00, 0x22, 0x42, 0x97, 0xec, 0xff, 0xff, 0xff, 0xc7, 0x72,
+	0x1d, 0x00, 0x0c, 0x3a, 0x8f, 0xe4, 0xff, 0xff, 0xff, 0xcc, 0x77, 0x22, 0x00, 0x03, 0x42, 0x97, 0xec, 0xff, 0xff, 0xff, 0xc7, 0x72, 0x1d, 0x00,
+	0x0c, 0x3a, 0x8f, 0xe4, 0xff, 0xff, 0xff, 0xcc, 0x77, 0x22, 0x00, 0x03, 0x42, 0x97, 0xec, 0xff, 0xff, 0xff, 0xc7, 0x72, 0x1d, 0x00, 0x0c, 0x3a,
+	0x8f, 0xe4, 0xff, 0xff, 0xff, 0xcc, 0x77, 0x22, 0x00, 0x10, 0x2e, 0x83, 0xd8, 0xff, 0xf8, 0xa6, 0x51, 0x02, 0x00, 0x04, 0x32, 0x87, 0xdc, 0xff,
+	0xff, 0xce, 0x79, 0x24, 0x00, 0x08, 0x28, 0x7d, 0xd2, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x05, 0x03, 0x44, 0x99, 0xeb, 0xff, 0xd9, 0x84, 0x2f,
+	0x00, 0x03, 0x49, 0x9e, 0xf3, 0xff, 0xff, 0xfb, 0xa8, 0x53, 0x02, 0x00, 0x04, 0x01, 0x23, 0x70, 0xc3, 0xf6, 0xff, 0xf5, 0xbf, 0x6b, 0x20, 0x00,
+	0x08, 0x0c, 0x61, 0xb6, 0xff, 0xff, 0xff, 0xe7, 0x92, 0x3d, 0x00, 0x06, 0x1c, 0x71, 0xc6, 0xff, 0xff, 0xd7, 0x85, 0x30, 0x03, 0x00, 0x1d, 0x0e,
+	0x5a, 0xaf, 0xf5, 0xff, 0xe2, 0x91, 0x83, 0xa0, 0xf1, 0xff, 0xf2, 0xa6, 0x51, 0x09, 0x00, 0x09, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40,
+	0x00, 0x05, 0x15, 0x46, 0x8d, 0xcd, 0xf2, 0xfe, 0xff, 0xfe, 0xf1, 0xcf, 0x9a, 0x5d, 0x29, 0x0a, 0x00, 0x06, 0x01, 0x4c, 0xa1, 0xf4, 0xff, 0xff,
+	0xf2, 0xab, 0x56, 0x0e, 0x00, 0x0c, 0x15, 0x63, 0xb8, 0xf8, 0xff, 0xff, 0xfe, 0xb1, 0x5c, 0x07, 0x00, 0x1d, 0x05, 0x1e, 0x4c, 0x89, 0xbe, 0xe3,
+	0xf5, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf0, 0xd4, 0xa7, 0x6d, 0x34, 0x10, 0x00, 0x07, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xe0, 0x8d,
+	0x51, 0x4b, 0x8d, 0xc3, 0xe8, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xee, 0xcb, 0x94, 0x51, 0x1f, 0x05, 0x00, 0x23, 0x16, 0x5a, 0xae,
+	0xec, 0xfe, 0xff, 0xff, 0xf9, 0xe7, 0xc7, 0xa0, 0x78, 0x63, 0x68, 0x86, 0xae, 0xd4, 0xef, 0xfd, 0xff, 0xff, 0xf9, 0xd5, 0x86, 0x37, 0x06, 0x00,
+	0x1e, 0x10, 0x65, 0xba, 0xff, 0xff, 0xff, 0xe6, 0x91, 0x3c, 0x00, 0x0d, 0x08, 0x57, 0xac, 0xf9, 0xff, 0xff, 0xf2, 0x9e, 0x49, 0x00, 0x02, 0x10,
+	0x65, 0xba, 0xff, 0xff, 0xff, 0xe6, 0x91, 0x3c, 0x00, 0x0d, 0x08, 0x57, 0xac, 0xf9, 0xff, 0xff, 0xf2, 0x9e, 0x49, 0x00, 0x02, 0x10, 0x65, 0xba,
+	0xff, 0xff, 0xff, 0xe6, 0x91, 0x3c, 0x00, 0x0d, 0x08, 0x57, 0xac, 0xf9, 0xff, 0xff, 0xf2, 0x9e, 0x49, 0x00, 0x10, 0x09, 0x5c, 0xb1, 0xfd, 0xff,
+	0xca, 0x75, 0x20, 0x00, 0x04, 0x0d, 0x58, 0xad, 0xf5, 0xff, 0xfd, 0xbe, 0x6a, 0x17, 0x00, 0x05, 0x08, 0x35, 0x8a, 0xd6, 0xfe, 0xfe, 0xfe, 0xf5,
+	0xa9, 0x54, 0x08, 0x00, 0x03, 0x11, 0x51, 0xa6, 0xe9, 0xfe, 0xda, 0x87, 0x32, 0x02, 0x00, 0x03, 0x27, 0x7c, 0xd1, 0xff, 0xff, 0xff, 0xc1, 0x6c,
+	0x17, 0x00, 0x03, 0x1a, 0x62, 0xb7, 0xf1, 0xff, 0xf9, 0xcb, 0x78, 0x29, 0x02, 0x00, 0x09, 0x26, 0x7b, 0xd0, 0xff, 0xff, 0xff, 0xc5, 0x70, 0x1b,
+	0x00, 0x06, 0x02, 0x35, 0x82, 0xd4, 0xf7, 0xff, 0xfd, 0xf6, 0xe9, 0xdd, 0xd6, 0xd4, 0xd4, 0xd4, 0xd4, 0xd2, 0xcd, 0xc3, 0xb6, 0xa9, 0x94, 0x73,
+	0x45, 0x1d, 0x06, 0x00, 0x0e, 0x09, 0x4f, 0xa4, 0xf0, 0xff, 0xec, 0xec, 0xec, 0xff, 0xef, 0xa2, 0x4d, 0x07, 0x00, 0x0a, 0x3f, 0x94, 0xe9, 0xff,
+	0xff, 0xea, 0x95, 0x40, 0x00, 0x08, 0x07, 0x22, 0x51, 0x8c, 0xc4, 0xea, 0xfd, 0xff, 0xff, 0xf2, 0xc9, 0x80, 0x38, 0x0c, 0x00, 0x03, 0x1d, 0x72,
+	0xc7, 0xff, 0xff, 0xff, 0xcb, 0x76, 0x21, 0x00, 0x0e, 0x2d, 0x82, 0xd7, 0xff, 0xff, 0xff, 0xb7, 0x62, 0x0d, 0x00, 0x1b, 0x16, 0x5a, 0xae, 0xec,
+	0xfe, 0xff, 0xff, 0xf9, 0xe7, 0xc7, 0xa0, 0x78, 0x63, 0x68, 0x86, 0xae, 0xd4, 0xef, 0xfd, 0xff, 0xff, 0xf9, 0xd5, 0x86, 0x37, 0x06, 0x00, 0x04,
+	0x3f, 0x94, 0xe9, 0xff, 0xff, 0xf0, 0xe8, 0xe8, 0xf3, 0xe4, 0xba, 0x8d, 0x70, 0x5f, 0x55, 0x5f, 0x7d, 0xa9, 0xd2, 0xef, 0xfd, 0xff, 0xff, 0xfd,
+	0xe2, 0x95, 0x41, 0x08, 0x00, 0x1f, 0x08, 0x3f, 0x94, 0xe1, 0xff, 0xff, 0xf8, 0xb9, 0x6c, 0x1e, 0x08, 0x00, 0x07, 0x01, 0x0e, 0x35, 0x89, 0xd1,
+	0xff, 0xff, 0xf8, 0xc4, 0x70, 0x22, 0x00, 0x1d, 0x29, 0x7e, 0xd3, 0xff, 0xff, 0xff, 0xbf, 0x6a, 0x15, 0x00, 0x0e, 0x2f, 0x84, 0xd9, 0xff, 0xff,
+	0xff, 0xb9, 0x64, 0x0f, 0x00, 0x01, 0x29, 0x7e, 0xd3, 0xff, 0xff, 0xff, 0xbf, 0x6a, 0x15, 0x00, 0x0e, 0x2f, 0x84, 0xd9, 0xff, 0xff, 0xff, 0xb9,
+	0x64, 0x0f, 0x00, 0x01, 0x29, 0x7e, 0xd3, 0xff, 0xff, 0xff, 0xbf, 0x6a, 0x15, 0x00, 0x0e, 0x2f, 0x84, 0xd9, 0xff, 0xff, 0xff, 0xb9, 0x64, 0x0f,
+	0x00, 0x10, 0x34, 0x89, 0xde, 0xff, 0xef, 0x9c, 0x47, 0x01, 0x00, 0x04, 0x04, 0x34, 0x81, 0xd2, 0xf7, 0xff, 0xfc, 0xed, 0xd2, 0xaf, 0x9b, 0x9a,
+	0xae, 0xd0, 0xec, 0xf2, 0xc5, 0x79, 0x70, 0x9d, 0xe9, 0xfa, 0xe0, 0xbb, 0x9a, 0x99, 0xae, 0xd4, 0xef, 0xfd, 0xe1, 0xa0, 0x4d, 0x14, 0x00, 0x05,
+	0x07, 0x5b, 0xb0, 0xfd, 0xff, 0xff, 0xf3, 0xaa, 0x55, 0x0c, 0x13, 0x54, 0xa9, 0xeb, 0xff, 0xfc, 0xd5, 0x86, 0x33, 0x05, 0x00, 0x0a, 0x14, 0x61,
+	0xb6, 0xf7, 0xff, 0xff, 0xf3, 0x9f, 0x4a, 0x01, 0x00, 0x04, 0x04, 0x1a, 0x44, 0x76, 0x9f, 0xc8, 0xe8, 0xf6, 0xed, 0xde, 0xd6, 0xd2, 0xd1, 0xd1,
+	0xd1, 0xd1, 0xd3, 0xd7, 0xdd, 0xe8, 0xf4, 0xfd, 0xff, 0xff, 0xfe, 0xe6, 0xa1, 0x4d, 0x10, 0x00, 0x0d, 0x05, 0x45, 0x9a, 0xe9, 0xff, 0xff, 0xff,
+	0xed, 0x9e, 0x49, 0x06, 0x00, 0x0b, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x0c, 0x03, 0x1c, 0x52, 0xa3, 0xdf, 0xfe, 0xff, 0xfd,
+	0xd6, 0x81, 0x2e, 0x00, 0x02, 0x28, 0x7d, 0xd2, 0xff, 0xff, 0xff, 0xbf, 0x6a, 0x15, 0x00, 0x0d, 0x05, 0x50, 0xa5, 0xf5, 0xff, 0xff, 0xeb, 0x96,
+	0x41, 0x00, 0x1a, 0x08, 0x3f, 0x94, 0xe1, 0xff, 0xff, 0xf8, 0xb9, 0x6c, 0x1e, 0x08, 0x00, 0x07, 0x01, 0x0e, 0x35, 0x89, 0xd1, 0xff, 0xff, 0xf8,
+	0xc4, 0x70, 0x22, 0x00, 0x03, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xff, 0xfd, 0xca, 0x79, 0x26, 0x03, 0x00, 0x07, 0x02, 0x11, 0x4c, 0x9f, 0xe5, 0xff,
+	0xff, 0xf8, 0xbe, 0x69, 0x1b, 0x00, 0x1e, 0x42, 0x97, 0xec, 0xff, 0xff, 0xff, 0xc7, 0x72, 0x1d, 0x00, 0x0c, 0x3a, 0x8f, 0xe4, 0xff, 0xff, 0xff,
+	0xcc, 0x77, 0x22, 0x00, 0x1c, 0x0c, 0x60, 0xb5, 0xfe, 0xff, 0xff, 0xea, 0x96, 0x41, 0x00, 0x0d, 0x0a, 0x5b, 0xb0, 0xfa, 0xff, 0xff, 0xf1, 0x9d,
+	0x48, 0x00, 0x02, 0x0c, 0x60, 0xb5, 0xfe, 0xff, 0xff, 0xea, 0x96, 0x41, 0x00, 0x0d, 0x0a, 0x5b, 0xb0, 0xfa, 0xff, 0xff, 0xf1, 0x9d, 0x48, 0x00,
+	0x02, 0x0c, 0x60, 0xb5, 0xfe, 0xff, 0xff, 0xea, 0x96, 0x41, 0x00, 0x0d, 0x0a, 0x5b, 0xb0, 0xfa, 0xff, 0xff, 0xf1, 0x9d, 0x48, 0x00, 0x11, 0x0a,
+	0x4d, 0xa2, 0xed, 0xff, 0xf1, 0xb5, 0x60, 0x19, 0x00, 0x06, 0x0f, 0x33, 0x61, 0x87, 0x9c, 0xae, 0xb9, 0xba, 0xb1, 0x9e, 0x82, 0x58, 0x2c, 0x0d,
+	0x00, 0x02, 0x0f, 0x33, 0x67, 0x93, 0xae, 0xb9, 0xb7, 0xac, 0x96, 0x74, 0x45, 0x1b, 0x05, 0x00, 0x08, 0x13, 0x57, 0xac, 0xee, 0xff, 0xff, 0xf9,
+	0xc2, 0xa7, 0xad, 0xe3, 0xfe, 0xfe, 0xde, 0x92, 0x3e, 0x09, 0x00, 0x0b, 0x24, 0x77, 0xcc, 0xfd, 0xff, 0xfe, 0xdd, 0x8c, 0x38, 0x04, 0x00, 0x03,
+	0x07, 0x39, 0x8c, 0xd9, 0xfc, 0xfc, 0xd9, 0x98, 0x4a, 0x18, 0x05, 0x00, 0x0b, 0x0a, 0x32, 0x86, 0xd1, 0xff, 0xff, 0xfc, 0xb0, 0x5b, 0x08, 0x00,
+	0x0d, 0x30, 0x85, 0xda, 0xff, 0xff, 0xea, 0x99, 0x44, 0x04, 0x00, 0x0c, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x0f, 0x1a, 0x6f,
+	0xc4, 0xff, 0xff, 0xff, 0xc2, 0x6d, 0x18, 0x00, 0x01, 0x05, 0x55, 0xaa, 0xfa, 0xff, 0xff, 0xe0, 0x8c, 0x37, 0x00, 0x0d, 0x35, 0x8a, 0xdf, 0xff,
+	0xff, 0xfe, 0xc6, 0x71, 0x1d, 0x00, 0x1a, 0x42, 0x97, 0xec, 0xff, 0xff, 0xff, 0xc7, 0x72, 0x1d, 0x00, 0x0c, 0x3a, 0x8f, 0xe4, 0xff, 0xff, 0xff,
+	0xcc, 0x77, 0x22, 0x00, 0x02, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xff, 0xc5, 0x70, 0x1b, 0x00, 0x0b, 0x08, 0x58, 0xad, 0xfa, 0xff, 0xff, 0xfe, 0xb3,
+	0x5e, 0x0a, 0x00, 0x1c, 0x10, 0x65, 0xba, 0xff, 0xff, 0xff, 0xe6, 0x91, 0x3c, 0x00, 0x0d, 0x08, 0x57, 0xac, 0xf9, 0xff, 0xff, 0xf2, 0x9e, 0x49,
+	0x00, 0x1d, 0x3b, 0x90, 0xe5, 0xff, 0xff, 0xff, 0xcd, 0x78, 0x23, 0x00, 0x0c, 0x3d, 0x92, 0xe7, 0xff, 0xff, 0xff, 0xce, 0x79, 0x24, 0x00, 0x03,
+	0x3b, 0x90, 0xe5, 0xff, 0xff, 0xff, 0xcd, 0x78, 0x23, 0x00, 0x0c, 0x3d, 0x92, 0xe7, 0xff, 0xff, 0xff, 0xce, 0x79, 0x24, 0x00, 0x03, 0x3b, 0x90,
+	0xe5, 0xff, 0xff, 0xff, 0xcd, 0x78, 0x23, 0x00, 0x0c, 0x3d, 0x92, 0xe7, 0xff, 0xff, 0xff, 0xce, 0x79, 0x24, 0x00, 0x13, 0x1c, 0x64, 0xb8, 0xf2,
+	0xff, 0xe8, 0xa5, 0x51, 0x13, 0x01, 0x00, 0x2a, 0x21, 0x6f, 0xc3, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xa0, 0x4b, 0x0f, 0x00, 0x09, 0x04,
+	0x1e, 0x51, 0x98, 0xd2, 0xf5, 0xff, 0xff, 0xf4, 0xb6, 0x61, 0x16, 0x00, 0x05, 0x39, 0x8e, 0xe3, 0xff, 0xff, 0xd6, 0x81, 0x2c, 0x00, 0x0f, 0x17,
+	0x68, 0xbd, 0xfb, 0xff, 0xfd, 0xb7, 0x62, 0x0e, 0x00, 0x0b, 0x02, 0x36, 0x8b, 0xde, 0xff, 0xff, 0xe4, 0x93, 0x3e, 0x03, 0x00, 0x0d, 0x3f, 0x94,
+	0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x01, 0x06, 0x06, 0x06, 0x00, 0x0b, 0x24, 0x79, 0xce, 0xff, 0xff, 0xfc, 0xb2, 0x5d, 0x0a, 0x00, 0x02,
+	0x1a, 0x65, 0xba, 0xf4, 0xff, 0xff, 0xe9, 0xa4, 0x50, 0x11, 0x00, 0x08, 0x02, 0x0f, 0x34, 0x87, 0xcf, 0xff, 0xff, 0xf3, 0xb4, 0x5f, 0x16, 0x00,
+	0x1a, 0x10, 0x65, 0xba, 0xff, 0xff, 0xff, 0xe6, 0x91, 0x3c, 0x00, 0x0d, 0x08, 0x57, 0xac, 0xf9, 0xff, 0xff, 0xf2, 0x9e, 0x49, 0x00, 0x02, 0x3f,
+	0x94, 0xe9, 0xff, 0xff, 0xfa, 0xa6, 0x51, 0x00, 0x0d, 0x24, 0x79, 0xce, 0xff, 0xff, 0xff, 0xd2, 0x7d, 0x28, 0x00, 0x1c, 0x29, 0x7e, 0xd3, 0xff,
+	0xff, 0xff, 0xbf, 0x6a, 0x15, 0x00, 0x0e, 0x2f, 0x84, 0xd9, 0xff, 0xff, 0xff, 0xb9, 0x64, 0x0f, 0x00, 0x1c, 0x03, 0x30, 0x83, 0xd5, 0xfd, 0xff,
+	0xfa, 0xc2, 0x7b, 0x2c, 0x10, 0x02, 0x00, 0x06, 0x04, 0x16, 0x41, 0x91, 0xd5, 0xff, 0xff, 0xf8, 0xc3, 0x6f, 0x20, 0x00, 0x04, 0x03, 0x30, 0x83,
+	0xd5, 0xfd, 0xff, 0xfa, 0xc2, 0x7b, 0x2c, 0x10, 0x02, 0x00, 0x06, 0x04, 0x16, 0x41, 0x91, 0xd5, 0xff, 0xff, 0xf8, 0xc3, 0x6f, 0x20, 0x00, 0x04,
+	0x03, 0x30, 0x83, 0xd5, 0xfd, 0xff, 0xfa, 0xc2, 0x7b, 0x2c, 0x10, 0x02, 0x00, 0x06, 0x04, 0x16, 0x41, 0x91, 0xd5, 0xff, 0xff, 0xf8, 0xc3, 0x6f,
+	0x20, 0x00, 0x15, 0x01, 0x23, 0x6c, 0xbf, 0xf2, 0xff, 0xfa, 0xe5, 0xbe, 0x88, 0x52, 0x24, 0x09, 0x00, 0x0f, 0x01, 0x09, 0x1b, 0x36, 0x35, 0x23,
+	0x07, 0x00, 0x11, 0x09, 0x54, 0xa9, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xeb, 0xd0, 0xb0, 0x98, 0x89, 0x7f, 0x7a, 0x7e, 0x8b, 0x9c, 0xad, 0xbf,
+	0xd8, 0xed, 0xfc, 0xff, 0xfe, 0xee, 0xc8, 0x8d, 0x4c, 0x1c, 0x03, 0x00, 0x06, 0x2a, 0x7f, 0xd4, 0xff, 0xff, 0xea, 0xa2, 0x4d, 0x0d, 0x00, 0x0c,
+	0x0a, 0x44, 0x99, 0xe3, 0xff, 0xff, 0xfe, 0xd3, 0x7e, 0x2a, 0x00, 0x0a, 0x01, 0x1a, 0x5f, 0xb3, 0xee, 0xff, 0xfe, 0xd3, 0x7e, 0x2a, 0x00, 0x0f,
+	0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x01, 0x47, 0x95, 0xd6, 0xc5, 0xa3, 0x87, 0x70, 0x5f, 0x54, 0x53, 0x57, 0x63, 0x7a, 0xa1,
+	0xd0, 0xf1, 0xff, 0xff, 0xf1, 0xb9, 0x64, 0x1d, 0x00, 0x04, 0x02, 0x27, 0x73, 0xc6, 0xf6, 0xff, 0xff, 0xf8, 0xdc, 0xb4, 0x8d, 0x76, 0x67, 0x62,
+	0x70, 0x8f, 0xb5, 0xd9, 0xf1, 0xfd, 0xff, 0xff, 0xf3, 0xcb, 0x79, 0x30, 0x03, 0x00, 0x1b, 0x29, 0x7e, 0xd3, 0xff, 0xff, 0xff, 0xbf, 0x6a, 0x15,
+	0x00, 0x0e, 0x2f, 0x84, 0xd9, 0xff, 0xff, 0xff, 0xb9, 0x64, 0x0f, 0x00, 0x01, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xee, 0x99, 0x44, 0x00, 0x0d, 0x03,
+	0x55, 0xaa, 0xfc, 0xff, 0xff, 0xe8, 0x93, 0x3e, 0x00, 0x1c, 0x0c, 0x60, 0xb5, 0xfe, 0xff, 0xff, 0xea, 0x96, 0x41, 0x00, 0x0d, 0x0a, 0x5b, 0xb0,
+	0xfa, 0xff, 0xff, 0xf1, 0x9d, 0x48, 0x00, 0x1f, 0x0d, 0x47, 0x98, 0xdf, 0xfa, 0xff, 0xff, 0xfd, 0xf1, 0xd7, 0xb0, 0x88, 0x71, 0x74, 0x92, 0xbb,
+	0xdf, 0xf5, 0xfe, 0xff, 0xff, 0xf8, 0xd6, 0x87, 0x39, 0x06, 0x00, 0x07, 0x0d, 0x47, 0x98, 0xdf, 0xfa, 0xff, 0xff, 0xfd, 0xf1, 0xd7, 0xb0, 0x88,
+	0x71, 0x74, 0x92, 0xbb, 0xdf, 0xf5, 0xfe, 0xff, 0xff, 0xf8, 0xd6, 0x87, 0x39, 0x06, 0x00, 0x07, 0x0d, 0x47, 0x98, 0xdf, 0xfa, 0xff, 0xff, 0xfd,
+	0xf1, 0xd7, 0xb0, 0x88, 0x71, 0x74, 0x92, 0xbb, 0xdf, 0xf5, 0xfe, 0xff, 0xff, 0xf8, 0xd6, 0x87, 0x39, 0x06, 0x00, 0x19, 0x06, 0x1f, 0x48, 0x7d,
+	0xb2, 0xdd, 0xf7, 0xff, 0xfa, 0xf1, 0xe4, 0xd6, 0xc8, 0xbb, 0xae, 0xa0, 0x96, 0x91, 0x92, 0x97, 0x9e, 0xa9, 0xb6, 0xc5, 0xd7, 0xe9, 0xf7, 0xfe,
+	0xff, 0xbb, 0x66, 0x11, 0x00, 0x0f, 0x02, 0x26, 0x74, 0xc7, 0xf8, 0xff, 0xf3, 0xca, 0xa6, 0x95, 0xa6, 0xb9, 0xcc, 0xdf, 0xf0, 0xfa, 0xff, 0xff,
+	0xff, 0xff, 0xfc, 0xf4, 0xe6, 0xd5, 0xc4, 0xae, 0x88, 0x53, 0x22, 0x06, 0x00, 0x0a, 0x02, 0x24, 0x68, 0xbb, 0xee, 0xff, 0xfe, 0xf2, 0xd8, 0xb4,
+	0x98, 0x86, 0x7d, 0x78, 0x7c, 0x89, 0x9b, 0xac, 0xbe, 0xcf, 0xe0, 0xf0, 0xfa, 0xff, 0xff, 0xf5, 0xcb, 0x80, 0x34, 0x09, 0x00, 0x03, 0x0a, 0x41,
+	0x73, 0x99, 0x92, 0x94, 0x9a, 0xac, 0xc9, 0xe7, 0xfa, 0xff, 0xfd, 0xdd, 0x95, 0x42, 0x0d, 0x00, 0x10, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95,
+	0x40, 0x00, 0x01, 0x28, 0x63, 0xab, 0xd5, 0xef, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf2, 0xd7, 0xb0, 0x7f, 0x44, 0x18, 0x00,
+	0x09, 0x0c, 0x29, 0x59, 0x8f, 0xbe, 0xdf, 0xf3, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf2, 0xe3, 0xc7, 0x9b, 0x5f, 0x29, 0x0a, 0x00, 0x1e,
+	0x0c, 0x60, 0xb5, 0xfe, 0xff, 0xff, 0xea, 0x96, 0x41, 0x00, 0x0d, 0x0a, 0x5b, 0xb0, 0xfa, 0xff, 0xff, 0xf1, 0x9d, 0x48, 0x00, 0x02, 0x3f, 0x94,
+	0xe9, 0xff, 0xff, 0xfb, 0xa8, 0x53, 0x01, 0x00, 0x0c, 0x2a, 0x7f, 0xd4, 0xff, 0xff, 0xff, 0xd0, 0x7b, 0x26, 0x00, 0x1d, 0x3b, 0x90, 0xe5, 0xff,
+	0xff, 0xff, 0xcd, 0x78, 0x23, 0x00, 0x0c, 0x3d, 0x92, 0xe7, 0xff, 0xff, 0xff, 0xce, 0x79, 0x24, 0x00, 0x21, 0x01, 0x13, 0x39, 0x73, 0xa9, 0xd1,
+	0xe9, 0xf6, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf3, 0xe5, 0xca, 0xa0, 0x67, 0x30, 0x0e, 0x00, 0x0c, 0x01, 0x13, 0x39, 0x73, 0xa9, 0xd1, 0xe9,
+	0xf6, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf3, 0xe5, 0xca, 0xa0, 0x67, 0x30, 0x0e, 0x00, 0x0c, 0x01, 0x13, 0x39, 0x73, 0xa9, 0xd1, 0xe9, 0xf6,
+	0xfd, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf3, 0xe5, 0xca, 0xa0, 0x67, 0x30, 0x0e, 0x00, 0x21, 0x09, 0x23, 0x43, 0x5d, 0x6c, 0x7a, 0x87, 0x95, 0xa2,
+	0xb0, 0xbd, 0xc8, 0xcc, 0xc9, 0xc2, 0xba, 0xb2, 0xaa, 0xa1, 0x92, 0x7d, 0x63, 0x48, 0x2e, 0x16, 0x07, 0x00, 0x11, 0x0b, 0x25, 0x50, 0x80, 0x89,
+	0x60, 0x26, 0x02, 0x00, 0x05, 0x02, 0x0a, 0x18, 0x24, 0x24, 0x19, 0x0b, 0x03, 0x00, 0x15, 0x0c, 0x26, 0x4d, 0x76, 0x9a, 0xb6, 0xc7, 0xd1, 0xdb,
+	0xe4, 0xeb, 0xeb, 0xe5, 0xdc, 0xd3, 0xc9, 0xc0, 0xb4, 0xa0, 0x82, 0x5d, 0x38, 0x19, 0x06, 0x00, 0x06, 0x0c, 0x52, 0x9d, 0xdf, 0xe8, 0xed, 0xeb,
+	0xe3, 0xd5, 0xc5, 0xaa, 0x80, 0x49, 0x1d, 0x05, 0x00, 0x1f, 0x05, 0x0c, 0x16, 0x1e, 0x27, 0x2c, 0x2a, 0x22, 0x18, 0x0d, 0x05, 0x01, 0x00, 0x13,
+	0x01, 0x07, 0x12, 0x20, 0x27, 0x24, 0x16, 0x09, 0x02, 0x00, 0x25, 0x3b, 0x90, 0xe5, 0xff, 0xff, 0xff, 0xcd, 0x78, 0x23, 0x00, 0x0c, 0x3d, 0x92,
+	0xe7, 0xff, 0xff, 0xff, 0xce, 0x79, 0x24, 0x00, 0x02, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xff, 0xcd, 0x78, 0x23, 0x00, 0x0b, 0x0c, 0x5f, 0xb4, 0xfc,
+	0xff, 0xff, 0xfd, 0xb1, 0x5c, 0x08, 0x00, 0x1d, 0x03, 0x30, 0x83, 0xd5, 0xfd, 0xff, 0xfa, 0xc2, 0x7b, 0x2c, 0x10, 0x02, 0x00, 0x06, 0x04, 0x16,
+	0x41, 0x91, 0xd5, 0xff, 0xff, 0xf8, 0xc3, 0x6f, 0x20, 0x00, 0x29, 0x04, 0x0e, 0x1d, 0x26, 0x24, 0x17, 0x0a, 0x02, 0x00, 0x19, 0x04, 0x0e, 0x1d,
+	0x26, 0x24, 0x17, 0x0a, 0x02, 0x00, 0x19, 0x04, 0x0e, 0x1d, 0x26, 0x24, 0x17, 0x0a, 0x02, 0x00, 0xff, 0x00, 0x16, 0x03, 0x30, 0x83, 0xd5, 0xfd,
+	0xff, 0xfa, 0xc2, 0x7b, 0x2c, 0x10, 0x02, 0x00, 0x06, 0x04, 0x16, 0x41, 0x91, 0xd5, 0xff, 0xff, 0xf8, 0xc3, 0x6f, 0x20, 0x00, 0x03, 0x3f, 0x94,
+	0xe9, 0xff, 0xff, 0xff, 0xfe, 0xd5, 0x89, 0x34, 0x09, 0x00, 0x07, 0x08, 0x21, 0x62, 0xae, 0xeb, 0xff, 0xff, 0xf5, 0xb5, 0x60, 0x15, 0x00, 0x20,
+	0x0d, 0x47, 0x98, 0xdf, 0xfa, 0xff, 0xff, 0xfd, 0xf1, 0xd7, 0xb0, 0x88, 0x71, 0x74, 0x92, 0xbb, 0xdf, 0xf5, 0xfe, 0xff, 0xff, 0xf8, 0xd6, 0x87,
+	0x39, 0x06, 0x00, 0x97, 0x1c, 0x55, 0x8d, 0xa9, 0xa9, 0xa8, 0x70, 0x37, 0x00, 0x01, 0x03, 0x08, 0x0c, 0x0e, 0x0c, 0x08, 0x03, 0x00, 0x04, 0x04,
+	0x10, 0x1f, 0x2e, 0x36, 0x34, 0x2a, 0x18, 0x0a, 0x02, 0x00, 0x14, 0x07, 0x13, 0x25, 0x33, 0x36, 0x30, 0x22, 0x12, 0x06, 0x00, 0x04, 0x02, 0x06,
+	0x0b, 0x0e, 0x0e, 0x09, 0x04, 0x00, 0x06, 0x23, 0x65, 0xa8, 0xc9, 0xcb, 0xcb, 0xc8, 0x99, 0x55, 0x15, 0x00, 0x1f, 0x26, 0x6a, 0xad, 0xcb, 0xcb,
+	0xcb, 0xc3, 0x93, 0x50, 0x13, 0x00, 0x0f, 0x02, 0x27, 0x6a, 0xab, 0xca, 0xcb, 0xcb, 0xcb, 0xb1, 0x71, 0x2d, 0x03, 0x00, 0x12, 0x03, 0x03, 0x03,
+	0x00, 0x08, 0x04, 0x05, 0x05, 0x01, 0x00, 0x08, 0x03, 0x08, 0x0c, 0x0e, 0x0e, 0x0c, 0x08, 0x03, 0x00, 0x0d, 0x04, 0x09, 0x0e, 0x0e, 0x0e, 0x0b,
+	0x06, 0x02, 0x00, 0x14, 0x0d, 0x47, 0x98, 0xdf, 0xfa, 0xff, 0xff, 0xfd, 0xf1, 0xd7, 0xb0, 0x88, 0x71, 0x74, 0x92, 0xbb, 0xdf, 0xf5, 0xfe, 0xff,
+	0xff, 0xf8, 0xd6, 0x87, 0x39, 0x06, 0x00, 0x04, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xe6, 0xdc, 0xdc, 0xf4, 0xed, 0xc9, 0x9f, 0x80, 0x6f, 0x64, 0x6d,
+	0x8c, 0xbb, 0xe1, 0xf8, 0xff, 0xff, 0xff, 0xfb, 0xda, 0x8a, 0x39, 0x05, 0x00, 0x23, 0x01, 0x13, 0x39, 0x73, 0xa9, 0xd1, 0xe9, 0xf6, 0xfd, 0xff,
+	0xff, 0xff, 0xff, 0xfc, 0xf3, 0xe5, 0xca, 0xa0, 0x67, 0x30, 0x0e, 0x00, 0x0c, 0x0a, 0x40, 0x84, 0xbd, 0xcb, 0xcb, 0xcb, 0xb9, 0x7a, 0x37, 0x04,
+	0x00, 0x1d, 0x09, 0x43, 0x86, 0xc0, 0xcb, 0xcb, 0xcb, 0xb6, 0x77, 0x33, 0x04, 0x00, 0x0d, 0x07, 0x39, 0x7c, 0xb8, 0xcb, 0xcb, 0xcb, 0xc8, 0xa2,
+	0x5f, 0x1d, 0x00, 0x11, 0x01, 0x03, 0x03, 0x02, 0x00, 0x08, 0x04, 0x05, 0x05, 0x01, 0x00, 0x22, 0x2b, 0x80, 0xd5, 0xff, 0xff, 0xfe, 0xa9, 0x54,
+	0x00, 0x01, 0x3f, 0x94, 0xe9, 0xff, 0xfa, 0xab, 0x57, 0x1d, 0x43, 0x84, 0xbb, 0xe3, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xee, 0xcb,
+	0x94, 0x51, 0x1f, 0x05, 0x00, 0x09, 0x01, 0x15, 0x41, 0x81, 0xbc, 0xe5, 0xf8, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xe8, 0xc4, 0x90, 0x4f,
+	0x1e, 0x43, 0x95, 0xea, 0xff, 0xfe, 0xa9, 0x54, 0x00, 0x07, 0x0a, 0x35, 0x81, 0xcc, 0xf6, 0xff, 0xfe, 0xdd, 0x90, 0x3b, 0x07, 0x00, 0x1b, 0x11,
+	0x54, 0xa9, 0xed, 0xff, 0xff, 0xec, 0xb7, 0x65, 0x23, 0x03, 0x00, 0x0e, 0x08, 0x32, 0x7f, 0xcb, 0xf6, 0xff, 0xef, 0xdc, 0xdc, 0xec, 0xfe, 0xf8,
+	0xd1, 0x86, 0x38, 0x0a, 0x00, 0x0d, 0x14, 0x5c, 0xaf, 0xf0, 0xf5, 0xd5, 0x81, 0x34, 0x01, 0x00, 0x02, 0x05, 0x43, 0x93, 0xe3, 0xf9, 0xee, 0xa9,
+	0x54, 0x0f, 0x00, 0x06, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x0c, 0x02, 0x57, 0xac, 0xff, 0xff, 0xff, 0xd2, 0x7d, 0x28, 0x00,
+	0x16, 0x01, 0x13, 0x39, 0x73, 0xa9, 0xd1, 0xe9, 0xf6, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf3, 0xe5, 0xca, 0xa0, 0x67, 0x30, 0x0e, 0x00, 0x07,
+	0x3f, 0x94, 0xe9, 0xff, 0xe2, 0x8e, 0x3a, 0x16, 0x41, 0x7f, 0xb4, 0xdc, 0xf3, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf4, 0xe3, 0xbd, 0x86, 0x45,
+	0x17, 0x02, 0x00, 0x2c, 0x04, 0x0e, 0x1d, 0x26, 0x24, 0x17, 0x0a, 0x02, 0x00, 0x14, 0x19, 0x54, 0xa7, 0xe3, 0xfd, 0xff, 0xf6, 0xbe, 0x69, 0x1d,
+	0x00, 0x1a, 0x02, 0x28, 0x79, 0xcc, 0xfa, 0xff, 0xfb, 0xd9, 0x96, 0x45, 0x11, 0x00, 0x0d, 0x10, 0x44, 0x96, 0xdb, 0xfc, 0xfd, 0xe7, 0xdb, 0xdd,
+	0xf3, 0xff, 0xf1, 0xc0, 0x70, 0x28, 0x04, 0x00, 0x0c, 0x21, 0x6d, 0xc1, 0xf3, 0xf3, 0xc5, 0x71, 0x25, 0x00, 0x03, 0x0e, 0x53, 0xa5, 0xec, 0xfa,
+	0xe6, 0x97, 0x44, 0x06, 0x00, 0x20, 0x2b, 0x80, 0xd5, 0xff, 0xff, 0xfe, 0xa9, 0x54, 0x00, 0x01, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xe9, 0xde, 0xde,
+	0xf0, 0xe2, 0xb7, 0x8a, 0x6d, 0x5d, 0x54, 0x5f, 0x7d, 0xa9, 0xd2, 0xef, 0xfd, 0xff, 0xff, 0xfd, 0xe2, 0x95, 0x41, 0x08, 0x00, 0x05, 0x01, 0x2e,
+	0x7e, 0xd1, 0xfa, 0xff, 0xff, 0xff, 0xf7, 0xdf, 0xb8, 0x89, 0x65, 0x57, 0x5e, 0x6f, 0x8a, 0xb6, 0xe0, 0xf5, 0xde, 0xde, 0xe3, 0xff, 0xff, 0xfe,
+	0xa9, 0x54, 0x00, 0x09, 0x01, 0x18, 0x4d, 0x9c, 0xda, 0xfa, 0xfa, 0xce, 0x7d, 0x2d, 0x04, 0x00, 0x17, 0x0c, 0x43, 0x97, 0xe0, 0xfe, 0xf3, 0xca,
+	0x83, 0x39, 0x0d, 0x00, 0x0e, 0x01, 0x1c, 0x57, 0xa9, 0xe3, 0xfc, 0xe9, 0xbc, 0x74, 0x33, 0x0c, 0x09, 0x2e, 0x6d, 0xb6, 0xe6, 0xfb, 0xe8, 0xb1,
+	0x60, 0x21, 0x03, 0x00, 0x0a, 0x0f, 0x50, 0x9d, 0xdf, 0xe5, 0xc4, 0x73, 0x2c, 0x00, 0x03, 0x03, 0x39, 0x83, 0xd1, 0xe5, 0xd6, 0x8a, 0x40, 0x06,
+	0x00, 0x06, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x0c, 0x02, 0x57, 0xac, 0xff, 0xff, 0xff, 0xd2, 0x7d, 0x28, 0x00, 0x1d, 0x04,
+	0x0e, 0x1d, 0x26, 0x24, 0x17, 0x0a, 0x02, 0x00, 0x18, 0x01, 0x09, 0x14, 0x21, 0x29, 0x27, 0x1c, 0x0d, 0x03, 0x00, 0x50, 0x07, 0x2c, 0x6f, 0xbc,
+	0xec, 0xfe, 0xec, 0xac, 0x57, 0x15, 0x00, 0x17, 0x1d, 0x66, 0xbb, 0xf3, 0xfd, 0xe6, 0xb0, 0x60, 0x23, 0x04, 0x00, 0x0c, 0x05, 0x28, 0x6c, 0xbb,
+	0xed, 0xfa, 0xe0, 0xab, 0x60, 0x26, 0x06, 0x10, 0x3c, 0x81, 0xc5, 0xee, 0xfb, 0xdc, 0x9d, 0x4c, 0x16, 0x00, 0x0a, 0x1b, 0x5f, 0xae, 0xe3, 0xe3,
+	0xb3, 0x64, 0x1f, 0x00, 0x03, 0x0a, 0x48, 0x94, 0xdb, 0xe5, 0xca, 0x7a, 0x32, 0x01, 0x00, 0x20, 0x2b, 0x80, 0xd5, 0xff, 0xff, 0xfe, 0xa9, 0x54,
+	0x00, 0x01, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xff, 0xfc, 0xc9, 0x76, 0x24, 0x02, 0x00, 0x07, 0x02, 0x11, 0x4c, 0x9f, 0xe5, 0xff, 0xff, 0xf8, 0xbe,
+	0x69, 0x1b, 0x00, 0x03, 0x0d, 0x51, 0xa6, 0xee, 0xff, 0xff, 0xf4, 0xb6, 0x68, 0x1e, 0x07, 0x00, 0x07, 0x03, 0x20, 0x70, 0xc2, 0xfa, 0xff, 0xff,
+	0xff, 0xfe, 0xa9, 0x54, 0x00, 0x0c, 0x01, 0x18, 0x42, 0x6b, 0x80, 0x79, 0x4e, 0x23, 0x00, 0x16, 0x06, 0x30, 0x5b, 0x80, 0x7c, 0x60, 0x35, 0x0f,
+	0x00, 0x11, 0x23, 0x4e, 0x79, 0x80, 0x6e, 0x47, 0x1d, 0x04, 0x00, 0x06, 0x03, 0x19, 0x42, 0x6a, 0x7f, 0x7c, 0x53, 0x28, 0x02, 0x00, 0x23, 0x3f,
+	0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x0c, 0x02, 0x57, 0xac, 0xff, 0xff, 0xff, 0xd2, 0x7d, 0x28, 0x00, 0x57, 0x0a, 0x40, 0x84, 0xbd,
+	0xcb, 0xcb, 0xcb, 0xb9, 0x7a, 0x37, 0x04, 0x00, 0x1b, 0x06, 0x3a, 0x7e, 0xbc, 0xcb, 0xcb, 0xcb, 0xba, 0x7f, 0x3b, 0x08, 0x00, 0x11, 0x08, 0x2a,
+	0x55, 0x77, 0x81, 0x65, 0x3a, 0x0f, 0x00, 0x15, 0x17, 0x42, 0x6d, 0x81, 0x74, 0x4e, 0x23, 0x05, 0x00, 0x0e, 0x06, 0x2f, 0x5a, 0x7e, 0x7d, 0x65,
+	0x3b, 0x14, 0x01, 0x00, 0x06, 0x06, 0x23, 0x4d, 0x72, 0x80, 0x73, 0x48, 0x1d, 0x00, 0x31, 0x07, 0x13, 0x25, 0x33, 0x37, 0x31, 0x25, 0x14, 0x07,
+	0x00, 0x03, 0x2b, 0x80, 0xd5, 0xff, 0xff, 0xfe, 0xa9, 0x54, 0x00, 0x01, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xff, 0xc3, 0x6e, 0x19, 0x00, 0x0b, 0x08,
+	0x58, 0xad, 0xfa, 0xff, 0xff, 0xfe, 0xb3, 0x5e, 0x0a, 0x00, 0x02, 0x49, 0x9e, 0xf3, 0xff, 0xff, 0xff, 0xc4, 0x6f, 0x1a, 0x00, 0x0b, 0x11, 0x63,
+	0xb8, 0xfc, 0xff, 0xff, 0xfe, 0xa9, 0x54, 0x00, 0x02, 0x05, 0x09, 0x0e, 0x0e, 0x0e, 0x0b, 0x06, 0x02, 0x00, 0x0c, 0x01, 0x06, 0x0b, 0x0e, 0x0e,
+	0x0e, 0x0a, 0x05, 0x00, 0x03, 0x05, 0x09, 0x0e, 0x0e, 0x0e, 0x0b, 0x06, 0x02, 0x00, 0x0c, 0x01, 0x06, 0x0b, 0x0e, 0x0e, 0x0e, 0x0a, 0x05, 0x00,
+	0x03, 0x05, 0x09, 0x0e, 0x0e, 0x0e, 0x0b, 0x06, 0x02, 0x00, 0x0c, 0x01, 0x06, 0x0b, 0x0e, 0x0e, 0x0e, 0x0a, 0x05, 0x00, 0x03, 0x05, 0x09, 0x0e,
+	0x0e, 0x0e, 0x0b, 0x06, 0x02, 0x00, 0x0c, 0x01, 0x06, 0x0b, 0x0e, 0x0e, 0x0e, 0x0a, 0x05, 0x00, 0x02, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95,
+	0x40, 0x00, 0x0c, 0x02, 0x57, 0xac, 0xff, 0xff, 0xff, 0xd2, 0x7d, 0x28, 0x00, 0x1b, 0x04, 0x30, 0x74, 0xb3, 0xcb, 0xcb, 0xcb, 0xca, 0xa9, 0x67,
+	0x24, 0x01, 0x00, 0x0f, 0x02, 0x0b, 0x15, 0x17, 0x0e, 0x04, 0x00, 0x08, 0x0b, 0x1a, 0x29, 0x23, 0x15, 0x06, 0x00, 0x0f, 0x19, 0x54, 0xa7, 0xe3,
+	0xfd, 0xff, 0xf6, 0xbe, 0x69, 0x1d, 0x00, 0x19, 0x20, 0x6e, 0xc2, 0xf7, 0xff, 0xfc, 0xdf, 0xa0, 0x4d, 0x16, 0x00, 0x12, 0x06, 0x12, 0x24, 0x31,
+	0x33, 0x29, 0x18, 0x0a, 0x02, 0x00, 0x15, 0x06, 0x12, 0x24, 0x31, 0x33, 0x29, 0x18, 0x0a, 0x02, 0x00, 0x15, 0x06, 0x12, 0x24, 0x31, 0x33, 0x29,
+	0x18, 0x0a, 0x02, 0x00, 0x15, 0x06, 0x12, 0x24, 0x31, 0x33, 0x29, 0x18, 0x0a, 0x02, 0x00, 0x13, 0x01, 0x15, 0x41, 0x81, 0xbc, 0xe5, 0xf8, 0xfe,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xeb, 0xca, 0x97, 0x58, 0x44, 0x7a, 0xc9, 0xff, 0xff, 0xfe, 0xa9, 0x54, 0x00, 0x01, 0x3f, 0x94, 0xe9, 0xff,
+	0xff, 0xf7, 0xa3, 0x4e, 0x00, 0x0d, 0x24, 0x79, 0xce, 0xff, 0xff, 0xff, 0xd2, 0x7d, 0x28, 0x00, 0x01, 0x13, 0x68, 0xbd, 0xff, 0xff, 0xff, 0xe5,
+	0x90, 0x3b, 0x00, 0x0d, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xfe, 0xa9, 0x54, 0x00, 0x01, 0x04, 0x59, 0xae, 0xff, 0xff, 0xff, 0xd0, 0x7b, 0x26, 0x00,
+	0x0c, 0x1c, 0x71, 0xc6, 0xff, 0xff, 0xff, 0xb8, 0x63, 0x0e, 0x00, 0x01, 0x04, 0x59, 0xae, 0xff, 0xff, 0xff, 0xd0, 0x7b, 0x26, 0x00, 0x0c, 0x1c,
+	0x71, 0xc6, 0xff, 0xff, 0xff, 0xb8, 0x63, 0x0e, 0x00, 0x01, 0x04, 0x59, 0xae, 0xff, 0xff, 0xff, 0xd0, 0x7b, 0x26, 0x00, 0x0c, 0x1c, 0x71, 0xc6,
+	0xff, 0xff, 0xff, 0xb8, 0x63, 0x0e, 0x00, 0x01, 0x04, 0x59, 0xae, 0xff, 0xff, 0xff, 0xd0, 0x7b, 0x26, 0x00, 0x0c, 0x1c, 0x71, 0xc6, 0xff, 0xff,
+	0xff, 0xb8, 0x63, 0x0e, 0x00, 0x01, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x0c, 0x02, 0x57, 0xac, 0xff, 0xff, 0xff, 0xd2, 0x7d,
+	0x28, 0x00, 0x19, 0x0c, 0x3b, 0x8b, 0xd4, 0xfa, 0xfe, 0xea, 0xdc, 0xdc, 0xf0, 0xff, 0xf5, 0xc8, 0x7a, 0x2f, 0x07, 0x00, 0x0a, 0x18, 0x4f, 0x9c,
+	0xd9, 0xf7, 0xff, 0xff, 0xfc, 0xed, 0xd1, 0xa9, 0x7e, 0x53, 0x30, 0x1b, 0x1e, 0x46, 0x94, 0xd8, 0xfb, 0xb0, 0x5b, 0x0a, 0x00, 0x11, 0x07, 0x2c,
+	0x6f, 0xbc, 0xec, 0xfe, 0xec, 0xac, 0x57, 0x15, 0x00, 0x15, 0x17, 0x5c, 0xb1, 0xee, 0xfe, 0xea, 0xb8, 0x6a, 0x28, 0x06, 0x00, 0x0e, 0x05, 0x21,
+	0x53, 0x94, 0xc7, 0xea, 0xf8, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf0, 0xd2, 0xa2, 0x64, 0x2e, 0x0c, 0x00, 0x0a, 0x05, 0x21, 0x53, 0x94,
+	0xc7, 0xea, 0xf8, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf0, 0xd2, 0xa2, 0x64, 0x2e, 0x0c, 0x00, 0x0a, 0x05, 0x21, 0x53, 0x94, 0xc7, 0xea,
+	0xf8, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf0, 0xd2, 0xa2, 0x64, 0x2e, 0x0c, 0x00, 0x0a, 0x05, 0x21, 0x53, 0x94, 0xc7, 0xea, 0xf8, 0xfe,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf0, 0xd2, 0xa2, 0x64, 0x2e, 0x0c, 0x00, 0x0c, 0x01, 0x2e, 0x7e, 0xd1, 0xfa, 0xff, 0xff, 0xff, 0xf7, 0xdf,
+	0xb8, 0x89, 0x65, 0x57, 0x5e, 0x6f, 0x8a, 0xb6, 0xe0, 0xf8, 0xe7, 0xe7, 0xea, 0xff, 0xff, 0xfe, 0xa9, 0x54, 0x00, 0x01, 0x3f, 0x94, 0xe9, 0xff,
+	0xff, 0xec, 0x97, 0x42, 0x00, 0x0d, 0x03, 0x55, 0xaa, 0xfc, 0xff, 0xff, 0xe8, 0x93, 0x3e, 0x00, 0x01, 0x2a, 0x7f, 0xd4, 0xff, 0xff, 0xff, 0xbe,
+	0x69, 0x14, 0x00, 0x0d, 0x2e, 0x83, 0xd8, 0xff, 0xff, 0xfe, 0xa9, 0x54, 0x00, 0x01, 0x04, 0x59, 0xae, 0xff, 0xff, 0xff, 0xd0, 0x7b, 0x26, 0x00,
+	0x0c, 0x1c, 0x71, 0xc6, 0xff, 0xff, 0xff, 0xb8, 0x63, 0x0e, 0x00, 0x01, 0x04, 0x59, 0xae, 0xff, 0xff, 0xff, 0xd0, 0x7b, 0x26, 0x00, 0x0c, 0x1c,
+	0x71, 0xc6, 0xff, 0xff, 0xff, 0xb8, 0x63, 0x0e, 0x00, 0x01, 0x04, 0x59, 0xae, 0xff, 0xff, 0xff, 0xd0, 0x7b, 0x26, 0x00, 0x0c, 0x1c, 0x71, 0xc6,
+	0xff, 0xff, 0xff, 0xb8, 0x63, 0x0e, 0x00, 0x01, 0x04, 0x59, 0xae, 0xff, 0xff, 0xff, 0xd0, 0x7b, 0x26, 0x00, 0x0c, 0x1c, 0x71, 0xc6, 0xff, 0xff,
+	0xff, 0xb8, 0x63, 0x0e, 0x00, 0x01, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x0c, 0x03, 0x58, 0xad, 0xff, 0xff, 0xff, 0xd2, 0x7d,
+	0x28, 0x00, 0x16, 0x03, 0x22, 0x62, 0xb3, 0xe9, 0xfb, 0xe4, 0xb3, 0x69, 0x2b, 0x08, 0x0d, 0x35, 0x78, 0xbe, 0xeb, 0xfb, 0xe1, 0xa6, 0x55, 0x1b,
+	0x01, 0x00, 0x06, 0x30, 0x85, 0xda, 0xf8, 0xd3, 0xa3, 0x75, 0x6d, 0x7b, 0x9b, 0xc3, 0xe6, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xe6, 0x9f,
+	0x4b, 0x0d, 0x00, 0x15, 0x08, 0x2a, 0x55, 0x77, 0x81, 0x65, 0x3a, 0x0f, 0x00, 0x13, 0x12, 0x3d, 0x68, 0x81, 0x77, 0x54, 0x29, 0x08, 0x00, 0x0f,
+	0x15, 0x58, 0xac, 0xeb, 0xfe, 0xff, 0xf7, 0xe4, 0xc4, 0x9f, 0x7a, 0x5f, 0x55, 0x5e, 0x75, 0x9f, 0xcf, 0xf3, 0xff, 0xff, 0xf3, 0xb7, 0x62, 0x19,
+	0x00, 0x06, 0x15, 0x58, 0xac, 0xeb, 0xfe, 0xff, 0xf7, 0xe4, 0xc4, 0x9f, 0x7a, 0x5f, 0x55, 0x5e, 0x75, 0x9f, 0xcf, 0xf3, 0xff, 0xff, 0xf3, 0xb7,
+	0x62, 0x19, 0x00, 0x06, 0x15, 0x58, 0xac, 0xeb, 0xfe, 0xff, 0xf7, 0xe4, 0xc4, 0x9f, 0x7a, 0x5f, 0x55, 0x5e, 0x75, 0x9f, 0xcf, 0xf3, 0xff, 0xff,
+	0xf3, 0xb7, 0x62, 0x19, 0x00, 0x06, 0x15, 0x58, 0xac, 0xeb, 0xfe, 0xff, 0xf7, 0xe4, 0xc4, 0x9f, 0x7a, 0x5f, 0x55, 0x5e, 0x75, 0x9f, 0xcf, 0xf3,
+	0xff, 0xff, 0xf3, 0xb7, 0x62, 0x19, 0x00, 0x09, 0x0d, 0x51, 0xa6, 0xee, 0xff, 0xff, 0xf4, 0xb6, 0x68, 0x1e, 0x07, 0x00, 0x07, 0x03, 0x20, 0x70,
+	0xc2, 0xfa, 0xff, 0xff, 0xff, 0xfe, 0xa9, 0x54, 0x00, 0x01, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xfb, 0xa8, 0x53, 0x01, 0x00, 0x0c, 0x2a, 0x7f, 0xd4,
+	0xff, 0xff, 0xff, 0xd0, 0x7b, 0x26, 0x00, 0x01, 0x12, 0x67, 0xbc, 0xff, 0xff, 0xff, 0xe4, 0x8f, 0x3a, 0x00, 0x0d, 0x3c, 0x91, 0xe6, 0xff, 0xff,
+	0xfe, 0xa9, 0x54, 0x00, 0x01, 0x04, 0x59, 0xae, 0xff, 0xff, 0xff, 0xd0, 0x7b, 0x26, 0x00, 0x0c, 0x1c, 0x71, 0xc6, 0xff, 0xff, 0xff, 0xb8, 0x63,
+	0x0e, 0x00, 0x01, 0x04, 0x59, 0xae, 0xff, 0xff, 0xff, 0xd0, 0x7b, 0x26, 0x00, 0x0c, 0x1c, 0x71, 0xc6, 0xff, 0xff, 0xff, 0xb8, 0x63, 0x0e, 0x00,
+	0x01, 0x04, 0x59, 0xae, 0xff, 0xff, 0xff, 0xd0, 0x7b, 0x26, 0x00, 0x0c, 0x1c, 0x71, 0xc6, 0xff, 0xff, 0xff, 0xb8, 0x63, 0x0e, 0x00, 0x01, 0x04,
+	0x59, 0xae, 0xff, 0xff, 0xff, 0xd0, 0x7b, 0x26, 0x00, 0x0c, 0x1c, 0x71, 0xc6, 0xff, 0xff, 0xff, 0xb8, 0x63, 0x0e, 0x00, 0x01, 0x3f, 0x94, 0xe9,
+	0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x0c, 0x13, 0x68, 0xbd, 0xff, 0xff, 0xff, 0xd2, 0x7d, 0x28, 0x00, 0x15, 0x03, 0x2a, 0x55, 0x7d, 0x7e, 0x69,
+	0x40, 0x18, 0x02, 0x00, 0x06, 0x05, 0x1e, 0x49, 0x6f, 0x80, 0x78, 0x4d, 0x22, 0x00, 0x05, 0x04, 0x2e, 0x59, 0x80, 0x60, 0x35, 0x0a, 0x00, 0x05,
+	0x0a, 0x21, 0x41, 0x5d, 0x6c, 0x6c, 0x5f, 0x3e, 0x1e, 0x05, 0x00, 0x13, 0x03, 0x0a, 0x16, 0x22, 0x2f, 0x37, 0x37, 0x31, 0x27, 0x1d, 0x11, 0x08,
+	0x01, 0x00, 0x10, 0x03, 0x0a, 0x16, 0x22, 0x2f, 0x37, 0x37, 0x31, 0x27, 0x1d, 0x11, 0x08, 0x01, 0x00, 0x0a, 0x05, 0x38, 0x8c, 0xdc, 0xfe, 0xff,
+	0xf7, 0xb1, 0x5c, 0x0f, 0x00, 0x08, 0x14, 0x60, 0xb5, 0xf5, 0xff, 0xff, 0xe4, 0x94, 0x3f, 0x04, 0x00, 0x02, 0x05, 0x38, 0x8c, 0xdc, 0xfe, 0xff,
+	0xf7, 0xb1, 0x5c, 0x0f, 0x00, 0x08, 0x14, 0x60, 0xb5, 0xf5, 0xff, 0xff, 0xe4, 0x94, 0x3f, 0x04, 0x00, 0x02, 0x05, 0x38, 0x8c, 0xdc, 0xfe, 0xff,
+	0xf7, 0xb1, 0x5c, 0x0f, 0x00, 0x08, 0x14, 0x60, 0xb5, 0xf5, 0xff, 0xff, 0xe4, 0x94, 0x3f, 0x04, 0x00, 0x02, 0x05, 0x38, 0x8c, 0xdc, 0xfe, 0xff,
+	0xf7, 0xb1, 0x5c, 0x0f, 0x00, 0x08, 0x14, 0x60, 0xb5, 0xf5, 0xff, 0xff, 0xe4, 0x94, 0x3f, 0x04, 0x00, 0x07, 0x49, 0x9e, 0xf3, 0xff, 0xff, 0xff,
+	0xc4, 0x6f, 0x1a, 0x00, 0x0b, 0x11, 0x63, 0xb8, 0xfc, 0xff, 0xff, 0xfe, 0xa9, 0x54, 0x00, 0x01, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xff, 0xcd, 0x78,
+	0x23, 0x00, 0x0b, 0x0c, 0x5f, 0xb4, 0xfc, 0xff, 0xff, 0xfd, 0xb1, 0x5c, 0x08, 0x00, 0x02, 0x48, 0x9d, 0xf2, 0xff, 0xff, 0xff, 0xc3, 0x6e, 0x19,
+	0x00, 0x0b, 0x0c, 0x5e, 0xb3, 0xfc, 0xff, 0xff, 0xfe, 0xa9, 0x54, 0x00, 0x01, 0x04, 0x59, 0xae, 0xff, 0xff, 0xff, 0xd0, 0x7b, 0x26, 0x00, 0x0c,
+	0x1c, 0x71, 0xc6, 0xff, 0xff, 0xff, 0xb8, 0x63, 0x0e, 0x00, 0x01, 0x04, 0x59, 0xae, 0xff, 0xff, 0xff, 0xd0, 0x7b, 0x26, 0x00, 0x0c, 0x1c, 0x71,
+	0xc6, 0xff, 0xff, 0xff, 0xb8, 0x63, 0x0e, 0x00, 0x01, 0x04, 0x59, 0xae, 0xff, 0xff, 0xff, 0xd0, 0x7b, 0x26, 0x00, 0x0c, 0x1c, 0x71, 0xc6, 0xff,
+	0xff, 0xff, 0xb8, 0x63, 0x0e, 0x00, 0x01, 0x04, 0x59, 0xae, 0xff, 0xff, 0xff, 0xd0, 0x7b, 0x26, 0x00, 0x0c, 0x1c, 0x71, 0xc6, 0xff, 0xff, 0xff,
+	0xb8, 0x63, 0x0e, 0x00, 0x01, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xfa, 0xb3, 0x5e, 0x0d, 0x00, 0x0b, 0x36, 0x8b, 0xdf, 0xff, 0xff, 0xff, 0xd2, 0x7d,
+	0x28, 0x00, 0x1a, 0x03, 0x0a, 0x16, 0x22, 0x2f, 0x37, 0x37, 0x31, 0x27, 0x1d, 0x11, 0x08, 0x01, 0x00, 0x10, 0x03, 0x0a, 0x16, 0x22, 0x2f, 0x37,
+	0x37, 0x31, 0x27, 0x1d, 0x11, 0x08, 0x01, 0x00, 0x10, 0x12, 0x3a, 0x6d, 0x9a, 0xbd, 0xdd, 0xf3, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xfd, 0xee, 0xd1, 0xa6, 0x6b, 0x34, 0x0b, 0x00, 0x06, 0x12, 0x3a, 0x6d, 0x9a, 0xbd, 0xdd, 0xf3, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xfd, 0xee, 0xd1, 0xa6, 0x6b, 0x34, 0x0b, 0x00, 0x06, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xf6, 0xaf, 0x5a, 0x0d, 0x00, 0x0a, 0x12, 0x67,
+	0xbc, 0xff, 0xff, 0xff, 0xd0, 0x7b, 0x26, 0x00, 0x02, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xf6, 0xaf, 0x5a, 0x0d, 0x00, 0x0a, 0x12, 0x67, 0xbc, 0xff,
+	0xff, 0xff, 0xd0, 0x7b, 0x26, 0x00, 0x02, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xf6, 0xaf, 0x5a, 0x0d, 0x00, 0x0a, 0x12, 0x67, 0xbc, 0xff, 0xff, 0xff,
+	0xd0, 0x7b, 0x26, 0x00, 0x02, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xf6, 0xaf, 0x5a, 0x0d, 0x00, 0x0a, 0x12, 0x67, 0xbc, 0xff, 0xff, 0xff, 0xd0, 0x7b,
+	0x26, 0x00, 0x06, 0x13, 0x68, 0xbd, 0xff, 0xff, 0xff, 0xe5, 0x90, 0x3b, 0x00, 0x0d, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xfe, 0xa9, 0x54, 0x00, 0x01,
+	0x3f, 0x94, 0xe9, 0xff, 0xff, 0xff, 0xfe, 0xd5, 0x89, 0x34, 0x09, 0x00, 0x07, 0x08, 0x21, 0x62, 0xae, 0xeb, 0xff, 0xff, 0xf5, 0xb5, 0x60, 0x15,
+	0x00, 0x03, 0x0c, 0x4e, 0xa3, 0xec, 0xff, 0xff, 0xf3, 0xb4, 0x67, 0x1d, 0x07, 0x00, 0x07, 0x02, 0x1e, 0x6d, 0xbf, 0xf9, 0xff, 0xff, 0xff, 0xfe,
+	0xa9, 0x54, 0x00, 0x01, 0x04, 0x59, 0xae, 0xff, 0xff, 0xff, 0xd0, 0x7b, 0x26, 0x00, 0x0c, 0x1c, 0x71, 0xc6, 0xff, 0xff, 0xff, 0xb8, 0x63, 0x0e,
+	0x00, 0x01, 0x04, 0x59, 0xae, 0xff, 0xff, 0xff, 0xd0, 0x7b, 0x26, 0x00, 0x0c, 0x1c, 0x71, 0xc6, 0xff, 0xff, 0xff, 0xb8, 0x63, 0x0e, 0x00, 0x01,
+	0x04, 0x59, 0xae, 0xff, 0xff, 0xff, 0xd0, 0x7b, 0x26, 0x00, 0x0c, 0x1c, 0x71, 0xc6, 0xff, 0xff, 0xff, 0xb8, 0x63, 0x0e, 0x00, 0x01, 0x04, 0x59,
+	0xae, 0xff, 0xff, 0xff, 0xd0, 0x7b, 0x26, 0x00, 0x0c, 0x1c, 0x71, 0xc6, 0xff, 0xff, 0xff, 0xb8, 0x63, 0x0e, 0x00, 0x01, 0x3f, 0x94, 0xe9, 0xff,
+	0xff, 0xff, 0xf2, 0xa3, 0x4e, 0x05, 0x00, 0x08, 0x0e, 0x49, 0x9e, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x7d, 0x28, 0x00, 0x14, 0x12, 0x3a, 0x6d,
+	0x9a, 0xbd, 0xdd, 0xf3, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xee, 0xd1, 0xa6, 0x6b, 0x34, 0x0b, 0x00, 0x06, 0x12, 0x3a,
+	0x6d, 0x9a, 0xbd, 0xdd, 0xf3, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xee, 0xd1, 0xa6, 0x6b, 0x34, 0x0b, 0x00, 0x0c, 0x05,
+	0x3b, 0x90, 0xd7, 0xe1, 0xc1, 0x9f, 0x84, 0x71, 0x64, 0x57, 0x4e, 0x4d, 0x55, 0x6a, 0x8d, 0xc1, 0xe8, 0xfe, 0xff, 0xfd, 0xdb, 0x8c, 0x39, 0x05,
+	0x00, 0x04, 0x05, 0x3b, 0x90, 0xd7, 0xe1, 0xc1, 0x9f, 0x84, 0x71, 0x64, 0x57, 0x4e, 0x4d, 0x55, 0x6a, 0x8d, 0xc1, 0xe8, 0xfe, 0xff, 0xfd, 0xdb,
+	0x8c, 0x39, 0x05, 0x00, 0x03, 0x0d, 0x62, 0xb7, 0xfe, 0xff, 0xff, 0xed, 0xd0, 0xb4, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9,
+	0xa9, 0xa9, 0xc5, 0xe2, 0xfe, 0xff, 0xff, 0xf5, 0xa0, 0x4b, 0x00, 0x01, 0x0d, 0x62, 0xb7, 0xfe, 0xff, 0xff, 0xed, 0xd0, 0xb4, 0xa9, 0xa9, 0xa9,
+	0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xc5, 0xe2, 0xfe, 0xff, 0xff, 0xf5, 0xa0, 0x4b, 0x00, 0x01, 0x0d, 0x62, 0xb7, 0xfe, 0xff,
+	0xff, 0xed, 0xd0, 0xb4, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xc5, 0xe2, 0xfe, 0xff, 0xff, 0xf5, 0xa0, 0x4b,
+	0x00, 0x01, 0x0d, 0x62, 0xb7, 0xfe, 0xff, 0xff, 0xed, 0xd0, 0xb4, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xc5,
+	0xe2, 0xfe, 0xff, 0xff, 0xf5, 0xa0, 0x4b, 0x00, 0x06, 0x2a, 0x7f, 0xd4, 0xff, 0xff, 0xff, 0xbe, 0x69, 0x14, 0x00, 0x0d, 0x2e, 0x83, 0xd8, 0xff,
+	0xff, 0xfe, 0xa9, 0x54, 0x00, 0x01, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xed, 0xe3, 0xe3, 0xf4, 0xed, 0xc9, 0x9f, 0x80, 0x6f, 0x64, 0x6d, 0x8c, 0xbb,
+	0xe1, 0xf8, 0xff, 0xff, 0xff, 0xfb, 0xda, 0x8a, 0x39, 0x05, 0x00, 0x05, 0x01, 0x2b, 0x79, 0xcd, 0xf8, 0xff, 0xff, 0xff, 0xf8, 0xe3, 0xc0, 0x95,
+	0x72, 0x63, 0x67, 0x76, 0x90, 0xba, 0xe2, 0xf3, 0xdb, 0xdb, 0xe3, 0xff, 0xff, 0xfe, 0xa9, 0x54, 0x00, 0x01, 0x04, 0x59, 0xae, 0xff, 0xff, 0xff,
+	0xd0, 0x7b, 0x26, 0x00, 0x0c, 0x1d, 0x72, 0xc7, 0xff, 0xff, 0xff, 0xb8, 0x63, 0x0e, 0x00, 0x01, 0x04, 0x59, 0xae, 0xff, 0xff, 0xff, 0xd0, 0x7b,
+	0x26, 0x00, 0x0c, 0x1d, 0x72, 0xc7, 0xff, 0xff, 0xff, 0xb8, 0x63, 0x0e, 0x00, 0x01, 0x04, 0x59, 0xae, 0xff, 0xff, 0xff, 0xd0, 0x7b, 0x26, 0x00,
+	0x0c, 0x1d, 0x72, 0xc7, 0xff, 0xff, 0xff, 0xb8, 0x63, 0x0e, 0x00, 0x01, 0x04, 0x59, 0xae, 0xff, 0xff, 0xff, 0xd0, 0x7b, 0x26, 0x00, 0x0c, 0x1d,
+	0x72, 0xc7, 0xff, 0xff, 0xff, 0xb8, 0x63, 0x0e, 0x00, 0x01, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xeb, 0xd1, 0xaf, 0x8e, 0x70, 0x62,
+	0x65, 0x75, 0x88, 0xac, 0xd4, 0xf1, 0xdf, 0xd1, 0xd4, 0xf1, 0xff, 0xff, 0xd2, 0x7d, 0x28, 0x00, 0x14, 0x05, 0x3b, 0x90, 0xd7, 0xe1, 0xc1, 0x9f,
+	0x84, 0x71, 0x64, 0x57, 0x4e, 0x4d, 0x55, 0x6a, 0x8d, 0xc1, 0xe8, 0xfe, 0xff, 0xfd, 0xdb, 0x8c, 0x39, 0x05, 0x00, 0x04, 0x05, 0x3b, 0x90, 0xd7,
+	0xe1, 0xc1, 0x9f, 0x84, 0x71, 0x64, 0x57, 0x4e, 0x4d, 0x55, 0x6a, 0x8d, 0xc1, 0xe8, 0xfe, 0xff, 0xfd, 0xdb, 0x8c, 0x39, 0x05, 0x00, 0x0c, 0x03,
+	0x03, 0x03, 0x00, 0x0b, 0x11, 0x60, 0xb5, 0xf9, 0xff, 0xff, 0xd5, 0x80, 0x2b, 0x00, 0x06, 0x03, 0x03, 0x03, 0x00, 0x0b, 0x11, 0x60, 0xb5, 0xf9,
+	0xff, 0xff, 0xd5, 0x80, 0x2b, 0x00, 0x03, 0x28, 0x7d, 0xd2, 0xff, 0xff, 0xff, 0xf2, 0xe4, 0xd5, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3,
+	0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd2, 0x8b, 0x45, 0x00, 0x01, 0x28, 0x7d, 0xd2, 0xff, 0xff, 0xff, 0xf2, 0xe4, 0xd5, 0xd3,
+	0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd2, 0x8b, 0x45, 0x00, 0x01, 0x28, 0x7d, 0xd2,
+	0xff, 0xff, 0xff, 0xf2, 0xe4, 0xd5, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd2,
+	0x8b, 0x45, 0x00, 0x01, 0x28, 0x7d, 0xd2, 0xff, 0xff, 0xff, 0xf2, 0xe4, 0xd5, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3,
+	0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd2, 0x8b, 0x45, 0x00, 0x06, 0x12, 0x67, 0xbc, 0xff, 0xff, 0xff, 0xe4, 0x8f, 0x3a, 0x00, 0x0d, 0x3c, 0x91,
+	0xe6, 0xff, 0xff, 0xfe, 0xa9, 0x54, 0x00, 0x01, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xde, 0x8a, 0x4b, 0x41, 0x7f, 0xb4, 0xdc, 0xf3, 0xfd, 0xff, 0xff,
+	0xff, 0xff, 0xfc, 0xf4, 0xe3, 0xbd, 0x86, 0x45, 0x17, 0x02, 0x00, 0x0a, 0x11, 0x39, 0x77, 0xb1, 0xda, 0xf1, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xfe,
+	0xf6, 0xe1, 0xbb, 0x86, 0x48, 0x3b, 0x78, 0xcb, 0xff, 0xff, 0xfe, 0xa9, 0x54, 0x00, 0x01, 0x04, 0x59, 0xae, 0xff, 0xff, 0xff, 0xd0, 0x7b, 0x26,
+	0x00, 0x0c, 0x2e, 0x83, 0xd8, 0xff, 0xff, 0xff, 0xb8, 0x63, 0x0e, 0x00, 0x01, 0x04, 0x59, 0xae, 0xff, 0xff, 0xff, 0xd0, 0x7b, 0x26, 0x00, 0x0c,
+	0x2e, 0x83, 0xd8, 0xff, 0xff, 0xff, 0xb8, 0x63, 0x0e, 0x00, 0x01, 0x04, 0x59, 0xae, 0xff, 0xff, 0xff, 0xd0, 0x7b, 0x26, 0x00, 0x0c, 0x2e, 0x83,
+	0xd8, 0xff, 0xff, 0xff, 0xb8, 0x63, 0x0e, 0x00, 0x01, 0x04, 0x59, 0xae, 0xff, 0xff, 0xff, 0xd0, 0x7b, 0x26, 0x00, 0x0c, 0x2e, 0x83, 0xd8, 0xff,
+	0xff, 0xff, 0xb8, 0x63, 0x0e, 0x00, 0x01, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0xc3, 0xb2, 0xc5, 0xeb, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xf7, 0xea,
+	0xd1, 0xa1, 0x5d, 0x22, 0x19, 0x6a, 0xbf, 0xff, 0xff, 0xd2, 0x7d, 0x28, 0x00, 0x16, 0x03, 0x03, 0x03, 0x00, 0x0b, 0x11, 0x60, 0xb5, 0xf9, 0xff,
+	0xff, 0xd5, 0x80, 0x2b, 0x00, 0x06, 0x03, 0x03, 0x03, 0x00, 0x0b, 0x11, 0x60, 0xb5, 0xf9, 0xff, 0xff, 0xd5, 0x80, 0x2b, 0x00, 0x1b, 0x31, 0x86,
+	0xdb, 0xff, 0xff, 0xf3, 0x9e, 0x49, 0x00, 0x15, 0x31, 0x86, 0xdb, 0xff, 0xff, 0xf3, 0x9e, 0x49, 0x00, 0x03, 0x0e, 0x62, 0xb7, 0xfe, 0xff, 0xff,
+	0xe2, 0x8d, 0x38, 0x00, 0x15, 0x0e, 0x62, 0xb7, 0xfe, 0xff, 0xff, 0xe2, 0x8d, 0x38, 0x00, 0x15, 0x0e, 0x62, 0xb7, 0xfe, 0xff, 0xff, 0xe2, 0x8d,
+	0x38, 0x00, 0x15, 0x0e, 0x62, 0xb7, 0xfe, 0xff, 0xff, 0xe2, 0x8d, 0x38, 0x00, 0x1b, 0x48, 0x9d, 0xf2, 0xff, 0xff, 0xff, 0xc3, 0x6e, 0x19, 0x00,
+	0x0b, 0x0c, 0x5e, 0xb3, 0xfc, 0xff, 0xff, 0xfe, 0xa9, 0x54, 0x00, 0x01, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xe9, 0x94, 0x3f, 0x00, 0x03, 0x01, 0x09,
+	0x14, 0x21, 0x29, 0x27, 0x1c, 0x0d, 0x03, 0x00, 0x15, 0x02, 0x0a, 0x18, 0x25, 0x29, 0x24, 0x18, 0x0c, 0x03, 0x00, 0x03, 0x2b, 0x80, 0xd5, 0xff,
+	0xff, 0xfe, 0xa9, 0x54, 0x00, 0x01, 0x01, 0x4d, 0xa2, 0xf6, 0xff, 0xff, 0xec, 0x99, 0x44, 0x02, 0x00, 0x0a, 0x08, 0x52, 0xa7, 0xf4, 0xff, 0xff,
+	0xff, 0xb8, 0x63, 0x0e, 0x00, 0x01, 0x01, 0x4d, 0xa2, 0xf6, 0xff, 0xff, 0xec, 0x99, 0x44, 0x02, 0x00, 0x0a, 0x08, 0x52, 0xa7, 0xf4, 0xff, 0xff,
+	0xff, 0xb8, 0x63, 0x0e, 0x00, 0x01, 0x01, 0x4d, 0xa2, 0xf6, 0xff, 0xff, 0xec, 0x99, 0x44, 0x02, 0x00, 0x0a, 0x08, 0x52, 0xa7, 0xf4, 0xff, 0xff,
+	0xff, 0xb8, 0x63, 0x0e, 0x00, 0x01, 0x01, 0x4d, 0xa2, 0xf6, 0xff, 0xff, 0xec, 0x99, 0x44, 0x02, 0x00, 0x0a, 0x08, 0x52, 0xa7, 0xf4, 0xff, 0xff,
+	0xff, 0xb8, 0x63, 0x0e, 0x00, 0x01, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xe4, 0x8f, 0x3a, 0x00, 0x01, 0x04, 0x0d, 0x1b, 0x25, 0x23, 0x15, 0x08, 0x01,
+	0x00, 0x31, 0x31, 0x86, 0xdb, 0xff, 0xff, 0xf3, 0x9e, 0x49, 0x00, 0x15, 0x31, 0x86, 0xdb, 0xff, 0xff, 0xf3, 0x9e, 0x49, 0x00, 0x0e, 0x0b, 0x22,
+	0x3f, 0x56, 0x64, 0x6f, 0x7b, 0x86, 0x90, 0x97, 0x9c, 0x9f, 0xa3, 0xb4, 0xd3, 0xf0, 0xff, 0xff, 0xf7, 0xa2, 0x4d, 0x00, 0x08, 0x0b, 0x22, 0x3f,
+	0x56, 0x64, 0x6f, 0x7b, 0x86, 0x90, 0x97, 0x9c, 0x9f, 0xa3, 0xb4, 0xd3, 0xf0, 0xff, 0xff, 0xf7, 0xa2, 0x4d, 0x00, 0x04, 0x3c, 0x91, 0xe6, 0xff,
+	0xff, 0xff, 0xd6, 0x81, 0x2c, 0x00, 0x15, 0x3c, 0x91, 0xe6, 0xff, 0xff, 0xff, 0xd6, 0x81, 0x2c, 0x00, 0x15, 0x3c, 0x91, 0xe6, 0xff, 0xff, 0xff,
+	0xd6, 0x81, 0x2c, 0x00, 0x15, 0x3c, 0x91, 0xe6, 0xff, 0xff, 0xff, 0xd6, 0x81, 0x2c, 0x00, 0x1a, 0x0c, 0x4e, 0xa3, 0xec, 0xff, 0xff, 0xf3, 0xb4,
+	0x67, 0x1d, 0x07, 0x00, 0x07, 0x02, 0x1e, 0x6d, 0xbf, 0xf9, 0xff, 0xff, 0xff, 0xfe, 0xa9, 0x54, 0x00, 0x01, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea,
+	0x95, 0x40, 0x00, 0x2d, 0x2b, 0x80, 0xd5, 0xff, 0xff, 0xfe, 0xa9, 0x54, 0x00, 0x02, 0x2d, 0x82, 0xd7, 0xff, 0xff, 0xff, 0xde, 0x89, 0x34, 0x00,
+	0x08, 0x02, 0x1a, 0x65, 0xb8, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xb8, 0x63, 0x0e, 0x00, 0x02, 0x2d, 0x82, 0xd7, 0xff, 0xff, 0xff, 0xde, 0x89, 0x34,
+	0x00, 0x08, 0x02, 0x1a, 0x65, 0xb8, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xb8, 0x63, 0x0e, 0x00, 0x02, 0x2d, 0x82, 0xd7, 0xff, 0xff, 0xff, 0xde, 0x89,
+	0x34, 0x00, 0x08, 0x02, 0x1a, 0x65, 0xb8, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xb8, 0x63, 0x0e, 0x00, 0x02, 0x2d, 0x82, 0xd7, 0xff, 0xff, 0xff, 0xde,
+	0x89, 0x34, 0x00, 0x08, 0x02, 0x1a, 0x65, 0xb8, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xb8, 0x63, 0x0e, 0x00, 0x01, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xe9,
+	0x94, 0x3f, 0x00, 0x2d, 0x0b, 0x22, 0x3f, 0x56, 0x64, 0x6f, 0x7b, 0x86, 0x90, 0x97, 0x9c, 0x9f, 0xa3, 0xb4, 0xd3, 0xf0, 0xff, 0xff, 0xf7, 0xa2,
+	0x4d, 0x00, 0x08, 0x0b, 0x22, 0x3f, 0x56, 0x64, 0x6f, 0x7b, 0x86, 0x90, 0x97, 0x9c, 0x9f, 0xa3, 0xb4, 0xd3, 0xf0, 0xff, 0xff, 0xf7, 0xa2, 0x4d,
+	0x00, 0x0a, 0x09, 0x3e, 0x83, 0xcc, 0xeb, 0xfb, 0xff, 0xfe, 0xf4, 0xe5, 0xd3, 0xc7, 0xbb, 0xb1, 0xa9, 0xa4, 0x9f, 0xaf, 0xce, 0xf0, 0xff, 0xff,
+	0xf7, 0xa2, 0x4d, 0x00, 0x04, 0x09, 0x3e, 0x83, 0xcc, 0xeb, 0xfb, 0xff, 0xfe, 0xf4, 0xe5, 0xd3, 0xc7, 0xbb, 0xb1, 0xa9, 0xa4, 0x9f, 0xaf, 0xce,
+	0xf0, 0xff, 0xff, 0xf7, 0xa2, 0x4d, 0x00, 0x04, 0x05, 0x33, 0x86, 0xd6, 0xfd, 0xff, 0xff, 0xd2, 0x8d, 0x3c, 0x14, 0x04, 0x00, 0x0b, 0x02, 0x08,
+	0x08, 0x05, 0x00, 0x03, 0x05, 0x33, 0x86, 0xd6, 0xfd, 0xff, 0xff, 0xd2, 0x8d, 0x3c, 0x14, 0x04, 0x00, 0x0b, 0x02, 0x08, 0x08, 0x05, 0x00, 0x03,
+	0x05, 0x33, 0x86, 0xd6, 0xfd, 0xff, 0xff, 0xd2, 0x8d, 0x3c, 0x14, 0x04, 0x00, 0x0b, 0x02, 0x08, 0x08, 0x05, 0x00, 0x03, 0x05, 0x33, 0x86, 0xd6,
+	0xfd, 0xff, 0xff, 0xd2, 0x8d, 0x3c, 0x14, 0x04, 0x00, 0x0b, 0x02, 0x08, 0x08, 0x05, 0x00, 0x09, 0x01, 0x2b, 0x79, 0xcd, 0xf8, 0xff, 0xff, 0xff,
+	0xf8, 0xe3, 0xc0, 0x95, 0x72, 0x63, 0x67, 0x76, 0x90, 0xba, 0xe2, 0xf3, 0xd8, 0xd8, 0xe0, 0xff, 0xff, 0xfe, 0xa9, 0x54, 0x00, 0x01, 0x3f, 0x94,
+	0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x2d, 0x2b, 0x80, 0xd5, 0xff, 0xff, 0xfe, 0xa9, 0x54, 0x00, 0x02, 0x02, 0x2c, 0x7e, 0xd1, 0xfc, 0xff,
+	0xff, 0xf7, 0xe5, 0xc7, 0xa5, 0x84, 0x6a, 0x61, 0x69, 0x7a, 0x91, 0xba, 0xe1, 0xf5, 0xd8, 0xd5, 0xdb, 0xfc, 0xff, 0xff, 0xb8, 0x63, 0x0e, 0x00,
+	0x02, 0x02, 0x2c, 0x7e, 0xd1, 0xfc, 0xff, 0xff, 0xf7, 0xe5, 0xc7, 0xa5, 0x84, 0x6a, 0x61, 0x69, 0x7a, 0x91, 0xba, 0xe1, 0xf5, 0xd8, 0xd5, 0xdb,
+	0xfc, 0xff, 0xff, 0xb8, 0x63, 0x0e, 0x00, 0x02, 0x02, 0x2c, 0x7e, 0xd1, 0xfc, 0xff, 0xff, 0xf7, 0xe5, 0xc7, 0xa5, 0x84, 0x6a, 0x61, 0x69, 0x7a,
+	0x91, 0xba, 0xe1, 0xf5, 0xd8, 0xd5, 0xdb, 0xfc, 0xff, 0xff, 0xb8, 0x63, 0x0e, 0x00, 0x02, 0x02, 0x2c, 0x7e, 0xd1, 0xfc, 0xff, 0xff, 0xf7, 0xe5,
+	0xc7, 0xa5, 0x84, 0x6a, 0x61, 0x69, 0x7a, 0x91, 0xba, 0xe1, 0xf5, 0xd8, 0xd5, 0xdb, 0xfc, 0xff, 0xff, 0xb8, 0x63, 0x0e, 0x00, 0x01, 0x3f, 0x94,
+	0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x29, 0x09, 0x3e, 0x83, 0xcc, 0xeb, 0xfb, 0xff, 0xfe, 0xf4, 0xe5, 0xd3, 0xc7, 0xbb, 0xb1, 0xa9, 0xa4,
+	0x9f, 0xaf, 0xce, 0xf0, 0xff, 0xff, 0xf7, 0xa2, 0x4d, 0x00, 0x04, 0x09, 0x3e, 0x83, 0xcc, 0xeb, 0xfb, 0xff, 0xfe, 0xf4, 0xe5, 0xd3, 0xc7, 0xbb,
+	0xb1, 0xa9, 0xa4, 0x9f, 0xaf, 0xce, 0xf0, 0xff, 0xff, 0xf7, 0xa2, 0x4d, 0x00, 0x09, 0x1a, 0x68, 0xbd, 0xf8, 0xff, 0xee, 0xba, 0x74, 0x33, 0x12,
+	0x03, 0x00, 0x07, 0x33, 0x88, 0xdd, 0xff, 0xff, 0xf7, 0xa2, 0x4d, 0x00, 0x03, 0x1a, 0x68, 0xbd, 0xf8, 0xff, 0xee, 0xba, 0x74, 0x33, 0x12, 0x03,
+	0x00, 0x07, 0x33, 0x88, 0xdd, 0xff, 0xff, 0xf7, 0xa2, 0x4d, 0x00, 0x06, 0x0d, 0x46, 0x97, 0xdf, 0xfa, 0xff, 0xff, 0xff, 0xf8, 0xe6, 0xc9, 0xa7,
+	0x87, 0x73, 0x6c, 0x70, 0x78, 0x84, 0x95, 0xaa, 0xc4, 0xe0, 0xca, 0x7f, 0x2b, 0x00, 0x05, 0x0d, 0x46, 0x97, 0xdf, 0xfa, 0xff, 0xff, 0xff, 0xf8,
+	0xe6, 0xc9, 0xa7, 0x87, 0x73, 0x6c, 0x70, 0x78, 0x84, 0x95, 0xaa, 0xc4, 0xe0, 0xca, 0x7f, 0x2b, 0x00, 0x05, 0x0d, 0x46, 0x97, 0xdf, 0xfa, 0xff,
+	0xff, 0xff, 0xf8, 0xe6, 0xc9, 0xa7, 0x87, 0x73, 0x6c, 0x70, 0x78, 0x84, 0x95, 0xaa, 0xc4, 0xe0, 0xca, 0x7f, 0x2b, 0x00, 0x05, 0x0d, 0x46, 0x97,
+	0xdf, 0xfa, 0xff, 0xff, 0xff, 0xf8, 0xe6, 0xc9, 0xa7, 0x87, 0x73, 0x6c, 0x70, 0x78, 0x84, 0x95, 0xaa, 0xc4, 0xe0, 0xca, 0x7f, 0x2b, 0x00, 0x0c,
+	0x11, 0x39, 0x77, 0xb1, 0xda, 0xf1, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf6, 0xe1, 0xbb, 0x86, 0x48, 0x1a, 0x40, 0x93, 0xe8, 0xff, 0xfe, 0xa9,
+	0x54, 0x00, 0x01, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x2d, 0x2b, 0x80, 0xd5, 0xff, 0xff, 0xfe, 0xa9, 0x54, 0x00, 0x04, 0x09,
+	0x2b, 0x5f, 0x9b, 0xcc, 0xed, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf7, 0xe5, 0xc2, 0x91, 0x51, 0x20, 0x32, 0x83, 0xd8, 0xff, 0xff, 0xb8,
+	0x63, 0x0e, 0x00, 0x04, 0x09, 0x2b, 0x5f, 0x9b, 0xcc, 0xed, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf7, 0xe5, 0xc2, 0x91, 0x51, 0x20, 0x32,
+	0x83, 0xd8, 0xff, 0xff, 0xb8, 0x63, 0x0e, 0x00, 0x04, 0x09, 0x2b, 0x5f, 0x9b, 0xcc, 0xed, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf7, 0xe5,
+	0xc2, 0x91, 0x51, 0x20, 0x32, 0x83, 0xd8, 0xff, 0xff, 0xb8, 0x63, 0x0e, 0x00, 0x04, 0x09, 0x2b, 0x5f, 0x9b, 0xcc, 0xed, 0xfd, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xfe, 0xf7, 0xe5, 0xc2, 0x91, 0x51, 0x20, 0x32, 0x83, 0xd8, 0xff, 0xff, 0xb8, 0x63, 0x0e, 0x00, 0x01, 0x3f, 0x94, 0xe9, 0xff, 0xff,
+	0xea, 0x95, 0x40, 0x00, 0x28, 0x1a, 0x68, 0xbd, 0xf8, 0xff, 0xee, 0xba, 0x74, 0x33, 0x12, 0x03, 0x00, 0x07, 0x33, 0x88, 0xdd, 0xff, 0xff, 0xf7,
+	0xa2, 0x4d, 0x00, 0x03, 0x1a, 0x68, 0xbd, 0xf8, 0xff, 0xee, 0xba, 0x74, 0x33, 0x12, 0x03, 0x00, 0x07, 0x33, 0x88, 0xdd, 0xff, 0xff, 0xf7, 0xa2,
+	0x4d, 0x00, 0x07, 0x02, 0x32, 0x87, 0xda, 0xfe, 0xff, 0xec, 0x97, 0x42, 0x00, 0x0a, 0x05, 0x54, 0xa9, 0xf9, 0xff, 0xff, 0xf7, 0xa2, 0x4d, 0x00,
+	0x01, 0x02, 0x32, 0x87, 0xda, 0xfe, 0xff, 0xec, 0x97, 0x42, 0x00, 0x0a, 0x05, 0x54, 0xa9, 0xf9, 0xff, 0xff, 0xf7, 0xa2, 0x4d, 0x00, 0x08, 0x01,
+	0x11, 0x34, 0x6a, 0xa1, 0xca, 0xe5, 0xf3, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xef, 0xd9, 0xbc, 0x88, 0x49, 0x15, 0x00, 0x07,
+	0x01, 0x11, 0x34, 0x6a, 0xa1, 0xca, 0xe5, 0xf3, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xef, 0xd9, 0xbc, 0x88, 0x49, 0x15, 0x00,
+	0x07, 0x01, 0x11, 0x34, 0x6a, 0xa1, 0xca, 0xe5, 0xf3, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xef, 0xd9, 0xbc, 0x88, 0x49, 0x15,
+	0x00, 0x07, 0x01, 0x11, 0x34, 0x6a, 0xa1, 0xca, 0xe5, 0xf3, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xef, 0xd9, 0xbc, 0x88, 0x49,
+	0x15, 0x00, 0x11, 0x02, 0x0a, 0x18, 0x25, 0x29, 0x24, 0x18, 0x0c, 0x03, 0x00, 0x0c, 0x3c, 0x8d, 0xde, 0xf3, 0xf3, 0xdf, 0x8e, 0x3d, 0x00, 0x2d,
+	0x29, 0x7a, 0xcb, 0xf3, 0xf3, 0xf2, 0xa1, 0x50, 0x00, 0x09, 0x02, 0x09, 0x14, 0x20, 0x29, 0x2b, 0x26, 0x19, 0x0c, 0x03, 0x00, 0x15, 0x02, 0x09,
+	0x14, 0x20, 0x29, 0x2b, 0x26, 0x19, 0x0c, 0x03, 0x00, 0x15, 0x02, 0x09, 0x14, 0x20, 0x29, 0x2b, 0x26, 0x19, 0x0c, 0x03, 0x00, 0x15, 0x02, 0x09,
+	0x14, 0x20, 0x29, 0x2b, 0x26, 0x19, 0x0c, 0x03, 0x00, 0x0d, 0x3c, 0x8d, 0xde, 0xf3, 0xf3, 0xdf, 0x8e, 0x3d, 0x00, 0x26, 0x02, 0x32, 0x87, 0xda,
+	0xfe, 0xff, 0xec, 0x97, 0x42, 0x00, 0x0a, 0x05, 0x54, 0xa9, 0xf9, 0xff, 0xff, 0xf7, 0xa2, 0x4d, 0x00, 0x01, 0x02, 0x32, 0x87, 0xda, 0xfe, 0xff,
+	0xec, 0x97, 0x42, 0x00, 0x0a, 0x05, 0x54, 0xa9, 0xf9, 0xff, 0xff, 0xf7, 0xa2, 0x4d, 0x00, 0x07, 0x01, 0x4a, 0x9f, 0xf2, 0xff, 0xff, 0xf9, 0xb7,
+	0x62, 0x13, 0x00, 0x08, 0x1b, 0x64, 0xb8, 0xf2, 0xff, 0xff, 0xff, 0xf7, 0xa2, 0x4d, 0x00, 0x01, 0x01, 0x4a, 0x9f, 0xf2, 0xff, 0xff, 0xf9, 0xb7,
+	0x62, 0x13, 0x00, 0x08, 0x1b, 0x64, 0xb8, 0xf2, 0xff, 0xff, 0xff, 0xf7, 0xa2, 0x4d, 0x00, 0x0f, 0x02, 0x09, 0x16, 0x24, 0x2d, 0x2f, 0x2a, 0x23,
+	0x17, 0x0b, 0x03, 0x00, 0x13, 0x02, 0x09, 0x16, 0x24, 0x2d, 0x2f, 0x2a, 0x23, 0x17, 0x0b, 0x03, 0x00, 0x13, 0x02, 0x09, 0x16, 0x24, 0x2d, 0x2f,
+	0x2a, 0x23, 0x17, 0x0b, 0x03, 0x00, 0x13, 0x02, 0x09, 0x16, 0x24, 0x2d, 0x2f, 0x2a, 0x23, 0x17, 0x0b, 0x03, 0x00, 0xff, 0x00, 0x14, 0x01, 0x4a,
+	0x9f, 0xf2, 0xff, 0xff, 0xf9, 0xb7, 0x62, 0x13, 0x00, 0x08, 0x1b, 0x64, 0xb8, 0xf2, 0xff, 0xff, 0xff, 0xf7, 0xa2, 0x4d, 0x00, 0x01, 0x01, 0x4a,
+	0x9f, 0xf2, 0xff, 0xff, 0xf9, 0xb7, 0x62, 0x13, 0x00, 0x08, 0x1b, 0x64, 0xb8, 0xf2, 0xff, 0xff, 0xff, 0xf7, 0xa2, 0x4d, 0x00, 0x08, 0x15, 0x5d,
+	0xb2, 0xf2, 0xff, 0xff, 0xfb, 0xdd, 0xb6, 0x8a, 0x6e, 0x5a, 0x55, 0x5e, 0x70, 0x8e, 0xb9, 0xe2, 0xef, 0xcf, 0xcd, 0xd6, 0xfc, 0xff, 0xf7, 0xa2,
+	0x4d, 0x00, 0x02, 0x15, 0x5d, 0xb2, 0xf2, 0xff, 0xff, 0xfb, 0xdd, 0xb6, 0x8a, 0x6e, 0x5a, 0x55, 0x5e, 0x70, 0x8e, 0xb9, 0xe2, 0xef, 0xcf, 0xcd,
+	0xd6, 0xfc, 0xff, 0xf7, 0xa2, 0x4d, 0x00, 0x83, 0x01, 0x03, 0x03, 0x02, 0x00, 0x08, 0x04, 0x05, 0x05, 0x01, 0x00, 0x09, 0x07, 0x1a, 0x3a, 0x60,
+	0x80, 0x97, 0xa5, 0xaf, 0xb9, 0xbe, 0xbc, 0xb3, 0xaa, 0xa0, 0x92, 0x7e, 0x64, 0x47, 0x28, 0x11, 0x03, 0x00, 0x0d, 0x05, 0x0e, 0x1c, 0x2a, 0x35,
+	0x38, 0x34, 0x2a, 0x21, 0x14, 0x09, 0x01, 0x00, 0x10, 0x05, 0x17, 0x35, 0x59, 0x7c, 0x9a, 0xaf, 0xbc, 0xc7, 0xd3, 0xde, 0xe4, 0xe2, 0xd8, 0xcd,
+	0xc1, 0xb6, 0xa4, 0x8a, 0x69, 0x45, 0x23, 0x0c, 0x01, 0x00, 0x19, 0x05, 0x17, 0x35, 0x59, 0x7c, 0x9a, 0xaf, 0xbc, 0xc7, 0xd3, 0xde, 0xe4, 0xe2,
+	0xd8, 0xcd, 0xc1, 0xb6, 0xa4, 0x8a, 0x69, 0x45, 0x23, 0x0c, 0x01, 0x00, 0x10, 0x0a, 0x30, 0x68, 0x9b, 0xba, 0xcd, 0xdc, 0xdd, 0xd1, 0xbd, 0xa0,
+	0x6f, 0x36, 0x0e, 0x00, 0x0e, 0x0e, 0x45, 0x82, 0xb1, 0xb7, 0x9d, 0x61, 0x24, 0x01, 0x00, 0x13, 0x10, 0x31, 0x57, 0x73, 0x84, 0x94, 0xa4, 0xb5,
+	0xc5, 0xd5, 0xe1, 0xe4, 0xdf, 0xd6, 0xcd, 0xc4, 0xb8, 0xa5, 0x8b, 0x6d, 0x4e, 0x2e, 0x14, 0x04, 0x00, 0x05, 0x15, 0x5d, 0xb2, 0xf2, 0xff, 0xff,
+	0xfb, 0xdd, 0xb6, 0x8a, 0x6e, 0x5a, 0x55, 0x5e, 0x70, 0x8e, 0xb9, 0xe2, 0xef, 0xcf, 0xcd, 0xd6, 0xfc, 0xff, 0xf7, 0xa2, 0x4d, 0x00, 0x02, 0x15,
+	0x5d, 0xb2, 0xf2, 0xff, 0xff, 0xfb, 0xdd, 0xb6, 0x8a, 0x6e, 0x5a, 0x55, 0x5e, 0x70, 0x8e, 0xb9, 0xe2, 0xef, 0xcf, 0xcd, 0xd6, 0xfc, 0xff, 0xf7,
+	0xa2, 0x4d, 0x00, 0x09, 0x01, 0x1e, 0x51, 0x93, 0xc8, 0xea, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf5, 0xe1, 0xb9, 0x83, 0x44, 0x17, 0x24,
+	0x78, 0xcd, 0xff, 0xf7, 0xa2, 0x4d, 0x00, 0x03, 0x01, 0x1e, 0x51, 0x93, 0xc8, 0xea, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf5, 0xe1, 0xb9,
+	0x83, 0x44, 0x17, 0x24, 0x78, 0xcd, 0xff, 0xf7, 0xa2, 0x4d, 0x00, 0x08, 0x0a, 0x24, 0x4e, 0x7d, 0xa3, 0xbe, 0xce, 0xda, 0xe5, 0xe9, 0xe4, 0xd9,
+	0xcc, 0xba, 0x9c, 0x72, 0x40, 0x1a, 0x04, 0x00, 0x1b, 0x0e, 0x2f, 0x56, 0x76, 0x88, 0x99, 0xa9, 0xb9, 0xc9, 0xd9, 0xe4, 0xe4, 0xd9, 0xc8, 0xb7,
+	0xa6, 0x95, 0x85, 0x6f, 0x4a, 0x23, 0x07, 0x00, 0x0b, 0x1b, 0x58, 0x95, 0xb7, 0xb7, 0xb7, 0x86, 0x49, 0x0c, 0x00, 0x11, 0x01, 0x3f, 0x7e, 0xbc,
+	0xbc, 0xbc, 0xa3, 0x64, 0x25, 0x00, 0x07, 0x19, 0x63, 0xb7, 0xf2, 0xf5, 0xcf, 0x7b, 0x2e, 0x00, 0x03, 0x08, 0x4a, 0x9b, 0xe7, 0xfa, 0xeb, 0xa1,
+	0x4d, 0x0b, 0x00, 0x04, 0x02, 0x26, 0x68, 0xba, 0xeb, 0xfe, 0xfe, 0xf9, 0xee, 0xde, 0xcd, 0xbd, 0xb6, 0xb9, 0xc4, 0xd1, 0xe1, 0xf0, 0xfc, 0xff,
+	0xe9, 0x9b, 0x46, 0x06, 0x00, 0x07, 0x09, 0x24, 0x51, 0x88, 0xbc, 0xe3, 0xf8, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf4, 0xe1,
+	0x9a, 0x4f, 0x0d, 0x00, 0x09, 0x10, 0x36, 0x70, 0xaf, 0xde, 0xf7, 0xf0, 0xd3, 0xb1, 0x97, 0x85, 0x74, 0x62, 0x51, 0x40, 0x38, 0x3b, 0x49, 0x5a,
+	0x6c, 0x7d, 0x8e, 0xa3, 0xc4, 0xe4, 0xf8, 0xec, 0xc7, 0x8d, 0x4e, 0x1e, 0x05, 0x00, 0x11, 0x10, 0x36, 0x70, 0xaf, 0xde, 0xf7, 0xf0, 0xd3, 0xb1,
+	0x97, 0x85, 0x74, 0x62, 0x51, 0x40, 0x38, 0x3b, 0x49, 0x5a, 0x6c, 0x7d, 0x8e, 0xa3, 0xc4, 0xe4, 0xf8, 0xec, 0xc7, 0x8d, 0x4e, 0x1e, 0x05, 0x00,
+	0x0a, 0x0c, 0x4f, 0xa4, 0xec, 0xfe, 0xfb, 0xe6, 0xbd, 0x92, 0x8e, 0xb0, 0xde, 0xf8, 0xff, 0xf2, 0xb3, 0x5e, 0x16, 0x00, 0x0a, 0x04, 0x32, 0x86,
+	0xd6, 0xfd, 0xf4, 0xb8, 0x63, 0x19, 0x00, 0x10, 0x01, 0x13, 0x39, 0x73, 0xb0, 0xdf, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf3, 0xe4, 0xd2, 0xc5,
+	0xc2, 0xca, 0xd5, 0xe1, 0xee, 0xf8, 0xfe, 0xff, 0xfe, 0xde, 0x8e, 0x39, 0x05, 0x00, 0x06, 0x01, 0x1e, 0x51, 0x93, 0xc8, 0xea, 0xfc, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xfe, 0xf5, 0xe1, 0xb9, 0x83, 0x44, 0x17, 0x24, 0x78, 0xcd, 0xff, 0xf7, 0xa2, 0x4d, 0x00, 0x03, 0x01, 0x1e, 0x51, 0x93, 0xc8,
+	0xea, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf5, 0xe1, 0xb9, 0x83, 0x44, 0x17, 0x24, 0x78, 0xcd, 0xff, 0xf7, 0xa2, 0x4d, 0x00, 0x0e, 0x05,
+	0x0e, 0x1a, 0x26, 0x2b, 0x2a, 0x23, 0x17, 0x0b, 0x02, 0x00, 0x13, 0x05, 0x0e, 0x1a, 0x26, 0x2b, 0x2a, 0x23, 0x17, 0x0b, 0x02, 0x00, 0x11, 0x15,
+	0x52, 0xa7, 0xe7, 0xfe, 0xff, 0xfd, 0xf2, 0xde, 0xc3, 0xaa, 0x9e, 0xa1, 0xba, 0xd9, 0xf3, 0xfe, 0xff, 0xfb, 0xd4, 0x87, 0x36, 0x08, 0x00, 0x15,
+	0x0c, 0x2f, 0x66, 0xa7, 0xd9, 0xf7, 0xff, 0xff, 0xff, 0xfe, 0xfa, 0xef, 0xdf, 0xcd, 0xc1, 0xc1, 0xcd, 0xdf, 0xef, 0xfa, 0xfe, 0xff, 0xff, 0xfe,
+	0xef, 0xcb, 0x91, 0x50, 0x20, 0x05, 0x00, 0x07, 0x25, 0x7a, 0xcf, 0xff, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x11, 0x01, 0x56, 0xab, 0xff, 0xff,
+	0xff, 0xdd, 0x88, 0x33, 0x00, 0x07, 0x13, 0x56, 0xa4, 0xe1, 0xe4, 0xbd, 0x6d, 0x26, 0x00, 0x03, 0x05, 0x3f, 0x8a, 0xd6, 0xe5, 0xd2, 0x84, 0x3a,
+	0x04, 0x00, 0x04, 0x30, 0x85, 0xda, 0xff, 0xff, 0xee, 0xac, 0x57, 0x13, 0x00, 0x08, 0x07, 0x18, 0x31, 0x2b, 0x1a, 0x01, 0x00, 0x06, 0x15, 0x59,
+	0xae, 0xee, 0xff, 0xff, 0xff, 0xfe, 0xf6, 0xe0, 0xbf, 0x99, 0x79, 0x67, 0x67, 0x74, 0x86, 0x9d, 0xb7, 0xa1, 0x64, 0x1d, 0x00, 0x07, 0x12, 0x48,
+	0x96, 0xd9, 0xf3, 0xe3, 0xb9, 0x81, 0x48, 0x1d, 0x05, 0x00, 0x0f, 0x01, 0x10, 0x33, 0x67, 0xa1, 0xd3, 0xf2, 0xec, 0xb9, 0x69, 0x26, 0x03, 0x00,
+	0x0b, 0x12, 0x48, 0x96, 0xd9, 0xf3, 0xe3, 0xb9, 0x81, 0x48, 0x1d, 0x05, 0x00, 0x0f, 0x01, 0x10, 0x33, 0x67, 0xa1, 0xd3, 0xf2, 0xec, 0xb9, 0x69,
+	0x26, 0x03, 0x00, 0x06, 0x10, 0x5e, 0xb3, 0xf8, 0xff, 0xd6, 0x83, 0x2e, 0x02, 0x00, 0x03, 0x18, 0x6d, 0xc1, 0xff, 0xfd, 0xca, 0x75, 0x21, 0x00,
+	0x08, 0x1d, 0x69, 0xbe, 0xf6, 0xfc, 0xd2, 0x80, 0x2e, 0x03, 0x00, 0x0f, 0x04, 0x33, 0x83, 0xd4, 0xfa, 0xff, 0xff, 0xfe, 0xee, 0xc7, 0x8b, 0x4f,
+	0x24, 0x0c, 0x03, 0x00, 0x07, 0x02, 0x0f, 0x27, 0x48, 0x53, 0x3a, 0x17, 0x00, 0x0d, 0x05, 0x0e, 0x1a, 0x26, 0x2b, 0x2a, 0x23, 0x17, 0x0b, 0x02,
+	0x00, 0x13, 0x05, 0x0e, 0x1a, 0x26, 0x2b, 0x2a, 0x23, 0x17, 0x0b, 0x02, 0x00, 0x50, 0x11, 0x66, 0xbb, 0xfe, 0xff, 0xff, 0xe0, 0x8e, 0x39, 0x02,
+	0x00, 0x05, 0x0c, 0x4a, 0x9f, 0xe8, 0xff, 0xff, 0xed, 0x98, 0x43, 0x00, 0x13, 0x15, 0x5d, 0xb2, 0xf2, 0xff, 0xff, 0xff, 0xf1, 0xcb, 0x8e, 0x4d,
+	0x1f, 0x08, 0x01, 0x00, 0x06, 0x01, 0x08, 0x20, 0x4f, 0x90, 0xcd, 0xf2, 0xff, 0xff, 0xfe, 0xe2, 0x95, 0x41, 0x08, 0x00, 0x05, 0x25, 0x7a, 0xcf,
+	0xff, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x11, 0x01, 0x56, 0xab, 0xff, 0xff, 0xff, 0xdd, 0x88, 0x33, 0x00, 0x1f, 0x1b, 0x6f, 0xc4, 0xfe, 0xff,
+	0xf3, 0xbe, 0x71, 0x28, 0x08, 0x00, 0x11, 0x0a, 0x44, 0x99, 0xe3, 0xff, 0xff, 0xfd, 0xc9, 0x84, 0x35, 0x14, 0x04, 0x00, 0x11, 0x1d, 0x60, 0xb4,
+	0xec, 0xee, 0xb4, 0x60, 0x1b, 0x01, 0x00, 0x04, 0x0a, 0x29, 0x5a, 0x8a, 0xaa, 0xbd, 0xcd, 0xdd, 0xe8, 0xea, 0xe3, 0xd7, 0xc8, 0xb1, 0x95, 0x64,
+	0x33, 0x0b, 0x00, 0x02, 0x0a, 0x3d, 0x8f, 0xda, 0xf6, 0xd1, 0x85, 0x36, 0x08, 0x00, 0x07, 0x1d, 0x60, 0xb4, 0xec, 0xee, 0xb4, 0x60, 0x1b, 0x01,
+	0x00, 0x02, 0x16, 0x5f, 0xa8, 0xdb, 0xdb, 0xdb, 0xdb, 0xda, 0xd5, 0xc8, 0xb3, 0x9d, 0x86, 0x70, 0x5a, 0x3a, 0x1c, 0x05, 0x00, 0x04, 0x0a, 0x3d,
+	0x8f, 0xda, 0xf6, 0xd1, 0x85, 0x36, 0x08, 0x00, 0x04, 0x34, 0x89, 0xde, 0xff, 0xfc, 0xae, 0x59, 0x07, 0x00, 0x05, 0x3e, 0x93, 0xe8, 0xff, 0xf8,
+	0xa4, 0x4f, 0x01, 0x00, 0x05, 0x0e, 0x4d, 0xa2, 0xe9, 0xff, 0xe6, 0x9c, 0x47, 0x0b, 0x00, 0x10, 0x1b, 0x66, 0xbb, 0xf5, 0xff, 0xff, 0xf8, 0xc5,
+	0x76, 0x27, 0x06, 0x00, 0x5e, 0x03, 0x19, 0x3c, 0x61, 0x79, 0x87, 0x96, 0xa5, 0xb4, 0xc2, 0xd1, 0xde, 0xe4, 0xe2, 0xda, 0xd1, 0xc9, 0xc0, 0xb2,
+	0x9e, 0x84, 0x67, 0x4a, 0x2c, 0x13, 0x04, 0x00, 0x1f, 0x2b, 0x80, 0xd5, 0xff, 0xff, 0xf5, 0xa0, 0x4b, 0x00, 0x08, 0x20, 0x75, 0xca, 0xff, 0xff,
+	0xfa, 0xab, 0x56, 0x06, 0x00, 0x10, 0x03, 0x33, 0x87, 0xd9, 0xfe, 0xff, 0xff, 0xde, 0x93, 0x3e, 0x0a, 0x00, 0x10, 0x0b, 0x44, 0x99, 0xe2, 0xff,
+	0xff, 0xf9, 0xc3, 0x6e, 0x1f, 0x00, 0x04, 0x25, 0x7a, 0xcf, 0xff, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x11, 0x01, 0x56, 0xab, 0xff, 0xff, 0xff,
+	0xdd, 0x88, 0x33, 0x00, 0x0a, 0x03, 0x0a, 0x16, 0x22, 0x2f, 0x37, 0x37, 0x31, 0x27, 0x1d, 0x11, 0x08, 0x01, 0x00, 0x09, 0x16, 0x49, 0x92, 0xd1,
+	0xf3, 0xff, 0xff, 0xf5, 0xdc, 0xb7, 0x8e, 0x68, 0x42, 0x1f, 0x09, 0x00, 0x0b, 0x3d, 0x92, 0xe7, 0xff, 0xff, 0xff, 0xd3, 0x7e, 0x29, 0x00, 0x12,
+	0x04, 0x3f, 0x94, 0xe4, 0xed, 0xb1, 0x5c, 0x19, 0x00, 0x04, 0x05, 0x35, 0x80, 0xcf, 0xf5, 0xff, 0xf8, 0xdc, 0xb7, 0x93, 0x7e, 0x73, 0x72, 0x7b,
+	0x8e, 0xa7, 0xc5, 0xb0, 0x6d, 0x22, 0x00, 0x05, 0x09, 0x3a, 0x8c, 0xd8, 0xf5, 0xba, 0x65, 0x17, 0x00, 0x04, 0x04, 0x3f, 0x94, 0xe4, 0xed, 0xb1,
+	0x5c, 0x19, 0x00, 0x05, 0x19, 0x6e, 0xc3, 0xff, 0xff, 0xe7, 0xbe, 0x95, 0x89, 0x95, 0xa8, 0xc1, 0xde, 0xf4, 0xff, 0xf3, 0xac, 0x57, 0x0e, 0x00,
+	0x05, 0x09, 0x3a, 0x8c, 0xd8, 0xf5, 0xba, 0x65, 0x17, 0x00, 0x03, 0x47, 0x9c, 0xf1, 0xff, 0xe3, 0x8e, 0x39, 0x00, 0x06, 0x1a, 0x6f, 0xc4, 0xff,
+	0xff, 0xbb, 0x66, 0x11, 0x00, 0x03, 0x04, 0x32, 0x86, 0xd6, 0xfd, 0xf4, 0xb9, 0x64, 0x1a, 0x00, 0x10, 0x01, 0x3c, 0x91, 0xe5, 0xff, 0xff, 0xff,
+	0xe2, 0x94, 0x3f, 0x07, 0x00, 0x22, 0x08, 0x2a, 0x56, 0x80, 0x97, 0xab, 0xc0, 0xd4, 0xe1, 0xe1, 0xd3, 0xbe, 0xa9, 0x94, 0x79, 0x4c, 0x21, 0x04,
+	0x00, 0x0e, 0x03, 0x2a, 0x6e, 0xae, 0xca, 0xcb, 0xcb, 0xca, 0xae, 0x6d, 0x2a, 0x02, 0x00, 0x0e, 0x0b, 0x29, 0x5b, 0x94, 0xc9, 0xed, 0xfd, 0xff,
+	0xff, 0xff, 0xfe, 0xf9, 0xee, 0xdf, 0xcf, 0xc3, 0xbf, 0xc2, 0xcb, 0xd9, 0xe9, 0xf6, 0xfd, 0xff, 0xff, 0xff, 0xe6, 0x98, 0x43, 0x06, 0x00, 0x1f,
+	0x09, 0x53, 0xa8, 0xf4, 0xff, 0xff, 0xdd, 0x8d, 0x38, 0x05, 0x00, 0x04, 0x0c, 0x3a, 0x8c, 0xd4, 0xfc, 0xff, 0xf7, 0xbe, 0x69, 0x1c, 0x00, 0x10,
+	0x07, 0x4f, 0xa4, 0xf2, 0xff, 0xff, 0xfb, 0xc6, 0x71, 0x20, 0x00, 0x14, 0x27, 0x7a, 0xcf, 0xfd, 0xff, 0xff, 0xe4, 0x8f, 0x3a, 0x00, 0x03, 0x25,
+	0x7a, 0xcf, 0xff, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x11, 0x01, 0x56, 0xab, 0xff, 0xff, 0xff, 0xdd, 0x88, 0x33, 0x00, 0x04, 0x12, 0x3a, 0x6d,
+	0x9a, 0xbd, 0xdd, 0xf3, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xee, 0xd1, 0xa6, 0x6b, 0x34, 0x0b, 0x00, 0x06, 0x0b, 0x30,
+	0x72, 0xbb, 0xec, 0xff, 0xf9, 0xf6, 0xf6, 0xfc, 0xff, 0xff, 0xfa, 0xe8, 0xc8, 0x9a, 0x64, 0x2f, 0x0d, 0x00, 0x05, 0x0c, 0x61, 0xb6, 0xfe, 0xff,
+	0xff, 0xec, 0x98, 0x43, 0x01, 0x00, 0x11, 0x08, 0x50, 0xa5, 0xf1, 0xdd, 0x88, 0x33, 0x00, 0x05, 0x1c, 0x69, 0xbe, 0xf7, 0xff, 0xec, 0xa9, 0x55,
+	0x13, 0x00, 0x13, 0x10, 0x63, 0xb8, 0xfc, 0xcc, 0x77, 0x23, 0x00, 0x02, 0x08, 0x50, 0xa5, 0xf1, 0xdd, 0x88, 0x33, 0x00, 0x07, 0x19, 0x6e, 0xc3,
+	0xff, 0xff, 0xcf, 0x7a, 0x25, 0x00, 0x03, 0x03, 0x3c, 0x91, 0xe3, 0xff, 0xfa, 0xb9, 0x64, 0x14, 0x00, 0x06, 0x10, 0x63, 0xb8, 0xfc, 0xcc, 0x77,
+	0x23, 0x00, 0x02, 0x39, 0x8e, 0xe3, 0xff, 0xf5, 0xa1, 0x4c, 0x01, 0x00, 0x05, 0x30, 0x85, 0xda, 0xff, 0xfe, 0xaf, 0x5a, 0x06, 0x00, 0x02, 0x1d,
+	0x69, 0xbe, 0xf6, 0xfc, 0xd2, 0x80, 0x2e, 0x03, 0x00, 0x03, 0x01, 0x01, 0x01, 0x00, 0x0b, 0x1b, 0x70, 0xc5, 0xff, 0xff, 0xff, 0xdd, 0x88, 0x33,
+	0x00, 0x21, 0x06, 0x29, 0x68, 0xb6, 0xe9, 0xfe, 0xff, 0xfa, 0xee, 0xda, 0xc2, 0xb2, 0xb2, 0xc2, 0xda, 0xee, 0xfa, 0xff, 0xfc, 0xe1, 0xaa, 0x5b,
+	0x21, 0x04, 0x00, 0x09, 0x09, 0x36, 0x84, 0xcf, 0xf8, 0xfe, 0xed, 0xdc, 0xdc, 0xed, 0xfe, 0xf7, 0xcd, 0x82, 0x34, 0x09, 0x00, 0x0a, 0x21, 0x6c,
+	0xc0, 0xf5, 0xff, 0xff, 0xfe, 0xf1, 0xcf, 0x98, 0x5c, 0x2f, 0x12, 0x06, 0x00, 0x09, 0x08, 0x18, 0x32, 0x51, 0x63, 0x49, 0x23, 0x00, 0x22, 0x07,
+	0x3a, 0x8e, 0xdb, 0xfd, 0xff, 0xf9, 0xd3, 0x8d, 0x4b, 0x3d, 0x61, 0x9b, 0xd0, 0xf2, 0xff, 0xfd, 0xe9, 0xb9, 0x68, 0x28, 0x03, 0x00, 0x11, 0x26,
+	0x7b, 0xd0, 0xff, 0xff, 0xff, 0xcc, 0x77, 0x22, 0x00, 0x16, 0x2d, 0x82, 0xd7, 0xff, 0xff, 0xff, 0xbd, 0x68, 0x13, 0x00, 0x02, 0x25, 0x7a, 0xcf,
+	0xff, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x11, 0x01, 0x56, 0xab, 0xff, 0xff, 0xff, 0xdd, 0x88, 0x33, 0x00, 0x04, 0x05, 0x3b, 0x90, 0xd7, 0xe1,
+	0xc1, 0x9f, 0x84, 0x71, 0x64, 0x57, 0x4e, 0x4d, 0x55, 0x6a, 0x8d, 0xc1, 0xe8, 0xfe, 0xff, 0xfd, 0xdb, 0x8c, 0x39, 0x05, 0x00, 0x02, 0x09, 0x47,
+	0x9b, 0xe7, 0xfe, 0xed, 0xb7, 0x6a, 0x27, 0x08, 0x0a, 0x21, 0x43, 0x6c, 0x9b, 0xcd, 0xef, 0xfe, 0xff, 0xf5, 0xc5, 0x74, 0x28, 0x03, 0x00, 0x02,
+	0x28, 0x7d, 0xd2, 0xff, 0xff, 0xff, 0xc0, 0x6b, 0x16, 0x00, 0x12, 0x2c, 0x81, 0xd6, 0xf8, 0xa9, 0x54, 0x06, 0x00, 0x04, 0x06, 0x58, 0xad, 0xfc,
+	0xff, 0xe8, 0x94, 0x3f, 0x01, 0x00, 0x15, 0x2e, 0x83, 0xd8, 0xfa, 0xa8, 0x53, 0x03, 0x00, 0x01, 0x2c, 0x81, 0xd6, 0xf8, 0xa9, 0x54, 0x06, 0x00,
+	0x07, 0x19, 0x6e, 0xc3, 0xff, 0xff, 0xcf, 0x7a, 0x25, 0x00, 0x02, 0x01, 0x0f, 0x58, 0xac, 0xf2, 0xff, 0xfb, 0xb9, 0x64, 0x13, 0x00, 0x07, 0x2e,
+	0x83, 0xd8, 0xfa, 0xa8, 0x53, 0x03, 0x00, 0x01, 0x1b, 0x70, 0xc5, 0xfe, 0xff, 0xc5, 0x70, 0x1b, 0x00, 0x04, 0x07, 0x58, 0xad, 0xfb, 0xff, 0xe7,
+	0x92, 0x3d, 0x00, 0x01, 0x0e, 0x4d, 0xa2, 0xe9, 0xff, 0xe6, 0x9d, 0x48, 0x0f, 0x1f, 0x56, 0x95, 0xc1, 0xda, 0xec, 0xf6, 0xf3, 0xe4, 0xcf, 0xac,
+	0x74, 0x36, 0x0d, 0x00, 0x05, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xff, 0xb9, 0x64, 0x0f, 0x00, 0x20, 0x1b, 0x6e, 0xc3, 0xfd, 0xff, 0xfd, 0xe0, 0x9e,
+	0x4b, 0x13, 0x00, 0x06, 0x12, 0x49, 0x9b, 0xde, 0xfc, 0xff, 0xf9, 0xb8, 0x63, 0x14, 0x00, 0x05, 0x02, 0x1e, 0x5b, 0xad, 0xe5, 0xfb, 0xe7, 0xb8,
+	0x70, 0x30, 0x0a, 0x0a, 0x31, 0x71, 0xb9, 0xe8, 0xfc, 0xe5, 0xad, 0x5b, 0x1f, 0x02, 0x00, 0x05, 0x15, 0x5a, 0xaf, 0xee, 0xff, 0xff, 0xf9, 0xc6,
+	0x79, 0x2a, 0x07, 0x00, 0x39, 0x0a, 0x38, 0x8a, 0xd4, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xeb, 0xc7, 0x91, 0x53, 0x23, 0x06, 0x00, 0x14,
+	0x45, 0x9a, 0xef, 0xff, 0xff, 0xfe, 0xb0, 0x5b, 0x07, 0x00, 0x16, 0x12, 0x67, 0xbc, 0xff, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x02, 0x25, 0x7a,
+	0xcf, 0xff, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x11, 0x01, 0x56, 0xab, 0xff, 0xff, 0xff, 0xdd, 0x88, 0x33, 0x00, 0x06, 0x03, 0x03, 0x03, 0x00,
+	0x0b, 0x11, 0x60, 0xb5, 0xf9, 0xff, 0xff, 0xd5, 0x80, 0x2b, 0x00, 0x02, 0x3b, 0x90, 0xe5, 0xff, 0xf8, 0xa4, 0x4f, 0x01, 0x00, 0x07, 0x07, 0x31,
+	0x85, 0xd3, 0xfe, 0xff, 0xe4, 0x8f, 0x3a, 0x00, 0x02, 0x0e, 0x63, 0xb8, 0xfe, 0xff, 0xff, 0xeb, 0x97, 0x42, 0x01, 0x00, 0x11, 0x4a, 0x9f, 0xf4,
+	0xd2, 0x7d, 0x28, 0x00, 0x05, 0x23, 0x78, 0xcd, 0xff, 0xff, 0xcb, 0x76, 0x21, 0x00, 0x16, 0x04, 0x56, 0xab, 0xfb, 0xc6, 0x71, 0x1c, 0x00, 0x01,
+	0x4a, 0x9f, 0xf4, 0xd2, 0x7d, 0x28, 0x00, 0x08, 0x19, 0x6e, 0xc3, 0xff, 0xff, 0xf2, 0xdb, 0xc5, 0xc2, 0xd0, 0xe6, 0xf6, 0xfe, 0xfd, 0xee, 0xc5,
+	0x7b, 0x36, 0x0a, 0x00, 0x08, 0x04, 0x56, 0xab, 0xfb, 0xc6, 0x71, 0x1c, 0x00, 0x02, 0x1d, 0x6f, 0xc4, 0xfc, 0xf7, 0xd7, 0xa3, 0x62, 0x36, 0x31,
+	0x55, 0x94, 0xcc, 0xf1, 0xff, 0xe6, 0x95, 0x40, 0x08, 0x32, 0x85, 0xd6, 0xfd, 0xf4, 0xb9, 0x64, 0x1a, 0x27, 0x79, 0xce, 0xfc, 0xfe, 0xed, 0xc8,
+	0x92, 0x72, 0x7b, 0xaa, 0xda, 0xf6, 0xff, 0xee, 0xa5, 0x50, 0x0b, 0x00, 0x02, 0x0a, 0x5f, 0xb4, 0xff, 0xff, 0xff, 0xf0, 0x9b, 0x46, 0x00, 0x20,
+	0x1d, 0x71, 0xc6, 0xfd, 0xff, 0xfc, 0xb7, 0x62, 0x10, 0x00, 0x0a, 0x0c, 0x5b, 0xb0, 0xf9, 0xff, 0xfc, 0xc1, 0x6c, 0x1a, 0x00, 0x04, 0x26, 0x51,
+	0x7b, 0x7f, 0x6c, 0x44, 0x1b, 0x03, 0x00, 0x06, 0x03, 0x1b, 0x45, 0x6c, 0x7f, 0x7b, 0x51, 0x26, 0x00, 0x04, 0x37, 0x8c, 0xe1, 0xff, 0xff, 0xff,
+	0xe2, 0x95, 0x40, 0x07, 0x00, 0x38, 0x02, 0x19, 0x45, 0x82, 0xbb, 0xe4, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xb7, 0x67, 0x26, 0x05,
+	0x00, 0x15, 0x0b, 0x60, 0xb5, 0xff, 0xff, 0xff, 0xee, 0x99, 0x44, 0x00, 0x18, 0x51, 0xa6, 0xfb, 0xff, 0xff, 0xfb, 0xa7, 0x52, 0x01, 0x00, 0x01,
+	0x25, 0x7a, 0xcf, 0xff, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x11, 0x01, 0x56, 0xab, 0xff, 0xff, 0xff, 0xdd, 0x88, 0x33, 0x00, 0x15, 0x31, 0x86,
+	0xdb, 0xff, 0xff, 0xf3, 0x9e, 0x49, 0x00, 0x02, 0x2d, 0x82, 0xd7, 0xff, 0xff, 0xda, 0x8f, 0x3a, 0x0a, 0x00, 0x08, 0x48, 0x9d, 0xf2, 0xff, 0xf4,
+	0xa0, 0x4b, 0x00, 0x03, 0x3e, 0x93, 0xe8, 0xff, 0xff, 0xff, 0xd2, 0x7d, 0x28, 0x00, 0x11, 0x35, 0x8a, 0xdf, 0xef, 0x9b, 0x46, 0x01, 0x00, 0x04,
+	0x0f, 0x64, 0xb9, 0xff, 0xff, 0xd9, 0x84, 0x2f, 0x00, 0x16, 0x20, 0x75, 0xca, 0xfd, 0xb2, 0x5d, 0x09, 0x00, 0x01, 0x35, 0x8a, 0xdf, 0xef, 0x9b,
+	0x46, 0x01, 0x00, 0x07, 0x19, 0x6e, 0xc3, 0xff, 0xff, 0xeb, 0xc8, 0xa5, 0xa1, 0xc4, 0xe7, 0xff, 0xfd, 0xcf, 0x7c, 0x29, 0x02, 0x00, 0x0a, 0x20,
+	0x75, 0xca, 0xfd, 0xb2, 0x5d, 0x09, 0x00, 0x03, 0x0a, 0x30, 0x71, 0xbb, 0xea, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xd4, 0x96, 0x4a, 0x18,
+	0x1e, 0x69, 0xbe, 0xf6, 0xfc, 0xd3, 0x81, 0x2f, 0x03, 0x2d, 0x82, 0xd7, 0xff, 0xfd, 0xb4, 0x5f, 0x0b, 0x00, 0x04, 0x2b, 0x80, 0xd5, 0xff, 0xf8,
+	0xb3, 0x5e, 0x10, 0x00, 0x02, 0x4c, 0xa1, 0xf5, 0xff, 0xff, 0xfc, 0xac, 0x57, 0x04, 0x00, 0x1e, 0x14, 0x68, 0xbd, 0xfe, 0xff, 0xff, 0xc9, 0x74,
+	0x1f, 0x00, 0x0c, 0x17, 0x6b, 0xc0, 0xfe, 0xff, 0xfe, 0xbe, 0x69, 0x15, 0x00, 0x0a, 0x03, 0x08, 0x0c, 0x0e, 0x0e, 0x0c, 0x08, 0x03, 0x00, 0x0a,
+	0x16, 0x6b, 0xc0, 0xff, 0xff, 0xff, 0xdd, 0x88, 0x33, 0x00, 0x38, 0x14, 0x4a, 0x9a, 0xda, 0xf9, 0xff, 0xfd, 0xe6, 0xb9, 0x7a, 0x41, 0x36, 0x5c,
+	0xa9, 0xe2, 0xfc, 0xff, 0xfc, 0xe1, 0xa7, 0x58, 0x1e, 0x02, 0x00, 0x06, 0x27, 0x7b, 0xcf, 0xfc, 0xfc, 0xf5, 0xad, 0x59, 0x0c, 0x00, 0x04, 0x4c,
+	0xa1, 0xf5, 0xff, 0xff, 0xfb, 0xaa, 0x55, 0x03, 0x00, 0x16, 0x0c, 0x61, 0xb6, 0xff, 0xff, 0xff, 0xe7, 0x92, 0x3d, 0x00, 0x02, 0x25, 0x7a, 0xcf,
+	0xff, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x11, 0x01, 0x56, 0xab, 0xff, 0xff, 0xff, 0xdd, 0x88, 0x33, 0x00, 0x08, 0x0b, 0x22, 0x3f, 0x56, 0x64,
+	0x6f, 0x7b, 0x86, 0x90, 0x97, 0x9c, 0x9f, 0xa3, 0xb4, 0xd3, 0xf0, 0xff, 0xff, 0xf7, 0xa2, 0x4d, 0x00, 0x02, 0x02, 0x24, 0x6e, 0xc1, 0xf3, 0xff,
+	0xfe, 0xf2, 0xd1, 0xa1, 0x6f, 0x44, 0x21, 0x0a, 0x01, 0x16, 0x53, 0xa7, 0xe7, 0xff, 0xf4, 0xb1, 0x5c, 0x12, 0x00, 0x03, 0x0a, 0x43, 0x98, 0xe3,
+	0xff, 0xff, 0xfd, 0xc9, 0x85, 0x36, 0x15, 0x04, 0x00, 0x0e, 0x11, 0x64, 0xb9, 0xfc, 0xce, 0x79, 0x24, 0x00, 0x05, 0x37, 0x8c, 0xe1, 0xff, 0xfb,
+	0xc7, 0x72, 0x21, 0x00, 0x14, 0x06, 0x54, 0xa9, 0xf8, 0xe0, 0x8b, 0x36, 0x00, 0x02, 0x11, 0x64, 0xb9, 0xfc, 0xce, 0x79, 0x24, 0x00, 0x07, 0x19,
+	0x6e, 0xc3, 0xff, 0xff, 0xcf, 0x7a, 0x25, 0x00, 0x01, 0x16, 0x5c, 0xb1, 0xf0, 0xff, 0xf3, 0xbb, 0x66, 0x1d, 0x00, 0x08, 0x06, 0x54, 0xa9, 0xf8,
+	0xe0, 0x8b, 0x36, 0x00, 0x07, 0x02, 0x0a, 0x1a, 0x2e, 0x3e, 0x40, 0x34, 0x21, 0x0f, 0x04, 0x00, 0x01, 0x0d, 0x4c, 0xa1, 0xe9, 0xff, 0xe6, 0x9d,
+	0x48, 0x0c, 0x00, 0x01, 0x01, 0x52, 0xa7, 0xfa, 0xff, 0xe3, 0x8e, 0x39, 0x00, 0x05, 0x06, 0x56, 0xab, 0xfa, 0xff, 0xdc, 0x87, 0x32, 0x00, 0x02,
+	0x2d, 0x82, 0xd7, 0xff, 0xff, 0xff, 0xc9, 0x74, 0x1f, 0x00, 0x1e, 0x2d, 0x82, 0xd7, 0xff, 0xff, 0xf7, 0xa2, 0x4d, 0x00, 0x0e, 0x42, 0x97, 0xec,
+	0xff, 0xff, 0xdc, 0x87, 0x32, 0x00, 0x0a, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x0a, 0x3d, 0x92, 0xe7, 0xff, 0xff, 0xff, 0xb9,
+	0x64, 0x0f, 0x00, 0x36, 0x03, 0x38, 0x8c, 0xde, 0xfe, 0xff, 0xfb, 0xcd, 0x7e, 0x2d, 0x06, 0x00, 0x04, 0x05, 0x26, 0x65, 0xb3, 0xe7, 0xfe, 0xff,
+	0xfa, 0xda, 0x9c, 0x4d, 0x18, 0x01, 0x00, 0x01, 0x03, 0x32, 0x87, 0xd9, 0xff, 0xff, 0xf3, 0xae, 0x59, 0x10, 0x00, 0x05, 0x2c, 0x81, 0xd6, 0xff,
+	0xff, 0xff, 0xc5, 0x70, 0x1b, 0x00, 0x16, 0x26, 0x7b, 0xd0, 0xff, 0xff, 0xff, 0xc5, 0x70, 0x1b, 0x00, 0x02, 0x24, 0x79, 0xce, 0xff, 0xff, 0xff,
+	0xbc, 0x67, 0x12, 0x00, 0x11, 0x02, 0x57, 0xac, 0xff, 0xff, 0xff, 0xdc, 0x87, 0x32, 0x00, 0x04, 0x09, 0x3e, 0x83, 0xcc, 0xeb, 0xfb, 0xff, 0xfe,
+	0xf4, 0xe5, 0xd3, 0xc7, 0xbb, 0xb1, 0xa9, 0xa4, 0x9f, 0xaf, 0xce, 0xf0, 0xff, 0xff, 0xf7, 0xa2, 0x4d, 0x00, 0x05, 0x0c, 0x2e, 0x62, 0x99, 0xc8,
+	0xe8, 0xfa, 0xff, 0xff, 0xfb, 0xec, 0xe6, 0xea, 0xf9, 0xfc, 0xdc, 0xa3, 0x52, 0x1d, 0x01, 0x00, 0x06, 0x15, 0x58, 0xad, 0xed, 0xfe, 0xff, 0xff,
+	0xfe, 0xf6, 0xe1, 0xc1, 0x9b, 0x7f, 0x72, 0x76, 0x80, 0x8c, 0x9f, 0xb8, 0xd4, 0x97, 0x4f, 0x00, 0x03, 0x12, 0x5e, 0xb3, 0xf2, 0xd1, 0x82, 0x30,
+	0x05, 0x00, 0x04, 0x1c, 0x69, 0xbe, 0xf7, 0xff, 0xf1, 0xcd, 0x94, 0x62, 0x42, 0x31, 0x25, 0x21, 0x27, 0x35, 0x47, 0x5c, 0x57, 0x39, 0x12, 0x00,
+	0x06, 0x19, 0x5d, 0xb2, 0xee, 0xd8, 0x84, 0x2f, 0x01, 0x00, 0x03, 0x12, 0x5e, 0xb3, 0xf2, 0xd1, 0x82, 0x30, 0x05, 0x00, 0x05, 0x19, 0x6e, 0xc3,
+	0xff, 0xff, 0xcf, 0x7a, 0x25, 0x00, 0x02, 0x01, 0x23, 0x71, 0xc5, 0xf7, 0xff, 0xed, 0xac, 0x57, 0x14, 0x00, 0x05, 0x19, 0x5d, 0xb2, 0xee, 0xd8,
+	0x84, 0x2f, 0x01, 0x00, 0x10, 0x04, 0x32, 0x85, 0xd6, 0xfd, 0xf4, 0xba, 0x65, 0x1b, 0x00, 0x03, 0x0f, 0x64, 0xb9, 0xff, 0xff, 0xc5, 0x70, 0x1b,
+	0x00, 0x06, 0x35, 0x8a, 0xdf, 0xff, 0xf2, 0x9d, 0x48, 0x00, 0x02, 0x0d, 0x5f, 0xb4, 0xfc, 0xff, 0xff, 0xf4, 0xb2, 0x5d, 0x13, 0x00, 0x1d, 0x42,
+	0x97, 0xec, 0xff, 0xff, 0xe9, 0x94, 0x3f, 0x00, 0x0e, 0x32, 0x87, 0xdc, 0xff, 0xff, 0xf3, 0x9e, 0x49, 0x00, 0x0a, 0x3f, 0x94, 0xe9, 0xff, 0xff,
+	0xea, 0x95, 0x40, 0x00, 0x09, 0x09, 0x5e, 0xb3, 0xfe, 0xff, 0xff, 0xf0, 0x9b, 0x46, 0x00, 0x0b, 0x19, 0x5a, 0x9c, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5,
+	0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0x92, 0x51, 0x0f, 0x00, 0x1a, 0x23, 0x78, 0xcd, 0xff, 0xff, 0xff, 0xc3, 0x6e, 0x19, 0x00, 0x09, 0x08,
+	0x2d, 0x70, 0xbd, 0xed, 0xff, 0xff, 0xf7, 0xd2, 0x92, 0x6e, 0x8b, 0xca, 0xf6, 0xff, 0xfc, 0xd5, 0x85, 0x33, 0x04, 0x00, 0x06, 0x0d, 0x5f, 0xb4,
+	0xfc, 0xff, 0xff, 0xf2, 0xab, 0x56, 0x0e, 0x00, 0x14, 0x14, 0x61, 0xb6, 0xf7, 0xff, 0xff, 0xf3, 0x9f, 0x4a, 0x01, 0x00, 0x02, 0x0a, 0x5e, 0xb3,
+	0xfd, 0xff, 0xff, 0xeb, 0x99, 0x44, 0x03, 0x00, 0x10, 0x19, 0x6e, 0xc3, 0xff, 0xff, 0xff, 0xc1, 0x6c, 0x17, 0x00, 0x03, 0x1a, 0x68, 0xbd, 0xf8,
+	0xff, 0xee, 0xba, 0x74, 0x33, 0x12, 0x03, 0x00, 0x07, 0x33, 0x88, 0xdd, 0xff, 0xff, 0xf7, 0xa2, 0x4d, 0x00, 0x0a, 0x09, 0x1f, 0x42, 0x69, 0x90,
+	0xb8, 0xdd, 0xf5, 0xff, 0xff, 0xf8, 0xd9, 0xa2, 0x54, 0x1d, 0x00, 0x08, 0x06, 0x1f, 0x4b, 0x82, 0xb6, 0xdb, 0xf2, 0xfb, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xf8, 0xe6, 0xc9, 0x7a, 0x37, 0x00, 0x04, 0x08, 0x3e, 0x91, 0xde, 0xf8, 0xd1, 0x82, 0x32, 0x06, 0x00, 0x03, 0x01, 0x15, 0x3d,
+	0x78, 0xb3, 0xe0, 0xf8, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf4, 0xba, 0x66, 0x1b, 0x00, 0x04, 0x1a, 0x5d, 0xb2, 0xed, 0xf0, 0xb6,
+	0x61, 0x1b, 0x00, 0x06, 0x08, 0x3e, 0x91, 0xde, 0xf8, 0xd1, 0x82, 0x32, 0x06, 0x00, 0x03, 0x19, 0x6e, 0xc3, 0xff, 0xff, 0xcf, 0x7a, 0x25, 0x00,
+	0x04, 0x05, 0x33, 0x86, 0xd6, 0xfc, 0xff, 0xe3, 0x9a, 0x45, 0x0b, 0x00, 0x01, 0x1a, 0x5d, 0xb2, 0xed, 0xf0, 0xb6, 0x61, 0x1b, 0x00, 0x11, 0x1d,
+	0x69, 0xbe, 0xf6, 0xfc, 0xd3, 0x82, 0x2f, 0x03, 0x00, 0x04, 0x02, 0x53, 0xa8, 0xfb, 0xff, 0xde, 0x89, 0x34, 0x00, 0x05, 0x03, 0x50, 0xa5, 0xf7,
+	0xff, 0xe3, 0x8e, 0x39, 0x00, 0x03, 0x0d, 0x4f, 0xa4, 0xec, 0xff, 0xff, 0xfe, 0xd5, 0x82, 0x2e, 0x02, 0x00, 0x1b, 0x53, 0xa8, 0xfc, 0xff, 0xff,
+	0xdc, 0x87, 0x32, 0x00, 0x0e, 0x25, 0x7a, 0xcf, 0xff, 0xff, 0xff, 0xb2, 0x5d, 0x08, 0x00, 0x09, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40,
+	0x00, 0x0a, 0x49, 0x9e, 0xf3, 0xff, 0xff, 0xfc, 0xab, 0x56, 0x04, 0x00, 0x0a, 0x1c, 0x67, 0xb2, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe3, 0xee,
+	0xf8, 0xff, 0xff, 0xff, 0xbe, 0x69, 0x14, 0x00, 0x1a, 0x2c, 0x81, 0xd6, 0xff, 0xff, 0xff, 0xbe, 0x69, 0x14, 0x00, 0x0c, 0x0c, 0x35, 0x7d, 0xc6,
+	0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xc9, 0x7c, 0x32, 0x08, 0x00, 0x09, 0x0d, 0x4f, 0xa4, 0xec, 0xff, 0xff, 0xfb, 0xc2, 0x6d, 0x1c, 0x00,
+	0x12, 0x24, 0x77, 0xcc, 0xfd, 0xff, 0xfe, 0xdd, 0x8c, 0x38, 0x04, 0x00, 0x04, 0x37, 0x8c, 0xe1, 0xff, 0xff, 0xff, 0xe8, 0x95, 0x40, 0x02, 0x00,
+	0x0e, 0x0c, 0x51, 0xa6, 0xef, 0xff, 0xff, 0xee, 0x99, 0x44, 0x00, 0x02, 0x02, 0x32, 0x87, 0xda, 0xfe, 0xff, 0xec, 0x97, 0x42, 0x00, 0x0a, 0x05,
+	0x54, 0xa9, 0xf9, 0xff, 0xff, 0xf7, 0xa2, 0x4d, 0x00, 0x10, 0x09, 0x29, 0x71, 0xbd, 0xf2, 0xff, 0xff, 0xd6, 0x81, 0x2c, 0x00, 0x0c, 0x01, 0x2c,
+	0x81, 0xd5, 0xff, 0xd2, 0x8a, 0x3f, 0x1d, 0x14, 0x0a, 0x03, 0x00, 0x09, 0x08, 0x32, 0x7f, 0xcc, 0xf2, 0xde, 0xae, 0x70, 0x39, 0x14, 0x02, 0x00,
+	0x05, 0x06, 0x10, 0x1f, 0x2f, 0x39, 0x3d, 0x38, 0x2c, 0x19, 0x0a, 0x01, 0x00, 0x02, 0x09, 0x26, 0x56, 0x93, 0xcb, 0xf0, 0xe4, 0xa5, 0x51, 0x16,
+	0x00, 0x0a, 0x08, 0x32, 0x7f, 0xcc, 0xf2, 0xde, 0xae, 0x70, 0x39, 0x14, 0x05, 0x0e, 0x19, 0x21, 0x21, 0x1b, 0x10, 0x05, 0x00, 0x06, 0x06, 0x11,
+	0x1c, 0x21, 0x21, 0x29, 0x3b, 0x60, 0x93, 0xcb, 0xf0, 0xe4, 0xa5, 0x51, 0x16, 0x00, 0x11, 0x0d, 0x4c, 0xa1, 0xe9, 0xff, 0xe7, 0x9e, 0x49, 0x0c,
+	0x00, 0x07, 0x31, 0x86, 0xdb, 0xff, 0xfc, 0xad, 0x58, 0x06, 0x00, 0x04, 0x24, 0x79, 0xce, 0xff, 0xfe, 0xc3, 0x6e, 0x1a, 0x00, 0x04, 0x01, 0x2a,
+	0x7d, 0xd1, 0xfd, 0xff, 0xff, 0xf8, 0xdc, 0xa9, 0x68, 0x2f, 0x0c, 0x00, 0x18, 0x44, 0x99, 0xee, 0xff, 0xff, 0xe5, 0x90, 0x3b, 0x00, 0x0e, 0x2e,
+	0x83, 0xd8, 0xff, 0xff, 0xfa, 0xa6, 0x51, 0x01, 0x00, 0x09, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x0a, 0x26, 0x7b, 0xd0, 0xff,
+	0xff, 0xff, 0xc8, 0x73, 0x1e, 0x00, 0x13, 0x1e, 0x73, 0xc8, 0xff, 0xff, 0xff, 0xbe, 0x69, 0x14, 0x00, 0x1a, 0x05, 0x54, 0xa9, 0xf8, 0xff, 0xff,
+	0xf6, 0xc3, 0x71, 0x25, 0x03, 0x00, 0x09, 0x01, 0x12, 0x36, 0x70, 0xb3, 0xe4, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xee, 0xbf, 0x72, 0x2e, 0x08, 0x00,
+	0x0a, 0x01, 0x2a, 0x7d, 0xd1, 0xfd, 0xff, 0xff, 0xf2, 0xcc, 0x8f, 0x49, 0x1a, 0x02, 0x00, 0x0a, 0x04, 0x1e, 0x51, 0x98, 0xd2, 0xf5, 0xff, 0xff,
+	0xf4, 0xb6, 0x61, 0x16, 0x00, 0x06, 0x04, 0x30, 0x82, 0xd3, 0xfc, 0xff, 0xff, 0xe6, 0xad, 0x69, 0x33, 0x17, 0x06, 0x00, 0x08, 0x02, 0x16, 0x42,
+	0x92, 0xd3, 0xfc, 0xff, 0xfd, 0xd8, 0x89, 0x36, 0x06, 0x00, 0x02, 0x01, 0x4a, 0x9f, 0xf2, 0xff, 0xff, 0xf9, 0xb7, 0x62, 0x13, 0x00, 0x08, 0x1b,
+	0x64, 0xb8, 0xf2, 0xff, 0xff, 0xff, 0xf7, 0xa2, 0x4d, 0x00, 0x01, 0x03, 0x06, 0x06, 0x02, 0x00, 0x0c, 0x01, 0x32, 0x87, 0xdb, 0xff, 0xff, 0xe8,
+	0x93, 0x3e, 0x00, 0x0b, 0x06, 0x3f, 0x90, 0xdf, 0xfb, 0xf3, 0xd9, 0xb2, 0x83, 0x48, 0x1a, 0x01, 0x00, 0x0c, 0x01, 0x13, 0x3a, 0x77, 0xb6, 0xe4,
+	0xf8, 0xe8, 0xc1, 0x8e, 0x67, 0x4d, 0x3c, 0x2b, 0x1a, 0x0b, 0x03, 0x00, 0x01, 0x01, 0x07, 0x12, 0x23, 0x34, 0x45, 0x59, 0x7a, 0xa9, 0xd9, 0xf5,
+	0xf1, 0xcd, 0x95, 0x54, 0x22, 0x06, 0x00, 0x0e, 0x01, 0x13, 0x3a, 0x77, 0xb6, 0xe4, 0xf8, 0xe8, 0xc1, 0x8e, 0x67, 0x4d, 0x3c, 0x2b, 0x1a, 0x0b,
+	0x03, 0x00, 0x01, 0x01, 0x07, 0x12, 0x23, 0x34, 0x45, 0x59, 0x7a, 0xa9, 0xd9, 0xf5, 0xf1, 0xcd, 0x95, 0x54, 0x22, 0x06, 0x00, 0x11, 0x04, 0x32,
+	0x85, 0xd6, 0xfd, 0xf4, 0xbb, 0x66, 0x1b, 0x00, 0x0a, 0x2e, 0x83, 0xd7, 0xff, 0xf6, 0xd8, 0xa7, 0x6c, 0x4c, 0x55, 0x85, 0xbf, 0xe8, 0xfc, 0xfc,
+	0xc2, 0x6d, 0x1b, 0x00, 0x07, 0x0a, 0x2b, 0x62, 0xa5, 0xd8, 0xf6, 0xff, 0xff, 0xff, 0xf6, 0xe4, 0xcc, 0xb8, 0xa8, 0x97, 0x87, 0x7b, 0x78, 0x7d,
+	0x85, 0x8e, 0x99, 0xa8, 0xbc, 0xd2, 0xd8, 0x92, 0x45, 0x00, 0x07, 0x2e, 0x83, 0xd8, 0xff, 0xff, 0xf4, 0x9f, 0x4a, 0x00, 0x0e, 0x3e, 0x93, 0xe8,
+	0xff, 0xff, 0xe6, 0x91, 0x3c, 0x00, 0x0a, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x0a, 0x06, 0x56, 0xab, 0xfa, 0xff, 0xff, 0xf7,
+	0xbb, 0x66, 0x18, 0x00, 0x12, 0x1e, 0x73, 0xc8, 0xff, 0xff, 0xff, 0xbe, 0x69, 0x14, 0x00, 0x1b, 0x06, 0x31, 0x80, 0xcf, 0xf9, 0xff, 0xff, 0xfd,
+	0xed, 0xcd, 0xa8, 0x8d, 0x7e, 0x75, 0x73, 0x79, 0x85, 0x98, 0xb2, 0xd3, 0xed, 0xfc, 0xff, 0xff, 0xf1, 0xcc, 0x95, 0x7f, 0x9d, 0xd4, 0xf7, 0xff,
+	0xfe, 0xe8, 0xb4, 0x65, 0x26, 0x05, 0x00, 0x09, 0x0a, 0x2b, 0x63, 0xa5, 0xd9, 0xf7, 0xff, 0xff, 0xfb, 0xeb, 0xd5, 0xbd, 0xab, 0x9a, 0x89, 0x7e,
+	0x7f, 0x8b, 0x9c, 0xad, 0xbf, 0xd8, 0xed, 0xfc, 0xff, 0xfe, 0xee, 0xc8, 0x8d, 0x4c, 0x1c, 0x03, 0x00, 0x09, 0x0a, 0x3f, 0x8c, 0xd7, 0xf7, 0xff,
+	0xff, 0xff, 0xff, 0xfb, 0xec, 0xd4, 0xb5, 0x96, 0x83, 0x80, 0x8b, 0x9a, 0xac, 0xcb, 0xe7, 0xfc, 0xff, 0xff, 0xf6, 0xd7, 0x8f, 0x43, 0x0d, 0x00,
+	0x05, 0x15, 0x5d, 0xb2, 0xf2, 0xff, 0xff, 0xfb, 0xdd, 0xb6, 0x8a, 0x6e, 0x5a, 0x55, 0x5e, 0x70, 0x8e, 0xb9, 0xe2, 0xef, 0xcf, 0xcd, 0xd6, 0xfc,
+	0xff, 0xf7, 0xa2, 0x4d, 0x00, 0x01, 0x1d, 0x71, 0xbc, 0xdf, 0xc1, 0xa5, 0x8d, 0x79, 0x6a, 0x5f, 0x58, 0x57, 0x5b, 0x64, 0x72, 0x89, 0xb1, 0xd9,
+	0xf5, 0xff, 0xfa, 0xd9, 0x8c, 0x3c, 0x08, 0x00, 0x0e, 0x07, 0x1c, 0x57, 0xa5, 0xe4, 0xff, 0xec, 0x97, 0x42, 0x00, 0x10, 0x02, 0x13, 0x31, 0x58,
+	0x7d, 0xa1, 0xc4, 0xe2, 0xf5, 0xfd, 0xff, 0xfc, 0xf4, 0xef, 0xf1, 0xf9, 0xfe, 0xfe, 0xfa, 0xec, 0xd2, 0xb1, 0x8d, 0x69, 0x42, 0x1f, 0x08, 0x00,
+	0x16, 0x02, 0x13, 0x31, 0x58, 0x7d, 0xa1, 0xc4, 0xe2, 0xf5, 0xfd, 0xff, 0xfc, 0xf4, 0xef, 0xf1, 0xf9, 0xfe, 0xfe, 0xfa, 0xec, 0xd2, 0xb1, 0x8d,
+	0x69, 0x42, 0x1f, 0x08, 0x00, 0x14, 0x1d, 0x69, 0xbe, 0xf6, 0xfc, 0xd4, 0x82, 0x2f, 0x03, 0x00, 0x0c, 0x0b, 0x31, 0x73, 0xb8, 0xe6, 0xf9, 0xfe,
+	0xff, 0xff, 0xfe, 0xf7, 0xdd, 0xa8, 0x60, 0x25, 0x06, 0x00, 0x0c, 0x0e, 0x31, 0x68, 0x98, 0xb7, 0xc9, 0xd9, 0xe9, 0xf5, 0xfd, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xef, 0xdb, 0xb8, 0x6e, 0x2e, 0x00, 0x07, 0x16, 0x6b, 0xc0, 0xff, 0xff, 0xfe, 0xbb, 0x66, 0x12, 0x00, 0x0c,
+	0x0b, 0x5b, 0xb0, 0xfa, 0xff, 0xff, 0xd0, 0x7b, 0x26, 0x00, 0x0a, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x0b, 0x09, 0x42, 0x97,
+	0xe3, 0xff, 0xff, 0xfe, 0xdb, 0x8a, 0x35, 0x04, 0x00, 0x10, 0x1e, 0x73, 0xc8, 0xff, 0xff, 0xff, 0xbe, 0x69, 0x14, 0x00, 0x1d, 0x04, 0x1b, 0x42,
+	0x75, 0xa4, 0xce, 0xec, 0xfb, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf7, 0xe6, 0xcc, 0xa9, 0x7f, 0x4d, 0x23, 0x09, 0x00, 0x02, 0x01,
+	0x18, 0x4c, 0x9a, 0xd8, 0xf9, 0xff, 0xfc, 0xe1, 0xa8, 0x58, 0x1e, 0x02, 0x00, 0x0a, 0x0e, 0x32, 0x69, 0x98, 0xb8, 0xc9, 0xda, 0xea, 0xf6, 0xfd,
+	0xff, 0xff, 0xff, 0xff, 0xfc, 0xf4, 0xe6, 0xd5, 0xc4, 0xae, 0x88, 0x53, 0x22, 0x06, 0x00, 0x10, 0x0b, 0x29, 0x5a, 0x92, 0xbd, 0xdb, 0xec, 0xf7,
+	0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf4, 0xe7, 0xd6, 0xba, 0x8f, 0x58, 0x27, 0x0a, 0x00, 0x09, 0x01, 0x1e, 0x51, 0x93, 0xc8, 0xea, 0xfc,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf5, 0xe1, 0xb9, 0x83, 0x44, 0x17, 0x24, 0x78, 0xcd, 0xff, 0xf7, 0xa2, 0x4d, 0x00, 0x01, 0x0d, 0x3c, 0x75,
+	0xaa, 0xc8, 0xe1, 0xf2, 0xfa, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf8, 0xef, 0xde, 0xc3, 0x9f, 0x79, 0x47, 0x1e, 0x03, 0x00, 0x0b, 0x04, 0x14,
+	0x23, 0x2e, 0x33, 0x3f, 0x53, 0x8a, 0xc5, 0xf5, 0xf7, 0xba, 0x65, 0x18, 0x00, 0x18, 0x01, 0x07, 0x10, 0x1b, 0x25, 0x2b, 0x29, 0x20, 0x15, 0x0a,
+	0x03, 0x00, 0x26, 0x01, 0x07, 0x10, 0x1b, 0x25, 0x2b, 0x29, 0x20, 0x15, 0x0a, 0x03, 0x00, 0x35, 0x02, 0x0a, 0x19, 0x23, 0x21, 0x13, 0x06, 0x00,
+	0x19, 0x03, 0x0c, 0x1b, 0x28, 0x2f, 0x2f, 0x2c, 0x27, 0x1e, 0x13, 0x08, 0x02, 0x00, 0x0c, 0x26, 0x7b, 0xd0, 0xfe, 0xff, 0xf5, 0xa6, 0x51, 0x06,
+	0x00, 0x0a, 0x03, 0x49, 0x9e, 0xef, 0xff, 0xff, 0xe1, 0x8d, 0x38, 0x01, 0x00, 0x0a, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x0d,
+	0x19, 0x64, 0xb9, 0xf5, 0xff, 0xff, 0xfc, 0xe7, 0xbc, 0x7d, 0x3f, 0x15, 0x01, 0x00, 0x0c, 0x1e, 0x73, 0xc8, 0xff, 0xff, 0xff, 0xbe, 0x69, 0x14,
+	0x00, 0x24, 0x04, 0x0c, 0x18, 0x23, 0x2b, 0x2b, 0x26, 0x1e, 0x13, 0x09, 0x02, 0x00, 0x27, 0x04, 0x0d, 0x1c, 0x26, 0x25, 0x19, 0x0b, 0x03, 0x00,
+	0x1f, 0x03, 0x0b, 0x18, 0x24, 0x28, 0x22, 0x14, 0x09, 0x02, 0x00, 0x15, 0x05, 0x0e, 0x1a, 0x26, 0x2b, 0x2a, 0x23, 0x17, 0x0b, 0x02, 0x00, 0x13,
+	0x01, 0x05, 0x0b, 0x12, 0x13, 0x0e, 0x06, 0x01, 0x00, 0x13, 0x10, 0x5c, 0xac, 0xeb, 0xe7, 0xd8, 0xc4, 0xaf, 0x9a, 0x85, 0x59, 0x2c, 0x07, 0x00,
+	0xc3, 0x1f, 0x73, 0xc8, 0xfd, 0xff, 0xf2, 0xbf, 0x6e, 0x25, 0x03, 0x00, 0x06, 0x03, 0x23, 0x68, 0xba, 0xef, 0xff, 0xff, 0xde, 0x8a, 0x35, 0x01,
+	0x00, 0x0b, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x0e, 0x03, 0x1f, 0x4f, 0x90, 0xc9, 0xee, 0xfe, 0xff, 0xff, 0xfb, 0xed, 0xd9,
+	0xc5, 0xb5, 0xa5, 0x95, 0x85, 0x79, 0x73, 0x74, 0x79, 0x81, 0x8b, 0x98, 0xaf, 0xd1, 0xef, 0xff, 0xff, 0xff, 0xbe, 0x69, 0x14, 0x00, 0xea, 0x04,
+	0x15, 0x34, 0x59, 0x7a, 0x96, 0xaf, 0xc3, 0xd2, 0xdb, 0xe2, 0xe6, 0xe2, 0xd9, 0xcc, 0xc0, 0xb2, 0x9b, 0x78, 0x4b, 0x22, 0x09, 0x00, 0x10, 0x01,
+	0x0f, 0x2d, 0x59, 0x7f, 0x9a, 0xaa, 0xb7, 0xc4, 0xd0, 0xdd, 0xe6, 0xe9, 0xe5, 0xdd, 0xcb, 0x81, 0x3b, 0x00, 0x0a, 0x02, 0x15, 0x3c, 0x6e, 0x94,
+	0xac, 0xbc, 0xcb, 0xda, 0xe0, 0xdb, 0xcc, 0xba, 0xa9, 0x93, 0x6e, 0x3d, 0x14, 0x01, 0x00, 0x0b, 0x20, 0x5d, 0x9a, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7,
+	0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0x92, 0x55, 0x18, 0x00, 0x09, 0x06, 0x1b, 0x3f, 0x6a, 0x93, 0xb2,
+	0xc6, 0xd3, 0xdf, 0xe7, 0xe8, 0xe1, 0xd5, 0xc9, 0xb6, 0x99, 0x72, 0x47, 0x21, 0x09, 0x00, 0x0f, 0x03, 0x15, 0x37, 0x64, 0x88, 0xa0, 0xad, 0xb7,
+	0xbd, 0xbc, 0xb5, 0xa9, 0x99, 0x73, 0x3f, 0x13, 0x00, 0x06, 0x11, 0x41, 0x8e, 0xd2, 0xf6, 0xff, 0xf9, 0xde, 0xbc, 0x98, 0x80, 0x6f, 0x6f, 0x7f,
+	0x97, 0xbb, 0xde, 0xf8, 0xff, 0xfc, 0xe0, 0xa7, 0x56, 0x1d, 0x00, 0x0d, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x12, 0x05, 0x1f,
+	0x4d, 0x84, 0xab, 0xc4, 0xd4, 0xe4, 0xf2, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf8, 0xed, 0xdc, 0xc9, 0xb4, 0x9c,
+	0x69, 0x35, 0x09, 0x00, 0x06, 0x0c, 0x27, 0x50, 0x7c, 0x9e, 0xb6, 0xc4, 0xd0, 0xdc, 0xe4, 0xe5, 0xdf, 0xd6, 0xcc, 0xc3, 0xb9, 0xa9, 0x92, 0x76,
+	0x59, 0x37, 0x1a, 0x05, 0x00, 0x02, 0x2a, 0x62, 0x9a, 0xa9, 0xa9, 0x9b, 0x62, 0x2a, 0x00, 0x1d, 0x03, 0x0d, 0x16, 0x16, 0x0c, 0x03, 0x00, 0x08,
+	0x0e, 0x1d, 0x2b, 0x21, 0x12, 0x03, 0x00, 0x03, 0x2a, 0x62, 0x9a, 0xa9, 0xa9, 0x97, 0x5f, 0x27, 0x00, 0x16, 0x08, 0x1c, 0x3b, 0x5e, 0x7f, 0x9a,
+	0xae, 0xbc, 0xc9, 0xd6, 0xe1, 0xe2, 0xdb, 0xce, 0xc1, 0xb0, 0x93, 0x6b, 0x3b, 0x17, 0x04, 0x00, 0x11, 0x4e, 0x9d, 0xec, 0xed, 0xa9, 0x5a, 0x0b,
+	0x00, 0x13, 0x06, 0x18, 0x2c, 0x37, 0x2b, 0x16, 0x05, 0x00, 0x0c, 0x03, 0x03, 0x03, 0x00, 0x08, 0x03, 0x05, 0x05, 0x02, 0x00, 0x03, 0x2a, 0x62,
+	0x9a, 0xa9, 0xa9, 0x9b, 0x62, 0x2a, 0x00, 0x01, 0x03, 0x31, 0x78, 0xca, 0xf1, 0xfe, 0xff, 0xff, 0xfa, 0xef, 0xe0, 0xd1, 0xc2, 0xb3, 0xaa, 0xaa,
+	0xb3, 0xc6, 0xe0, 0xf5, 0xff, 0xff, 0xff, 0xf7, 0xcd, 0x7f, 0x32, 0x07, 0x00, 0x0a, 0x10, 0x40, 0x84, 0xc6, 0xea, 0xfc, 0xff, 0xff, 0xf6, 0xe4,
+	0xce, 0xbc, 0xb0, 0xa4, 0x9c, 0x9a, 0x9e, 0xa8, 0xb0, 0x79, 0x3c, 0x00, 0x07, 0x01, 0x23, 0x64, 0xb5, 0xe7, 0xfc, 0xff, 0xfd, 0xef, 0xda, 0xc1,
+	0xb1, 0xac, 0xb3, 0xc6, 0xdc, 0xef, 0xfb, 0xff, 0xfa, 0xe1, 0xb1, 0x65, 0x29, 0x04, 0x00, 0x08, 0x3e, 0x93, 0xe8, 0xff, 0xff, 0xfc, 0xf8, 0xf4,
+	0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xc1, 0x70, 0x1f, 0x00, 0x06, 0x01, 0x1a, 0x56, 0xa9, 0xe4, 0xfe,
+	0xff, 0xff, 0xfa, 0xed, 0xd6, 0xbc, 0xaa, 0xa9, 0xbb, 0xd5, 0xeb, 0xf9, 0xff, 0xff, 0xff, 0xec, 0xb6, 0x64, 0x22, 0x02, 0x00, 0x0a, 0x03, 0x2e,
+	0x7f, 0xd1, 0xfb, 0xff, 0xff, 0xf8, 0xe7, 0xd2, 0xc5, 0xc4, 0xcc, 0xdc, 0xd9, 0x94, 0x44, 0x04, 0x00, 0x09, 0x16, 0x47, 0x86, 0xb8, 0xd4, 0xe8,
+	0xf6, 0xfe, 0xff, 0xff, 0xfe, 0xf8, 0xeb, 0xd8, 0xc1, 0x97, 0x5a, 0x22, 0x04, 0x00, 0x0f, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00,
+	0x1a, 0x01, 0x08, 0x14, 0x23, 0x2c, 0x2f, 0x2d, 0x2a, 0x25, 0x1e, 0x14, 0x0b, 0x04, 0x00, 0x0b, 0x0b, 0x3b, 0x8a, 0xd3, 0xf9, 0xff, 0xff, 0xff,
+	0xff, 0xfb, 0xef, 0xdb, 0xc9, 0xc3, 0xca, 0xd5, 0xe0, 0xec, 0xf7, 0xfd, 0xff, 0xff, 0xe2, 0x91, 0x3c, 0x04, 0x00, 0x02, 0x3f, 0x94, 0xe9, 0xff,
+	0xff, 0xea, 0x95, 0x40, 0x00, 0x1a, 0x20, 0x5b, 0xab, 0xe0, 0xfa, 0xff, 0xff, 0xfa, 0xe9, 0xcb, 0xa1, 0x75, 0x4c, 0x2a, 0x1a, 0x20, 0x55, 0xa2,
+	0xe4, 0xf2, 0xa0, 0x4b, 0x02, 0x00, 0x03, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xe4, 0x8f, 0x3a, 0x00, 0x15, 0x1d, 0x6f, 0xc4, 0xfc, 0xff, 0xff, 0xfa,
+	0xf0, 0xe1, 0xd3, 0xc5, 0xba, 0xb8, 0xc0, 0xd2, 0xe7, 0xf8, 0xff, 0xff, 0xfe, 0xe5, 0xa3, 0x4f, 0x12, 0x00, 0x0d, 0x03, 0x0f, 0x63, 0xb5, 0xfe,
+	0xff, 0xc8, 0x86, 0x3f, 0x2a, 0x1d, 0x0f, 0x05, 0x00, 0x0d, 0x08, 0x4a, 0x9f, 0xec, 0xff, 0xff, 0xfe, 0xe9, 0x99, 0x44, 0x04, 0x00, 0x07, 0x0d,
+	0x53, 0xa5, 0xec, 0xf6, 0xdd, 0x8c, 0x3d, 0x04, 0x00, 0x02, 0x02, 0x3a, 0x89, 0xdc, 0xf9, 0xf1, 0xb3, 0x5e, 0x16, 0x00, 0x01, 0x3f, 0x94, 0xe9,
+	0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x02, 0x03, 0x26, 0x67, 0x9a, 0x9d, 0x73, 0x43, 0x1d, 0x06, 0x00, 0x08, 0x06, 0x21, 0x62, 0xb1, 0xeb, 0xff,
+	0xff, 0xfc, 0xc0, 0x6b, 0x19, 0x00, 0x06, 0x01, 0x21, 0x64, 0xb7, 0xec, 0xff, 0xff, 0xec, 0xbd, 0x7c, 0x3f, 0x1a, 0x06, 0x00, 0x11, 0x15, 0x5b,
+	0xb0, 0xef, 0xff, 0xff, 0xe1, 0xa4, 0x53, 0x1c, 0x04, 0x00, 0x05, 0x01, 0x16, 0x46, 0x93, 0xd2, 0xf7, 0xff, 0xf4, 0xb5, 0x60, 0x16, 0x00, 0x06,
+	0x01, 0x53, 0xa8, 0xfb, 0xff, 0xff, 0xb8, 0x63, 0x0e, 0x00, 0x16, 0x37, 0x8c, 0xe1, 0xff, 0xff, 0xfe, 0xcf, 0x7e, 0x2a, 0x04, 0x00, 0x06, 0x03,
+	0x21, 0x73, 0xc4, 0xfb, 0xff, 0xff, 0xed, 0x99, 0x44, 0x01, 0x00, 0x09, 0x3d, 0x92, 0xe7, 0xff, 0xff, 0xf1, 0xac, 0x57, 0x10, 0x00, 0x18, 0x07,
+	0x15, 0x22, 0x22, 0x15, 0x08, 0x01, 0x00, 0x15, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x31, 0x26, 0x7a, 0xcf, 0xfe, 0xff, 0xff,
+	0xec, 0xaf, 0x67, 0x2a, 0x13, 0x05, 0x00, 0x06, 0x01, 0x0a, 0x1d, 0x38, 0x4b, 0x38, 0x1c, 0x00, 0x04, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95,
+	0x40, 0x00, 0x18, 0x01, 0x40, 0x95, 0xe9, 0xf2, 0xcb, 0x99, 0x72, 0x6d, 0x80, 0xa2, 0xcb, 0xeb, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xdc,
+	0x8f, 0x3d, 0x07, 0x00, 0x04, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xe4, 0x8f, 0x3a, 0x00, 0x16, 0x0f, 0x38, 0x55, 0x57, 0x34, 0x17, 0x05, 0x00, 0x07,
+	0x0a, 0x2d, 0x79, 0xc3, 0xf5, 0xff, 0xff, 0xd8, 0x83, 0x2e, 0x00, 0x07, 0x0d, 0x33, 0x6e, 0xa7, 0xcf, 0xe9, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xfa, 0xec, 0xb5, 0x65, 0x1e, 0x00, 0x0a, 0x10, 0x63, 0xb8, 0xfd, 0xff, 0xff, 0xff, 0xfb, 0xb2, 0x5d, 0x0b, 0x00, 0x07,
+	0x09, 0x47, 0x93, 0xdb, 0xe6, 0xcd, 0x7d, 0x34, 0x02, 0x00, 0x02, 0x01, 0x31, 0x79, 0xc9, 0xe5, 0xdb, 0x94, 0x49, 0x0a, 0x00, 0x01, 0x3f, 0x94,
+	0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x15, 0x01, 0x47, 0x9c, 0xf0, 0xff, 0xff, 0xf2, 0x9d, 0x48, 0x00, 0x05, 0x06, 0x45, 0x9a, 0xe8, 0xff,
+	0xff, 0xe5, 0x9e, 0x49, 0x0d, 0x00, 0x14, 0x0a, 0x5e, 0xb3, 0xfd, 0xff, 0xfe, 0xc2, 0x6d, 0x18, 0x00, 0x0b, 0x06, 0x41, 0x96, 0xe4, 0xff, 0xfe,
+	0xdb, 0x87, 0x32, 0x00, 0x05, 0x12, 0x67, 0xbc, 0xff, 0xff, 0xf5, 0xa1, 0x4c, 0x00, 0x16, 0x11, 0x66, 0xbb, 0xff, 0xff, 0xff, 0xc5, 0x70, 0x1b,
+	0x00, 0x0a, 0x10, 0x63, 0xb8, 0xfd, 0xff, 0xff, 0xc8, 0x73, 0x1e, 0x00, 0x08, 0x09, 0x5e, 0xb3, 0xfe, 0xff, 0xff, 0xc9, 0x74, 0x1f, 0x00, 0x47,
+	0x28, 0x6b, 0xae, 0xca, 0xcb, 0xcb, 0xc6, 0x93, 0x4f, 0x10, 0x00, 0x09, 0x03, 0x32, 0x76, 0xb6, 0xcb, 0xcb, 0xcb, 0xbe, 0x87, 0x43, 0x0c, 0x00,
+	0x08, 0x09, 0x5b, 0xb0, 0xfc, 0xff, 0xff, 0xdb, 0x88, 0x33, 0x02, 0x00, 0x14, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x18, 0x0b,
+	0x36, 0x61, 0x7e, 0x58, 0x2d, 0x04, 0x00, 0x04, 0x01, 0x0d, 0x27, 0x46, 0x61, 0x6d, 0x6b, 0x5a, 0x37, 0x18, 0x02, 0x00, 0x06, 0x3f, 0x94, 0xe9,
+	0xff, 0xff, 0xe4, 0x8f, 0x3a, 0x00, 0x26, 0x0c, 0x60, 0xb5, 0xfe, 0xff, 0xfd, 0xb4, 0x5f, 0x0c, 0x00, 0x04, 0x25, 0x6e, 0xc3, 0xf2, 0xff, 0xff,
+	0xff, 0xff, 0xf8, 0xe4, 0xc4, 0x9e, 0x7b, 0x65, 0x5f, 0x6a, 0x7a, 0x90, 0xa9, 0xa9, 0x72, 0x30, 0x00, 0x0c, 0x0a, 0x2a, 0x54, 0x78, 0x81, 0x76,
+	0x51, 0x27, 0x08, 0x00, 0x1d, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x15, 0x06, 0x55, 0xaa, 0xf9, 0xff, 0xff, 0xde, 0x89, 0x34,
+	0x00, 0x04, 0x0a, 0x54, 0xa9, 0xf3, 0xff, 0xff, 0xd3, 0x7f, 0x2a, 0x00, 0x16, 0x2f, 0x84, 0xd9, 0xff, 0xff, 0xe9, 0x94, 0x3f, 0x00, 0x0e, 0x46,
+	0x9b, 0xf0, 0xff, 0xff, 0xbe, 0x69, 0x14, 0x00, 0x04, 0x27, 0x7c, 0xd1, 0xff, 0xff, 0xde, 0x89, 0x34, 0x00, 0x16, 0x02, 0x4d, 0xa2, 0xf5, 0xff,
+	0xff, 0xd7, 0x84, 0x2f, 0x01, 0x00, 0x09, 0x25, 0x7a, 0xce, 0xff, 0xff, 0xfa, 0xad, 0x58, 0x08, 0x00, 0x08, 0x1b, 0x70, 0xc5, 0xff, 0xff, 0xff,
+	0xc3, 0x73, 0x23, 0x0e, 0x0e, 0x0e, 0x0e, 0x0c, 0x07, 0x03, 0x00, 0x06, 0x3c, 0x79, 0xb6, 0xb7, 0xb7, 0xb7, 0xa0, 0x63, 0x26, 0x00, 0x04, 0x09,
+	0x1b, 0x2f, 0x36, 0x27, 0x13, 0x03, 0x00, 0x05, 0x01, 0x0c, 0x1a, 0x1f, 0x14, 0x06, 0x00, 0x1c, 0x0c, 0x3a, 0x88, 0xd1, 0xf8, 0xff, 0xfd, 0xd8,
+	0x89, 0x35, 0x05, 0x00, 0x06, 0x1a, 0x64, 0xb9, 0xf4, 0xff, 0xfe, 0xe4, 0xa9, 0x56, 0x1a, 0x01, 0x00, 0x09, 0x04, 0x55, 0xaa, 0xfb, 0xff, 0xff,
+	0xd3, 0x7e, 0x29, 0x00, 0x15, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x03, 0x03, 0x0f, 0x1f, 0x2f, 0x36, 0x30, 0x1f, 0x0b, 0x01,
+	0x00, 0x0a, 0x03, 0x08, 0x0c, 0x0e, 0x0c, 0x08, 0x03, 0x00, 0x04, 0x03, 0x0f, 0x1f, 0x2f, 0x36, 0x30, 0x1f, 0x0b, 0x01, 0x00, 0x0a, 0x3f, 0x94,
+	0xe9, 0xff, 0xff, 0xe4, 0x8f, 0x3a, 0x00, 0x0a, 0x03, 0x08, 0x0d, 0x0e, 0x0e, 0x0e, 0x0c, 0x07, 0x02, 0x00, 0x13, 0x10, 0x65, 0xba, 0xff, 0xff,
+	0xfd, 0xb0, 0x5b, 0x07, 0x00, 0x02, 0x05, 0x40, 0x95, 0xe5, 0xff, 0xff, 0xff, 0xd9, 0x96, 0x46, 0x17, 0x05, 0x00, 0x2f, 0x03, 0x08, 0x0c, 0x0e,
+	0x0e, 0x0c, 0x08, 0x03, 0x00, 0x07, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x13, 0x09, 0x31, 0x7e, 0xca, 0xf7, 0xff, 0xfb, 0xd1,
+	0x80, 0x2f, 0x04, 0x00, 0x04, 0x39, 0x8e, 0xe3, 0xff, 0xff, 0xe7, 0x92, 0x3d, 0x00, 0x03, 0x06, 0x11, 0x1f, 0x29, 0x2d, 0x28, 0x1b, 0x0d, 0x04,
+	0x00, 0x0b, 0x31, 0x86, 0xdb, 0xff, 0xff, 0xe8, 0x93, 0x3e, 0x00, 0x0e, 0x34, 0x89, 0xde, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x04, 0x3b, 0x90,
+	0xe5, 0xff, 0xff, 0xc6, 0x71, 0x1c, 0x00, 0x02, 0x01, 0x02, 0x02, 0x01, 0x00, 0x11, 0x06, 0x3d, 0x90, 0xdf, 0xfd, 0xff, 0xf3, 0xc7, 0x86, 0x3e,
+	0x15, 0x01, 0x00, 0x03, 0x11, 0x38, 0x7d, 0xc1, 0xef, 0xff, 0xfd, 0xde, 0x91, 0x3e, 0x08, 0x00, 0x03, 0x04, 0x2f, 0x64, 0x9e, 0xbc, 0xd9, 0xef,
+	0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x8d, 0x38, 0x00, 0x06, 0x4a, 0x9f, 0xf4, 0xff, 0xff, 0xff, 0xd5,
+	0x80, 0x2b, 0x00, 0x02, 0x11, 0x5a, 0xaf, 0xf3, 0xff, 0xff, 0xfd, 0xdd, 0x88, 0x35, 0x00, 0x02, 0x01, 0x39, 0x8d, 0xe1, 0xfe, 0xff, 0xee, 0x9f,
+	0x4a, 0x06, 0x00, 0x1c, 0x01, 0x1b, 0x53, 0xa3, 0xde, 0xfb, 0xf8, 0xc8, 0x76, 0x28, 0x03, 0x00, 0x02, 0x12, 0x52, 0xa7, 0xe9, 0xff, 0xee, 0xc0,
+	0x73, 0x2f, 0x08, 0x00, 0x0d, 0x20, 0x70, 0xc5, 0xfa, 0xff, 0xff, 0xe8, 0xaf, 0x63, 0x25, 0x09, 0x00, 0x12, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xe2,
+	0x8e, 0x4e, 0x42, 0x81, 0xb9, 0xe2, 0xf7, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xf4, 0xe1, 0xc5, 0xa7, 0x89, 0x69, 0x3c, 0x18, 0x00, 0x04, 0x3f, 0x94,
+	0xe9, 0xff, 0xfa, 0xab, 0x56, 0x1c, 0x42, 0x81, 0xb9, 0xe2, 0xf7, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xf4, 0xe1, 0xc5, 0xa7, 0x89, 0x69, 0x3c, 0x18,
+	0x00, 0x04, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xe4, 0x8f, 0x3a, 0x00, 0x07, 0x01, 0x1e, 0x5d, 0xb0, 0xe9, 0xfe, 0xff, 0xed, 0xb9, 0x68, 0x25, 0x04,
+	0x00, 0x11, 0x02, 0x22, 0x71, 0xc3, 0xf8, 0xff, 0xfb, 0xc4, 0x6f, 0x1d, 0x00, 0x03, 0x38, 0x8d, 0xe2, 0xff, 0xff, 0xff, 0xea, 0x96, 0x41, 0x00,
+	0x1c, 0x1a, 0x5e, 0xa3, 0xcd, 0xc3, 0x7e, 0x3a, 0x00, 0x0f, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x07, 0x3f, 0x94, 0xe9, 0xff,
+	0xff, 0xea, 0x95, 0x40, 0x00, 0x08, 0x18, 0x37, 0x56, 0x5d, 0x5e, 0x63, 0x6c, 0x78, 0x85, 0x9b, 0xbd, 0xe1, 0xf7, 0xf9, 0xe9, 0xc4, 0x90, 0x51,
+	0x21, 0x05, 0x00, 0x05, 0x10, 0x65, 0xba, 0xfe, 0xff, 0xff, 0xc2, 0x72, 0x3b, 0x58, 0x97, 0xca, 0xea, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
+	0xf7, 0xe4, 0xbf, 0x8c, 0x54, 0x25, 0x09, 0x00, 0x05, 0x0b, 0x5f, 0xb4, 0xfd, 0xff, 0xfe, 0xcc, 0x78, 0x24, 0x00, 0x0b, 0x05, 0x2d, 0x81, 0xd1,
+	0xfe, 0xff, 0xff, 0xfb, 0xa7, 0x52, 0x01, 0x00, 0x03, 0x4f, 0xa4, 0xf9, 0xff, 0xff, 0xf4, 0xec, 0xe7, 0xf0, 0xf8, 0xfc, 0xfe, 0xfd, 0xf6, 0xec,
+	0xdf, 0xd2, 0xc0, 0xa2, 0x7a, 0x4c, 0x23, 0x0a, 0x00, 0x0a, 0x08, 0x2d, 0x6c, 0xb6, 0xe5, 0xfb, 0xff, 0xfc, 0xed, 0xce, 0xaf, 0xac, 0xc7, 0xe8,
+	0xfb, 0xfe, 0xef, 0xcf, 0x99, 0x57, 0x22, 0x04, 0x00, 0x05, 0x03, 0x1f, 0x3a, 0x53, 0x53, 0x53, 0x62, 0x9b, 0xd5, 0xff, 0xff, 0xff, 0xd4, 0x9b,
+	0x62, 0x53, 0x53, 0x53, 0x53, 0x49, 0x2e, 0x12, 0x00, 0x06, 0x3d, 0x92, 0xe7, 0xff, 0xff, 0xff, 0xc9, 0x74, 0x1f, 0x00, 0x02, 0x1e, 0x73, 0xc8,
+	0xfe, 0xff, 0xff, 0xff, 0xf5, 0xa2, 0x4d, 0x02, 0x00, 0x02, 0x31, 0x80, 0xd4, 0xf8, 0xf9, 0xd8, 0x85, 0x36, 0x01, 0x00, 0x1f, 0x02, 0x1b, 0x45,
+	0x6e, 0x80, 0x75, 0x4a, 0x1f, 0x00, 0x01, 0x0d, 0x38, 0x63, 0x81, 0x79, 0x59, 0x2e, 0x0a, 0x00, 0x11, 0x09, 0x3a, 0x84, 0xd0, 0xf4, 0xff, 0xff,
+	0xff, 0xf4, 0xdb, 0xb5, 0x8d, 0x68, 0x42, 0x20, 0x0a, 0x00, 0x0c, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xee, 0xe1, 0xe1, 0xf0, 0xe9, 0xc1, 0x93, 0x74,
+	0x63, 0x55, 0x57, 0x69, 0x89, 0xab, 0xce, 0xea, 0xfb, 0xff, 0xff, 0xec, 0xa9, 0x54, 0x11, 0x00, 0x02, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xe9, 0xdc,
+	0xdc, 0xf0, 0xe9, 0xc1, 0x93, 0x74, 0x63, 0x55, 0x57, 0x69, 0x89, 0xab, 0xce, 0xea, 0xfb, 0xff, 0xff, 0xec, 0xa9, 0x54, 0x11, 0x00, 0x02, 0x3f,
+	0x94, 0xe9, 0xff, 0xff, 0xe4, 0x8f, 0x3a, 0x00, 0x05, 0x09, 0x35, 0x81, 0xcd, 0xf6, 0xff, 0xf9, 0xd5, 0x8f, 0x40, 0x0f, 0x00, 0x11, 0x03, 0x1d,
+	0x51, 0x9c, 0xd7, 0xf8, 0xff, 0xf7, 0xcf, 0x83, 0x35, 0x09, 0x00, 0x03, 0x03, 0x54, 0xa9, 0xfb, 0xff, 0xff, 0xfa, 0xb0, 0x5b, 0x0b, 0x00, 0x1b,
+	0x0c, 0x53, 0xa8, 0xf0, 0xff, 0xdd, 0x88, 0x33, 0x00, 0x0f, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x07, 0x3f, 0x94, 0xe9, 0xff,
+	0xff, 0xea, 0x95, 0x40, 0x00, 0x08, 0x43, 0x98, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xdf, 0xb0, 0x77, 0x47, 0x22, 0x0c, 0x01,
+	0x00, 0x07, 0x23, 0x78, 0xcd, 0xff, 0xff, 0xff, 0xdf, 0xdb, 0xdb, 0xed, 0xd1, 0xa3, 0x7d, 0x63, 0x52, 0x47, 0x47, 0x52, 0x64, 0x84, 0xb3, 0xe0,
+	0xf9, 0xff, 0xfe, 0xe1, 0x97, 0x42, 0x0a, 0x00, 0x04, 0x0e, 0x4b, 0xa0, 0xe6, 0xff, 0xff, 0xef, 0xc7, 0x8a, 0x50, 0x28, 0x11, 0x06, 0x02, 0x07,
+	0x12, 0x25, 0x46, 0x73, 0xae, 0xd9, 0xee, 0xf4, 0xf7, 0xff, 0xff, 0xf6, 0xa1, 0x4c, 0x00, 0x03, 0x01, 0x1e, 0x4d, 0x8a, 0xab, 0xb7, 0xae, 0xa2,
+	0x97, 0x8f, 0x8a, 0x8f, 0x9d, 0xb5, 0xce, 0xe6, 0xf6, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xcb, 0x7d, 0x31, 0x07, 0x00, 0x08, 0x06, 0x1c, 0x46,
+	0x8b, 0xc9, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xde, 0xab, 0x6a, 0x34, 0x12, 0x01, 0x00, 0x0c, 0x16, 0x6b, 0xc0, 0xff, 0xff,
+	0xff, 0xc0, 0x6b, 0x16, 0x00, 0x0d, 0x31, 0x86, 0xdb, 0xff, 0xff, 0xff, 0xbc, 0x67, 0x12, 0x00, 0x03, 0x0e, 0x31, 0x5c, 0x7b, 0x81, 0x72, 0x49,
+	0x20, 0x04, 0x00, 0x05, 0x04, 0x09, 0x09, 0x04, 0x00, 0x22, 0x03, 0x08, 0x0c, 0x0e, 0x0e, 0x0c, 0x08, 0x03, 0x00, 0x01, 0x03, 0x08, 0x0c, 0x0e,
+	0x0e, 0x0c, 0x08, 0x03, 0x00, 0x14, 0x0e, 0x33, 0x67, 0x9c, 0xc6, 0xe7, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xea, 0xcd, 0xa5, 0x7a, 0x47, 0x1d,
+	0x04, 0x00, 0x06, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xff, 0xfd, 0xcf, 0x7f, 0x2c, 0x05, 0x00, 0x08, 0x10, 0x62, 0xb7, 0xfb, 0xff, 0xff, 0xfa, 0xa8,
+	0x53, 0x03, 0x00, 0x01, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xff, 0xfd, 0xcf, 0x7f, 0x2c, 0x05, 0x00, 0x08, 0x10, 0x62, 0xb7, 0xfb, 0xff, 0xff, 0xfa,
+	0xa8, 0x53, 0x03, 0x00, 0x01, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xe3, 0x8e, 0x39, 0x00, 0x03, 0x18, 0x53, 0xa6, 0xe3, 0xfe, 0xfe, 0xea, 0xb4, 0x62,
+	0x22, 0x03, 0x00, 0x10, 0x02, 0x20, 0x5a, 0xa9, 0xe0, 0xfb, 0xff, 0xf4, 0xd0, 0x90, 0x47, 0x16, 0x01, 0x00, 0x05, 0x14, 0x69, 0xbe, 0xff, 0xff,
+	0xff, 0xd9, 0x84, 0x2f, 0x00, 0x19, 0x05, 0x23, 0x5f, 0xad, 0xe4, 0xfe, 0xfd, 0xdd, 0x8b, 0x37, 0x03, 0x00, 0x0f, 0x3f, 0x94, 0xe9, 0xff, 0xff,
+	0xea, 0x95, 0x40, 0x00, 0x07, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x08, 0x0a, 0x17, 0x24, 0x27, 0x28, 0x2b, 0x32, 0x3a, 0x42,
+	0x4e, 0x62, 0x7f, 0xa1, 0xcb, 0xea, 0xfc, 0xf0, 0xd7, 0xb0, 0x6a, 0x2e, 0x02, 0x00, 0x03, 0x2d, 0x82, 0xd7, 0xff, 0xff, 0xff, 0xf8, 0xcd, 0x7f,
+	0x31, 0x07, 0x00, 0x0a, 0x24, 0x75, 0xc9, 0xfa, 0xff, 0xfc, 0xc3, 0x6e, 0x1c, 0x00, 0x05, 0x14, 0x40, 0x7f, 0xbc, 0xe5, 0xfb, 0xff, 0xff, 0xff,
+	0xfe, 0xfb, 0xfb, 0xfb, 0xfe, 0xff, 0xfd, 0xe8, 0xba, 0x6d, 0x74, 0xa1, 0xf0, 0xff, 0xff, 0xe7, 0x92, 0x3d, 0x00, 0x12, 0x01, 0x0a, 0x1b, 0x42,
+	0x8d, 0xd0, 0xfd, 0xff, 0xff, 0xfc, 0xcf, 0x7a, 0x28, 0x00, 0x04, 0x09, 0x2f, 0x70, 0xbb, 0xea, 0xfe, 0xff, 0xf7, 0xda, 0xa9, 0x6c, 0x37, 0x23,
+	0x34, 0x60, 0x8f, 0xc1, 0xe6, 0xfc, 0xff, 0xf9, 0xdd, 0xa8, 0x5d, 0x24, 0x04, 0x00, 0x09, 0x16, 0x6b, 0xc0, 0xff, 0xff, 0xff, 0xc0, 0x6b, 0x16,
+	0x00, 0x0d, 0x24, 0x79, 0xce, 0xff, 0xff, 0xff, 0xb0, 0x5b, 0x06, 0x00, 0x0f, 0x03, 0x08, 0x0c, 0x0e, 0x0e, 0x0c, 0x08, 0x03, 0x00, 0x20, 0x3f,
+	0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x01, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x19, 0x09, 0x1f, 0x42, 0x69, 0x90,
+	0xb6, 0xda, 0xf3, 0xfe, 0xff, 0xff, 0xfd, 0xec, 0xc1, 0x73, 0x30, 0x05, 0x00, 0x03, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xff, 0xc6, 0x71, 0x1c, 0x00,
+	0x0b, 0x1d, 0x72, 0xc7, 0xff, 0xff, 0xff, 0xc8, 0x73, 0x1e, 0x00, 0x01, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xff, 0xc6, 0x71, 0x1c, 0x00, 0x0b, 0x1d,
+	0x72, 0xc7, 0xff, 0xff, 0xff, 0xc8, 0x73, 0x1e, 0x00, 0x01, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xd6, 0x81, 0x2c, 0x06, 0x2d, 0x76, 0xc5, 0xf3, 0xff,
+	0xf8, 0xd1, 0x8a, 0x3c, 0x0d, 0x00, 0x12, 0x1f, 0x6b, 0xc0, 0xf6, 0xff, 0xf4, 0xca, 0x85, 0x3b, 0x10, 0x00, 0x09, 0x03, 0x54, 0xa9, 0xfb, 0xff,
+	0xff, 0xfa, 0xb1, 0x5c, 0x0b, 0x00, 0x15, 0x0a, 0x2e, 0x6d, 0xb6, 0xe7, 0xfd, 0xff, 0xf0, 0xc5, 0x7c, 0x36, 0x0b, 0x00, 0x11, 0x3f, 0x94, 0xe9,
+	0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x07, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x15, 0x08, 0x2d, 0x7f, 0xcc, 0xfc, 0xff, 0xeb,
+	0x9c, 0x47, 0x06, 0x00, 0x02, 0x17, 0x6c, 0xc1, 0xff, 0xff, 0xfe, 0xb9, 0x64, 0x10, 0x00, 0x0d, 0x21, 0x76, 0xcb, 0xff, 0xff, 0xf2, 0x9e, 0x49,
+	0x01, 0x00, 0x07, 0x01, 0x0f, 0x25, 0x3e, 0x4f, 0x5d, 0x6b, 0x73, 0x73, 0x6c, 0x5d, 0x46, 0x28, 0x0f, 0x02, 0x0f, 0x64, 0xb9, 0xff, 0xff, 0xff,
+	0xbf, 0x6a, 0x15, 0x00, 0x16, 0x17, 0x67, 0xbc, 0xf9, 0xff, 0xff, 0xfe, 0xb8, 0x63, 0x0f, 0x00, 0x01, 0x02, 0x2b, 0x7d, 0xd0, 0xfb, 0xff, 0xfe,
+	0xd4, 0x8b, 0x37, 0x0c, 0x00, 0x07, 0x02, 0x18, 0x49, 0x97, 0xd7, 0xfb, 0xff, 0xf8, 0xcc, 0x79, 0x2b, 0x02, 0x00, 0x07, 0x16, 0x6b, 0xc0, 0xff,
+	0xff, 0xff, 0xc0, 0x6b, 0x16, 0x00, 0x0d, 0x18, 0x6d, 0xc2, 0xff, 0xff, 0xf8, 0xa3, 0x4e, 0x00, 0x05, 0x2b, 0x6f, 0xb3, 0xcd, 0x92, 0x4e, 0x0a,
+	0x00, 0x04, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x20, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x01, 0x3f, 0x94,
+	0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x1f, 0x05, 0x1e, 0x4a, 0x90, 0xcd, 0xf6, 0xff, 0xff, 0xf9, 0xc2, 0x6d, 0x1e, 0x00, 0x02, 0x3f, 0x94,
+	0xe9, 0xff, 0xff, 0xf9, 0xa5, 0x50, 0x00, 0x0c, 0x02, 0x57, 0xac, 0xff, 0xff, 0xff, 0xd2, 0x7d, 0x28, 0x00, 0x01, 0x3f, 0x94, 0xe9, 0xff, 0xff,
+	0xf9, 0xa5, 0x50, 0x00, 0x0c, 0x02, 0x57, 0xac, 0xff, 0xff, 0xff, 0xd2, 0x7d, 0x28, 0x00, 0x01, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xc7, 0x83, 0x63,
+	0x97, 0xdb, 0xfc, 0xff, 0xf6, 0xbe, 0x6b, 0x1f, 0x02, 0x00, 0x13, 0x15, 0x6a, 0xbf, 0xfe, 0xfd, 0xca, 0x76, 0x23, 0x01, 0x00, 0x0c, 0x38, 0x8d,
+	0xe2, 0xff, 0xff, 0xff, 0xec, 0x98, 0x43, 0x01, 0x00, 0x11, 0x01, 0x1f, 0x61, 0xb4, 0xeb, 0xfe, 0xfe, 0xea, 0xbb, 0x73, 0x32, 0x0c, 0x00, 0x14,
+	0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x07, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x17, 0x28, 0x7d, 0xd2, 0xff,
+	0xff, 0xf3, 0xa9, 0x54, 0x0a, 0x00, 0x02, 0x4b, 0xa0, 0xf5, 0xff, 0xfe, 0xb6, 0x61, 0x0d, 0x00, 0x0d, 0x12, 0x67, 0xbc, 0xff, 0xff, 0xfe, 0xb1,
+	0x5c, 0x08, 0x00, 0x15, 0x08, 0x4c, 0xa1, 0xee, 0xff, 0xff, 0xe2, 0x8d, 0x38, 0x00, 0x18, 0x13, 0x68, 0xbd, 0xff, 0xff, 0xff, 0xd2, 0x7d, 0x28,
+	0x00, 0x01, 0x25, 0x7a, 0xcf, 0xff, 0xff, 0xfe, 0xcb, 0x76, 0x22, 0x00, 0x0c, 0x06, 0x4f, 0xa4, 0xf2, 0xff, 0xff, 0xd6, 0x81, 0x2c, 0x00, 0x07,
+	0x16, 0x6b, 0xc0, 0xff, 0xff, 0xff, 0xc0, 0x6b, 0x16, 0x00, 0x0d, 0x0b, 0x60, 0xb5, 0xff, 0xff, 0xec, 0x97, 0x42, 0x00, 0x05, 0x40, 0x95, 0xea,
+	0xff, 0xc1, 0x6c, 0x17, 0x00, 0x04, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x20, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40,
+	0x00, 0x01, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x22, 0x02, 0x3a, 0x8f, 0xe2, 0xff, 0xff, 0xf9, 0xa9, 0x54, 0x04, 0x00, 0x01,
+	0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x0c, 0x02, 0x57, 0xac, 0xff, 0xff, 0xff, 0xd2, 0x7d, 0x28, 0x00, 0x01, 0x3f, 0x94, 0xe9,
+	0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x0c, 0x02, 0x57, 0xac, 0xff, 0xff, 0xff, 0xd2, 0x7d, 0x28, 0x00, 0x01, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xf4,
+	0xf4, 0xf4, 0xfe, 0xfd, 0xfd, 0xfe, 0xff, 0xed, 0xb2, 0x5e, 0x1a, 0x00, 0x13, 0x22, 0x69, 0xaf, 0xd4, 0xc2, 0x7c, 0x35, 0x00, 0x0e, 0x05, 0x3e,
+	0x93, 0xe3, 0xff, 0xff, 0xff, 0xdc, 0x9e, 0x52, 0x20, 0x0a, 0x00, 0x0e, 0x0b, 0x50, 0xa5, 0xef, 0xff, 0xff, 0xdd, 0x94, 0x3f, 0x0c, 0x00, 0x17,
+	0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x07, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x17, 0x37, 0x8c, 0xe1, 0xff,
+	0xff, 0xf9, 0xa9, 0x54, 0x05, 0x00, 0x02, 0x23, 0x77, 0xcc, 0xfe, 0xff, 0xe9, 0x9b, 0x46, 0x07, 0x00, 0x0c, 0x33, 0x88, 0xdd, 0xff, 0xff, 0xe2,
+	0x8d, 0x38, 0x00, 0x15, 0x0e, 0x59, 0xae, 0xf4, 0xff, 0xff, 0xdb, 0x88, 0x33, 0x01, 0x00, 0x18, 0x2d, 0x82, 0xd7, 0xff, 0xff, 0xfa, 0xab, 0x56,
+	0x06, 0x00, 0x01, 0x35, 0x8a, 0xdf, 0xff, 0xff, 0xec, 0x97, 0x42, 0x00, 0x0e, 0x36, 0x8b, 0xe0, 0xff, 0xff, 0xe6, 0x91, 0x3c, 0x00, 0x07, 0x16,
+	0x6b, 0xc0, 0xff, 0xff, 0xff, 0xc0, 0x6b, 0x16, 0x00, 0x0d, 0x01, 0x54, 0xa9, 0xfd, 0xff, 0xe0, 0x8b, 0x36, 0x00, 0x05, 0x4c, 0xa1, 0xf6, 0xff,
+	0xce, 0x79, 0x24, 0x00, 0x04, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x20, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00,
+	0x01, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x22, 0x02, 0x38, 0x8d, 0xdf, 0xff, 0xff, 0xf8, 0xaa, 0x55, 0x06, 0x00, 0x01, 0x3f,
+	0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x0c, 0x02, 0x57, 0xac, 0xff, 0xff, 0xff, 0xd2, 0x7d, 0x28, 0x00, 0x01, 0x3f, 0x94, 0xe9, 0xff,
+	0xff, 0xea, 0x95, 0x40, 0x00, 0x0c, 0x02, 0x57, 0xac, 0xff, 0xff, 0xff, 0xd2, 0x7d, 0x28, 0x00, 0x01, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xf7, 0xd1,
+	0x95, 0x4d, 0x2e, 0x4f, 0x9f, 0xe4, 0xfe, 0xff, 0xef, 0xb7, 0x63, 0x1d, 0x00, 0x28, 0x21, 0x65, 0xba, 0xee, 0xfe, 0xff, 0xff, 0xff, 0xfc, 0xed,
+	0xd1, 0xac, 0x8c, 0x7a, 0x79, 0x83, 0x8e, 0x9e, 0xb5, 0xd2, 0xad, 0x67, 0x16, 0x00, 0x01, 0x3d, 0x92, 0xe7, 0xff, 0xff, 0xd9, 0x84, 0x2f, 0x00,
+	0x19, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x07, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x01, 0x0c, 0x1b, 0x1f,
+	0x13, 0x04, 0x00, 0x0e, 0x01, 0x19, 0x58, 0xab, 0xe9, 0xff, 0xff, 0xfa, 0xc3, 0x6e, 0x1e, 0x00, 0x04, 0x14, 0x5d, 0xb2, 0xf2, 0xff, 0xf7, 0xc6,
+	0x7b, 0x2e, 0x09, 0x00, 0x08, 0x0d, 0x49, 0x9e, 0xe6, 0xff, 0xff, 0xec, 0xa3, 0x4e, 0x0c, 0x00, 0x12, 0x0c, 0x33, 0x74, 0xbb, 0xe9, 0xfe, 0xff,
+	0xf1, 0xbc, 0x67, 0x1f, 0x00, 0x05, 0x01, 0x14, 0x19, 0x18, 0x04, 0x00, 0x0d, 0x01, 0x15, 0x53, 0xa7, 0xe7, 0xff, 0xff, 0xf4, 0xbb, 0x66, 0x1b,
+	0x00, 0x02, 0x0b, 0x5e, 0xb3, 0xfc, 0xff, 0xff, 0xd8, 0x8a, 0x35, 0x07, 0x00, 0x0a, 0x07, 0x35, 0x89, 0xd7, 0xfe, 0xff, 0xfa, 0xb1, 0x5c, 0x0c,
+	0x00, 0x07, 0x16, 0x6b, 0xc0, 0xff, 0xff, 0xff, 0xc0, 0x6b, 0x16, 0x00, 0x0e, 0x48, 0x9d, 0xf2, 0xff, 0xd3, 0x7e, 0x29, 0x00, 0x04, 0x04, 0x59,
+	0xae, 0xff, 0xff, 0xda, 0x85, 0x30, 0x00, 0x04, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x20, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea,
+	0x95, 0x40, 0x00, 0x01, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x0f, 0x10, 0x18, 0x19, 0x08, 0x00, 0x0e, 0x0c, 0x50, 0xa5, 0xee,
+	0xff, 0xff, 0xfe, 0xc9, 0x74, 0x20, 0x00, 0x02, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x0c, 0x02, 0x57, 0xac, 0xff, 0xff, 0xff,
+	0xd2, 0x7d, 0x28, 0x00, 0x01, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x0c, 0x02, 0x57, 0xac, 0xff, 0xff, 0xff, 0xd2, 0x7d, 0x28,
+	0x00, 0x01, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xe4, 0x8f, 0x3a, 0x00, 0x03, 0x10, 0x4a, 0x9f, 0xe4, 0xfe, 0xff, 0xf1, 0xbc, 0x68, 0x20, 0x01, 0x00,
+	0x0d, 0x01, 0x17, 0x3c, 0x65, 0x78, 0x75, 0x5a, 0x31, 0x0f, 0x00, 0x11, 0x08, 0x2a, 0x60, 0x97, 0xbf, 0xdb, 0xf0, 0xfc, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xfb, 0xec, 0xd2, 0x8e, 0x48, 0x0d, 0x00, 0x01, 0x41, 0x96, 0xeb, 0xff, 0xff, 0xd3, 0x7e, 0x29, 0x00, 0x19, 0x3f, 0x94, 0xe9,
+	0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x07, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x01, 0x2c, 0x81, 0xd6, 0xf8, 0xe7, 0xcc, 0xae,
+	0x97, 0x88, 0x7d, 0x72, 0x67, 0x5f, 0x5f, 0x66, 0x70, 0x7b, 0x8d, 0xaa, 0xd1, 0xee, 0xfd, 0xff, 0xff, 0xf7, 0xca, 0x7a, 0x2d, 0x05, 0x00, 0x06,
+	0x03, 0x2f, 0x78, 0xc9, 0xf2, 0xff, 0xfe, 0xed, 0xcd, 0xa5, 0x88, 0x72, 0x65, 0x65, 0x71, 0x88, 0xad, 0xd7, 0xf5, 0xff, 0xff, 0xf4, 0xbe, 0x69,
+	0x1f, 0x00, 0x07, 0x14, 0x3c, 0x5e, 0x67, 0x5a, 0x53, 0x54, 0x5e, 0x6f, 0x81, 0x93, 0xa5, 0xbc, 0xda, 0xf2, 0xff, 0xff, 0xfb, 0xde, 0x9e, 0x4d,
+	0x15, 0x00, 0x07, 0x03, 0x58, 0xad, 0xf5, 0xe3, 0xc8, 0xae, 0x98, 0x85, 0x76, 0x6b, 0x63, 0x61, 0x64, 0x6d, 0x78, 0x87, 0xa3, 0xc9, 0xea, 0xfc,
+	0xff, 0xff, 0xf4, 0xc1, 0x6e, 0x24, 0x02, 0x00, 0x04, 0x09, 0x38, 0x89, 0xd4, 0xfa, 0xff, 0xfd, 0xed, 0xcd, 0xa2, 0x82, 0x6e, 0x62, 0x5a, 0x5b,
+	0x63, 0x70, 0x85, 0xa7, 0xd1, 0xef, 0xfd, 0xff, 0xf6, 0xc9, 0x79, 0x2d, 0x05, 0x00, 0x08, 0x16, 0x6b, 0xc0, 0xff, 0xff, 0xff, 0xc0, 0x6b, 0x16,
+	0x00, 0x0e, 0x3b, 0x90, 0xe5, 0xff, 0xc7, 0x72, 0x1d, 0x00, 0x04, 0x10, 0x65, 0xba, 0xff, 0xff, 0xe6, 0x91, 0x3c, 0x00, 0x04, 0x3f, 0x94, 0xe9,
+	0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x20, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x01, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95,
+	0x40, 0x00, 0x0f, 0x49, 0x9e, 0xef, 0xf0, 0xdc, 0xc3, 0xae, 0x9b, 0x8b, 0x7e, 0x75, 0x72, 0x77, 0x85, 0x9a, 0xb0, 0xc6, 0xdb, 0xee, 0xfa, 0xff,
+	0xff, 0xfa, 0xd5, 0x8c, 0x3b, 0x0b, 0x00, 0x03, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x0c, 0x02, 0x57, 0xac, 0xff, 0xff, 0xff,
+	0xd2, 0x7d, 0x28, 0x00, 0x01, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x0c, 0x02, 0x57, 0xac, 0xff, 0xff, 0xff, 0xd2, 0x7d, 0x28,
+	0x00, 0x01, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xe4, 0x8f, 0x3a, 0x00, 0x05, 0x10, 0x4a, 0x9f, 0xe4, 0xfe, 0xff, 0xf3, 0xc0, 0x6d, 0x24, 0x02, 0x00,
+	0x0b, 0x3e, 0x93, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x7e, 0x29, 0x00, 0x16, 0x06, 0x5b, 0xb0, 0xfe, 0xff, 0xc2, 0x78, 0x2a, 0x16, 0x0b, 0x04,
+	0x00, 0x05, 0x14, 0x67, 0xbc, 0xfc, 0xff, 0xfc, 0xd5, 0x8e, 0x3c, 0x0e, 0x00, 0x08, 0x0b, 0x21, 0x43, 0x55, 0x3e, 0x1c, 0x00, 0x09, 0x3f, 0x94,
+	0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x07, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x01, 0x13, 0x3f, 0x75, 0xa2, 0xbf, 0xdc,
+	0xf1, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfb, 0xf4, 0xe8, 0xcf, 0xac, 0x7f, 0x51, 0x27, 0x0c, 0x00, 0x0c, 0x09, 0x29,
+	0x60, 0x9d, 0xc9, 0xe6, 0xf4, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf5, 0xe6, 0xc6, 0x98, 0x5e, 0x2b, 0x0b, 0x00, 0x09, 0x26, 0x7b, 0xd0, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf5, 0xea, 0xd5, 0xb4, 0x88, 0x58, 0x2c, 0x0e, 0x01, 0x00, 0x09, 0x01, 0x2b, 0x62, 0xa4, 0xc5, 0xe1,
+	0xf3, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf5, 0xe9, 0xd0, 0xac, 0x7c, 0x4a, 0x21, 0x08, 0x00, 0x09, 0x05, 0x1d, 0x44,
+	0x74, 0xa2, 0xcb, 0xe9, 0xf9, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf6, 0xe3, 0xc1, 0x95, 0x66, 0x36, 0x14, 0x02, 0x00, 0x0a, 0x16,
+	0x6b, 0xc0, 0xff, 0xff, 0xff, 0xc0, 0x6b, 0x16, 0x00, 0x0e, 0x28, 0x6e, 0xb5, 0xd4, 0x9c, 0x55, 0x0e, 0x00, 0x04, 0x1d, 0x72, 0xc7, 0xff, 0xff,
+	0xf3, 0x9e, 0x49, 0x00, 0x04, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x20, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00,
+	0x01, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x0f, 0x28, 0x60, 0xa0, 0xc2, 0xdd, 0xf1, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xfd, 0xf6, 0xe2, 0xc1, 0x96, 0x6a, 0x3c, 0x18, 0x04, 0x00, 0x05, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x0c,
+	0x02, 0x57, 0xac, 0xff, 0xff, 0xff, 0xd2, 0x7d, 0x28, 0x00, 0x01, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x0c, 0x02, 0x57, 0xac,
+	0xff, 0xff, 0xff, 0xd2, 0x7d, 0x28, 0x00, 0x01, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xe4, 0x8f, 0x3a, 0x00, 0x07, 0x10, 0x4a, 0x9f, 0xe4, 0xfe, 0xff,
+	0xf5, 0xc4, 0x72, 0x27, 0x03, 0x00, 0x09, 0x2d, 0x80, 0xd5, 0xfd, 0xff, 0xff, 0xf9, 0xbf, 0x6a, 0x1b, 0x00, 0x17, 0x54, 0xa9, 0xfe, 0xff, 0xb6,
+	0x61, 0x0c, 0x00, 0x09, 0x09, 0x39, 0x8b, 0xd7, 0xfc, 0xff, 0xff, 0xfa, 0xe8, 0xd2, 0xbd, 0xb3, 0xb1, 0xb9, 0xc6, 0xd3, 0xe4, 0xf2, 0xfc, 0xff,
+	0xff, 0xde, 0x8c, 0x37, 0x02, 0x00, 0x07, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x07, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95,
+	0x40, 0x00, 0x07, 0x04, 0x0a, 0x13, 0x1a, 0x21, 0x28, 0x2c, 0x2b, 0x24, 0x18, 0x0d, 0x05, 0x01, 0x00, 0x19, 0x03, 0x0c, 0x1b, 0x26, 0x25, 0x19,
+	0x0b, 0x03, 0x00, 0x0f, 0x01, 0x08, 0x13, 0x20, 0x29, 0x2f, 0x2e, 0x28, 0x1d, 0x11, 0x07, 0x01, 0x00, 0x17, 0x04, 0x0c, 0x17, 0x22, 0x29, 0x2e,
+	0x2e, 0x28, 0x1d, 0x10, 0x07, 0x01, 0x00, 0x17, 0x03, 0x0a, 0x15, 0x21, 0x29, 0x29, 0x21, 0x14, 0x09, 0x02, 0x00, 0x11, 0x16, 0x6b, 0xc0, 0xff,
+	0xff, 0xff, 0xc0, 0x6b, 0x16, 0x00, 0x19, 0x29, 0x7e, 0xd3, 0xff, 0xff, 0xfd, 0xaa, 0x55, 0x02, 0x00, 0x03, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea,
+	0x95, 0x40, 0x00, 0x20, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x01, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x14,
+	0x04, 0x0a, 0x12, 0x19, 0x20, 0x27, 0x2c, 0x2c, 0x25, 0x1b, 0x10, 0x07, 0x01, 0x00, 0x0c, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00,
+	0x0c, 0x02, 0x57, 0xac, 0xff, 0xff, 0xff, 0xd2, 0x7d, 0x28, 0x00, 0x01, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x0c, 0x02, 0x57,
+	0xac, 0xff, 0xff, 0xff, 0xd2, 0x7d, 0x28, 0x00, 0x01, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xe4, 0x8f, 0x3a, 0x00, 0x09, 0x10, 0x4a, 0x9f, 0xe4, 0xfe,
+	0xff, 0xf7, 0xc9, 0x78, 0x2b, 0x04, 0x00, 0x08, 0x03, 0x15, 0x2c, 0x3e, 0x3b, 0x26, 0x10, 0x01, 0x00, 0x18, 0x11, 0x22, 0x33, 0x33, 0x24, 0x13,
+	0x02, 0x00, 0x0b, 0x02, 0x12, 0x34, 0x64, 0x91, 0xb1, 0xc5, 0xd2, 0xde, 0xe8, 0xe9, 0xe2, 0xd6, 0xc9, 0xbc, 0xab, 0x93, 0x73, 0x51, 0x2f, 0x14,
+	0x04, 0x00, 0x08, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x07, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0xbb, 0x0c,
+	0x2c, 0x54, 0x73, 0x79, 0x69, 0x41, 0x1b, 0x03, 0x00, 0x03, 0x35, 0x8a, 0xdf, 0xff, 0xff, 0xff, 0xb7, 0x62, 0x0d, 0x00, 0x03, 0x3f, 0x94, 0xe9,
+	0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x20, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x01, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95,
+	0x40, 0x00, 0xf5, 0x08, 0x43, 0x80, 0xb5, 0xb7, 0xb7, 0xab, 0x6f, 0x32, 0x00, 0x0e, 0x01, 0x34, 0x71, 0xad, 0xb7, 0xb7, 0xb7, 0xa3, 0x66, 0x29,
+	0x00, 0x0e, 0x0c, 0x49, 0x86, 0xb7, 0xb7, 0xb7, 0xaa, 0x6d, 0x30, 0x00, 0x15, 0x02, 0x2e, 0x6b, 0xa6, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7,
+	0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb6, 0x79, 0x3c, 0x00, 0x02,
+	0x03, 0x17, 0x3b, 0x6a, 0x91, 0xb0, 0xc6, 0xd5, 0xdf, 0xe0, 0xda, 0xcf, 0xbe, 0xa1, 0x79, 0x43, 0x1a, 0x01, 0x00, 0x0e, 0x10, 0x49, 0x86, 0xb3,
+	0xb7, 0x9a, 0x5e, 0x21, 0x00, 0x21, 0x1d, 0x71, 0xc6, 0xfe, 0xff, 0xff, 0xff, 0xf3, 0xa0, 0x4b, 0x02, 0x00, 0x02, 0x42, 0x97, 0xec, 0xff, 0xff,
+	0xff, 0xc3, 0x6e, 0x19, 0x00, 0x03, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x20, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40,
+	0x00, 0x01, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x0d, 0x0d, 0x30, 0x67, 0x97, 0xb1, 0xb7, 0xa9, 0x6c, 0x2f, 0x00, 0x0e, 0x02,
+	0x29, 0x66, 0xa1, 0xb7, 0xb0, 0x7e, 0x41, 0x0b, 0x00, 0x09, 0x3c, 0x79, 0xb6, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xa5, 0x68, 0x2b, 0x00, 0x15, 0x03,
+	0x37, 0x74, 0xae, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xab, 0x6e, 0x31, 0x00, 0x06, 0x03, 0x19, 0x45, 0x7f, 0xa5, 0xb6, 0xb7, 0x8f, 0x52, 0x15, 0x00,
+	0x0e, 0x0a, 0x3f, 0x7c, 0xaf, 0xb7, 0xa2, 0x68, 0x2b, 0x02, 0x00, 0x15, 0x34, 0x71, 0xae, 0xb7, 0x9d, 0x60, 0x23, 0x00, 0x06, 0x1f, 0x5c, 0x99,
+	0xb7, 0xac, 0x6f, 0x32, 0x00, 0x16, 0x0f, 0x50, 0x92, 0xc5, 0xc7, 0xc7, 0xb6, 0x76, 0x33, 0x01, 0x00, 0x24, 0x24, 0x79, 0xce, 0xff, 0xff, 0xff,
+	0xd2, 0x7d, 0x28, 0x00, 0x0d, 0x2c, 0x81, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc8, 0x73, 0x1e, 0x00, 0x0c, 0x01, 0x42, 0x97, 0xeb, 0xff, 0xff,
+	0xfc, 0xb6, 0x61, 0x0f, 0x00, 0x14, 0x0b, 0x4e, 0xa3, 0xed, 0xff, 0xfd, 0xf7, 0xf2, 0xee, 0xf3, 0xf9, 0xfe, 0xff, 0xff, 0xfd, 0xf7, 0xf2, 0xee,
+	0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0x9d, 0x4e, 0x00, 0x02, 0x1b, 0x5f, 0xb2, 0xdb, 0xca, 0x9f,
+	0x7e, 0x67, 0x59, 0x54, 0x5f, 0x88, 0xbf, 0xec, 0xff, 0xf4, 0xb5, 0x60, 0x15, 0x00, 0x0b, 0x05, 0x36, 0x8a, 0xda, 0xfe, 0xf1, 0xb3, 0x5e, 0x17,
+	0x00, 0x22, 0x12, 0x5e, 0xb3, 0xf5, 0xff, 0xff, 0xfe, 0xe2, 0x8d, 0x38, 0x00, 0x03, 0x4e, 0xa3, 0xf8, 0xff, 0xff, 0xff, 0xcf, 0x7a, 0x25, 0x00,
+	0x03, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x20, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x01, 0x3f, 0x94, 0xe9,
+	0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x09, 0x0a, 0x2b, 0x61, 0xa3, 0xd7, 0xf5, 0xf3, 0xf3, 0xf4, 0xff, 0xec, 0x97, 0x42, 0x00, 0x0d, 0x16, 0x5d,
+	0xb2, 0xf1, 0xfe, 0xda, 0x8b, 0x37, 0x05, 0x00, 0x0a, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0x88, 0x33, 0x00, 0x13, 0x04,
+	0x43, 0x98, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0x99, 0x44, 0x00, 0x02, 0x02, 0x16, 0x40, 0x7d, 0xbc, 0xe7, 0xf5, 0xf2, 0xf2, 0xfa,
+	0xff, 0xc7, 0x72, 0x1d, 0x00, 0x0c, 0x02, 0x2b, 0x7c, 0xcf, 0xfb, 0xf7, 0xc1, 0x6c, 0x1f, 0x00, 0x16, 0x1e, 0x73, 0xc8, 0xff, 0xfc, 0xb1, 0x5c,
+	0x0a, 0x00, 0x05, 0x07, 0x56, 0xab, 0xf9, 0xff, 0xc6, 0x71, 0x1c, 0x00, 0x15, 0x15, 0x65, 0xba, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x95, 0x40,
+	0x03, 0x00, 0x24, 0x36, 0x8b, 0xe0, 0xff, 0xff, 0xfd, 0xbd, 0x68, 0x14, 0x00, 0x0b, 0x1b, 0x6f, 0xc4, 0xfe, 0xff, 0xec, 0xec, 0xec, 0xff, 0xfc,
+	0xb8, 0x63, 0x11, 0x00, 0x0b, 0x27, 0x7c, 0xd1, 0xff, 0xff, 0xff, 0xcb, 0x76, 0x21, 0x00, 0x14, 0x1b, 0x6b, 0xc0, 0xf9, 0xff, 0xf2, 0xad, 0x58,
+	0x0f, 0x00, 0x01, 0x52, 0xa7, 0xfc, 0xff, 0xff, 0xe4, 0x8f, 0x3a, 0x00, 0x15, 0x01, 0x01, 0x01, 0x00, 0x06, 0x04, 0x53, 0xa8, 0xf9, 0xff, 0xdc,
+	0x87, 0x32, 0x00, 0x0a, 0x20, 0x6e, 0xc2, 0xf7, 0xfb, 0xce, 0x7b, 0x2a, 0x02, 0x00, 0x25, 0x0d, 0x23, 0x39, 0x3f, 0x2f, 0x18, 0x05, 0x00, 0x03,
+	0x03, 0x43, 0x84, 0xc1, 0xc1, 0xc1, 0xc1, 0xa5, 0x65, 0x24, 0x00, 0x03, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x39, 0x0d, 0x47,
+	0x9b, 0xda, 0xd6, 0xa2, 0x5d, 0x51, 0x87, 0xd4, 0xff, 0xec, 0x97, 0x42, 0x00, 0x0b, 0x09, 0x41, 0x96, 0xe2, 0xff, 0xec, 0xa8, 0x53, 0x10, 0x00,
+	0x0c, 0x54, 0xa9, 0xfe, 0xff, 0xea, 0xd1, 0xd1, 0xe5, 0xff, 0xff, 0xdf, 0x8b, 0x36, 0x01, 0x00, 0x10, 0x05, 0x47, 0x9c, 0xec, 0xff, 0xf3, 0xd0,
+	0xd0, 0xdc, 0xff, 0xff, 0xee, 0x99, 0x44, 0x00, 0x02, 0x21, 0x6a, 0xbe, 0xe0, 0xc4, 0x85, 0x43, 0x65, 0xa5, 0xf9, 0xff, 0xc7, 0x72, 0x1d, 0x00,
+	0x0b, 0x17, 0x60, 0xb5, 0xf2, 0xfd, 0xd8, 0x88, 0x35, 0x05, 0x00, 0x16, 0x03, 0x4e, 0xa3, 0xf5, 0xff, 0xd6, 0x81, 0x2c, 0x00, 0x06, 0x33, 0x88,
+	0xdd, 0xff, 0xe9, 0x94, 0x3f, 0x00, 0x15, 0x1a, 0x6d, 0xc2, 0xfc, 0xff, 0xdf, 0xd8, 0xd8, 0xf8, 0xff, 0xec, 0x9d, 0x48, 0x06, 0x00, 0x23, 0x03,
+	0x48, 0x9d, 0xee, 0xff, 0xff, 0xf6, 0xa8, 0x53, 0x07, 0x00, 0x09, 0x0d, 0x5d, 0xb2, 0xfa, 0xff, 0xe6, 0x94, 0x88, 0xa1, 0xf2, 0xff, 0xf5, 0xa7,
+	0x52, 0x07, 0x00, 0x09, 0x0e, 0x60, 0xb5, 0xfc, 0xff, 0xff, 0xe0, 0x8b, 0x36, 0x00, 0x13, 0x02, 0x33, 0x88, 0xdb, 0xff, 0xff, 0xe3, 0x93, 0x3e,
+	0x04, 0x00, 0x02, 0x52, 0xa7, 0xfc, 0xff, 0xff, 0xe4, 0x8f, 0x3a, 0x00, 0x17, 0x03, 0x06, 0x09, 0x0d, 0x1a, 0x30, 0x48, 0x7e, 0xbb, 0xf0, 0xf9,
+	0xda, 0x87, 0x38, 0x02, 0x00, 0x08, 0x10, 0x51, 0xa6, 0xeb, 0xff, 0xe3, 0x97, 0x42, 0x09, 0x00, 0x4d, 0x3c, 0x79, 0xb6, 0xb7, 0xb7, 0xb7, 0xb7,
+	0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb6, 0xb0, 0xa6, 0x98, 0x8a, 0x7c, 0x6e, 0x60, 0x51, 0x37, 0x1c, 0x06, 0x00, 0x1c, 0x05, 0x05, 0x05, 0x00, 0x02,
+	0x32, 0x87, 0xdc, 0xff, 0xec, 0x97, 0x42, 0x00, 0x09, 0x01, 0x28, 0x79, 0xcd, 0xfb, 0xf8, 0xc4, 0x6f, 0x21, 0x00, 0x0e, 0x54, 0xa9, 0xfe, 0xff,
+	0xf7, 0xa4, 0x87, 0x8f, 0xe2, 0xff, 0xff, 0xe2, 0x8f, 0x3a, 0x01, 0x00, 0x0e, 0x06, 0x4b, 0xa0, 0xee, 0xff, 0xf1, 0xa4, 0x81, 0x8f, 0xdb, 0xff,
+	0xff, 0xee, 0x99, 0x44, 0x00, 0x04, 0x05, 0x05, 0x04, 0x00, 0x01, 0x02, 0x57, 0xac, 0xff, 0xff, 0xc7, 0x72, 0x1d, 0x00, 0x09, 0x0a, 0x43, 0x98,
+	0xe3, 0xff, 0xeb, 0xa5, 0x50, 0x0f, 0x00, 0x18, 0x29, 0x7e, 0xd3, 0xff, 0xf6, 0xa5, 0x50, 0x04, 0x00, 0x05, 0x10, 0x65, 0xba, 0xfe, 0xfd, 0xb7,
+	0x62, 0x0f, 0x00, 0x14, 0x21, 0x75, 0xca, 0xfe, 0xff, 0xe7, 0x93, 0x51, 0x66, 0xb9, 0xfb, 0xff, 0xf1, 0xa6, 0x51, 0x0a, 0x00, 0x23, 0x0b, 0x59,
+	0xae, 0xf8, 0xff, 0xff, 0xe7, 0x93, 0x3e, 0x00, 0x08, 0x04, 0x4b, 0xa0, 0xf1, 0xff, 0xf9, 0xad, 0x58, 0x1a, 0x64, 0xb9, 0xfd, 0xff, 0xe9, 0x96,
+	0x41, 0x01, 0x00, 0x07, 0x01, 0x45, 0x9a, 0xee, 0xff, 0xff, 0xf1, 0xa0, 0x4b, 0x03, 0x00, 0x12, 0x0c, 0x50, 0xa5, 0xee, 0xff, 0xfd, 0xce, 0x79,
+	0x26, 0x00, 0x04, 0x52, 0xa7, 0xfc, 0xff, 0xff, 0xe4, 0x8f, 0x3a, 0x00, 0x16, 0x04, 0x59, 0xae, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xc9,
+	0x7f, 0x33, 0x0a, 0x00, 0x08, 0x05, 0x36, 0x8a, 0xd9, 0xfe, 0xf2, 0xb4, 0x5f, 0x17, 0x00, 0x27, 0x3c, 0x79, 0xb6, 0xb7, 0xb7, 0xa0, 0x63, 0x26,
+	0x00, 0x11, 0x0f, 0x4c, 0x89, 0xb7, 0xb7, 0xb7, 0x90, 0x53, 0x16, 0x00, 0x06, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xfb, 0xf1, 0xe7, 0xe1, 0xe1, 0xe1,
+	0xe1, 0xe5, 0xed, 0xf7, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf2, 0xd4, 0xa4, 0x6c, 0x38, 0x13, 0x02, 0x00, 0x1c, 0x33, 0x88, 0xdd, 0xff,
+	0xec, 0x97, 0x42, 0x00, 0x08, 0x16, 0x5d, 0xb2, 0xf1, 0xfe, 0xdb, 0x8c, 0x38, 0x06, 0x00, 0x0f, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xae, 0x5b, 0x3c,
+	0x8c, 0xe0, 0xff, 0xff, 0xe5, 0x92, 0x3d, 0x02, 0x00, 0x0c, 0x08, 0x4e, 0xa3, 0xf0, 0xff, 0xee, 0xa0, 0x4b, 0x43, 0x91, 0xe6, 0xff, 0xff, 0xee,
+	0x99, 0x44, 0x00, 0x08, 0x02, 0x57, 0xac, 0xff, 0xff, 0xc7, 0x72, 0x1d, 0x00, 0x07, 0x02, 0x2a, 0x7c, 0xce, 0xfb, 0xf7, 0xc1, 0x6d, 0x1f, 0x00,
+	0x10, 0x05, 0x24, 0x43, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5f, 0x91, 0xc7, 0xfb, 0xff, 0xe3, 0xad, 0x78, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e,
+	0x81, 0xb7, 0xed, 0xff, 0xee, 0xb8, 0x83, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x4b, 0x2c, 0x0d, 0x00, 0x0c, 0x28, 0x7d, 0xd2, 0xfe, 0xff, 0xe8, 0x96,
+	0x41, 0x03, 0x17, 0x68, 0xbd, 0xfb, 0xff, 0xf5, 0xaf, 0x5a, 0x0e, 0x00, 0x23, 0x17, 0x6b, 0xc0, 0xfe, 0xff, 0xff, 0xd3, 0x7e, 0x29, 0x00, 0x07,
+	0x39, 0x8e, 0xe3, 0xff, 0xff, 0xc6, 0x71, 0x1c, 0x00, 0x01, 0x23, 0x78, 0xcd, 0xff, 0xff, 0xda, 0x85, 0x30, 0x00, 0x07, 0x2a, 0x7f, 0xd4, 0xff,
+	0xff, 0xfb, 0xb5, 0x60, 0x0e, 0x00, 0x12, 0x1d, 0x6d, 0xc2, 0xfa, 0xff, 0xf6, 0xb5, 0x60, 0x14, 0x00, 0x05, 0x52, 0xa7, 0xfc, 0xff, 0xff, 0xe4,
+	0x8f, 0x3a, 0x00, 0x17, 0x09, 0x12, 0x1b, 0x1e, 0x28, 0x39, 0x4c, 0x68, 0xa2, 0xd7, 0xfd, 0xf8, 0xcf, 0x7a, 0x2c, 0x00, 0x05, 0x1f, 0x6d, 0xc1,
+	0xf7, 0xfb, 0xce, 0x7b, 0x2a, 0x02, 0x00, 0x28, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x11, 0x16, 0x6b, 0xc0, 0xff, 0xff, 0xff,
+	0xc8, 0x73, 0x1e, 0x00, 0x06, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x06, 0x03, 0x0a, 0x16, 0x24, 0x39, 0x5c, 0x8d, 0xc3, 0xe9,
+	0xfc, 0xff, 0xff, 0xfc, 0xdc, 0x90, 0x3d, 0x09, 0x00, 0x1a, 0x33, 0x88, 0xdd, 0xff, 0xec, 0x97, 0x42, 0x00, 0x06, 0x09, 0x40, 0x95, 0xe1, 0xff,
+	0xec, 0xa8, 0x53, 0x11, 0x00, 0x11, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xb7, 0x62, 0x0d, 0x34, 0x89, 0xdd, 0xff, 0xff, 0xe7, 0x95, 0x40, 0x03, 0x00,
+	0x0a, 0x09, 0x52, 0xa7, 0xf2, 0xff, 0xec, 0x9c, 0x47, 0x05, 0x42, 0x97, 0xec, 0xff, 0xff, 0xee, 0x99, 0x44, 0x00, 0x08, 0x02, 0x57, 0xac, 0xff,
+	0xff, 0xc7, 0x72, 0x1d, 0x00, 0x06, 0x17, 0x5f, 0xb4, 0xf2, 0xfd, 0xd9, 0x89, 0x36, 0x05, 0x00, 0x11, 0x0e, 0x63, 0xb8, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xcd, 0x78, 0x23, 0x00, 0x0b, 0x31, 0x86, 0xda, 0xff, 0xff, 0xe6, 0x94, 0x3f, 0x02, 0x00, 0x02, 0x14, 0x64, 0xb9, 0xfa,
+	0xff, 0xf9, 0xb7, 0x62, 0x13, 0x00, 0x23, 0x28, 0x7d, 0xd2, 0xff, 0xff, 0xfe, 0xbe, 0x69, 0x15, 0x00, 0x05, 0x27, 0x7c, 0xd1, 0xff, 0xff, 0xd9,
+	0x84, 0x2f, 0x00, 0x03, 0x33, 0x88, 0xdd, 0xff, 0xff, 0xc9, 0x74, 0x1f, 0x00, 0x05, 0x11, 0x64, 0xb9, 0xfd, 0xff, 0xff, 0xca, 0x75, 0x20, 0x00,
+	0x11, 0x03, 0x36, 0x8b, 0xdd, 0xff, 0xff, 0xe9, 0x9b, 0x46, 0x07, 0x00, 0x06, 0x52, 0xa7, 0xfc, 0xff, 0xff, 0xf2, 0xc9, 0xa0, 0x84, 0x84, 0x84,
+	0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x7b, 0x4f, 0x23, 0x00, 0x0f, 0x19, 0x6e, 0xc3, 0xff, 0xff, 0xcc, 0x77, 0x22, 0x00,
+	0x02, 0x0f, 0x50, 0xa5, 0xeb, 0xff, 0xe3, 0x98, 0x43, 0x0a, 0x00, 0x03, 0x11, 0x4d, 0x99, 0xd3, 0xe3, 0xe3, 0x9f, 0x53, 0x08, 0x00, 0x1e, 0x54,
+	0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x11, 0x16, 0x6b, 0xc0, 0xff, 0xff, 0xff, 0xc8, 0x73, 0x1e, 0x00, 0x06, 0x54, 0xa9, 0xfe, 0xff,
+	0xff, 0xdf, 0x8a, 0x35, 0x00, 0x0d, 0x02, 0x15, 0x54, 0xa7, 0xe9, 0xff, 0xff, 0xfb, 0xd1, 0x80, 0x2f, 0x04, 0x00, 0x18, 0x33, 0x88, 0xdd, 0xff,
+	0xec, 0x97, 0x42, 0x00, 0x04, 0x01, 0x28, 0x79, 0xcc, 0xfa, 0xf8, 0xc4, 0x70, 0x2d, 0x29, 0x59, 0x8b, 0xb1, 0xcb, 0xde, 0xef, 0xf7, 0xf5, 0xe9,
+	0xd3, 0xb1, 0x7d, 0x41, 0x15, 0x00, 0x04, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x01, 0x30, 0x85, 0xda, 0xff, 0xff, 0xe9, 0x98,
+	0x43, 0x04, 0x00, 0x08, 0x0b, 0x55, 0xaa, 0xf4, 0xff, 0xe9, 0x98, 0x43, 0x04, 0x00, 0x01, 0x44, 0x99, 0xee, 0xff, 0xff, 0xee, 0x99, 0x44, 0x00,
+	0x08, 0x02, 0x57, 0xac, 0xff, 0xff, 0xc7, 0x72, 0x1d, 0x00, 0x04, 0x09, 0x43, 0x98, 0xe3, 0xff, 0xeb, 0xa6, 0x51, 0x0f, 0x00, 0x04, 0x12, 0x4f,
+	0x9b, 0xd4, 0xe3, 0xe3, 0x9d, 0x51, 0x06, 0x00, 0x07, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x13, 0x66, 0xba, 0xfe, 0xfe, 0xbe, 0x6a, 0x16,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x08, 0x55, 0xa9, 0xf8, 0xff, 0xcc, 0x78, 0x24, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x01, 0x00, 0x0a, 0x02,
+	0x39, 0x8e, 0xe1, 0xff, 0xff, 0xe5, 0x92, 0x3d, 0x02, 0x00, 0x04, 0x11, 0x60, 0xb5, 0xf9, 0xff, 0xfb, 0xbf, 0x6a, 0x19, 0x00, 0x23, 0x39, 0x8e,
+	0xe3, 0xff, 0xff, 0xf6, 0xa8, 0x53, 0x07, 0x00, 0x03, 0x16, 0x69, 0xbe, 0xfd, 0xff, 0xeb, 0x97, 0x42, 0x01, 0x00, 0x03, 0x02, 0x43, 0x98, 0xeb,
+	0xff, 0xfc, 0xb9, 0x64, 0x11, 0x00, 0x03, 0x02, 0x49, 0x9e, 0xf0, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x11, 0x0d, 0x53, 0xa8, 0xf0, 0xff, 0xfe,
+	0xd5, 0x81, 0x2d, 0x01, 0x00, 0x07, 0x52, 0xa7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xee, 0x99, 0x44, 0x00, 0x02, 0x03, 0x32, 0x55, 0x6a, 0x47, 0x29, 0x12, 0x06, 0x01, 0x01, 0x0a, 0x1b, 0x36, 0x79, 0xbd, 0xf6,
+	0xff, 0xf3, 0xa8, 0x53, 0x09, 0x05, 0x35, 0x89, 0xd9, 0xfd, 0xf2, 0xb5, 0x60, 0x17, 0x00, 0x03, 0x0f, 0x4a, 0x9f, 0xe3, 0xfe, 0xfe, 0xff, 0xff,
+	0xb3, 0x5e, 0x09, 0x00, 0x1e, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x11, 0x16, 0x6b, 0xc0, 0xff, 0xff, 0xff, 0xc8, 0x73, 0x1e,
+	0x00, 0x06, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x10, 0x1e, 0x6b, 0xc0, 0xf7, 0xff, 0xff, 0xf6, 0xae, 0x59, 0x0c, 0x00, 0x17,
+	0x33, 0x88, 0xdd, 0xff, 0xec, 0x97, 0x42, 0x00, 0x03, 0x15, 0x5c, 0xb1, 0xf0, 0xfe, 0xdb, 0x8c, 0x38, 0x0f, 0x39, 0x88, 0xca, 0xd2, 0xa9, 0x7b,
+	0x59, 0x44, 0x41, 0x4f, 0x84, 0xbf, 0xf0, 0xff, 0xea, 0x97, 0x42, 0x02, 0x00, 0x02, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x02,
+	0x2d, 0x82, 0xd7, 0xff, 0xff, 0xeb, 0x9b, 0x46, 0x05, 0x00, 0x06, 0x0d, 0x59, 0xae, 0xf6, 0xff, 0xe6, 0x94, 0x3f, 0x03, 0x00, 0x02, 0x44, 0x99,
+	0xee, 0xff, 0xff, 0xee, 0x99, 0x44, 0x00, 0x08, 0x02, 0x57, 0xac, 0xff, 0xff, 0xc7, 0x72, 0x1d, 0x00, 0x02, 0x02, 0x2a, 0x7b, 0xce, 0xfb, 0xf7,
+	0xc2, 0x6d, 0x20, 0x00, 0x04, 0x10, 0x4c, 0xa1, 0xe5, 0xfe, 0xfe, 0xff, 0xff, 0xb1, 0x5c, 0x07, 0x00, 0x0e, 0x42, 0x97, 0xeb, 0xff, 0xe1, 0x8c,
+	0x37, 0x00, 0x06, 0x30, 0x85, 0xda, 0xff, 0xef, 0x9b, 0x46, 0x01, 0x00, 0x11, 0x04, 0x41, 0x96, 0xe7, 0xff, 0xff, 0xe3, 0x90, 0x3b, 0x01, 0x00,
+	0x06, 0x0f, 0x5c, 0xb1, 0xf7, 0xff, 0xfd, 0xc8, 0x73, 0x1f, 0x00, 0x22, 0x04, 0x4b, 0xa0, 0xf1, 0xff, 0xff, 0xe8, 0x93, 0x3e, 0x00, 0x02, 0x09,
+	0x57, 0xac, 0xf8, 0xff, 0xf7, 0xaa, 0x55, 0x08, 0x00, 0x05, 0x08, 0x53, 0xa8, 0xf5, 0xff, 0xf5, 0xa8, 0x53, 0x07, 0x00, 0x02, 0x2e, 0x83, 0xd8,
+	0xff, 0xff, 0xf0, 0x9f, 0x4a, 0x03, 0x00, 0x10, 0x1f, 0x70, 0xc5, 0xfb, 0xff, 0xfe, 0xd5, 0x93, 0x51, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x78, 0xba, 0xfc, 0xff, 0xff, 0xe7, 0x9b, 0x50, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1b,
+	0x11, 0x08, 0x00, 0x02, 0x04, 0x46, 0x92, 0xe3, 0xf6, 0xfe, 0xfe, 0xfb, 0xf4, 0xf4, 0xf8, 0xfe, 0xff, 0xfc, 0xeb, 0xcc, 0x96, 0x53, 0x1e, 0x01,
+	0x1f, 0x6c, 0xc1, 0xf7, 0xfb, 0xcf, 0x7c, 0x2b, 0x02, 0x00, 0x02, 0x0e, 0x46, 0x9a, 0xe1, 0xee, 0xb7, 0xb7, 0xc7, 0xff, 0xff, 0xb3, 0x5e, 0x09,
+	0x00, 0x1e, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x11, 0x16, 0x6b, 0xc0, 0xff, 0xff, 0xff, 0xc8, 0x73, 0x1e, 0x00, 0x06, 0x54,
+	0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x11, 0x13, 0x68, 0xbd, 0xff, 0xff, 0xff, 0xdd, 0x88, 0x33, 0x00, 0x17, 0x33, 0x88, 0xdd, 0xff,
+	0xec, 0x97, 0x42, 0x00, 0x01, 0x08, 0x40, 0x94, 0xe1, 0xfe, 0xed, 0xa9, 0x54, 0x11, 0x00, 0x03, 0x01, 0x01, 0x01, 0x00, 0x06, 0x08, 0x5c, 0xb1,
+	0xfe, 0xff, 0xc3, 0x6e, 0x19, 0x00, 0x02, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x03, 0x2a, 0x7f, 0xd4, 0xff, 0xff, 0xed, 0x9e,
+	0x49, 0x06, 0x00, 0x04, 0x0f, 0x5c, 0xb1, 0xf7, 0xff, 0xe3, 0x90, 0x3b, 0x02, 0x00, 0x03, 0x44, 0x99, 0xee, 0xff, 0xff, 0xee, 0x99, 0x44, 0x00,
+	0x08, 0x02, 0x57, 0xac, 0xff, 0xff, 0xc7, 0x72, 0x1d, 0x00, 0x01, 0x17, 0x5f, 0xb4, 0xf2, 0xfe, 0xda, 0x8a, 0x36, 0x05, 0x00, 0x03, 0x0e, 0x48,
+	0x9d, 0xe3, 0xed, 0xb7, 0xb7, 0xc8, 0xff, 0xff, 0xb1, 0x5c, 0x07, 0x00, 0x0d, 0x1f, 0x74, 0xc9, 0xff, 0xfb, 0xaf, 0x5a, 0x09, 0x00, 0x05, 0x0e,
+	0x61, 0xb6, 0xfd, 0xff, 0xbf, 0x6a, 0x15, 0x00, 0x11, 0x06, 0x49, 0x9e, 0xed, 0xff, 0xff, 0xef, 0xae, 0x6c, 0x39, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x45, 0x85, 0xc7, 0xfc, 0xff, 0xfe, 0xd0, 0x7b, 0x27, 0x00, 0x22, 0x0d, 0x5d, 0xb2, 0xfa, 0xff, 0xff, 0xd2, 0x7d, 0x28, 0x01,
+	0x42, 0x97, 0xeb, 0xff, 0xfd, 0xbd, 0x68, 0x14, 0x00, 0x07, 0x11, 0x63, 0xb8, 0xfc, 0xff, 0xe9, 0x96, 0x41, 0x01, 0x12, 0x66, 0xbb, 0xfe, 0xff,
+	0xfb, 0xb4, 0x5f, 0x0d, 0x00, 0x0f, 0x03, 0x38, 0x8d, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x8f, 0x3a, 0x00, 0x15, 0x02, 0x0e, 0x1e, 0x2d, 0x36, 0x3d, 0x3e, 0x39, 0x2e, 0x23, 0x14, 0x09,
+	0x01, 0x00, 0x02, 0x0f, 0x50, 0xa5, 0xea, 0xff, 0xe4, 0x99, 0x44, 0x0a, 0x00, 0x02, 0x0c, 0x42, 0x96, 0xdf, 0xf3, 0xc0, 0x6c, 0x33, 0x67, 0xbb,
+	0xff, 0xff, 0xb3, 0x5e, 0x09, 0x00, 0x1e, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x11, 0x16, 0x6b, 0xc0, 0xff, 0xff, 0xff, 0xc8,
+	0x73, 0x1e, 0x00, 0x01, 0x05, 0x0e, 0x17, 0x1b, 0x1b, 0x66, 0xb2, 0xfe, 0xff, 0xff, 0xe2, 0x96, 0x4a, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b,
+	0x19, 0x10, 0x07, 0x00, 0x08, 0x46, 0x9b, 0xf0, 0xff, 0xff, 0xfc, 0xb0, 0x5b, 0x08, 0x00, 0x16, 0x05, 0x0e, 0x16, 0x1a, 0x18, 0x0f, 0x08, 0x27,
+	0x78, 0xcb, 0xfa, 0xf8, 0xc5, 0x70, 0x22, 0x00, 0x0d, 0x05, 0x39, 0x8e, 0xde, 0xff, 0xe6, 0x93, 0x3e, 0x02, 0x00, 0x02, 0x54, 0xa9, 0xfe, 0xff,
+	0xff, 0xbb, 0x66, 0x11, 0x00, 0x04, 0x27, 0x7c, 0xd1, 0xff, 0xff, 0xef, 0xa2, 0x4d, 0x07, 0x00, 0x02, 0x11, 0x60, 0xb5, 0xf8, 0xff, 0xdf, 0x8b,
+	0x36, 0x01, 0x00, 0x04, 0x44, 0x99, 0xee, 0xff, 0xff, 0xee, 0x99, 0x44, 0x00, 0x09, 0x09, 0x11, 0x1a, 0x1a, 0x14, 0x0b, 0x0c, 0x42, 0x97, 0xe2,
+	0xff, 0xeb, 0xa6, 0x51, 0x10, 0x00, 0x03, 0x0d, 0x44, 0x98, 0xe0, 0xf3, 0xbe, 0x6a, 0x33, 0x69, 0xbd, 0xff, 0xff, 0xb1, 0x5c, 0x07, 0x00, 0x04,
+	0x1b, 0x55, 0x8f, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xc3, 0xde, 0xf8, 0xff, 0xf6, 0xdb, 0xc1, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xbd, 0xd8,
+	0xf2, 0xff, 0xfb, 0xe1, 0xc6, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0x82, 0x48, 0x0e, 0x00, 0x08, 0x0a, 0x52, 0xa7, 0xf1, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0x84, 0x2f, 0x00, 0x22, 0x1a,
+	0x6f, 0xc4, 0xfe, 0xff, 0xfd, 0xb4, 0x5f, 0x2f, 0x78, 0xcd, 0xff, 0xff, 0xcf, 0x7a, 0x25, 0x00, 0x09, 0x1e, 0x73, 0xc8, 0xff, 0xff, 0xd6, 0x81,
+	0x2c, 0x42, 0x97, 0xec, 0xff, 0xff, 0xc9, 0x74, 0x1f, 0x00, 0x0f, 0x0e, 0x56, 0xab, 0xf1, 0xff, 0xff, 0xde, 0xae, 0x7f, 0x70, 0x70, 0x70, 0x70,
+	0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x9e, 0xcd, 0xfd, 0xff, 0xff, 0xe4, 0x8f, 0x3a, 0x00, 0x22, 0x05, 0x35, 0x88, 0xd8, 0xfd, 0xf2,
+	0xb5, 0x60, 0x18, 0x00, 0x02, 0x0a, 0x3f, 0x92, 0xdd, 0xf5, 0xc5, 0x72, 0x26, 0x02, 0x12, 0x67, 0xbc, 0xff, 0xff, 0xb3, 0x5e, 0x09, 0x00, 0x1e,
+	0x54, 0xa9, 0xfe, 0xff, 0xff, 0xef, 0xc6, 0x9d, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
+	0x84, 0x8e, 0xb7, 0xe0, 0xff, 0xff, 0xff, 0xc8, 0x73, 0x1e, 0x00, 0x01, 0x31, 0x86, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0x97, 0x42, 0x00, 0x08, 0x2b, 0x80, 0xd5, 0xff, 0xff, 0xff, 0xce, 0x79, 0x24, 0x00, 0x1b,
+	0x15, 0x5b, 0xb0, 0xf0, 0xfe, 0xdc, 0x8d, 0x39, 0x06, 0x00, 0x0c, 0x0e, 0x3d, 0x8e, 0xd4, 0xfa, 0xec, 0xb4, 0x5f, 0x1d, 0x00, 0x04, 0x54, 0xa9,
+	0xfe, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x05, 0x24, 0x78, 0xcd, 0xfe, 0xff, 0xf1, 0xa5, 0x50, 0x08, 0x13, 0x63, 0xb8, 0xfa, 0xff, 0xdc, 0x87,
+	0x32, 0x00, 0x06, 0x44, 0x99, 0xee, 0xff, 0xff, 0xee, 0x99, 0x44, 0x00, 0x0d, 0x02, 0x29, 0x7a, 0xcd, 0xfb, 0xf7, 0xc2, 0x6e, 0x20, 0x00, 0x03,
+	0x0b, 0x41, 0x95, 0xde, 0xf5, 0xc3, 0x70, 0x24, 0x02, 0x14, 0x69, 0xbe, 0xff, 0xff, 0xb1, 0x5c, 0x07, 0x00, 0x04, 0x1b, 0x55, 0x90, 0xb0, 0xb0,
+	0xb0, 0xb0, 0xb0, 0xc3, 0xde, 0xf8, 0xff, 0xf7, 0xdd, 0xc2, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xbd, 0xd7, 0xf2, 0xff, 0xfc, 0xe1, 0xc7, 0xb0,
+	0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0x83, 0x49, 0x0e, 0x00, 0x07, 0x0e, 0x5a, 0xaf, 0xf5, 0xff, 0xff, 0xdc, 0xac, 0x7d, 0x70, 0x70, 0x70, 0x70,
+	0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x90, 0xbf, 0xef, 0xff, 0xff, 0xe0, 0x8c, 0x37, 0x01, 0x00, 0x21, 0x2b, 0x80, 0xd5,
+	0xff, 0xff, 0xe1, 0x91, 0x8a, 0xa8, 0xf8, 0xff, 0xe2, 0x8d, 0x38, 0x00, 0x0b, 0x2e, 0x83, 0xd8, 0xff, 0xfe, 0xbe, 0x80, 0x81, 0xc1, 0xff, 0xff,
+	0xde, 0x89, 0x34, 0x00, 0x0f, 0x21, 0x73, 0xc8, 0xfc, 0xff, 0xf9, 0xc0, 0x6b, 0x1b, 0x00, 0x0d, 0x52, 0xa7, 0xfc, 0xff, 0xff, 0xe4, 0x8f, 0x3a,
+	0x00, 0x21, 0x1f, 0x6c, 0xc0, 0xf7, 0xfb, 0xcf, 0x7d, 0x2b, 0x02, 0x00, 0x01, 0x09, 0x3b, 0x8e, 0xda, 0xfc, 0xe3, 0xa4, 0x62, 0x3b, 0x38, 0x38,
+	0x46, 0x88, 0xcb, 0xff, 0xff, 0xc3, 0x81, 0x3f, 0x36, 0x23, 0x10, 0x00, 0x1b, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc8, 0x73, 0x1e, 0x00,
+	0x01, 0x1a, 0x46, 0x73, 0x86, 0x86, 0xae, 0xd6, 0xfe, 0xff, 0xff, 0xf0, 0xc7, 0x9f, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x7c, 0x4f, 0x22,
+	0x00, 0x08, 0x43, 0x98, 0xed, 0xff, 0xff, 0xfd, 0xb2, 0x5d, 0x09, 0x00, 0x19, 0x08, 0x3f, 0x94, 0xe0, 0xfe, 0xed, 0xaa, 0x55, 0x11, 0x00, 0x0b,
+	0x06, 0x2a, 0x6e, 0xbc, 0xed, 0xf8, 0xd4, 0x90, 0x42, 0x11, 0x00, 0x06, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x06, 0x21, 0x75,
+	0xca, 0xfe, 0xff, 0xf3, 0xa8, 0x69, 0x71, 0xbc, 0xfb, 0xff, 0xd8, 0x83, 0x2e, 0x00, 0x07, 0x44, 0x99, 0xee, 0xff, 0xff, 0xee, 0x99, 0x44, 0x00,
+	0x0c, 0x16, 0x5e, 0xb3, 0xf1, 0xfe, 0xda, 0x8b, 0x37, 0x05, 0x00, 0x02, 0x09, 0x3d, 0x90, 0xdb, 0xfc, 0xe1, 0xa2, 0x60, 0x3b, 0x38, 0x38, 0x48,
+	0x8a, 0xcc, 0xff, 0xff, 0xc2, 0x7f, 0x3d, 0x35, 0x22, 0x10, 0x00, 0x08, 0x0b, 0x5e, 0xb3, 0xfd, 0xff, 0xc6, 0x71, 0x1c, 0x00, 0x05, 0x02, 0x4b,
+	0xa0, 0xf3, 0xff, 0xd5, 0x80, 0x2b, 0x00, 0x10, 0x13, 0x62, 0xb7, 0xf9, 0xff, 0xfe, 0xcf, 0x7a, 0x25, 0x00, 0x0f, 0x05, 0x48, 0x9d, 0xec, 0xff,
+	0xff, 0xe6, 0x95, 0x40, 0x03, 0x00, 0x21, 0x3d, 0x92, 0xe6, 0xff, 0xfe, 0xdc, 0xdc, 0xdd, 0xff, 0xf1, 0xa0, 0x4b, 0x04, 0x00, 0x0b, 0x01, 0x3e,
+	0x93, 0xe7, 0xff, 0xf2, 0xd9, 0xd9, 0xe6, 0xff, 0xf0, 0x9e, 0x49, 0x03, 0x00, 0x0d, 0x04, 0x3b, 0x90, 0xe1, 0xff, 0xff, 0xed, 0xa3, 0x4e, 0x0b,
+	0x00, 0x0e, 0x52, 0xa7, 0xfc, 0xff, 0xff, 0xe4, 0x8f, 0x3a, 0x00, 0x1f, 0x0f, 0x4f, 0xa4, 0xea, 0xff, 0xe4, 0x99, 0x44, 0x0a, 0x00, 0x03, 0x2e,
+	0x83, 0xd8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x9f, 0x4a, 0x00, 0x1b, 0x54,
+	0xa9, 0xfe, 0xff, 0xff, 0xe3, 0x9a, 0x50, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+	0x35, 0x7e, 0xc8, 0xff, 0xff, 0xff, 0xc8, 0x73, 0x1e, 0x00, 0x06, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x11, 0x10, 0x65, 0xba,
+	0xff, 0xff, 0xff, 0xe1, 0x8c, 0x37, 0x00, 0x18, 0x01, 0x27, 0x77, 0xcb, 0xfa, 0xf8, 0xc5, 0x71, 0x22, 0x00, 0x0a, 0x02, 0x1f, 0x5a, 0xaa, 0xe3,
+	0xfa, 0xdf, 0xa4, 0x54, 0x1c, 0x02, 0x00, 0x08, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x07, 0x1e, 0x72, 0xc7, 0xfd, 0xff, 0xf6,
+	0xf3, 0xf3, 0xfc, 0xff, 0xd4, 0x7f, 0x2a, 0x00, 0x08, 0x44, 0x99, 0xee, 0xff, 0xff, 0xee, 0x99, 0x44, 0x00, 0x0a, 0x09, 0x41, 0x96, 0xe2, 0xff,
+	0xec, 0xa7, 0x52, 0x10, 0x00, 0x04, 0x30, 0x85, 0xda, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xf2, 0x9d, 0x48, 0x00, 0x08, 0x37, 0x8c, 0xe1, 0xff, 0xea, 0x96, 0x41, 0x00, 0x06, 0x28, 0x7d, 0xd2, 0xff, 0xf5, 0xa4, 0x4f, 0x03, 0x00,
+	0x0f, 0x19, 0x6a, 0xbf, 0xfb, 0xff, 0xfd, 0xc8, 0x73, 0x1f, 0x00, 0x11, 0x04, 0x43, 0x98, 0xe9, 0xff, 0xff, 0xec, 0x9d, 0x48, 0x06, 0x00, 0x20,
+	0x05, 0x4e, 0xa3, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xb3, 0x5e, 0x0d, 0x00, 0x0d, 0x05, 0x4e, 0xa3, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xb3,
+	0x5e, 0x0d, 0x00, 0x0d, 0x10, 0x59, 0xae, 0xf2, 0xff, 0xfe, 0xd8, 0x85, 0x31, 0x02, 0x00, 0x0f, 0x52, 0xa7, 0xfc, 0xff, 0xff, 0xf5, 0xd8, 0xba,
+	0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa5, 0x6e, 0x36, 0x00, 0x0c, 0x04, 0x34, 0x87, 0xd8, 0xfd,
+	0xf3, 0xb6, 0x61, 0x18, 0x00, 0x05, 0x02, 0x07, 0x0c, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x20, 0x70, 0xc0, 0xff, 0xff, 0xb7, 0x67,
+	0x17, 0x0e, 0x09, 0x04, 0x00, 0x1b, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x11, 0x16, 0x6b, 0xc0, 0xff, 0xff, 0xff, 0xc8, 0x73,
+	0x1e, 0x00, 0x06, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x10, 0x16, 0x5d, 0xb2, 0xf1, 0xff, 0xff, 0xfc, 0xb8, 0x63, 0x11, 0x00,
+	0x17, 0x14, 0x5b, 0xb0, 0xf0, 0xfe, 0xdc, 0x8e, 0x39, 0x06, 0x00, 0x09, 0x12, 0x46, 0x95, 0xd8, 0xf9, 0xfb, 0xde, 0xa6, 0x6d, 0x4e, 0x4a, 0x4a,
+	0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x3d, 0x24, 0x0c, 0x00, 0x01, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x08, 0x1c, 0x6f, 0xc4, 0xfd,
+	0xff, 0xff, 0xff, 0xfe, 0xd0, 0x7b, 0x26, 0x00, 0x09, 0x44, 0x99, 0xee, 0xff, 0xff, 0xee, 0x99, 0x44, 0x00, 0x08, 0x02, 0x29, 0x7a, 0xcd, 0xfb,
+	0xf8, 0xc3, 0x6f, 0x21, 0x00, 0x06, 0x02, 0x07, 0x0c, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x22, 0x72, 0xc2, 0xff, 0xff, 0xb5, 0x65,
+	0x15, 0x0e, 0x09, 0x04, 0x00, 0x07, 0x11, 0x66, 0xbb, 0xfe, 0xfe, 0xba, 0x65, 0x10, 0x00, 0x05, 0x09, 0x5a, 0xaf, 0xfb, 0xff, 0xc8, 0x73, 0x1e,
+	0x00, 0x0f, 0x1f, 0x73, 0xc8, 0xfd, 0xff, 0xfc, 0xc2, 0x6d, 0x1b, 0x00, 0x13, 0x02, 0x3d, 0x92, 0xe5, 0xff, 0xff, 0xf1, 0xa5, 0x50, 0x09, 0x00,
+	0x20, 0x0f, 0x60, 0xb5, 0xfb, 0xff, 0xff, 0xfe, 0xc6, 0x71, 0x1c, 0x00, 0x0f, 0x0d, 0x5e, 0xb3, 0xfa, 0xff, 0xff, 0xff, 0xc8, 0x73, 0x1e, 0x00,
+	0x0d, 0x23, 0x75, 0xca, 0xfc, 0xff, 0xf8, 0xbd, 0x68, 0x19, 0x00, 0x11, 0x52, 0xa7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xa9, 0x54, 0x00, 0x0b, 0x1e, 0x6b, 0xc0, 0xf6, 0xfb, 0xd0, 0x7d, 0x2b, 0x02,
+	0x00, 0x11, 0x12, 0x66, 0xba, 0xfc, 0xfc, 0xb0, 0x5c, 0x08, 0x00, 0x1e, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x11, 0x16, 0x6b,
+	0xc0, 0xff, 0xff, 0xff, 0xc8, 0x73, 0x1e, 0x00, 0x06, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x0e, 0x09, 0x41, 0x96, 0xe2, 0xff,
+	0xff, 0xfe, 0xe1, 0x97, 0x43, 0x0b, 0x00, 0x16, 0x08, 0x3f, 0x93, 0xe0, 0xfe, 0xed, 0xaa, 0x55, 0x12, 0x00, 0x0b, 0x42, 0x96, 0xea, 0xfc, 0xfc,
+	0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xd1, 0x7d, 0x29, 0x00, 0x01, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xbb, 0x66,
+	0x11, 0x00, 0x09, 0x19, 0x6b, 0xc0, 0xfc, 0xff, 0xfe, 0xcb, 0x76, 0x22, 0x00, 0x0a, 0x44, 0x99, 0xee, 0xff, 0xff, 0xee, 0x99, 0x44, 0x00, 0x07,
+	0x16, 0x5d, 0xb2, 0xf1, 0xfe, 0xda, 0x8b, 0x37, 0x05, 0x00, 0x12, 0x14, 0x68, 0xbc, 0xfc, 0xfc, 0xae, 0x5a, 0x06, 0x00, 0x0a, 0x3f, 0x94, 0xe9,
+	0xff, 0xde, 0x89, 0x34, 0x00, 0x06, 0x37, 0x8c, 0xe1, 0xff, 0xec, 0x97, 0x42, 0x00, 0x0f, 0x26, 0x7b, 0xd0, 0xfe, 0xff, 0xfb, 0xbc, 0x67, 0x16,
+	0x00, 0x15, 0x01, 0x39, 0x8e, 0xe1, 0xff, 0xff, 0xf5, 0xae, 0x59, 0x0e, 0x00, 0xcd, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x11,
+	0x16, 0x6b, 0xc0, 0xff, 0xff, 0xff, 0xc8, 0x73, 0x1e, 0x00, 0x06, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x09, 0x01, 0x12, 0x35,
+	0x69, 0xa1, 0xd2, 0xf2, 0xfe, 0xff, 0xff, 0xeb, 0xa9, 0x54, 0x12, 0x00, 0xed, 0x27, 0x64, 0xa1, 0xb7, 0xb7, 0xb7, 0x8c, 0x4f, 0x12, 0x00, 0x13,
+	0x0d, 0x49, 0x86, 0xb6, 0xb7, 0xb7, 0xa8, 0x6b, 0x2e, 0x00, 0x02, 0x3c, 0x79, 0xb6, 0xb7, 0xb7, 0xb7, 0xaf, 0x7f, 0x42, 0x0c, 0x00, 0x11, 0x0a,
+	0x47, 0x84, 0xb7, 0xb7, 0xb7, 0x7f, 0x42, 0x05, 0x00, 0x02, 0x1a, 0x56, 0x93, 0xb5, 0xb7, 0xb7, 0x9b, 0x5f, 0x22, 0x01, 0x00, 0x0e, 0x01, 0x25,
+	0x62, 0x9e, 0xb7, 0xb7, 0xb0, 0x81, 0x44, 0x0d, 0x00, 0x03, 0x24, 0x61, 0x9d, 0xb7, 0xb7, 0xb3, 0x84, 0x47, 0x0d, 0x00, 0x10, 0x09, 0x40, 0x7d,
+	0xb0, 0xb7, 0xb7, 0xa2, 0x66, 0x29, 0x01, 0x00, 0x14, 0x11, 0x4a, 0x8e, 0xc1, 0xcc, 0xcc, 0xcc, 0xa3, 0x5f, 0x1b, 0x00, 0x19, 0x54, 0xa9, 0xfe,
+	0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x11, 0x16, 0x6b, 0xc0, 0xff, 0xff, 0xff, 0xc8, 0x73, 0x1e, 0x00, 0x06, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xf2,
+	0xd1, 0xb0, 0x9c, 0x9c, 0x9c, 0xa0, 0xa9, 0xb6, 0xc3, 0xd1, 0xde, 0xec, 0xf7, 0xfd, 0xff, 0xff, 0xfe, 0xef, 0xce, 0x9d, 0x67, 0x33, 0x11, 0x00,
+	0x07, 0x3c, 0x79, 0xb6, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb6, 0xb0, 0xa6, 0x98, 0x8a, 0x7c, 0x6e, 0x60, 0x51, 0x37, 0x1c,
+	0x06, 0x00, 0x0c, 0x1c, 0x59, 0x96, 0xb7, 0xb7, 0xb7, 0x9f, 0x63, 0x26, 0x00, 0x10, 0x06, 0x39, 0x76, 0xad, 0xb7, 0xb7, 0xb0, 0x7d, 0x40, 0x09,
+	0x00, 0x01, 0x18, 0x55, 0x92, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7,
+	0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0x96, 0x59, 0x1c, 0x00, 0x01, 0x11, 0x4e, 0x8b, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7,
+	0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0x80, 0x43, 0x06, 0x00, 0x01,
+	0x3c, 0x79, 0xb6, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb6, 0xb2, 0xac, 0xa4, 0x9d, 0x95, 0x8e, 0x81, 0x6b, 0x4e, 0x2d, 0x13,
+	0x04, 0x00, 0x08, 0x3c, 0x79, 0xb6, 0xb7, 0xb7, 0xa0, 0x63, 0x26, 0x00, 0x0d, 0x0b, 0x39, 0x76, 0xa7, 0xb7, 0xb7, 0xb2, 0x8f, 0x53, 0x1b, 0x01,
+	0x00, 0x1b, 0x03, 0x42, 0x97, 0xe9, 0xff, 0xff, 0xf9, 0xb3, 0x5e, 0x0f, 0x00, 0x11, 0x0b, 0x56, 0xab, 0xf5, 0xff, 0xff, 0xef, 0xa1, 0x4c, 0x07,
+	0x00, 0x02, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xd8, 0x89, 0x36, 0x06, 0x00, 0x0f, 0x0e, 0x63, 0xb8, 0xff, 0xff, 0xff, 0xb1, 0x5c,
+	0x07, 0x00, 0x03, 0x0d, 0x48, 0x9d, 0xe5, 0xff, 0xff, 0xef, 0xb1, 0x5c, 0x16, 0x00, 0x0c, 0x1a, 0x62, 0xb7, 0xf2, 0xff, 0xfc, 0xd3, 0x83, 0x31,
+	0x05, 0x00, 0x05, 0x20, 0x70, 0xc5, 0xfa, 0xff, 0xfb, 0xc9, 0x74, 0x22, 0x00, 0x0e, 0x1c, 0x6b, 0xc0, 0xf9, 0xff, 0xfb, 0xca, 0x76, 0x25, 0x00,
+	0x14, 0x11, 0x4d, 0xa2, 0xe5, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xcb, 0x76, 0x21, 0x00, 0x19, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00,
+	0x11, 0x16, 0x6b, 0xc0, 0xff, 0xff, 0xff, 0xc8, 0x73, 0x1e, 0x00, 0x06, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
+	0xf6, 0xec, 0xde, 0xd1, 0xc4, 0xb6, 0xa9, 0x9c, 0x89, 0x6a, 0x3e, 0x18, 0x03, 0x00, 0x0b, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xfb, 0xf1, 0xe7, 0xe1,
+	0xe1, 0xe1, 0xe1, 0xe5, 0xed, 0xf7, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf2, 0xd4, 0xa4, 0x6c, 0x38, 0x13, 0x02, 0x00, 0x08, 0x19, 0x65,
+	0xba, 0xf6, 0xff, 0xff, 0xe6, 0x98, 0x43, 0x07, 0x00, 0x0d, 0x15, 0x60, 0xb5, 0xf5, 0xff, 0xff, 0xe3, 0x95, 0x40, 0x07, 0x00, 0x02, 0x1f, 0x6e,
+	0xbe, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf2, 0xf8, 0xfd, 0xff, 0xff, 0xfe, 0xf8, 0xf3, 0xee, 0xee, 0xee, 0xee, 0xee,
+	0xee, 0xee, 0xee, 0xee, 0xee, 0xc4, 0x74, 0x25, 0x00, 0x01, 0x17, 0x68, 0xb9, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3,
+	0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf5, 0xf9, 0xfd, 0xff, 0xff, 0xfd, 0xaf, 0x5a, 0x07, 0x00, 0x01, 0x54, 0xa9, 0xfe, 0xff,
+	0xff, 0xfb, 0xf1, 0xe7, 0xe1, 0xe1, 0xe1, 0xe1, 0xe2, 0xe9, 0xf3, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xd6, 0x94, 0x46, 0x13,
+	0x00, 0x05, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x0b, 0x19, 0x56, 0xa9, 0xe5, 0xfe, 0xff, 0xef, 0xbc, 0x6b, 0x26, 0x04, 0x00,
+	0x1e, 0x03, 0x42, 0x97, 0xe9, 0xff, 0xff, 0xf7, 0xb0, 0x5b, 0x0d, 0x00, 0x0f, 0x09, 0x52, 0xa7, 0xf3, 0xff, 0xff, 0xef, 0xa1, 0x4c, 0x06, 0x00,
+	0x03, 0x54, 0xa9, 0xfe, 0xff, 0xfa, 0xf9, 0xf9, 0xfe, 0xff, 0xf9, 0xca, 0x77, 0x27, 0x02, 0x00, 0x0d, 0x0e, 0x63, 0xb8, 0xff, 0xff, 0xff, 0xb1,
+	0x5c, 0x07, 0x00, 0x05, 0x15, 0x58, 0xad, 0xed, 0xff, 0xff, 0xe6, 0x9e, 0x49, 0x0d, 0x00, 0x08, 0x10, 0x50, 0xa5, 0xe9, 0xff, 0xfe, 0xdd, 0x92,
+	0x3e, 0x09, 0x00, 0x08, 0x09, 0x47, 0x9c, 0xe7, 0xff, 0xff, 0xe4, 0x95, 0x40, 0x06, 0x00, 0x0a, 0x04, 0x38, 0x8d, 0xde, 0xff, 0xff, 0xe9, 0xa0,
+	0x4b, 0x0b, 0x00, 0x13, 0x12, 0x4f, 0xa4, 0xe6, 0xff, 0xe1, 0xc3, 0xc3, 0xe1, 0xff, 0xff, 0xcb, 0x76, 0x21, 0x00, 0x19, 0x54, 0xa9, 0xfe, 0xff,
+	0xff, 0xdf, 0x8a, 0x35, 0x00, 0x11, 0x16, 0x6b, 0xc0, 0xff, 0xff, 0xff, 0xc8, 0x73, 0x1e, 0x00, 0x2a, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a,
+	0x35, 0x00, 0x06, 0x03, 0x0a, 0x16, 0x24, 0x39, 0x5c, 0x8d, 0xc3, 0xe9, 0xfc, 0xff, 0xff, 0xfc, 0xdc, 0x90, 0x3d, 0x09, 0x00, 0x07, 0x06, 0x3c,
+	0x91, 0xe0, 0xff, 0xff, 0xf6, 0xb7, 0x62, 0x16, 0x00, 0x0a, 0x01, 0x2c, 0x80, 0xd4, 0xfe, 0xff, 0xf8, 0xc0, 0x6b, 0x1d, 0x00, 0x11, 0x41, 0x96,
+	0xeb, 0xff, 0xff, 0xf4, 0x9f, 0x4a, 0x00, 0x24, 0x19, 0x68, 0xbd, 0xf9, 0xff, 0xf7, 0xb6, 0x61, 0x14, 0x00, 0x02, 0x54, 0xa9, 0xfe, 0xff, 0xff,
+	0xdf, 0x8a, 0x35, 0x00, 0x06, 0x03, 0x0c, 0x1b, 0x2d, 0x3f, 0x54, 0x8c, 0xc6, 0xf7, 0xff, 0xff, 0xff, 0xee, 0x9b, 0x46, 0x02, 0x00, 0x03, 0x54,
+	0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x08, 0x06, 0x2e, 0x78, 0xc6, 0xf4, 0xff, 0xfc, 0xdc, 0x9a, 0x48, 0x12, 0x00, 0x22, 0x03, 0x42,
+	0x97, 0xe9, 0xff, 0xff, 0xf5, 0xab, 0x56, 0x0b, 0x00, 0x0d, 0x07, 0x4f, 0xa4, 0xf1, 0xff, 0xff, 0xef, 0xa1, 0x4c, 0x06, 0x00, 0x04, 0x54, 0xa9,
+	0xfe, 0xff, 0xeb, 0xa5, 0x8e, 0xa2, 0xe8, 0xff, 0xff, 0xf3, 0xb9, 0x64, 0x1b, 0x00, 0x0c, 0x0e, 0x63, 0xb8, 0xff, 0xff, 0xff, 0xb1, 0x5c, 0x07,
+	0x00, 0x07, 0x1e, 0x68, 0xbc, 0xf4, 0xff, 0xfd, 0xda, 0x8c, 0x38, 0x07, 0x00, 0x04, 0x09, 0x3f, 0x93, 0xdf, 0xfe, 0xff, 0xe7, 0xa1, 0x4c, 0x0f,
+	0x00, 0x0c, 0x22, 0x73, 0xc8, 0xfb, 0xff, 0xf5, 0xb6, 0x61, 0x15, 0x00, 0x08, 0x12, 0x5a, 0xaf, 0xf2, 0xff, 0xfb, 0xc9, 0x75, 0x24, 0x00, 0x13,
+	0x13, 0x51, 0xa6, 0xe7, 0xff, 0xf4, 0xbb, 0x66, 0x58, 0x91, 0xe6, 0xff, 0xff, 0xcb, 0x76, 0x21, 0x00, 0x3c, 0x3c, 0x79, 0xb6, 0xb7, 0xb7, 0xb7,
+	0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb4, 0xaf, 0xa6, 0x9d, 0x93, 0x8a, 0x80, 0x6f, 0x53, 0x2e, 0x12, 0x02, 0x00, 0x12, 0x54, 0xa9, 0xfe, 0xff, 0xff,
+	0xdf, 0x8a, 0x35, 0x00, 0x0d, 0x02, 0x15, 0x54, 0xa7, 0xe9, 0xff, 0xff, 0xfb, 0xd1, 0x80, 0x2f, 0x04, 0x00, 0x07, 0x1b, 0x68, 0xbd, 0xf7, 0xff,
+	0xfe, 0xd5, 0x81, 0x2d, 0x01, 0x00, 0x07, 0x0a, 0x4c, 0xa1, 0xeb, 0xff, 0xff, 0xe3, 0x96, 0x41, 0x07, 0x00, 0x12, 0x41, 0x96, 0xeb, 0xff, 0xff,
+	0xf4, 0x9f, 0x4a, 0x00, 0x22, 0x01, 0x2d, 0x81, 0xd5, 0xfe, 0xff, 0xec, 0xa0, 0x4b, 0x09, 0x00, 0x03, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a,
+	0x35, 0x00, 0x0c, 0x08, 0x46, 0x9b, 0xe8, 0xff, 0xff, 0xff, 0xd2, 0x7d, 0x28, 0x00, 0x03, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00,
+	0x06, 0x12, 0x48, 0x9a, 0xdd, 0xfc, 0xff, 0xf2, 0xc2, 0x73, 0x2b, 0x06, 0x00, 0x25, 0x03, 0x42, 0x97, 0xe9, 0xff, 0xff, 0xf4, 0xa8, 0x53, 0x09,
+	0x00, 0x0b, 0x05, 0x4b, 0xa0, 0xef, 0xff, 0xff, 0xef, 0xa1, 0x4c, 0x06, 0x00, 0x05, 0x54, 0xa9, 0xfe, 0xff, 0xfa, 0xa5, 0x50, 0x19, 0x60, 0xb5,
+	0xf1, 0xff, 0xff, 0xea, 0xa7, 0x52, 0x11, 0x00, 0x0a, 0x0e, 0x63, 0xb8, 0xff, 0xff, 0xff, 0xb1, 0x5c, 0x07, 0x00, 0x08, 0x02, 0x28, 0x78, 0xca,
+	0xf9, 0xff, 0xfa, 0xcc, 0x79, 0x29, 0x02, 0x04, 0x30, 0x82, 0xd2, 0xfb, 0xff, 0xee, 0xaf, 0x5a, 0x16, 0x00, 0x0f, 0x0b, 0x4a, 0x9f, 0xe9, 0xff,
+	0xfe, 0xd5, 0x82, 0x2e, 0x01, 0x00, 0x04, 0x01, 0x29, 0x7d, 0xd1, 0xfd, 0xff, 0xe9, 0x9f, 0x4a, 0x0b, 0x00, 0x12, 0x14, 0x53, 0xa8, 0xe8, 0xff,
+	0xf3, 0xc0, 0x6c, 0x23, 0x01, 0x45, 0x9a, 0xef, 0xff, 0xff, 0xcb, 0x76, 0x21, 0x00, 0x23, 0x0b, 0x26, 0x51, 0x7f, 0xa1, 0xb7, 0xc5, 0xd2, 0xdd,
+	0xdf, 0xda, 0xd0, 0xc5, 0xbb, 0xad, 0x98, 0x7b, 0x5c, 0x38, 0x1a, 0x06, 0x00, 0x04, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xfb, 0xf1, 0xe7, 0xe1, 0xe1,
+	0xe1, 0xe4, 0xea, 0xf2, 0xf9, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf2, 0xd7, 0x9b, 0x52, 0x18, 0x00, 0x0f, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf,
+	0x8a, 0x35, 0x00, 0x10, 0x1e, 0x6b, 0xc0, 0xf7, 0xff, 0xff, 0xf6, 0xae, 0x59, 0x0c, 0x00, 0x07, 0x07, 0x3f, 0x94, 0xe2, 0xff, 0xff, 0xeb, 0xa0,
+	0x4b, 0x0a, 0x00, 0x05, 0x1c, 0x6c, 0xc1, 0xf9, 0xff, 0xf8, 0xc0, 0x6b, 0x1d, 0x00, 0x14, 0x41, 0x96, 0xeb, 0xff, 0xff, 0xf4, 0x9f, 0x4a, 0x00,
+	0x21, 0x07, 0x46, 0x9b, 0xe9, 0xff, 0xff, 0xdc, 0x89, 0x34, 0x02, 0x00, 0x04, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x0d, 0x0d,
+	0x62, 0xb7, 0xff, 0xff, 0xff, 0xd5, 0x80, 0x2b, 0x00, 0x03, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x03, 0x03, 0x24, 0x68, 0xba,
+	0xee, 0xff, 0xfd, 0xe1, 0xa2, 0x4f, 0x16, 0x00, 0x29, 0x03, 0x42, 0x97, 0xe9, 0xff, 0xff, 0xf1, 0xa4, 0x4f, 0x07, 0x00, 0x09, 0x04, 0x47, 0x9c,
+	0xec, 0xff, 0xff, 0xef, 0xa0, 0x4b, 0x06, 0x00, 0x06, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xb1, 0x5c, 0x07, 0x01, 0x24, 0x72, 0xc6, 0xf8, 0xff, 0xfe,
+	0xe0, 0x95, 0x40, 0x0a, 0x00, 0x08, 0x0e, 0x63, 0xb8, 0xff, 0xff, 0xff, 0xb1, 0x5c, 0x07, 0x00, 0x0a, 0x06, 0x35, 0x87, 0xd6, 0xfc, 0xff, 0xf4,
+	0xbc, 0x89, 0x8c, 0xc4, 0xf7, 0xff, 0xf4, 0xbe, 0x6a, 0x1f, 0x00, 0x13, 0x25, 0x77, 0xcb, 0xfb, 0xff, 0xec, 0xa3, 0x4e, 0x0b, 0x00, 0x02, 0x0a,
+	0x4a, 0x9f, 0xea, 0xff, 0xfb, 0xc9, 0x74, 0x23, 0x00, 0x12, 0x15, 0x55, 0xaa, 0xe9, 0xff, 0xf2, 0xbd, 0x6a, 0x21, 0x01, 0x00, 0x02, 0x4c, 0xa1,
+	0xf6, 0xff, 0xff, 0xcb, 0x76, 0x21, 0x00, 0x20, 0x05, 0x2e, 0x7a, 0xca, 0xf6, 0xff, 0xff, 0xfc, 0xec, 0xd4, 0xba, 0xab, 0xa8, 0xad, 0xba, 0xc7,
+	0xd9, 0xeb, 0xfa, 0xff, 0xe3, 0x93, 0x3e, 0x05, 0x00, 0x04, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x06, 0x01, 0x0a, 0x20, 0x41,
+	0x6f, 0xac, 0xdf, 0xfd, 0xff, 0xff, 0xf0, 0xb4, 0x5f, 0x18, 0x00, 0x0d, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x11, 0x13, 0x68,
+	0xbd, 0xff, 0xff, 0xff, 0xdd, 0x88, 0x33, 0x00, 0x09, 0x1d, 0x6c, 0xc1, 0xf8, 0xff, 0xf9, 0xbf, 0x6a, 0x1b, 0x00, 0x02, 0x03, 0x37, 0x8c, 0xde,
+	0xff, 0xff, 0xe3, 0x96, 0x41, 0x07, 0x00, 0x15, 0x41, 0x96, 0xeb, 0xff, 0xff, 0xf4, 0x9f, 0x4a, 0x00, 0x20, 0x14, 0x60, 0xb5, 0xf6, 0xff, 0xfc,
+	0xc8, 0x73, 0x20, 0x00, 0x06, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x0b, 0x01, 0x1a, 0x60, 0xb4, 0xef, 0xff, 0xfd, 0xd6, 0x85,
+	0x32, 0x03, 0x00, 0x03, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x01, 0x0c, 0x3b, 0x8b, 0xd3, 0xf9, 0xff, 0xf5, 0xc9, 0x7c, 0x31,
+	0x08, 0x00, 0x2c, 0x03, 0x42, 0x97, 0xe9, 0xff, 0xff, 0xef, 0xa0, 0x4b, 0x06, 0x00, 0x07, 0x03, 0x43, 0x98, 0xea, 0xff, 0xff, 0xef, 0xa0, 0x4b,
+	0x06, 0x00, 0x07, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xb8, 0x63, 0x0e, 0x00, 0x02, 0x05, 0x32, 0x85, 0xd5, 0xfc, 0xff, 0xfc, 0xd3, 0x82, 0x30, 0x04,
+	0x00, 0x06, 0x0e, 0x63, 0xb8, 0xff, 0xff, 0xff, 0xb1, 0x5c, 0x07, 0x00, 0x0c, 0x0b, 0x43, 0x98, 0xe1, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xcb,
+	0x78, 0x29, 0x02, 0x00, 0x15, 0x0c, 0x4e, 0xa3, 0xeb, 0xff, 0xfa, 0xc4, 0x6f, 0x1e, 0x1d, 0x6d, 0xc2, 0xf9, 0xff, 0xe9, 0x9f, 0x4a, 0x0b, 0x00,
+	0x11, 0x16, 0x57, 0xac, 0xea, 0xff, 0xf2, 0xbc, 0x68, 0x20, 0x01, 0x00, 0x04, 0x4e, 0xa3, 0xf8, 0xff, 0xff, 0xcb, 0x76, 0x21, 0x00, 0x1f, 0x0f,
+	0x60, 0xb5, 0xfa, 0xff, 0xff, 0xe9, 0xa9, 0x56, 0x17, 0x02, 0x00, 0x07, 0x06, 0x17, 0x2d, 0x27, 0x16, 0x00, 0x06, 0x54, 0xa9, 0xfe, 0xff, 0xff,
+	0xdf, 0x8a, 0x35, 0x00, 0x0b, 0x09, 0x52, 0xa7, 0xf3, 0xff, 0xff, 0xf8, 0xa7, 0x52, 0x04, 0x00, 0x0c, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a,
+	0x35, 0x00, 0x12, 0x46, 0x9b, 0xf0, 0xff, 0xff, 0xfc, 0xb0, 0x5b, 0x08, 0x00, 0x09, 0x08, 0x43, 0x98, 0xe5, 0xff, 0xff, 0xdb, 0x89, 0x34, 0x13,
+	0x58, 0xad, 0xf1, 0xff, 0xf8, 0xc1, 0x6c, 0x1d, 0x00, 0x17, 0x41, 0x96, 0xeb, 0xff, 0xff, 0xf4, 0x9f, 0x4a, 0x00, 0x1f, 0x26, 0x7a, 0xce, 0xfd,
+	0xff, 0xf5, 0xb2, 0x5d, 0x11, 0x00, 0x07, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xee, 0xc2, 0x95, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7b, 0x7f, 0x87, 0x90,
+	0x9c, 0xb2, 0xd2, 0xee, 0xf7, 0xec, 0xcc, 0x9b, 0x5d, 0x28, 0x09, 0x00, 0x05, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x48, 0x4e, 0xa2, 0xe4,
+	0xfe, 0xff, 0xf6, 0xbb, 0x67, 0x1b, 0x01, 0x00, 0x2f, 0x03, 0x42, 0x97, 0xe9, 0xff, 0xff, 0xed, 0x9c, 0x47, 0x04, 0x00, 0x05, 0x02, 0x3f, 0x94,
+	0xe7, 0xff, 0xff, 0xee, 0xa0, 0x4b, 0x06, 0x00, 0x08, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x04, 0x0a, 0x42, 0x97, 0xe1, 0xfe,
+	0xff, 0xf7, 0xc4, 0x70, 0x23, 0x01, 0x00, 0x04, 0x0e, 0x63, 0xb8, 0xff, 0xff, 0xff, 0xb1, 0x5c, 0x07, 0x00, 0x0d, 0x07, 0x46, 0x9b, 0xe9, 0xff,
+	0xff, 0xff, 0xff, 0xda, 0x89, 0x34, 0x03, 0x00, 0x17, 0x01, 0x28, 0x7a, 0xce, 0xfc, 0xff, 0xe0, 0xc1, 0xc1, 0xdf, 0xff, 0xfa, 0xc8, 0x74, 0x23,
+	0x00, 0x11, 0x17, 0x59, 0xae, 0xeb, 0xff, 0xf1, 0xb9, 0x65, 0x1e, 0x01, 0x00, 0x06, 0x4e, 0xa3, 0xf8, 0xff, 0xff, 0xcb, 0x76, 0x21, 0x00, 0x1f,
+	0x3d, 0x92, 0xe7, 0xff, 0xff, 0xf3, 0x9f, 0x4a, 0x00, 0x15, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x0c, 0x27, 0x7c, 0xd1, 0xff,
+	0xff, 0xff, 0xc7, 0x72, 0x1d, 0x00, 0x0c, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x12, 0x2b, 0x80, 0xd5, 0xff, 0xff, 0xff, 0xce,
+	0x79, 0x24, 0x00, 0x0b, 0x1f, 0x6f, 0xc4, 0xf9, 0xff, 0xef, 0xc4, 0xc2, 0xd1, 0xfc, 0xff, 0xe4, 0x96, 0x41, 0x07, 0x00, 0x18, 0x41, 0x96, 0xeb,
+	0xff, 0xff, 0xf4, 0x9f, 0x4a, 0x00, 0x1d, 0x05, 0x3f, 0x94, 0xe4, 0xff, 0xff, 0xe9, 0x9b, 0x46, 0x07, 0x00, 0x08, 0x54, 0xa9, 0xfe, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xed, 0xcc, 0xa1, 0x7e, 0x5e, 0x39, 0x18, 0x04, 0x00, 0x06,
+	0x54, 0xa9, 0xfe, 0xff, 0xff, 0xed, 0xd9, 0xd9, 0xeb, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xef, 0xb4, 0x5f, 0x1a, 0x00, 0x30, 0x03, 0x43, 0x98, 0xe9,
+	0xff, 0xff, 0xea, 0x98, 0x43, 0x03, 0x00, 0x03, 0x01, 0x3b, 0x90, 0xe4, 0xff, 0xff, 0xee, 0x9f, 0x4a, 0x06, 0x00, 0x09, 0x54, 0xa9, 0xfe, 0xff,
+	0xff, 0xbb, 0x66, 0x11, 0x00, 0x06, 0x13, 0x55, 0xaa, 0xec, 0xff, 0xff, 0xf0, 0xb3, 0x5e, 0x17, 0x00, 0x03, 0x0e, 0x63, 0xb8, 0xff, 0xff, 0xff,
+	0xb1, 0x5c, 0x07, 0x00, 0x0b, 0x02, 0x2a, 0x7a, 0xcc, 0xfa, 0xff, 0xed, 0xe8, 0xe8, 0xfa, 0xff, 0xf6, 0xc1, 0x6c, 0x20, 0x00, 0x11, 0x3e, 0x92,
+	0xe6, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xec, 0x98, 0x44,
+	0x00, 0x09, 0x18, 0x5b, 0xb0, 0xec, 0xff, 0xf0, 0xb7, 0x63, 0x1d, 0x00, 0x09, 0x4e, 0xa3, 0xf8, 0xff, 0xff, 0xcb, 0x76, 0x21, 0x00, 0x1f, 0x4d,
+	0xa2, 0xf7, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x15, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x0b, 0x03, 0x46, 0x9b, 0xed, 0xff,
+	0xff, 0xf7, 0xa6, 0x51, 0x03, 0x00, 0x0c, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x12, 0x43, 0x98, 0xed, 0xff, 0xff, 0xfd, 0xb2,
+	0x5d, 0x09, 0x00, 0x0c, 0x09, 0x46, 0x9b, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xc1, 0x6c, 0x1d, 0x00, 0x1a, 0x41, 0x96, 0xeb, 0xff, 0xff, 0xf4,
+	0x9f, 0x4a, 0x00, 0x1c, 0x0f, 0x58, 0xad, 0xf3, 0xff, 0xff, 0xd8, 0x85, 0x30, 0x01, 0x00, 0x09, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xe2, 0x95, 0x48,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x19, 0x1d, 0x25, 0x2f, 0x39, 0x4a, 0x66, 0x8e, 0xc0, 0xe6, 0xfc, 0xfe, 0xf1, 0xca, 0x7e, 0x36, 0x08, 0x00, 0x03,
+	0x54, 0xa9, 0xfe, 0xff, 0xff, 0xff, 0xf5, 0xd3, 0x9b, 0x56, 0x3e, 0x68, 0xb6, 0xf0, 0xff, 0xff, 0xed, 0xb0, 0x5b, 0x18, 0x00, 0x2f, 0x03, 0x43,
+	0x98, 0xe9, 0xff, 0xff, 0xe7, 0x94, 0x3f, 0x01, 0x00, 0x02, 0x37, 0x8c, 0xe0, 0xff, 0xff, 0xee, 0x9f, 0x4a, 0x06, 0x00, 0x0a, 0x54, 0xa9, 0xfe,
+	0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x08, 0x1d, 0x67, 0xbc, 0xf4, 0xff, 0xff, 0xe7, 0xa0, 0x4b, 0x0e, 0x00, 0x01, 0x0a, 0x5f, 0xb4, 0xff, 0xff,
+	0xff, 0xb1, 0x5c, 0x07, 0x00, 0x0a, 0x1d, 0x67, 0xbc, 0xf4, 0xff, 0xf4, 0xbc, 0x67, 0x25, 0x3f, 0x94, 0xe0, 0xfe, 0xff, 0xee, 0xae, 0x59, 0x15,
+	0x00, 0x0f, 0x19, 0x3a, 0x5b, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x85, 0xb9, 0xed, 0xff, 0xff, 0xf0, 0xbd, 0x89, 0x64, 0x64, 0x64, 0x64, 0x64,
+	0x64, 0x5d, 0x3c, 0x1b, 0x00, 0x07, 0x1a, 0x5d, 0xb2, 0xed, 0xff, 0xef, 0xb5, 0x60, 0x1b, 0x00, 0x0b, 0x4e, 0xa3, 0xf8, 0xff, 0xff, 0xcb, 0x76,
+	0x21, 0x00, 0x1f, 0x4d, 0xa2, 0xf7, 0xff, 0xff, 0xde, 0x89, 0x34, 0x00, 0x15, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x08, 0x05,
+	0x18, 0x40, 0x88, 0xca, 0xf7, 0xff, 0xff, 0xe4, 0x9b, 0x46, 0x0b, 0x00, 0x0d, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x11, 0x10,
+	0x65, 0xba, 0xff, 0xff, 0xff, 0xe1, 0x8c, 0x37, 0x00, 0x0f, 0x36, 0x8b, 0xdf, 0xff, 0xff, 0xff, 0xb8, 0x63, 0x0e, 0x00, 0x1b, 0x41, 0x96, 0xeb,
+	0xff, 0xff, 0xf4, 0x9f, 0x4a, 0x00, 0x1b, 0x20, 0x72, 0xc7, 0xfc, 0xff, 0xfb, 0xc3, 0x6e, 0x1d, 0x00, 0x0b, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf,
+	0x8a, 0x35, 0x00, 0x0d, 0x09, 0x42, 0x97, 0xe2, 0xff, 0xff, 0xfc, 0xc2, 0x6d, 0x1b, 0x00, 0x02, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xe1, 0x8c, 0x37,
+	0x00, 0x04, 0x1e, 0x67, 0xbb, 0xf2, 0xff, 0xff, 0xeb, 0xad, 0x58, 0x16, 0x00, 0x2e, 0x03, 0x43, 0x98, 0xe9, 0xff, 0xff, 0xde, 0x89, 0x34, 0x00,
+	0x01, 0x2e, 0x83, 0xd8, 0xff, 0xff, 0xee, 0x9f, 0x4a, 0x06, 0x00, 0x0b, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x09, 0x02, 0x2a,
+	0x7a, 0xcc, 0xfa, 0xff, 0xfe, 0xdb, 0x8e, 0x3a, 0x08, 0x54, 0xa9, 0xfd, 0xff, 0xff, 0xb1, 0x5c, 0x07, 0x00, 0x08, 0x12, 0x54, 0xa9, 0xec, 0xff,
+	0xfb, 0xd0, 0x7e, 0x2c, 0x03, 0x00, 0x02, 0x15, 0x5b, 0xb0, 0xf0, 0xff, 0xff, 0xe4, 0x9b, 0x46, 0x0c, 0x00, 0x0d, 0x01, 0x02, 0x03, 0x04, 0x04,
+	0x04, 0x04, 0x04, 0x04, 0x3a, 0x8e, 0xe2, 0xff, 0xff, 0xe7, 0x94, 0x40, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x03, 0x02, 0x01, 0x00, 0x06, 0x19,
+	0x6e, 0xc3, 0xff, 0xff, 0xff, 0xfd, 0xfa, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xfa, 0xfc, 0xfe, 0xff,
+	0xff, 0xfd, 0xfb, 0xf9, 0xf8, 0xf8, 0xf8, 0xea, 0x97, 0x44, 0x00, 0x19, 0x4d, 0xa2, 0xf7, 0xff, 0xff, 0xde, 0x89, 0x34, 0x00, 0x15, 0x54, 0xa9,
+	0xfe, 0xff, 0xff, 0xf4, 0xd8, 0xbc, 0xab, 0xab, 0xab, 0xae, 0xb4, 0xbd, 0xc6, 0xd3, 0xe6, 0xf6, 0xff, 0xff, 0xfb, 0xe6, 0xb8, 0x76, 0x36, 0x0f,
+	0x00, 0x0f, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x10, 0x16, 0x5d, 0xb2, 0xf1, 0xff, 0xff, 0xfc, 0xb8, 0x63, 0x11, 0x00, 0x0f,
+	0x2d, 0x82, 0xd7, 0xff, 0xff, 0xff, 0xb4, 0x5f, 0x0a, 0x00, 0x1b, 0x41, 0x96, 0xeb, 0xff, 0xff, 0xf4, 0x9f, 0x4a, 0x00, 0x19, 0x03, 0x37, 0x8c,
+	0xde, 0xff, 0xff, 0xf3, 0xad, 0x58, 0x0f, 0x00, 0x0c, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x0e, 0x05, 0x59, 0xae, 0xfd, 0xff,
+	0xff, 0xf1, 0x9c, 0x47, 0x00, 0x02, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x05, 0x01, 0x22, 0x6c, 0xc0, 0xf4, 0xff, 0xff, 0xea,
+	0xa9, 0x54, 0x14, 0x00, 0x2d, 0x03, 0x43, 0x98, 0xe9, 0xff, 0xff, 0xcf, 0x7a, 0x48, 0x77, 0xcc, 0xff, 0xff, 0xee, 0x9e, 0x49, 0x05, 0x00, 0x0c,
+	0x54, 0xa9, 0xfe, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x0b, 0x07, 0x38, 0x8c, 0xda, 0xfd, 0xff, 0xfa, 0xcd, 0x7b, 0x73, 0xa0, 0xf2, 0xff, 0xff,
+	0xb1, 0x5c, 0x07, 0x00, 0x06, 0x0a, 0x42, 0x97, 0xe1, 0xfe, 0xfe, 0xe0, 0x94, 0x40, 0x09, 0x00, 0x05, 0x01, 0x26, 0x77, 0xca, 0xfa, 0xff, 0xfd,
+	0xd7, 0x88, 0x35, 0x06, 0x00, 0x0b, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x9a, 0x45, 0x00, 0x06, 0x12, 0x4d, 0x88, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2,
+	0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xc9, 0xe3, 0xfd, 0xff, 0xff, 0xef, 0xd5, 0xbc, 0xb2, 0xb2, 0xb2, 0xa8, 0x6c, 0x31, 0x00, 0x13, 0x46,
+	0x95, 0xe5, 0xee, 0xee, 0xee, 0xf3, 0xf8, 0xfe, 0xff, 0xff, 0xfd, 0xf7, 0xf1, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xec, 0x9c, 0x4d,
+	0x00, 0x0a, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xfc, 0xf5, 0xee, 0xea, 0xea, 0xea, 0xea, 0xec, 0xf3, 0xfa, 0xff, 0xff, 0xfd, 0xd0, 0x85, 0x33, 0x0b,
+	0x00, 0x13, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x0e, 0x09, 0x41, 0x96, 0xe2, 0xff, 0xff, 0xfe, 0xe1, 0x97, 0x43, 0x0b, 0x00,
+	0x10, 0x2d, 0x82, 0xd7, 0xff, 0xff, 0xff, 0xb4, 0x5f, 0x0a, 0x00, 0x1b, 0x41, 0x96, 0xeb, 0xff, 0xff, 0xf4, 0x9f, 0x4a, 0x00, 0x18, 0x0c, 0x51,
+	0xa6, 0xef, 0xff, 0xff, 0xe6, 0x96, 0x41, 0x05, 0x00, 0x0d, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x0e, 0x1a, 0x6f, 0xc4, 0xff,
+	0xff, 0xff, 0xdb, 0x86, 0x31, 0x00, 0x02, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x07, 0x02, 0x25, 0x71, 0xc4, 0xf6, 0xff, 0xff,
+	0xe8, 0xa6, 0x51, 0x13, 0x00, 0x2c, 0x03, 0x43, 0x98, 0xe9, 0xff, 0xfd, 0xc7, 0xc4, 0xc6, 0xfc, 0xff, 0xed, 0x9e, 0x49, 0x05, 0x00, 0x0d, 0x54,
+	0xa9, 0xfe, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x0d, 0x0d, 0x49, 0x9e, 0xe6, 0xff, 0xff, 0xf5, 0xec, 0xec, 0xf6, 0xff, 0xff, 0xb1, 0x5c, 0x07,
+	0x00, 0x04, 0x04, 0x31, 0x84, 0xd4, 0xfc, 0xff, 0xed, 0xab, 0x56, 0x13, 0x00, 0x09, 0x08, 0x3e, 0x92, 0xdf, 0xfe, 0xff, 0xf9, 0xc9, 0x75, 0x26,
+	0x01, 0x00, 0x09, 0x17, 0x35, 0x54, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x7f, 0xb6, 0xec, 0xff, 0xff, 0xf0, 0xb9, 0x83, 0x5c, 0x5c, 0x5c, 0x5c,
+	0x5c, 0x5c, 0x56, 0x37, 0x19, 0x00, 0x1b, 0x4e, 0xa3, 0xf8, 0xff, 0xff, 0xcb, 0x76, 0x21, 0x00, 0x19, 0x21, 0x47, 0x6d, 0x72, 0x72, 0x72, 0x9c,
+	0xcb, 0xfa, 0xff, 0xff, 0xed, 0xbe, 0x8f, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x71, 0x4b, 0x25, 0x00, 0x0a, 0x54, 0xa9, 0xfe, 0xff,
+	0xff, 0xdf, 0x8a, 0x35, 0x00, 0x04, 0x02, 0x2a, 0x7a, 0xcd, 0xfa, 0xff, 0xfe, 0xde, 0x93, 0x3f, 0x09, 0x00, 0x12, 0x54, 0xa9, 0xfe, 0xff, 0xff,
+	0xdf, 0x8a, 0x35, 0x00, 0x09, 0x01, 0x12, 0x35, 0x69, 0xa1, 0xd2, 0xf2, 0xfe, 0xff, 0xff, 0xeb, 0xa9, 0x54, 0x12, 0x00, 0x12, 0x2d, 0x82, 0xd7,
+	0xff, 0xff, 0xff, 0xb4, 0x5f, 0x0a, 0x00, 0x1b, 0x41, 0x96, 0xeb, 0xff, 0xff, 0xf4, 0x9f, 0x4a, 0x00, 0x17, 0x1a, 0x6a, 0xbf, 0xfa, 0xff, 0xfe,
+	0xd4, 0x80, 0x2b, 0x00, 0x0f, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x0b, 0x05, 0x1b, 0x51, 0x9f, 0xde, 0xfe, 0xff, 0xff, 0xeb,
+	0x9d, 0x48, 0x07, 0x00, 0x02, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x09, 0x03, 0x29, 0x77, 0xc9, 0xf8, 0xff, 0xff, 0xe6, 0xa3,
+	0x4e, 0x11, 0x00, 0x2b, 0x03, 0x43, 0x98, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0x9e, 0x49, 0x05, 0x00, 0x0e, 0x54, 0xa9, 0xfe, 0xff, 0xff,
+	0xbb, 0x66, 0x11, 0x00, 0x0f, 0x16, 0x5c, 0xb1, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb1, 0x5c, 0x07, 0x00, 0x02, 0x01, 0x23, 0x71, 0xc5,
+	0xf7, 0xff, 0xf6, 0xc1, 0x6d, 0x20, 0x00, 0x0d, 0x14, 0x5a, 0xaf, 0xef, 0xff, 0xff, 0xf2, 0xb7, 0x62, 0x1a, 0x00, 0x11, 0x37, 0x8c, 0xe1, 0xff,
+	0xff, 0xe7, 0x92, 0x3d, 0x00, 0x24, 0x4e, 0xa3, 0xf8, 0xff, 0xff, 0xcb, 0x76, 0x21, 0x00, 0x1f, 0x4d, 0xa2, 0xf7, 0xff, 0xff, 0xde, 0x89, 0x34,
+	0x00, 0x15, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x06, 0x08, 0x3c, 0x90, 0xdd, 0xfe, 0xff, 0xfc, 0xd4, 0x84, 0x32, 0x05, 0x00,
+	0x10, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xf2, 0xd1, 0xb0, 0x9c, 0x9c, 0x9c, 0xa0, 0xa9, 0xb6, 0xc3, 0xd1, 0xde, 0xec, 0xf7, 0xfd, 0xff, 0xff, 0xfe,
+	0xef, 0xce, 0x9d, 0x67, 0x33, 0x11, 0x00, 0x14, 0x2d, 0x82, 0xd7, 0xff, 0xff, 0xff, 0xb4, 0x5f, 0x0a, 0x00, 0x1b, 0x41, 0x96, 0xeb, 0xff, 0xff,
+	0xf4, 0x9f, 0x4a, 0x00, 0x15, 0x01, 0x2f, 0x84, 0xd8, 0xfe, 0xff, 0xfa, 0xbe, 0x69, 0x19, 0x00, 0x10, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xf2, 0xcf,
+	0xac, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x9a, 0xa1, 0xab, 0xb7, 0xc8, 0xdf, 0xf3, 0xfe, 0xff, 0xff, 0xfd, 0xe4, 0xa4, 0x51, 0x14, 0x00, 0x04,
+	0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x0b, 0x04, 0x2c, 0x7c, 0xcd, 0xf9, 0xff, 0xfe, 0xe4, 0x9f, 0x4b, 0x10, 0x00, 0x2a, 0x03,
+	0x43, 0x98, 0xe9, 0xff, 0xff, 0xff, 0xed, 0x9d, 0x48, 0x05, 0x00, 0x0f, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x10, 0x01, 0x22,
+	0x6e, 0xc2, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xb1, 0x5c, 0x07, 0x00, 0x01, 0x18, 0x5e, 0xb3, 0xf0, 0xff, 0xfc, 0xd4, 0x83, 0x30, 0x04, 0x00, 0x0f,
+	0x01, 0x26, 0x75, 0xc9, 0xf9, 0xff, 0xff, 0xe9, 0xa4, 0x4f, 0x10, 0x00, 0x0f, 0x37, 0x8c, 0xe1, 0xff, 0xff, 0xe7, 0x92, 0x3d, 0x00, 0x24, 0x4e,
+	0xa3, 0xf8, 0xff, 0xff, 0xcb, 0x76, 0x21, 0x00, 0x1f, 0x4f, 0xa4, 0xf9, 0xff, 0xff, 0xdc, 0x87, 0x32, 0x00, 0x15, 0x54, 0xa9, 0xfe, 0xff, 0xff,
+	0xdf, 0x8a, 0x35, 0x00, 0x08, 0x10, 0x51, 0xa6, 0xea, 0xff, 0xff, 0xf8, 0xc8, 0x75, 0x26, 0x02, 0x00, 0x0e, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf6, 0xec, 0xde, 0xd1, 0xc4, 0xb6, 0xa9, 0x9c, 0x89, 0x6a, 0x3e, 0x18, 0x03, 0x00, 0x18, 0x2d, 0x82, 0xd7,
+	0xff, 0xff, 0xff, 0xb4, 0x5f, 0x0a, 0x00, 0x1b, 0x41, 0x96, 0xeb, 0xff, 0xff, 0xf4, 0x9f, 0x4a, 0x00, 0x14, 0x08, 0x49, 0x9e, 0xea, 0xff, 0xff,
+	0xf0, 0xa8, 0x53, 0x0c, 0x00, 0x11, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfb, 0xf3, 0xe8,
+	0xdb, 0xcf, 0xc2, 0xac, 0x8a, 0x5d, 0x30, 0x11, 0x01, 0x00, 0x06, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x0d, 0x05, 0x31, 0x81,
+	0xd1, 0xfa, 0xff, 0xfe, 0xe3, 0x9c, 0x48, 0x0e, 0x00, 0xec, 0x19, 0x6e, 0xc3, 0xff, 0xff, 0xfe, 0xbf, 0x6a, 0x16, 0x00, 0x15, 0x54, 0xa9, 0xfe,
+	0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x0a, 0x1d, 0x67, 0xbc, 0xf4, 0xff, 0xff, 0xf3, 0xbb, 0x66, 0x1d, 0x00, 0xdf, 0x01, 0x0e, 0x2c, 0x54, 0x79,
+	0x97, 0xb1, 0xc5, 0xd4, 0xde, 0xe4, 0xe3, 0xda, 0xcc, 0xbf, 0xaf, 0x93, 0x6a, 0x3a, 0x16, 0x03, 0x00, 0x08, 0x38, 0x75, 0xb2, 0xb7, 0xb7, 0xb7,
+	0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0x88, 0x4b, 0x0e,
+	0x00, 0x01, 0x3c, 0x79, 0xb6, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb5, 0xaf, 0xa6, 0x9c, 0x91, 0x86, 0x7b, 0x6a, 0x4e, 0x29, 0x0e,
+	0x01, 0x00, 0x07, 0x3c, 0x79, 0xb6, 0xb7, 0xb7, 0xa0, 0x63, 0x26, 0x00, 0x26, 0x14, 0x51, 0x8e, 0xb7, 0xb7, 0xb2, 0x7c, 0x3f, 0x07, 0x00, 0x01,
+	0x3c, 0x79, 0xb6, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb3, 0x76,
+	0x39, 0x00, 0x01, 0x3c, 0x79, 0xb6, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7,
+	0xb7, 0xb3, 0x76, 0x39, 0x00, 0x01, 0x3c, 0x79, 0xb6, 0xb7, 0xb7, 0xa0, 0x63, 0x26, 0x00, 0x17, 0x0d, 0x3a, 0x8d, 0xd4, 0xfd, 0xfe, 0xe8, 0xa9,
+	0x55, 0x16, 0x00, 0x16, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x0b, 0x03, 0x2c, 0x7d, 0xcf, 0xfb, 0xff, 0xff, 0xec, 0xac, 0x57,
+	0x14, 0x00, 0x03, 0x03, 0x37, 0x74, 0xad, 0xb7, 0xb7, 0x96, 0x59, 0x1c, 0x00, 0x18, 0x0d, 0x3f, 0x71, 0x96, 0x6f, 0x3c, 0x0a, 0x00, 0x12, 0x07,
+	0x24, 0x57, 0x8d, 0xad, 0xb7, 0xb7, 0x97, 0x5a, 0x1d, 0x00, 0x01, 0x20, 0x5d, 0x9a, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7,
+	0xb7, 0xb7, 0xb7, 0x97, 0x5a, 0x1d, 0x00, 0x05, 0x02, 0x14, 0x2d, 0x46, 0x4c, 0x3d, 0x21, 0x0a, 0x00, 0x0c, 0x03, 0x0a, 0x16, 0x22, 0x2f, 0x36,
+	0x33, 0x26, 0x15, 0x08, 0x01, 0x00, 0x0b, 0x04, 0x10, 0x23, 0x30, 0x31, 0x24, 0x13, 0x07, 0x01, 0x00, 0x15, 0x03, 0x0c, 0x1a, 0x2a, 0x34, 0x33,
+	0x27, 0x16, 0x09, 0x01, 0x00, 0x17, 0x05, 0x0e, 0x1c, 0x2a, 0x35, 0x38, 0x34, 0x2a, 0x21, 0x14, 0x09, 0x01, 0x00, 0x05, 0x0b, 0x35, 0x75, 0xbc,
+	0xe7, 0xfb, 0xff, 0xff, 0xfb, 0xf2, 0xe2, 0xce, 0xbb, 0xad, 0xaa, 0xb3, 0xc9, 0xe3, 0xf7, 0xff, 0xff, 0xfe, 0xe9, 0xab, 0x57, 0x17, 0x00, 0x06,
+	0x4a, 0x9b, 0xec, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf7, 0xfb, 0xff,
+	0xff, 0xff, 0xfd, 0xb8, 0x63, 0x0f, 0x00, 0x01, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xfb, 0xf1, 0xe7, 0xe1, 0xe1, 0xe2, 0xe9, 0xf3, 0xfc, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xfc, 0xec, 0xcc, 0x8d, 0x48, 0x13, 0x00, 0x04, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x25, 0x1c, 0x6e,
+	0xc3, 0xfc, 0xff, 0xf6, 0xb0, 0x5b, 0x0f, 0x00, 0x02, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xfd, 0xf7, 0xf1, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+	0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe8, 0x99, 0x4a, 0x00, 0x01, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xfd, 0xf7, 0xf1, 0xee, 0xee, 0xee, 0xee,
+	0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe8, 0x99, 0x4a, 0x00, 0x01, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00,
+	0x14, 0x31, 0x70, 0xbb, 0xdf, 0xf5, 0xff, 0xff, 0xfb, 0xe5, 0xc9, 0xb1, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
+	0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xaa, 0x71, 0x38, 0x00, 0x03, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x0d, 0x08, 0x3e, 0x92,
+	0xdf, 0xfe, 0xff, 0xff, 0xe4, 0x9d, 0x48, 0x0d, 0x00, 0x02, 0x09, 0x50, 0xa5, 0xf0, 0xff, 0xfe, 0xce, 0x79, 0x25, 0x00, 0x16, 0x0e, 0x5b, 0xb0,
+	0xf7, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x0e, 0x04, 0x1e, 0x4e, 0x8f, 0xca, 0xef, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x7d, 0x28, 0x00, 0x01, 0x0e,
+	0x2f, 0x57, 0x77, 0x8c, 0xa7, 0xce, 0xed, 0xff, 0xff, 0xff, 0xec, 0xcc, 0xa5, 0x8b, 0x77, 0x56, 0x2e, 0x0d, 0x00, 0x04, 0x15, 0x64, 0xb9, 0xf9,
+	0xff, 0xff, 0xff, 0xe7, 0x93, 0x3e, 0x00, 0x05, 0x12, 0x3a, 0x6d, 0x9a, 0xbd, 0xdd, 0xf3, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfa,
+	0xf0, 0xdc, 0xb0, 0x6d, 0x2c, 0x07, 0x00, 0x01, 0x12, 0x3f, 0x82, 0xbc, 0xe1, 0xf2, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf9, 0xe7, 0xc1, 0x8a,
+	0x4b, 0x1d, 0x04, 0x00, 0x0a, 0x05, 0x1e, 0x4c, 0x89, 0xbe, 0xe3, 0xf5, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf0, 0xd4, 0xa7, 0x6d,
+	0x34, 0x10, 0x00, 0x0c, 0x09, 0x24, 0x51, 0x88, 0xbc, 0xe3, 0xf8, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf4, 0xe1, 0x9a, 0x4f,
+	0x0d, 0x00, 0x03, 0x15, 0x4b, 0x99, 0xc5, 0xbc, 0x88, 0x4f, 0x21, 0x07, 0x00, 0x07, 0x0a, 0x31, 0x7f, 0xc9, 0xf8, 0xff, 0xff, 0xe9, 0x95, 0x40,
+	0x01, 0x00, 0x17, 0x16, 0x5a, 0xaf, 0xee, 0xff, 0xfe, 0xe3, 0x9b, 0x46, 0x0d, 0x00, 0x02, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00,
+	0x04, 0x06, 0x13, 0x28, 0x3f, 0x55, 0x6c, 0x94, 0xc5, 0xef, 0xff, 0xff, 0xff, 0xe9, 0xa7, 0x52, 0x13, 0x00, 0x02, 0x54, 0xa9, 0xfe, 0xff, 0xff,
+	0xe5, 0x9f, 0x59, 0x2e, 0x2e, 0x2e, 0x2c, 0x26, 0x1d, 0x13, 0x09, 0x02, 0x00, 0x1b, 0x24, 0x78, 0xcd, 0xfe, 0xff, 0xf1, 0xa7, 0x52, 0x0a, 0x00,
+	0x03, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x12, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x12, 0x54, 0xa9, 0xfe,
+	0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x14, 0x50, 0xa5, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xa8, 0x53, 0x00, 0x26, 0x05, 0x46, 0x9b, 0xea, 0xff, 0xff, 0xd8,
+	0x83, 0x2e, 0x00, 0x13, 0x06, 0x1f, 0x6c, 0xbb, 0xf7, 0xff, 0xff, 0xbf, 0x6e, 0x1e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0b, 0x07, 0x02, 0x00, 0x02,
+	0x02, 0x19, 0x45, 0x85, 0xc2, 0xeb, 0xfd, 0xfe, 0xed, 0xc0, 0xaa, 0xbc, 0xe8, 0xff, 0xff, 0xd2, 0x7d, 0x28, 0x00, 0x06, 0x1c, 0x71, 0xc6, 0xff,
+	0xff, 0xff, 0xc2, 0x6d, 0x18, 0x00, 0x09, 0x1a, 0x6d, 0xc2, 0xfc, 0xff, 0xff, 0xff, 0xef, 0x9c, 0x47, 0x01, 0x00, 0x04, 0x05, 0x3b, 0x90, 0xd7,
+	0xe1, 0xc1, 0x9f, 0x84, 0x71, 0x64, 0x57, 0x4e, 0x4d, 0x55, 0x6a, 0x8d, 0xc1, 0xe8, 0xfe, 0xfd, 0xe5, 0xc1, 0xb8, 0xd0, 0xf4, 0xff, 0xf6, 0xe1,
+	0xc0, 0x9a, 0x74, 0x5c, 0x56, 0x64, 0x85, 0xb5, 0xe2, 0xfc, 0xff, 0xfd, 0xde, 0x8f, 0x3c, 0x06, 0x00, 0x06, 0x16, 0x5a, 0xae, 0xec, 0xfe, 0xff,
+	0xff, 0xf9, 0xe7, 0xc7, 0xa0, 0x78, 0x63, 0x68, 0x86, 0xae, 0xd4, 0xef, 0xfd, 0xff, 0xff, 0xf9, 0xd5, 0x86, 0x37, 0x06, 0x00, 0x07, 0x15, 0x59,
+	0xae, 0xee, 0xff, 0xff, 0xff, 0xfe, 0xf6, 0xe0, 0xbf, 0x99, 0x79, 0x67, 0x67, 0x74, 0x86, 0x9d, 0xb7, 0xa1, 0x64, 0x1d, 0x00, 0x16, 0x0d, 0x62,
+	0xb7, 0xfe, 0xff, 0xff, 0xcd, 0x78, 0x23, 0x00, 0x15, 0x10, 0x4e, 0xa3, 0xe7, 0xff, 0xff, 0xea, 0xa8, 0x53, 0x12, 0x00, 0x04, 0x54, 0xa9, 0xfe,
+	0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x0a, 0x03, 0x3e, 0x93, 0xe4, 0xff, 0xff, 0xff, 0xf6, 0xa4, 0x4f, 0x02, 0x00, 0x01, 0x54, 0xa9, 0xfe, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf9, 0xf1, 0xe0, 0xc4, 0x9d, 0x71, 0x44, 0x1f, 0x08, 0x00, 0x12, 0x2d,
+	0x82, 0xd7, 0xff, 0xff, 0xeb, 0x9d, 0x48, 0x06, 0x00, 0x04, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x12, 0x54, 0xa9, 0xfe, 0xff,
+	0xff, 0xdf, 0x8a, 0x35, 0x00, 0x12, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x40, 0x03, 0x0b, 0x19, 0x29, 0x34, 0x37, 0x31, 0x25,
+	0x16, 0x09, 0x00, 0x01, 0x08, 0x39, 0x70, 0x8f, 0x75, 0x46, 0x1e, 0x07, 0x00, 0x08, 0x02, 0x3c, 0x91, 0xe3, 0xff, 0xff, 0xe0, 0x8d, 0x38, 0x02,
+	0x00, 0x0e, 0x30, 0x6f, 0xbd, 0xe1, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0x83, 0x2e, 0x00,
+	0x01, 0x0b, 0x4a, 0x9f, 0xe9, 0xff, 0xf8, 0xda, 0xa5, 0x5f, 0x28, 0x08, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xd2, 0x7d, 0x28, 0x00, 0x06, 0x1c, 0x71,
+	0xc6, 0xff, 0xff, 0xff, 0xc2, 0x6d, 0x18, 0x00, 0x0a, 0x08, 0x23, 0x47, 0x65, 0x6b, 0x5b, 0x36, 0x15, 0x01, 0x00, 0x07, 0x03, 0x03, 0x03, 0x00,
+	0x0b, 0x11, 0x60, 0xb5, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xb0, 0x5b, 0x0e, 0x00, 0x07, 0x03, 0x37, 0x8c, 0xde, 0xff, 0xff, 0xf8, 0xbd, 0x68,
+	0x1a, 0x00, 0x03, 0x08, 0x3f, 0x94, 0xe1, 0xff, 0xff, 0xf8, 0xb9, 0x6c, 0x1e, 0x08, 0x00, 0x07, 0x01, 0x0e, 0x35, 0x89, 0xd1, 0xff, 0xff, 0xf8,
+	0xc4, 0x70, 0x22, 0x00, 0x04, 0x0a, 0x44, 0x99, 0xe3, 0xff, 0xff, 0xfd, 0xc9, 0x84, 0x35, 0x14, 0x04, 0x00, 0x22, 0x08, 0x5a, 0xaf, 0xfc, 0xff,
+	0xff, 0xcf, 0x7a, 0x25, 0x00, 0x13, 0x0b, 0x42, 0x96, 0xe0, 0xfe, 0xff, 0xf0, 0xb4, 0x5f, 0x19, 0x00, 0x06, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf,
+	0x8a, 0x35, 0x00, 0x0c, 0x36, 0x8b, 0xdf, 0xff, 0xff, 0xff, 0xc7, 0x72, 0x1d, 0x00, 0x01, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xec, 0xbb, 0x8a, 0x6b,
+	0x6b, 0x6c, 0x73, 0x83, 0x99, 0xaf, 0xc6, 0xdc, 0xef, 0xfb, 0xff, 0xff, 0xff, 0xfe, 0xe4, 0xa2, 0x4d, 0x12, 0x00, 0x0e, 0x01, 0x37, 0x8c, 0xdf,
+	0xff, 0xff, 0xe5, 0x93, 0x3e, 0x03, 0x00, 0x05, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x12, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf,
+	0x8a, 0x35, 0x00, 0x12, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x15, 0x05, 0x09, 0x0e, 0x0e, 0x0e, 0x0b, 0x06, 0x02, 0x00, 0x0c,
+	0x01, 0x06, 0x0b, 0x0e, 0x0e, 0x0e, 0x0a, 0x05, 0x00, 0x09, 0x04, 0x1c, 0x49, 0x86, 0xbb, 0xe1, 0xf5, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xfd, 0xf0, 0xd9, 0xd8, 0xe4, 0xfb, 0xfe, 0xe2, 0x9a, 0x45, 0x0c, 0x00, 0x09, 0x01, 0x32, 0x87, 0xdb, 0xff, 0xff, 0xe8, 0x97, 0x42, 0x04, 0x00,
+	0x0d, 0x1b, 0x37, 0x53, 0x53, 0x65, 0x9e, 0xd8, 0xff, 0xff, 0xff, 0xd1, 0x98, 0x5e, 0x53, 0x53, 0x53, 0x53, 0x53, 0x46, 0x2a, 0x0f, 0x00, 0x03,
+	0x11, 0x36, 0x47, 0x37, 0x11, 0x00, 0x04, 0x45, 0x9a, 0xef, 0xff, 0xff, 0xd2, 0x7d, 0x28, 0x00, 0x06, 0x1c, 0x71, 0xc6, 0xff, 0xff, 0xff, 0xc2,
+	0x6d, 0x18, 0x00, 0x29, 0x31, 0x86, 0xdb, 0xff, 0xff, 0xff, 0xf8, 0xb1, 0x5c, 0x0e, 0x00, 0x0a, 0x41, 0x96, 0xeb, 0xff, 0xff, 0xf6, 0xa3, 0x4e,
+	0x02, 0x00, 0x02, 0x42, 0x97, 0xec, 0xff, 0xff, 0xff, 0xc7, 0x72, 0x1d, 0x00, 0x0c, 0x3a, 0x8f, 0xe4, 0xff, 0xff, 0xff, 0xcc, 0x77, 0x22, 0x00,
+	0x03, 0x3d, 0x92, 0xe7, 0xff, 0xff, 0xff, 0xd3, 0x7e, 0x29, 0x00, 0x24, 0x02, 0x38, 0x8d, 0xe0, 0xff, 0xff, 0xf1, 0xa0, 0x4b, 0x03, 0x00, 0x11,
+	0x07, 0x37, 0x8a, 0xd8, 0xfd, 0xff, 0xf5, 0xc0, 0x6c, 0x21, 0x01, 0x00, 0x07, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x0c, 0x3e,
+	0x93, 0xe8, 0xff, 0xff, 0xfb, 0xac, 0x57, 0x06, 0x00, 0x01, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x09, 0x03, 0x24, 0x77, 0xc8,
+	0xfd, 0xff, 0xff, 0xff, 0xdc, 0x87, 0x32, 0x00, 0x0c, 0x04, 0x41, 0x96, 0xe7, 0xff, 0xff, 0xdd, 0x89, 0x34, 0x01, 0x00, 0x06, 0x54, 0xa9, 0xfe,
+	0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x12, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x12, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a,
+	0x35, 0x00, 0x14, 0x04, 0x59, 0xae, 0xff, 0xff, 0xff, 0xd0, 0x7b, 0x26, 0x00, 0x0c, 0x1c, 0x71, 0xc6, 0xff, 0xff, 0xff, 0xb8, 0x63, 0x0e, 0x00,
+	0x06, 0x13, 0x55, 0xa9, 0xea, 0xfd, 0xff, 0xff, 0xfa, 0xe8, 0xc9, 0xa2, 0x7a, 0x5d, 0x4f, 0x54, 0x69, 0x9e, 0xd3, 0xfb, 0xff, 0xff, 0xff, 0xed,
+	0xa0, 0x4b, 0x08, 0x00, 0x0c, 0x29, 0x7d, 0xd2, 0xfe, 0xff, 0xee, 0xa1, 0x4c, 0x07, 0x00, 0x10, 0x1b, 0x70, 0xc5, 0xff, 0xff, 0xff, 0xbb, 0x66,
+	0x11, 0x00, 0x14, 0x47, 0x9c, 0xf1, 0xff, 0xff, 0xd2, 0x7d, 0x28, 0x00, 0x06, 0x1c, 0x71, 0xc6, 0xff, 0xff, 0xff, 0xc2, 0x6d, 0x18, 0x00, 0x1c,
+	0x0b, 0x22, 0x3f, 0x56, 0x64, 0x6f, 0x7b, 0x86, 0x90, 0x97, 0x9c, 0x9f, 0xa3, 0xb4, 0xd3, 0xf0, 0xff, 0xff, 0xff, 0xee, 0xd2, 0xb5, 0xa9, 0xa9,
+	0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xb9, 0xd5, 0xf2, 0xff, 0xff, 0xff, 0xc7, 0x72, 0x1d, 0x00, 0x01, 0x10, 0x65, 0xba, 0xff,
+	0xff, 0xff, 0xe6, 0x91, 0x3c, 0x00, 0x0d, 0x08, 0x57, 0xac, 0xf9, 0xff, 0xff, 0xf2, 0x9e, 0x49, 0x00, 0x02, 0x0c, 0x61, 0xb6, 0xfe, 0xff, 0xff,
+	0xec, 0x98, 0x43, 0x01, 0x00, 0x23, 0x13, 0x59, 0xae, 0xf0, 0xff, 0xfe, 0xdc, 0x8a, 0x36, 0x03, 0x00, 0x10, 0x03, 0x2d, 0x7d, 0xce, 0xfa, 0xff,
+	0xf9, 0xcb, 0x79, 0x29, 0x02, 0x00, 0x09, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x0a, 0x17, 0x53, 0xa8, 0xe6, 0xff, 0xff, 0xf7,
+	0xc0, 0x6b, 0x1e, 0x00, 0x02, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x0b, 0x15, 0x64, 0xb9, 0xf9, 0xff, 0xff, 0xfe, 0xb7, 0x62,
+	0x0e, 0x00, 0x0a, 0x07, 0x4b, 0xa0, 0xee, 0xff, 0xff, 0xd4, 0x7f, 0x2a, 0x00, 0x08, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xef, 0xc6, 0x9d, 0x84, 0x84,
+	0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x7a, 0x4e, 0x22, 0x00, 0x02, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35,
+	0x00, 0x12, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x14, 0x04, 0x59, 0xae, 0xff, 0xff, 0xff, 0xd0, 0x7b, 0x26, 0x00, 0x0c, 0x1c,
+	0x71, 0xc6, 0xff, 0xff, 0xff, 0xb8, 0x63, 0x0e, 0x00, 0x04, 0x06, 0x3a, 0x8f, 0xdd, 0xfe, 0xff, 0xfa, 0xbd, 0x71, 0x21, 0x09, 0x00, 0x05, 0x1f,
+	0x69, 0xbe, 0xf4, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfa, 0xca, 0x76, 0x25, 0x01, 0x00, 0x0b, 0x20, 0x74, 0xc9, 0xfd, 0xff, 0xf3, 0xab, 0x56, 0x0c,
+	0x00, 0x0f, 0x1b, 0x70, 0xc5, 0xff, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x14, 0x47, 0x9c, 0xf1, 0xff, 0xff, 0xd2, 0x7d, 0x28, 0x00, 0x06, 0x1c,
+	0x71, 0xc6, 0xff, 0xff, 0xff, 0xc2, 0x6d, 0x18, 0x00, 0x18, 0x09, 0x3e, 0x83, 0xcc, 0xeb, 0xfb, 0xff, 0xfe, 0xf4, 0xe5, 0xd3, 0xc7, 0xbb, 0xb1,
+	0xa9, 0xa4, 0x9f, 0xaf, 0xce, 0xf0, 0xff, 0xff, 0xff, 0xf3, 0xe4, 0xd6, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3,
+	0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xab, 0x65, 0x1f, 0x00, 0x01, 0x29, 0x7e, 0xd3, 0xff, 0xff, 0xff, 0xbf, 0x6a, 0x15, 0x00, 0x0e, 0x2f, 0x84, 0xd9,
+	0xff, 0xff, 0xff, 0xb9, 0x64, 0x0f, 0x00, 0x01, 0x28, 0x7d, 0xd2, 0xff, 0xff, 0xff, 0xc0, 0x6b, 0x16, 0x00, 0x21, 0x01, 0x1c, 0x5d, 0xb1, 0xea,
+	0xff, 0xfe, 0xe4, 0xa3, 0x4e, 0x14, 0x00, 0x10, 0x01, 0x24, 0x71, 0xc4, 0xf6, 0xff, 0xfc, 0xd5, 0x86, 0x33, 0x05, 0x00, 0x0b, 0x54, 0xa9, 0xfe,
+	0xff, 0xff, 0xe9, 0xaf, 0x75, 0x51, 0x51, 0x54, 0x59, 0x61, 0x6a, 0x74, 0x87, 0xa4, 0xc9, 0xe7, 0xf9, 0xff, 0xff, 0xf9, 0xd0, 0x80, 0x31, 0x04,
+	0x00, 0x03, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x0c, 0x2b, 0x80, 0xd5, 0xff, 0xff, 0xff, 0xc1, 0x6c, 0x17, 0x00, 0x09, 0x0c,
+	0x55, 0xaa, 0xf3, 0xff, 0xfd, 0xca, 0x75, 0x21, 0x00, 0x09, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0x97, 0x42, 0x00, 0x02, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xfb, 0xf0, 0xe5, 0xde, 0xde, 0xde, 0xde,
+	0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xce, 0x84, 0x3a, 0x00, 0x02, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x14,
+	0x04, 0x59, 0xae, 0xff, 0xff, 0xff, 0xd0, 0x7b, 0x26, 0x00, 0x0c, 0x1c, 0x71, 0xc6, 0xff, 0xff, 0xff, 0xb8, 0x63, 0x0e, 0x00, 0x04, 0x3d, 0x92,
+	0xe7, 0xff, 0xff, 0xff, 0xcc, 0x77, 0x22, 0x00, 0x05, 0x17, 0x5c, 0xb1, 0xef, 0xff, 0xf6, 0xc2, 0x81, 0x8a, 0xbd, 0xff, 0xff, 0xff, 0xd3, 0x7e,
+	0x29, 0x00, 0x0c, 0x18, 0x6a, 0xbf, 0xfb, 0xff, 0xf8, 0xb5, 0x60, 0x12, 0x00, 0x0e, 0x1b, 0x70, 0xc5, 0xff, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00,
+	0x14, 0x47, 0x9c, 0xf1, 0xff, 0xff, 0xd2, 0x7d, 0x28, 0x00, 0x06, 0x1c, 0x71, 0xc6, 0xff, 0xff, 0xff, 0xc2, 0x6d, 0x18, 0x00, 0x17, 0x1a, 0x68,
+	0xbd, 0xf8, 0xff, 0xee, 0xba, 0x74, 0x33, 0x12, 0x03, 0x00, 0x07, 0x33, 0x88, 0xdd, 0xff, 0xff, 0xff, 0xe5, 0x90, 0x3b, 0x00, 0x15, 0x0c, 0x60,
+	0xb5, 0xfe, 0xff, 0xff, 0xea, 0x96, 0x41, 0x00, 0x0d, 0x0a, 0x5b, 0xb0, 0xfa, 0xff, 0xff, 0xf1, 0x9d, 0x48, 0x00, 0x02, 0x0e, 0x63, 0xb8, 0xfe,
+	0xff, 0xff, 0xeb, 0x97, 0x42, 0x01, 0x00, 0x1e, 0x0d, 0x39, 0x84, 0xcc, 0xf5, 0xff, 0xfa, 0xd6, 0x8e, 0x3e, 0x0c, 0x00, 0x11, 0x1c, 0x64, 0xb9,
+	0xf2, 0xff, 0xfe, 0xdd, 0x92, 0x3e, 0x09, 0x00, 0x0d, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xfe, 0xfb, 0xf3, 0xde, 0xbc, 0x8c, 0x58, 0x29, 0x0c, 0x00, 0x06, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x0b, 0x0f, 0x5d, 0xb2,
+	0xf8, 0xff, 0xff, 0xed, 0x99, 0x44, 0x00, 0x09, 0x12, 0x60, 0xb5, 0xf8, 0xff, 0xfb, 0xc0, 0x6b, 0x1a, 0x00, 0x0a, 0x54, 0xa9, 0xfe, 0xff, 0xff,
+	0xe3, 0x97, 0x4c, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1b, 0x11, 0x07, 0x00, 0x02, 0x54, 0xa9, 0xfe,
+	0xff, 0xff, 0xf8, 0xe5, 0xd2, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xb8, 0x76, 0x34, 0x00, 0x02, 0x54,
+	0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x14, 0x04, 0x59, 0xae, 0xff, 0xff, 0xff, 0xd0, 0x7b, 0x26, 0x00, 0x0c, 0x1c, 0x71, 0xc6, 0xff,
+	0xff, 0xff, 0xb8, 0x63, 0x0e, 0x00, 0x03, 0x0c, 0x60, 0xb5, 0xfe, 0xff, 0xff, 0xea, 0x96, 0x41, 0x00, 0x04, 0x10, 0x4f, 0xa4, 0xe8, 0xff, 0xf9,
+	0xcc, 0x7b, 0x2b, 0x03, 0x41, 0x96, 0xeb, 0xff, 0xff, 0xf6, 0xa3, 0x4e, 0x02, 0x00, 0x0c, 0x12, 0x60, 0xb5, 0xf8, 0xff, 0xfb, 0xbf, 0x6a, 0x18,
+	0x00, 0x0d, 0x1b, 0x70, 0xc5, 0xff, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x14, 0x47, 0x9c, 0xf1, 0xff, 0xff, 0xd2, 0x7d, 0x28, 0x00, 0x06, 0x1c,
+	0x71, 0xc6, 0xff, 0xff, 0xff, 0xc2, 0x6d, 0x18, 0x00, 0x15, 0x02, 0x32, 0x87, 0xda, 0xfe, 0xff, 0xec, 0x97, 0x42, 0x00, 0x0a, 0x05, 0x54, 0xa9,
+	0xf9, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x81, 0x2c, 0x00, 0x15, 0x3b, 0x90, 0xe5, 0xff, 0xff, 0xff, 0xcd, 0x78, 0x23, 0x00, 0x0c, 0x3d, 0x92, 0xe7,
+	0xff, 0xff, 0xff, 0xce, 0x79, 0x24, 0x00, 0x03, 0x3e, 0x93, 0xe8, 0xff, 0xff, 0xff, 0xd2, 0x7d, 0x28, 0x00, 0x1b, 0x06, 0x2a, 0x6c, 0xbb, 0xec,
+	0xff, 0xfe, 0xe6, 0xaf, 0x5e, 0x20, 0x03, 0x00, 0x11, 0x15, 0x58, 0xad, 0xec, 0xff, 0xff, 0xe5, 0x9f, 0x4a, 0x0e, 0x00, 0x0f, 0x54, 0xa9, 0xfe,
+	0xff, 0xff, 0xe8, 0xaa, 0x6c, 0x45, 0x45, 0x43, 0x3e, 0x34, 0x27, 0x1b, 0x0e, 0x05, 0x01, 0x00, 0x0c, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a,
+	0x35, 0x00, 0x07, 0x09, 0x1e, 0x40, 0x75, 0xb4, 0xe7, 0xfe, 0xff, 0xfb, 0xd1, 0x80, 0x2f, 0x04, 0x00, 0x08, 0x18, 0x6a, 0xbf, 0xfb, 0xff, 0xf8,
+	0xb6, 0x61, 0x13, 0x00, 0x0b, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x12, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00,
+	0x12, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x14, 0x04, 0x59, 0xae, 0xff, 0xff, 0xff, 0xd0, 0x7b, 0x26, 0x00, 0x0c, 0x1c, 0x71,
+	0xc6, 0xff, 0xff, 0xff, 0xb8, 0x63, 0x0e, 0x00, 0x03, 0x23, 0x78, 0xcd, 0xff, 0xff, 0xff, 0xbe, 0x69, 0x14, 0x00, 0x02, 0x0b, 0x42, 0x96, 0xe0,
+	0xfe, 0xfc, 0xd6, 0x87, 0x35, 0x06, 0x00, 0x02, 0x28, 0x7d, 0xd2, 0xff, 0xff, 0xff, 0xbe, 0x69, 0x14, 0x00, 0x0d, 0x0c, 0x56, 0xab, 0xf3, 0xff,
+	0xfd, 0xc8, 0x73, 0x20, 0x00, 0x0c, 0x1b, 0x70, 0xc5, 0xff, 0xff, 0xff, 0xbb, 0x66, 0x11, 0x00, 0x14, 0x47, 0x9c, 0xf1, 0xff, 0xff, 0xd2, 0x7d,
+	0x28, 0x00, 0x06, 0x1c, 0x71, 0xc6, 0xff, 0xff, 0xff, 0xc2, 0x6d, 0x18, 0x00, 0x09, 0x05, 0x26, 0x48, 0x65, 0x65, 0x65, 0x65, 0x4b, 0x29, 0x07,
+	0x00, 0x02, 0x01, 0x48, 0x9d, 0xf1, 0xff, 0xff, 0xf9, 0xb7, 0x62, 0x13, 0x00, 0x08, 0x1b, 0x64, 0xb8, 0xf2, 0xfd, 0xfc, 0xfc, 0xfe, 0xff, 0xfe,
+	0xd0, 0x8a, 0x39, 0x13, 0x03, 0x00, 0x0b, 0x08, 0x08, 0x07, 0x00, 0x04, 0x03, 0x30, 0x83, 0xd5, 0xfd, 0xff, 0xfa, 0xc2, 0x7b, 0x2c, 0x10, 0x02,
+	0x00, 0x06, 0x04, 0x16, 0x41, 0x91, 0xd5, 0xff, 0xff, 0xf8, 0xc3, 0x6f, 0x20, 0x00, 0x04, 0x0a, 0x43, 0x98, 0xe3, 0xff, 0xff, 0xfd, 0xc9, 0x85,
+	0x36, 0x15, 0x04, 0x00, 0x15, 0x02, 0x1e, 0x59, 0xa9, 0xe2, 0xfd, 0xff, 0xef, 0xc1, 0x75, 0x30, 0x09, 0x00, 0x12, 0x0f, 0x4b, 0xa0, 0xe6, 0xff,
+	0xff, 0xec, 0xac, 0x57, 0x14, 0x00, 0x11, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x16, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xf8, 0xe5,
+	0xd2, 0xc7, 0xc7, 0xca, 0xd0, 0xd8, 0xe0, 0xea, 0xf4, 0xfb, 0xff, 0xff, 0xff, 0xf5, 0xd9, 0xac, 0x6a, 0x30, 0x08, 0x00, 0x09, 0x20, 0x74, 0xc9,
+	0xfd, 0xff, 0xf4, 0xad, 0x58, 0x0d, 0x00, 0x0c, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x12, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf,
+	0x8a, 0x35, 0x00, 0x12, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x14, 0x04, 0x59, 0xae, 0xff, 0xff, 0xff, 0xd0, 0x7b, 0x26, 0x00,
+	0x0c, 0x1d, 0x72, 0xc7, 0xff, 0xff, 0xff, 0xb8, 0x63, 0x0e, 0x00, 0x03, 0x08, 0x5b, 0xb0, 0xfd, 0xff, 0xff, 0xc7, 0x72, 0x1d, 0x06, 0x36, 0x88,
+	0xd7, 0xfc, 0xfe, 0xdf, 0x94, 0x40, 0x0a, 0x00, 0x03, 0x07, 0x56, 0xab, 0xf8, 0xff, 0xff, 0xf5, 0xa2, 0x4d, 0x01, 0x00, 0x0e, 0x08, 0x4c, 0xa1,
+	0xee, 0xff, 0xfe, 0xd2, 0x7d, 0x28, 0x00, 0x0b, 0x1a, 0x6f, 0xc4, 0xff, 0xff, 0xff, 0xbd, 0x68, 0x13, 0x00, 0x14, 0x47, 0x9c, 0xf1, 0xff, 0xff,
+	0xd2, 0x7d, 0x28, 0x00, 0x06, 0x1c, 0x71, 0xc6, 0xff, 0xff, 0xff, 0xc2, 0x6d, 0x18, 0x00, 0x09, 0x29, 0x7e, 0xd3, 0xff, 0xff, 0xff, 0xeb, 0x98,
+	0x43, 0x02, 0x00, 0x03, 0x12, 0x56, 0xab, 0xed, 0xff, 0xff, 0xfb, 0xdd, 0xb6, 0x8a, 0x6e, 0x5a, 0x55, 0x5e, 0x70, 0x8e, 0xb9, 0xe2, 0xf9, 0xf8,
+	0xd0, 0x84, 0x3f, 0x39, 0x74, 0xc0, 0xee, 0xff, 0xff, 0xfe, 0xf6, 0xe3, 0xc4, 0xa1, 0x82, 0x70, 0x6c, 0x72, 0x7c, 0x8a, 0x9d, 0xb4, 0xd1, 0xe5,
+	0xa0, 0x4f, 0x00, 0x06, 0x0d, 0x47, 0x98, 0xdf, 0xfa, 0xff, 0xff, 0xfd, 0xf1, 0xd7, 0xb0, 0x88, 0x71, 0x74, 0x92, 0xbb, 0xdf, 0xf5, 0xfe, 0xff,
+	0xff, 0xf8, 0xd6, 0x87, 0x39, 0x06, 0x00, 0x07, 0x15, 0x58, 0xad, 0xed, 0xfe, 0xff, 0xff, 0xfe, 0xf6, 0xe1, 0xc1, 0x9b, 0x7f, 0x72, 0x76, 0x80,
+	0x8c, 0x9f, 0xb8, 0xd4, 0x97, 0x4f, 0x00, 0x07, 0x14, 0x48, 0x97, 0xd8, 0xf9, 0xff, 0xf4, 0xcb, 0x85, 0x3a, 0x0e, 0x00, 0x13, 0x0a, 0x40, 0x94,
+	0xdf, 0xfe, 0xff, 0xf2, 0xb8, 0x63, 0x1b, 0x00, 0x13, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x16, 0x54, 0xa9, 0xfe, 0xff, 0xff,
+	0xf9, 0xe8, 0xd8, 0xce, 0xce, 0xcc, 0xc7, 0xbd, 0xb0, 0xa4, 0x97, 0x8a, 0x7e, 0x68, 0x46, 0x20, 0x07, 0x00, 0x0c, 0x29, 0x7d, 0xd2, 0xfe, 0xff,
+	0xef, 0xa3, 0x4e, 0x08, 0x00, 0x0d, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x12, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35,
+	0x00, 0x12, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x14, 0x04, 0x59, 0xae, 0xff, 0xff, 0xff, 0xd0, 0x7b, 0x26, 0x00, 0x0c, 0x2e,
+	0x83, 0xd8, 0xff, 0xff, 0xff, 0xb8, 0x63, 0x0e, 0x00, 0x04, 0x36, 0x8b, 0xe0, 0xff, 0xff, 0xef, 0xa2, 0x75, 0x7f, 0xcd, 0xfa, 0xff, 0xe6, 0xa1,
+	0x4c, 0x0f, 0x00, 0x05, 0x38, 0x8d, 0xe2, 0xff, 0xff, 0xff, 0xd3, 0x7e, 0x29, 0x00, 0x10, 0x04, 0x42, 0x97, 0xe8, 0xff, 0xff, 0xdb, 0x87, 0x32,
+	0x01, 0x00, 0x09, 0x05, 0x57, 0xac, 0xfb, 0xff, 0xff, 0xe4, 0x8f, 0x3a, 0x00, 0x14, 0x47, 0x9c, 0xf1, 0xff, 0xff, 0xd2, 0x7d, 0x28, 0x00, 0x06,
+	0x1c, 0x71, 0xc6, 0xff, 0xff, 0xff, 0xc2, 0x6d, 0x18, 0x00, 0x08, 0x08, 0x59, 0xae, 0xfa, 0xff, 0xff, 0xeb, 0x9b, 0x46, 0x05, 0x00, 0x06, 0x17,
+	0x45, 0x83, 0xbb, 0xe1, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xee, 0xd3, 0xab, 0x77, 0x3e, 0x13, 0x01, 0x00, 0x03, 0x0d, 0x38, 0x72,
+	0xa5, 0xc1, 0xd6, 0xe9, 0xf7, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf6, 0xe6, 0xcb, 0xa8, 0x63, 0x2a, 0x00, 0x08, 0x01, 0x13, 0x39, 0x73,
+	0xa9, 0xd1, 0xe9, 0xf6, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf3, 0xe5, 0xca, 0xa0, 0x67, 0x30, 0x0e, 0x00, 0x0c, 0x06, 0x1f, 0x4b, 0x82, 0xb6,
+	0xdb, 0xf2, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xe6, 0xc9, 0x7a, 0x37, 0x00, 0x04, 0x0d, 0x38, 0x82, 0xca, 0xf4, 0xff, 0xf8,
+	0xd5, 0x94, 0x46, 0x14, 0x00, 0x14, 0x06, 0x35, 0x87, 0xd6, 0xfc, 0xff, 0xf6, 0xc4, 0x70, 0x23, 0x01, 0x00, 0x14, 0x54, 0xa9, 0xfe, 0xff, 0xff,
+	0xdf, 0x8a, 0x35, 0x00, 0x16, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x18, 0x01, 0x33, 0x88, 0xdc, 0xff, 0xff, 0xe9, 0x99, 0x44,
+	0x05, 0x00, 0x0e, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x12, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x12, 0x54,
+	0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x14, 0x01, 0x4d, 0xa2, 0xf6, 0xff, 0xff, 0xec, 0x99, 0x44, 0x02, 0x00, 0x0a, 0x08, 0x52, 0xa7,
+	0xf4, 0xff, 0xff, 0xff, 0xb8, 0x63, 0x0e, 0x00, 0x04, 0x02, 0x2d, 0x7f, 0xd1, 0xfc, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xed, 0xad, 0x58, 0x15, 0x00,
+	0x04, 0x04, 0x15, 0x3c, 0x8d, 0xd1, 0xff, 0xff, 0xfa, 0xc8, 0x74, 0x24, 0x00, 0x12, 0x02, 0x38, 0x8d, 0xe0, 0xff, 0xff, 0xe3, 0x91, 0x3c, 0x02,
+	0x00, 0x09, 0x25, 0x78, 0xcd, 0xfc, 0xff, 0xff, 0xe9, 0xc6, 0x94, 0x6f, 0x59, 0x54, 0x5c, 0x61, 0x42, 0x1f, 0x00, 0x0c, 0x47, 0x9c, 0xf1, 0xff,
+	0xff, 0xd2, 0x7d, 0x28, 0x00, 0x06, 0x1c, 0x71, 0xc6, 0xff, 0xff, 0xff, 0xc2, 0x6d, 0x18, 0x00, 0x08, 0x38, 0x8d, 0xe2, 0xff, 0xff, 0xe5, 0x93,
+	0x3e, 0x03, 0x00, 0x0b, 0x03, 0x0a, 0x15, 0x21, 0x29, 0x2a, 0x24, 0x1b, 0x0f, 0x06, 0x00, 0x10, 0x07, 0x14, 0x24, 0x2d, 0x2e, 0x28, 0x1e, 0x12,
+	0x07, 0x01, 0x00, 0x13, 0x04, 0x0e, 0x1d, 0x26, 0x24, 0x17, 0x0a, 0x02, 0x00, 0x18, 0x01, 0x07, 0x11, 0x1f, 0x29, 0x2b, 0x26, 0x1d, 0x14, 0x0a,
+	0x03, 0x00, 0x05, 0x05, 0x48, 0x9d, 0xed, 0xff, 0xff, 0xff, 0xfa, 0xe0, 0xc4, 0xac, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab,
+	0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0x8b, 0x52, 0x19, 0x00, 0x01, 0x1a, 0x6a, 0xbf, 0xf9, 0xff, 0xff, 0xfe, 0xe5, 0xc9, 0xae, 0xab, 0xab,
+	0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xa3, 0x6a, 0x31, 0x00, 0x01, 0x54, 0xa9, 0xfe,
+	0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x16, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x17, 0x03, 0x3d, 0x92, 0xe4, 0xff, 0xff, 0xe2,
+	0x8f, 0x3a, 0x02, 0x00, 0x0f, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xf4, 0xd6, 0xb8, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6,
+	0xa6, 0xa6, 0xa6, 0xa2, 0x6b, 0x33, 0x00, 0x01, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x12, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xf4,
+	0xd8, 0xbc, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xa7, 0x6e, 0x35, 0x00, 0x04, 0x2d, 0x82, 0xd7,
+	0xff, 0xff, 0xff, 0xde, 0x89, 0x34, 0x00, 0x08, 0x02, 0x1a, 0x65, 0xb8, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xb8, 0x63, 0x0e, 0x00, 0x06, 0x0b, 0x55,
+	0xaa, 0xf3, 0xff, 0xff, 0xff, 0xf7, 0xce, 0x9c, 0x6e, 0x5e, 0x5e, 0x6f, 0x90, 0xb8, 0xdd, 0xf4, 0xfe, 0xff, 0xff, 0xf9, 0xd9, 0x8c, 0x3d, 0x08,
+	0x00, 0x15, 0x2e, 0x83, 0xd8, 0xff, 0xff, 0xea, 0x9b, 0x46, 0x05, 0x00, 0x09, 0x0b, 0x3a, 0x7a, 0xbf, 0xe5, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xfe, 0xe7, 0x92, 0x3d, 0x00, 0x0c, 0x47, 0x9c, 0xf1, 0xff, 0xff, 0xd2, 0x7d, 0x28, 0x00, 0x01, 0x02, 0x0b, 0x1b, 0x30, 0x44, 0x67, 0xa6, 0xdd,
+	0xff, 0xff, 0xff, 0xdb, 0xa3, 0x65, 0x43, 0x2f, 0x1a, 0x0b, 0x02, 0x00, 0x02, 0x1a, 0x6f, 0xc4, 0xff, 0xfe, 0xd7, 0x83, 0x2e, 0x00, 0x74, 0x08,
+	0x5d, 0xb2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xcf, 0x7a, 0x25, 0x00, 0x01, 0x2c, 0x81, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x9e, 0x49, 0x00, 0x01, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a,
+	0x35, 0x00, 0x16, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x16, 0x06, 0x47, 0x9c, 0xeb, 0xff, 0xff, 0xd9, 0x85, 0x30, 0x00, 0x11,
+	0x54, 0xa9, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xa4,
+	0x4f, 0x00, 0x01, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x12, 0x54, 0xa9, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xa4, 0x4f, 0x00, 0x04, 0x02, 0x2c, 0x7e, 0xd1, 0xfc, 0xff, 0xff, 0xf7,
+	0xe5, 0xc7, 0xa5, 0x84, 0x6a, 0x61, 0x69, 0x7a, 0x91, 0xba, 0xe1, 0xf5, 0xd8, 0xd5, 0xdb, 0xfc, 0xff, 0xff, 0xb8, 0x63, 0x0e, 0x00, 0x05, 0x12,
+	0x52, 0xa7, 0xea, 0xff, 0xf8, 0xdf, 0xcc, 0xc7, 0xdb, 0xed, 0xf9, 0xfe, 0xff, 0xff, 0xff, 0xfc, 0xf4, 0xe6, 0xcc, 0xa3, 0x6b, 0x33, 0x0f, 0x00,
+	0x19, 0x25, 0x79, 0xce, 0xfe, 0xff, 0xf0, 0xa5, 0x50, 0x09, 0x00, 0x0c, 0x06, 0x10, 0x1d, 0x28, 0x2e, 0x2e, 0x26, 0x18, 0x0b, 0x02, 0x00, 0x0d,
+	0x47, 0x9c, 0xf1, 0xff, 0xff, 0xd2, 0x7d, 0x28, 0x00, 0x01, 0x2c, 0x81, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xd3, 0x7e, 0x29, 0x00, 0x02, 0x30, 0x68, 0xa0, 0xa8, 0x8b, 0x53, 0x1b, 0x00, 0x12, 0x06, 0x12, 0x24, 0x31, 0x33, 0x29, 0x18, 0x0a,
+	0x02, 0x00, 0x13, 0x03, 0x0a, 0x16, 0x22, 0x2f, 0x37, 0x37, 0x31, 0x27, 0x1d, 0x11, 0x08, 0x01, 0x00, 0x0e, 0x01, 0x08, 0x12, 0x1f, 0x2a, 0x34,
+	0x39, 0x37, 0x2f, 0x25, 0x1b, 0x0f, 0x06, 0x01, 0x00, 0x07, 0x02, 0x14, 0x2d, 0x46, 0x4c, 0x3d, 0x21, 0x0a, 0x00, 0xf8, 0x09, 0x2b, 0x5f, 0x9b,
+	0xcc, 0xed, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf7, 0xe5, 0xc2, 0x91, 0x51, 0x20, 0x32, 0x83, 0xd8, 0xff, 0xff, 0xb8, 0x63, 0x0e, 0x00,
+	0x05, 0x08, 0x21, 0x49, 0x7a, 0x8d, 0x69, 0x30, 0x05, 0x00, 0x02, 0x01, 0x0a, 0x18, 0x24, 0x24, 0x18, 0x0a, 0x02, 0x00, 0x7c, 0x05, 0x21, 0x53,
+	0x94, 0xc7, 0xea, 0xf8, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf0, 0xd2, 0xa2, 0x64, 0x2e, 0x0c, 0x00, 0x08, 0x12, 0x3a, 0x6d, 0x9a, 0xbd,
+	0xdd, 0xf3, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xee, 0xd1, 0xa6, 0x6b, 0x34, 0x0b, 0x00, 0x06, 0x0d, 0x38, 0x71, 0xaa,
+	0xd2, 0xee, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf2, 0xdd, 0xbf, 0x86, 0x47, 0x11, 0x00, 0x02, 0x15, 0x64, 0xb9, 0xf9,
+	0xff, 0xff, 0xff, 0xe7, 0x93, 0x3e, 0x00, 0x02, 0x03, 0x08, 0x0c, 0x0e, 0x0c, 0x08, 0x03, 0x00, 0x04, 0x05, 0x13, 0x24, 0x32, 0x37, 0x33, 0x25,
+	0x13, 0x06, 0x00, 0x0b, 0x08, 0x17, 0x28, 0x34, 0x34, 0x27, 0x13, 0x04, 0x00, 0x0a, 0x01, 0x06, 0x0b, 0x0e, 0x0e, 0x0e, 0x0b, 0x06, 0x01, 0x00,
+	0x0b, 0x04, 0x08, 0x0d, 0x0e, 0x0e, 0x0e, 0x0a, 0x05, 0x00, 0x0c, 0x05, 0x0a, 0x0e, 0x0e, 0x0e, 0x0b, 0x07, 0x02, 0x00, 0x01, 0x04, 0x09, 0x0d,
+	0x0e, 0x0e, 0x0c, 0x08, 0x03, 0x00, 0x10, 0x05, 0x09, 0x0e, 0x0e, 0x0e, 0x0c, 0x07, 0x02, 0x00, 0x01, 0x01, 0x06, 0x0a, 0x0e, 0x0e, 0x0e, 0x0d,
+	0x09, 0x04, 0x00, 0x0d, 0x05, 0x09, 0x0e, 0x0e, 0x0e, 0x0e, 0x0a, 0x05, 0x01, 0x00, 0x0c, 0x12, 0x62, 0xb2, 0xf0, 0xf0, 0xb8, 0x68, 0x18, 0x00,
+	0x0c, 0x03, 0x08, 0x0c, 0x0e, 0x0c, 0x08, 0x03, 0x00, 0x04, 0x03, 0x0f, 0x1f, 0x2f, 0x36, 0x30, 0x1f, 0x0b, 0x01, 0x00, 0x0f, 0x03, 0x19, 0x45,
+	0x7f, 0xa5, 0xb6, 0xb7, 0x8f, 0x52, 0x15, 0x00, 0x0b, 0x02, 0x09, 0x14, 0x20, 0x29, 0x2b, 0x26, 0x19, 0x0c, 0x03, 0x00, 0x31, 0x02, 0x07, 0x0b,
+	0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0a, 0x05, 0x01, 0x00, 0x01, 0x03,
+	0x08, 0x0c, 0x0e, 0x0c, 0x08, 0x03, 0x00, 0x04, 0x03, 0x0e, 0x1d, 0x2e, 0x39, 0x3c, 0x37, 0x28, 0x15, 0x05, 0x00, 0x1a, 0x08, 0x20, 0x45, 0x3d,
+	0x25, 0x00, 0x1f, 0x15, 0x58, 0xac, 0xeb, 0xfe, 0xff, 0xf7, 0xe4, 0xc4, 0x9f, 0x7a, 0x5f, 0x55, 0x5e, 0x75, 0x9f, 0xcf, 0xf3, 0xff, 0xff, 0xf3,
+	0xb7, 0x62, 0x19, 0x00, 0x06, 0x05, 0x3b, 0x90, 0xd7, 0xe1, 0xc1, 0x9f, 0x84, 0x71, 0x64, 0x57, 0x4e, 0x4d, 0x55, 0x6a, 0x8d, 0xc1, 0xe8, 0xfe,
+	0xff, 0xfd, 0xdb, 0x8c, 0x39, 0x05, 0x00, 0x02, 0x08, 0x49, 0x9e, 0xea, 0xfe, 0xff, 0xf3, 0xcf, 0xa4, 0x7d, 0x6a, 0x58, 0x50, 0x52, 0x5e, 0x6c,
+	0x7e, 0x96, 0xb4, 0xd2, 0xba, 0x73, 0x24, 0x00, 0x03, 0x1a, 0x6d, 0xc2, 0xfc, 0xff, 0xff, 0xff, 0xef, 0x9c, 0x47, 0x01, 0x00, 0x01, 0x3f, 0x94,
+	0xe9, 0xff, 0xfa, 0xab, 0x57, 0x1e, 0x46, 0x88, 0xc1, 0xe7, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf7, 0xea, 0xcb, 0x90, 0x48, 0x13, 0x00,
+	0x01, 0x0d, 0x31, 0x69, 0xa5, 0xd3, 0xef, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xe8, 0xce, 0xaf, 0x90, 0x70, 0x41, 0x1c, 0x01, 0x00, 0x03, 0x07,
+	0x52, 0xa7, 0xf5, 0xff, 0xff, 0xe9, 0x94, 0x3f, 0x00, 0x0a, 0x1a, 0x6f, 0xc4, 0xfe, 0xff, 0xff, 0xff, 0xd9, 0x84, 0x2f, 0x00, 0x0a, 0x2a, 0x7f,
+	0xd4, 0xff, 0xff, 0xfa, 0xb1, 0x5c, 0x0c, 0x00, 0x01, 0x25, 0x79, 0xce, 0xfe, 0xff, 0xfc, 0xbc, 0x67, 0x15, 0x00, 0x0e, 0x32, 0x87, 0xdc, 0xff,
+	0xff, 0xf6, 0xaf, 0x5a, 0x0d, 0x00, 0x01, 0x01, 0x20, 0x69, 0xbd, 0xf3, 0xff, 0xff, 0xe8, 0xa3, 0x4e, 0x10, 0x00, 0x09, 0x13, 0x55, 0xaa, 0xeb,
+	0xff, 0xff, 0xf0, 0xb7, 0x63, 0x1c, 0x00, 0x0d, 0x13, 0x68, 0xbd, 0xff, 0xff, 0xc3, 0x6e, 0x19, 0x00, 0x0c, 0x3f, 0x94, 0xe9, 0xff, 0xfa, 0xab,
+	0x56, 0x1c, 0x42, 0x81, 0xb9, 0xe2, 0xf7, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xf4, 0xe1, 0xc5, 0xa7, 0x89, 0x69, 0x3c, 0x18, 0x00, 0x05, 0x02, 0x16,
+	0x40, 0x7d, 0xbc, 0xe7, 0xf5, 0xf2, 0xf2, 0xfa, 0xff, 0xc7, 0x72, 0x1d, 0x00, 0x22, 0x23, 0x3b, 0x45, 0x22, 0x0a, 0x00, 0x1f, 0x2c, 0x81, 0xd6,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x6a, 0x15, 0x00, 0x01, 0x3f,
+	0x94, 0xe9, 0xff, 0xf6, 0xa2, 0x4d, 0x03, 0x1e, 0x54, 0x99, 0xd2, 0xf1, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xb7, 0x62, 0x0d, 0x00, 0x14, 0x05, 0x19,
+	0x3c, 0x68, 0x94, 0xc0, 0xe4, 0xf9, 0xfe, 0xa9, 0x54, 0x00, 0x1d, 0x05, 0x38, 0x8c, 0xdc, 0xfe, 0xff, 0xf7, 0xb1, 0x5c, 0x0f, 0x00, 0x08, 0x14,
+	0x60, 0xb5, 0xf5, 0xff, 0xff, 0xe4, 0x94, 0x3f, 0x04, 0x00, 0x06, 0x03, 0x03, 0x03, 0x00, 0x0b, 0x11, 0x60, 0xb5, 0xf9, 0xff, 0xff, 0xd5, 0x80,
+	0x2b, 0x00, 0x02, 0x34, 0x89, 0xde, 0xff, 0xff, 0xe9, 0x97, 0x42, 0x03, 0x00, 0x12, 0x08, 0x23, 0x47, 0x65, 0x6b, 0x5b, 0x36, 0x15, 0x01, 0x00,
+	0x02, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xe9, 0xdd, 0xdd, 0xef, 0xe1, 0xb6, 0x89, 0x6d, 0x5c, 0x55, 0x5f, 0x7c, 0x9f, 0xc5, 0xe4, 0xf8, 0xff, 0xff,
+	0xf1, 0xc6, 0xaf, 0xbc, 0xe7, 0xf7, 0xda, 0xae, 0x83, 0x69, 0x59, 0x55, 0x62, 0x81, 0xa4, 0xca, 0xe8, 0xfa, 0xff, 0xff, 0xf0, 0xae, 0x59, 0x13,
+	0x00, 0x03, 0x13, 0x66, 0xbb, 0xfd, 0xff, 0xff, 0xcd, 0x78, 0x23, 0x00, 0x08, 0x12, 0x63, 0xb8, 0xfb, 0xf9, 0xf3, 0xf3, 0xf9, 0xff, 0xcb, 0x76,
+	0x21, 0x00, 0x08, 0x12, 0x66, 0xbb, 0xfd, 0xff, 0xfe, 0xc4, 0x6f, 0x1a, 0x00, 0x03, 0x23, 0x77, 0xcc, 0xfe, 0xff, 0xfb, 0xba, 0x65, 0x14, 0x00,
+	0x0c, 0x30, 0x85, 0xda, 0xff, 0xff, 0xf5, 0xad, 0x58, 0x0c, 0x00, 0x04, 0x01, 0x21, 0x6b, 0xbf, 0xf3, 0xff, 0xfe, 0xdf, 0x95, 0x40, 0x0a, 0x00,
+	0x05, 0x0d, 0x46, 0x9b, 0xe3, 0xfe, 0xff, 0xf0, 0xb8, 0x64, 0x1d, 0x00, 0x0f, 0x13, 0x68, 0xbd, 0xff, 0xff, 0xc3, 0x6e, 0x19, 0x00, 0x0c, 0x3f,
+	0x94, 0xe9, 0xff, 0xff, 0xe9, 0xdc, 0xdc, 0xf0, 0xe9, 0xc1, 0x93, 0x74, 0x63, 0x55, 0x57, 0x69, 0x89, 0xab, 0xce, 0xea, 0xfb, 0xff, 0xff, 0xec,
+	0xa9, 0x54, 0x11, 0x00, 0x03, 0x21, 0x6a, 0xbe, 0xe0, 0xc4, 0x85, 0x43, 0x65, 0xa5, 0xf9, 0xff, 0xc7, 0x72, 0x1d, 0x00, 0x10, 0x01, 0x02, 0x02,
+	0x01, 0x00, 0x0e, 0x4e, 0xa3, 0xf8, 0xf9, 0xe6, 0xc3, 0x97, 0x6b, 0x3f, 0x1b, 0x06, 0x00, 0x19, 0x0e, 0x2a, 0x46, 0x53, 0x53, 0x53, 0x53, 0x53,
+	0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x5c, 0x8b, 0xc5, 0xf5, 0xff, 0xff, 0xee, 0xa3, 0x4e, 0x0a, 0x00, 0x01, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xc2,
+	0x96, 0x90, 0xcd, 0xf7, 0xe9, 0xca, 0xa5, 0x8c, 0x7b, 0x72, 0x73, 0x73, 0x4d, 0x24, 0x00, 0x0f, 0x02, 0x13, 0x32, 0x5d, 0x8a, 0xb6, 0xdd, 0xf5,
+	0xff, 0xfc, 0xed, 0xcf, 0xa6, 0x7c, 0x52, 0x28, 0x0d, 0x00, 0x1d, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xf6, 0xaf, 0x5a, 0x0d, 0x00, 0x0a, 0x12, 0x67,
+	0xbc, 0xff, 0xff, 0xff, 0xd0, 0x7b, 0x26, 0x00, 0x15, 0x31, 0x86, 0xdb, 0xff, 0xff, 0xf3, 0x9e, 0x49, 0x00, 0x02, 0x1c, 0x71, 0xc6, 0xfe, 0xff,
+	0xfb, 0xd4, 0x93, 0x45, 0x17, 0x03, 0x00, 0x1b, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xff, 0xfc, 0xc8, 0x76, 0x23, 0x03, 0x00, 0x07, 0x06, 0x52, 0xa7,
+	0xf5, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xb8, 0x63, 0x17, 0x00, 0x08, 0x0c, 0x5d, 0xb2, 0xfa, 0xff, 0xff, 0xfb, 0xa9, 0x54, 0x03, 0x00, 0x03, 0x25,
+	0x7a, 0xcf, 0xff, 0xff, 0xfb, 0xb2, 0x5d, 0x0b, 0x00, 0x06, 0x0b, 0x58, 0xad, 0xf7, 0xff, 0xc7, 0x8e, 0x8e, 0xc6, 0xff, 0xfd, 0xbd, 0x68, 0x15,
+	0x00, 0x06, 0x04, 0x4c, 0xa1, 0xf2, 0xff, 0xff, 0xd7, 0x82, 0x2d, 0x00, 0x05, 0x21, 0x75, 0xca, 0xfe, 0xff, 0xfa, 0xb8, 0x63, 0x13, 0x00, 0x0a,
+	0x2e, 0x83, 0xd8, 0xff, 0xff, 0xf4, 0xab, 0x56, 0x0b, 0x00, 0x07, 0x01, 0x23, 0x6d, 0xc0, 0xf4, 0xff, 0xfc, 0xd5, 0x86, 0x34, 0x05, 0x00, 0x01,
+	0x07, 0x39, 0x8d, 0xda, 0xfd, 0xff, 0xf1, 0xb9, 0x64, 0x1d, 0x00, 0x06, 0x02, 0x04, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x19,
+	0x6c, 0xbf, 0xff, 0xff, 0xc4, 0x71, 0x1e, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x04, 0x02, 0x00, 0x01, 0x3f, 0x94, 0xe9, 0xff,
+	0xff, 0xff, 0xfd, 0xcf, 0x7f, 0x2c, 0x05, 0x00, 0x08, 0x10, 0x62, 0xb7, 0xfb, 0xff, 0xff, 0xfa, 0xa8, 0x53, 0x03, 0x00, 0x04, 0x05, 0x05, 0x04,
+	0x00, 0x01, 0x02, 0x57, 0xac, 0xff, 0xff, 0xc7, 0x72, 0x1d, 0x00, 0x0d, 0x08, 0x43, 0x93, 0xdf, 0xf9, 0xf9, 0xdf, 0x94, 0x45, 0x0a, 0x00, 0x0b,
+	0x0c, 0x26, 0x4e, 0x79, 0xa3, 0xcc, 0xeb, 0xfb, 0xff, 0xf6, 0xdf, 0xb9, 0x8d, 0x60, 0x35, 0x14, 0x03, 0x00, 0x1f, 0x07, 0x35, 0x87, 0xd5, 0xfc,
+	0xff, 0xf0, 0xb7, 0x62, 0x1c, 0x00, 0x03, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xed, 0xb3, 0x62, 0x1f, 0x04, 0x00, 0x11, 0x01, 0x0e, 0x29,
+	0x53, 0x7f, 0xab, 0xd5, 0xf1, 0xfe, 0xfc, 0xeb, 0xcd, 0xa4, 0x7a, 0x50, 0x28, 0x0d, 0x01, 0x00, 0x21, 0x0d, 0x62, 0xb7, 0xfe, 0xff, 0xff, 0xed,
+	0xd0, 0xb4, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xc5, 0xe2, 0xfe, 0xff, 0xff, 0xf5, 0xa0, 0x4b, 0x00, 0x08,
+	0x0b, 0x22, 0x3f, 0x56, 0x64, 0x6f, 0x7b, 0x86, 0x90, 0x97, 0x9c, 0x9f, 0xa3, 0xb4, 0xd3, 0xf0, 0xff, 0xff, 0xf7, 0xa2, 0x4d, 0x00, 0x03, 0x0d,
+	0x3f, 0x8a, 0xd2, 0xf4, 0xff, 0xff, 0xfd, 0xef, 0xd3, 0xad, 0x87, 0x60, 0x39, 0x19, 0x06, 0x00, 0x15, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xff, 0xc2,
+	0x6d, 0x18, 0x00, 0x0a, 0x12, 0x66, 0xbb, 0xfd, 0xff, 0xff, 0xfd, 0xb1, 0x5c, 0x09, 0x00, 0x0a, 0x1c, 0x71, 0xc6, 0xff, 0xff, 0xff, 0xc8, 0x73,
+	0x1e, 0x00, 0x04, 0x38, 0x8d, 0xe2, 0xff, 0xff, 0xea, 0x96, 0x41, 0x00, 0x05, 0x05, 0x4d, 0xa2, 0xf1, 0xff, 0xe1, 0x8c, 0x37, 0x33, 0x88, 0xdd,
+	0xff, 0xf8, 0xae, 0x59, 0x0b, 0x00, 0x05, 0x33, 0x88, 0xdd, 0xff, 0xff, 0xe9, 0x95, 0x40, 0x01, 0x00, 0x06, 0x1f, 0x73, 0xc8, 0xfe, 0xff, 0xfa,
+	0xb6, 0x61, 0x11, 0x00, 0x08, 0x2c, 0x81, 0xd6, 0xff, 0xff, 0xf3, 0xa9, 0x54, 0x0a, 0x00, 0x0a, 0x02, 0x24, 0x6f, 0xc2, 0xf5, 0xff, 0xf9, 0xca,
+	0x7b, 0x56, 0x81, 0xcf, 0xfa, 0xff, 0xf1, 0xb9, 0x65, 0x1e, 0x00, 0x08, 0x4e, 0xa3, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xa9, 0x54, 0x00, 0x01, 0x3f, 0x94, 0xe9, 0xff,
+	0xff, 0xff, 0xc6, 0x71, 0x1c, 0x00, 0x0b, 0x1d, 0x72, 0xc7, 0xff, 0xff, 0xff, 0xc8, 0x73, 0x1e, 0x00, 0x08, 0x02, 0x57, 0xac, 0xff, 0xff, 0xc7,
+	0x72, 0x1d, 0x00, 0x0d, 0x16, 0x6a, 0xbf, 0xfe, 0xff, 0xff, 0xfe, 0xc2, 0x6d, 0x19, 0x00, 0x11, 0x0c, 0x26, 0x4d, 0x77, 0xa1, 0xca, 0xe9, 0xfb,
+	0xfe, 0xf2, 0xd7, 0xae, 0x82, 0x56, 0x2c, 0x0f, 0x01, 0x00, 0x17, 0x05, 0x30, 0x81, 0xd1, 0xfa, 0xff, 0xf3, 0xbd, 0x69, 0x1f, 0x01, 0x00, 0x04,
+	0x3f, 0x94, 0xe9, 0xff, 0xff, 0xff, 0xd8, 0x84, 0x2f, 0x01, 0x00, 0x0e, 0x09, 0x21, 0x48, 0x75, 0xa1, 0xcc, 0xeb, 0xfc, 0xfb, 0xea, 0xcb, 0xa1,
+	0x77, 0x4d, 0x26, 0x0c, 0x00, 0x28, 0x28, 0x7d, 0xd2, 0xff, 0xff, 0xff, 0xf2, 0xe4, 0xd5, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3,
+	0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd2, 0x8b, 0x45, 0x00, 0x04, 0x09, 0x3e, 0x83, 0xcc, 0xeb, 0xfb, 0xff, 0xfe, 0xf4, 0xe5, 0xd3,
+	0xc7, 0xbb, 0xb1, 0xa9, 0xa4, 0x9f, 0xaf, 0xce, 0xf0, 0xff, 0xff, 0xf7, 0xa2, 0x4d, 0x00, 0x06, 0x09, 0x26, 0x51, 0x80, 0xa9, 0xd0, 0xed, 0xfc,
+	0xff, 0xff, 0xff, 0xf7, 0xe2, 0xbb, 0x87, 0x4e, 0x20, 0x06, 0x00, 0x10, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xf8, 0xa4, 0x4f, 0x00, 0x0c, 0x4c, 0xa1,
+	0xf6, 0xff, 0xff, 0xe9, 0x94, 0x3f, 0x00, 0x0b, 0x02, 0x57, 0xac, 0xff, 0xff, 0xff, 0xd1, 0x7c, 0x27, 0x00, 0x04, 0x04, 0x4c, 0xa1, 0xf2, 0xff,
+	0xff, 0xcf, 0x7a, 0x25, 0x00, 0x03, 0x02, 0x41, 0x96, 0xe9, 0xff, 0xf3, 0xa3, 0x4e, 0x05, 0x03, 0x48, 0x9d, 0xef, 0xff, 0xf1, 0xa0, 0x4b, 0x04,
+	0x00, 0x03, 0x1a, 0x6f, 0xc4, 0xff, 0xff, 0xf6, 0xa8, 0x53, 0x07, 0x00, 0x08, 0x1d, 0x71, 0xc6, 0xfd, 0xff, 0xf9, 0xb4, 0x5f, 0x10, 0x00, 0x06,
+	0x2a, 0x7f, 0xd4, 0xff, 0xff, 0xf2, 0xa6, 0x51, 0x09, 0x00, 0x0d, 0x02, 0x25, 0x70, 0xc3, 0xf5, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xf1, 0xba, 0x66,
+	0x1e, 0x00, 0x0a, 0x26, 0x4f, 0x78, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x86, 0xb1, 0xdd, 0xff, 0xff, 0xe0, 0xb4, 0x89, 0x7c, 0x7c,
+	0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7b, 0x52, 0x28, 0x00, 0x01, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xf9, 0xa5, 0x50, 0x00, 0x0c, 0x02, 0x57, 0xac,
+	0xff, 0xff, 0xff, 0xd2, 0x7d, 0x28, 0x00, 0x08, 0x02, 0x57, 0xac, 0xff, 0xff, 0xc7, 0x72, 0x1d, 0x00, 0x0e, 0x0b, 0x2a, 0x51, 0x6c, 0x6b, 0x51,
+	0x2a, 0x0b, 0x00, 0x18, 0x0b, 0x23, 0x4a, 0x74, 0x9e, 0xc7, 0xe8, 0xfa, 0xfc, 0xed, 0xce, 0xa4, 0x78, 0x4b, 0x24, 0x0a, 0x00, 0x10, 0x03, 0x2b,
+	0x7a, 0xcc, 0xf9, 0xff, 0xf5, 0xc2, 0x6f, 0x23, 0x01, 0x00, 0x06, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xf9, 0xa7, 0x52, 0x03, 0x00, 0x0d, 0x3c, 0x8c,
+	0xe1, 0xf9, 0xff, 0xfe, 0xeb, 0xbf, 0x84, 0x4d, 0x24, 0x0b, 0x00, 0x2e, 0x0e, 0x62, 0xb7, 0xfe, 0xff, 0xff, 0xe2, 0x8d, 0x38, 0x00, 0x17, 0x1a,
+	0x68, 0xbd, 0xf8, 0xff, 0xee, 0xba, 0x74, 0x33, 0x12, 0x03, 0x00, 0x07, 0x33, 0x88, 0xdd, 0xff, 0xff, 0xf7, 0xa2, 0x4d, 0x00, 0x0c, 0x0c, 0x25,
+	0x4a, 0x75, 0xa6, 0xd4, 0xf3, 0xff, 0xff, 0xfd, 0xde, 0x95, 0x42, 0x0c, 0x00, 0x0e, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x0c,
+	0x4c, 0xa1, 0xf6, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x0b, 0x02, 0x57, 0xac, 0xff, 0xff, 0xff, 0xd1, 0x7c, 0x27, 0x00, 0x05, 0x0e, 0x60, 0xb5,
+	0xfb, 0xff, 0xfb, 0xb3, 0x5e, 0x0c, 0x00, 0x02, 0x36, 0x8b, 0xe0, 0xff, 0xf9, 0xb2, 0x5d, 0x0d, 0x00, 0x02, 0x0b, 0x5a, 0xaf, 0xf8, 0xff, 0xe6,
+	0x92, 0x3d, 0x01, 0x00, 0x01, 0x08, 0x56, 0xab, 0xf8, 0xff, 0xfd, 0xbb, 0x66, 0x13, 0x00, 0x0a, 0x1c, 0x6f, 0xc4, 0xfd, 0xff, 0xf8, 0xb3, 0x5e,
+	0x0f, 0x00, 0x04, 0x28, 0x7d, 0xd2, 0xff, 0xff, 0xf1, 0xa4, 0x4f, 0x08, 0x00, 0x10, 0x18, 0x68, 0xbd, 0xfa, 0xff, 0xff, 0xff, 0xf6, 0xb2, 0x5d,
+	0x11, 0x00, 0x16, 0x13, 0x68, 0xbd, 0xff, 0xff, 0xc3, 0x6e, 0x19, 0x00, 0x0c, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x0c, 0x02,
+	0x57, 0xac, 0xff, 0xff, 0xff, 0xd2, 0x7d, 0x28, 0x00, 0x08, 0x02, 0x57, 0xac, 0xff, 0xff, 0xc7, 0x72, 0x1d, 0x00, 0x03, 0x02, 0x04, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x04, 0x02, 0x00, 0x13, 0x0a, 0x21, 0x48, 0x7e, 0xba, 0xe8, 0xfd, 0xff, 0xfa, 0xe6, 0x91, 0x41, 0x00, 0x0c, 0x02, 0x27, 0x74, 0xc6, 0xf7, 0xff,
+	0xf7, 0xc7, 0x75, 0x27, 0x02, 0x00, 0x08, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x0e, 0x1f, 0x4e, 0x8a, 0xb4, 0xd8, 0xf1, 0xfd,
+	0xfd, 0xf2, 0xda, 0xb6, 0x91, 0x6c, 0x47, 0x24, 0x0c, 0x01, 0x00, 0x2a, 0x3c, 0x91, 0xe6, 0xff, 0xff, 0xff, 0xd6, 0x81, 0x2c, 0x00, 0x14, 0x02,
+	0x32, 0x87, 0xda, 0xfe, 0xff, 0xec, 0x97, 0x42, 0x00, 0x0a, 0x05, 0x54, 0xa9, 0xf9, 0xff, 0xff, 0xf7, 0xa2, 0x4d, 0x00, 0x11, 0x0d, 0x4a, 0x9f,
+	0xe7, 0xff, 0xff, 0xf0, 0x9c, 0x47, 0x01, 0x00, 0x0d, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x0c, 0x4c, 0xa1, 0xf6, 0xff, 0xff,
+	0xdf, 0x8a, 0x35, 0x00, 0x0b, 0x02, 0x57, 0xac, 0xff, 0xff, 0xff, 0xd1, 0x7c, 0x27, 0x00, 0x06, 0x1f, 0x74, 0xc9, 0xff, 0xff, 0xe9, 0x94, 0x3f,
+	0x00, 0x01, 0x29, 0x7e, 0xd3, 0xff, 0xfd, 0xc0, 0x6b, 0x17, 0x00, 0x04, 0x15, 0x69, 0xbe, 0xfd, 0xff, 0xd7, 0x82, 0x2d, 0x00, 0x01, 0x39, 0x8e,
+	0xe3, 0xff, 0xff, 0xce, 0x79, 0x24, 0x00, 0x0c, 0x1a, 0x6d, 0xc2, 0xfd, 0xff, 0xf7, 0xaf, 0x5a, 0x0c, 0x00, 0x02, 0x24, 0x79, 0xce, 0xff, 0xff,
+	0xf0, 0xa2, 0x4d, 0x07, 0x00, 0x0f, 0x15, 0x55, 0xaa, 0xea, 0xff, 0xfd, 0xe7, 0xe7, 0xe8, 0xfe, 0xfe, 0xe3, 0x9e, 0x49, 0x0f, 0x00, 0x14, 0x13,
+	0x68, 0xbd, 0xff, 0xff, 0xc3, 0x6e, 0x19, 0x00, 0x0c, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x0c, 0x02, 0x57, 0xac, 0xff, 0xff,
+	0xff, 0xd2, 0x7d, 0x28, 0x00, 0x08, 0x02, 0x57, 0xac, 0xff, 0xff, 0xc7, 0x72, 0x1d, 0x00, 0x03, 0x4e, 0xa3, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xa9, 0x54, 0x00, 0x0f,
+	0x0b, 0x21, 0x44, 0x69, 0x8e, 0xb3, 0xd7, 0xf0, 0xfd, 0xfe, 0xf3, 0xdb, 0xb7, 0x8f, 0x52, 0x22, 0x00, 0x0a, 0x01, 0x22, 0x6d, 0xc1, 0xf5, 0xff,
+	0xf9, 0xcc, 0x7a, 0x2b, 0x03, 0x00, 0x0a, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x12, 0x02, 0x10, 0x2b, 0x51, 0x78, 0x9f, 0xc6,
+	0xe6, 0xf9, 0xff, 0xfc, 0xef, 0xd5, 0xb1, 0x8c, 0x66, 0x41, 0x1f, 0x09, 0x00, 0x24, 0x05, 0x33, 0x86, 0xd6, 0xfd, 0xff, 0xff, 0xd2, 0x8d, 0x3c,
+	0x14, 0x04, 0x00, 0x0b, 0x02, 0x08, 0x08, 0x05, 0x00, 0x02, 0x01, 0x4a, 0x9f, 0xf2, 0xff, 0xff, 0xf9, 0xb7, 0x62, 0x13, 0x00, 0x08, 0x1b, 0x64,
+	0xb8, 0xf2, 0xff, 0xff, 0xff, 0xf7, 0xa2, 0x4d, 0x00, 0x01, 0x03, 0x07, 0x07, 0x04, 0x00, 0x0c, 0x01, 0x30, 0x85, 0xd9, 0xff, 0xff, 0xeb, 0x96,
+	0x41, 0x00, 0x03, 0x0c, 0x2c, 0x54, 0x73, 0x79, 0x69, 0x41, 0x1b, 0x03, 0x00, 0x02, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x0c,
+	0x4c, 0xa1, 0xf6, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x0b, 0x02, 0x57, 0xac, 0xff, 0xff, 0xff, 0xd1, 0x7c, 0x27, 0x00, 0x07, 0x32, 0x87, 0xdc,
+	0xff, 0xff, 0xc4, 0x6f, 0x2d, 0x67, 0xbc, 0xfe, 0xff, 0xcd, 0x78, 0x23, 0x00, 0x06, 0x23, 0x78, 0xcd, 0xff, 0xfe, 0xc1, 0x6c, 0x2d, 0x6a, 0xbf,
+	0xff, 0xff, 0xe1, 0x8c, 0x37, 0x00, 0x0e, 0x18, 0x6b, 0xc0, 0xfc, 0xff, 0xf3, 0xa4, 0x4f, 0x06, 0x1b, 0x6f, 0xc4, 0xfe, 0xff, 0xef, 0xa0, 0x4b,
+	0x06, 0x00, 0x0e, 0x14, 0x54, 0xa9, 0xe9, 0xff, 0xfe, 0xe2, 0x9a, 0x45, 0x1c, 0x4c, 0xa1, 0xe6, 0xff, 0xfe, 0xe3, 0x9d, 0x49, 0x0f, 0x00, 0x12,
+	0x13, 0x68, 0xbd, 0xff, 0xff, 0xc3, 0x6e, 0x19, 0x00, 0x0c, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x0c, 0x02, 0x57, 0xac, 0xff,
+	0xff, 0xff, 0xd2, 0x7d, 0x28, 0x00, 0x08, 0x02, 0x57, 0xac, 0xff, 0xff, 0xc7, 0x72, 0x1d, 0x00, 0x03, 0x26, 0x4f, 0x78, 0x7c, 0x7c, 0x7c, 0x7c,
+	0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7b, 0x52, 0x28, 0x00,
+	0x08, 0x08, 0x1d, 0x3e, 0x63, 0x89, 0xae, 0xd2, 0xed, 0xfc, 0xff, 0xf9, 0xe7, 0xc8, 0xa2, 0x7b, 0x54, 0x2d, 0x11, 0x02, 0x00, 0x0d, 0x1e, 0x67,
+	0xbb, 0xf2, 0xff, 0xfa, 0xd1, 0x81, 0x30, 0x05, 0x00, 0x0c, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x19, 0x07, 0x1b, 0x3c, 0x63,
+	0x8a, 0xb1, 0xd6, 0xf0, 0xfd, 0xff, 0xfb, 0xec, 0xd0, 0xab, 0x86, 0x61, 0x3b, 0x1b, 0x07, 0x00, 0x1f, 0x0d, 0x46, 0x97, 0xdf, 0xfa, 0xff, 0xff,
+	0xff, 0xf8, 0xe6, 0xc9, 0xa7, 0x87, 0x73, 0x6c, 0x70, 0x78, 0x84, 0x95, 0xaa, 0xc4, 0xe0, 0xca, 0x7f, 0x2b, 0x00, 0x03, 0x15, 0x5d, 0xb2, 0xf2,
+	0xff, 0xff, 0xfb, 0xdd, 0xb6, 0x8a, 0x6e, 0x5a, 0x55, 0x5e, 0x70, 0x8e, 0xb9, 0xe2, 0xef, 0xcf, 0xcd, 0xd6, 0xfc, 0xff, 0xf7, 0xa2, 0x4d, 0x00,
+	0x01, 0x18, 0x6c, 0xb8, 0xe1, 0xc4, 0xa7, 0x8e, 0x78, 0x67, 0x5b, 0x53, 0x52, 0x55, 0x5d, 0x6b, 0x83, 0xac, 0xd7, 0xf5, 0xff, 0xfd, 0xe1, 0x97,
+	0x44, 0x0b, 0x00, 0x02, 0x1d, 0x71, 0xc6, 0xfe, 0xff, 0xff, 0xff, 0xf3, 0xa0, 0x4b, 0x02, 0x00, 0x01, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95,
+	0x40, 0x00, 0x0c, 0x4c, 0xa1, 0xf6, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x0b, 0x02, 0x57, 0xac, 0xff, 0xff, 0xff, 0xd1, 0x7c, 0x27, 0x00, 0x07,
+	0x02, 0x46, 0x9b, 0xee, 0xff, 0xef, 0x9d, 0x8f, 0x9e, 0xf1, 0xff, 0xda, 0x85, 0x30, 0x00, 0x08, 0x33, 0x88, 0xdd, 0xff, 0xf6, 0xa6, 0x93, 0x9b,
+	0xeb, 0xff, 0xf0, 0x9f, 0x4a, 0x03, 0x00, 0x0f, 0x17, 0x69, 0xbe, 0xfb, 0xff, 0xe9, 0x95, 0x4f, 0x61, 0xb5, 0xfb, 0xff, 0xed, 0x9e, 0x49, 0x06,
+	0x00, 0x0d, 0x14, 0x52, 0xa7, 0xe8, 0xff, 0xff, 0xe9, 0xa6, 0x51, 0x11, 0x00, 0x03, 0x16, 0x59, 0xae, 0xed, 0xff, 0xfe, 0xe2, 0x9c, 0x48, 0x0f,
+	0x00, 0x10, 0x07, 0x25, 0x44, 0x5c, 0x5c, 0x46, 0x28, 0x09, 0x00, 0x0c, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x0c, 0x02, 0x57,
+	0xac, 0xff, 0xff, 0xff, 0xd2, 0x7d, 0x28, 0x00, 0x09, 0x09, 0x11, 0x1a, 0x1a, 0x14, 0x0b, 0x03, 0x00, 0x22, 0x06, 0x19, 0x39, 0x5e, 0x83, 0xa8,
+	0xcd, 0xea, 0xfa, 0xff, 0xfd, 0xf1, 0xd8, 0xb4, 0x8d, 0x66, 0x3f, 0x1d, 0x08, 0x00, 0x12, 0x1a, 0x60, 0xb5, 0xf0, 0xff, 0xfc, 0xd5, 0x87, 0x35,
+	0x06, 0x00, 0x0e, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x1f, 0x01, 0x0e, 0x28, 0x4e, 0x75, 0x9c, 0xc3, 0xe4, 0xf8, 0xff, 0xfe,
+	0xa9, 0x54, 0x00, 0x21, 0x01, 0x11, 0x34, 0x6a, 0xa1, 0xca, 0xe5, 0xf3, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xef, 0xd9, 0xbc,
+	0x88, 0x49, 0x15, 0x00, 0x04, 0x01, 0x1e, 0x51, 0x93, 0xc8, 0xea, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf5, 0xe1, 0xb9, 0x83, 0x44, 0x17,
+	0x24, 0x78, 0xcd, 0xff, 0xf7, 0xa2, 0x4d, 0x00, 0x01, 0x0c, 0x40, 0x7e, 0xba, 0xda, 0xf1, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xfe, 0xf4, 0xdd, 0xba, 0x92, 0x5b, 0x2a, 0x07, 0x00, 0x04, 0x12, 0x5e, 0xb3, 0xf5, 0xff, 0xff, 0xfe, 0xe2, 0x8d, 0x38, 0x00, 0x02, 0x3f, 0x94,
+	0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x0c, 0x4c, 0xa1, 0xf6, 0xff, 0xff, 0xdf, 0x8a, 0x35, 0x00, 0x0b, 0x02, 0x57, 0xac, 0xff, 0xff, 0xff,
+	0xd1, 0x7c, 0x27, 0x00, 0x08, 0x0b, 0x5a, 0xaf, 0xf9, 0xff, 0xe7, 0xe7, 0xe7, 0xff, 0xe6, 0x92, 0x3d, 0x01, 0x00, 0x08, 0x02, 0x42, 0x97, 0xea,
+	0xff, 0xe8, 0xe8, 0xe8, 0xff, 0xfa, 0xb2, 0x5d, 0x0d, 0x00, 0x11, 0x15, 0x67, 0xbc, 0xfb, 0xff, 0xd9, 0xcc, 0xcc, 0xf1, 0xff, 0xec, 0x9c, 0x47,
+	0x05, 0x00, 0x0c, 0x13, 0x52, 0xa7, 0xe8, 0xff, 0xff, 0xef, 0xb2, 0x5d, 0x18, 0x00, 0x07, 0x1d, 0x66, 0xbb, 0xf3, 0xff, 0xfe, 0xe2, 0x9b, 0x47,
+	0x0e, 0x00, 0x03, 0x28, 0x53, 0x7e, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
+	0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x56, 0x2a, 0x00, 0x01, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x0c, 0x02, 0x57, 0xac,
+	0xff, 0xff, 0xff, 0xd2, 0x7d, 0x28, 0x00, 0x1d, 0x07, 0x40, 0x8d, 0xd9, 0xf4, 0xf4, 0xd9, 0x8e, 0x42, 0x09, 0x00, 0x0b, 0x4e, 0xa3, 0xf8, 0xff,
+	0xf9, 0xe6, 0xc6, 0x9f, 0x78, 0x51, 0x2b, 0x10, 0x02, 0x00, 0x16, 0x11, 0x54, 0xa9, 0xed, 0xff, 0xff, 0xf7, 0xcb, 0x96, 0x69, 0x61, 0x61, 0x61,
+	0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x5a, 0x3a, 0x19, 0x00, 0x01, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x26,
+	0x06, 0x19, 0x39, 0x5f, 0x4c, 0x2c, 0x00, 0x28, 0x02, 0x09, 0x16, 0x24, 0x2d, 0x2f, 0x2a, 0x23, 0x17, 0x0b, 0x03, 0x00, 0x0e, 0x05, 0x0e, 0x1a,
+	0x26, 0x2b, 0x2a, 0x23, 0x17, 0x0b, 0x02, 0x00, 0x11, 0x05, 0x0b, 0x14, 0x1c, 0x24, 0x2b, 0x2d, 0x29, 0x20, 0x16, 0x0c, 0x05, 0x01, 0x00, 0x0b,
+	0x0d, 0x23, 0x39, 0x3f, 0x2f, 0x18, 0x05, 0x00, 0x03, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x0c, 0x4c, 0xa1, 0xf6, 0xff, 0xff,
+	0xdf, 0x8a, 0x35, 0x00, 0x0b, 0x02, 0x57, 0xac, 0xff, 0xff, 0xff, 0xd1, 0x7c, 0x27, 0x00, 0x09, 0x19, 0x6e, 0xc3, 0xfe, 0xff, 0xff, 0xff, 0xf0,
+	0xa0, 0x4b, 0x04, 0x00, 0x0a, 0x07, 0x52, 0xa7, 0xf4, 0xff, 0xff, 0xff, 0xfe, 0xc5, 0x70, 0x1b, 0x00, 0x13, 0x14, 0x65, 0xba, 0xfa, 0xff, 0xff,
+	0xff, 0xff, 0xea, 0x9a, 0x45, 0x04, 0x00, 0x0b, 0x13, 0x50, 0xa5, 0xe7, 0xff, 0xff, 0xf4, 0xbd, 0x69, 0x1f, 0x00, 0x0a, 0x02, 0x26, 0x74, 0xc7,
+	0xf8, 0xff, 0xfe, 0xe1, 0x9a, 0x46, 0x0e, 0x00, 0x01, 0x4e, 0xa3, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xa9, 0x54, 0x00, 0x01, 0x3f, 0x94, 0xe9, 0xff, 0xff, 0xea, 0x95,
+	0x40, 0x00, 0x0c, 0x02, 0x57, 0xac, 0xff, 0xff, 0xff, 0xd2, 0x7d, 0x28, 0x00, 0x06, 0x37, 0x74, 0xb1, 0xb7, 0xb7, 0xb0, 0x73, 0x36, 0x00, 0x0f,
+	0x17, 0x6b, 0xc0, 0xfe, 0xff, 0xff, 0xfe, 0xc4, 0x6f, 0x1a, 0x00, 0x0b, 0x29, 0x4a, 0x5e, 0x3c, 0x1b, 0x07, 0x00, 0x1d, 0x2c, 0x81, 0xd6, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0x98, 0x43, 0x00, 0x01, 0x3f,
+	0x94, 0xe9, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0xff, 0x00, 0x90, 0x3b, 0x90, 0xe5, 0xff, 0xff, 0xe4, 0x8f, 0x3a, 0x00, 0x10, 0x0d, 0x2e, 0x57,
+	0x72, 0x72, 0x57, 0x2e, 0x0d, 0x00, 0x6c, 0x25, 0x6b, 0xb0, 0xd2, 0xbf, 0x7d, 0x37, 0x04, 0x00, 0x18, 0x02, 0x3a, 0x72, 0xa8, 0xa9, 0xa9, 0xa5,
+	0x6d, 0x35, 0x00, 0x18, 0x12, 0x62, 0xb2, 0xf0, 0xf0, 0xb8, 0x68, 0x18, 0x00, 0x0d, 0x03, 0x1e, 0x52, 0x73, 0x61, 0x2c, 0x08, 0x00, 0x04, 0x01,
+	0x07, 0x0c, 0x0c, 0x07, 0x01, 0x00, 0x04, 0x09, 0x2d, 0x62, 0x75, 0x54, 0x1f, 0x03, 0x00, 0x03, 0x03, 0x17, 0x3b, 0x6a, 0x91, 0xb0, 0xc6, 0xd5,
+	0xdf, 0xe0, 0xda, 0xcf, 0xbe, 0xa1, 0x79, 0x43, 0x1a, 0x01, 0x00, 0x04, 0x01, 0x10, 0x32, 0x63, 0x8d, 0xa9, 0xbd, 0xcf, 0xda, 0xdb, 0xd1, 0xbe,
+	0x9f, 0x72, 0x3b, 0x14, 0x00, 0x0c, 0x0d, 0x3f, 0x70, 0x81, 0x5b, 0x2a, 0x0b, 0x00, 0x05, 0x05, 0x2b, 0x62, 0x82, 0x6c, 0x37, 0x13, 0x01, 0x00,
+	0x02, 0x0e, 0x2f, 0x62, 0x82, 0x6b, 0x37, 0x09, 0x00, 0x05, 0x08, 0x23, 0x51, 0x7e, 0x77, 0x49, 0x13, 0x00, 0x0b, 0x14, 0x3c, 0x4b, 0x37, 0x10,
+	0x00, 0x0e, 0x0c, 0x32, 0x4b, 0x41, 0x1b, 0x02, 0x00, 0x05, 0x03, 0x18, 0x43, 0x79, 0xa3, 0xbd, 0xcd, 0xd6, 0xd4, 0xc7, 0xb3, 0x91, 0x60, 0x2c,
+	0x0c, 0x00, 0x05, 0x11, 0x36, 0x67, 0x91, 0xac, 0xc0, 0xce, 0xd6, 0xd1, 0xc0, 0xa7, 0x8f, 0x72, 0x42, 0x1a, 0x00, 0x03, 0x06, 0x0c, 0x13, 0x14,
+	0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x13,
+	0x0d, 0x06, 0x00, 0x01, 0x02, 0x04, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x04, 0x02, 0x00, 0x04, 0x02, 0x15, 0x3b, 0x70, 0x9d, 0xbc, 0xcf, 0xdc, 0xdf, 0xd6, 0xc5, 0xac,
+	0x85, 0x52, 0x23, 0x08, 0x00, 0x04, 0x27, 0x7c, 0xd1, 0xff, 0xff, 0xd0, 0x7b, 0x26, 0x00, 0x24, 0x37, 0x74, 0xb1, 0xb7, 0xb7, 0xb0, 0x73, 0x36,
+	0x00, 0x02, 0x01, 0x3d, 0x7a, 0xb5, 0xb7, 0xb7, 0xa8, 0x6b, 0x2e, 0x00, 0x04, 0x05, 0x26, 0x48, 0x65, 0x65, 0x65, 0x65, 0x4b, 0x29, 0x07, 0x00,
+	0x04, 0x1a, 0x66, 0xbb, 0xf4, 0xd0, 0x7c, 0x2a, 0x01, 0x00, 0x07, 0x03, 0x11, 0x2c, 0x51, 0x74, 0x8c, 0x95, 0x8e, 0x7f, 0x69, 0x4e, 0x2f, 0x15,
+	0x05, 0x00, 0x08, 0x01, 0x11, 0x3a, 0x39, 0x29, 0x00, 0x0f, 0x0b, 0x4a, 0x9f, 0xe9, 0xff, 0xff, 0xff, 0xf4, 0xb3, 0x5e, 0x14, 0x00, 0x18, 0x40,
+	0x95, 0xea, 0xff, 0xff, 0xe3, 0x8e, 0x39, 0x00, 0x18, 0x13, 0x68, 0xbd, 0xff, 0xff, 0xc3, 0x6e, 0x19, 0x00, 0x0c, 0x02, 0x2c, 0x76, 0xc8, 0xf4,
+	0xfe, 0xe9, 0xbc, 0x99, 0x97, 0xbb, 0xdc, 0xf2, 0xfb, 0xff, 0xff, 0xfb, 0xf2, 0xdb, 0xba, 0x97, 0x99, 0xbe, 0xea, 0xfe, 0xf3, 0xc8, 0x76, 0x2d,
+	0x03, 0x00, 0x02, 0x1b, 0x5f, 0xb2, 0xdb, 0xca, 0x9f, 0x7e, 0x67, 0x59, 0x54, 0x5f, 0x88, 0xbf, 0xec, 0xff, 0xf4, 0xb5, 0x60, 0x15, 0x00, 0x02,
+	0x03, 0x2e, 0x7e, 0xcf, 0xea, 0xce, 0xa2, 0x7d, 0x64, 0x5c, 0x66, 0x8d, 0xc2, 0xec, 0xff, 0xed, 0xa3, 0x4e, 0x0b, 0x00, 0x08, 0x16, 0x51, 0xa6,
+	0xe5, 0xfe, 0xf7, 0xc9, 0x78, 0x2a, 0x03, 0x00, 0x02, 0x0b, 0x3b, 0x8b, 0xd5, 0xfa, 0xfd, 0xdb, 0x91, 0x3e, 0x0a, 0x00, 0x01, 0x06, 0x32, 0x82,
+	0xd1, 0xfa, 0xfd, 0xdf, 0x9c, 0x48, 0x11, 0x00, 0x03, 0x1f, 0x67, 0xbb, 0xf1, 0xff, 0xec, 0xb4, 0x60, 0x1e, 0x01, 0x00, 0x06, 0x0f, 0x54, 0xa9,
+	0xee, 0xff, 0xf2, 0xca, 0x84, 0x3c, 0x0f, 0x00, 0x08, 0x0d, 0x36, 0x7b, 0xc3, 0xef, 0xff, 0xf3, 0xb4, 0x5f, 0x15, 0x00, 0x02, 0x01, 0x27, 0x77,
+	0xcb, 0xfa, 0xe9, 0xc6, 0x96, 0x6e, 0x59, 0x5e, 0x7e, 0xac, 0xd7, 0xf4, 0xeb, 0xa7, 0x52, 0x10, 0x00, 0x03, 0x05, 0x36, 0x6b, 0x90, 0x7d, 0x63,
+	0x50, 0x48, 0x4e, 0x67, 0xa4, 0xd8, 0xfe, 0xd6, 0x81, 0x2c, 0x00, 0x02, 0x4e, 0xa3, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xa9, 0x54, 0x00, 0x01, 0x4e, 0xa3, 0xf8, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+	0xa9, 0x54, 0x00, 0x02, 0x05, 0x2f, 0x7e, 0xce, 0xf9, 0xec, 0xc7, 0x95, 0x6f, 0x5a, 0x57, 0x62, 0x82, 0xb1, 0xde, 0xf9, 0xe8, 0xa6, 0x51, 0x13,
+	0x00, 0x02, 0x14, 0x69, 0xbe, 0xff, 0xff, 0xbc, 0x67, 0x12, 0x00, 0x05, 0x02, 0x2e, 0x71, 0xb2, 0xca, 0xcb, 0xcb, 0xc3, 0x8c, 0x48, 0x0c, 0x00,
+	0x06, 0x0c, 0x2c, 0x54, 0x73, 0x79, 0x69, 0x41, 0x1b, 0x03, 0x00, 0x05, 0x3b, 0x90, 0xe5, 0xff, 0xff, 0xe4, 0x8f, 0x3a, 0x00, 0x03, 0x43, 0x98,
+	0xed, 0xff, 0xff, 0xd9, 0x84, 0x2f, 0x00, 0x04, 0x29, 0x7e, 0xd3, 0xff, 0xff, 0xff, 0xeb, 0x98, 0x43, 0x02, 0x00, 0x03, 0x2a, 0x79, 0xcd, 0xf8,
+	0xf8, 0xe1, 0xbf, 0x91, 0x58, 0x25, 0x05, 0x00, 0x02, 0x2e, 0x6d, 0xb8, 0xde, 0xf4, 0xfb, 0xf4, 0xeb, 0xe8, 0xef, 0xf8, 0xfe, 0xff, 0xff, 0xff,
+	0xf8, 0xe5, 0xc8, 0xa7, 0x8d, 0x7a, 0x71, 0x73, 0x82, 0x9c, 0xc3, 0xe5, 0xf9, 0xa9, 0x54, 0x00, 0x0e, 0x23, 0x74, 0xc9, 0xfb, 0xf1, 0xb3, 0x99,
+	0xa6, 0xe5, 0xfe, 0xd7, 0x84, 0x30, 0x02, 0x00, 0x16, 0x24, 0x79, 0xce, 0xff, 0xff, 0xc7, 0x72, 0x1d, 0x00, 0x18, 0x13, 0x68, 0xbd, 0xff, 0xff,
+	0xc3, 0x6e, 0x19, 0x00, 0x0f, 0x12, 0x56, 0xab, 0xee, 0xff, 0xfe, 0xf0, 0xcf, 0x9f, 0x77, 0x5d, 0x51, 0x51, 0x5d, 0x76, 0x9d, 0xcc, 0xee, 0xfe,
+	0xff, 0xef, 0xaa, 0x55, 0x10, 0x00, 0x07, 0x01, 0x01, 0x01, 0x00, 0x06, 0x04, 0x53, 0xa8, 0xf9, 0xff, 0xdc, 0x87, 0x32, 0x00, 0x04, 0x03, 0x09,
+	0x09, 0x06, 0x00, 0x05, 0x02, 0x49, 0x9e, 0xf0, 0xff, 0xda, 0x85, 0x30, 0x00, 0x05, 0x02, 0x21, 0x65, 0xb8, 0xee, 0xff, 0xf6, 0xc6, 0x74, 0x28,
+	0x03, 0x00, 0x02, 0x13, 0x4c, 0xa0, 0xe2, 0xfe, 0xfc, 0xd9, 0x8e, 0x3b, 0x0a, 0x00, 0x05, 0x05, 0x2f, 0x7e, 0xce, 0xf9, 0xff, 0xea, 0xaf, 0x5b,
+	0x1b, 0x00, 0x02, 0x01, 0x1e, 0x64, 0xb8, 0xf0, 0xff, 0xf4, 0xc5, 0x75, 0x2b, 0x05, 0x00, 0x05, 0x01, 0x17, 0x49, 0x96, 0xd5, 0xf7, 0xff, 0xf2,
+	0xc9, 0x84, 0x3b, 0x0f, 0x00, 0x02, 0x0e, 0x38, 0x7f, 0xc5, 0xf0, 0xff, 0xf8, 0xd7, 0x9a, 0x4d, 0x19, 0x01, 0x00, 0x03, 0x2f, 0x84, 0xd9, 0xff,
+	0xe0, 0x8b, 0x36, 0x00, 0x05, 0x09, 0x5a, 0xaf, 0xfa, 0xfe, 0xb7, 0x62, 0x0e, 0x00, 0x08, 0x01, 0x0a, 0x15, 0x20, 0x4b, 0x94, 0xdd, 0xff, 0xc9,
+	0x74, 0x1f, 0x00, 0x01, 0x21, 0x45, 0x69, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+	0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6b, 0x47, 0x23, 0x00, 0x01, 0x26, 0x4f, 0x78, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
+	0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x92, 0xbe, 0xe9, 0xff, 0xfe, 0xa9, 0x54, 0x00, 0x01, 0x01, 0x46, 0x9b, 0xee,
+	0xf3, 0xae, 0x59, 0x10, 0x00, 0x06, 0x03, 0x30, 0x85, 0xd7, 0xff, 0xc4, 0x6f, 0x1a, 0x00, 0x01, 0x02, 0x55, 0xaa, 0xfc, 0xfb, 0xa8, 0x53, 0x02,
+	0x00, 0x07, 0x0f, 0x41, 0x91, 0xd6, 0xfa, 0xff, 0xfc, 0xd2, 0x80, 0x2d, 0x03, 0x00, 0x03, 0x1d, 0x71, 0xc6, 0xfe, 0xff, 0xff, 0xff, 0xf3, 0xa0,
+	0x4b, 0x02, 0x00, 0x04, 0x27, 0x7c, 0xd1, 0xff, 0xff, 0xd0, 0x7b, 0x26, 0x00, 0x03, 0x30, 0x85, 0xda, 0xff, 0xff, 0xc5, 0x70, 0x1b, 0x00, 0x03,
+	0x08, 0x59, 0xae, 0xfa, 0xff, 0xff, 0xeb, 0x9b, 0x46, 0x05, 0x00, 0x06, 0x04, 0x14, 0x3f, 0x90, 0xd5, 0xff, 0xf9, 0xae, 0x59, 0x0a, 0x00, 0x01,
+	0x4a, 0x84, 0xaa, 0x74, 0x41, 0x1b, 0x07, 0x00, 0x02, 0x01, 0x0b, 0x1f, 0x3e, 0x60, 0x83, 0xa5, 0xc5, 0xe1, 0xf4, 0xfd, 0xff, 0xf9, 0xe7, 0xc9,
+	0xa4, 0x7f, 0x5a, 0x35, 0x17, 0x05, 0x00, 0x0c, 0x0a, 0x49, 0x9e, 0xe8, 0xfe, 0xda, 0x88, 0x34, 0x03, 0x24, 0x76, 0xcb, 0xfc, 0xf0, 0xab, 0x56,
+	0x10, 0x00, 0x0a, 0x38, 0x75, 0xaa, 0x9f, 0x86, 0x6e, 0x56, 0x3e, 0x26, 0x11, 0x04, 0x09, 0x5d, 0xb2, 0xfe, 0xfc, 0xab, 0x56, 0x04, 0x05, 0x11,
+	0x26, 0x3e, 0x56, 0x6d, 0x85, 0x9d, 0xad, 0x7a, 0x3d, 0x00, 0x02, 0x02, 0x04, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x19, 0x6c,
+	0xbf, 0xff, 0xff, 0xc4, 0x71, 0x1e, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x04, 0x02, 0x00, 0x04, 0x37, 0x8c, 0xe1, 0xff, 0xe6,
+	0xa0, 0x4b, 0x0f, 0x00, 0x08, 0x0b, 0x41, 0x96, 0xe0, 0xff, 0xe3, 0x8f, 0x3a, 0x00, 0x09, 0x03, 0x06, 0x09, 0x0d, 0x1a, 0x30, 0x48, 0x7e, 0xbb,
+	0xf0, 0xf9, 0xda, 0x87, 0x38, 0x02, 0x00, 0x0d, 0x1a, 0x6c, 0xc1, 0xfb, 0xf7, 0xb3, 0x5e, 0x10, 0x00, 0x03, 0x05, 0x2d, 0x79, 0xc9, 0xf6, 0xff,
+	0xf4, 0xc2, 0x70, 0x25, 0x02, 0x00, 0x01, 0x01, 0x1e, 0x60, 0xb4, 0xec, 0xff, 0xfb, 0xd6, 0x8a, 0x38, 0x08, 0x00, 0x09, 0x04, 0x2c, 0x7a, 0xca,
+	0xf7, 0xff, 0xf2, 0xc1, 0x6f, 0x27, 0x03, 0x00, 0x02, 0x1c, 0x60, 0xb5, 0xee, 0xff, 0xfa, 0xd4, 0x8a, 0x3a, 0x0a, 0x00, 0x06, 0x01, 0x17, 0x4a,
+	0x97, 0xd5, 0xf8, 0xff, 0xf2, 0xc8, 0x9f, 0x9e, 0xc7, 0xf1, 0xff, 0xf8, 0xd7, 0x9a, 0x4d, 0x19, 0x01, 0x00, 0x06, 0x4c, 0xa1, 0xf6, 0xfe, 0xb3,
+	0x5e, 0x09, 0x00, 0x06, 0x2c, 0x81, 0xd6, 0xff, 0xd8, 0x83, 0x2e, 0x00, 0x02, 0x09, 0x38, 0x6f, 0xa5, 0xbd, 0xd2, 0xe1, 0xe4, 0xdd, 0xd4, 0xd4,
+	0xe3, 0xf4, 0xff, 0xd0, 0x7b, 0x26, 0x00, 0x37, 0x2b, 0x80, 0xd5, 0xff, 0xfe, 0xa9, 0x54, 0x00, 0x01, 0x0a, 0x5d, 0xb2, 0xfd, 0xde, 0x89, 0x34,
+	0x00, 0x08, 0x0b, 0x60, 0xb5, 0xfe, 0xdb, 0x86, 0x31, 0x00, 0x02, 0x29, 0x5c, 0x8e, 0x8e, 0x5b, 0x28, 0x00, 0x0a, 0x03, 0x20, 0x5b, 0xab, 0xe3,
+	0xfc, 0xf5, 0xc1, 0x6d, 0x22, 0x01, 0x00, 0x01, 0x12, 0x5e, 0xb3, 0xf5, 0xff, 0xff, 0xfe, 0xe2, 0x8d, 0x38, 0x00, 0x05, 0x14, 0x69, 0xbe, 0xff,
+	0xff, 0xbc, 0x67, 0x12, 0x00, 0x03, 0x1c, 0x71, 0xc6, 0xff, 0xff, 0xb1, 0x5c, 0x07, 0x00, 0x03, 0x38, 0x8d, 0xe2, 0xff, 0xff, 0xe5, 0x93, 0x3e,
+	0x03, 0x00, 0x03, 0x10, 0x1f, 0x2d, 0x30, 0x3b, 0x4b, 0x79, 0xb5, 0xeb, 0xfd, 0xd0, 0x7c, 0x28, 0x00, 0x02, 0x01, 0x01, 0x01, 0x00, 0x0f, 0x03,
+	0x09, 0x0e, 0x0a, 0x05, 0x00, 0x12, 0x22, 0x73, 0xc7, 0xfa, 0xf6, 0xb9, 0x64, 0x18, 0x00, 0x03, 0x0f, 0x57, 0xac, 0xf1, 0xfd, 0xd0, 0x7c, 0x29,
+	0x01, 0x00, 0x07, 0x15, 0x6a, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf0, 0xdd, 0xdd, 0xe9, 0xfc, 0xfa, 0xe7, 0xdc, 0xde, 0xf1,
+	0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0x6d, 0x18, 0x00, 0x01, 0x4e, 0xa3, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xa9, 0x54, 0x00, 0x03, 0x15, 0x6a, 0xbf,
+	0xff, 0xf8, 0xa6, 0x51, 0x03, 0x00, 0x0b, 0x44, 0x99, 0xee, 0xff, 0xc3, 0x6e, 0x19, 0x00, 0x07, 0x04, 0x59, 0xae, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xf5, 0xc9, 0x7f, 0x33, 0x0a, 0x00, 0x0c, 0x02, 0x1f, 0x61, 0xb3, 0xec, 0xfa, 0xd6, 0x89, 0x38, 0x07, 0x00, 0x03, 0x16, 0x67, 0xbc, 0xfb,
+	0xff, 0xff, 0xe1, 0x8e, 0x39, 0x02, 0x00, 0x02, 0x07, 0x4e, 0xa3, 0xf1, 0xff, 0xff, 0xf3, 0xa9, 0x54, 0x0a, 0x00, 0x0d, 0x04, 0x43, 0x98, 0xe9,
+	0xff, 0xff, 0xf7, 0xb2, 0x5d, 0x0f, 0x00, 0x03, 0x2a, 0x7f, 0xd4, 0xff, 0xff, 0xfe, 0xcd, 0x78, 0x24, 0x00, 0x08, 0x01, 0x18, 0x58, 0xab, 0xea,
+	0xff, 0xff, 0xff, 0xff, 0xeb, 0xae, 0x5b, 0x19, 0x01, 0x00, 0x09, 0x34, 0x89, 0xde, 0xff, 0xd5, 0x80, 0x2b, 0x00, 0x05, 0x04, 0x4f, 0xa4, 0xf5,
+	0xff, 0xc1, 0x6c, 0x17, 0x00, 0x01, 0x19, 0x67, 0xbc, 0xf8, 0xd6, 0x8d, 0x39, 0x0d, 0x01, 0x00, 0x02, 0x2b, 0x80, 0xd5, 0xff, 0xd0, 0x7b, 0x26,
+	0x00, 0x37, 0x2b, 0x80, 0xd5, 0xff, 0xfe, 0xa9, 0x54, 0x00, 0x02, 0x21, 0x71, 0xc6, 0xf9, 0xe5, 0xab, 0x5e, 0x22, 0x07, 0x00, 0x02, 0x02, 0x14,
+	0x3d, 0x89, 0xcc, 0xf7, 0xe8, 0x9a, 0x45, 0x06, 0x00, 0x15, 0x04, 0x1f, 0x4a, 0x71, 0x81, 0x71, 0x46, 0x1b, 0x00, 0x03, 0x0d, 0x23, 0x39, 0x3f,
+	0x2f, 0x18, 0x05, 0x00, 0x06, 0x02, 0x55, 0xaa, 0xfc, 0xfb, 0xa8, 0x53, 0x02, 0x00, 0x03, 0x08, 0x5d, 0xb2, 0xff, 0xf2, 0x9d, 0x48, 0x00, 0x03,
+	0x1a, 0x6f, 0xc4, 0xff, 0xfe, 0xd7, 0x83, 0x2e, 0x00, 0x05, 0x47, 0x96, 0xe6, 0xe9, 0xdd, 0xca, 0xb5, 0xa0, 0x8b, 0x66, 0x38, 0x10, 0x00, 0x2a,
+	0x09, 0x47, 0x9c, 0xe7, 0xff, 0xe4, 0x95, 0x40, 0x06, 0x00, 0x05, 0x03, 0x37, 0x8c, 0xdd, 0xff, 0xeb, 0xa2, 0x4d, 0x0c, 0x00, 0x06, 0x05, 0x11,
+	0x1f, 0x2a, 0x31, 0x37, 0x3d, 0x44, 0x4a, 0x51, 0x5c, 0x89, 0xc1, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xef, 0xbd, 0x85, 0x5b, 0x50, 0x4a, 0x44, 0x3d,
+	0x37, 0x31, 0x2a, 0x1f, 0x11, 0x05, 0x00, 0x01, 0x26, 0x4f, 0x78, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x86, 0xb1, 0xdd, 0xff, 0xff,
+	0xe0, 0xb4, 0x89, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7b, 0x52, 0x28, 0x00, 0x03, 0x06, 0x57, 0xac, 0xfb, 0xfe, 0xc4, 0x6f, 0x1a,
+	0x00, 0x0a, 0x12, 0x64, 0xb9, 0xfc, 0xfc, 0xb0, 0x5b, 0x09, 0x00, 0x08, 0x09, 0x12, 0x1b, 0x1e, 0x28, 0x39, 0x4c, 0x68, 0xa2, 0xd7, 0xfd, 0xf8,
+	0xcf, 0x7a, 0x2c, 0x00, 0x08, 0x12, 0x44, 0x93, 0xd5, 0xf9, 0xec, 0xbb, 0x6b, 0x28, 0x05, 0x00, 0x06, 0x0e, 0x41, 0x93, 0xda, 0xfc, 0xff, 0xed,
+	0xb1, 0x5d, 0x1a, 0x00, 0x02, 0x06, 0x2e, 0x79, 0xc8, 0xf5, 0xff, 0xf7, 0xc9, 0x78, 0x2a, 0x04, 0x00, 0x09, 0x01, 0x20, 0x67, 0xbb, 0xf1, 0xff,
+	0xfa, 0xd3, 0x89, 0x39, 0x0a, 0x00, 0x02, 0x12, 0x4e, 0xa2, 0xe5, 0xfe, 0xfe, 0xe3, 0xa3, 0x4f, 0x15, 0x00, 0x08, 0x0d, 0x36, 0x7c, 0xc4, 0xf0,
+	0xff, 0xf8, 0xf2, 0xf2, 0xf8, 0xff, 0xf1, 0xc6, 0x7f, 0x38, 0x0e, 0x00, 0x08, 0x06, 0x3a, 0x8e, 0xdd, 0xfc, 0xd4, 0x9e, 0x5c, 0x34, 0x1d, 0x23,
+	0x44, 0x79, 0xb7, 0xe7, 0xf9, 0xc7, 0x73, 0x23, 0x00, 0x02, 0x3e, 0x93, 0xe8, 0xff, 0xd2, 0x87, 0x33, 0x0b, 0x08, 0x1b, 0x4b, 0x98, 0xd8, 0xfc,
+	0xff, 0xd0, 0x7b, 0x26, 0x00, 0x01, 0x4b, 0x9c, 0xee, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5,
+	0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf3, 0xa2, 0x50, 0x00, 0x18, 0x2b, 0x80, 0xd5, 0xff, 0xfe, 0xa9, 0x54, 0x00, 0x03, 0x05,
+	0x2b, 0x68, 0xb2, 0xe0, 0xf9, 0xfa, 0xf0, 0xe4, 0xe2, 0xeb, 0xf7, 0xfc, 0xed, 0xca, 0x8a, 0x45, 0x13, 0x00, 0x04, 0x19, 0x47, 0x7d, 0x9c, 0xa2,
+	0x92, 0x64, 0x30, 0x0a, 0x00, 0x23, 0x29, 0x5c, 0x8e, 0x8e, 0x5b, 0x28, 0x00, 0x05, 0x2e, 0x61, 0x93, 0x87, 0x54, 0x22, 0x00, 0x03, 0x30, 0x68,
+	0xa0, 0xa8, 0x8b, 0x53, 0x1b, 0x00, 0x1a, 0x1f, 0x62, 0xa6, 0xca, 0xcb, 0xcb, 0xc6, 0x9a, 0x57, 0x18, 0x00, 0x17, 0x21, 0x71, 0xc6, 0xfa, 0xfa,
+	0xc6, 0x71, 0x20, 0x00, 0x09, 0x1c, 0x6c, 0xc1, 0xf9, 0xfb, 0xc9, 0x74, 0x23, 0x00, 0x0d, 0x0b, 0x3b, 0x8c, 0xd6, 0xfb, 0xf8, 0xbe, 0x93, 0x98,
+	0xd3, 0xfd, 0xf9, 0xd2, 0x87, 0x38, 0x0a, 0x00, 0x14, 0x13, 0x68, 0xbd, 0xff, 0xff, 0xc3, 0x6e, 0x19, 0x00, 0x0f, 0x0d, 0x52, 0xa7, 0xef, 0xff,
+	0xea, 0xb9, 0x75, 0x38, 0x14, 0x02, 0x00, 0x02, 0x02, 0x13, 0x35, 0x6f, 0xb3, 0xe5, 0xfe, 0xf0, 0xaa, 0x55, 0x0f, 0x00, 0x11, 0x19, 0x6e, 0xc3,
+	0xff, 0xff, 0xcc, 0x77, 0x22, 0x00, 0x04, 0x0b, 0x34, 0x7d, 0xc7, 0xf2, 0xf3, 0xca, 0x82, 0x39, 0x0d, 0x00, 0x0b, 0x06, 0x30, 0x7d, 0xcb, 0xf7,
+	0xff, 0xef, 0xb6, 0x61, 0x1c, 0x00, 0x02, 0x01, 0x1f, 0x63, 0xb6, 0xed, 0xff, 0xf8, 0xcc, 0x7b, 0x2d, 0x04, 0x00, 0x05, 0x01, 0x22, 0x6b, 0xbf,
+	0xf3, 0xff, 0xf3, 0xc3, 0x73, 0x29, 0x04, 0x00, 0x02, 0x14, 0x51, 0xa6, 0xe7, 0xff, 0xfb, 0xd6, 0x8d, 0x3c, 0x0c, 0x00, 0x07, 0x0d, 0x36, 0x7c,
+	0xc4, 0xef, 0xff, 0xf8, 0xd7, 0x99, 0x4d, 0x1a, 0x1a, 0x4b, 0x97, 0xd5, 0xf7, 0xff, 0xf0, 0xc6, 0x7f, 0x38, 0x0e, 0x00, 0x07, 0x0e, 0x33, 0x6e,
+	0xab, 0xd7, 0xf1, 0xfb, 0xff, 0xfe, 0xf8, 0xeb, 0xcb, 0x9b, 0x5b, 0x26, 0x07, 0x00, 0x03, 0x04, 0x2c, 0x6c, 0xb8, 0xe5, 0xfa, 0xfe, 0xfe, 0xfb,
+	0xed, 0xcb, 0x92, 0x8a, 0xaa, 0xe4, 0xcc, 0x79, 0x26, 0x00, 0x01, 0x2b, 0x59, 0x88, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c,
+	0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8b, 0x5c, 0x2e, 0x00, 0x18, 0x0f, 0x2e, 0x4d, 0x5c, 0x5b,
+	0x3d, 0x1e, 0x00, 0x07, 0x0c, 0x1f, 0x37, 0x4a, 0x57, 0x59, 0x51, 0x40, 0x29, 0x14, 0x04, 0x00, 0x06, 0x23, 0x78, 0xcd, 0xff, 0xff, 0xff, 0xff,
+	0xfa, 0xa7, 0x52, 0x02, 0x00, 0x55, 0x0d, 0x4c, 0xa1, 0xe8, 0xff, 0xff, 0xef, 0xbd, 0x6d, 0x28, 0x04, 0x00, 0x16, 0x09, 0x45, 0x9a, 0xe6, 0xff,
+	0xec, 0xa2, 0x4d, 0x0b, 0x00, 0x0b, 0x0a, 0x4c, 0xa1, 0xeb, 0xff, 0xe7, 0x9a, 0x45, 0x08, 0x00, 0x09, 0x12, 0x4b, 0x9f, 0xe2, 0xfe, 0xff, 0xec,
+	0xa1, 0x4c, 0x0a, 0x11, 0x57, 0xac, 0xf0, 0xff, 0xfd, 0xe0, 0x9d, 0x49, 0x12, 0x00, 0x12, 0x13, 0x68, 0xbd, 0xff, 0xff, 0xc3, 0x6e, 0x19, 0x00,
+	0x0d, 0x09, 0x2d, 0x6e, 0xba, 0xea, 0xfe, 0xf6, 0xf4, 0xf4, 0xfd, 0xff, 0xfc, 0xf3, 0xea, 0xea, 0xf2, 0xfb, 0xff, 0xfd, 0xf6, 0xf6, 0xf8, 0xfe,
+	0xe8, 0xb6, 0x6a, 0x2a, 0x07, 0x00, 0x02, 0x03, 0x32, 0x55, 0x6a, 0x47, 0x29, 0x12, 0x06, 0x01, 0x01, 0x0a, 0x1b, 0x36, 0x79, 0xbd, 0xf6, 0xff,
+	0xf3, 0xa8, 0x53, 0x09, 0x00, 0x01, 0x05, 0x27, 0x67, 0xb7, 0xea, 0xfe, 0xe9, 0xb5, 0x70, 0x40, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x29,
+	0x1a, 0x0b, 0x00, 0x06, 0x02, 0x22, 0x67, 0xba, 0xef, 0xff, 0xf1, 0xba, 0x66, 0x1f, 0x01, 0x00, 0x02, 0x14, 0x4e, 0xa2, 0xe2, 0xfe, 0xf9, 0xce,
+	0x7f, 0x30, 0x05, 0x00, 0x01, 0x02, 0x25, 0x70, 0xc2, 0xf4, 0xff, 0xeb, 0xb1, 0x5d, 0x1c, 0x01, 0x00, 0x02, 0x15, 0x55, 0xaa, 0xe9, 0xff, 0xf5,
+	0xc6, 0x77, 0x2c, 0x05, 0x00, 0x06, 0x0a, 0x33, 0x79, 0xc3, 0xef, 0xff, 0xf8, 0xd6, 0x98, 0x4b, 0x18, 0x01, 0x00, 0x04, 0x01, 0x16, 0x48, 0x93,
+	0xd3, 0xf6, 0xff, 0xf0, 0xc5, 0x7d, 0x36, 0x0c, 0x00, 0x09, 0x02, 0x09, 0x0e, 0x0d, 0x05, 0x00, 0x0d, 0x02, 0x09, 0x11, 0x13, 0x0d, 0x05, 0x00,
+	0x5e, 0x0c, 0x49, 0x9b, 0xe4, 0xfc, 0xff, 0xf5, 0xca, 0x75, 0x29, 0x00, 0x03, 0x01, 0x07, 0x0d, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+	0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x0d, 0x07, 0x00,
+	0x02, 0x01, 0x0e, 0x1b, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+	0x26, 0x26, 0x26, 0x20, 0x13, 0x07, 0x00, 0x10, 0x09, 0x3b, 0x8f, 0xdb, 0xfd, 0xf6, 0xd0, 0x8b, 0x3f, 0x10, 0x00, 0x18, 0x1f, 0x6f, 0xc4, 0xf9,
+	0xfd, 0xd2, 0x7e, 0x2b, 0x01, 0x00, 0x0d, 0x01, 0x2d, 0x81, 0xd4, 0xfe, 0xf9, 0xc1, 0x6c, 0x1d, 0x00, 0x06, 0x06, 0x3c, 0x90, 0xde, 0xfe, 0xff,
+	0xfe, 0xd8, 0x85, 0x30, 0x01, 0x00, 0x02, 0x02, 0x30, 0x84, 0xd6, 0xfe, 0xff, 0xfe, 0xdf, 0x91, 0x3c, 0x07, 0x00, 0x10, 0x13, 0x68, 0xbd, 0xff,
+	0xff, 0xc3, 0x6e, 0x19, 0x00, 0x0c, 0x01, 0x21, 0x5e, 0xb0, 0xd7, 0xc5, 0x80, 0x39, 0x10, 0x0f, 0x2a, 0x49, 0x61, 0x6f, 0x78, 0x79, 0x70, 0x62,
+	0x4b, 0x2b, 0x10, 0x13, 0x3e, 0x87, 0xca, 0xdc, 0xb4, 0x62, 0x23, 0x01, 0x00, 0x01, 0x04, 0x46, 0x92, 0xe3, 0xf6, 0xfe, 0xfe, 0xfb, 0xf4, 0xf4,
+	0xf8, 0xfe, 0xff, 0xfc, 0xeb, 0xcc, 0x96, 0x53, 0x1e, 0x01, 0x00, 0x02, 0x2c, 0x81, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0x95, 0x40, 0x00, 0x09, 0x16, 0x51, 0x8c, 0x9d, 0x77, 0x3e, 0x17, 0x02, 0x00, 0x04, 0x0b, 0x3b, 0x7b, 0x9d,
+	0x88, 0x4e, 0x21, 0x06, 0x00, 0x01, 0x04, 0x1b, 0x45, 0x7d, 0x9e, 0x85, 0x49, 0x11, 0x00, 0x05, 0x11, 0x35, 0x6c, 0x99, 0x92, 0x5d, 0x1e, 0x01,
+	0x00, 0x08, 0x02, 0x1c, 0x52, 0x9a, 0xb2, 0x92, 0x4a, 0x17, 0x01, 0x00, 0x0b, 0x15, 0x45, 0x8e, 0xb7, 0xa7, 0x62, 0x26, 0x05, 0x00, 0x2c, 0x01,
+	0x03, 0x03, 0x02, 0x00, 0x08, 0x04, 0x05, 0x05, 0x01, 0x00, 0x03, 0x10, 0x30, 0x50, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f,
+	0x5f, 0x5f, 0x4d, 0x2e, 0x0e, 0x00, 0x01, 0x10, 0x30, 0x50, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x4d, 0x2e,
+	0x0e, 0x00, 0x1d, 0x01, 0x08, 0x11, 0x14, 0x0d, 0x04, 0x00, 0x05, 0x0f, 0x64, 0xb9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0x5e, 0x09, 0x00, 0x01,
+	0x0a, 0x5f, 0xb4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xd8, 0x83, 0x2e, 0x00, 0x0f, 0x03, 0x2c, 0x57, 0x7e, 0x7e, 0x64, 0x3a, 0x12, 0x00, 0x1a, 0x10, 0x38, 0x61, 0x79, 0x79, 0x62, 0x3a,
+	0x11, 0x00, 0x11, 0x14, 0x3c, 0x65, 0x79, 0x79, 0x5e, 0x36, 0x0d, 0x00, 0x07, 0x03, 0x14, 0x34, 0x60, 0x69, 0x49, 0x1a, 0x00, 0x06, 0x13, 0x44,
+	0x66, 0x66, 0x39, 0x17, 0x04, 0x00, 0x12, 0x07, 0x25, 0x44, 0x5c, 0x5c, 0x46, 0x28, 0x09, 0x00, 0x0f, 0x03, 0x03, 0x03, 0x00, 0x12, 0x04, 0x04,
+	0x04, 0x00, 0x07, 0x02, 0x0e, 0x1e, 0x2d, 0x36, 0x3d, 0x3e, 0x39, 0x2e, 0x23, 0x14, 0x09, 0x01, 0x00, 0x06, 0x04, 0x0d, 0x15, 0x1a, 0x1a, 0x1a,
+	0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x17, 0x0f, 0x06, 0x00, 0x81, 0x17, 0x61, 0xb4, 0xf1, 0xf5, 0xd1, 0x7d, 0x30,
+	0x00, 0x03, 0x07, 0x48, 0x99, 0xe6, 0xf9, 0xeb, 0xa3, 0x4f, 0x0c, 0x00, 0x01, 0x2c, 0x81, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xd0, 0x7b, 0x26, 0x00, 0x01, 0x2c, 0x81, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xd0, 0x7b, 0x26, 0x00, 0x28, 0x05, 0x22, 0x3e, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+	0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x3c, 0x1f, 0x03, 0x00, 0x01, 0x02, 0x19, 0x2f, 0x43, 0x43, 0x43,
+	0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x39, 0x22, 0x0c, 0x00,
+	0xff, 0x00, 0x5e, 0x12, 0x55, 0xa2, 0xe0, 0xe4, 0xbf, 0x6f, 0x28, 0x00, 0x03, 0x05, 0x3e, 0x88, 0xd4, 0xe5, 0xd3, 0x86, 0x3c, 0x04, 0x00, 0x01,
+	0x0e, 0x29, 0x44, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x42, 0x27, 0x0c, 0x00, 0x01, 0x0e, 0x29, 0x44, 0x51,
+	0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x42, 0x27, 0x0c, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+	0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+	0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+	0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+	0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+	0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+	0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+	0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+	0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x8b,
+};
@@ -2,87 +2,172 @@
 #include "Calibration.h"
 #include "Configuration.h"
 #include "IPCClient.h"
+#include "DeviceRegistry.h"
+#include "PoseCapture.h"
+#include "DevicePairing.h"
+#include "TransformGraph.h"
+#include "SampleFile.h"
+#include "ResidualFile.h"
+#include "Diagnostics.h"
+#include "StatusPublisher.h"
+#include "TrackingSimulator.h"
+#include "ChaperoneGeometry.h"
+#include "ProfileSync.h"
+#include "SharedAnchor.h"
+#include "NetworkPoses.h"
+#include "MetricsEndpoint.h"
+#include "CalibrationSnapshot.h"
+#include "ProfileStore.h"
+#include "StartupTimings.h"
+#include "ClientTimings.h"
+#include "TaskPool.h"
+#include "../QuaternionMath.h"
+#include "../Instrumentation.h"
+#include "../CalibrationSolver/CalibrationSolver.h"
 
 #include <string>
 #include <vector>
 #include <iostream>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <algorithm>
+#include <ctime>
+#include <thread>
+#include <exception>
+#include <limits>
 
 #include <Eigen/Dense>
 
-
-inline vr::HmdQuaternion_t operator*(const vr::HmdQuaternion_t& lhs, const vr::HmdQuaternion_t& rhs) {
-	return {
-		(lhs.w * rhs.w) - (lhs.x * rhs.x) - (lhs.y * rhs.y) - (lhs.z * rhs.z),
-		(lhs.w * rhs.x) + (lhs.x * rhs.w) + (lhs.y * rhs.z) - (lhs.z * rhs.y),
-		(lhs.w * rhs.y) + (lhs.y * rhs.w) + (lhs.z * rhs.x) - (lhs.x * rhs.z),
-		(lhs.w * rhs.z) + (lhs.z * rhs.w) + (lhs.x * rhs.y) - (lhs.y * rhs.x)
-	};
-}
-
-inline vr::HmdVector3d_t quaternionRotateVector(const vr::HmdQuaternion_t& quat, const double(&vector)[3]) {
-	vr::HmdQuaternion_t vectorQuat = { 0.0, vector[0], vector[1] , vector[2] };
-	vr::HmdQuaternion_t conjugate = { quat.w, -quat.x, -quat.y, -quat.z };
-	auto rotatedVectorQuat = quat * vectorQuat * conjugate;
-	return { rotatedVectorQuat.x, rotatedVectorQuat.y, rotatedVectorQuat.z };
-}
-
-inline Eigen::Matrix3d quaternionRotateMatrix(const vr::HmdQuaternion_t& quat) {
-	return Eigen::Quaterniond(quat.w, quat.x, quat.y, quat.z).toRotationMatrix();
-}
-
+#ifdef _DEBUG
+#include <crtdbg.h>
+#endif
 
 static IPCClient Driver;
+static PoseCaptureReader Capture;
+static DevicePairing Pairing;
+static std::vector<protocol::PoseCaptureSample> PairingPoses; // Drained per tick, kept to reuse its storage.
+static TransformGraph Graph;
+static SampleRecorder Recorder;
+static SampleRecorder Checkpoint;
+static ResidualExporter Residuals;
+static StatusPublisher Status;
 CalibrationContext CalCtx;
 
+static void FindSessionCheckpoint(CalibrationContext &ctx);
+
+// The driver connection is made by the first tick, see UpdateDriverConnection.
 void InitCalibrator()
 {
-	Driver.Connect();
+	Devices.RefreshAll();
+	FindSessionCheckpoint(CalCtx);
 }
 
-struct Pose
-{
-	Eigen::Matrix3d rot;
-	Eigen::Vector3d trans;
+// A preset session collects at most twice its sample count, see MaxSampleCount.
+static const size_t MaxSessionSamples = MaxPresetSampleCount * 2;
 
-	Pose() { }
-	Pose(vr::HmdMatrix34_t hmdMatrix)
+/**
+ * Fixed-capacity ring of samples. Storage is allocated for at least the most samples any
+ * preset collects, so neither collecting nor changing presets between sessions reallocates,
+ * only a larger custom or adaptive session grows it. Once full, new samples replace the
+ * oldest. Keeps the compact rotations of the samples alongside for pairing new ones with them.
+ */
+class SampleBuffer
+{
+public:
+	void Reset(size_t newCapacity)
 	{
-		for (int i = 0; i < 3; i++) {
-			for (int j = 0; j < 3; j++) {
-				rot(i,j) = hmdMatrix.m[i][j];
-			}
+		if (storage.size() < newCapacity || storage.empty())
+		{
+			size_t size = std::max(newCapacity, MaxSessionSamples);
+			storage.resize(size);
+			rotations.Reserve(size);
 		}
-		trans = Eigen::Vector3d(hmdMatrix.m[0][3], hmdMatrix.m[1][3], hmdMatrix.m[2][3]);
+		capacity = newCapacity;
+		Clear();
 	}
-	Pose(double x, double y, double z) : trans(Eigen::Vector3d(x,y,z)) { }
 
-	Eigen::Matrix4d ToAffine() const {
-		Eigen::Matrix4d matrix = Eigen::Matrix4d::Identity();
+	void Clear() { start = 0; count = 0; rotations.Clear(); }
 
-		for (int i = 0; i < 3; i++) {
-			for (int j = 0; j < 3; j++) {
-				matrix(i,j) = rot(i, j);
-			}
-			matrix(i, 3) = trans(i);
+	// Frees the storage, the next Reset allocates it again.
+	void Release()
+	{
+		storage = std::vector<Sample>();
+		rotations = CompactRotations();
+		capacity = 0;
+		Clear();
+	}
+
+	size_t size() const { return count; }
+	size_t Capacity() const { return capacity; }
+
+	void Push(const Sample &sample)
+	{
+		if (capacity == 0)
+			return;
+
+		if (count < capacity)
+		{
+			storage[(start + count) % capacity] = sample;
+			rotations.Push(sample);
+			count++;
+		}
+		else
+		{
+			storage[start] = sample;
+			rotations.Set(start, CompactRotations::FromSample(sample));
+			start = (start + 1) % capacity;
 		}
+	}
 
-		return matrix;
+	// Index 0 is the oldest sample.
+	const Sample &operator[](size_t i) const { return storage[(start + i) % capacity]; }
+
+	// By storage slot, which is the sample's index until the ring first wraps around. Samples
+	// are only paired before that.
+	const CompactRotations &Rotations() const { return rotations; }
+
+	// Oldest first, into out's existing storage.
+	void CopyTo(std::vector<Sample> &out) const
+	{
+		out.clear();
+		for (size_t i = 0; i < count; i++)
+			out.push_back((*this)[i]);
 	}
+
+private:
+	std::vector<Sample> storage;
+	CompactRotations rotations;
+	size_t capacity = 0, start = 0, count = 0;
 };
 
-struct Sample
+// Uses the capture's own tracking state and speeds.
+static double CapturedPoseQuality(const protocol::PoseCaptureSample &pose)
 {
-	Pose ref, target;
-	bool valid;
-	Sample() : valid(false) { }
-	Sample(Pose ref, Pose target) : valid(true), ref(ref), target(target) { }
-};
+	return PoseQuality(pose.valid && pose.trackingResult == vr::TrackingResult_Running_OK, pose.linearSpeed, pose.angularSpeed);
+}
 
-struct DSample
+static Pose PoseFromMatrix(const vr::HmdMatrix34_t &hmdMatrix)
 {
-	bool valid;
-	Eigen::Vector3d ref, target;
-};
+	Eigen::Matrix3d rot;
+	for (int i = 0; i < 3; i++) {
+		for (int j = 0; j < 3; j++) {
+			rot(i,j) = hmdMatrix.m[i][j];
+		}
+	}
+	return Pose(rot, Eigen::Vector3d(hmdMatrix.m[0][3], hmdMatrix.m[1][3], hmdMatrix.m[2][3]));
+}
+
+static Pose PoseFromCapture(const protocol::PoseCaptureSample &sample)
+{
+	return Pose(
+		Eigen::Quaterniond(sample.rotation.w, sample.rotation.x, sample.rotation.y, sample.rotation.z).toRotationMatrix(),
+		Eigen::Vector3d(sample.position[0], sample.position[1], sample.position[2])
+	);
+}
+
+// Samples below this are dropped when collected.
+static const double MinSampleQuality = 0.25;
 
 bool StartsWith(const std::string &str, const std::string &prefix)
 {
@@ -100,182 +185,134 @@ bool EndsWith(const std::string &str, const std::string &suffix)
 	return str.compare(str.length() - suffix.length(), suffix.length(), suffix) == 0;
 }
 
-Eigen::Vector3d AxisFromRotationMatrix3(Eigen::Matrix3d rot)
+// Fills in what a captured pose would hold from a pose polled through the OpenVR API.
+protocol::PoseCaptureSample CaptureSampleFromPose(uint32_t openVRID, const vr::TrackedDevicePose_t &pose)
 {
-	return Eigen::Vector3d(rot(2,1) - rot(1,2), rot(0,2) - rot(2,0), rot(1,0) - rot(0,1));
-}
+	LARGE_INTEGER now, frequency;
+	QueryPerformanceCounter(&now);
+	QueryPerformanceFrequency(&frequency);
 
-double AngleFromRotationMatrix3(Eigen::Matrix3d rot)
-{
-	return acos((rot(0,0) + rot(1,1) + rot(2,2) - 1.0) / 2.0);
+	const auto &m = pose.mDeviceToAbsoluteTracking.m;
+	Eigen::Matrix3d rot;
+	rot << m[0][0], m[0][1], m[0][2], m[1][0], m[1][1], m[1][2], m[2][0], m[2][1], m[2][2];
+	Eigen::Quaterniond q(rot);
+
+	const float *v = pose.vVelocity.v, *w = pose.vAngularVelocity.v;
+
+	protocol::PoseCaptureSample sample;
+	sample.openVRID = openVRID;
+	sample.valid = pose.bPoseIsValid;
+	sample.trackingResult = pose.eTrackingResult;
+	sample.timestamp = (double) now.QuadPart / (double) frequency.QuadPart;
+	sample.position[0] = m[0][3];
+	sample.position[1] = m[1][3];
+	sample.position[2] = m[2][3];
+	sample.rotation = { q.w(), q.x(), q.y(), q.z() };
+	sample.linearSpeed = sqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+	sample.angularSpeed = sqrt(w[0] * w[0] + w[1] * w[1] + w[2] * w[2]);
+	return sample;
 }
 
-DSample DeltaRotationSamples(Sample s1, Sample s2)
-{
-	// Difference in rotation between samples.
-	auto dref = s1.ref.rot * s2.ref.rot.transpose();
-	auto dtarget = s1.target.rot * s2.target.rot.transpose();
-
-	// When stuck together, the two tracked objects rotate as a pair,
-	// therefore their axes of rotation must be equal between any given pair of samples.
-	DSample ds;
-	ds.ref = AxisFromRotationMatrix3(dref);
-	ds.target = AxisFromRotationMatrix3(dtarget);
+// How long the reference or target may stay out of tracking before a run gives up on it.
+static const double MaxTrackingLoss = 3.0; // seconds
 
-	// Reject samples that were too close to each other.
-	auto refA = AngleFromRotationMatrix3(dref);
-	auto targetA = AngleFromRotationMatrix3(dtarget);
-	ds.valid = refA > 0.4 && targetA > 0.4 && ds.ref.norm() > 0.01 && ds.target.norm() > 0.01;
+// When each device stopped tracking, negative while it tracks.
+static struct
+{
+	double reference = -1, target = -1;
+} TrackingLostSince;
 
-	ds.ref.normalize();
-	ds.target.normalize();
-	return ds;
+static void ResetTrackingLoss()
+{
+	TrackingLostSince.reference = TrackingLostSince.target = -1;
 }
 
-Eigen::Vector3d CalibrateRotation(const std::vector<Sample> &samples)
+static bool FollowTracking(double &lostSince, bool tracking, double time, const char *device)
 {
-	std::vector<DSample> deltas;
-
-	for (size_t i = 0; i < samples.size(); i++)
+	char buf[256];
+	if (tracking)
 	{
-		for (size_t j = 0; j < i; j++)
+		if (lostSince >= 0)
 		{
-			auto delta = DeltaRotationSamples(samples[i], samples[j]);
-			if (delta.valid)
-				deltas.push_back(delta);
+			snprintf(buf, sizeof buf, "%s device is tracking again\n", device);
+			CalCtx.Log(buf);
 		}
+		lostSince = -1;
+		return true;
 	}
-	char buf[256];
-	snprintf(buf, sizeof buf, "Got %zd samples with %zd delta samples\n", samples.size(), deltas.size());
-	CalCtx.Log(buf);
-
-	// Kabsch algorithm
-
-	Eigen::MatrixXd refPoints(deltas.size(), 3), targetPoints(deltas.size(), 3);
-	Eigen::Vector3d refCentroid(0,0,0), targetCentroid(0,0,0);
-
-	for (size_t i = 0; i < deltas.size(); i++)
-	{
-		refPoints.row(i) = deltas[i].ref;
-		refCentroid += deltas[i].ref;
-
-		targetPoints.row(i) = deltas[i].target;
-		targetCentroid += deltas[i].target;
-	}
-
-	refCentroid /= (double) deltas.size();
-	targetCentroid /= (double) deltas.size();
-
-	for (size_t i = 0; i < deltas.size(); i++)
-	{
-		refPoints.row(i) -= refCentroid;
-		targetPoints.row(i) -= targetCentroid;
-	}
-
-	auto crossCV = refPoints.transpose() * targetPoints;
 
-	Eigen::BDCSVD<Eigen::MatrixXd> bdcsvd;
-	auto svd = bdcsvd.compute(crossCV, Eigen::ComputeThinU | Eigen::ComputeThinV);
-
-	Eigen::Matrix3d i = Eigen::Matrix3d::Identity();
-	if ((svd.matrixU() * svd.matrixV().transpose()).determinant() < 0)
+	if (lostSince < 0)
 	{
-		i(2,2) = -1;
+		lostSince = time;
+		snprintf(buf, sizeof buf, "%s device is not tracking, waiting for it\n", device);
+		CalCtx.Log(buf);
 	}
+	return time - lostSince <= MaxTrackingLoss;
+}
 
-	Eigen::Matrix3d rot = svd.matrixV() * i * svd.matrixU().transpose();
-	rot.transposeInPlace();
-
-	Eigen::Vector3d euler = rot.eulerAngles(2, 1, 0) * 180.0 / EIGEN_PI;
-
-	snprintf(buf, sizeof buf, "Calibrated rotation: yaw=%.2f pitch=%.2f roll=%.2f\n", euler[1], euler[2], euler[0]);
+static void LogTrackingLossAbort()
+{
+	char buf[256];
+	snprintf(buf, sizeof buf, "Tracking was lost for more than %.0f seconds, aborting calibration!\n", MaxTrackingLoss);
 	CalCtx.Log(buf);
-	return euler;
 }
 
-Eigen::Vector3d CalibrateTranslation(const std::vector<Sample> &samples)
+/**
+ * Frames where either device isn't tracking well are skipped, they'd only add samples of
+ * quality 0 anyway. A calibration or verification only ends once a device stays lost for
+ * longer than MaxTrackingLoss, so briefly occluding one doesn't throw away what was collected.
+ * Returns false then, after logging why.
+ */
+static bool TrackingLossTolerable(bool referenceTracking, bool targetTracking, double time)
 {
-	std::vector<std::pair<Eigen::Vector3d, Eigen::Matrix3d>> deltas;
-
-	for (size_t i = 0; i < samples.size(); i++)
-	{
-		for (size_t j = 0; j < i; j++)
-		{
-			auto QAi = samples[i].ref.rot.transpose();
-			auto QAj = samples[j].ref.rot.transpose();
-			auto dQA = QAj - QAi;
-			auto CA = QAj * (samples[j].ref.trans - samples[j].target.trans) - QAi * (samples[i].ref.trans - samples[i].target.trans);
-			deltas.push_back(std::make_pair(CA, dQA));
-
-			auto QBi = samples[i].target.rot.transpose();
-			auto QBj = samples[j].target.rot.transpose();
-			auto dQB = QBj - QBi;
-			auto CB = QBj * (samples[j].ref.trans - samples[j].target.trans) - QBi * (samples[i].ref.trans - samples[i].target.trans);
-			deltas.push_back(std::make_pair(CB, dQB));
-		}
-	}
-
-	Eigen::VectorXd constants(deltas.size() * 3);
-	Eigen::MatrixXd coefficients(deltas.size() * 3, 3);
-
-	for (size_t i = 0; i < deltas.size(); i++)
-	{
-		for (int axis = 0; axis < 3; axis++)
-		{
-			constants(i * 3 + axis) = deltas[i].first(axis);
-			coefficients.row(i * 3 + axis) = deltas[i].second.row(axis);
-		}
-	}
-
-	Eigen::Vector3d trans = coefficients.bdcSvd(Eigen::ComputeThinU | Eigen::ComputeThinV).solve(constants);
-	auto transcm = trans * 100.0;
+	bool ok = FollowTracking(TrackingLostSince.reference, referenceTracking, time, "Reference");
+	ok = FollowTracking(TrackingLostSince.target, targetTracking, time, "Target") && ok;
+	if (!ok)
+		LogTrackingLossAbort();
+	return ok;
+}
 
-	char buf[256];
-	snprintf(buf, sizeof buf, "Calibrated translation x=%.2f y=%.2f z=%.2f\n", transcm[0], transcm[1], transcm[2]);
-	CalCtx.Log(buf);
-	return transcm;
+static bool PoseTracking(const vr::TrackedDevicePose_t &pose)
+{
+	return pose.bPoseIsValid && pose.eTrackingResult == vr::TrackingResult_Running_OK;
 }
 
-Sample CollectSample(const CalibrationContext &ctx)
+static bool PoseTracking(const protocol::PoseCaptureSample &pose)
 {
-	vr::TrackedDevicePose_t reference, target;
-	reference.bPoseIsValid = false;
-	target.bPoseIsValid = false;
+	return pose.valid && pose.trackingResult == vr::TrackingResult_Running_OK;
+}
 
-	reference = ctx.devicePoses[ctx.referenceID];
-	target = ctx.devicePoses[ctx.targetID];
+// Returns an invalid sample for frames without tracking, see TrackingLossTolerable.
+Sample CollectSample(const CalibrationContext &ctx, SampleRecord &record)
+{
+	auto &reference = ctx.devicePoses[ctx.referenceID];
+	auto &target = ctx.devicePoses[ctx.targetID];
 
-	bool ok = true;
-	if (!reference.bPoseIsValid)
-	{
-		CalCtx.Log("Reference device is not tracking\n"); ok = false;
-	}
-	if (!target.bPoseIsValid)
-	{
-		CalCtx.Log("Target device is not tracking\n"); ok = false;
-	}
-	if (!ok)
+	bool referenceTracking = PoseTracking(reference), targetTracking = PoseTracking(target);
+	if (!TrackingLossTolerable(referenceTracking, targetTracking, ctx.timeLastTick))
 	{
-		CalCtx.Log("Aborting calibration!\n");
 		CalCtx.state = CalibrationState::None;
 		return Sample();
 	}
+	if (!referenceTracking || !targetTracking)
+		return Sample();
+
+	record.reference = CaptureSampleFromPose(ctx.referenceID, reference);
+	record.target = CaptureSampleFromPose(ctx.targetID, target);
+	record.reference.timestamp += ctx.devicePosePrediction;
+	record.target.timestamp += ctx.devicePosePrediction;
+
+	record.quality = std::min(CapturedPoseQuality(record.reference), CapturedPoseQuality(record.target));
 
 	return Sample(
-		Pose(reference.mDeviceToAbsoluteTracking),
-		Pose(target.mDeviceToAbsoluteTracking)
+		PoseFromMatrix(reference.mDeviceToAbsoluteTracking),
+		PoseFromMatrix(target.mDeviceToAbsoluteTracking),
+		record.quality
 	);
 }
 
-vr::HmdQuaternion_t VRRotationQuat(Eigen::Vector3d eulerdeg)
+vr::HmdQuaternion_t VRQuat(const Eigen::Quaterniond &rotQuat)
 {
-	auto euler = eulerdeg * EIGEN_PI / 180.0;
-
-	Eigen::Quaterniond rotQuat =
-		Eigen::AngleAxisd(euler(0), Eigen::Vector3d::UnitZ()) *
-		Eigen::AngleAxisd(euler(1), Eigen::Vector3d::UnitY()) *
-		Eigen::AngleAxisd(euler(2), Eigen::Vector3d::UnitX());
-
 	vr::HmdQuaternion_t vrRotQuat;
 	vrRotQuat.x = rotQuat.coeffs()[0];
 	vrRotQuat.y = rotQuat.coeffs()[1];
@@ -294,7 +331,7 @@ vr::HmdVector3d_t VRTranslationVec(Eigen::Vector3d transcm)
 	return vrTrans;
 }
 
-void ResetAndDisableOffsets(uint32_t id)
+protocol::SetDeviceTransform ResetTransform(uint32_t id)
 {
 	vr::HmdVector3d_t zeroV;
 	zeroV.v[0] = zeroV.v[1] = zeroV.v[2] = 0;
@@ -302,347 +339,3197 @@ void ResetAndDisableOffsets(uint32_t id)
 	vr::HmdQuaternion_t zeroQ;
 	zeroQ.x = 0; zeroQ.y = 0; zeroQ.z = 0; zeroQ.w = 1;
 
-	protocol::Request req(protocol::RequestSetDeviceTransform);
-	req.setDeviceTransform = { id, false, zeroV, zeroQ, 1.0 };
-	Driver.SendBlocking(req);
+	return { id, false, zeroV, zeroQ, 1.0 };
 }
 
-static_assert(vr::k_unTrackedDeviceIndex_Hmd == 0, "HMD index expected to be 0");
-
-void ScanAndApplyProfile(CalibrationContext &ctx)
+// Shadow copy of the transforms the driver has applied, so profile passes only send what changed.
+struct DriverTransform
 {
-	char buffer[vr::k_unMaxPropertyStringSize];
-	ctx.enabled = ctx.validProfile;
+	bool known = false;
+	bool enabled;
+	vr::HmdVector3d_t translation;
+	vr::HmdQuaternion_t rotation;
+	double scale;
+};
 
-	for (uint32_t id = 0; id < vr::k_unMaxTrackedDeviceCount; ++id)
-	{
-		auto deviceClass = vr::VRSystem()->GetTrackedDeviceClass(id);
-		if (deviceClass == vr::TrackedDeviceClass_Invalid)
-			continue;
+static DriverTransform driverTransforms[vr::k_unMaxTrackedDeviceCount];
 
-		/*if (deviceClass == vr::TrackedDeviceClass_HMD) // for debugging unexpected universe switches
-		{
-			vr::ETrackedPropertyError err = vr::TrackedProp_Success;
-			auto universeId = vr::VRSystem()->GetUint64TrackedDeviceProperty(id, vr::Prop_CurrentUniverseId_Uint64, &err);
-			printf("uid %d err %d\n", universeId, err);
-			ResetAndDisableOffsets(id);
-			continue;
-		}*/
+// Last rules sent to the driver, see protocol::TrackingSystemRule.
+static protocol::SetTrackingSystemRules driverRules;
+static bool driverRulesKnown = false;
 
-		if (!ctx.enabled)
-		{
-			ResetAndDisableOffsets(id);
-			continue;
-		}
+// Devices the profile was applied to since they first reported poses through the driver.
+static uint64_t knownPosedMask = 0;
 
-		vr::ETrackedPropertyError err = vr::TrackedProp_Success;
-		vr::VRSystem()->GetStringTrackedDeviceProperty(id, vr::Prop_TrackingSystemName_String, buffer, vr::k_unMaxPropertyStringSize, &err);
+// Generation of the device under each OpenVR ID the shadow copy is for, and that transforms
+// are sent for, see protocol::TransformBuffer::Generation. 0 without shared memory, which the
+// driver takes for whichever device has the ID.
+static uint32_t knownGenerations[vr::k_unMaxTrackedDeviceCount];
 
-		if (err != vr::TrackedProp_Success)
-		{
-			ResetAndDisableOffsets(id);
-			continue;
-		}
+// Last filter chain sent to each device in knownFiltersMask, see SendPoseFilters. Filters
+// aren't part of the readback, so they're sent again whenever the shadow copy is rebuilt.
+static protocol::SetPoseFilters driverFilters[vr::k_unMaxTrackedDeviceCount];
+static uint64_t knownFiltersMask = 0;
 
-		std::string trackingSystem(buffer);
+// Last protocol::PoseHookMode sent, negative when the driver's isn't known.
+static int driverPoseHookMode = -1;
 
-		if (id == vr::k_unTrackedDeviceIndex_Hmd)
-		{
-			//auto p = ctx.devicePoses[id].mDeviceToAbsoluteTracking.m;
-			//printf("HMD %d: %f %f %f\n", id, p[0][3], p[1][3], p[2][3]);
+static void InvalidateDriverTransforms()
+{
+	for (auto &tf : driverTransforms)
+		tf.known = false;
+	for (auto &generation : knownGenerations)
+		generation = 0;
+	driverRulesKnown = false;
+	knownPosedMask = 0;
+	knownFiltersMask = 0;
+	driverPoseHookMode = -1;
+}
 
-			if (trackingSystem != ctx.referenceTrackingSystem)
-			{
-				// Currently using an HMD with a different tracking system than the calibration.
-				ctx.enabled = false;
-			}
+// Without shared memory there's no telling, so all devices count.
+static uint64_t PosedDevices()
+{
+	return Driver.Shared() ? Driver.Shared()->posedMask.load(std::memory_order_relaxed) : AllDevicesMask;
+}
 
-			ResetAndDisableOffsets(id);
-			continue;
-		}
+static uint32_t DriverGeneration(uint32_t id)
+{
+	return Driver.Shared() ? Driver.Shared()->transforms.Generation(id) : 0;
+}
 
-		if (trackingSystem != ctx.targetTrackingSystem)
-		{
-			ResetAndDisableOffsets(id);
-			continue;
-		}
+// Makes the shadow copy what the driver really has, so the next pass sends only what differs.
+// This also picks up transforms the driver restored or derived from rules on its own. Without
+// a readback everything is sent again.
+static void SyncDriverTransforms()
+{
+	// Read before the table, a device replaced in between is then picked up by the next pass.
+	uint32_t generations[vr::k_unMaxTrackedDeviceCount];
+	for (uint32_t id = 0; id < vr::k_unMaxTrackedDeviceCount; id++)
+		generations[id] = DriverGeneration(id);
 
-		protocol::Request req(protocol::RequestSetDeviceTransform);
-		req.setDeviceTransform = {
-			id,
-			true,
-			VRTranslationVec(ctx.calibratedTranslation),
-			VRRotationQuat(ctx.calibratedRotation),
-			ctx.calibratedScale
-		};
-		Driver.SendBlocking(req);
+	static protocol::DeviceTransforms table;
+	if (!Driver.ReadDeviceTransforms(table))
+	{
+		InvalidateDriverTransforms();
+		return;
 	}
+	std::copy(generations, generations + vr::k_unMaxTrackedDeviceCount, knownGenerations);
 
-	if (ctx.enabled && ctx.chaperone.valid && ctx.chaperone.autoApply)
+	for (uint32_t id = 0; id < vr::k_unMaxTrackedDeviceCount; id++)
 	{
-		uint32_t quadCount = 0;
-		vr::VRChaperoneSetup()->GetLiveCollisionBoundsInfo(nullptr, &quadCount);
-
-		// Heuristic: when SteamVR resets to a blank-ish chaperone, it uses empty geometry,
-		// but manual adjustments (e.g. via a play space mover) will not touch geometry.
-		if (quadCount != ctx.chaperone.geometry.size())
-		{
-			ApplyChaperoneBounds();
-		}
+		auto &tf = table.devices[id];
+		auto &shadow = driverTransforms[id];
+		shadow.known = true;
+		shadow.enabled = tf.enabled;
+		shadow.translation = tf.translation;
+		shadow.rotation = tf.rotation;
+		shadow.scale = tf.scale;
 	}
+	driverRulesKnown = false;
+	knownPosedMask = 0;
+	knownFiltersMask = 0;
+	driverPoseHookMode = -1;
 }
 
-Pose ApplyTransform(const Pose& originalPose, const Eigen::Vector3d& vrTrans, const Eigen::Matrix3d& rotMat) {
-	Pose pose(originalPose);
-	pose.rot = rotMat * pose.rot;
-	pose.trans = vrTrans + (rotMat * pose.trans);
-	return pose;
+static bool SameDriverTransform(const DriverTransform &a, const DriverTransform &b)
+{
+	return a.enabled == b.enabled &&
+		memcmp(&a.translation, &b.translation, sizeof a.translation) == 0 &&
+		memcmp(&a.rotation, &b.rotation, sizeof a.rotation) == 0 &&
+		a.scale == b.scale;
 }
 
-double RetargetingErrorRMS(
-	const std::vector<Sample>& samples,
-	const Eigen::Vector4d &hmdToTargetPos,
-	const vr::HmdVector3d_t& vrTrans,
-	const vr::HmdQuaternion_t& vrRotQuat
-) {
-	const auto rotMat = quaternionRotateMatrix(vrRotQuat);
-	const auto trans = Eigen::Vector3d(vrTrans.v);
-
-	double errorAccum = 0;
-	int sampleCount = 0;
-	for (auto& sample : samples) {
-		if (!sample.valid) continue;
-
-		// Apply transformation
-		const auto updatedPose = ApplyTransform(sample.target, trans, rotMat);
-		const Eigen::Vector4d targetToWorld = Eigen::Vector4d(updatedPose.trans(0), updatedPose.trans(1), updatedPose.trans(2), 1);
+// Updates the shadow copy with a transform about to be sent, returns false if the driver already has it.
+static bool RecordDriverTransform(const protocol::SetDeviceTransform &tf)
+{
+	auto &shadow = driverTransforms[tf.openVRID];
+	bool complete = tf.updateTranslation && tf.updateRotation && tf.updateScale;
+	if (!shadow.known && !complete)
+		return true;
+
+	// The driver ignores a disabled transform's values, so only the step from enabled to
+	// disabled needs sending. The shadow keeps the values the driver really has.
+	if (shadow.known && !shadow.enabled && !tf.enabled)
+		return false;
 
-		// Now compute it based on the HMD pose offset
-		const Eigen::Vector4d hmdAffine = sample.ref.ToAffine() * hmdToTargetPos;
+	DriverTransform next = shadow;
+	next.known = true;
+	next.enabled = tf.enabled;
+	if (tf.updateTranslation)
+		next.translation = tf.translation;
+	if (tf.updateRotation)
+		next.rotation = tf.rotation;
+	if (tf.updateScale)
+		next.scale = tf.scale;
+
+	bool changed = !shadow.known || !SameDriverTransform(shadow, next);
+	shadow = next;
+	return changed;
+}
 
-		// Compute error term
-		errorAccum += (hmdAffine - targetToWorld).squaredNorm();
-		sampleCount++;
+static void QueueDeviceTransform(protocol::SetDeviceTransformBatch &batch, const protocol::SetDeviceTransform &tf)
+{
+	if (RecordDriverTransform(tf))
+	{
+		auto &queued = batch.transforms[batch.count++];
+		queued = tf;
+		queued.generation = knownGenerations[tf.openVRID];
 	}
-
-	return sqrt(errorAccum / sampleCount);
 }
 
-Eigen::Vector4d DeriveRefToTargetOffset(
-	const std::vector<Sample>& samples,
-	const vr::HmdVector3d_t& vrTrans,
-	const vr::HmdQuaternion_t& vrRotQuat
-) {
-	const auto rotMat = quaternionRotateMatrix(vrRotQuat);
-	const auto trans = Eigen::Vector3d(vrTrans.v);
-
-	Eigen::Vector4d accum = Eigen::Vector4d::Zero();
-	int sampleCount = 0;
+void SendDeviceTransform(const protocol::SetDeviceTransform &tf)
+{
+	if (RecordDriverTransform(tf))
+	{
+		auto sent = tf;
+		sent.generation = knownGenerations[tf.openVRID];
+		Driver.SetDeviceTransforms(&sent, 1);
+	}
+}
 
-	for (auto& sample : samples) {
-		if (!sample.valid) continue;
+void ResetAndDisableOffsets(uint32_t id)
+{
+	SendDeviceTransform(ResetTransform(id));
+}
 
-		// Apply transformation
-		const auto updatedPose = ApplyTransform(sample.target, trans, rotMat);
+static_assert(vr::k_unTrackedDeviceIndex_Hmd == 0, "HMD index expected to be 0");
 
-		// Now move the transform from world to HMD space
-		const auto trans4 = Eigen::Vector4d(updatedPose.trans(0), updatedPose.trans(1), updatedPose.trans(2), 1);
-		const auto hmdSpace = sample.ref.ToAffine().inverse() * trans4;
+// Driver transform for each calibrated target system, resolved again when the profile changed.
+struct ResolvedTarget
+{
+	StringID trackingSystem;
+	protocol::SetDeviceTransform transform;
+};
 
-		accum += hmdSpace;
-		sampleCount++;
-	}
+static std::vector<ResolvedTarget> resolvedTargets;
+static std::vector<StringID> graphSystems; // Systems with an edge in Graph, from the last pass.
 
-	accum /= sampleCount;
-	accum(3) = 1; // Ensure we're precisely in affine form
+// Returns whether the graph changed.
+static bool AddGraphEdge(const CalibrationContext &ctx, std::vector<StringID> &systems, StringID trackingSystem, StringID parentSystem,
+	const Eigen::Quaterniond &rotation, const Eigen::Vector3d &translation, double scale)
+{
+	if (trackingSystem == NoString || trackingSystem == ctx.referenceTrackingSystem ||
+		std::find(systems.begin(), systems.end(), trackingSystem) != systems.end())
+		return false;
 
-	return accum;
+	TransformGraph::Transform edge;
+	edge.rotation = rotation.toRotationMatrix();
+	edge.translation = translation;
+	edge.scale = scale;
+	systems.push_back(trackingSystem);
+	return Graph.SetEdge(trackingSystem, parentSystem != NoString ? parentSystem : ctx.referenceTrackingSystem, edge);
 }
 
 /**
- * Determines how sensitive the sampled data is to changes in the calibrated rot/trans values.
+ * Brings the transform graph in line with the profile and flattens it into one transform per
+ * system. Unchanged calibrations keep their cached compositions, so an edit only recomputes
+ * the systems chained below the edited one, and a pass over an unchanged profile keeps the
+ * driver transforms of the last one. Systems whose chain doesn't reach the reference are left
+ * out, their devices get no transform.
  */
-bool ComputeSensitivity(
-	CalibrationContext& CalCtx,
-	const std::vector<Sample>& samples,
-	const vr::HmdVector3d_t& vrTrans,
-	const vr::HmdQuaternion_t& vrRotQuat
-) {
-	bool reject = false;
-	const auto posOffset = DeriveRefToTargetOffset(samples, vrTrans, vrRotQuat);
-	char buf[256];
+static void ResolveTargets(const CalibrationContext &ctx)
+{
+	bool changed = Graph.Root() != ctx.referenceTrackingSystem;
+	Graph.SetRoot(ctx.referenceTrackingSystem);
 
-	snprintf(buf, sizeof buf, "HMD to target offset: (%.2f, %.2f, %.2f)\n", posOffset(0), posOffset(1), posOffset(2));
-	CalCtx.Log(buf);
+	// The selected target goes first, so it wins over a stale entry for the same system.
+	std::vector<StringID> systems;
+	if (ctx.validProfile)
+		changed |= AddGraphEdge(ctx, systems, ctx.targetTrackingSystem, ctx.targetParentSystem, ctx.calibratedRotation, ctx.calibratedTranslation, ctx.calibratedScale);
 
-	double baseError = RetargetingErrorRMS(samples, posOffset, vrTrans, vrRotQuat);
-	snprintf(buf, sizeof buf, "Position error (RMS error): %.2f\n", baseError);
-	CalCtx.Log(buf);
-	if (baseError > 0.1) reject = true;
+	for (auto &target : ctx.otherTargets)
+		changed |= AddGraphEdge(ctx, systems, target.trackingSystem, target.parentSystem, target.rotation, target.translation, target.scale);
 
-	// Compute errors with rotation perturbations
+	for (auto system : graphSystems)
+	{
+		if (std::find(systems.begin(), systems.end(), system) == systems.end())
+			changed |= Graph.RemoveEdge(system);
+	}
 
-	double deltaError = RetargetingErrorRMS(samples, posOffset, vrTrans, VRRotationQuat(Eigen::Vector3d(10, 0, 0)) * vrRotQuat) - baseError;
-	if (deltaError < 0.2) reject = true;
+	if (!changed && systems == graphSystems)
+		return;
+	graphSystems = systems;
 
-	snprintf(buf, sizeof buf, "Sensitivity rotation X (RMS error delta): %.2f\n", deltaError);
-	CalCtx.Log(buf);
+	resolvedTargets.clear();
+	for (auto system : systems)
+	{
+		TransformGraph::Transform tf;
+		if (!Graph.Resolve(system, tf))
+			continue;
 
-	deltaError = RetargetingErrorRMS(samples, posOffset, vrTrans, VRRotationQuat(Eigen::Vector3d(0, 10, 0)) * vrRotQuat) - baseError;
-	if (deltaError < 0.2) reject = true;
+		Eigen::Quaterniond rotation(tf.rotation);
+		resolvedTargets.push_back({ system, { 0, true, VRTranslationVec(tf.translation), VRQuat(rotation), tf.scale } });
+	}
+}
 
-	snprintf(buf, sizeof buf, "Sensitivity rotation Y (RMS error delta): %.2f\n", deltaError);
-	CalCtx.Log(buf);
+// Lets the driver give devices of the calibrated systems their transform as soon as they show
+// up. Only sent when the rules changed.
+static void SendTrackingSystemRules(const CalibrationContext &ctx)
+{
+	// Older drivers only get transforms per device, as they show up in the registry.
+	if (!Driver.Supports(protocol::CapabilityTrackingSystemRules))
+		return;
 
-	deltaError = RetargetingErrorRMS(samples, posOffset, vrTrans, VRRotationQuat(Eigen::Vector3d(0, 0, 10)) * vrRotQuat) - baseError;
-	if (deltaError < 0.2) reject = true;
+	protocol::Request request(protocol::RequestSetTrackingSystemRules);
+	auto &rules = request.setTrackingSystemRules;
+	rules.count = 0;
 
-	snprintf(buf, sizeof buf, "Sensitivity rotation Z (RMS error delta): %.2f\n", deltaError);
-	CalCtx.Log(buf);
+	if (ctx.enabled)
+	{
+		for (auto &target : resolvedTargets)
+		{
+			auto &name = InternedString(target.trackingSystem);
+			if (rules.count == protocol::MaxTrackingSystemRules || name.size() >= protocol::MaxTrackingSystemNameLength)
+				continue;
+
+			auto &rule = rules.rules[rules.count++];
+			memset(&rule, 0, sizeof rule);
+			strncpy_s(rule.trackingSystem, name.c_str(), _TRUNCATE);
+			rule.translation = target.transform.translation;
+			rule.rotation = target.transform.rotation;
+			rule.scale = target.transform.scale;
+		}
+	}
+
+	request.size = rules.PayloadSize();
+	if (driverRulesKnown && driverRules.count == rules.count && memcmp(driverRules.rules, rules.rules, rules.count * sizeof rules.rules[0]) == 0)
+		return;
 
-	return reject;
+	driverRules = rules;
+	driverRulesKnown = true;
+	Driver.SendAsync(request);
 }
 
-void StartCalibration()
+// A rig tracker silent for longer keeps the last correction, see protocol::PoseFilterCompensate.
+static const double MaxMotionRigPoseAge = 0.05; // seconds
+
+// The devices of the HMD's tracking system ride the platform along with the rig tracker.
+static bool MotionCompensated(const CalibrationContext &ctx, uint32_t id)
 {
-	CalCtx.state = CalibrationState::Begin;
-	CalCtx.wantedUpdateInterval = 0.0;
-	CalCtx.messages.clear();
+	if (ctx.motionRigID >= vr::k_unMaxTrackedDeviceCount || id == ctx.motionRigID || !Driver.Supports(protocol::CapabilityMotionCompensation))
+		return false;
+
+	auto &device = Devices.devices[id];
+	auto &hmd = Devices.devices[vr::k_unTrackedDeviceIndex_Hmd];
+	return device.hasTrackingSystem && hmd.hasTrackingSystem && device.trackingSystem == hmd.trackingSystem;
 }
 
-void CalibrationTick(double time)
-{
-	if (!vr::VRSystem())
-		return;
+// Position noise of the linked device and of its source, see protocol::PoseFilterFusion. Both
+// systems track a body part to a few mm, so neither is trusted more.
+static const double LinkedPositionNoise = 0.004; // m
+static const double LinkSourcePositionNoise = 0.004; // m
 
-	auto &ctx = CalCtx;
-	if ((time - ctx.timeLastTick) < 0.05)
+// How hard a hand or foot is expected to speed up, larger follows quick moves sooner and
+// smooths them less.
+static const double LinkAccelerationNoise = 10.0; // m/s^2
+
+// A source pose older than this doesn't stand in for the lost device, which stays lost.
+static const double LinkFallbackMaxAge = 0.1; // seconds
+
+// How far each pose with both tracking moves the fallback offset toward the one measured, so
+// straps that slip are followed over a second or two of tracking.
+static const double LinkOffsetLearning = 0.01;
+
+/**
+ * The device's whole filter chain, nothing else sets filters. A linked device is fused with its
+ * source or falls back on it first, the stage has to head the chain to carry the device while it
+ * is lost. With a
+ * motion rig selected the platform's motion then comes out of the devices riding it. Devices of the target system are
+ * then shifted in time by the latency the calibration measured, so they move in step with the
+ * reference instead of ahead of or behind it.
+ */
+static void SendPoseFilters(const CalibrationContext &ctx, uint32_t id)
+{
+	if (!Driver.Supports(protocol::CapabilityPoseFilters))
 		return;
 
-	ctx.timeLastTick = time;
-	vr::VRSystem()->GetDeviceToAbsoluteTrackingPose(vr::TrackingUniverseRawAndUncalibrated, 0.0f, ctx.devicePoses, vr::k_unMaxTrackedDeviceCount);
+	protocol::SetPoseFilters filters;
+	memset(&filters, 0, sizeof filters);
+	filters.openVRID = id;
 
-	if (ctx.state == CalibrationState::None)
+	bool fused = ctx.linkMode == DeviceLinkMode::Fuse;
+	if (id == ctx.linkedID && ctx.linkSourceID < vr::k_unMaxTrackedDeviceCount &&
+		Driver.Supports(fused ? protocol::CapabilityPoseFusion : protocol::CapabilityPoseFallback))
 	{
-		ctx.wantedUpdateInterval = 1.0;
-
-		if ((time - ctx.timeLastScan) >= 1.0)
+		auto &stage = filters.stages[filters.count++];
+		stage.sourceID = ctx.linkSourceID;
+		if (fused)
 		{
-			ScanAndApplyProfile(ctx);
-			ctx.timeLastScan = time;
+			stage.type = protocol::PoseFilterFusion;
+			stage.params[0] = LinkedPositionNoise;
+			stage.params[1] = LinkSourcePositionNoise;
+			stage.params[2] = LinkAccelerationNoise;
 		}
-		return;
+		else
+		{
+			stage.type = protocol::PoseFilterFallback;
+			stage.params[0] = LinkFallbackMaxAge;
+			stage.params[1] = LinkOffsetLearning;
+		}
+		stage.offsetTranslation = ctx.linkOffsetTranslation;
+		stage.offsetRotation = ctx.linkOffsetRotation;
 	}
 
-	if (ctx.state == CalibrationState::Editing)
+	if (MotionCompensated(ctx, id))
 	{
-		ctx.wantedUpdateInterval = 0.1;
+		auto &stage = filters.stages[filters.count++];
+		stage.type = protocol::PoseFilterCompensate;
+		stage.sourceID = ctx.motionRigID;
+		stage.params[0] = MaxMotionRigPoseAge;
+		stage.offsetTranslation = ctx.motionNeutralTranslation;
+		stage.offsetRotation = ctx.motionNeutralRotation;
+	}
 
-		if ((time - ctx.timeLastScan) >= 0.1)
+	auto &device = Devices.devices[id];
+	if (Driver.Supports(protocol::CapabilityPosePrediction) && ctx.enabled && ctx.validProfile && ctx.latencyCompensation &&
+		device.hasTrackingSystem && device.trackingSystem == ctx.targetTrackingSystem)
+	{
+		double prediction = std::max(-protocol::MaxPosePrediction, std::min(-ctx.targetLatency, protocol::MaxPosePrediction));
+		if (prediction != 0)
 		{
-			ScanAndApplyProfile(ctx);
-			ctx.timeLastScan = time;
+			auto &stage = filters.stages[filters.count++];
+			stage.type = protocol::PoseFilterPredict;
+			stage.params[0] = prediction;
 		}
-		return;
 	}
 
-	if (ctx.state == CalibrationState::Begin)
-	{
-		bool ok = true;
+	uint64_t bit = DeviceBit(id);
+	if ((knownFiltersMask & bit) && memcmp(&driverFilters[id], &filters, sizeof filters) == 0)
+		return;
+	knownFiltersMask |= bit;
+	driverFilters[id] = filters;
 
-		char referenceSerial[256], targetSerial[256];
-		vr::VRSystem()->GetStringTrackedDeviceProperty(ctx.referenceID, vr::Prop_SerialNumber_String, referenceSerial, 256);
-		vr::VRSystem()->GetStringTrackedDeviceProperty(ctx.targetID, vr::Prop_SerialNumber_String, targetSerial, 256);
+	protocol::Request request(protocol::RequestSetPoseFilters);
+	request.setPoseFilters = filters;
+	request.size = sizeof filters;
+	Driver.SendAsync(request);
+}
 
-		char buf[256];
-		snprintf(buf, sizeof buf, "Reference device ID: %d, serial: %s\n", ctx.referenceID, referenceSerial);
-		CalCtx.Log(buf);
-		snprintf(buf, sizeof buf, "Target device ID: %d, serial %s\n", ctx.targetID, targetSerial);
-		CalCtx.Log(buf);
+// Without a profile to apply the driver may take its pose hooks out, when nothing else of ours
+// needs them. Devices only count as posed once they report through the hooks, so an enabled
+// profile keeps them in for the devices it has yet to see.
+static void SendPoseHookMode(const CalibrationContext &ctx)
+{
+	if (!Driver.Supports(protocol::CapabilityPoseHookMode))
+		return;
 
-		if (ctx.referenceID == -1)
-		{
-			CalCtx.Log("Missing reference device\n"); ok = false;
-		}
-		else if (!ctx.devicePoses[ctx.referenceID].bPoseIsValid)
-		{
-			CalCtx.Log("Reference device is not tracking\n"); ok = false;
-		}
+	int mode = ctx.enabled ? protocol::PoseHookAlways : protocol::PoseHookWhenNeeded;
+	if (mode == driverPoseHookMode)
+		return;
+	driverPoseHookMode = mode;
 
-		if (ctx.targetID == -1)
-		{
-			CalCtx.Log("Missing target device\n"); ok = false;
-		}
-		else if (!ctx.devicePoses[ctx.targetID].bPoseIsValid)
-		{
-			CalCtx.Log("Target device is not tracking\n"); ok = false;
-		}
+	protocol::Request request(protocol::RequestSetPoseHookMode);
+	request.setPoseHookMode.mode = (uint32_t) mode;
+	request.setPoseHookMode.reserved = 0;
+	request.size = sizeof request.setPoseHookMode;
+	Driver.SendAsync(request);
+}
 
-		if (!ok)
-		{
-			ctx.state = CalibrationState::None;
-			CalCtx.Log("Aborting calibration!\n");
-			return;
-		}
+static void ApplyProfileToDevice(const CalibrationContext &ctx, uint32_t id, protocol::SetDeviceTransformBatch &batch)
+{
+	auto &device = Devices.devices[id];
+	if (!device.present)
+		return;
 
-		ResetAndDisableOffsets(ctx.targetID);
-		ctx.state = CalibrationState::Rotation;
-		ctx.wantedUpdateInterval = 0.0;
+	// Nothing would ever read the transform. The device gets one once it shows a pose, see
+	// UpdateProfileDevices.
+	if (!(PosedDevices() & DeviceBit(id)))
+		return;
 
-		CalCtx.Log("Starting calibration...\n");
+	SendPoseFilters(ctx, id);
+
+	if (!ctx.enabled || !device.hasTrackingSystem || id == vr::k_unTrackedDeviceIndex_Hmd)
+	{
+		QueueDeviceTransform(batch, ResetTransform(id));
 		return;
 	}
 
-	auto sample = CollectSample(ctx);
+	for (auto &target : resolvedTargets)
+	{
+		if (target.trackingSystem != device.trackingSystem)
+			continue;
+
+		auto tf = target.transform;
+		tf.openVRID = id;
+
+		// Layered under the system transform: R = Rs Ro, t = s Rs to + ts.
+		auto offset = FindDeviceOffset(ctx, id);
+		if (offset)
+		{
+			Eigen::Quaterniond system(tf.rotation.w, tf.rotation.x, tf.rotation.y, tf.rotation.z);
+			Eigen::Vector3d translation = tf.scale * (system * offset->translation * 0.01);
+			tf.rotation = VRQuat(system * EulerQuat(offset->rotation));
+			for (int i = 0; i < 3; i++)
+				tf.translation.v[i] += translation(i);
+		}
+
+		QueueDeviceTransform(batch, tf);
+		return;
+	}
+
+	QueueDeviceTransform(batch, ResetTransform(id));
+}
+
+// Applies the profile to the devices in the mask, or to every device if the profile's enabled state changed.
+static void ApplyProfile(CalibrationContext &ctx, uint64_t deviceMask)
+{
+	ScopedTiming timing(TimingSection::ProfileApply);
+	bool wasEnabled = ctx.enabled;
+	ctx.enabled = ctx.validProfile || !ctx.otherTargets.empty();
+
+	auto &hmd = Devices.devices[vr::k_unTrackedDeviceIndex_Hmd];
+	if (ctx.enabled && hmd.present && hmd.hasTrackingSystem && hmd.trackingSystem != ctx.referenceTrackingSystem)
+	{
+		// Currently using an HMD with a different tracking system than the calibration.
+		ctx.enabled = false;
+	}
+
+	if (ctx.enabled != wasEnabled)
+		deviceMask = AllDevicesMask;
+
+	ResolveTargets(ctx);
+	SendTrackingSystemRules(ctx);
+	SendPoseHookMode(ctx);
+
+	// All transforms for this pass go to the driver in one update.
+	protocol::SetDeviceTransformBatch batch;
+	batch.count = 0;
+
+	for (uint32_t id = 0; id < vr::k_unMaxTrackedDeviceCount; ++id)
+	{
+		if (deviceMask & DeviceBit(id))
+			ApplyProfileToDevice(ctx, id, batch);
+	}
+
+	if (batch.count > 0)
+		Driver.SetDeviceTransforms(batch.transforms, batch.count);
+}
+
+const DeviceOffset *FindDeviceOffset(const CalibrationContext &ctx, uint32_t id)
+{
+	if (ctx.deviceOffsets.empty() || id >= vr::k_unMaxTrackedDeviceCount)
+		return nullptr;
+
+	auto &device = Devices.devices[id];
+	if (!device.present || device.serial == NoString)
+		return nullptr;
+
+	auto existing = ctx.deviceOffsets.find(device.serial);
+	return existing != ctx.deviceOffsets.end() ? &existing->second : nullptr;
+}
+
+// Keeps the calibration of the previously selected target in otherTargets, and brings up the
+// stored calibration of the new one if there is one.
+void SelectTargetSystem(StringID trackingSystem)
+{
+	auto &ctx = CalCtx;
+	if (trackingSystem == ctx.targetTrackingSystem)
+		return;
+
+	auto &others = ctx.otherTargets;
+	StringID previous = ctx.targetTrackingSystem, next = trackingSystem;
+
+	others.erase(std::remove_if(others.begin(), others.end(), [previous](const TargetProfile &target) {
+		return target.trackingSystem == previous;
+	}), others.end());
+
+	if (ctx.validProfile && previous != NoString)
+	{
+		TargetProfile stored;
+		stored.trackingSystem = previous;
+		stored.parentSystem = ctx.targetParentSystem;
+		stored.rotation = ctx.calibratedRotation;
+		stored.translation = ctx.calibratedTranslation;
+		stored.scale = ctx.calibratedScale;
+		others.push_back(stored);
+	}
+
+	ctx.targetTrackingSystem = trackingSystem;
+	ctx.targetParentSystem = NoString;
+	ctx.validProfile = false;
+	ctx.calibratedRotation = Eigen::Quaterniond::Identity();
+	ctx.calibratedTranslation = Eigen::Vector3d::Zero();
+	ctx.calibratedScale = 1.0;
+
+	auto existing = std::find_if(others.begin(), others.end(), [next](const TargetProfile &target) {
+		return target.trackingSystem == next;
+	});
+
+	if (existing != others.end())
+	{
+		ctx.calibratedRotation = existing->rotation;
+		ctx.calibratedTranslation = existing->translation;
+		ctx.calibratedScale = existing->scale;
+		ctx.targetParentSystem = existing->parentSystem;
+		ctx.validProfile = true;
+		others.erase(existing);
+	}
+}
+
+static bool LiveChaperoneMatchesProfile(const CalibrationContext &ctx)
+{
+	static std::vector<vr::HmdQuad_t> live;
+
+	uint32_t quadCount = 0;
+	vr::VRChaperoneSetup()->GetLiveCollisionBoundsInfo(nullptr, &quadCount);
+	if (quadCount != ctx.chaperone.geometry.size())
+		return false;
+
+	live.resize(quadCount);
+	if (quadCount > 0 && !vr::VRChaperoneSetup()->GetLiveCollisionBoundsInfo(live.data(), &quadCount))
+		return false;
+
+	// The raw corner coordinates, SteamVR hands back exactly what was set.
+	return quadCount == live.size() && memcmp(live.data(), ctx.chaperone.geometry.data(), quadCount * sizeof(vr::HmdQuad_t)) == 0;
+}
+
+static const double EditSaveDelay = 1.0; // seconds
+static bool editSavePending = false;
+static double timeLastEdit = 0;
+
+void ProfileEdited(uint64_t deviceMask)
+{
+	ApplyProfile(CalCtx, deviceMask);
+	editSavePending = true;
+	timeLastEdit = CalCtx.timeLastTick;
+}
+
+static const double ChaperoneCommitInterval = 2.0; // seconds
+static double timeLastChaperoneCommit = -ChaperoneCommitInterval;
+
+// Devices the driver replaced since the last pass: another one connected, or may yet, under
+// the ID of one that disconnected, and the driver reset everything the ID had. They're read
+// again and get the profile as new devices once they report a pose, whatever the device
+// events said so far.
+static void ForgetReplacedDevices()
+{
+	if (!Driver.Shared())
+		return;
+
+	uint64_t replaced = 0;
+	for (uint32_t id = 0; id < vr::k_unMaxTrackedDeviceCount; id++)
+	{
+		uint32_t generation = DriverGeneration(id);
+		if (generation == knownGenerations[id])
+			continue;
+
+		knownGenerations[id] = generation;
+		driverTransforms[id].known = false;
+		replaced |= DeviceBit(id);
+		Devices.Refresh(id);
+	}
+
+	knownPosedMask &= ~replaced;
+	knownFiltersMask &= ~replaced;
+}
+
+/**
+ * Applies the profile to devices the registry saw change, or to all of them for the periodic
+ * full pass. New devices of a calibrated system already got the system transform from the
+ * driver's rules, this adds their device offset and catches everything else.
+ */
+static void UpdateProfileDevices(CalibrationContext &ctx, bool fullPass)
+{
+	ForgetReplacedDevices();
+	uint64_t posed = PosedDevices();
+	uint64_t newlyPosed = posed & ~knownPosedMask;
+	knownPosedMask = posed;
+
+	if (fullPass)
+	{
+		Devices.TakeDirty();
+		ApplyProfile(ctx, AllDevicesMask);
+		if (ctx.driverConnected)
+			MarkStartupPhase(StartupPhase::ProfileApplied);
+	}
+	else if (Devices.dirty || newlyPosed)
+	{
+		ApplyProfile(ctx, Devices.TakeDirty() | newlyPosed);
+	}
+
+	// Only looked at after SteamVR reports a change, and kept pending while auto apply can't run.
+	// Commits are spaced out, so a play space mover resetting the chaperone repeatedly only
+	// costs one chaperone write per interval.
+	if (ctx.enabled && ctx.chaperone.valid && ctx.chaperone.autoApply && Devices.chaperoneChanged &&
+		(ctx.timeLastTick - timeLastChaperoneCommit) >= ChaperoneCommitInterval)
+	{
+		Devices.chaperoneChanged = false;
+
+		// When SteamVR resets the chaperone it replaces the geometry, but manual adjustments
+		// (e.g. via a play space mover) only move the standing center, so only geometry counts.
+		// Our own commit raises another change event, which then finds matching geometry.
+		if (!LiveChaperoneMatchesProfile(ctx) && ApplyChaperoneBounds())
+		{
+			timeLastChaperoneCommit = ctx.timeLastTick;
+		}
+	}
+}
+
+void SwapUniverseProfile(CalibrationContext &ctx, UniverseProfile &profile)
+{
+	std::swap(ctx.universeID, profile.universeID);
+	std::swap(ctx.referenceTrackingSystem, profile.referenceTrackingSystem);
+	std::swap(ctx.targetTrackingSystem, profile.targetTrackingSystem);
+	std::swap(ctx.targetParentSystem, profile.targetParentSystem);
+	std::swap(ctx.calibratedRotation, profile.calibratedRotation);
+	std::swap(ctx.calibratedTranslation, profile.calibratedTranslation);
+	std::swap(ctx.calibratedScale, profile.calibratedScale);
+	std::swap(ctx.targetLatency, profile.targetLatency);
+	std::swap(ctx.validProfile, profile.validProfile);
+	std::swap(ctx.otherTargets, profile.otherTargets);
+	std::swap(ctx.chaperone, profile.chaperone);
+}
+
+// A universe has at most one stored profile. Serials don't pick it, which devices are
+// switched on changes from one start to the next.
+static std::vector<UniverseProfile>::iterator FindUniverseProfile(CalibrationContext &ctx, uint64_t universe)
+{
+	auto &others = ctx.otherUniverses;
+	return std::find_if(others.begin(), others.end(), [universe](const UniverseProfile &profile) {
+		return profile.universeID == universe;
+	});
+}
+
+/**
+ * Runs once the profile is loaded, before anything is applied. Picks the profile of the
+ * universe the HMD starts in, so the first pass sends its transforms to the driver rather
+ * than those of the universe last saved, followed by a switch in the next tick.
+ */
+static void SelectStartupUniverse(CalibrationContext &ctx)
+{
+	uint64_t universe = Devices.CurrentUniverse();
+	if (universe == 0 || ctx.universeID == 0 || universe == ctx.universeID)
+		return;
+
+	auto stored = FindUniverseProfile(ctx, universe);
+	if (stored == ctx.otherUniverses.end())
+		return; // UpdateUniverse starts a profile for it.
+
+	UniverseProfile previous;
+	SwapUniverseProfile(ctx, previous);
+	SwapUniverseProfile(ctx, *stored);
+	ctx.otherUniverses.erase(stored);
+	if (previous.validProfile || !previous.otherTargets.empty())
+		ctx.otherUniverses.push_back(std::move(previous));
+
+	std::cout << "Starting with the profile of universe " << universe << std::endl;
+}
+
+/**
+ * Follows the HMD into another universe. The current calibrations go to otherUniverses and
+ * the new universe's come out of it, then every device's transform goes to the driver in one
+ * batch, which the driver takes over in a single table swap. A profile that doesn't know its
+ * universe yet is taken to belong to the current one.
+ */
+static void UpdateUniverse(CalibrationContext &ctx)
+{
+	uint64_t universe = Devices.CurrentUniverse();
+	if (universe == 0 || universe == ctx.universeID)
+		return;
+
+	if (ctx.universeID == 0)
+	{
+		ctx.universeID = universe;
+		if (ctx.validProfile || !ctx.otherTargets.empty())
+			SaveProfile(ctx);
+		return;
+	}
+
+	UniverseProfile previous;
+	SwapUniverseProfile(ctx, previous);
+	bool keep = previous.validProfile || !previous.otherTargets.empty();
+
+	auto &others = ctx.otherUniverses;
+	auto stored = FindUniverseProfile(ctx, universe);
+
+	char buf[256];
+	if (stored != others.end())
+	{
+		SwapUniverseProfile(ctx, *stored);
+		others.erase(stored);
+		snprintf(buf, sizeof buf, "Switched to the profile of universe %llu\n", (unsigned long long) universe);
+	}
+	else
+	{
+		// Nothing calibrated here yet, the systems stay selected for calibrating.
+		ctx.universeID = universe;
+		ctx.referenceTrackingSystem = previous.referenceTrackingSystem;
+		ctx.targetTrackingSystem = previous.targetTrackingSystem;
+		snprintf(buf, sizeof buf, "Universe %llu has no profile yet\n", (unsigned long long) universe);
+	}
+	CalCtx.Log(buf);
+
+	if (keep)
+		others.push_back(std::move(previous));
+	ctx.calibrateAgainst = NoString;
+	Devices.chaperoneChanged = true;
+	ApplyProfile(ctx, AllDevicesMask);
+}
+
+// Takes over a profile another station published, see ProfileSync. Like at startup, it may
+// hold the universe the HMD is in among its others.
+static void ApplyReceivedProfile(CalibrationContext &ctx)
+{
+	std::vector<uint8_t> data;
+	if (!SharedProfiles.TakeReceived(data))
+		return;
+
+	try
+	{
+		ApplySharedProfile(ctx, data);
+	}
+	catch (std::runtime_error &e)
+	{
+		CalCtx.Log(std::string("Ignored a profile shared by another station: ") + e.what() + "\n");
+		return;
+	}
+
+	SelectStartupUniverse(ctx);
+	Devices.chaperoneChanged = true;
+	ApplyProfile(ctx, AllDevicesMask);
+	CalCtx.Log("Applied a profile shared by another station\n");
+}
+
+static const double AnchorSeconds = 2.0; // Of poses averaged into the anchor's.
+static const double AnchorPollInterval = 0.02; // seconds
+static const double AnchorMaxSpread = 0.002; // meters, an anchor that moved more was bumped.
+
+static AnchorEstimator Anchor;
+static uint32_t anchorID = vr::k_unTrackedDeviceIndexInvalid; // Invalid while not aligning.
+static double anchorStartTime = 0;
+
+static uint32_t TrackingDeviceWithSerial(const CalibrationContext &ctx, StringID serial)
+{
+	for (uint32_t id = 0; id < vr::k_unMaxTrackedDeviceCount && serial != NoString; id++)
+	{
+		auto &pose = ctx.devicePoses[id];
+		if (Devices.devices[id].serial == serial && pose.bPoseIsValid && pose.eTrackingResult == vr::TrackingResult_Running_OK)
+			return id;
+	}
+	return vr::k_unTrackedDeviceIndexInvalid;
+}
+
+bool StartAnchorAlignment()
+{
+	auto &ctx = CalCtx;
+	uint32_t id = TrackingDeviceWithSerial(ctx, ctx.anchorSerial);
+	if (ctx.state != CalibrationState::None || id == vr::k_unTrackedDeviceIndexInvalid)
+	{
+		ctx.Log("Can't align to the shared anchor, it isn't set or isn't tracking\n");
+		SharedProfiles.ReportAnchor(AnchorNotFound, 0.0);
+		return false;
+	}
+
+	Anchor.Reset();
+	anchorID = id;
+	anchorStartTime = ctx.timeLastTick;
+	ctx.Log("Aligning to the shared anchor, keep it still\n");
+	WakeCalibrationThread();
+	return true;
+}
+
+bool AnchorAlignmentRunning()
+{
+	return anchorID != vr::k_unTrackedDeviceIndexInvalid;
+}
+
+// The bounds stay where they are in the room, only the origin moves onto the anchor.
+static void FinishAnchorAlignment(CalibrationContext &ctx)
+{
+	double spread = Anchor.Spread();
+	char buf[256];
+	if (spread > AnchorMaxSpread)
+	{
+		snprintf(buf, sizeof buf, "The shared anchor moved %.1f mm while it was measured, try again\n", spread * 1000.0);
+		ctx.Log(buf);
+		SharedProfiles.ReportAnchor(AnchorMoved, spread);
+		return;
+	}
+
+	auto setup = vr::VRChaperoneSetup();
+	setup->RevertWorkingCopy();
+	vr::HmdMatrix34_t previous;
+	if (!setup->GetWorkingStandingZeroPoseToRawTrackingPose(&previous))
+	{
+		ctx.Log("Can't align to the shared anchor, SteamVR has no standing play space\n");
+		SharedProfiles.ReportAnchor(AnchorNotFound, spread);
+		return;
+	}
+	auto zero = AnchorStandingZero(Anchor.Position(), Anchor.Rotation(), previous.m[1][3]);
+
+	uint32_t quadCount = 0;
+	setup->GetWorkingCollisionBoundsInfo(nullptr, &quadCount);
+	std::vector<vr::HmdQuad_t> bounds(quadCount);
+	if (quadCount > 0 && setup->GetWorkingCollisionBoundsInfo(bounds.data(), &quadCount))
+	{
+		KeepChaperoneInPlace(bounds, previous, zero);
+		setup->SetWorkingCollisionBoundsInfo(bounds.data(), quadCount);
+	}
+	setup->SetWorkingStandingZeroPoseToRawTrackingPose(&zero);
+	setup->CommitWorkingCopy(vr::EChaperoneConfigFile_Live);
+
+	// Or auto apply would put the old origin back with the next chaperone change.
+	if (ctx.chaperone.valid)
+	{
+		KeepChaperoneInPlace(ctx.chaperone.geometry, ctx.chaperone.standingCenter, zero);
+		ctx.chaperone.standingCenter = zero;
+		ProfileEdited(0);
+	}
+
+	snprintf(buf, sizeof buf, "Aligned to the shared anchor, it moved %.1f mm while it was measured\n", spread * 1000.0);
+	ctx.Log(buf);
+	SharedProfiles.ReportAnchor(AnchorAligned, spread);
+}
+
+/**
+ * Takes the anchor's poses while idle, at a faster tick so the couple of seconds give enough to
+ * average. A publishing station's request starts an alignment here like the button does.
+ */
+static void UpdateAnchorAlignment(CalibrationContext &ctx)
+{
+	if (SharedProfiles.TakeAnchorRequest())
+		StartAnchorAlignment();
+	if (!AnchorAlignmentRunning())
+		return;
+
+	auto &pose = ctx.devicePoses[anchorID];
+	if (!pose.bPoseIsValid || pose.eTrackingResult != vr::TrackingResult_Running_OK)
+	{
+		anchorID = vr::k_unTrackedDeviceIndexInvalid;
+		ctx.Log("The shared anchor lost tracking while it was measured\n");
+		SharedProfiles.ReportAnchor(AnchorNotFound, 0.0);
+		return;
+	}
+
+	Anchor.Push(pose.mDeviceToAbsoluteTracking);
+	ctx.wantedUpdateInterval = AnchorPollInterval;
+	if (ctx.timeLastTick - anchorStartTime < AnchorSeconds)
+		return;
+
+	anchorID = vr::k_unTrackedDeviceIndexInvalid;
+	FinishAnchorAlignment(ctx);
+}
+
+/**
+ * A recalibration usually corrects a little drift, so the solve starts from the profile it
+ * replaces and needs fewer samples to be certain of the result, see CalibrationPrior. Only
+ * when the session measures the same calibration the profile holds: the selected target's
+ * system against the same parent. In the solver's terms, with the device offset put back.
+ */
+static CalibrationPrior ProfilePrior(const CalibrationContext &ctx)
+{
+	CalibrationPrior prior;
+	if (!ctx.validProfile || ctx.targetParentSystem != ctx.calibrateAgainst)
+		return prior;
+
+	auto &device = Devices.devices[ctx.targetID];
+	if (!device.present || !device.hasTrackingSystem || device.trackingSystem != ctx.targetTrackingSystem)
+		return prior;
+
+	Eigen::Quaterniond rotation = ctx.calibratedRotation;
+	Eigen::Vector3d translation = ctx.calibratedTranslation;
+	auto offset = FindDeviceOffset(ctx, ctx.targetID);
+	if (offset)
+	{
+		translation += ctx.calibratedScale * (rotation * offset->translation);
+		rotation = rotation * EulerQuat(offset->rotation);
+	}
+
+	prior.valid = true;
+	prior.rotation = rotation.toRotationMatrix();
+	prior.translation = translation;
+	return prior;
+}
+
+// The solver works on the target device's raw poses, so its result includes that device's
+// offset: S = Sys * Off, with Sys scaling the offset's translation too. Takes the offset back
+// out, leaving the transform for the whole system.
+static void RemoveDeviceOffset(const CalibrationContext &ctx, uint32_t targetID, CalibrationSolution &solution)
+{
+	auto offset = FindDeviceOffset(ctx, targetID);
+	if (!offset)
+		return;
+
+	Eigen::Quaterniond system = EulerQuat(solution.rotation) * EulerQuat(offset->rotation).inverse();
+	solution.translation -= solution.scale * (system * offset->translation);
+	solution.rotation = EulerFromQuat(system);
+}
+
+// Data collected during the current calibration run.
+struct CalibrationSession
+{
+	SampleBuffer samples;
+	RotationAccumulator rotation;
+
+	std::future<CalibrationSolution> solve;
+	std::atomic<int> solveStage;
+
+	// Buffers of the solve, the probe and the extra solves, by extraSolves index. They only
+	// grow, so later sessions solve in the storage the first one allocated. Like solve, they
+	// outlive Reset.
+	SolveWorkspace solveWorkspace, probeWorkspace;
+	std::vector<SolveWorkspace> extraWorkspaces;
+
+	// Second moment of the raw target positions, for the predicted sensitivity.
+	Eigen::Matrix3d targetMoment;
+
+	// Axes of the accumulated pairs. pairs is scratch for judging a new sample.
+	AxisHistogram axes;
+	std::vector<DSample> pairs;
+	size_t redundant;
+
+	// Interim solve while collecting, see CheckConvergence.
+	std::future<CalibrationSolution> probe;
+	std::atomic<int> probeStage;
+	size_t samplesAtProbe;
+
+	// In continuous calibration samples is a sliding window, this counts entries added since the last solve.
+	size_t samplesSinceSolve;
+	double timeLastSolve;
+
+	// Continuous calibration handed to the driver, see driverContinuous.
+	bool inDriver, driverStopped;
+	double timeLastStatus;
+
+	// Last recorded sample, new ones must move far enough away from it.
+	Sample lastAccepted;
+
+	// Driver-captured pose histories. Samples are taken on a fixed grid of target timestamps,
+	// with the reference interpolated to the same moment shifted by the estimated latency.
+	std::vector<protocol::PoseCaptureSample> captured;
+	PoseHistory referenceHistory, targetHistory;
+	double nextSampleTime;
+	double latency, timeLastLatencyEstimate;
+
+	// The latency the session had when Reset last ended it, for the profile. Outlives Reset.
+	double solvedLatency = 0;
+
+	// Devices of further target systems collected from the same captured poses, see
+	// extraTargetIDs. Each is paired with the reference on its own sample grid and latency.
+	struct ExtraTarget
+	{
+		uint32_t id;
+		PoseHistory history;
+		double nextSampleTime, latency, timeLastLatencyEstimate;
+		SampleBuffer samples;
+		RotationAccumulator rotation;
+		Sample lastAccepted;
+	};
+	std::vector<ExtraTarget> extras;
+
+	// Further devices of the reference's system on the same rig, see extraReferenceIDs. Sums
+	// of their pose relative to the reference device, as quaternion coefficients with their
+	// signs aligned and as translations in the reference device's frame. Squared too, for the
+	// spread that tells whether they really are rigid.
+	struct ExtraReference
+	{
+		uint32_t id;
+		PoseHistory history;
+		Eigen::Vector4d rotationSum;
+		Eigen::Vector3d translationSum;
+		double translationSquares;
+		size_t offsetSamples;
+		bool rigid;
+	};
+	std::vector<ExtraReference> extraReferences;
+
+	// Solves of the extra targets, started with the main one. Like solve, outlives Reset.
+	struct ExtraSolve
+	{
+		uint32_t id;
+		std::future<CalibrationSolution> solve;
+	};
+	std::vector<ExtraSolve> extraSolves;
+
+	// The main target's samples solved other ways, see compareSolvers, and their buffers by
+	// index. Like extraSolves, they outlive Reset.
+	struct ComparisonSolve
+	{
+		const char *name;
+		std::future<CalibrationSolution> solve;
+	};
+	std::vector<ComparisonSolve> comparisons;
+	std::vector<SolveWorkspace> comparisonWorkspaces;
+
+	// The system the reference device tracks in, see calibrateAgainst. Also outlives Reset.
+	StringID parentSystem = NoString;
+
+	// The current profile of the main target, see ProfilePrior. Set with parentSystem.
+	CalibrationPrior prior;
+
+	void Reset()
+	{
+		samples.Clear();
+		rotation.Reset();
+		lastAccepted = Sample();
+		samplesSinceSolve = 0;
+		timeLastSolve = 0;
+		inDriver = false;
+		driverStopped = false;
+		timeLastStatus = 0;
+		samplesAtProbe = 0;
+		targetMoment.setZero();
+		axes.Reset();
+		pairs.clear();
+		pairs.reserve(MaxPairsPerSample + 1);
+		redundant = 0;
+		// Waits for a probe still in flight, its result belongs to the old session.
+		if (probe.valid())
+			probe.wait();
+		probe = std::future<CalibrationSolution>();
+		referenceHistory.Clear();
+		targetHistory.Clear();
+		NetworkPoses.Flush(); // Received while nothing drained them.
+		nextSampleTime = 0;
+		solvedLatency = latency;
+		latency = 0;
+		timeLastLatencyEstimate = 0;
+		extras.clear();
+		extraReferences.clear();
+	}
+};
+
+static CalibrationSession Session;
+
+// Captured poses arrive at tracking rate. Samples are spaced out so a session still
+// covers enough motion.
+static const double CaptureSampleInterval = 0.02;
+
+// Poses beyond this rate only add interpolation points between two that are already close,
+// so faster devices are decimated by the driver before they're captured.
+static const double MaxCaptureRate = 250.0;
+static const double LatencyEstimateInterval = 1.0;
+
+// Pairing only compares angular speeds averaged over DevicePairing::BinSeconds.
+static const double PairingCaptureRate = 50.0;
+
+// Continuous calibration re-solves over the most recent window of samples and nudges the
+// profile towards the result once it drifts past these thresholds.
+static const double ContinuousSolveInterval = 5.0;
+static const double ContinuousRotationThreshold = 0.5; // degrees
+static const double ContinuousTranslationThreshold = 0.5; // cm
+static const double ContinuousCorrectionRate = 0.5;
+static const double ContinuousStatusInterval = 1.0;
+
+/**
+ * Collection re-solves in the background every ProbeInterval samples and stops as soon as an
+ * interim solve is both accepted and certain enough. Brisk, varied motion converges after a
+ * fraction of SampleCount, while slow motion can keep collecting up to MaxSampleCount. The
+ * uncertainty grows with tracking noise and shrinks with well spread motion, so an adaptive
+ * session, which only stops early, collects just what its motion and noise need.
+ */
+static const size_t MinProbeSamples = 50;
+static const size_t ProbeInterval = 25;
+static const double ConvergedRotation = 0.1; // degrees
+static const double ConvergedTranslation = 0.1; // cm
+
+static const size_t MaxAdaptiveSampleCount = CalibrationContext::MaxCustomSampleCount * 2;
+
+static size_t MaxSampleCount(const CalibrationContext &ctx)
+{
+	if (ctx.calibrationSpeed == CalibrationContext::ADAPTIVE)
+		return MaxAdaptiveSampleCount;
+	return ctx.SampleCount() * 2;
+}
+
+// Sized like SampleBuffer, so no later session of a preset grows it. No solve may be using it.
+static void FillWorkspace(SolveWorkspace &workspace, const SampleBuffer &samples)
+{
+	workspace.Reserve(std::max(samples.Capacity(), MaxSessionSamples));
+	samples.CopyTo(workspace.samples);
+}
+
+static RotationModel SolveRotationModel(const CalibrationContext &ctx)
+{
+	return ctx.gravityAligned ? RotationModel::GravityAligned : RotationModel::Full;
+}
+
+static RobustLoss SolveRobustLoss(const CalibrationContext &ctx)
+{
+	return ctx.robustLoss == 1 ? RobustLoss::Huber : ctx.robustLoss == 2 ? RobustLoss::Tukey : RobustLoss::None;
+}
+
+// Solves a copy of samples on the task pool.
+static std::future<CalibrationSolution> StartSolveThread(SolveWorkspace &workspace, const SampleBuffer &samples,
+	const RotationAccumulator &rotation, bool estimateScale, RotationModel model, const CalibrationPrior &prior, std::atomic<int> *stage)
+{
+	FillWorkspace(workspace, samples);
+	return Tasks().Submit([&workspace, rotation, estimateScale, stage, model, prior]() {
+		return SolveCalibration(workspace, rotation, estimateScale, stage, model, prior);
+	});
+}
+
+// As the context's options ask.
+static std::future<CalibrationSolution> StartSolveThread(SolveWorkspace &workspace, const SampleBuffer &samples,
+	const RotationAccumulator &rotation, const CalibrationContext &ctx, const CalibrationPrior &prior, std::atomic<int> *stage)
+{
+	workspace.robustLoss = SolveRobustLoss(ctx);
+	return StartSolveThread(workspace, samples, rotation, ctx.estimateScale, SolveRotationModel(ctx), prior, stage);
+}
+
+/**
+ * A one-shot session's accepted samples also go to session.samples in the profile directory,
+ * flushed by the recorder's writer thread as they come. Whatever cuts the session off before
+ * its solve, closing the client, losing the driver or tracking, leaves the file behind, and
+ * ResumeCalibration replays it through AddSample. That rebuilds the session's rotation sums,
+ * axis histogram and sample buffer exactly as they were, so they aren't stored themselves.
+ */
+static size_t checkpointedSamples = 0; // Recorded into the open checkpoint.
+static bool resumeRequested = false;
+
+static std::string CheckpointPath()
+{
+	auto directory = ProfileDirectory();
+	return directory.empty() ? directory : directory + "\\session.samples";
+}
+
+// The session reached its solve, or was replaced, and won't be resumed.
+static void DiscardCheckpoint(CalibrationContext &ctx)
+{
+	Checkpoint.Stop(true);
+	ctx.checkpointSamples = 0;
+}
+
+// Every extra target gets a solve of its own, next to the main solve.
+static void StartExtraSolves(CalibrationContext &ctx)
+{
+	// Solves of the last session may still be running in the workspaces.
+	for (auto &extra : Session.extraSolves)
+	{
+		if (extra.solve.valid())
+			extra.solve.wait();
+	}
+	Session.extraSolves.clear();
+	if (Session.extraWorkspaces.size() < Session.extras.size())
+		Session.extraWorkspaces.resize(Session.extras.size());
+
+	for (auto &extra : Session.extras)
+	{
+		if (extra.samples.size() < MinProbeSamples)
+		{
+			char buf[256];
+			snprintf(buf, sizeof buf, "Too few samples for target device %d (%zd), not calibrated\n", extra.id, extra.samples.size());
+			CalCtx.Log(buf);
+			continue;
+		}
+
+		auto &workspace = Session.extraWorkspaces[Session.extraSolves.size()];
+		Session.extraSolves.push_back({ extra.id, StartSolveThread(workspace, extra.samples, extra.rotation, ctx, CalibrationPrior(), nullptr) });
+	}
+}
+
+/**
+ * With compareSolvers, the main target's samples are also solved the other ways the settings
+ * could ask for, each on a thread of its own next to the main solve, so the comparison takes
+ * about as long as the solve alone. Only the main solve calibrates, the others are logged
+ * beside it, see LogSolverComparison. A recording has no prior, so -batch only solves the
+ * variants marked offline; the rest would repeat one of them.
+ */
+struct SolverVariant
+{
+	const char *name;
+	RotationModel model;
+	bool estimateScale, prior, offline;
+};
+
+static const SolverVariant SolverVariants[] = {
+	{ "6-DOF", RotationModel::Full, false, true, true },
+	{ "Level (yaw only)", RotationModel::GravityAligned, false, true, true },
+	{ "6-DOF with scale", RotationModel::Full, true, true, true },
+	{ "6-DOF without prior", RotationModel::Full, false, false, false },
+};
+
+static void StartComparisonSolves(CalibrationContext &ctx)
+{
+	for (auto &comparison : Session.comparisons)
+	{
+		if (comparison.solve.valid())
+			comparison.solve.wait();
+	}
+	Session.comparisons.clear();
+	if (!ctx.compareSolvers)
+		return;
+
+	size_t count = sizeof SolverVariants / sizeof SolverVariants[0];
+	if (Session.comparisonWorkspaces.size() < count)
+		Session.comparisonWorkspaces.resize(count);
+
+	for (auto &variant : SolverVariants)
+	{
+		bool usesPrior = variant.prior && Session.prior.valid;
+		bool same = variant.model == SolveRotationModel(ctx) && variant.estimateScale == ctx.estimateScale && usesPrior == Session.prior.valid;
+		if (same || (!variant.prior && !Session.prior.valid))
+			continue;
+
+		auto &workspace = Session.comparisonWorkspaces[Session.comparisons.size()];
+		workspace.robustLoss = SolveRobustLoss(ctx);
+		auto prior = usesPrior ? Session.prior : CalibrationPrior();
+		Session.comparisons.push_back({ variant.name,
+			StartSolveThread(workspace, Session.samples, Session.rotation, variant.estimateScale, variant.model, prior, nullptr) });
+	}
+}
+
+static void LogSolution(const char *name, const CalibrationSolution &solution)
+{
+	char buf[256];
+	snprintf(buf, sizeof buf, "  %-22s %6.2f mm RMS, sensitivity %.2f %.2f %.2f cm, uncertainty %.3f deg %.3f cm%s\n",
+		name, solution.positionError * 1000.0, solution.sensitivity(0) * 100.0, solution.sensitivity(1) * 100.0,
+		solution.sensitivity(2) * 100.0, solution.uncertainty.rotation, solution.uncertainty.translation,
+		solution.reject ? ", rejected" : "");
+	CalCtx.Log(buf);
+}
+
+// Points out a variant that fits clearly better, so the settings can be changed for the next calibration.
+static const double ComparisonBetterShare = 0.8;
+
+static void LogSolverComparison(const CalibrationSolution &solution)
+{
+	if (Session.comparisons.empty())
+		return;
+
+	CalCtx.Log("\nSolver comparison on the same samples:\n");
+	LogSolution("Settings (used)", solution);
+
+	const char *better = nullptr;
+	double bestError = solution.reject ? std::numeric_limits<double>::infinity() : solution.positionError * ComparisonBetterShare;
+	for (auto &comparison : Session.comparisons)
+	{
+		auto other = comparison.solve.get();
+		LogSolution(comparison.name, other);
+		if (!other.reject && other.positionError < bestError)
+		{
+			bestError = other.positionError;
+			better = comparison.name;
+		}
+	}
+	Session.comparisons.clear();
+
+	if (better)
+	{
+		char buf[256];
+		snprintf(buf, sizeof buf, "%s fits these samples best, consider the matching settings for the next calibration\n", better);
+		CalCtx.Log(buf);
+	}
+	CalCtx.Log("\n");
+}
+
+static void StartSolve(CalibrationContext &ctx)
+{
+	CalCtx.Log("\n");
+	Capture.SetDevices(0);
+	DiscardCheckpoint(ctx);
+
+	Session.solveStage = 0;
+	Session.solveWorkspace.keepResiduals = true; // For the diagnostics report, and the CSV with exportResiduals.
+	Session.solve = StartSolveThread(Session.solveWorkspace, Session.samples, Session.rotation, ctx, Session.prior, &Session.solveStage);
+	StartExtraSolves(ctx);
+	StartComparisonSolves(ctx);
+	Session.Reset();
+	ctx.state = CalibrationState::Solving;
+}
+
+// Stores each accepted extra solve as the calibration of its device's system.
+static void FinishExtraTargets(CalibrationContext &ctx)
+{
+	bool changed = false;
+	for (auto &extra : Session.extraSolves)
+	{
+		auto solution = extra.solve.get();
+		auto system = Devices.devices[extra.id].trackingSystem;
+
+		char buf[256];
+		if (solution.reject)
+		{
+			snprintf(buf, sizeof buf, "Rejecting low quality calibration of %s (device %d)\n", InternedString(system).c_str(), extra.id);
+			CalCtx.Log(buf);
+			continue;
+		}
+
+		RemoveDeviceOffset(ctx, extra.id, solution);
+
+		auto &others = ctx.otherTargets;
+		auto existing = std::find_if(others.begin(), others.end(), [system](const TargetProfile &target) {
+			return target.trackingSystem == system;
+		});
+		if (existing == others.end())
+		{
+			others.push_back(TargetProfile());
+			existing = others.end() - 1;
+			existing->trackingSystem = system;
+		}
+		existing->parentSystem = Session.parentSystem;
+		existing->rotation = EulerQuat(solution.rotation);
+		existing->translation = solution.translation;
+		if (ctx.estimateScale)
+			existing->scale = solution.scale;
+
+		ApplyProfile(ctx, Devices.TrackingSystemMask(system));
+		snprintf(buf, sizeof buf, "Calibrated %s (device %d), position error %.3f\n", InternedString(system).c_str(), extra.id, solution.positionError);
+		CalCtx.Log(buf);
+		changed = true;
+	}
+	Session.extraSolves.clear();
+
+	if (changed)
+		SaveProfile(ctx);
+}
+
+static void ReprojectChaperone(ChaperoneProfile &chaperone, const TransformGraph::Transform &from, const TransformGraph::Transform &to);
+
+static void FinishCalibration(CalibrationContext &ctx, CalibrationSolution &solution)
+{
+	CalCtx.Log(solution.log);
+
+	if (solution.reject)
+	{
+		CalCtx.Log("\n\n!!! Rejecting low quality calibration !!!\n");
+		ctx.state = CalibrationState::None;
+		return;
+	}
+
+	// What the target's devices were moved by until now, the graph is still from the last pass.
+	TransformGraph::Transform previous, current;
+	bool reproject = ctx.chaperone.valid && ctx.chaperone.followCalibration &&
+		Graph.Root() == ctx.referenceTrackingSystem && Graph.Resolve(ctx.targetTrackingSystem, previous);
+
+	RemoveDeviceOffset(ctx, ctx.targetID, solution);
+	ctx.calibratedRotation = EulerQuat(solution.rotation);
+	ctx.calibratedTranslation = solution.translation;
+	if (ctx.estimateScale)
+		ctx.calibratedScale = solution.scale;
+	ctx.targetParentSystem = Session.parentSystem;
+	ctx.targetLatency = Session.solvedLatency;
+	ctx.validProfile = true;
+	ctx.positionError = solution.positionError;
+
+	// Goes through the profile so the target's own offset is applied on top again.
+	ApplyProfile(ctx, DeviceBit(ctx.targetID));
+
+	if (reproject && Graph.Resolve(ctx.targetTrackingSystem, current))
+	{
+		ReprojectChaperone(ctx.chaperone, previous, current);
+		ApplyChaperoneBounds();
+		CalCtx.Log("Moved the chaperone bounds with the calibration\n");
+	}
+
+	SaveProfile(ctx);
+	CalCtx.Log("Finished calibration, profile saved\n");
+
+	ctx.state = CalibrationState::None;
+}
+
+// Sizes in pixels and colors of the 3D view's points, see SampleViewData.
+static const float ViewSampleSize = 5.0f, ViewAxisSize = 7.0f;
+static const double ViewGoodResidual = 1.0, ViewBadResidual = 10.0; // mm, green to red.
+
+static uint32_t ViewColor(double r, double g, double b, double a = 1.0)
+{
+	auto byte = [](double v) { return (uint32_t) (std::max(0.0, std::min(v, 1.0)) * 255.0 + 0.5); };
+	return byte(r) | byte(g) << 8 | byte(b) << 16 | byte(a) << 24;
+}
+
+static SampleViewPoint ViewPoint(const Eigen::Vector3d &position, float size, uint32_t color)
+{
+	return { { (float) position(0), (float) position(1), (float) position(2) }, size, color };
+}
+
+static void ClearSampleView(CalibrationContext &ctx)
+{
+	ctx.sampleView.points.clear();
+	ctx.sampleView.axes.clear();
+	ctx.sampleView.residuals = false;
+	ctx.sampleView.generation++;
+}
+
+// Each histogram cell at its centre, covered cells bright.
+static void UpdateAxisView(CalibrationContext &ctx)
+{
+	const int side = AxisHistogram::BinsPerSide;
+	auto &axes = ctx.sampleView.axes;
+	axes.clear();
+	for (int bin = 0; bin < AxisHistogram::BinCount; bin++)
+	{
+		int face = bin / (side * side);
+		Eigen::Vector3d axis;
+		axis(face) = 1.0;
+		axis((face + 1) % 3) = (bin / side % side + 0.5) * 2.0 / side - 1.0;
+		axis((face + 2) % 3) = (bin % side + 0.5) * 2.0 / side - 1.0;
+		axis.normalize();
+
+		double weight = Session.axes.weights[bin] / AxisHistogram::CoveredWeight;
+		uint32_t color = weight >= 1.0 ? ViewColor(0.5, 0.8, 0.5) : ViewColor(0.5, 0.5, 0.5, 0.3 + 0.5 * weight);
+		axes.push_back(ViewPoint(axis, ViewAxisSize, color));
+		axes.push_back(ViewPoint(-axis, ViewAxisSize, color));
+	}
+	ctx.sampleView.generation++;
+}
+
+static void AddSampleToView(CalibrationContext &ctx, const Sample &sample)
+{
+	if (ctx.sampleView.residuals)
+		ClearSampleView(ctx);
+	ctx.sampleView.points.push_back(ViewPoint(sample.ref.trans, ViewSampleSize, ViewColor(0.45, 0.65, 1.0)));
+	UpdateAxisView(ctx);
+}
+
+static void ShowResidualsInView(CalibrationContext &ctx, const std::vector<SampleResidual> &residuals)
+{
+	auto &points = ctx.sampleView.points;
+	points.clear();
+	for (auto &residual : residuals)
+	{
+		double t = (residual.error.norm() * 1000.0 - ViewGoodResidual) / (ViewBadResidual - ViewGoodResidual);
+		t = std::max(0.0, std::min(t, 1.0));
+		points.push_back(ViewPoint(residual.position, ViewSampleSize, ViewColor(0.3 + 0.6 * std::min(2.0 * t, 1.0), 0.8 - 0.6 * std::max(2.0 * t - 1.0, 0.0), 0.3)));
+	}
+	ctx.sampleView.residuals = true;
+	ctx.sampleView.generation++;
+}
+
+/**
+ * Constant work per sample: Horn's closed form rotation from the running sums, plus the sensitivity
+ * ComputeSensitivity would report for the current estimate. With translation and offset held
+ * fixed, a perturbation Q adds E|(Q - I) rot * target|^2 to the squared error, which the second
+ * moment of the target positions gives directly.
+ */
+static void UpdateCollectionMetrics(CalibrationContext &ctx)
+{
+	auto &metrics = ctx.collection;
+	size_t n = Session.samples.size();
+	if (n < 2 || Session.rotation.count < 3)
+		return;
+
+	Eigen::Matrix3d rot = SolveRotationQuaternion(Session.rotation).toRotationMatrix();
+	metrics.valid = true;
+	metrics.axisCoverage = Session.rotation.AxisCoverage();
+	metrics.axisDirections = Session.axes.Covered();
+	metrics.axisDirectionCount = AxisHistogram::BinCount;
+	metrics.redundantSamples = Session.redundant;
+	metrics.axisError = Session.rotation.AxisErrorRMS(rot) * 180.0 / EIGEN_PI;
+
+	Eigen::Matrix3d moment = rot * (Session.targetMoment / (double) n) * rot.transpose();
+	double baseError = std::max(metrics.positionError, 0.0);
+	for (int axis = 0; axis < 3; axis++)
+	{
+		Eigen::Vector3d perturbation = Eigen::Vector3d::Zero();
+		perturbation(axis) = 10;
+		Eigen::Matrix3d delta = EulerQuat(perturbation).toRotationMatrix() - Eigen::Matrix3d::Identity();
+		double added = (delta.transpose() * delta * moment).trace();
+		metrics.sensitivity(axis) = sqrt(baseError * baseError + std::max(added, 0.0)) - baseError;
+	}
+}
+
+static void CheckConvergence(CalibrationContext &ctx)
+{
+	if (ctx.state != CalibrationState::Rotation || !Session.probe.valid() ||
+		Session.probe.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+		return;
+
+	auto solution = Session.probe.get();
+	ctx.collection.positionError = solution.positionError;
+	if (solution.reject || solution.uncertainty.rotation > ConvergedRotation || solution.uncertainty.translation > ConvergedTranslation)
+		return;
+
+	char buf[256];
+	snprintf(buf, sizeof buf, "\nConverged after %zd samples\n", Session.samplesAtProbe);
+	CalCtx.Log(buf);
+
+	Capture.SetDevices(0);
+	if (!Session.extras.empty())
+	{
+		// The extra targets still need solving, the converged result waits for them.
+		std::promise<CalibrationSolution> converged;
+		converged.set_value(solution);
+		Session.solveStage = SolveStageCount;
+		Session.solve = converged.get_future();
+		StartExtraSolves(ctx);
+		Session.Reset();
+		ctx.state = CalibrationState::Solving;
+		return;
+	}
+
+	Session.Reset();
+	FinishCalibration(ctx, solution);
+}
+
+// Once the session has this many samples, ones whose rotation pairs all land in directions
+// holding over RedundantShare times their even share are skipped. They would mostly add
+// weight where there is plenty already, and make the solve slower without conditioning it.
+// At most as many are skipped as kept, so a user who can't reach new directions still finishes.
+static const size_t MinSamplesBeforeSkipping = 50;
+static const double RedundantShare = 2.0;
+
+static void AddSample(CalibrationContext &ctx, const Sample &sample, const SampleRecord &record)
+{
+	if (sample.quality < MinSampleQuality || !MovedEnough(Session.lastAccepted, sample))
+		return;
+
+	auto &samples = Session.samples;
+	if (ctx.state == CalibrationState::Continuous)
+	{
+		Session.lastAccepted = sample;
+		Recorder.Record(record);
+		samples.Push(sample);
+		Session.samplesSinceSolve++;
+		return;
+	}
+
+	auto &pairs = Session.pairs;
+	pairs.clear();
+	ForEachRotationPair(samples.Rotations(), CompactRotations::FromSample(sample), samples.size(), [&](const DSample &delta) { pairs.push_back(delta); });
+
+	if (samples.size() >= MinSamplesBeforeSkipping && Session.redundant < samples.size() && !pairs.empty())
+	{
+		bool redundant = std::all_of(pairs.begin(), pairs.end(), [](const DSample &delta) {
+			return Session.axes.Crowded(delta.target, RedundantShare);
+		});
+		if (redundant)
+		{
+			Session.redundant++;
+			return;
+		}
+	}
+
+	Session.lastAccepted = sample;
+	Recorder.Record(record);
+	Checkpoint.Record(record);
+	checkpointedSamples++;
+
+	// Same pairs AccumulateRotationPairs would add.
+	samples.Push(sample);
+	for (auto &delta : pairs)
+	{
+		Session.rotation.Add(delta);
+		Session.axes.Add(delta);
+	}
+	Session.targetMoment.noalias() += sample.target.trans * sample.target.trans.transpose();
+	UpdateCollectionMetrics(ctx);
+	AddSampleToView(ctx, sample);
+
+	CalCtx.Progress(samples.size(), MaxSampleCount(ctx));
+
+	if (samples.size() == MaxSampleCount(ctx))
+	{
+		StartSolve(ctx);
+		return;
+	}
+
+	if (samples.size() >= MinProbeSamples && samples.size() - Session.samplesAtProbe >= ProbeInterval && !Session.probe.valid())
+	{
+		Session.samplesAtProbe = samples.size();
+		Session.probeStage = 0;
+		Session.probe = StartSolveThread(Session.probeWorkspace, samples, Session.rotation, ctx, Session.prior, &Session.probeStage);
+	}
+}
+
+// Extra targets skip the metrics and the redundancy check, the main target drives the session.
+static void AddExtraSample(CalibrationSession::ExtraTarget &extra, const Sample &sample)
+{
+	auto &samples = extra.samples;
+	if (samples.size() == samples.Capacity() || sample.quality < MinSampleQuality || !MovedEnough(extra.lastAccepted, sample))
+		return;
+
+	extra.lastAccepted = sample;
+	ForEachRotationPair(samples.Rotations(), CompactRotations::FromSample(sample), samples.size(), [&](const DSample &delta) { extra.rotation.Add(delta); });
+	samples.Push(sample);
+}
+
+static const std::string &DeviceSerial(uint32_t id)
+{
+	if (id >= vr::k_unMaxTrackedDeviceCount)
+		return InternedString(NoString);
+	return InternedString(Devices.devices[id].serial);
+}
+
+bool SetMotionRig(uint32_t rigID)
+{
+	auto &ctx = CalCtx;
+	if (rigID < vr::k_unMaxTrackedDeviceCount)
+	{
+		auto &pose = ctx.devicePoses[rigID];
+		if (!pose.bPoseIsValid || pose.eTrackingResult != vr::TrackingResult_Running_OK)
+		{
+			ctx.Log("The motion platform tracker is not tracking, it needs a neutral pose\n");
+			return false;
+		}
+
+		Pose neutral = PoseFromMatrix(pose.mDeviceToAbsoluteTracking);
+		Eigen::Quaterniond rotation(neutral.rot);
+		ctx.motionNeutralTranslation = { neutral.trans(0), neutral.trans(1), neutral.trans(2) };
+		ctx.motionNeutralRotation = { rotation.w(), rotation.x(), rotation.y(), rotation.z() };
+
+		char buf[256];
+		snprintf(buf, sizeof buf, "Taking the motion of device %d, serial %s, out of the HMD's tracking system\n", rigID, DeviceSerial(rigID).c_str());
+		ctx.Log(buf);
+	}
+	else if (ctx.motionRigID < vr::k_unMaxTrackedDeviceCount)
+	{
+		ctx.Log("Motion compensation stopped\n");
+	}
+
+	ctx.motionRigID = rigID;
+	ApplyProfile(ctx, AllDevicesMask);
+	return true;
+}
+
+bool SetDeviceLink(uint32_t linkedID, uint32_t sourceID, DeviceLinkMode mode)
+{
+	auto &ctx = CalCtx;
+	if (linkedID < vr::k_unMaxTrackedDeviceCount)
+	{
+		if (sourceID >= vr::k_unMaxTrackedDeviceCount || sourceID == linkedID)
+			return false;
+		if (!PoseTracking(ctx.devicePoses[linkedID]) || !PoseTracking(ctx.devicePoses[sourceID]))
+		{
+			ctx.Log("Both linked devices need to be tracking, their offset is taken from how they are placed now\n");
+			return false;
+		}
+
+		// The device's pose in the source's frame, Rs^-1 (pd - ps) and Rs^-1 Rd.
+		Pose linked = PoseFromMatrix(ctx.devicePoses[linkedID].mDeviceToAbsoluteTracking);
+		Pose source = PoseFromMatrix(ctx.devicePoses[sourceID].mDeviceToAbsoluteTracking);
+		Eigen::Vector3d translation = source.rot.transpose() * (linked.trans - source.trans);
+		Eigen::Quaterniond rotation(source.rot.transpose() * linked.rot);
+		ctx.linkOffsetTranslation = { translation(0), translation(1), translation(2) };
+		ctx.linkOffsetRotation = { rotation.w(), rotation.x(), rotation.y(), rotation.z() };
+
+		char buf[256];
+		snprintf(buf, sizeof buf, "%s device %d, serial %s, with device %d, serial %s\n",
+			mode == DeviceLinkMode::Fuse ? "Fusing" : "Standing in for", linkedID, DeviceSerial(linkedID).c_str(), sourceID, DeviceSerial(sourceID).c_str());
+		ctx.Log(buf);
+	}
+	else if (ctx.linkedID < vr::k_unMaxTrackedDeviceCount)
+	{
+		ctx.Log("Device link stopped\n");
+	}
+
+	ctx.linkedID = linkedID;
+	ctx.linkMode = mode;
+	ctx.linkSourceID = linkedID < vr::k_unMaxTrackedDeviceCount ? sourceID : vr::k_unTrackedDeviceIndexInvalid;
+	ApplyProfile(ctx, AllDevicesMask);
+	return true;
+}
+
+/**
+ * Takes the extra targets that can join this session: present, tracking, in a system of
+ * their own other than the reference's, the one calibrated against and the selected target's.
+ * Only captured poses are paired for them, the polled fallback calibrates the selected target
+ * alone.
+ */
+static void StartExtraTargets(CalibrationContext &ctx)
+{
+	if (ctx.extraTargetIDs.empty())
+		return;
+
+	if (!Capture.IsOpen())
+	{
+		CalCtx.Log("Additional targets need the driver's pose capture, calibrating the selected target only\n");
+		return;
+	}
+
+	std::vector<StringID> systems = { ctx.referenceTrackingSystem, ctx.SessionReferenceSystem(), ctx.targetTrackingSystem };
+	for (uint32_t id : ctx.extraTargetIDs)
+	{
+		if (id >= vr::k_unMaxTrackedDeviceCount)
+			continue;
+
+		auto &device = Devices.devices[id];
+		if (!device.present || !device.hasTrackingSystem || !ctx.devicePoses[id].bPoseIsValid ||
+			std::find(systems.begin(), systems.end(), device.trackingSystem) != systems.end())
+			continue;
+		systems.push_back(device.trackingSystem);
+
+		ResetAndDisableOffsets(id);
+		Session.extras.emplace_back();
+		auto &extra = Session.extras.back();
+		extra.id = id;
+		extra.nextSampleTime = 0;
+		extra.latency = 0;
+		extra.timeLastLatencyEstimate = 0;
+		extra.samples.Reset(MaxSampleCount(ctx));
+
+		char buf[256];
+		snprintf(buf, sizeof buf, "Additional target device ID: %d, serial %s\n", id, DeviceSerial(id).c_str());
+		CalCtx.Log(buf);
+	}
+}
+
+// The relative pose of an extra reference is learned from this many samples before its poses
+// count, and it's dropped once its spread shows it moving against the reference device.
+static const size_t MinReferenceOffsetSamples = 20;
+static const double MaxReferenceTranslationSpread = 0.005; // meters
+static const double MaxReferenceRotationSpread = 1.0; // degrees
+
+/**
+ * Takes the extra references that can join this session: present, tracking, in the system of
+ * the reference device and neither it nor the target. Like extra targets they need captured
+ * poses.
+ */
+static void StartExtraReferences(CalibrationContext &ctx)
+{
+	if (ctx.extraReferenceIDs.empty())
+		return;
+
+	if (!Capture.IsOpen())
+	{
+		CalCtx.Log("Additional reference devices need the driver's pose capture, using the selected reference only\n");
+		return;
+	}
+
+	for (uint32_t id : ctx.extraReferenceIDs)
+	{
+		if (id >= vr::k_unMaxTrackedDeviceCount || id == ctx.referenceID || id == ctx.targetID)
+			continue;
+
+		auto &device = Devices.devices[id];
+		if (!device.present || !device.hasTrackingSystem || !ctx.devicePoses[id].bPoseIsValid ||
+			device.trackingSystem != ctx.SessionReferenceSystem())
+			continue;
+
+		auto &extras = Session.extraReferences;
+		if (std::any_of(extras.begin(), extras.end(), [id](const CalibrationSession::ExtraReference &extra) { return extra.id == id; }))
+			continue;
+
+		extras.emplace_back();
+		auto &extra = extras.back();
+		extra.id = id;
+		extra.rotationSum.setZero();
+		extra.translationSum.setZero();
+		extra.translationSquares = 0;
+		extra.offsetSamples = 0;
+		extra.rigid = true;
+
+		char buf[256];
+		snprintf(buf, sizeof buf, "Additional reference device ID: %d, serial %s\n", id, DeviceSerial(id).c_str());
+		CalCtx.Log(buf);
+	}
+}
+
+/**
+ * Averages the reference pose at time with the extra references' poses there, each moved onto
+ * the reference device by its learned relative pose. Their tracking noise is independent, so
+ * every sample's reference gets less of it. learn adds this moment to the relative poses,
+ * which only the main target's grid does, so each moment counts once.
+ */
+static void AverageExtraReferences(Pose &reference, double time, bool learn)
+{
+	if (Session.extraReferences.empty())
+		return;
+
+	Eigen::Quaterniond primary(reference.rot);
+	Eigen::Vector4d rotationSum = primary.coeffs();
+	Eigen::Vector3d positionSum = reference.trans;
+	int count = 1;
+
+	for (auto &extra : Session.extraReferences)
+	{
+		protocol::PoseCaptureSample captured;
+		if (!extra.rigid || !extra.history.Interpolate(time, captured) || CapturedPoseQuality(captured) < MinSampleQuality)
+			continue;
+		Pose pose = PoseFromCapture(captured);
+
+		if (learn)
+		{
+			Eigen::Quaterniond relative(reference.rot.transpose() * pose.rot);
+			if (relative.coeffs().dot(extra.rotationSum) < 0.0)
+				relative.coeffs() *= -1.0;
+			Eigen::Vector3d translation = reference.rot.transpose() * (pose.trans - reference.trans);
+			extra.rotationSum += relative.coeffs();
+			extra.translationSum += translation;
+			extra.translationSquares += translation.squaredNorm();
+			extra.offsetSamples++;
+		}
+
+		if (extra.offsetSamples < MinReferenceOffsetSamples)
+			continue;
+
+		// For small spreads, the mean of unit quaternions shrinks by a quarter of the mean squared angle.
+		double n = (double) extra.offsetSamples;
+		Eigen::Vector3d meanTranslation = extra.translationSum / n;
+		double translationSpread = sqrt(std::max(extra.translationSquares / n - meanTranslation.squaredNorm(), 0.0));
+		double rotationSpread = 2.0 * sqrt(std::max(1.0 - (extra.rotationSum / n).squaredNorm(), 0.0)) * 180.0 / EIGEN_PI;
+		if (translationSpread > MaxReferenceTranslationSpread || rotationSpread > MaxReferenceRotationSpread)
+		{
+			extra.rigid = false;
+			char buf[256];
+			snprintf(buf, sizeof buf, "Reference device %d moves against the reference by %.1f mm and %.2f deg, not averaging it\n",
+				extra.id, translationSpread * 1000.0, rotationSpread);
+			CalCtx.Log(buf);
+			continue;
+		}
+
+		Eigen::Quaterniond offset;
+		offset.coeffs() = extra.rotationSum.normalized();
+		Eigen::Quaterniond estimated(pose.rot * offset.toRotationMatrix().transpose());
+		if (estimated.coeffs().dot(primary.coeffs()) < 0.0)
+			estimated.coeffs() *= -1.0;
+		rotationSum += estimated.coeffs();
+		positionSum += pose.trans - estimated.toRotationMatrix() * meanTranslation;
+		count++;
+	}
+
+	if (count == 1)
+		return;
+
+	Eigen::Quaterniond averaged;
+	averaged.coeffs() = rotationSum.normalized();
+	reference.rot = averaged.toRotationMatrix();
+	reference.trans = positionSum / count;
+}
+
+// Writes pose into a captured sample, leaving its timing and tracking state.
+static void SetCapturedPose(protocol::PoseCaptureSample &sample, const Pose &pose)
+{
+	Eigen::Quaterniond rotation(pose.rot);
+	sample.rotation = { rotation.w(), rotation.x(), rotation.y(), rotation.z() };
+	for (int i = 0; i < 3; i++)
+		sample.position[i] = pose.trans(i);
+}
+
+static void CollectExtraSamples(CalibrationSession::ExtraTarget &extra)
+{
+	auto &reference = Session.referenceHistory, &target = extra.history;
+	if (reference.Empty() || target.Empty())
+		return;
+
+	if (target.LatestTime() - extra.timeLastLatencyEstimate >= LatencyEstimateInterval)
+	{
+		extra.timeLastLatencyEstimate = target.LatestTime();
+		EstimateCaptureLatency(reference, target, extra.latency);
+	}
+
+	double begin = std::max(target.OldestTime(), reference.OldestTime() - extra.latency);
+	double end = std::min(target.LatestTime(), reference.LatestTime() - extra.latency);
+	extra.nextSampleTime = std::max(extra.nextSampleTime, begin);
+
+	for (; extra.nextSampleTime <= end; extra.nextSampleTime += CaptureSampleInterval)
+	{
+		protocol::PoseCaptureSample referencePose, targetPose;
+		if (!target.Interpolate(extra.nextSampleTime, targetPose) ||
+			!reference.Interpolate(extra.nextSampleTime + extra.latency, referencePose))
+			continue;
+
+		double quality = std::min(CapturedPoseQuality(referencePose), CapturedPoseQuality(targetPose));
+		Pose reference = PoseFromCapture(referencePose);
+		AverageExtraReferences(reference, extra.nextSampleTime + extra.latency, false);
+		AddExtraSample(extra, Sample(reference, PoseFromCapture(targetPose), quality));
+	}
+}
+
+// The selected device an external system's poses stand in for, invalid while there's none.
+static uint32_t NetworkStandIn(const CalibrationContext &ctx)
+{
+	if (!NetworkPoses.IsRunning())
+		return vr::k_unTrackedDeviceIndexInvalid;
+
+	switch (ctx.networkPoseRole)
+	{
+	case NetworkPoseRole::Reference:
+		return ctx.referenceID;
+	case NetworkPoseRole::Target:
+		return ctx.targetID;
+	default:
+		return vr::k_unTrackedDeviceIndexInvalid;
+	}
+}
+
+static void CollectCapturedSamples(CalibrationContext &ctx)
+{
+	Session.captured.clear();
+	uint64_t lost = Capture.Drain(Session.captured);
+
+	// The bridge's device still comes through the pose hook, later than its poses come here.
+	uint32_t standIn = NetworkStandIn(ctx);
+	if (standIn != vr::k_unTrackedDeviceIndexInvalid)
+	{
+		auto &captured = Session.captured;
+		captured.erase(std::remove_if(captured.begin(), captured.end(),
+			[standIn](const protocol::PoseCaptureSample &sample) { return sample.openVRID == standIn; }), captured.end());
+		lost += NetworkPoses.Drain(captured, standIn);
+	}
+	bool continuous = ctx.state == CalibrationState::Continuous;
+	if (lost)
+	{
+		if (continuous)
+		{
+			Events.Write(ClientEvent::PoseCaptureOverrun, (double) lost);
+		}
+		else
+		{
+			char buf[256];
+			snprintf(buf, sizeof buf, "Pose capture overrun, %llu poses dropped\n", (unsigned long long) lost);
+			CalCtx.Log(buf);
+		}
+	}
+
+	for (auto &captured : Session.captured)
+	{
+		if (captured.openVRID == ctx.referenceID)
+			Session.referenceHistory.Push(captured);
+		else if (captured.openVRID == ctx.targetID)
+			Session.targetHistory.Push(captured);
+		else
+		{
+			// An extra device losing tracking only leaves a gap in its own poses.
+			for (auto &extra : Session.extras)
+			{
+				if (extra.id == captured.openVRID)
+					extra.history.Push(captured);
+			}
+			for (auto &extra : Session.extraReferences)
+			{
+				if (extra.id == captured.openVRID)
+					extra.history.Push(captured);
+			}
+			continue;
+		}
+
+		// Tracking loss is expected over a long continuous session, interpolation just skips the
+		// gap. Invalid poses never make it into samples, see PoseHistory::Interpolate.
+		if (continuous)
+			continue;
+
+		bool isReference = captured.openVRID == ctx.referenceID;
+		bool tracking = PoseTracking(captured);
+		if (!FollowTracking(isReference ? TrackingLostSince.reference : TrackingLostSince.target, tracking,
+			ctx.timeLastTick, isReference ? "Reference" : "Target"))
+		{
+			LogTrackingLossAbort();
+			Capture.SetDevices(0);
+			ctx.state = CalibrationState::None;
+			return;
+		}
+	}
+
+	// Before the main target, whose samples may finish the session.
+	for (auto &extra : Session.extras)
+		CollectExtraSamples(extra);
+
+	auto &reference = Session.referenceHistory, &target = Session.targetHistory;
+	if (reference.Empty() || target.Empty())
+		return;
+
+	if (target.LatestTime() - Session.timeLastLatencyEstimate >= LatencyEstimateInterval)
+	{
+		Session.timeLastLatencyEstimate = target.LatestTime();
+
+		double latency;
+		if (EstimateCaptureLatency(reference, target, latency))
+		{
+			if (std::abs(latency - Session.latency) >= 0.002)
+				Events.Write(ClientEvent::LatencyEstimated, latency * 1000.0);
+			Session.latency = latency;
+		}
+	}
+
+	double begin = std::max(target.OldestTime(), reference.OldestTime() - Session.latency);
+	double end = std::min(target.LatestTime(), reference.LatestTime() - Session.latency);
+	Session.nextSampleTime = std::max(Session.nextSampleTime, begin);
+
+	for (; Session.nextSampleTime <= end; Session.nextSampleTime += CaptureSampleInterval)
+	{
+		if (ctx.state != CalibrationState::Rotation && ctx.state != CalibrationState::Continuous)
+			return;
+
+		protocol::PoseCaptureSample referencePose, targetPose;
+		if (!target.Interpolate(Session.nextSampleTime, targetPose) ||
+			!reference.Interpolate(Session.nextSampleTime + Session.latency, referencePose))
+			continue;
+
+		// Recorded averaged, so a replay solves the same samples.
+		Pose reference = PoseFromCapture(referencePose);
+		AverageExtraReferences(reference, Session.nextSampleTime + Session.latency, true);
+		SetCapturedPose(referencePose, reference);
+
+		SampleRecord record;
+		record.reference = referencePose;
+		record.target = targetPose;
+		record.quality = std::min(CapturedPoseQuality(referencePose), CapturedPoseQuality(targetPose));
+		AddSample(ctx, Sample(reference, PoseFromCapture(targetPose), record.quality), record);
+	}
+}
+
+// Of the last continuous correction, for the metrics endpoint.
+static struct
+{
+	double rotation = 0.0, translation = 0.0; // degrees, cm
+	uint64_t corrections = 0;
+} ContinuousDrift;
+
+// The driver has already corrected the transforms, the same correction goes into the profile
+// so it's saved and new devices get it too. A correction maps x to R * x + t in world space,
+// composing it with the calibration is just as the driver does with each device's transform.
+static void MergeDriverCorrection(CalibrationContext &ctx, const protocol::ContinuousCalibrationStatus &status)
+{
+	if (ctx.state != CalibrationState::Continuous || !Session.inDriver || status.corrections == 0)
+		return;
+
+	Eigen::Quaterniond rotation(status.rotation.w, status.rotation.x, status.rotation.y, status.rotation.z);
+	Eigen::Vector3d translation(status.translation.v[0], status.translation.v[1], status.translation.v[2]);
+
+	ctx.calibratedRotation = (rotation * ctx.calibratedRotation).normalized();
+	ctx.calibratedTranslation = rotation * ctx.calibratedTranslation + translation * 100.0;
+
+	Events.Write(ClientEvent::DriverContinuousCorrections, status.corrections, status.samples);
+	ContinuousDrift.rotation = Eigen::Quaterniond::Identity().angularDistance(rotation) * 180.0 / EIGEN_PI;
+	ContinuousDrift.translation = translation.norm() * 100.0;
+	ContinuousDrift.corrections += status.corrections;
+
+	ApplyProfile(ctx, AllDevicesMask);
+	SaveProfile(ctx);
+}
+
+static void DriverContinuousCalibrationTick(CalibrationContext &ctx, double time)
+{
+	if (Session.driverStopped)
+	{
+		Events.Write(ClientEvent::DriverStoppedContinuous);
+		StopContinuousCalibration();
+		return;
+	}
+
+	if (time - Session.timeLastStatus < ContinuousStatusInterval)
+		return;
+	Session.timeLastStatus = time;
+
+	// Callbacks may run inside another request's wait, so stopping is left to the next tick.
+	Driver.SendAsync(protocol::Request(protocol::RequestContinuousCalibrationStatus), [&ctx](const protocol::Response &response) {
+		if (response.type != protocol::ResponseContinuousCalibrationStatus)
+			return;
+
+		auto status = response.continuousCalibrationStatus;
+		if (!status.running && Session.inDriver)
+			Session.driverStopped = true;
+		MergeDriverCorrection(ctx, status);
+	});
+}
+
+static void ContinuousCalibrationTick(CalibrationContext &ctx, double time)
+{
+	if (Session.inDriver)
+	{
+		DriverContinuousCalibrationTick(ctx, time);
+		return;
+	}
+
+	if (Session.solve.valid())
+	{
+		if (Session.solve.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+			return;
+
+		auto solution = Session.solve.get();
+		Events.Text(solution.log);
+		if (solution.reject)
+			return;
+
+		RemoveDeviceOffset(ctx, ctx.targetID, solution);
+		Eigen::Quaterniond current = ctx.calibratedRotation;
+		Eigen::Quaterniond solved = EulerQuat(solution.rotation);
+
+		double rotationDrift = current.angularDistance(solved) * 180.0 / EIGEN_PI;
+		double translationDrift = (solution.translation - ctx.calibratedTranslation).norm();
+		if (rotationDrift < ContinuousRotationThreshold && translationDrift < ContinuousTranslationThreshold)
+			return;
+
+		Events.Write(ClientEvent::ContinuousDrift, rotationDrift, translationDrift);
+		ContinuousDrift.rotation = rotationDrift;
+		ContinuousDrift.translation = translationDrift;
+		ContinuousDrift.corrections++;
+
+		// Move part of the way each time, so a single noisy window can't make the space jump.
+		Eigen::Quaterniond corrected = current.slerp(ContinuousCorrectionRate, solved);
+		ctx.calibratedRotation = corrected.normalized();
+		ctx.calibratedTranslation += (solution.translation - ctx.calibratedTranslation) * ContinuousCorrectionRate;
+		ctx.positionError = solution.positionError;
+
+		ApplyProfile(ctx, AllDevicesMask);
+		SaveProfile(ctx);
+		return;
+	}
+
+	if (Session.samples.size() < Session.samples.Capacity() ||
+		Session.samplesSinceSolve < CalCtx.SampleCount() / 2 ||
+		(time - Session.timeLastSolve) < ContinuousSolveInterval)
+		return;
+
+	Session.samplesSinceSolve = 0;
+	Session.timeLastSolve = time;
+	Session.solveStage = 0;
+
+	auto &workspace = Session.solveWorkspace;
+	FillWorkspace(workspace, Session.samples);
+	workspace.robustLoss = SolveRobustLoss(ctx);
+	RotationModel model = SolveRotationModel(ctx);
+	std::atomic<int> *stage = &Session.solveStage;
+	Session.solve = Tasks().Submit([&workspace, model, stage]() {
+		workspace.rotations.Assign(workspace.samples);
+		RotationAccumulator rotation = AccumulateAllRotationPairs(workspace.rotations);
+		// Continuous corrections only follow rotation and translation drift.
+		return SolveCalibration(workspace, rotation, false, stage, model);
+	});
+}
+
+// Samples go to calibration-<date>-<time>.samples in the working directory, next to the driver's log.
+static void StartRecording(const CalibrationContext &ctx)
+{
+	if (!ctx.recordSamples)
+		return;
+
+	auto &referenceSerial = DeviceSerial(ctx.referenceID);
+	auto &targetSerial = DeviceSerial(ctx.targetID);
+
+	time_t now = time(nullptr);
+	tm local;
+	localtime_s(&local, &now);
+
+	char path[64];
+	strftime(path, sizeof path, "calibration-%Y%m%d-%H%M%S.samples", &local);
+
+	if (Recorder.Start(path, referenceSerial, targetSerial))
+		Events.Text(std::string("Recording samples to ") + path);
+	else
+		Events.Text(std::string("Couldn't create sample recording ") + path);
+}
+
+static void FindSessionCheckpoint(CalibrationContext &ctx)
+{
+	auto path = CheckpointPath();
+	SampleFileHeader header;
+	std::vector<SampleRecord> records;
+	try
+	{
+		if (!path.empty() && GetFileAttributesA(path.c_str()) != INVALID_FILE_ATTRIBUTES)
+			ReadSampleFile(path, header, records);
+	}
+	catch (const std::runtime_error &e)
+	{
+		ctx.Log(std::string("Ignoring the session checkpoint: ") + e.what() + "\n");
+	}
+	ctx.checkpointSamples = records.size();
+}
+
+static void StartCheckpoint(const CalibrationContext &ctx)
+{
+	auto path = CheckpointPath();
+	checkpointedSamples = 0;
+	if (!path.empty() && !Checkpoint.Start(path, DeviceSerial(ctx.referenceID), DeviceSerial(ctx.targetID)))
+		CalCtx.Log("Couldn't create the session checkpoint " + path + "\n");
+}
+
+// Called with the session's devices selected, before the checkpoint is started over.
+static bool LoadCheckpoint(CalibrationContext &ctx, std::vector<SampleRecord> &records)
+{
+	SampleFileHeader header;
+	try
+	{
+		ReadSampleFile(CheckpointPath(), header, records);
+	}
+	catch (const std::runtime_error &e)
+	{
+		ctx.Log(std::string("Couldn't load the interrupted calibration: ") + e.what() + "\n");
+		ctx.checkpointSamples = 0;
+		return false;
+	}
+
+	if (DeviceSerial(ctx.referenceID) != header.referenceSerial || DeviceSerial(ctx.targetID) != header.targetSerial)
+	{
+		char buf[256];
+		snprintf(buf, sizeof buf, "The interrupted calibration was of reference %s and target %s, select those to resume it\n",
+			header.referenceSerial, header.targetSerial);
+		ctx.Log(buf);
+		return false;
+	}
+	return true;
+}
+
+static void ReplayCheckpoint(CalibrationContext &ctx, const std::vector<SampleRecord> &records)
+{
+	for (auto &record : records)
+	{
+		// The replay may complete the session, which then solves.
+		if (ctx.state != CalibrationState::Rotation)
+			break;
+		AddSample(ctx, Sample(PoseFromCapture(record.reference), PoseFromCapture(record.target), record.quality), record);
+	}
+
+	char buf[256];
+	snprintf(buf, sizeof buf, "Resumed with %zd of the interrupted calibration's %zd samples\n", checkpointedSamples, records.size());
+	ctx.Log(buf);
+}
+
+// Next to the sample recordings, as calibration-<date>-<time>.residuals.csv. Rejected solves
+// too, they're the ones worth looking into.
+static void ExportResiduals(CalibrationContext &ctx, const CalibrationSolution &solution)
+{
+	auto &workspace = Session.solveWorkspace;
+	if (!workspace.keepResiduals)
+		return;
+	workspace.keepResiduals = false;
+
+	RecordSolveDiagnostics(solution, workspace.residuals);
+	ShowResidualsInView(ctx, workspace.residuals);
+	if (!ctx.exportResiduals)
+		return;
+
+	time_t now = time(nullptr);
+	tm local;
+	localtime_s(&local, &now);
+
+	char path[64];
+	strftime(path, sizeof path, "calibration-%Y%m%d-%H%M%S.residuals.csv", &local);
+	Residuals.Start(path, std::move(workspace.residuals), solution.axisError);
+	workspace.residuals.clear();
+}
+
+// Devices of a tracking system that can be held, base stations never move.
+static uint64_t PairingCandidates(StringID trackingSystem)
+{
+	uint64_t mask = Devices.TrackingSystemMask(trackingSystem);
+	for (uint32_t id = 0; id < vr::k_unMaxTrackedDeviceCount; ++id)
+	{
+		if (Devices.devices[id].deviceClass == vr::TrackedDeviceClass_TrackingReference)
+			mask &= ~DeviceBit(id);
+	}
+	return mask;
+}
+
+// Leaves the capture settings to whatever starts next, a calibration picks its own rate.
+static void StopDevicePairing()
+{
+	Capture.SetMaxRate(Pairing.CandidateMask(), 0);
+	Pairing.SetCandidates(0, 0);
+}
+
+/**
+ * While idle with autoSelectDevices, captures the movable devices of the two selected systems
+ * and feeds them to the pairing. The candidates follow the selected systems and the devices
+ * present in them, any change starts the scoring over.
+ */
+static void UpdateDevicePairing(CalibrationContext &ctx)
+{
+	uint64_t references = 0, targets = 0;
+	if (ctx.autoSelectDevices && Capture.IsOpen() && ctx.SessionReferenceSystem() != ctx.targetTrackingSystem)
+	{
+		references = PairingCandidates(ctx.SessionReferenceSystem());
+		targets = PairingCandidates(ctx.targetTrackingSystem);
+	}
+
+	if (references != Pairing.ReferenceMask() || targets != Pairing.TargetMask())
+	{
+		StopDevicePairing();
+		Pairing.SetCandidates(references, targets);
+		Capture.SetMaxRate(references | targets, PairingCaptureRate);
+		Capture.SetDevices(references | targets);
+	}
+
+	if (!Pairing.CandidateMask())
+		return;
+
+	PairingPoses.clear();
+	Capture.Drain(PairingPoses);
+	for (auto &pose : PairingPoses)
+		Pairing.Push(pose);
+}
+
+bool AutoSelectedDevices(uint32_t &referenceID, uint32_t &targetID, double &correlation)
+{
+	return Pairing.Best(referenceID, targetID, correlation);
+}
+
+bool StartContinuousCalibration()
+{
+	auto &ctx = CalCtx;
+	if (!ctx.driverContinuous && !Capture.IsOpen())
+	{
+		Events.Text("Continuous calibration needs the driver's pose capture");
+		return false;
+	}
+	if (!ctx.validProfile || ctx.referenceID == -1 || ctx.targetID == -1)
+	{
+		Events.Text("Continuous calibration needs an existing profile and selected devices");
+		return false;
+	}
+	if (ctx.targetParentSystem != NoString)
+	{
+		// Corrections are measured against the reference's raw poses, which only the reference system has.
+		Events.Text("Continuous calibration needs the target calibrated against the reference directly");
+		return false;
+	}
+
+	StopDevicePairing();
+	Session.Reset();
+	Capture.SetMaxRate(DeviceBit(ctx.referenceID) | DeviceBit(ctx.targetID), MaxCaptureRate);
+	bool inDriver = ctx.driverContinuous;
+	if (inDriver && ctx.driverConnected && !Driver.Supports(protocol::CapabilityContinuousCalibration))
+	{
+		Events.Text("The driver can't run continuous calibration, running it here instead");
+		inDriver = false;
+	}
+
+	if (inDriver)
+	{
+		if (!ctx.driverConnected)
+		{
+			Events.Text("Continuous calibration in the driver needs a driver connection");
+			return false;
+		}
+
+		protocol::Request request(protocol::RequestSetContinuousCalibration);
+		auto &config = request.setContinuousCalibration;
+		config.enabled = true;
+		config.referenceID = ctx.referenceID;
+		config.targetID = ctx.targetID;
+		config.correctMask = Devices.TrackingSystemMask(ctx.targetTrackingSystem);
+		config.windowSize = (uint32_t) ctx.SampleCount();
+		request.size = sizeof config;
+		Driver.SendAsync(request);
+
+		Session.inDriver = true;
+		ctx.state = CalibrationState::Continuous;
+		return true;
+	}
+
+	Session.samples.Reset(ctx.SampleCount());
+	Capture.SetDevices(DeviceBit(ctx.referenceID) | DeviceBit(ctx.targetID));
+	StartRecording(ctx);
+	ctx.state = CalibrationState::Continuous;
+	return true;
+}
+
+void StopContinuousCalibration()
+{
+	if (CalCtx.state != CalibrationState::Continuous)
+		return;
+
+	// Let an in-flight solve finish, its result is dropped.
+	if (Session.solve.valid())
+		Session.solve.get();
+
+	// A stopping engine settles its drift prediction into the transforms, so the status is
+	// only taken afterwards. It folds in whatever the driver corrected since the last one.
+	if (Session.inDriver)
+	{
+		protocol::Request request(protocol::RequestSetContinuousCalibration);
+		memset(&request.setContinuousCalibration, 0, sizeof request.setContinuousCalibration);
+		request.size = sizeof request.setContinuousCalibration;
+		Driver.SendBlocking(request);
+
+		auto status = Driver.SendBlocking(protocol::Request(protocol::RequestContinuousCalibrationStatus));
+		if (status.type == protocol::ResponseContinuousCalibrationStatus)
+			MergeDriverCorrection(CalCtx, status.continuousCalibrationStatus);
+	}
+
+	Capture.SetDevices(0);
+	Session.Reset();
+	CalCtx.state = CalibrationState::None;
+}
+
+/**
+ * Verification of the active profile from the poses apps see, with every transform applied.
+ * Held together, the target stays put in the reference's frame when the calibration fits, so
+ * the spread of its position there is the RMS error ComputeSensitivity reports for a solve,
+ * with the offset at its mean. Running sums keep each sample O(1): the offset's mean and second
+ * moment, the summed relative rotations for their spread around the chordal mean, and a least
+ * squares line through the offsets over time for drift.
+ */
+struct ProfileVerification
+{
+	double startTime;
+	size_t count;
+	Eigen::Vector3d sumOffset, sumTimeOffset;
+	double sumOffsetSquared, sumTime, sumTimeSquared;
+	Eigen::Matrix3d sumRelative, firstReference;
+	double maxRotation; // radians
+
+	void Reset(double time)
+	{
+		startTime = time;
+		count = 0;
+		sumOffset.setZero();
+		sumTimeOffset.setZero();
+		sumOffsetSquared = sumTime = sumTimeSquared = 0;
+		sumRelative.setZero();
+		maxRotation = 0;
+	}
+
+	void Add(double time, const Sample &sample)
+	{
+		Eigen::Vector3d offset = sample.ref.rot.transpose() * (sample.target.trans - sample.ref.trans);
+		double t = time - startTime;
+		if (count == 0)
+			firstReference = sample.ref.rot;
+
+		count++;
+		sumOffset += offset;
+		sumOffsetSquared += offset.squaredNorm();
+		sumTime += t;
+		sumTimeSquared += t * t;
+		sumTimeOffset += t * offset;
+		sumRelative.noalias() += sample.ref.rot.transpose() * sample.target.rot;
+
+		double rotation = AngleFromRotationMatrix3(sample.ref.rot * firstReference.transpose());
+		if (rotation == rotation) // acos rounds to NaN right at the identity.
+			maxRotation = std::max(maxRotation, rotation);
+	}
+
+	void Metrics(VerifyMetrics &metrics) const
+	{
+		metrics.valid = count > 1;
+		metrics.samples = count;
+		if (!metrics.valid)
+			return;
+
+		double n = (double) count;
+		Eigen::Vector3d mean = sumOffset / n;
+		metrics.positionError = sqrt(std::max(sumOffsetSquared / n - mean.squaredNorm(), 0.0));
+
+		// The rotation nearest the summed ones is their mean, and the trace against it is the
+		// sum of 1 + 2 cos(angle) over the samples.
+		Eigen::JacobiSVD<Eigen::Matrix3d> svd(sumRelative, Eigen::ComputeFullU | Eigen::ComputeFullV);
+		Eigen::Matrix3d fix = Eigen::Matrix3d::Identity();
+		if ((svd.matrixU() * svd.matrixV().transpose()).determinant() < 0)
+			fix(2, 2) = -1;
+		Eigen::Matrix3d meanRelative = svd.matrixU() * fix * svd.matrixV().transpose();
+		double meanCos = ((meanRelative.transpose() * sumRelative).trace() / n - 1.0) / 2.0;
+		metrics.rotationError = acos(std::min(std::max(meanCos, -1.0), 1.0)) * 180.0 / EIGEN_PI;
+
+		double denominator = n * sumTimeSquared - sumTime * sumTime;
+		metrics.drift = denominator > 0 ? ((n * sumTimeOffset - sumTime * sumOffset) / denominator).norm() * 100.0 : 0;
+		metrics.rotated = maxRotation * 180.0 / EIGEN_PI;
+	}
+};
+
+static ProfileVerification Verification;
+
+// A verdict needs this long and this much rotation of the devices, and gives up after the maximum.
+static const double VerifyMinDuration = 1.5;
+static const double VerifyMaxDuration = 10.0;
+static const double VerifyMinRotation = 30.0; // degrees
+static const size_t VerifyMinSamples = 20;
+
+// Fast motion magnifies latency differences between the systems into apparent error, so only
+// poses moving slower than for calibration count.
+static const double VerifyMinQuality = 0.5;
+
+// Tolerances of a profile that still fits, tracking noise alone stays well below them.
+static const double VerifyMaxPositionError = 0.02; // meters
+static const double VerifyMaxRotationError = 2.0; // degrees
+static const double VerifyMaxDrift = 1.0; // cm/s
+
+bool StartVerification()
+{
+	auto &ctx = CalCtx;
+	ctx.messages.Clear();
+	ctx.verify = VerifyMetrics();
+	ctx.verifyVerdict = VerifyVerdict::None;
+	if (!ctx.validProfile || !ctx.enabled || ctx.referenceID == -1 || ctx.targetID == -1)
+	{
+		ctx.Log("Verification needs an active profile and selected devices\n");
+		return false;
+	}
+
+	char buf[256];
+	snprintf(buf, sizeof buf, "Verifying the profile with reference %s and target %s\n", DeviceSerial(ctx.referenceID).c_str(), DeviceSerial(ctx.targetID).c_str());
+	ctx.Log(buf);
+	ctx.Log("Rotate both devices together in different directions...\n");
+
+	StopDevicePairing();
+	Verification.Reset(ctx.timeLastTick);
+	ResetTrackingLoss();
+	ctx.state = CalibrationState::Verifying;
+	ctx.wantedUpdateInterval = 0.0;
+	WakeCalibrationThread();
+	return true;
+}
+
+static void VerifyTick(CalibrationContext &ctx, double time)
+{
+	SampleRecord record;
+	auto sample = CollectSample(ctx, record);
 	if (!sample.valid)
+		return;
+	if (sample.quality >= VerifyMinQuality)
+		Verification.Add(time, sample);
+
+	Verification.Metrics(ctx.verify);
+	double elapsed = time - Verification.startTime;
+	bool enough = elapsed >= VerifyMinDuration && ctx.verify.samples >= VerifyMinSamples && ctx.verify.rotated >= VerifyMinRotation;
+	CalCtx.Progress((int) std::min(ctx.verify.rotated, VerifyMinRotation), (int) VerifyMinRotation);
+	if (!enough && elapsed < VerifyMaxDuration)
+		return;
+
+	char buf[256];
+	snprintf(buf, sizeof buf, "\nPosition error (RMS): %.2f cm, rotation error (RMS): %.2f deg, drift: %.2f cm/s over %zd samples\n",
+		ctx.verify.positionError * 100.0, ctx.verify.rotationError, ctx.verify.drift, ctx.verify.samples);
+	ctx.Log(buf);
+
+	if (!enough)
+	{
+		ctx.verifyVerdict = VerifyVerdict::Inconclusive;
+		ctx.Log("Not enough rotation to judge the profile, try again and rotate the devices further\n");
+	}
+	else if (ctx.verify.positionError > VerifyMaxPositionError || ctx.verify.rotationError > VerifyMaxRotationError || ctx.verify.drift > VerifyMaxDrift)
+	{
+		ctx.verifyVerdict = VerifyVerdict::Failed;
+		ctx.Log("The profile no longer fits, recalibration recommended\n");
+	}
+	else
+	{
+		ctx.verifyVerdict = VerifyVerdict::Passed;
+		ctx.Log("The profile still fits\n");
+	}
+	ctx.state = CalibrationState::None;
+}
+
+/**
+ * Between sessions the sample buffer, the solve workspaces and the drain buffers keep their
+ * storage, so the next session collects and solves without allocating. In low memory mode
+ * they're given back whenever the UI goes away, and the next session allocates them again.
+ */
+void TrimCalibrationMemory(CalibrationContext &ctx)
+{
+	if (ctx.state != CalibrationState::None)
+		return;
+
+	// A probe may outlive the session that started it, e.g. one ended by lost tracking, and
+	// its pool task still works on probeWorkspace and the samples.
+	if (Session.probe.valid())
+		Session.probe.wait();
+
+	Session.samples.Release();
+	Session.solveWorkspace = SolveWorkspace();
+	Session.probeWorkspace = SolveWorkspace();
+	std::vector<SolveWorkspace>().swap(Session.extraWorkspaces);
+	std::vector<SolveWorkspace>().swap(Session.comparisonWorkspaces);
+	std::vector<DSample>().swap(Session.pairs);
+	std::vector<protocol::PoseCaptureSample>().swap(Session.captured);
+	std::vector<protocol::PoseCaptureSample>().swap(PairingPoses);
+	ClearSampleView(ctx);
+	_heapmin();
+}
+
+void StartCalibration()
+{
+	resumeRequested = false;
+	CalCtx.state = CalibrationState::Begin;
+	CalCtx.wantedUpdateInterval = 0.0;
+	CalCtx.messages.Clear();
+	ClearSampleView(CalCtx);
+	WakeCalibrationThread();
+}
+
+bool ResumeCalibration()
+{
+	if (!CalCtx.checkpointSamples || CalCtx.state != CalibrationState::None)
+		return false;
+	StartCalibration();
+	resumeRequested = true;
+	return true;
+}
+
+/**
+ * Polled poses are predicted either to now or, with vsyncAlignedPoses, to when the next
+ * compositor frame reaches the display, the same point in time the compositor itself uses.
+ * Polls then land on the frame grid instead of wherever the tick happened to run, so their
+ * extrapolation error is the same for every sample.
+ */
+static void PollDevicePoses(CalibrationContext &ctx)
+{
+	float prediction = 0.0f;
+	if (ctx.vsyncAlignedPoses)
+	{
+		float secondsSinceVsync = 0.0f;
+		uint64_t frameCounter = 0;
+		auto &hmd = Devices.devices[vr::k_unTrackedDeviceIndex_Hmd];
+		float frequency = hmd.displayFrequency, vsyncToPhotons = hmd.vsyncToPhotons;
+
+		if (frequency > 0.0f && vr::VRSystem()->GetTimeSinceLastVsync(&secondsSinceVsync, &frameCounter))
+			prediction = std::max(0.0f, 1.0f / frequency - secondsSinceVsync + vsyncToPhotons);
+	}
+
+	vr::VRSystem()->GetDeviceToAbsoluteTrackingPose(vr::TrackingUniverseRawAndUncalibrated, prediction, ctx.devicePoses, vr::k_unMaxTrackedDeviceCount);
+	ctx.devicePosePrediction = prediction;
+}
+
+static const double MinReconnectDelay = 0.5, MaxReconnectDelay = 8.0; // seconds
+static double reconnectDelay = MinReconnectDelay;
+static double timeNextConnect = 0;
+
+static const double DriverStatsInterval = 2.0;
+static double timeDriverStatsWanted = -1.0, timeNextDriverStats = 0.0;
+static protocol::DriverStats driverStats[2]; // Previous and latest.
+static int driverStatsCount = 0;
+
+static bool DriverStatsWanted(double time)
+{
+	return timeDriverStatsWanted >= 0.0 && (time - timeDriverStatsWanted) < DriverStatsInterval * 2.0;
+}
+
+void WantDriverStats()
+{
+	if (!DriverStatsWanted(CalCtx.timeLastTick))
+	{
+		// Snapshots from before the gap would average the rates over it.
+		driverStatsCount = 0;
+		timeNextDriverStats = 0.0;
+		WakeCalibrationThread();
+	}
+	timeDriverStatsWanted = CalCtx.timeLastTick;
+}
+
+bool DriverStatsSnapshots(const protocol::DriverStats *&previous, const protocol::DriverStats *&latest)
+{
+	previous = &driverStats[0];
+	latest = &driverStats[1];
+	return driverStatsCount == 2;
+}
+
+bool DriverPoseRate(uint32_t openVRID, protocol::DevicePoseRate &rate)
+{
+	if (!driverStatsCount || !Driver.Supports(protocol::CapabilityPoseRates) || openVRID >= vr::k_unMaxTrackedDeviceCount)
+		return false;
+	rate = driverStats[1].poseRates[openVRID];
+	return true;
+}
+
+static void PollDriverStats(CalibrationContext &ctx, double time)
+{
+	if (!ctx.driverConnected || !Driver.Supports(protocol::CapabilityDriverStats) || !DriverStatsWanted(time) || time < timeNextDriverStats)
+		return;
+
+	timeNextDriverStats = time + DriverStatsInterval;
+	Driver.SendAsync(protocol::Request(protocol::RequestDriverStats), [](const protocol::Response &response) {
+		if (response.type != protocol::ResponseDriverStats)
+			return;
+
+		driverStats[0] = driverStats[1];
+		driverStats[1] = response.driverStats;
+		driverStatsCount = std::min(driverStatsCount + 1, 2);
+	});
+}
+
+/**
+ * Keeps the driver connection alive across SteamVR restarts. Attempts never wait for the
+ * pipe and back off while the driver stays away. The old shared memory is let go right away,
+ * a restarted driver must not find and reuse that section. Transforms sent in the meantime are dropped
+ * but still land in the shadow copy, which the caller replaces with the driver's table on
+ * reconnect, so the next pass pushes whatever the driver lacks. Returns true when the connection was just (re)established.
+ */
+static bool UpdateDriverConnection(CalibrationContext &ctx, double time)
+{
+	if (ctx.driverConnected && !Driver.Connected())
+	{
+		ctx.driverConnected = false;
+		driverStatsCount = 0; // A new driver starts its counters over.
+		Capture.Close();
+		Driver.Disconnect();
+
+		if (ctx.state == CalibrationState::Continuous)
+		{
+			StopContinuousCalibration();
+		}
+		else if (ctx.state == CalibrationState::Rotation)
+		{
+			ctx.state = CalibrationState::None;
+			ctx.Log("Lost connection to the driver, aborting calibration!\n");
+		}
+		timeNextConnect = time;
+	}
+
+	if (ctx.driverConnected || time < timeNextConnect)
+		return false;
+
+	if (!Driver.TryConnect())
+	{
+		if (reconnectDelay == MinReconnectDelay)
+			Events.Write(ClientEvent::DriverUnavailable);
+
+		timeNextConnect = time + reconnectDelay;
+		reconnectDelay = std::min(reconnectDelay * 2.0, MaxReconnectDelay);
+		return false;
+	}
+
+	Events.Write(ClientEvent::DriverConnected);
+	ctx.driverConnected = true;
+	reconnectDelay = MinReconnectDelay;
+	Capture.Open(Driver.Shared() ? &Driver.Shared()->poseCapture : nullptr);
+	return true;
+}
+
+static const double MinFullPassInterval = 0.25, MaxFullPassInterval = 300.0; // seconds
+static double fullPassInterval = MinFullPassInterval;
+static double timeNextFullPass = 0;
+static uint32_t fullPassGeneration = 0;
+
+/**
+ * Schedules the full pass, which reads back the driver's whole table and applies the profile
+ * to every device, in case the driver's state diverged from our shadow copy. Device changes
+ * themselves are picked up from registry events as they happen, so the full pass only catches
+ * what those miss, and that's most likely while devices come and go or the universe changes.
+ * It runs soon after any change in the registry, including the HMD's universe, and on
+ * reconnecting, then backs off exponentially while the device set stays the same.
+ */
+static bool FullPassDue(double time, bool connected)
+{
+	if (connected || Devices.generation != fullPassGeneration)
+	{
+		fullPassGeneration = Devices.generation;
+		fullPassInterval = MinFullPassInterval;
+		timeNextFullPass = connected ? time : std::min(timeNextFullPass, time + fullPassInterval);
+	}
+
+	if (time < timeNextFullPass)
+		return false;
+
+	timeNextFullPass = time + fullPassInterval;
+	fullPassInterval = std::min(fullPassInterval * 2.0, MaxFullPassInterval);
+	return true;
+}
+
+// Ticks as often as full passes are due after a change, down to once a second while nothing
+// happens. A change this tick's events brought in is only scheduled for next tick.
+static double IdleTickInterval()
+{
+	if (Devices.generation != fullPassGeneration)
+		return MinFullPassInterval;
+	return std::min(1.0, fullPassInterval);
+}
+
+const RequestLatency &DriverRequestLatency(uint32_t requestType)
+{
+	return Driver.Latency(requestType);
+}
+
+static void CopyName(char (&out)[protocol::MaxTrackingSystemNameLength], StringID name)
+{
+	strncpy_s(out, name != NoString ? InternedString(name).c_str() : "", _TRUNCATE);
+}
+
+static void PublishStatus(const CalibrationContext &ctx)
+{
+	protocol::CalibrationStatus status = {};
+	status.publishedTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+	status.profileSavedTime = ctx.profileSavedTime;
+	status.state = (uint32_t) ctx.state;
+	status.flags = (ctx.enabled ? protocol::StatusEnabled : 0) |
+		(ctx.validProfile ? protocol::StatusValidProfile : 0) |
+		(ctx.driverConnected ? protocol::StatusDriverConnected : 0);
+	status.positionError = ctx.positionError;
+
+	for (uint32_t id = 0; id < vr::k_unMaxTrackedDeviceCount; id++)
+	{
+		if (Devices.devices[id].present)
+			status.presentMask |= DeviceBit(id);
+	}
+	if (ctx.driverConnected && Driver.Shared())
+		status.appliedMask = Driver.Shared()->transforms.enabledMask.load(std::memory_order_relaxed);
+
+	CopyName(status.referenceTrackingSystem, ctx.referenceTrackingSystem);
+	CopyName(status.targetTrackingSystem, ctx.targetTrackingSystem);
+	Status.Publish(status);
+
+	if (!Metrics.IsRunning())
+		return;
+
+	MetricsSnapshot metrics = {};
+	metrics.profileSavedTime = status.profileSavedTime;
+	metrics.state = status.state;
+	metrics.flags = status.flags;
+	metrics.positionError = status.positionError;
+	metrics.rotationDrift = ContinuousDrift.rotation;
+	metrics.translationDrift = ContinuousDrift.translation;
+	metrics.continuousCorrections = ContinuousDrift.corrections;
+	metrics.presentMask = status.presentMask;
+	metrics.appliedMask = status.appliedMask;
+	metrics.tickSeconds = Timings[TimingSection::CalibrationTick].Last() / 1000.0;
+	metrics.scanSeconds = Timings[TimingSection::LoadVRState].Last() / 1000.0;
+	for (uint32_t type = 0; type < MetricsSnapshot::RequestTypes; type++)
+	{
+		auto &latency = Driver.Latency(type);
+		metrics.requests[type].count = latency.count;
+		metrics.requests[type].total = latency.total;
+		metrics.requests[type].max = latency.max;
+	}
+
+	// Keeps the driver's counters coming for as long as the endpoint runs.
+	WantDriverStats();
+	metrics.haveDriverStats = ctx.driverConnected && driverStatsCount > 0;
+	metrics.haveDriverPoseRates = metrics.haveDriverStats && Driver.Supports(protocol::CapabilityPoseRates);
+	if (metrics.haveDriverStats)
+		metrics.driver = driverStats[1];
+	Metrics.Publish(metrics);
+}
+
+void CalibrationTick(double time)
+{
+	SPACECAL_ZONE("CalibrationTick");
+	if (!vr::VRSystem())
+		return;
+
+	auto &ctx = CalCtx;
+	ctx.timeLastTick = time;
+
+	// Covers finishing, aborting and stopping alike, the file is closed in the background.
+	if (Recorder.IsRecording() && ctx.state != CalibrationState::Rotation && ctx.state != CalibrationState::Continuous)
+		Recorder.Stop();
+	if (Checkpoint.IsRecording() && ctx.state != CalibrationState::Rotation)
+	{
+		// Cut off before the solve, which discarded it otherwise.
+		Checkpoint.Stop(checkpointedSamples == 0);
+		ctx.checkpointSamples = checkpointedSamples;
+	}
+
+	if (editSavePending && (time - timeLastEdit) >= EditSaveDelay)
+	{
+		SaveProfile(ctx);
+		editSavePending = false;
+	}
+
+	bool connected = UpdateDriverConnection(ctx, time);
+	if (connected)
+		MarkStartupPhase(StartupPhase::DriverConnected);
+	if (ctx.driverConnected && Driver.Shared())
+		Driver.Shared()->transitionMilliseconds.store((uint32_t) (ctx.transformTransition * 1000.0), std::memory_order_relaxed);
+
+	bool resync = FullPassDue(time, connected);
+	if (resync && ctx.driverConnected)
+		SyncDriverTransforms();
+	PollDevicePoses(ctx);
+
+	Devices.PollEvents();
+	Driver.PollResponses();
+	PollDriverStats(ctx, time);
+	PublishStatus(ctx);
+
+	if (ctx.state == CalibrationState::None)
+	{
+		ctx.wantedUpdateInterval = IdleTickInterval();
+		ApplyReceivedProfile(ctx);
+		UpdateAnchorAlignment(ctx);
+		UpdateUniverse(ctx);
+		UpdateProfileDevices(ctx, resync);
+		UpdateDevicePairing(ctx);
+		return;
+	}
+
+	if (ctx.state == CalibrationState::Continuous)
+	{
+		ctx.wantedUpdateInterval = 0.1;
+		UpdateProfileDevices(ctx, resync);
+
+		CollectCapturedSamples(ctx);
+		ContinuousCalibrationTick(ctx, time);
+		return;
+	}
+
+	if (ctx.state == CalibrationState::Verifying)
+	{
+		ctx.wantedUpdateInterval = 0.0;
+		UpdateProfileDevices(ctx, resync);
+		VerifyTick(ctx, time);
+		return;
+	}
+
+	if (ctx.state == CalibrationState::Editing)
+	{
+		// Edits are applied through ProfileEdited as they happen, this only catches devices that come and go.
+		ctx.wantedUpdateInterval = 0.1;
+		UpdateProfileDevices(ctx, resync);
+		return;
+	}
+
+	if (ctx.state == CalibrationState::Begin)
 	{
+		bool ok = true;
+
+		char buf[256];
+		snprintf(buf, sizeof buf, "Reference device ID: %d, serial: %s\n", ctx.referenceID, DeviceSerial(ctx.referenceID).c_str());
+		CalCtx.Log(buf);
+		snprintf(buf, sizeof buf, "Target device ID: %d, serial %s\n", ctx.targetID, DeviceSerial(ctx.targetID).c_str());
+		CalCtx.Log(buf);
+
+		if (ctx.referenceID == -1)
+		{
+			CalCtx.Log("Missing reference device\n"); ok = false;
+		}
+		else if (!ctx.devicePoses[ctx.referenceID].bPoseIsValid)
+		{
+			CalCtx.Log("Reference device is not tracking\n"); ok = false;
+		}
+
+		if (ctx.targetID == -1)
+		{
+			CalCtx.Log("Missing target device\n"); ok = false;
+		}
+		else if (!ctx.devicePoses[ctx.targetID].bPoseIsValid)
+		{
+			CalCtx.Log("Target device is not tracking\n"); ok = false;
+		}
+
+		TransformGraph::Transform parent;
+		if (ctx.calibrateAgainst != NoString && !Graph.Resolve(ctx.calibrateAgainst, parent))
+		{
+			CalCtx.Log("The system to calibrate against isn't calibrated to the reference itself\n"); ok = false;
+		}
+
+		std::vector<SampleRecord> resumed;
+		if (ok && resumeRequested)
+			ok = LoadCheckpoint(ctx, resumed);
+		resumeRequested = false;
+
+		if (!ok)
+		{
+			ctx.state = CalibrationState::None;
+			CalCtx.Log("Aborting calibration!\n");
+			return;
+		}
+
+		ResetAndDisableOffsets(ctx.targetID);
+		Session.Reset();
+		ResetTrackingLoss();
+		Session.parentSystem = ctx.calibrateAgainst;
+		Session.prior = ProfilePrior(ctx);
+		if (Session.prior.valid)
+			CalCtx.Log("Starting from the current profile\n");
+		Session.samples.Reset(MaxSampleCount(ctx));
+		ctx.collection = CollectionMetrics();
+		StopDevicePairing();
+
+		uint64_t captureMask = DeviceBit(ctx.referenceID) | DeviceBit(ctx.targetID);
+		StartExtraTargets(ctx);
+		for (auto &extra : Session.extras)
+			captureMask |= DeviceBit(extra.id);
+		StartExtraReferences(ctx);
+		for (auto &extra : Session.extraReferences)
+			captureMask |= DeviceBit(extra.id);
+		Capture.SetMaxRate(captureMask, MaxCaptureRate);
+		Capture.SetDevices(captureMask);
+		StartRecording(ctx);
+		StartCheckpoint(ctx);
+		ctx.checkpointSamples = 0;
+		ctx.state = CalibrationState::Rotation;
+		ctx.wantedUpdateInterval = 0.0;
+
+		CalCtx.Log("Starting calibration...\n");
+		if (!resumed.empty())
+			ReplayCheckpoint(ctx, resumed);
 		return;
 	}
 
-	static std::vector<Sample> samples;
-	samples.push_back(sample);
+	if (ctx.state == CalibrationState::Solving)
+	{
+		CalCtx.Progress(Session.solveStage, SolveStageCount);
+
+		if (Session.solve.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+			return;
+
+		for (auto &extra : Session.extraSolves)
+		{
+			if (extra.solve.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+				return;
+		}
+		for (auto &comparison : Session.comparisons)
+		{
+			if (comparison.solve.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+				return;
+		}
 
-	CalCtx.Progress(samples.size(), CalCtx.SampleCount());
+		auto solution = Session.solve.get();
+		ExportResiduals(ctx, solution);
+		LogSolverComparison(solution);
+		FinishExtraTargets(ctx);
+		FinishCalibration(ctx, solution);
+		return;
+	}
 
-	if (samples.size() == CalCtx.SampleCount())
+	if (Capture.IsOpen())
 	{
-		CalCtx.Log("\n");
+		CollectCapturedSamples(ctx);
+		CheckConvergence(ctx);
+		return;
+	}
+
+	SampleRecord record;
+	auto sample = CollectSample(ctx, record);
+	if (sample.valid)
+		AddSample(ctx, sample, record);
+	CheckConvergence(ctx);
+}
 
-		ctx.calibratedRotation = CalibrateRotation(samples);
+std::mutex CalibrationMutex;
 
-		auto vrRotQuat = VRRotationQuat(ctx.calibratedRotation);
+static const double MinTickInterval = 0.05;
 
-		static std::vector<Sample> samplesOriginal = samples;
+// Identifying repeats a short haptic pulse, which also blinks the LED of devices without a motor.
+static const double IdentifyPulseInterval = 0.005;
+static const double IdentifyDuration = 0.5;
+static const unsigned short IdentifyPulseMicroseconds = 2000;
 
-		for (auto &sample : samples) {
-			const auto rotMat = quaternionRotateMatrix(vrRotQuat);
-			sample.target.rot = rotMat * sample.target.rot;
-			sample.target.trans = rotMat * sample.target.trans;
-		}
+static struct
+{
+	uint64_t requested = 0; // Set by IdentifyDevices, picked up by the next pulse.
+	uint64_t mask = 0;
+	double nextPulse = 0, end = 0;
+} Identify;
 
-		ctx.calibratedTranslation = CalibrateTranslation(samples);
+void IdentifyDevices(uint64_t deviceMask)
+{
+	Identify.requested |= deviceMask;
+	WakeCalibrationThread();
+}
 
-		auto vrTrans = VRTranslationVec(ctx.calibratedTranslation);
+// Returns the time of the next pulse, or infinity once there is none.
+static double PulseIdentifiedDevices(double time)
+{
+	if (Identify.requested)
+	{
+		Identify.mask |= Identify.requested;
+		Identify.requested = 0;
+		Identify.nextPulse = time;
+		Identify.end = time + IdentifyDuration;
+	}
+	if (!Identify.mask || !vr::VRSystem())
+		return std::numeric_limits<double>::infinity();
 
-		if (ComputeSensitivity(CalCtx, samplesOriginal, vrTrans, vrRotQuat)) {
-			CalCtx.Log("\n\n!!! Rejecting low quality calibration !!!\n");
-			ctx.state = CalibrationState::None;
-			samples.clear();
+	if (time >= Identify.end)
+	{
+		Identify.mask = 0;
+		return std::numeric_limits<double>::infinity();
+	}
+	if (time < Identify.nextPulse)
+		return Identify.nextPulse;
+
+	for (uint32_t id = 0; id < vr::k_unMaxTrackedDeviceCount; id++)
+	{
+		if (Identify.mask & (1ull << id))
+			vr::VRSystem()->TriggerHapticPulse(id, 0, IdentifyPulseMicroseconds);
+	}
+
+	// Pulses skipped while the thread was late aren't made up for.
+	Identify.nextPulse = std::max(Identify.nextPulse + IdentifyPulseInterval, time);
+	return Identify.nextPulse;
+}
+
+static std::thread TickThread;
+static std::atomic<bool> TickThreadStopping(false);
+static HANDLE TickWakeEvent = nullptr;
+static std::exception_ptr TickError;
+
+/**
+ * Ticks on a high resolution waitable timer, so sample timing doesn't depend on how long the
+ * UI takes to render or how often it gets events. The next tick is timed from the start of
+ * the previous one. Identify pulses are due far more often than ticks, the thread wakes for
+ * whichever comes first and only ticks when a tick is due.
+ */
+static void RunTickThread(double (*clock)(), void (*onTick)())
+{
+	// Every device found here is new to the registry, so the first tick applies the profile to all of them.
+	{
+		std::lock_guard<std::mutex> lock(CalibrationMutex);
+		try
+		{
+			InitCalibrator();
+			MarkStartupPhase(StartupPhase::InitCalibrator);
+			LoadProfile(CalCtx);
+			MarkStartupPhase(StartupPhase::LoadProfile);
+			SelectStartupUniverse(CalCtx);
+
+			uint32_t syncMode, syncChannel;
+			LoadProfileSyncSettings(syncMode, syncChannel);
+			SharedProfiles.Start(syncMode, syncChannel, LoadProfileSyncKey());
+			CalCtx.anchorSerial = Intern(LoadAnchorSerial());
+			Metrics.Start(LoadMetricsPort());
+			PublishCalibrationSnapshot(CalCtx);
+		}
+		catch (std::runtime_error &)
+		{
+			TickError = std::current_exception();
 			return;
 		}
+	}
 
-		protocol::Request req(protocol::RequestSetDeviceTransform);
-		req.setDeviceTransform = { ctx.targetID, true, vrTrans, vrRotQuat };
-		Driver.SendBlocking(req);
+	HANDLE timer = CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+	if (!timer) // Before Windows 10 1803.
+		timer = CreateWaitableTimerExW(nullptr, nullptr, 0, TIMER_ALL_ACCESS);
 
-		ctx.validProfile = true;
-		SaveProfile(ctx);
-		CalCtx.Log("Finished calibration, profile saved\n");
+	double nextTick = clock();
+	while (!TickThreadStopping)
+	{
+		double start = clock(), nextPulse;
+		{
+			std::lock_guard<std::mutex> lock(CalibrationMutex);
+			if (start >= nextTick)
+			{
+				try
+				{
+					ScopedTiming timing(TimingSection::CalibrationTick);
+					RunCalibrationCommands(CalCtx);
+					CalibrationTick(start);
+					PublishCalibrationSnapshot(CalCtx);
+				}
+				catch (std::runtime_error &)
+				{
+					TickError = std::current_exception();
+					break;
+				}
+
+				nextTick = start + std::max(CalCtx.wantedUpdateInterval, MinTickInterval);
+				if (onTick)
+					onTick();
+			}
+			nextPulse = PulseIdentifiedDevices(clock());
+		}
 
-		ctx.state = CalibrationState::None;
+		double wait = std::min(nextTick, nextPulse) - clock();
+		if (wait <= 0.0)
+			continue;
+
+		LARGE_INTEGER due;
+		due.QuadPart = -(LONGLONG) (wait * 1e7); // Relative, in 100 ns units.
+		SetWaitableTimer(timer, &due, 0, nullptr, nullptr, FALSE);
 
-		samples.clear();
+		HANDLE handles[] = { timer, TickWakeEvent };
+		if (WaitForMultipleObjects(2, handles, FALSE, INFINITE) == WAIT_OBJECT_0 + 1)
+			nextTick = clock();
 	}
+
+	CloseHandle(timer);
+}
+
+void StartCalibrationThread(double (*clock)(), void (*onTick)())
+{
+	TickThreadStopping = false;
+	TickWakeEvent = CreateEventA(nullptr, FALSE, FALSE, nullptr);
+	TickThread = std::thread(RunTickThread, clock, onTick);
+}
+
+void StopCalibrationThread()
+{
+	if (!TickThread.joinable())
+		return;
+
+	TickThreadStopping = true;
+	SetEvent(TickWakeEvent);
+	TickThread.join();
+	SharedProfiles.Stop();
+	NetworkPoses.Stop();
+	Metrics.Stop();
+
+	CloseHandle(TickWakeEvent);
+	TickWakeEvent = nullptr;
+}
+
+void CheckCalibrationThread()
+{
+	std::lock_guard<std::mutex> lock(CalibrationMutex);
+	if (TickError)
+		std::rethrow_exception(TickError);
+}
+
+void WakeCalibrationThread()
+{
+	if (TickWakeEvent)
+		SetEvent(TickWakeEvent);
 }
 
 void LoadChaperoneBounds()
@@ -654,16 +3541,456 @@ void LoadChaperoneBounds()
 
 	CalCtx.chaperone.geometry.resize(quadCount);
 	vr::VRChaperoneSetup()->GetLiveCollisionBoundsInfo(&CalCtx.chaperone.geometry[0], &quadCount);
+
+	// Only the copy in the profile is simplified, pasting it then commits the simplified bounds
+	// once and later comparisons with the live bounds find them equal.
+	size_t scanned = CalCtx.chaperone.geometry.size();
+	SimplifyChaperone(CalCtx.chaperone.geometry, CalCtx.chaperoneTolerance * 0.01);
+	if (CalCtx.chaperone.geometry.size() != scanned)
+		printf("simplified chaperone bounds from %zu to %zu quads\n", scanned, CalCtx.chaperone.geometry.size());
 	vr::VRChaperoneSetup()->GetWorkingStandingZeroPoseToRawTrackingPose(&CalCtx.chaperone.standingCenter);
 	vr::VRChaperoneSetup()->GetWorkingPlayAreaSize(&CalCtx.chaperone.playSpaceSize.v[0], &CalCtx.chaperone.playSpaceSize.v[1]);
 	CalCtx.chaperone.valid = true;
 }
 
-void ApplyChaperoneBounds()
+/**
+ * Moves bounds from where from put the target's devices to where to puts them: y' = A y + b
+ * with A = (s' / s) R' R^T and b = t' - A t. The corners are relative to the standing center,
+ * so the center alone carries the rotation and translation, and the corners only take the
+ * scale, which a pose can't hold. They are one 3xN float matrix in place, a single product
+ * over the whole array however many quads a scanned room has.
+ */
+static void ReprojectChaperone(ChaperoneProfile &chaperone, const TransformGraph::Transform &from, const TransformGraph::Transform &to)
 {
-	vr::VRChaperoneSetup()->RevertWorkingCopy();
-	vr::VRChaperoneSetup()->SetWorkingCollisionBoundsInfo(&CalCtx.chaperone.geometry[0], CalCtx.chaperone.geometry.size());
-	vr::VRChaperoneSetup()->SetWorkingStandingZeroPoseToRawTrackingPose(&CalCtx.chaperone.standingCenter);
-	vr::VRChaperoneSetup()->SetWorkingPlayAreaSize(CalCtx.chaperone.playSpaceSize.v[0], CalCtx.chaperone.playSpaceSize.v[1]);
-	vr::VRChaperoneSetup()->CommitWorkingCopy(vr::EChaperoneConfigFile_Live);
+	Eigen::Matrix3d rotation = to.rotation * from.rotation.transpose();
+	double scale = to.scale / from.scale;
+	Eigen::Vector3d offset = (to.translation - scale * rotation * from.translation) * 0.01; // cm to m
+
+	Eigen::Isometry3d center = IsometryFromMatrix(chaperone.standingCenter);
+	center.translation() = scale * (rotation * center.translation()) + offset;
+	center.linear() = rotation * center.linear();
+	chaperone.standingCenter = MatrixFromIsometry(center);
+
+	if (scale != 1.0)
+	{
+		static_assert(sizeof(vr::HmdQuad_t) == 12 * sizeof(float), "quads expected to be four packed float corners");
+		Eigen::Map<Eigen::Matrix3Xf> corners((float *) chaperone.geometry.data(), 3, chaperone.geometry.size() * 4);
+		corners *= (float) scale;
+	}
+
+	chaperone.playSpaceSize.v[0] *= (float) scale;
+	chaperone.playSpaceSize.v[1] *= (float) scale;
+}
+
+// Only the parts that differ from the profile are set, and nothing is committed if none do,
+// since a commit rewrites SteamVR's chaperone files.
+bool ApplyChaperoneBounds()
+{
+	auto &chaperone = CalCtx.chaperone;
+	auto setup = vr::VRChaperoneSetup();
+	setup->RevertWorkingCopy();
+
+	bool changed = false;
+	if (!LiveChaperoneMatchesProfile(CalCtx))
+	{
+		setup->SetWorkingCollisionBoundsInfo(&chaperone.geometry[0], chaperone.geometry.size());
+		changed = true;
+	}
+
+	vr::HmdMatrix34_t standingCenter;
+	if (!setup->GetWorkingStandingZeroPoseToRawTrackingPose(&standingCenter) ||
+		memcmp(&standingCenter, &chaperone.standingCenter, sizeof standingCenter) != 0)
+	{
+		setup->SetWorkingStandingZeroPoseToRawTrackingPose(&chaperone.standingCenter);
+		changed = true;
+	}
+
+	float sizeX, sizeZ;
+	if (!setup->GetWorkingPlayAreaSize(&sizeX, &sizeZ) ||
+		sizeX != chaperone.playSpaceSize.v[0] || sizeZ != chaperone.playSpaceSize.v[1])
+	{
+		setup->SetWorkingPlayAreaSize(chaperone.playSpaceSize.v[0], chaperone.playSpaceSize.v[1]);
+		changed = true;
+	}
+
+	if (changed)
+		setup->CommitWorkingCopy(vr::EChaperoneConfigFile_Live);
+	return changed;
+}
+
+static const size_t BenchmarkSampleCounts[] = { 100, 250, 500, 5000 };
+static const int BenchmarkRepetitions = 5;
+
+// Throws std::runtime_error like ReadSampleFile.
+static std::vector<Sample> ReadRecordedSamples(const std::string &path, SampleFileHeader &header)
+{
+	std::vector<SampleRecord> records;
+	ReadSampleFile(path, header, records);
+
+	std::vector<Sample> recorded;
+	recorded.reserve(records.size());
+	for (auto &record : records)
+	{
+		Sample sample(PoseFromCapture(record.reference), PoseFromCapture(record.target), record.quality);
+		sample.valid = record.reference.valid && record.target.valid;
+		recorded.push_back(sample);
+	}
+	return recorded;
+}
+
+// Same work as a live run: accumulation as samples arrive, then the solve on the worker.
+static CalibrationSolution SolveRecordedSamples(SolveWorkspace &workspace, const std::vector<Sample> &samples, const SolverVariant &variant)
+{
+	std::atomic<int> stage(0);
+	RotationAccumulator rotation;
+	CompactRotations &rotations = workspace.rotations;
+	rotations.Clear();
+	for (size_t j = 0; j < samples.size(); j++)
+	{
+		rotations.Push(samples[j]);
+		AccumulateRotationPairs(rotation, rotations, j);
+	}
+	workspace.samples = samples;
+	return SolveCalibration(workspace, rotation, variant.estimateScale, &stage, variant.model);
+}
+
+int RunCalibrationBenchmark(const std::string &path)
+{
+	SampleFileHeader header;
+	std::vector<Sample> recorded;
+	try
+	{
+		recorded = ReadRecordedSamples(path, header);
+	}
+	catch (const std::runtime_error &e)
+	{
+		fprintf(stderr, "Failed to load samples: %s\n", e.what());
+		return -1;
+	}
+
+	printf("%s: %zu samples, reference %s, target %s\n", path.c_str(), recorded.size(), header.referenceSerial, header.targetSerial);
+	printf("%8s %12s %12s %10s %8s %8s %8s %s\n", "samples", "best ms", "median ms", "alloc KB", "rms", "sens X", "sens Y", "sens Z");
+
+	for (size_t count : BenchmarkSampleCounts)
+	{
+		if (count > recorded.size())
+		{
+			printf("%8zu skipped, recording is too short\n", count);
+			continue;
+		}
+
+		std::vector<Sample> samples(recorded.begin(), recorded.begin() + count);
+		std::vector<double> times;
+		CalibrationSolution solution;
+		long long allocated = -1;
+
+		// Reused like a session's, so the allocations reported are the ones every solve makes.
+		SolveWorkspace workspace;
+		workspace.Reserve(count);
+
+		for (int i = 0; i < BenchmarkRepetitions; i++)
+		{
+#ifdef _DEBUG
+			_CrtMemState before, after;
+			_CrtMemCheckpoint(&before);
+#endif
+			auto start = std::chrono::steady_clock::now();
+			solution = SolveRecordedSamples(workspace, samples, SolverVariants[0]);
+			auto end = std::chrono::steady_clock::now();
+			times.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+#ifdef _DEBUG
+			_CrtMemCheckpoint(&after);
+			allocated = (long long) (after.lTotalCount - before.lTotalCount);
+#endif
+		}
+
+		std::sort(times.begin(), times.end());
+		char allocText[32] = "n/a";
+		if (allocated >= 0)
+			snprintf(allocText, sizeof allocText, "%.1f", allocated / 1024.0);
+
+		printf("%8zu %12.3f %12.3f %10s %8.4f %8.3f %8.3f %8.3f%s\n",
+			count, times.front(), times[times.size() / 2], allocText, solution.positionError,
+			solution.sensitivity(0), solution.sensitivity(1), solution.sensitivity(2), solution.reject ? " rejected" : "");
+	}
+
+	return 0;
+}
+
+/**
+ * Solves every .samples recording in a directory with each SolverVariant marked offline,
+ * and prints a row per recording and solver, then each solver's medians over all of them. The
+ * recordings are independent jobs: each worker takes the next one from a shared counter until
+ * none are left, so a long recording keeps one worker busy while the rest carry on.
+ */
+static const size_t SolverVariantCount = sizeof SolverVariants / sizeof SolverVariants[0];
+
+struct BatchRecording
+{
+	std::string name, error;
+	size_t samples = 0;
+	bool solved[SolverVariantCount] = { false };
+	CalibrationSolution solutions[SolverVariantCount];
+	double milliseconds[SolverVariantCount] = { 0 };
+};
+
+static void SolveBatchRecording(const std::string &directory, SolveWorkspace &workspace, BatchRecording &recording)
+{
+	SampleFileHeader header;
+	std::vector<Sample> samples;
+	try
+	{
+		samples = ReadRecordedSamples(directory + "\\" + recording.name, header);
+	}
+	catch (const std::runtime_error &e)
+	{
+		recording.error = e.what();
+		return;
+	}
+
+	recording.samples = samples.size();
+	workspace.Reserve(samples.size());
+	for (size_t i = 0; i < SolverVariantCount; i++)
+	{
+		if (!SolverVariants[i].offline)
+			continue;
+
+		auto start = std::chrono::steady_clock::now();
+		recording.solutions[i] = SolveRecordedSamples(workspace, samples, SolverVariants[i]);
+		recording.milliseconds[i] = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		recording.solutions[i].log.clear();
+		recording.solved[i] = true;
+	}
+}
+
+static double Median(std::vector<double> values)
+{
+	if (values.empty())
+		return 0.0;
+	std::sort(values.begin(), values.end());
+	return values[values.size() / 2];
+}
+
+int RunBatchCalibration(const std::string &directory)
+{
+	std::vector<BatchRecording> recordings;
+	WIN32_FIND_DATAA found;
+	HANDLE find = FindFirstFileA((directory + "\\*.samples").c_str(), &found);
+	if (find != INVALID_HANDLE_VALUE)
+	{
+		do
+		{
+			if (!(found.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY))
+			{
+				recordings.emplace_back();
+				recordings.back().name = found.cFileName;
+			}
+		} while (FindNextFileA(find, &found));
+		FindClose(find);
+	}
+
+	if (recordings.empty())
+	{
+		fprintf(stderr, "No .samples recordings in %s\n", directory.c_str());
+		return -1;
+	}
+	std::sort(recordings.begin(), recordings.end(), [](const BatchRecording &a, const BatchRecording &b) { return a.name < b.name; });
+
+	size_t workerCount = std::min(Tasks().WorkerCount(), recordings.size());
+	printf("%zu recordings in %s, %zu workers\n", recordings.size(), directory.c_str(), workerCount);
+
+	auto start = std::chrono::steady_clock::now();
+	std::atomic<size_t> next(0);
+	std::vector<std::future<void>> workers;
+	for (size_t w = 0; w < workerCount; w++)
+	{
+		workers.push_back(Tasks().Submit([&]() {
+			SolveWorkspace workspace;
+			for (size_t i = next++; i < recordings.size(); i = next++)
+				SolveBatchRecording(directory, workspace, recordings[i]);
+		}));
+	}
+	for (auto &worker : workers)
+		worker.get();
+	double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	int failed = 0;
+	printf("%-32s %8s %-18s %8s %8s %8s %8s %10s\n", "recording", "samples", "solver", "rms mm", "sens X", "sens Y", "sens Z", "ms");
+	for (auto &recording : recordings)
+	{
+		if (!recording.error.empty())
+		{
+			printf("%-32s failed: %s\n", recording.name.c_str(), recording.error.c_str());
+			failed++;
+			continue;
+		}
+
+		for (size_t i = 0; i < SolverVariantCount; i++)
+		{
+			if (!recording.solved[i])
+				continue;
+
+			auto &solution = recording.solutions[i];
+			printf("%-32s %8zu %-18s %8.3f %8.3f %8.3f %8.3f %10.2f%s\n", recording.name.c_str(), recording.samples,
+				SolverVariants[i].name, solution.positionError * 1000.0, solution.sensitivity(0) * 100.0, solution.sensitivity(1) * 100.0,
+				solution.sensitivity(2) * 100.0, recording.milliseconds[i], solution.reject ? " rejected" : "");
+		}
+	}
+
+	printf("\n%-18s %8s %12s %10s %10s\n", "solver", "solved", "median rms", "median ms", "rejected");
+	for (size_t i = 0; i < SolverVariantCount; i++)
+	{
+		if (!SolverVariants[i].offline)
+			continue;
+
+		std::vector<double> errors, times;
+		int rejected = 0;
+		for (auto &recording : recordings)
+		{
+			if (!recording.solved[i])
+				continue;
+			errors.push_back(recording.solutions[i].positionError * 1000.0);
+			times.push_back(recording.milliseconds[i]);
+			rejected += recording.solutions[i].reject;
+		}
+		printf("%-18s %8zu %9.3f mm %10.2f %10d\n", SolverVariants[i].name, errors.size(), Median(errors), Median(times), rejected);
+	}
+
+	printf("\n%zu recordings in %.2f s, %d couldn't be read\n", recordings.size(), elapsed, failed);
+	return failed ? 1 : 0;
+}
+
+// A target device of the simulated rig, collecting samples with the reference like the main
+// target of a live session: latency estimated from the captured history, then sampled on a
+// fixed grid shifted by it.
+struct SimulatedTarget
+{
+	PoseHistory history;
+	double latency = 0, timeLastLatencyEstimate = 0, nextSampleTime = 0;
+	double finished = -1; // When the last sample was collected.
+	Sample lastAccepted;
+	SolveWorkspace workspace;
+	RotationAccumulator rotation;
+};
+
+static const double SimulatedFrameInterval = 1.0 / 90.0;
+
+static void CollectSimulatedSamples(SimulatedTarget &target, const PoseHistory &reference, size_t sampleCount)
+{
+	if (reference.Empty() || target.history.Empty())
+		return;
+
+	if (target.history.LatestTime() - target.timeLastLatencyEstimate >= LatencyEstimateInterval)
+	{
+		target.timeLastLatencyEstimate = target.history.LatestTime();
+		EstimateCaptureLatency(reference, target.history, target.latency);
+	}
+
+	double begin = std::max(target.history.OldestTime(), reference.OldestTime() - target.latency);
+	double end = std::min(target.history.LatestTime(), reference.LatestTime() - target.latency);
+	target.nextSampleTime = std::max(target.nextSampleTime, begin);
+
+	auto &samples = target.workspace.samples;
+	for (; target.nextSampleTime <= end && samples.size() < sampleCount; target.nextSampleTime += CaptureSampleInterval)
+	{
+		protocol::PoseCaptureSample referencePose, targetPose;
+		if (!target.history.Interpolate(target.nextSampleTime, targetPose) ||
+			!reference.Interpolate(target.nextSampleTime + target.latency, referencePose))
+			continue;
+
+		double quality = std::min(CapturedPoseQuality(referencePose), CapturedPoseQuality(targetPose));
+		Sample sample(PoseFromCapture(referencePose), PoseFromCapture(targetPose), quality);
+		if (sample.quality < MinSampleQuality || !MovedEnough(target.lastAccepted, sample))
+			continue;
+
+		target.lastAccepted = sample;
+		samples.push_back(sample);
+		target.workspace.rotations.Push(sample);
+		AccumulateRotationPairs(target.rotation, target.workspace.rotations, samples.size() - 1);
+		if (samples.size() == sampleCount)
+			target.finished = target.nextSampleTime;
+	}
+}
+
+int RunCalibrationSimulation(const SimulationOptions &options)
+{
+	TrackingSimulator simulator(options);
+	std::vector<SimulatedTarget> targets(options.targets);
+	for (auto &target : targets)
+		target.workspace.Reserve(options.samples);
+
+	printf("%u targets, %zu samples each, %.0f Hz, %.1f mm and %.2f deg noise, %.0f ms latency, drift %.1f mm/min and %.2f deg/min%s\n",
+		options.targets, options.samples, options.rate, options.positionNoise, options.rotationNoise, options.latency,
+		options.translationDrift, options.rotationDrift, options.gravityAligned ? ", gravity aligned" : "");
+
+	// Captured a frame at a time, as the client drains the driver's capture buffer.
+	PoseHistory reference;
+	std::vector<protocol::PoseCaptureSample> captured;
+	size_t unfinished = targets.size();
+	for (double time = 0; unfinished && time < options.seconds; time += SimulatedFrameInterval)
+	{
+		captured.clear();
+		simulator.Capture(time, time + SimulatedFrameInterval, captured);
+		for (auto &pose : captured)
+		{
+			if (pose.openVRID == TrackingSimulator::ReferenceID)
+				reference.Push(pose);
+			else
+				targets[pose.openVRID - 1].history.Push(pose);
+		}
+
+		unfinished = 0;
+		for (auto &target : targets)
+		{
+			if (target.finished < 0)
+				CollectSimulatedSamples(target, reference, options.samples);
+			unfinished += target.finished < 0 ? 1 : 0;
+		}
+	}
+
+	printf("%6s %8s %10s %10s %10s %10s %10s %8s\n", "target", "samples", "session s", "latency ms", "rot err", "trans mm", "solve ms", "rms");
+
+	double totalRotationError = 0, maxRotationError = 0, totalTranslationError = 0, maxTranslationError = 0, totalMilliseconds = 0;
+	int solved = 0;
+	for (size_t i = 0; i < targets.size(); i++)
+	{
+		auto &target = targets[i];
+		size_t count = target.workspace.samples.size();
+		if (target.finished < 0)
+		{
+			printf("%6zu %8zu only collected within %.0f s\n", i + 1, count, options.seconds);
+			continue;
+		}
+
+		auto start = std::chrono::steady_clock::now();
+		CalibrationSolution solution = SolveCalibration(target.workspace, target.rotation, false, nullptr,
+			options.gravityAligned ? RotationModel::GravityAligned : RotationModel::Full);
+		double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+		// Against the transform at the end of the session, which is what the profile gets applied as.
+		Eigen::Matrix3d truthRotation;
+		Eigen::Vector3d truthTranslation;
+		simulator.GroundTruth(target.finished, truthRotation, truthTranslation);
+
+		Eigen::Matrix3d rotation = EulerQuat(solution.rotation).toRotationMatrix();
+		double rotationError = Eigen::AngleAxisd(rotation * truthRotation.transpose()).angle() * 180.0 / EIGEN_PI;
+		double translationError = (solution.translation / 100.0 - truthTranslation).norm() * 1000.0;
+
+		printf("%6zu %8zu %10.1f %10.1f %10.3f %10.2f %10.3f %8.4f%s\n", i + 1, count, target.finished, target.latency * 1000.0,
+			rotationError, translationError, milliseconds, solution.positionError, solution.reject ? " rejected" : "");
+
+		totalRotationError += rotationError;
+		maxRotationError = std::max(maxRotationError, rotationError);
+		totalTranslationError += translationError;
+		maxTranslationError = std::max(maxTranslationError, translationError);
+		totalMilliseconds += milliseconds;
+		solved++;
+	}
+
+	if (!solved)
+		return -1;
+
+	printf("mean rotation error %.3f deg (max %.3f), translation error %.2f mm (max %.2f), solve %.3f ms\n",
+		totalRotationError / solved, maxRotationError, totalTranslationError / solved, maxTranslationError, totalMilliseconds / solved);
+	return solved == (int) targets.size() ? 0 : -1;
 }
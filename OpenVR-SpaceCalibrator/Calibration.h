@@ -1,8 +1,15 @@
 #pragma once
 
+#include "StringTable.h"
+#include "MessageLog.h"
+#include "EventLog.h"
+
 #include <Eigen/Core>
+#include <Eigen/Geometry>
 #include <openvr.h>
 #include <vector>
+#include <unordered_map>
+#include <mutex>
 
 enum class CalibrationState
 {
@@ -10,7 +17,126 @@ enum class CalibrationState
 	Begin,
 	Rotation,
 	Translation,
+	Solving,
 	Editing,
+	Continuous,
+	Verifying,
+};
+
+// The selected device whose captured poses an external system's stand in for, see NetworkPoseSource.
+enum class NetworkPoseRole
+{
+	None,
+	Reference,
+	Target,
+};
+
+// What the driver does with a linked device's source, see SetDeviceLink.
+enum class DeviceLinkMode
+{
+	Fuse, // Both are fused all along, and the source carries the device while it is lost.
+	Fallback, // The device's own tracking passes unchanged, the source only stands in while it is lost.
+};
+
+// Outcome of the last StartVerification.
+enum class VerifyVerdict
+{
+	None,
+	Passed,
+	Failed, // A recalibration is recommended.
+	Inconclusive, // The devices didn't rotate enough to tell.
+};
+
+// Calibration of one target tracking system against the context's reference system, or
+// against another calibrated target system, see TransformGraph.
+struct TargetProfile
+{
+	StringID trackingSystem = NoString;
+	StringID parentSystem = NoString; // Calibrated against this system, NoString for the reference.
+	Eigen::Quaterniond rotation = Eigen::Quaterniond::Identity();
+	Eigen::Vector3d translation = Eigen::Vector3d::Zero(); // cm
+	double scale = 1.0;
+};
+
+// Refinement for a single device, applied in its own tracking space before the system's calibration.
+struct DeviceOffset
+{
+	Eigen::Vector3d rotation = Eigen::Vector3d::Zero(); // degrees
+	Eigen::Vector3d translation = Eigen::Vector3d::Zero(); // cm
+};
+
+struct ChaperoneProfile
+{
+	bool valid = false;
+	bool autoApply = true;
+	bool followCalibration = false; // Bounds traced with the target's devices move with its recalibrations.
+	std::vector<vr::HmdQuad_t> geometry;
+	vr::HmdMatrix34_t standingCenter;
+	vr::HmdVector2_t playSpaceSize;
+};
+
+/**
+ * The calibrations and chaperone of another universe, the room setup SteamVR tracks the HMD
+ * in. Kept loaded with the profile, so when the HMD moves to that universe its transforms go
+ * to the driver straight away instead of needing a recalibration. Device offsets belong to the
+ * devices and stay shared.
+ */
+struct UniverseProfile
+{
+	uint64_t universeID = 0;
+	StringID referenceTrackingSystem = NoString;
+	StringID targetTrackingSystem = NoString;
+	StringID targetParentSystem = NoString;
+	Eigen::Quaterniond calibratedRotation = Eigen::Quaterniond::Identity();
+	Eigen::Vector3d calibratedTranslation = Eigen::Vector3d::Zero();
+	double calibratedScale = 1.0;
+	double targetLatency = 0;
+	bool validProfile = false;
+	std::vector<TargetProfile> otherTargets;
+	ChaperoneProfile chaperone;
+};
+
+// Quality of the samples collected so far, updated with every sample so the user can change
+// how they move before the solve rejects the result.
+struct CollectionMetrics
+{
+	bool valid = false;
+	double axisCoverage = 0; // 0 while all rotations share one axis, 1 once axes spread evenly in 3D.
+	int axisDirections = 0, axisDirectionCount = 0; // Histogram cells holding rotation axes, of all cells.
+	size_t redundantSamples = 0; // Skipped for adding only crowded directions.
+	double axisError = 0; // RMS angle between paired rotation axes under the current estimate, degrees.
+	Eigen::Vector3d sensitivity = Eigen::Vector3d::Zero(); // Predicted ComputeSensitivity deltas.
+	double positionError = -1; // RMS error of the last interim solve, negative before the first.
+};
+
+// A point of the calibration popup's 3D view, laid out as the view's instance buffer.
+struct SampleViewPoint
+{
+	float position[3];
+	float size; // Pixels across.
+	uint32_t color; // Bytes RGBA, like ImU32.
+};
+
+// What the 3D view shows, see SampleView.h. While collecting, the reference device's position
+// at each accepted sample in reference space. After a solve, the same positions colored by
+// their residual. axes are the rotation axis histogram's directions, both signs, on the unit
+// sphere. Any change bumps generation.
+struct SampleViewData
+{
+	std::vector<SampleViewPoint> points, axes;
+	bool residuals = false;
+	uint64_t generation = 0;
+};
+
+// Running statistics of a verification, see StartVerification.
+struct VerifyMetrics
+{
+	bool valid = false;
+	size_t samples = 0;
+	double positionError = 0; // RMS spread of the target in the reference's frame, meters.
+	double rotationError = 0; // RMS angle of the relative rotation around its mean, degrees.
+	double drift = 0; // Speed the target moves at in the reference's frame, cm/s.
+	double rotated = 0; // Largest rotation of the reference from where it started, degrees.
 };
 
 struct CalibrationContext
@@ -18,36 +144,102 @@ struct CalibrationContext
 	CalibrationState state = CalibrationState::None;
 	uint32_t referenceID, targetID;
 
-	Eigen::Vector3d calibratedRotation;
-	Eigen::Vector3d calibratedTranslation;
+	// As the driver applies them. Euler angles are only for the profile editor and the profile
+	// on disk, converting on every pass would cost trig per target system.
+	Eigen::Quaterniond calibratedRotation;
+	Eigen::Vector3d calibratedTranslation; // cm
 	double calibratedScale;
 
-	std::string referenceTrackingSystem;
-	std::string targetTrackingSystem;
+	// Seconds the reference system shows a motion after the target system does, as estimated in
+	// the last calibration from the captured poses. Negative when the target is the slower one.
+	double targetLatency = 0;
+
+	StringID referenceTrackingSystem = NoString;
+	StringID targetTrackingSystem = NoString;
+	StringID targetParentSystem = NoString; // As TargetProfile::parentSystem, for the selected target.
+
+	// Another calibrated target system to measure the selected target against in the next
+	// calibration, for systems that share no device with the reference. NoString for the reference.
+	StringID calibrateAgainst = NoString;
+
+	// Calibrations of the other target systems sharing the reference, applied alongside the
+	// selected target, which lives in the calibrated* fields above and validProfile.
+	std::vector<TargetProfile> otherTargets;
+
+	// Devices of further target systems, at most one per system, calibrated in the same session
+	// as targetID from the same motion. Their results go to otherTargets.
+	std::vector<uint32_t> extraTargetIDs;
+
+	// More devices of the reference's system held rigidly with the reference device, e.g. the
+	// HMD together with a controller. Their poses are averaged into the reference's.
+	std::vector<uint32_t> extraReferenceIDs;
+
+	// Universe of the HMD the profile belongs to, 0 when it's not known, e.g. from older profiles.
+	uint64_t universeID = 0;
+	std::vector<UniverseProfile> otherUniverses;
+
+	// Per-device refinements keyed by interned serial, e.g. for trackers that shift in their mounts.
+	std::unordered_map<StringID, DeviceOffset> deviceOffsets;
 
 	bool enabled = false;
 	bool validProfile = false;
-	double timeLastTick = 0, timeLastScan = 0;
+	bool driverConnected = false; // The calibration thread reconnects in the background while this is false.
+	bool recordSamples = false; // Writes every accepted sample to a file for offline replay, see SampleFile.h.
+	size_t checkpointSamples = 0; // Of a session cut off before its solve, which ResumeCalibration picks up. 0 if there's none.
+	bool exportResiduals = false; // Writes each calibration's per-sample errors to a CSV file, see ResidualFile.h.
+	bool lowMemory = false; // Frees GL resources, UI caches and session buffers soon after the UI is hidden. The UI thread's.
+	bool vsyncAlignedPoses = false; // Polls poses predicted to the next frame's photons instead of to now.
+	bool estimateScale = false; // Solves for calibratedScale too, for systems that disagree on how long a meter is.
+	bool gravityAligned = false; // Solves only yaw and translation, for systems that agree on which way is up.
+	int robustLoss = 0; // The translation solve's RobustLoss, see CalibrationSolver.h. 0 is plain least squares.
+	bool compareSolvers = false; // Also solves each calibration's samples the other ways the settings allow, and logs how they compare.
+	bool driverContinuous = false; // Continuous calibration runs inside the driver, this only folds its corrections into the profile.
+	bool autoSelectDevices = false; // Watches the idle devices for a reference and target pair moving together.
+	bool latencyCompensation = false; // The driver shifts target devices by targetLatency, so they move in step with the reference.
+	double transformTransition = 0.5; // Seconds the driver takes to blend a device into a changed transform, 0 snaps.
+	double chaperoneTolerance = 0; // cm copied bounds may be simplified by, see SimplifyChaperone. 0 keeps every quad.
+
+	// Serial of the device every station of a venue sees, which the play space is aligned to for
+	// co-location, see StartAnchorAlignment. A setting of the station, not part of the profile.
+	StringID anchorSerial = NoString;
+
+	// Only for this run, NetworkPoses is started by the UI along with it.
+	NetworkPoseRole networkPoseRole = NetworkPoseRole::None;
+
+	// A tracker on a motion platform, whose motion the driver takes out of the HMD's tracking
+	// system from the neutral pose on, see SetMotionRig. Only for this run.
+	uint32_t motionRigID = vr::k_unTrackedDeviceIndexInvalid;
+	vr::HmdVector3d_t motionNeutralTranslation = { 0, 0, 0 };
+	vr::HmdQuaternion_t motionNeutralRotation = { 1, 0, 0, 0 };
+
+	// A device on the same body part as another, e.g. a tracker strapped to an inside-out
+	// controller, which the driver fuses with that source's tracking or stands the source in for
+	// through the offset between them, see SetDeviceLink. Only for this run.
+	uint32_t linkedID = vr::k_unTrackedDeviceIndexInvalid;
+	uint32_t linkSourceID = vr::k_unTrackedDeviceIndexInvalid;
+	DeviceLinkMode linkMode = DeviceLinkMode::Fuse;
+	vr::HmdVector3d_t linkOffsetTranslation = { 0, 0, 0 };
+	vr::HmdQuaternion_t linkOffsetRotation = { 1, 0, 0, 0 };
+	double positionError = -1; // RMS error of the last accepted solve in meters, negative before one this run.
+	int64_t profileSavedTime = 0; // Unix seconds, 0 while unknown.
+	double timeLastTick = 0;
 	double wantedUpdateInterval = 1.0;
 
 	enum Speed
 	{
 		FAST = 0,
 		SLOW = 1,
-		VERY_SLOW = 2
+		VERY_SLOW = 2,
+		CUSTOM = 3, // customSampleCount
+		ADAPTIVE = 4 // Collects until the solve converges, see MaxSampleCount.
 	};
 	Speed calibrationSpeed = FAST;
+	size_t customSampleCount = 250; // Clamped to MinCustomSampleCount and MaxCustomSampleCount.
 
 	vr::TrackedDevicePose_t devicePoses[vr::k_unMaxTrackedDeviceCount];
+	double devicePosePrediction = 0; // Seconds ahead of the poll that devicePoses are predicted to.
 
-	struct Chaperone
-	{
-		bool valid = false;
-		bool autoApply = true;
-		std::vector<vr::HmdQuad_t> geometry;
-		vr::HmdMatrix34_t standingCenter;
-		vr::HmdVector2_t playSpaceSize;
-	} chaperone;
+	ChaperoneProfile chaperone;
 
 	void Clear()
 	{
@@ -56,68 +248,167 @@ struct CalibrationContext
 		chaperone.playSpaceSize = vr::HmdVector2_t();
 		chaperone.valid = false;
 
-		calibratedRotation = Eigen::Vector3d();
-		calibratedTranslation = Eigen::Vector3d();
+		calibratedRotation = Eigen::Quaterniond::Identity();
+		calibratedTranslation = Eigen::Vector3d::Zero();
 		calibratedScale = 1.0;
-		referenceTrackingSystem = "";
-		targetTrackingSystem = "";
+		targetLatency = 0;
+		referenceTrackingSystem = NoString;
+		targetTrackingSystem = NoString;
+		targetParentSystem = NoString;
+		calibrateAgainst = NoString;
+		otherTargets.clear();
+		universeID = 0;
+		otherUniverses.clear();
+		deviceOffsets.clear();
 		enabled = false;
 		validProfile = false;
+		positionError = -1;
 	}
 
-	size_t SampleCount()
+	// The system whose device is held against the target in the next calibration.
+	StringID SessionReferenceSystem() const
 	{
-		switch (calibrationSpeed)
-		{
-		case FAST:
-			return 100;
-		case SLOW:
-			return 250;
-		case VERY_SLOW:
-			return 500;
-		}
-		return 100;
+		return calibrateAgainst != NoString ? calibrateAgainst : referenceTrackingSystem;
 	}
 
-	struct Message
+	// Known at compile time, so session buffers can be sized for the slowest preset up front.
+	static constexpr size_t PresetSampleCount(Speed speed)
 	{
-		enum Type
-		{
-			String,
-			Progress
-		} type = String;
+		return speed == VERY_SLOW ? 500 : speed == SLOW ? 250 : 100;
+	}
 
-		Message(Type type) : type(type) { }
+	static const size_t MinCustomSampleCount = 50, MaxCustomSampleCount = 2500;
 
-		std::string str;
-		int progress, target;
-	};
+	// Adaptive continuous calibration uses a Slow window.
+	size_t SampleCount() const
+	{
+		switch (calibrationSpeed)
+		{
+		case CUSTOM:
+			if (customSampleCount < MinCustomSampleCount)
+				return MinCustomSampleCount;
+			return customSampleCount > MaxCustomSampleCount ? MaxCustomSampleCount : customSampleCount;
+		case ADAPTIVE:
+			return PresetSampleCount(SLOW);
+		default:
+			return PresetSampleCount(calibrationSpeed);
+		}
+	}
 
-	std::vector<Message> messages;
+	MessageLog messages;
+	CollectionMetrics collection;
+	SampleViewData sampleView;
+	VerifyMetrics verify;
+	VerifyVerdict verifyVerdict = VerifyVerdict::None;
 
 	void Log(const std::string &msg)
 	{
-		if (messages.empty() || messages.back().type == Message::Progress)
-			messages.push_back(Message(Message::String));
-
-		messages.back().str += msg;
-		std::cerr << msg;
+		messages.Append(msg);
+		Events.Text(msg);
 	}
 
 	void Progress(int current, int target)
 	{
-		if (messages.empty() || messages.back().type == Message::String)
-			messages.push_back(Message(Message::Progress));
-
-		messages.back().progress = current;
-		messages.back().target = target;
+		messages.Progress(current, target);
 	}
 };
 
 extern CalibrationContext CalCtx;
 
+static constexpr size_t MaxPresetSampleCount = CalibrationContext::PresetSampleCount(CalibrationContext::VERY_SLOW);
+
 void InitCalibrator();
 void CalibrationTick(double time);
+
+/**
+ * CalibrationTick runs on its own thread between these calls. The thread starts with
+ * InitCalibrator and LoadProfile, so the profile reaches the driver while the UI is still
+ * being set up. Anything else touching CalCtx, the device registry or the driver connection
+ * meanwhile must hold CalibrationMutex. onTick is called after every tick with the mutex
+ * still held.
+ */
+extern std::mutex CalibrationMutex;
+void StartCalibrationThread(double (*clock)(), void (*onTick)());
+void StopCalibrationThread();
+
+// Rethrows the error that stopped the thread, if any.
+void CheckCalibrationThread();
+
+// Round trip times of the driver connection by protocol::RequestType, hold CalibrationMutex.
+const struct RequestLatency &DriverRequestLatency(uint32_t requestType);
+
+namespace protocol { struct DriverStats; struct DevicePoseRate; }
+
+// The driver's statistics are only polled, every couple of seconds, while something keeps
+// calling WantDriverStats. Rates come from comparing the last two snapshots, which exist once
+// DriverStatsSnapshots returns true. Hold CalibrationMutex for both.
+void WantDriverStats();
+bool DriverStatsSnapshots(const protocol::DriverStats *&previous, const protocol::DriverStats *&latest);
+
+// How steadily a device's poses reach the driver, from the latest snapshot. False without one,
+// or if the driver doesn't support protocol::CapabilityPoseRates.
+bool DriverPoseRate(uint32_t openVRID, protocol::DevicePoseRate &rate);
+
+// Ticks right away instead of waiting out the current interval.
+void WakeCalibrationThread();
+
+// Pulses the devices in the mask for half a second from the calibration thread, so the UI
+// neither waits for it nor renders meanwhile. Hold CalibrationMutex.
+void IdentifyDevices(uint64_t deviceMask);
+
 void StartCalibration();
+
+// Frees the buffers kept for the next session while none runs, see lowMemory. Hold CalibrationMutex.
+void TrimCalibrationMemory(CalibrationContext &ctx);
+
+// Starts a calibration with the samples of the session that was cut off, see checkpointSamples,
+// and collects only the rest. The selected devices must be the ones it calibrated.
+bool ResumeCalibration();
+void SelectTargetSystem(StringID trackingSystem);
+
+// Exchanges the universe specific part of the profile with the stored one.
+void SwapUniverseProfile(CalibrationContext &ctx, UniverseProfile &profile);
+
+// The reference and target devices that autoSelectDevices found moving together, hold CalibrationMutex.
+bool AutoSelectedDevices(uint32_t &referenceID, uint32_t &targetID, double &correlation);
+
+// Call after the editor changed the profile. The change goes to the devices in the mask right
+// away, and the profile is saved once there have been no edits for a moment.
+void ProfileEdited(uint64_t deviceMask);
+const DeviceOffset *FindDeviceOffset(const CalibrationContext &ctx, uint32_t id);
+
+// Compensates the platform's motion with the rig tracker, taking where it is now as neutral, or
+// stops with an invalid ID. Returns false when the tracker isn't tracking. Hold CalibrationMutex.
+bool SetMotionRig(uint32_t rigID);
+
+// Links the device to the source on the same body part, taking how they are placed now as the
+// offset, or stops with an invalid ID. Returns false when either isn't tracking. Hold
+// CalibrationMutex.
+bool SetDeviceLink(uint32_t linkedID, uint32_t sourceID, DeviceLinkMode mode);
+bool StartContinuousCalibration();
+void StopContinuousCalibration();
+
+// Checks the active profile in a few seconds instead of recalibrating: the user moves the
+// reference and target held together, and the verdict lands in verifyVerdict.
+bool StartVerification();
+
+// Measures the anchorSerial device for a couple of seconds while it rests, then moves the
+// standing zero pose onto it, see AnchorStandingZero, keeping the bounds where they are. The
+// outcome is logged and reported to the publishing station. Hold CalibrationMutex.
+bool StartAnchorAlignment();
+bool AnchorAlignmentRunning();
 void LoadChaperoneBounds();
-void ApplyChaperoneBounds();
\ No newline at end of file
+// Returns true if the live chaperone differed from the profile and was committed.
+bool ApplyChaperoneBounds();
+
+// Replays a recorded sample file through the solver and prints timings, returns the exit code.
+int RunCalibrationBenchmark(const std::string &path);
+
+// Solves every sample file in a directory with each solver, spread over all cores, and prints
+// each one's error and timing next to the solvers' medians. Returns the exit code.
+int RunBatchCalibration(const std::string &directory);
+
+// Runs sessions on a simulated rig of devices, see TrackingSimulator, and prints how far each
+// solve is from the ground truth next to its time. Returns the exit code.
+struct SimulationOptions;
+int RunCalibrationSimulation(const SimulationOptions &options);
\ No newline at end of file
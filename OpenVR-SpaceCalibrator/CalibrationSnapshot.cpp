@@ -0,0 +1,88 @@
+#include "stdafx.h"
+#include "CalibrationSnapshot.h"
+#include "DeviceRegistry.h"
+
+#include <atomic>
+
+static std::shared_ptr<const CalibrationSnapshot> Published = std::make_shared<const CalibrationSnapshot>();
+
+struct CalibrationCommand
+{
+	std::function<bool(CalibrationContext &ctx)> run;
+	std::shared_ptr<CalibrationCommandResult> result;
+	CalibrationCommand *next;
+};
+
+static uint64_t CommandsCompleted = 0; // Calibration thread only.
+
+// Newest first, the tick reverses it into posting order.
+static std::atomic<CalibrationCommand *> PostedCommands(nullptr);
+
+bool CalibrationSnapshot::SameState(const CalibrationSnapshot &other) const
+{
+	return state == other.state && validProfile == other.validProfile && hasOtherTargets == other.hasOtherTargets &&
+		enabled == other.enabled && driverConnected == other.driverConnected && chaperoneValid == other.chaperoneValid &&
+		dashboardActive == other.dashboardActive && quitRequested == other.quitRequested &&
+		deviceGeneration == other.deviceGeneration && messageGeneration == other.messageGeneration &&
+		commandsCompleted == other.commandsCompleted;
+}
+
+std::shared_ptr<const CalibrationSnapshot> LatestCalibrationSnapshot()
+{
+	return std::atomic_load(&Published);
+}
+
+void PublishCalibrationSnapshot(const CalibrationContext &ctx)
+{
+	CalibrationSnapshot next;
+	next.state = ctx.state;
+	next.validProfile = ctx.validProfile;
+	next.hasOtherTargets = !ctx.otherTargets.empty();
+	next.enabled = ctx.enabled;
+	next.driverConnected = ctx.driverConnected;
+	next.chaperoneValid = ctx.chaperone.valid;
+	next.dashboardActive = Devices.dashboardActive;
+	next.quitRequested = Devices.quitRequested;
+	next.deviceGeneration = Devices.generation;
+	next.messageGeneration = ctx.messages.Generation();
+	next.commandsCompleted = CommandsCompleted;
+
+	// Only this thread publishes, so the current version can be read without the atomic load.
+	if (next.SameState(*Published))
+		return;
+
+	next.version = Published->version + 1;
+	std::atomic_store(&Published, std::shared_ptr<const CalibrationSnapshot>(std::make_shared<CalibrationSnapshot>(next)));
+}
+
+std::shared_ptr<const CalibrationCommandResult> PostCalibrationCommand(std::function<bool(CalibrationContext &ctx)> command)
+{
+	auto result = std::make_shared<CalibrationCommandResult>();
+	auto posted = new CalibrationCommand{ std::move(command), result, PostedCommands.load(std::memory_order_relaxed) };
+	while (!PostedCommands.compare_exchange_weak(posted->next, posted, std::memory_order_release, std::memory_order_relaxed))
+		;
+	WakeCalibrationThread();
+	return result;
+}
+
+void RunCalibrationCommands(CalibrationContext &ctx)
+{
+	CalibrationCommand *posted = PostedCommands.exchange(nullptr, std::memory_order_acquire);
+	CalibrationCommand *ordered = nullptr;
+	while (posted)
+	{
+		auto next = posted->next;
+		posted->next = ordered;
+		ordered = posted;
+		posted = next;
+	}
+
+	while (ordered)
+	{
+		std::unique_ptr<CalibrationCommand> command(ordered);
+		ordered = ordered->next;
+		bool succeeded = command->run(ctx);
+		command->result->status.store((int) (succeeded ? CommandStatus::Succeeded : CommandStatus::Failed), std::memory_order_release);
+		CommandsCompleted++;
+	}
+}
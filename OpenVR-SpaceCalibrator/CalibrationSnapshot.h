@@ -0,0 +1,63 @@
+#pragma once
+
+#include "Calibration.h"
+
+#include <atomic>
+#include <functional>
+#include <memory>
+
+// What the calibration thread last published about itself, never changed once published.
+struct CalibrationSnapshot
+{
+	uint64_t version = 0; // Counts publishes that changed something, from 1.
+	CalibrationState state = CalibrationState::None;
+	bool validProfile = false, hasOtherTargets = false, enabled = false, driverConnected = false;
+	bool chaperoneValid = false, dashboardActive = false, quitRequested = false;
+	uint32_t deviceGeneration = 0; // DeviceRegistry::generation
+	uint64_t messageGeneration = 0; // MessageLog::Generation
+	uint64_t commandsCompleted = 0; // So a finished command wakes whoever waits for it.
+
+	// Ignoring version.
+	bool SameState(const CalibrationSnapshot &other) const;
+};
+
+/**
+ * Lets other threads follow the calibration and drive it without CalibrationMutex. After every
+ * tick the calibration thread publishes a new snapshot if anything in it changed, swapping in
+ * the pointer RCU-style: readers keep whichever version they loaded for as long as they hold
+ * it, and never see one being written. Commands go the other way, through a lock-free list
+ * that the next tick runs in the order they were posted, with the mutex it holds anyway, and
+ * posting wakes the thread so they run right away. Commands doing OpenVR or driver calls, which
+ * may block, are best posted so a button press never stalls a frame.
+ *
+ * The main window still reads and writes CalCtx with the mutex held while it's built. What
+ * moves to snapshots and commands no longer needs it.
+ */
+std::shared_ptr<const CalibrationSnapshot> LatestCalibrationSnapshot();
+
+enum class CommandStatus
+{
+	Pending,
+	Succeeded,
+	Failed, // The command returned false.
+};
+
+// Completes once the calibration thread ran the command, any thread may poll it.
+class CalibrationCommandResult
+{
+public:
+	CommandStatus Status() const { return (CommandStatus) status.load(std::memory_order_acquire); }
+	bool Done() const { return Status() != CommandStatus::Pending; }
+
+private:
+	friend void RunCalibrationCommands(CalibrationContext &ctx);
+	std::atomic<int> status{ (int) CommandStatus::Pending };
+};
+
+// Runs on the calibration thread at the start of its next tick. The command returns whether it
+// succeeded, e.g. StartContinuousCalibration's result.
+std::shared_ptr<const CalibrationCommandResult> PostCalibrationCommand(std::function<bool(CalibrationContext &ctx)> command);
+
+// From the calibration thread with CalibrationMutex held.
+void PublishCalibrationSnapshot(const CalibrationContext &ctx);
+void RunCalibrationCommands(CalibrationContext &ctx);
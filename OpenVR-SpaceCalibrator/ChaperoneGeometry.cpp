@@ -0,0 +1,117 @@
+#include "stdafx.h"
+#include "ChaperoneGeometry.h"
+
+#include <Eigen/Core>
+#include <algorithm>
+#include <utility>
+
+// Edges closer than this are taken as shared, scanned rooms repeat corners exactly anyway.
+static const double SharedEdgeDistance = 0.0001; // meters
+
+static Eigen::Vector3d Corner(const vr::HmdVector3_t &corner)
+{
+	return Eigen::Vector3d(corner.v[0], corner.v[1], corner.v[2]);
+}
+
+static bool SameCorner(const vr::HmdVector3_t &a, const vr::HmdVector3_t &b)
+{
+	return (Corner(a) - Corner(b)).squaredNorm() <= SharedEdgeDistance * SharedEdgeDistance;
+}
+
+static double SegmentDistance(const Eigen::Vector3d &p, const Eigen::Vector3d &a, const Eigen::Vector3d &b)
+{
+	Eigen::Vector3d ab = b - a;
+	double length = ab.squaredNorm();
+	double t = length > 0.0 ? std::min(std::max((p - a).dot(ab) / length, 0.0), 1.0) : 0.0;
+	return (a + t * ab - p).norm();
+}
+
+// An edge across the wall: corners 0 and 1 of the quad starting there, 3 and 2 of one ending there.
+struct WallEdge
+{
+	vr::HmdVector3_t first, second;
+};
+
+static double EdgeDistance(const WallEdge &edge, const WallEdge &a, const WallEdge &b)
+{
+	return std::max(
+		SegmentDistance(Corner(edge.first), Corner(a.first), Corner(b.first)),
+		SegmentDistance(Corner(edge.second), Corner(a.second), Corner(b.second)));
+}
+
+// Iterative, a wall of thousands of quads would recurse too deep. A closed loop starts and ends
+// on the same edge, its first split is then the edge farthest from that one.
+static void SimplifyWall(const std::vector<WallEdge> &edges, double tolerance, std::vector<vr::HmdQuad_t> &out)
+{
+	std::vector<bool> keep(edges.size(), false);
+	keep.front() = keep.back() = true;
+
+	std::vector<std::pair<size_t, size_t>> spans = { { 0, edges.size() - 1 } };
+	while (!spans.empty())
+	{
+		auto span = spans.back();
+		spans.pop_back();
+
+		size_t farthest = span.first;
+		double distance = 0.0;
+		for (size_t i = span.first + 1; i < span.second; i++)
+		{
+			double d = EdgeDistance(edges[i], edges[span.first], edges[span.second]);
+			if (d > distance)
+			{
+				farthest = i;
+				distance = d;
+			}
+		}
+
+		if (distance > tolerance)
+		{
+			keep[farthest] = true;
+			spans.push_back({ span.first, farthest });
+			spans.push_back({ farthest, span.second });
+		}
+	}
+
+	size_t start = 0;
+	for (size_t i = 1; i < edges.size(); i++)
+	{
+		if (!keep[i])
+			continue;
+
+		vr::HmdQuad_t quad;
+		quad.vCorners[0] = edges[start].first;
+		quad.vCorners[1] = edges[start].second;
+		quad.vCorners[2] = edges[i].second;
+		quad.vCorners[3] = edges[i].first;
+		out.push_back(quad);
+		start = i;
+	}
+}
+
+void SimplifyChaperone(std::vector<vr::HmdQuad_t> &quads, double tolerance)
+{
+	if (tolerance <= 0.0 || quads.size() < 2)
+		return;
+
+	std::vector<vr::HmdQuad_t> simplified;
+	std::vector<WallEdge> edges;
+	size_t begin = 0;
+	while (begin < quads.size())
+	{
+		size_t end = begin + 1;
+		while (end < quads.size() &&
+			SameCorner(quads[end - 1].vCorners[3], quads[end].vCorners[0]) &&
+			SameCorner(quads[end - 1].vCorners[2], quads[end].vCorners[1]))
+			end++;
+
+		edges.clear();
+		for (size_t i = begin; i < end; i++)
+			edges.push_back({ quads[i].vCorners[0], quads[i].vCorners[1] });
+		edges.push_back({ quads[end - 1].vCorners[3], quads[end - 1].vCorners[2] });
+
+		SimplifyWall(edges, tolerance, simplified);
+		begin = end;
+	}
+
+	quads.swap(simplified);
+}
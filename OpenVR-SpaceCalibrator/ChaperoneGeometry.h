@@ -0,0 +1,13 @@
+#pragma once
+
+#include <openvr.h>
+#include <vector>
+
+/**
+ * Thins out chaperone walls with Douglas-Peucker. Quads that continue one another, the end edge
+ * of one being the start edge of the next, form a wall polyline whose vertices are their shared
+ * edges. Vertices are dropped while both the floor and the top corner of every dropped edge stay
+ * within tolerance meters of the quad that replaces its run. Walls that don't continue one
+ * another are simplified on their own, so gaps and separate loops stay as they are.
+ */
+void SimplifyChaperone(std::vector<vr::HmdQuad_t> &quads, double tolerance);
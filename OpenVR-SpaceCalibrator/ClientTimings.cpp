@@ -0,0 +1,65 @@
+#include "stdafx.h"
+#include "ClientTimings.h"
+
+#include <algorithm>
+
+ClientTimings Timings;
+
+static double QueryCounterFrequency()
+{
+	LARGE_INTEGER value;
+	QueryPerformanceFrequency(&value);
+	return (double) value.QuadPart;
+}
+
+// Both threads record timings, a function local static is initialized only once either way.
+static double CounterFrequency()
+{
+	static const double frequency = QueryCounterFrequency();
+	return frequency;
+}
+
+void TimingHistory::Add(double seconds)
+{
+	ms[next] = (float) (seconds * 1000.0);
+	next = (next + 1) % Length;
+	count = std::min(count + 1, Length);
+}
+
+float TimingHistory::Mean() const
+{
+	if (!count)
+		return 0.0f;
+
+	float total = 0;
+	for (size_t i = 0; i < count; i++)
+		total += ms[i];
+	return total / count;
+}
+
+float TimingHistory::Max() const
+{
+	return count ? *std::max_element(ms, ms + count) : 0.0f;
+}
+
+const char *TimingSectionName(TimingSection section)
+{
+	static const char *const names[] = {
+		"Calibration tick", "Device list", "UI build", "UI render", "Window blit", "Overlay submit", "Profile apply",
+	};
+	return names[(size_t) section];
+}
+
+ScopedTiming::ScopedTiming(TimingSection section) : section(section)
+{
+	LARGE_INTEGER now;
+	QueryPerformanceCounter(&now);
+	start = now.QuadPart;
+}
+
+ScopedTiming::~ScopedTiming()
+{
+	LARGE_INTEGER now;
+	QueryPerformanceCounter(&now);
+	Timings[section].Add((now.QuadPart - start) / CounterFrequency());
+}
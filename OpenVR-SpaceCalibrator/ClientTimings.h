@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstddef>
+
+// The last Length durations of something, in milliseconds, as a ring ImGui can plot directly.
+struct TimingHistory
+{
+	static const size_t Length = 120;
+
+	float ms[Length] = { 0 };
+	size_t next = 0, count = 0;
+
+	void Add(double seconds);
+	float Mean() const;
+	float Max() const;
+	float Last() const { return count ? ms[(next + Length - 1) % Length] : 0.0f; }
+
+	// values_offset for ImGui::PlotHistogram, so the plot runs oldest to newest.
+	int PlotOffset() const { return count < Length ? 0 : (int) next; }
+};
+
+enum class TimingSection
+{
+	CalibrationTick,
+	LoadVRState,
+	BuildUI,
+	RenderUI,
+	Blit,
+	SubmitOverlay,
+	ProfileApply,
+	Count
+};
+
+// What one ApplyProfile may take, from an edit or a device change to the transforms written
+// into the driver's table. DriverBenchmark's apply mode holds the rest of the way, from the
+// table to the next pose, to the same budget.
+const double ProfileApplyBudget = 0.001; // seconds
+
+const char *TimingSectionName(TimingSection section);
+
+/**
+ * CPU time of the client's own work per loop, for the timings panel. CalibrationTick,
+ * LoadVRState and ProfileApply are recorded with CalibrationMutex held, everything else on the
+ * UI thread, and the panel reads them on the UI thread with the mutex held. ProfileApply counts
+ * each apply, whether a tick or an edit in the UI ran it.
+ */
+struct ClientTimings
+{
+	TimingHistory sections[(size_t) TimingSection::Count];
+
+	TimingHistory &operator[](TimingSection section) { return sections[(size_t) section]; }
+	const TimingHistory &operator[](TimingSection section) const { return sections[(size_t) section]; }
+};
+
+extern ClientTimings Timings;
+
+// Adds the time until the end of the scope to a section, one QueryPerformanceCounter call at each end.
+class ScopedTiming
+{
+public:
+	explicit ScopedTiming(TimingSection section);
+	~ScopedTiming();
+
+private:
+	TimingSection section;
+	long long start;
+};
@@ -1,13 +1,23 @@
 #include "stdafx.h"
 #include "Configuration.h"
+#include "ProfileStore.h"
+#include "ProfileSync.h"
+#include "../CalibrationSolver/CalibrationSolver.h"
 
 #include <picojson.h>
 
 #include <string>
 #include <iostream>
+#include <iterator>
 #include <fstream>
+#include <sstream>
 #include <iomanip>
 #include <limits>
+#include <memory>
+#include <vector>
+#include <cstring>
+#include <cstddef>
+#include <ctime>
 
 static picojson::array FloatArray(const float *buf, int numFloats)
 {
@@ -19,102 +29,566 @@ static picojson::array FloatArray(const float *buf, int numFloats)
 	return arr;
 }
 
-static void LoadFloatArray(const picojson::value &obj, float *buf, int numFloats)
+// Anything with a calibration in it, in this universe or another.
+static bool HasProfile(const CalibrationContext &ctx)
 {
-	if (!obj.is<picojson::array>())
-		throw std::runtime_error("expected array, got " + obj.to_str());
+	return ctx.validProfile || !ctx.otherTargets.empty() || !ctx.otherUniverses.empty();
+}
 
-	auto &arr = obj.get<picojson::array>();
-	if (arr.size() != numFloats)
-		throw std::runtime_error("wrong buffer size");
+// Speeds a newer version added fall back to Fast.
+static CalibrationContext::Speed SpeedFromProfile(int speed)
+{
+	if (speed < CalibrationContext::FAST || speed > CalibrationContext::ADAPTIVE)
+		return CalibrationContext::FAST;
+	return (CalibrationContext::Speed) speed;
+}
 
-	for (int i = 0; i < numFloats; i++)
-		buf[i] = (float) arr[i].get<double>();
+/**
+ * Profiles are read with picojson's streaming parser instead of into a picojson::value. Each
+ * context below takes one JSON element and writes it straight into the CalibrationContext,
+ * keys this version doesn't know are skipped without being stored, and the chaperone geometry
+ * goes into the profile's own buffer, which keeps its capacity from one load to the next. A
+ * value of the wrong type throws, naming its key.
+ */
+class JsonField
+{
+public:
+	explicit JsonField(const char *key) : key(key) { }
+
+	bool set_null() { return Unexpected("null"); }
+	bool set_bool(bool) { return Unexpected("a boolean"); }
+	bool set_number(double) { return Unexpected("a number"); }
+	template <typename Iter> bool parse_string(picojson::input<Iter> &) { return Unexpected("a string"); }
+	bool parse_array_start() { return Unexpected("an array"); }
+	template <typename Iter> bool parse_array_item(picojson::input<Iter> &, size_t) { return false; }
+	bool parse_array_stop(size_t) { return true; }
+	bool parse_object_start() { return Unexpected("an object"); }
+	template <typename Iter> bool parse_object_item(picojson::input<Iter> &, const std::string &) { return false; }
+
+protected:
+	bool Unexpected(const char *what) const
+	{
+		throw std::runtime_error(std::string(key) + " can't be " + what);
+	}
+
+	const char *key;
+};
+
+class NumberField : public JsonField
+{
+public:
+	NumberField(const char *key, double &out) : JsonField(key), out(out) { }
+	bool set_number(double value) { out = value; return true; }
+
+private:
+	double &out;
+};
+
+class BoolField : public JsonField
+{
+public:
+	BoolField(const char *key, bool &out) : JsonField(key), out(out) { }
+	bool set_bool(bool value) { out = value; return true; }
+
+private:
+	bool &out;
+};
+
+class StringField : public JsonField
+{
+public:
+	StringField(const char *key, std::string &out) : JsonField(key), out(out) { }
+
+	template <typename Iter> bool parse_string(picojson::input<Iter> &in)
+	{
+		out.clear();
+		return picojson::_parse_string(out, in);
+	}
+
+private:
+	std::string &out;
+};
+
+template <typename Field, typename Iter, typename Out>
+static bool ParseField(picojson::input<Iter> &in, const std::string &key, Out &out)
+{
+	Field field(key.c_str(), out);
+	return picojson::_parse(field, in);
 }
 
-static void ParseProfile(CalibrationContext &ctx, std::istream &stream)
+template <typename Iter>
+static bool SkipValue(picojson::input<Iter> &in)
 {
-	picojson::value v;
-	std::string err = picojson::parse(v, stream);
-	if (!err.empty())
-		throw std::runtime_error(err);
+	picojson::null_parse_context skip;
+	return picojson::_parse(skip, in);
+}
 
-	auto arr = v.get<picojson::array>();
-	if (arr.size() < 1)
-		throw std::runtime_error("no profiles in file");
+// An array of exactly count numbers.
+class FloatsField : public JsonField
+{
+public:
+	FloatsField(const char *key, float *out, size_t count) : JsonField(key), out(out), count(count) { }
 
-	auto obj = arr[0].get<picojson::object>();
+	bool parse_array_start() { return true; }
 
-	ctx.referenceTrackingSystem = obj["reference_tracking_system"].get<std::string>();
-	ctx.targetTrackingSystem = obj["target_tracking_system"].get<std::string>();
-	ctx.calibratedRotation(0) = obj["roll"].get<double>();
-	ctx.calibratedRotation(1) = obj["yaw"].get<double>();
-	ctx.calibratedRotation(2) = obj["pitch"].get<double>();
-	ctx.calibratedTranslation(0) = obj["x"].get<double>();
-	ctx.calibratedTranslation(1) = obj["y"].get<double>();
-	ctx.calibratedTranslation(2) = obj["z"].get<double>();
+	template <typename Iter> bool parse_array_item(picojson::input<Iter> &in, size_t index)
+	{
+		if (index >= count)
+			throw std::runtime_error(std::string("too many values for ") + key);
 
-	if (obj["scale"].is<double>())
-		ctx.calibratedScale = obj["scale"].get<double>();
-	else
-		ctx.calibratedScale = 1.0;
+		double value;
+		if (!ParseField<NumberField>(in, key, value))
+			return false;
+		out[index] = (float) value;
+		return true;
+	}
+
+	bool parse_array_stop(size_t size)
+	{
+		if (size != count)
+			throw std::runtime_error(std::string("too few values for ") + key);
+		return true;
+	}
 
-	if (obj["calibration_speed"].is<double>())
-		ctx.calibrationSpeed = (CalibrationContext::Speed)(int) obj["calibration_speed"].get<double>();
+private:
+	float *out;
+	size_t count;
+};
 
-	if (obj["chaperone"].is<picojson::object>())
+// The chaperone's quads as a flat array of their corners' coordinates.
+class GeometryField : public JsonField
+{
+public:
+	GeometryField(const char *key, std::vector<vr::HmdQuad_t> &out) : JsonField(key), out(out) { }
+
+	bool parse_array_start()
 	{
-		auto chaperone = obj["chaperone"].get<picojson::object>();
-		ctx.chaperone.autoApply = chaperone["auto_apply"].get<bool>();
+		out.clear();
+		return true;
+	}
 
-		LoadFloatArray(chaperone["play_space_size"], ctx.chaperone.playSpaceSize.v, 2);
+	template <typename Iter> bool parse_array_item(picojson::input<Iter> &in, size_t index)
+	{
+		if (index % QuadFloats == 0)
+			out.emplace_back();
 
-		LoadFloatArray(
-			chaperone["standing_center"],
-			(float *) ctx.chaperone.standingCenter.m,
-			sizeof(ctx.chaperone.standingCenter.m) / sizeof(float)
-		);
+		double value;
+		if (!ParseField<NumberField>(in, key, value))
+			return false;
+		((float *) out.data())[index] = (float) value;
+		return true;
+	}
 
-		if (!chaperone["geometry"].is<picojson::array>())
-			throw std::runtime_error("chaperone geometry is not an array");
+	bool parse_array_stop(size_t size)
+	{
+		if (size % QuadFloats != 0)
+			throw std::runtime_error("chaperone geometry ends in the middle of a quad");
+		return true;
+	}
 
-		auto &geometry = chaperone["geometry"].get<picojson::array>();
+private:
+	static const size_t QuadFloats = sizeof(vr::HmdQuad_t) / sizeof(float);
+	std::vector<vr::HmdQuad_t> &out;
+};
 
-		if (geometry.size() > 0)
+// Roll, yaw and pitch in degrees and x, y and z in cm, which profiles, other targets and
+// device offsets all need.
+class TransformFields
+{
+public:
+	// Whether key is one of them, with ok telling if its value parsed.
+	template <typename Iter> bool Parse(picojson::input<Iter> &in, const std::string &key, bool &ok)
+	{
+		static const char *const Keys[] = { "roll", "yaw", "pitch", "x", "y", "z" };
+		for (int i = 0; i < 6; i++)
 		{
-			ctx.chaperone.geometry.resize(geometry.size() * sizeof(float) / sizeof(ctx.chaperone.geometry[0]));
-			LoadFloatArray(chaperone["geometry"], (float *) ctx.chaperone.geometry.data(), geometry.size());
+			if (key == Keys[i])
+			{
+				seen |= 1 << i;
+				ok = ParseField<NumberField>(in, key, values[i]);
+				return true;
+			}
+		}
+		return false;
+	}
+
+	void Check(const char *what) const
+	{
+		if (seen != (1 << 6) - 1)
+			throw std::runtime_error(std::string(what) + " is missing part of its transform");
+	}
+
+	Eigen::Vector3d Euler() const { return Eigen::Vector3d(values[0], values[1], values[2]); }
+	Eigen::Vector3d Translation() const { return Eigen::Vector3d(values[3], values[4], values[5]); }
+
+private:
+	double values[6] = { 0 };
+	unsigned seen = 0;
+};
+
+// An array of objects, each parsed by an Element that adds itself to out once it's complete.
+template <typename Element, typename Out>
+class ObjectListField : public JsonField
+{
+public:
+	ObjectListField(const char *key, Out &out) : JsonField(key), out(out) { }
+
+	bool parse_array_start() { return true; }
+
+	template <typename Iter> bool parse_array_item(picojson::input<Iter> &in, size_t)
+	{
+		Element element(key);
+		if (!picojson::_parse(element, in))
+			return false;
+		element.Finish(out);
+		return true;
+	}
 
-			ctx.chaperone.valid = true;
+private:
+	Out &out;
+};
+
+class TargetField : public JsonField
+{
+public:
+	explicit TargetField(const char *key) : JsonField(key) { }
+
+	bool parse_object_start() { return true; }
+
+	template <typename Iter> bool parse_object_item(picojson::input<Iter> &in, const std::string &name)
+	{
+		bool ok;
+		if (transform.Parse(in, name, ok))
+			return ok;
+		if (name == "target_tracking_system")
+			return hasSystem = true, ParseField<StringField>(in, name, system);
+		if (name == "parent_tracking_system")
+			return hasParent = true, ParseField<StringField>(in, name, parent);
+		if (name == "scale")
+			return hasScale = true, ParseField<NumberField>(in, name, profile.scale);
+		return SkipValue(in);
+	}
+
+	void Finish(std::vector<TargetProfile> &targets)
+	{
+		if (!hasSystem || !hasScale)
+			throw std::runtime_error("other target is missing its tracking system or scale");
+		transform.Check("other target");
+
+		profile.trackingSystem = Intern(system);
+		if (hasParent)
+			profile.parentSystem = Intern(parent);
+		profile.rotation = EulerQuat(transform.Euler());
+		profile.translation = transform.Translation();
+		targets.push_back(profile);
+	}
+
+private:
+	TargetProfile profile;
+	TransformFields transform;
+	std::string system, parent;
+	bool hasSystem = false, hasParent = false, hasScale = false;
+};
+
+class DeviceOffsetField : public JsonField
+{
+public:
+	explicit DeviceOffsetField(const char *key) : JsonField(key) { }
+
+	bool parse_object_start() { return true; }
+
+	template <typename Iter> bool parse_object_item(picojson::input<Iter> &in, const std::string &name)
+	{
+		bool ok;
+		if (transform.Parse(in, name, ok))
+			return ok;
+		if (name == "serial")
+			return hasSerial = true, ParseField<StringField>(in, name, serial);
+		return SkipValue(in);
+	}
+
+	void Finish(std::unordered_map<StringID, DeviceOffset> &offsets)
+	{
+		if (!hasSerial)
+			throw std::runtime_error("device offset is missing its serial");
+		transform.Check("device offset");
+
+		DeviceOffset offset;
+		offset.rotation = transform.Euler();
+		offset.translation = transform.Translation();
+		offsets[Intern(serial)] = offset;
+	}
+
+private:
+	TransformFields transform;
+	std::string serial;
+	bool hasSerial = false;
+};
+
+class ChaperoneField : public JsonField
+{
+public:
+	ChaperoneField(const char *key, ChaperoneProfile &chaperone) : JsonField(key), chaperone(chaperone) { }
+
+	bool parse_object_start() { return present = true; }
+
+	template <typename Iter> bool parse_object_item(picojson::input<Iter> &in, const std::string &name)
+	{
+		if (name == "auto_apply")
+			return seen |= 1, ParseField<BoolField>(in, name, chaperone.autoApply);
+		if (name == "follow_calibration")
+			return ParseField<BoolField>(in, name, chaperone.followCalibration);
+		if (name == "play_space_size")
+		{
+			FloatsField field("play_space_size", chaperone.playSpaceSize.v, 2);
+			return seen |= 2, picojson::_parse(field, in);
+		}
+		if (name == "standing_center")
+		{
+			FloatsField field("standing_center", (float *) chaperone.standingCenter.m, sizeof(chaperone.standingCenter.m) / sizeof(float));
+			return seen |= 4, picojson::_parse(field, in);
 		}
+		if (name == "geometry")
+			return seen |= 8, ParseField<GeometryField>(in, name, chaperone.geometry);
+		return SkipValue(in);
 	}
 
-	ctx.validProfile = true;
-}
+	void Finish()
+	{
+		if (!present)
+			return;
+		if (seen != 15)
+			throw std::runtime_error("chaperone is missing auto_apply, play_space_size, standing_center or geometry");
+		if (!chaperone.geometry.empty())
+			chaperone.valid = true;
+	}
 
-static void WriteProfile(CalibrationContext &ctx, std::ostream &out)
+private:
+	ChaperoneProfile &chaperone;
+	bool present = false;
+	unsigned seen = 0;
+};
+
+class ProfileField : public JsonField
 {
-	if (!ctx.validProfile)
-		return;
+public:
+	ProfileField(const char *key, CalibrationContext &ctx) : JsonField(key), ctx(ctx)
+	{
+		ctx.universeID = 0;
+		ctx.targetParentSystem = NoString;
+		ctx.calibratedScale = 1.0;
+		ctx.targetLatency = 0;
+		ctx.otherTargets.clear();
+		ctx.deviceOffsets.clear();
+	}
+
+	bool parse_object_start() { return true; }
+
+	template <typename Iter> bool parse_object_item(picojson::input<Iter> &in, const std::string &name)
+	{
+		bool ok;
+		double number;
+		if (transform.Parse(in, name, ok))
+			return ok;
+
+		if (name == "universe_id")
+			return hasUniverse = true, ParseField<StringField>(in, name, universe);
+		if (name == "reference_tracking_system")
+			return hasReference = true, ParseField<StringField>(in, name, reference);
+		if (name == "target_tracking_system")
+			return hasTarget = true, ParseField<StringField>(in, name, target);
+		if (name == "parent_tracking_system")
+			return hasParent = true, ParseField<StringField>(in, name, parent);
+		if (name == "scale")
+			return ParseField<NumberField>(in, name, ctx.calibratedScale);
+		if (name == "target_latency")
+			return ParseField<NumberField>(in, name, ctx.targetLatency);
+		if (name == "other_targets")
+			return ParseField<ObjectListField<TargetField, std::vector<TargetProfile>>>(in, name, ctx.otherTargets);
+		if (name == "device_offsets")
+			return ParseField<ObjectListField<DeviceOffsetField, std::unordered_map<StringID, DeviceOffset>>>(in, name, ctx.deviceOffsets);
+		if (name == "calibration_speed")
+		{
+			if (!ParseField<NumberField>(in, name, number))
+				return false;
+			ctx.calibrationSpeed = SpeedFromProfile((int) number);
+			return true;
+		}
+		if (name == "custom_sample_count")
+		{
+			if (!ParseField<NumberField>(in, name, number))
+				return false;
+			ctx.customSampleCount = (size_t) number;
+			return true;
+		}
+		if (name == "latency_compensation")
+			return ParseField<BoolField>(in, name, ctx.latencyCompensation);
+		if (name == "chaperone")
+		{
+			ChaperoneField field("chaperone", ctx.chaperone);
+			if (!picojson::_parse(field, in))
+				return false;
+			field.Finish();
+			return true;
+		}
+		if (name == "calibrated")
+			return ParseField<BoolField>(in, name, calibrated);
+		return SkipValue(in);
+	}
+
+	void Finish()
+	{
+		if (!hasReference || !hasTarget)
+			throw std::runtime_error("profile is missing its reference or target tracking system");
+		transform.Check("profile");
+
+		if (hasUniverse)
+			ctx.universeID = std::stoull(universe);
+		ctx.referenceTrackingSystem = Intern(reference);
+		ctx.targetTrackingSystem = Intern(target);
+		if (hasParent)
+			ctx.targetParentSystem = Intern(parent);
+		ctx.calibratedRotation = EulerQuat(transform.Euler());
+		ctx.calibratedTranslation = transform.Translation();
+
+		// Older profiles only stored a calibrated target.
+		ctx.validProfile = calibrated;
+	}
+
+private:
+	CalibrationContext &ctx;
+	TransformFields transform;
+	std::string universe, reference, target, parent;
+	bool hasUniverse = false, hasReference = false, hasTarget = false, hasParent = false;
+	bool calibrated = true;
+};
+
+// The first entry is the profile in use, any further ones are those of other universes.
+class ProfileListField : public JsonField
+{
+public:
+	explicit ProfileListField(CalibrationContext &ctx) : JsonField("profiles"), ctx(ctx) { }
 
+	bool parse_array_start()
+	{
+		ctx.otherUniverses.clear();
+		return true;
+	}
+
+	template <typename Iter> bool parse_array_item(picojson::input<Iter> &in, size_t index)
+	{
+		if (index == 0)
+		{
+			ProfileField profile(key, ctx);
+			if (!picojson::_parse(profile, in))
+				return false;
+			profile.Finish();
+			return true;
+		}
+
+		CalibrationContext stored;
+		ProfileField profile(key, stored);
+		if (!picojson::_parse(profile, in))
+			return false;
+		profile.Finish();
+
+		UniverseProfile universe;
+		SwapUniverseProfile(stored, universe);
+		ctx.otherUniverses.push_back(std::move(universe));
+		return true;
+	}
+
+	bool parse_array_stop(size_t size)
+	{
+		if (size < 1)
+			throw std::runtime_error("no profiles in file");
+		return true;
+	}
+
+private:
+	CalibrationContext &ctx;
+};
+
+static void ParseProfile(CalibrationContext &ctx, std::istream &stream)
+{
+	ProfileListField profiles(ctx);
+	std::string err;
+	picojson::_parse(profiles, std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>(), &err);
+	if (!err.empty())
+		throw std::runtime_error(err);
+}
+
+static picojson::object WriteProfileObject(const CalibrationContext &ctx)
+{
 	picojson::object profile;
-	profile["reference_tracking_system"].set<std::string>(ctx.referenceTrackingSystem);
-	profile["target_tracking_system"].set<std::string>(ctx.targetTrackingSystem);
-	profile["roll"].set<double>(ctx.calibratedRotation(0));
-	profile["yaw"].set<double>(ctx.calibratedRotation(1));
-	profile["pitch"].set<double>(ctx.calibratedRotation(2));
+	if (ctx.universeID != 0)
+		profile["universe_id"].set<std::string>(std::to_string(ctx.universeID));
+	profile["reference_tracking_system"].set<std::string>(InternedString(ctx.referenceTrackingSystem));
+	profile["target_tracking_system"].set<std::string>(InternedString(ctx.targetTrackingSystem));
+	if (ctx.targetParentSystem != NoString)
+		profile["parent_tracking_system"].set<std::string>(InternedString(ctx.targetParentSystem));
+	// Saved as Euler angles in degrees, as profiles always were.
+	Eigen::Vector3d euler = EulerFromQuat(ctx.calibratedRotation);
+	profile["roll"].set<double>(euler(0));
+	profile["yaw"].set<double>(euler(1));
+	profile["pitch"].set<double>(euler(2));
 	profile["x"].set<double>(ctx.calibratedTranslation(0));
 	profile["y"].set<double>(ctx.calibratedTranslation(1));
 	profile["z"].set<double>(ctx.calibratedTranslation(2));
 	profile["scale"].set<double>(ctx.calibratedScale);
+	profile["target_latency"].set<double>(ctx.targetLatency);
+	profile["calibrated"].set<bool>(ctx.validProfile);
+
+	if (!ctx.otherTargets.empty())
+	{
+		picojson::array targets;
+		for (auto &target : ctx.otherTargets)
+		{
+			picojson::object obj;
+			obj["target_tracking_system"].set<std::string>(InternedString(target.trackingSystem));
+			if (target.parentSystem != NoString)
+				obj["parent_tracking_system"].set<std::string>(InternedString(target.parentSystem));
+			Eigen::Vector3d targetEuler = EulerFromQuat(target.rotation);
+			obj["roll"].set<double>(targetEuler(0));
+			obj["yaw"].set<double>(targetEuler(1));
+			obj["pitch"].set<double>(targetEuler(2));
+			obj["x"].set<double>(target.translation(0));
+			obj["y"].set<double>(target.translation(1));
+			obj["z"].set<double>(target.translation(2));
+			obj["scale"].set<double>(target.scale);
+			targets.push_back(picojson::value(obj));
+		}
+		profile["other_targets"].set<picojson::array>(targets);
+	}
+
+	if (!ctx.deviceOffsets.empty())
+	{
+		picojson::array offsets;
+		for (auto &entry : ctx.deviceOffsets)
+		{
+			picojson::object obj;
+			obj["serial"].set<std::string>(InternedString(entry.first));
+			obj["roll"].set<double>(entry.second.rotation(0));
+			obj["yaw"].set<double>(entry.second.rotation(1));
+			obj["pitch"].set<double>(entry.second.rotation(2));
+			obj["x"].set<double>(entry.second.translation(0));
+			obj["y"].set<double>(entry.second.translation(1));
+			obj["z"].set<double>(entry.second.translation(2));
+			offsets.push_back(picojson::value(obj));
+		}
+		profile["device_offsets"].set<picojson::array>(offsets);
+	}
 
 	double speed = (int) ctx.calibrationSpeed;
 	profile["calibration_speed"].set<double>(speed);
+	profile["custom_sample_count"].set<double>((double) ctx.customSampleCount);
+	profile["latency_compensation"].set<bool>(ctx.latencyCompensation);
 
 	if (ctx.chaperone.valid)
 	{
 		picojson::object chaperone;
 		chaperone["auto_apply"].set<bool>(ctx.chaperone.autoApply);
+		chaperone["follow_calibration"].set<bool>(ctx.chaperone.followCalibration);
 		chaperone["play_space_size"].set<picojson::array>(FloatArray(ctx.chaperone.playSpaceSize.v, 2));
 
 		chaperone["standing_center"].set<picojson::array>(FloatArray(
@@ -130,11 +604,24 @@ static void WriteProfile(CalibrationContext &ctx, std::ostream &out)
 		profile["chaperone"].set<picojson::object>(chaperone);
 	}
 
-	picojson::value profileV;
-	profileV.set<picojson::object>(profile);
+	return profile;
+}
+
+static void WriteProfile(CalibrationContext &ctx, std::ostream &out)
+{
+	if (!HasProfile(ctx))
+		return;
 
 	picojson::array profiles;
-	profiles.push_back(profileV);
+	profiles.push_back(picojson::value(WriteProfileObject(ctx)));
+
+	for (auto &other : ctx.otherUniverses)
+	{
+		CalibrationContext stored;
+		UniverseProfile profile = other;
+		SwapUniverseProfile(stored, profile);
+		profiles.push_back(picojson::value(WriteProfileObject(stored)));
+	}
 
 	picojson::value profilesV;
 	profilesV.set<picojson::array>(profiles);
@@ -142,6 +629,315 @@ static void WriteProfile(CalibrationContext &ctx, std::ostream &out)
 	out << profilesV.serialize(true);
 }
 
+static const uint32_t BinaryProfileMagic = 0x46504353; // "SCPF"
+static const uint32_t BinaryProfileVersion = 4;
+
+/**
+ * Layout of the profile stored in the registry: this header, then otherTargetCount BinaryTargets,
+ * deviceOffsetCount BinaryDeviceOffsets, geometryQuadCount chaperone quads and finally stringBytes
+ * of null terminated strings. Strings are referenced by their offset into that last block.
+ * Everything is stored as it's laid out in memory, so loading is a single read plus copies.
+ *
+ * Parent systems are string offsets too. The reference system's string comes first, so 0 means
+ * calibrated against the reference, which is also what version 1 left in the reserved fields.
+ *
+ * The profiles of other universes follow the strings, otherUniverseBytes in all: each is a
+ * uint64_t size and then a complete profile of its own without further universes.
+ *
+ * Version 1 headers end before targetParentSystem, version 2 headers before universeID and
+ * version 3 headers before targetLatency.
+ */
+struct BinaryProfileHeader
+{
+	uint32_t magic;
+	uint32_t version;
+	uint32_t flags;
+	uint32_t calibrationSpeed;
+	uint32_t referenceTrackingSystem;
+	uint32_t targetTrackingSystem;
+	uint32_t otherTargetCount;
+	uint32_t deviceOffsetCount;
+	uint32_t geometryQuadCount;
+	uint32_t stringBytes;
+	double rotation[3];
+	double translation[3];
+	double scale;
+	vr::HmdMatrix34_t standingCenter;
+	vr::HmdVector2_t playSpaceSize;
+	uint32_t targetParentSystem;
+	uint32_t otherUniverseCount;
+	uint64_t universeID;
+	uint32_t otherUniverseBytes;
+	uint32_t customSampleCount; // 0 in profiles from before custom counts.
+	double targetLatency;
+};
+
+static const size_t BinaryProfileHeaderV1Size = offsetof(BinaryProfileHeader, targetParentSystem);
+static const size_t BinaryProfileHeaderV2Size = offsetof(BinaryProfileHeader, universeID);
+static const size_t BinaryProfileHeaderV3Size = offsetof(BinaryProfileHeader, targetLatency);
+
+enum BinaryProfileFlags
+{
+	BinaryProfileCalibrated = 1 << 0,
+	BinaryProfileChaperone = 1 << 1,
+	BinaryProfileChaperoneAutoApply = 1 << 2,
+	BinaryProfileLatencyCompensation = 1 << 3,
+	BinaryProfileChaperoneFollowCalibration = 1 << 4,
+};
+
+struct BinaryTarget
+{
+	uint32_t trackingSystem;
+	uint32_t parentSystem;
+	double rotation[3];
+	double translation[3];
+	double scale;
+};
+
+struct BinaryDeviceOffset
+{
+	uint32_t serial;
+	uint32_t reserved;
+	double rotation[3];
+	double translation[3];
+};
+
+static_assert(sizeof(BinaryProfileHeader) % 8 == 0 && sizeof(BinaryTarget) % 8 == 0 && sizeof(BinaryDeviceOffset) % 8 == 0, "binary profile records must keep doubles aligned");
+
+static void ParseBinaryProfile(CalibrationContext &ctx, const uint8_t *data, size_t size)
+{
+	BinaryProfileHeader header = {};
+	if (size < BinaryProfileHeaderV1Size)
+		throw std::runtime_error("profile is truncated");
+
+	memcpy(&header, data, BinaryProfileHeaderV1Size);
+	if (header.magic != BinaryProfileMagic)
+		throw std::runtime_error("not a binary profile");
+	if (header.version < 1 || header.version > BinaryProfileVersion)
+		throw std::runtime_error("unsupported profile version " + std::to_string(header.version));
+
+	size_t headerSize = header.version == 1 ? BinaryProfileHeaderV1Size : header.version == 2 ? BinaryProfileHeaderV2Size :
+		header.version == 3 ? BinaryProfileHeaderV3Size : sizeof header;
+	if (size < headerSize)
+		throw std::runtime_error("profile is truncated");
+	memcpy(&header, data, headerSize);
+
+	size_t targetsOffset = headerSize;
+	size_t offsetsOffset = targetsOffset + header.otherTargetCount * sizeof(BinaryTarget);
+	size_t geometryOffset = offsetsOffset + header.deviceOffsetCount * sizeof(BinaryDeviceOffset);
+	size_t stringsOffset = geometryOffset + header.geometryQuadCount * sizeof(vr::HmdQuad_t);
+	size_t universesOffset = stringsOffset + header.stringBytes;
+	if (universesOffset + header.otherUniverseBytes != size)
+		throw std::runtime_error("profile size doesn't match its header");
+
+	auto strings = reinterpret_cast<const char *>(data + stringsOffset);
+	auto stringAt = [&](uint32_t offset) {
+		if (offset >= header.stringBytes || !memchr(strings + offset, 0, header.stringBytes - offset))
+			throw std::runtime_error("profile has an invalid string");
+		return Intern(strings + offset);
+	};
+
+	ctx.universeID = header.universeID;
+	ctx.referenceTrackingSystem = stringAt(header.referenceTrackingSystem);
+	ctx.targetTrackingSystem = stringAt(header.targetTrackingSystem);
+	ctx.targetParentSystem = header.targetParentSystem ? stringAt(header.targetParentSystem) : NoString;
+	ctx.calibratedRotation = EulerQuat(Eigen::Vector3d(header.rotation[0], header.rotation[1], header.rotation[2]));
+	ctx.calibratedTranslation = Eigen::Vector3d(header.translation[0], header.translation[1], header.translation[2]);
+	ctx.calibratedScale = header.scale;
+	ctx.targetLatency = header.targetLatency;
+	ctx.latencyCompensation = (header.flags & BinaryProfileLatencyCompensation) != 0;
+	ctx.calibrationSpeed = SpeedFromProfile((int) header.calibrationSpeed);
+	if (header.customSampleCount)
+		ctx.customSampleCount = header.customSampleCount;
+
+	ctx.otherTargets.clear();
+	for (uint32_t i = 0; i < header.otherTargetCount; i++)
+	{
+		BinaryTarget target;
+		memcpy(&target, data + targetsOffset + i * sizeof target, sizeof target);
+
+		TargetProfile profile;
+		profile.trackingSystem = stringAt(target.trackingSystem);
+		profile.parentSystem = target.parentSystem ? stringAt(target.parentSystem) : NoString;
+		profile.rotation = EulerQuat(Eigen::Vector3d(target.rotation[0], target.rotation[1], target.rotation[2]));
+		profile.translation = Eigen::Vector3d(target.translation[0], target.translation[1], target.translation[2]);
+		profile.scale = target.scale;
+		ctx.otherTargets.push_back(profile);
+	}
+
+	ctx.deviceOffsets.clear();
+	for (uint32_t i = 0; i < header.deviceOffsetCount; i++)
+	{
+		BinaryDeviceOffset device;
+		memcpy(&device, data + offsetsOffset + i * sizeof device, sizeof device);
+
+		DeviceOffset offset;
+		offset.rotation = Eigen::Vector3d(device.rotation[0], device.rotation[1], device.rotation[2]);
+		offset.translation = Eigen::Vector3d(device.translation[0], device.translation[1], device.translation[2]);
+		ctx.deviceOffsets[stringAt(device.serial)] = offset;
+	}
+
+	if (header.flags & BinaryProfileChaperone)
+	{
+		ctx.chaperone.autoApply = (header.flags & BinaryProfileChaperoneAutoApply) != 0;
+		ctx.chaperone.followCalibration = (header.flags & BinaryProfileChaperoneFollowCalibration) != 0;
+		ctx.chaperone.standingCenter = header.standingCenter;
+		ctx.chaperone.playSpaceSize = header.playSpaceSize;
+		ctx.chaperone.geometry.resize(header.geometryQuadCount);
+		if (header.geometryQuadCount > 0)
+			memcpy(ctx.chaperone.geometry.data(), data + geometryOffset, header.geometryQuadCount * sizeof(vr::HmdQuad_t));
+		ctx.chaperone.valid = header.geometryQuadCount > 0;
+	}
+
+	ctx.validProfile = (header.flags & BinaryProfileCalibrated) != 0;
+
+	ctx.otherUniverses.clear();
+	size_t universeOffset = universesOffset;
+	for (uint32_t i = 0; i < header.otherUniverseCount; i++)
+	{
+		uint64_t universeSize;
+		if (size - universeOffset < sizeof universeSize)
+			throw std::runtime_error("profile has a truncated universe");
+		memcpy(&universeSize, data + universeOffset, sizeof universeSize);
+		universeOffset += sizeof universeSize;
+		if (size - universeOffset < universeSize)
+			throw std::runtime_error("profile has a truncated universe");
+
+		CalibrationContext stored;
+		ParseBinaryProfile(stored, data + universeOffset, (size_t) universeSize);
+		if (!stored.otherUniverses.empty())
+			throw std::runtime_error("profile has nested universes");
+		universeOffset += (size_t) universeSize;
+
+		UniverseProfile profile;
+		SwapUniverseProfile(stored, profile);
+		ctx.otherUniverses.push_back(std::move(profile));
+	}
+}
+
+// Returns an empty buffer if there's no profile to save, like WriteProfile.
+static std::vector<uint8_t> WriteBinaryProfile(const CalibrationContext &ctx)
+{
+	std::vector<uint8_t> data;
+	if (!HasProfile(ctx))
+		return data;
+
+	std::string strings;
+	auto addString = [&strings](StringID id) {
+		uint32_t offset = (uint32_t) strings.size();
+		strings += InternedString(id);
+		strings.push_back('\0');
+		return offset;
+	};
+
+	BinaryProfileHeader header = {};
+	header.magic = BinaryProfileMagic;
+	header.version = BinaryProfileVersion;
+	header.calibrationSpeed = (uint32_t) ctx.calibrationSpeed;
+	header.customSampleCount = (uint32_t) ctx.customSampleCount;
+	header.universeID = ctx.universeID;
+	header.referenceTrackingSystem = addString(ctx.referenceTrackingSystem);
+	header.targetTrackingSystem = addString(ctx.targetTrackingSystem);
+	if (ctx.targetParentSystem != NoString)
+		header.targetParentSystem = addString(ctx.targetParentSystem);
+	header.otherTargetCount = (uint32_t) ctx.otherTargets.size();
+	header.deviceOffsetCount = (uint32_t) ctx.deviceOffsets.size();
+	Eigen::Vector3d euler = EulerFromQuat(ctx.calibratedRotation);
+	for (int i = 0; i < 3; i++)
+	{
+		header.rotation[i] = euler(i);
+		header.translation[i] = ctx.calibratedTranslation(i);
+	}
+	header.scale = ctx.calibratedScale;
+	header.targetLatency = ctx.targetLatency;
+
+	if (ctx.validProfile)
+		header.flags |= BinaryProfileCalibrated;
+	if (ctx.latencyCompensation)
+		header.flags |= BinaryProfileLatencyCompensation;
+
+	if (ctx.chaperone.valid)
+	{
+		header.flags |= BinaryProfileChaperone;
+		if (ctx.chaperone.autoApply)
+			header.flags |= BinaryProfileChaperoneAutoApply;
+		if (ctx.chaperone.followCalibration)
+			header.flags |= BinaryProfileChaperoneFollowCalibration;
+		header.standingCenter = ctx.chaperone.standingCenter;
+		header.playSpaceSize = ctx.chaperone.playSpaceSize;
+		header.geometryQuadCount = (uint32_t) ctx.chaperone.geometry.size();
+	}
+
+	std::vector<BinaryTarget> targets;
+	for (auto &profile : ctx.otherTargets)
+	{
+		BinaryTarget target = {};
+		target.trackingSystem = addString(profile.trackingSystem);
+		if (profile.parentSystem != NoString)
+			target.parentSystem = addString(profile.parentSystem);
+		Eigen::Vector3d targetEuler = EulerFromQuat(profile.rotation);
+		for (int i = 0; i < 3; i++)
+		{
+			target.rotation[i] = targetEuler(i);
+			target.translation[i] = profile.translation(i);
+		}
+		target.scale = profile.scale;
+		targets.push_back(target);
+	}
+
+	std::vector<BinaryDeviceOffset> offsets;
+	for (auto &entry : ctx.deviceOffsets)
+	{
+		BinaryDeviceOffset device = {};
+		device.serial = addString(entry.first);
+		for (int i = 0; i < 3; i++)
+		{
+			device.rotation[i] = entry.second.rotation(i);
+			device.translation[i] = entry.second.translation(i);
+		}
+		offsets.push_back(device);
+	}
+
+	header.stringBytes = (uint32_t) strings.size();
+
+	std::vector<uint8_t> universes;
+	for (auto &other : ctx.otherUniverses)
+	{
+		CalibrationContext stored;
+		UniverseProfile profile = other;
+		SwapUniverseProfile(stored, profile);
+
+		auto universe = WriteBinaryProfile(stored);
+		if (universe.empty())
+			continue;
+
+		uint64_t universeSize = universe.size();
+		auto sizeBytes = reinterpret_cast<const uint8_t *>(&universeSize);
+		universes.insert(universes.end(), sizeBytes, sizeBytes + sizeof universeSize);
+		universes.insert(universes.end(), universe.begin(), universe.end());
+		header.otherUniverseCount++;
+	}
+	header.otherUniverseBytes = (uint32_t) universes.size();
+
+	size_t geometryBytes = header.geometryQuadCount * sizeof(vr::HmdQuad_t);
+	data.resize(sizeof header + targets.size() * sizeof(BinaryTarget) + offsets.size() * sizeof(BinaryDeviceOffset) + geometryBytes + strings.size() + universes.size());
+
+	uint8_t *out = data.data();
+	auto append = [&out](const void *src, size_t size) {
+		if (size > 0)
+			memcpy(out, src, size);
+		out += size;
+	};
+
+	append(&header, sizeof header);
+	append(targets.data(), targets.size() * sizeof(BinaryTarget));
+	append(offsets.data(), offsets.size() * sizeof(BinaryDeviceOffset));
+	append(ctx.chaperone.geometry.data(), geometryBytes);
+	append(strings.data(), strings.size());
+	append(universes.data(), universes.size());
+	return data;
+}
+
 static void LogRegistryResult(LSTATUS result)
 {
 	char *message;
@@ -175,29 +971,149 @@ static std::string ReadRegistryKey()
 	return str;
 }
 
-static void WriteRegistryKey(std::string str)
+// Settings of this machine rather than of the profile, which other stations may replace.
+void LoadProfileSyncSettings(uint32_t &mode, uint32_t &channel)
+{
+	DWORD value, size = sizeof value;
+	mode = ProfileSyncOff;
+	channel = 0;
+	if (RegGetValueA(HKEY_CURRENT_USER_LOCAL_SETTINGS, RegistryKey, "ProfileSync", RRF_RT_REG_DWORD, 0, &value, &size) == ERROR_SUCCESS)
+		mode = value & (ProfileSyncPublish | ProfileSyncSubscribe);
+	size = sizeof value;
+	if (RegGetValueA(HKEY_CURRENT_USER_LOCAL_SETTINGS, RegistryKey, "ProfileSyncChannel", RRF_RT_REG_DWORD, 0, &value, &size) == ERROR_SUCCESS)
+		channel = value;
+}
+
+void SaveProfileSyncSettings(uint32_t mode, uint32_t channel)
+{
+	DWORD value = mode;
+	auto result = RegSetKeyValueA(HKEY_CURRENT_USER_LOCAL_SETTINGS, RegistryKey, "ProfileSync", REG_DWORD, &value, sizeof value);
+	if (result == ERROR_SUCCESS)
+	{
+		value = channel;
+		result = RegSetKeyValueA(HKEY_CURRENT_USER_LOCAL_SETTINGS, RegistryKey, "ProfileSyncChannel", REG_DWORD, &value, sizeof value);
+	}
+	if (result != ERROR_SUCCESS)
+		LogRegistryResult(result);
+}
+
+std::string LoadProfileSyncKey()
+{
+	char key[256];
+	DWORD size = sizeof key;
+	if (RegGetValueA(HKEY_CURRENT_USER_LOCAL_SETTINGS, RegistryKey, "ProfileSyncKey", RRF_RT_REG_SZ, 0, key, &size) != ERROR_SUCCESS)
+		return "";
+	return key;
+}
+
+void SaveProfileSyncKey(const std::string &key)
+{
+	auto result = RegSetKeyValueA(HKEY_CURRENT_USER_LOCAL_SETTINGS, RegistryKey, "ProfileSyncKey", REG_SZ, key.c_str(), (DWORD) key.size() + 1);
+	if (result != ERROR_SUCCESS)
+		LogRegistryResult(result);
+}
+
+std::string LoadAnchorSerial()
 {
-	HKEY hkey;
-	auto result = RegCreateKeyExA(HKEY_CURRENT_USER_LOCAL_SETTINGS, RegistryKey, 0, REG_NONE, 0, KEY_ALL_ACCESS, 0, &hkey, 0);
+	char serial[256];
+	DWORD size = sizeof serial;
+	if (RegGetValueA(HKEY_CURRENT_USER_LOCAL_SETTINGS, RegistryKey, "SharedAnchor", RRF_RT_REG_SZ, 0, serial, &size) != ERROR_SUCCESS)
+		return "";
+	return serial;
+}
+
+void SaveAnchorSerial(const std::string &serial)
+{
+	auto result = RegSetKeyValueA(HKEY_CURRENT_USER_LOCAL_SETTINGS, RegistryKey, "SharedAnchor", REG_SZ, serial.c_str(), (DWORD) serial.size() + 1);
+	if (result != ERROR_SUCCESS)
+		LogRegistryResult(result);
+}
+
+uint16_t LoadMetricsPort()
+{
+	DWORD value, size = sizeof value;
+	if (RegGetValueA(HKEY_CURRENT_USER_LOCAL_SETTINGS, RegistryKey, "MetricsPort", RRF_RT_REG_DWORD, 0, &value, &size) != ERROR_SUCCESS)
+		return 0;
+	return value <= 0xffff ? (uint16_t) value : 0;
+}
+
+void SaveMetricsPort(uint16_t port)
+{
+	DWORD value = port;
+	auto result = RegSetKeyValueA(HKEY_CURRENT_USER_LOCAL_SETTINGS, RegistryKey, "MetricsPort", REG_DWORD, &value, sizeof value);
+	if (result != ERROR_SUCCESS)
+		LogRegistryResult(result);
+}
+
+// Returns false if there's no binary profile yet, so an older JSON profile can be imported.
+static bool ReadRegistryBinary(std::vector<uint8_t> &data)
+{
+	DWORD size = 0;
+	auto result = RegGetValueA(HKEY_CURRENT_USER_LOCAL_SETTINGS, RegistryKey, "Profile", RRF_RT_REG_BINARY, 0, 0, &size);
+	if (result == ERROR_FILE_NOT_FOUND)
+		return false;
 	if (result != ERROR_SUCCESS)
 	{
 		LogRegistryResult(result);
-		return;
+		return false;
 	}
 
-	DWORD size = str.size() + 1;
+	data.resize(size);
+	if (size == 0)
+		return true;
 
-	result = RegSetValueExA(hkey, "Config", 0, REG_SZ, reinterpret_cast<const BYTE*>(str.c_str()), size);
+	result = RegGetValueA(HKEY_CURRENT_USER_LOCAL_SETTINGS, RegistryKey, "Profile", RRF_RT_REG_BINARY, 0, data.data(), &size);
 	if (result != ERROR_SUCCESS)
+	{
 		LogRegistryResult(result);
+		return false;
+	}
 
-	RegCloseKey(hkey);
+	data.resize(size);
+	return true;
 }
 
+static void LoadBinaryProfile(CalibrationContext &ctx, const uint8_t *data, size_t size)
+{
+	if (size == 0)
+	{
+		std::cout << "Profile is empty" << std::endl;
+		ctx.Clear();
+		return;
+	}
+
+	ParseBinaryProfile(ctx, data, size);
+}
+
+// The profile file is the one in use. Profiles from older versions, a binary or JSON value in
+// the registry, are imported from there until the first save, and left in place.
 void LoadProfile(CalibrationContext &ctx)
 {
 	ctx.validProfile = false;
 
+	try
+	{
+		std::vector<uint8_t> data;
+		if (Profiles.Read([&ctx](const uint8_t *data, size_t size) { LoadBinaryProfile(ctx, data, size); }))
+		{
+			ctx.profileSavedTime = Profiles.ModifiedTime();
+			std::cout << "Loaded profile" << std::endl;
+			return;
+		}
+
+		if (ReadRegistryBinary(data))
+		{
+			LoadBinaryProfile(ctx, data.data(), data.size());
+			std::cout << "Imported profile from registry" << std::endl;
+			return;
+		}
+	}
+	catch (const std::runtime_error &e)
+	{
+		std::cerr << "Error loading profile: " << e.what() << std::endl;
+		return;
+	}
+
 	auto str = ReadRegistryKey();
 	if (str == "")
 	{
@@ -210,7 +1126,7 @@ void LoadProfile(CalibrationContext &ctx)
 	{
 		std::stringstream io(str);
 		ParseProfile(ctx, io);
-		std::cout << "Loaded profile" << std::endl;
+		std::cout << "Imported JSON profile" << std::endl;
 	}
 	catch (const std::runtime_error &e)
 	{
@@ -220,9 +1136,73 @@ void LoadProfile(CalibrationContext &ctx)
 
 void SaveProfile(CalibrationContext &ctx)
 {
-	std::cout << "Saving profile to registry" << std::endl;
+	std::cout << "Saving profile" << std::endl;
+	auto data = WriteBinaryProfile(ctx);
+	SharedProfiles.Publish(data);
+	Profiles.Write(std::move(data));
+	ctx.profileSavedTime = (int64_t) time(nullptr);
+}
+
+void ApplySharedProfile(CalibrationContext &ctx, const std::vector<uint8_t> &data)
+{
+	// Parsed on the side first, so a profile this version can't read leaves ours alone.
+	std::unique_ptr<CalibrationContext> check(new CalibrationContext());
+	LoadBinaryProfile(*check, data.data(), data.size());
+
+	ctx.Clear();
+	LoadBinaryProfile(ctx, data.data(), data.size());
+
+	// Saved without SaveProfile, a station that publishes and subscribes would send it back.
+	std::cout << "Saving shared profile" << std::endl;
+	auto written = WriteBinaryProfile(ctx);
+	SharedProfiles.Adopt(written);
+	Profiles.Write(std::move(written));
+	ctx.profileSavedTime = (int64_t) time(nullptr);
+}
+
+void ShareProfile(const CalibrationContext &ctx)
+{
+	SharedProfiles.Push(WriteBinaryProfile(ctx));
+}
+
+void RestoreProfileVersion(CalibrationContext &ctx, size_t index)
+{
+	std::vector<uint8_t> data;
+	if (!Profiles.History().Read(index, data))
+		throw std::runtime_error("version " + std::to_string(index) + " of the profile history is damaged");
 
-	std::stringstream io;
-	WriteProfile(ctx, io);
-	WriteRegistryKey(io.str());
+	ctx.Clear();
+	LoadBinaryProfile(ctx, data.data(), data.size());
+	SaveProfile(ctx);
+}
+
+void ImportProfile(CalibrationContext &ctx, const std::string &path)
+{
+	std::ifstream file(path);
+	if (!file)
+		throw std::runtime_error("couldn't open " + path);
+
+	ctx.Clear();
+	ParseProfile(ctx, file);
+}
+
+void ExportProfile(CalibrationContext &ctx, const std::string &path)
+{
+	if (!HasProfile(ctx))
+		throw std::runtime_error("there is no profile to export");
+
+	std::ofstream file(path);
+	if (!file)
+		throw std::runtime_error("couldn't create " + path);
+
+	WriteProfile(ctx, file);
+	if (!file)
+		throw std::runtime_error("couldn't write " + path);
+}
+
+std::string ProfileJson(CalibrationContext &ctx)
+{
+	std::ostringstream out;
+	WriteProfile(ctx, out);
+	return out.str();
 }
@@ -4,3 +4,35 @@
 
 void LoadProfile(CalibrationContext &ctx);
 void SaveProfile(CalibrationContext &ctx);
+
+// Makes a version from the profile history the saved profile again, see ProfileHistory. The
+// caller applies it. Throws std::runtime_error.
+void RestoreProfileVersion(CalibrationContext &ctx, size_t index);
+
+// A profile another station published, see ProfileSync. It's saved here without being published
+// again, the caller applies it. Throws std::runtime_error if it can't be read, ctx is untouched then.
+void ApplySharedProfile(CalibrationContext &ctx, const std::vector<uint8_t> &data);
+
+// Sends the whole profile to the subscribed stations, even if they have it.
+void ShareProfile(const CalibrationContext &ctx);
+
+// ProfileSyncMode bits and channel of this machine, kept in the registry.
+void LoadProfileSyncSettings(uint32_t &mode, uint32_t &channel);
+void SaveProfileSyncSettings(uint32_t mode, uint32_t channel);
+
+// The key every station of the venue shares, profile sync is off without one.
+std::string LoadProfileSyncKey();
+void SaveProfileSyncKey(const std::string &key);
+std::string LoadAnchorSerial();
+void SaveAnchorSerial(const std::string &serial);
+
+// Port of the metrics endpoint on this machine, 0 while it's off.
+uint16_t LoadMetricsPort();
+void SaveMetricsPort(uint16_t port);
+
+// JSON profile files, for moving profiles between machines and editing them by hand. Throw std::runtime_error.
+void ImportProfile(CalibrationContext &ctx, const std::string &path);
+void ExportProfile(CalibrationContext &ctx, const std::string &path);
+
+// The profile as ExportProfile writes it, empty when there is none.
+std::string ProfileJson(CalibrationContext &ctx);
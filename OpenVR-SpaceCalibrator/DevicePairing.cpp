@@ -0,0 +1,190 @@
+#include "stdafx.h"
+#include "DevicePairing.h"
+
+#include <algorithm>
+#include <cmath>
+
+// A pair needs half a window of shared bins, and both devices must vary their speed by more
+// than this (rad/s squared) for the correlation to mean anything.
+static const double MinSharedBins = DevicePairing::WindowBins / 2;
+static const double MinSpeedVariance = 0.05;
+
+static const double MinPairCorrelation = 0.9;
+static const double MinPairMargin = 0.1;
+
+DevicePairing::DevicePairing() : devices(vr::k_unMaxTrackedDeviceCount)
+{
+}
+
+void DevicePairing::SetCandidates(uint64_t references, uint64_t targets)
+{
+	referenceMask = references;
+	targetMask = targets & ~references;
+	candidates.clear();
+	pairs.clear();
+	openBin = -1;
+
+	for (uint32_t id = 0; id < vr::k_unMaxTrackedDeviceCount; id++)
+	{
+		if (!(CandidateMask() & (1ull << id)))
+			continue;
+
+		candidates.push_back(id);
+		auto &device = devices[id];
+		device.binSum[0] = device.binSum[1] = 0;
+		device.binCount[0] = device.binCount[1] = 0;
+		std::fill(device.valid, device.valid + WindowBins, false);
+	}
+
+	for (uint32_t ref : candidates)
+	{
+		if (!(referenceMask & (1ull << ref)))
+			continue;
+
+		for (uint32_t target : candidates)
+		{
+			if (targetMask & (1ull << target))
+				pairs.push_back({ ref, target, 0, 0, 0, 0, 0, 0 });
+		}
+	}
+}
+
+void DevicePairing::Push(const protocol::PoseCaptureSample &sample)
+{
+	if (sample.openVRID >= vr::k_unMaxTrackedDeviceCount || !(CandidateMask() & (1ull << sample.openVRID)))
+		return;
+
+	int64_t bin = (int64_t) std::floor(sample.timestamp / BinSeconds);
+	if (openBin < 0)
+		openBin = bin;
+
+	// Two bins stay open, so poses of one device arriving a little after another's still count.
+	if (bin >= openBin + 2)
+		CloseBins(bin - 1);
+	if (bin < openBin || !sample.valid || sample.trackingResult != vr::TrackingResult_Running_OK)
+		return;
+
+	auto &device = devices[sample.openVRID];
+	device.binSum[bin & 1] += sample.angularSpeed;
+	device.binCount[bin & 1]++;
+}
+
+void DevicePairing::CloseBins(int64_t upTo)
+{
+	// After a long gap every stored bin is stale anyway.
+	if (upTo - openBin > (int64_t) WindowBins)
+	{
+		for (uint32_t id : candidates)
+		{
+			auto &device = devices[id];
+			device.binSum[0] = device.binSum[1] = 0;
+			device.binCount[0] = device.binCount[1] = 0;
+			std::fill(device.valid, device.valid + WindowBins, false);
+		}
+		for (auto &pair : pairs)
+			pair.n = pair.sx = pair.sy = pair.sxx = pair.syy = pair.sxy = 0;
+		openBin = upTo;
+		return;
+	}
+
+	for (; openBin < upTo; openBin++)
+	{
+		size_t slot = (size_t) (openBin % WindowBins);
+		int parity = (int) (openBin & 1);
+
+		for (uint32_t id : candidates)
+		{
+			auto &device = devices[id];
+			device.leavingValue = device.value[slot];
+			device.leavingValid = device.valid[slot];
+			device.valid[slot] = device.binCount[parity] > 0;
+			device.value[slot] = device.valid[slot] ? device.binSum[parity] / device.binCount[parity] : 0;
+			device.binSum[parity] = 0;
+			device.binCount[parity] = 0;
+		}
+
+		// Once per window the sums are rebuilt from the stored bins, so rounding errors from
+		// taking values back out can't pile up over a long session.
+		bool rebuild = slot == WindowBins - 1;
+
+		for (auto &pair : pairs)
+		{
+			auto &ref = devices[pair.referenceID], &target = devices[pair.targetID];
+			if (rebuild)
+			{
+				pair.n = pair.sx = pair.sy = pair.sxx = pair.syy = pair.sxy = 0;
+				for (size_t i = 0; i < WindowBins; i++)
+				{
+					if (!ref.valid[i] || !target.valid[i])
+						continue;
+					double x = ref.value[i], y = target.value[i];
+					pair.n++;
+					pair.sx += x; pair.sy += y;
+					pair.sxx += x * x; pair.syy += y * y; pair.sxy += x * y;
+				}
+				continue;
+			}
+
+			if (ref.leavingValid && target.leavingValid)
+			{
+				double x = ref.leavingValue, y = target.leavingValue;
+				pair.n--;
+				pair.sx -= x; pair.sy -= y;
+				pair.sxx -= x * x; pair.syy -= y * y; pair.sxy -= x * y;
+			}
+			if (ref.valid[slot] && target.valid[slot])
+			{
+				double x = ref.value[slot], y = target.value[slot];
+				pair.n++;
+				pair.sx += x; pair.sy += y;
+				pair.sxx += x * x; pair.syy += y * y; pair.sxy += x * y;
+			}
+		}
+	}
+}
+
+double DevicePairing::Correlation(const Pair &pair) const
+{
+	if (pair.n < MinSharedBins)
+		return 0;
+
+	double varX = pair.sxx / pair.n - (pair.sx / pair.n) * (pair.sx / pair.n);
+	double varY = pair.syy / pair.n - (pair.sy / pair.n) * (pair.sy / pair.n);
+	if (varX < MinSpeedVariance || varY < MinSpeedVariance)
+		return 0;
+
+	double cov = pair.sxy / pair.n - (pair.sx / pair.n) * (pair.sy / pair.n);
+	return cov / std::sqrt(varX * varY);
+}
+
+bool DevicePairing::Best(uint32_t &referenceID, uint32_t &targetID, double &correlation) const
+{
+	const Pair *best = nullptr;
+	double bestCorrelation = MinPairCorrelation;
+	for (auto &pair : pairs)
+	{
+		double c = Correlation(pair);
+		if (c >= bestCorrelation)
+		{
+			best = &pair;
+			bestCorrelation = c;
+		}
+	}
+	if (!best)
+		return false;
+
+	// Another device moving much the same way, e.g. both controllers swung together, leaves
+	// it ambiguous. Pairs of two other devices don't matter, several trackers may be mounted.
+	for (auto &pair : pairs)
+	{
+		if (&pair == best || (pair.referenceID != best->referenceID && pair.targetID != best->targetID))
+			continue;
+		if (Correlation(pair) > bestCorrelation - MinPairMargin)
+			return false;
+	}
+
+	referenceID = best->referenceID;
+	targetID = best->targetID;
+	correlation = bestCorrelation;
+	return true;
+}
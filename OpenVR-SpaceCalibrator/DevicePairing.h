@@ -0,0 +1,60 @@
+#pragma once
+
+#include "../Protocol.h"
+
+#include <vector>
+
+/**
+ * Finds the reference and target devices that are held together, so the user doesn't have to
+ * pick them by hand. Captured angular speeds are averaged into short bins, and every pair of
+ * a reference candidate and a target candidate keeps running correlation sums over a rolling
+ * window of bins. Each new bin adds itself to the sums and takes the bin leaving the window
+ * back out, so scoring costs the same however long the devices have been watched. Angular
+ * speed doesn't depend on which space it's measured in, so uncalibrated systems compare fine.
+ */
+class DevicePairing
+{
+public:
+	static const size_t WindowBins = 200;
+	static constexpr double BinSeconds = 0.05;
+
+	DevicePairing();
+
+	// Starts over with new candidates, a device may be in at most one of the masks.
+	void SetCandidates(uint64_t referenceMask, uint64_t targetMask);
+	uint64_t ReferenceMask() const { return referenceMask; }
+	uint64_t TargetMask() const { return targetMask; }
+	uint64_t CandidateMask() const { return referenceMask | targetMask; }
+
+	void Push(const protocol::PoseCaptureSample &sample);
+
+	// The best scoring pair, if it's correlated enough and clearly ahead of every other pair
+	// that shares one of its devices.
+	bool Best(uint32_t &referenceID, uint32_t &targetID, double &correlation) const;
+
+private:
+	struct Device
+	{
+		double binSum[2]; // The two open bins, by bin number parity.
+		int binCount[2];
+		double value[WindowBins]; // Mean angular speed per bin, by bin number modulo WindowBins.
+		bool valid[WindowBins];
+		double leavingValue; // The bin the one being closed replaces.
+		bool leavingValid;
+	};
+
+	struct Pair
+	{
+		uint32_t referenceID, targetID;
+		double n, sx, sy, sxx, syy, sxy;
+	};
+
+	void CloseBins(int64_t upTo);
+	double Correlation(const Pair &pair) const;
+
+	uint64_t referenceMask = 0, targetMask = 0;
+	std::vector<uint32_t> candidates;
+	std::vector<Device> devices; // Indexed by OpenVR ID, only candidates are used.
+	std::vector<Pair> pairs;
+	int64_t openBin = -1; // Bins before this one have been added to the sums.
+};
@@ -0,0 +1,176 @@
+#include "stdafx.h"
+#include "DeviceRegistry.h"
+
+#include <vector>
+
+DeviceRegistry Devices;
+
+void DeviceRegistry::RefreshAll()
+{
+	for (uint32_t id = 0; id < vr::k_unMaxTrackedDeviceCount; ++id)
+	{
+		Refresh(id);
+	}
+	dashboardActive = vr::VROverlay() && vr::VROverlay()->IsDashboardVisible();
+}
+
+// Property values are short, so they're read into a small buffer and only fetched again
+// with the reported size when one doesn't fit.
+static StringID GetStringProperty(uint32_t id, vr::ETrackedDeviceProperty prop, vr::ETrackedPropertyError &err)
+{
+	char buffer[256];
+	uint32_t size = vr::VRSystem()->GetStringTrackedDeviceProperty(id, prop, buffer, sizeof buffer, &err);
+
+	if (err == vr::TrackedProp_BufferTooSmall)
+	{
+		std::vector<char> large(size);
+		vr::VRSystem()->GetStringTrackedDeviceProperty(id, prop, large.data(), size, &err);
+		return err == vr::TrackedProp_Success ? Intern(large.data()) : NoString;
+	}
+
+	return err == vr::TrackedProp_Success ? Intern(buffer) : NoString;
+}
+
+static const vr::ETrackedDeviceProperty DeviceProperties[] = {
+	vr::Prop_TrackingSystemName_String,
+	vr::Prop_ModelNumber_String,
+	vr::Prop_SerialNumber_String,
+	vr::Prop_ControllerRoleHint_Int32,
+};
+
+static const vr::ETrackedDeviceProperty HmdProperties[] = {
+	vr::Prop_CurrentUniverseId_Uint64,
+	vr::Prop_DisplayFrequency_Float,
+	vr::Prop_SecondsFromVsyncToPhotons_Float,
+};
+
+// Reads prop into its field of device, returns false for properties the registry doesn't keep.
+static bool ReadProperty(uint32_t id, vr::ETrackedDeviceProperty prop, TrackedDeviceInfo &device)
+{
+	vr::ETrackedPropertyError err = vr::TrackedProp_Success;
+	bool hmd = id == vr::k_unTrackedDeviceIndex_Hmd;
+	switch (prop)
+	{
+	case vr::Prop_TrackingSystemName_String:
+		device.trackingSystem = GetStringProperty(id, prop, err);
+		device.hasTrackingSystem = err == vr::TrackedProp_Success;
+		return true;
+	case vr::Prop_ModelNumber_String:
+		device.model = GetStringProperty(id, prop, err);
+		return true;
+	case vr::Prop_SerialNumber_String:
+		device.serial = GetStringProperty(id, prop, err);
+		return true;
+	case vr::Prop_ControllerRoleHint_Int32:
+		device.controllerRole = (vr::ETrackedControllerRole) vr::VRSystem()->GetInt32TrackedDeviceProperty(id, prop, &err);
+		return true;
+	case vr::Prop_CurrentUniverseId_Uint64:
+		if (hmd)
+			device.universeID = vr::VRSystem()->GetUint64TrackedDeviceProperty(id, prop, &err);
+		return hmd;
+	case vr::Prop_DisplayFrequency_Float:
+		if (hmd)
+			device.displayFrequency = vr::VRSystem()->GetFloatTrackedDeviceProperty(id, prop, &err);
+		return hmd;
+	case vr::Prop_SecondsFromVsyncToPhotons_Float:
+		if (hmd)
+			device.vsyncToPhotons = vr::VRSystem()->GetFloatTrackedDeviceProperty(id, prop, &err);
+		return hmd;
+	default:
+		return false;
+	}
+}
+
+static void Store(DeviceRegistry &registry, uint32_t id, const TrackedDeviceInfo &device)
+{
+	auto &existing = registry.devices[id];
+	if (existing != device)
+	{
+		existing = device;
+		registry.dirty |= DeviceBit(id);
+		registry.generation++;
+	}
+}
+
+void DeviceRegistry::Refresh(uint32_t id)
+{
+	if (id >= vr::k_unMaxTrackedDeviceCount)
+		return;
+
+	TrackedDeviceInfo device;
+	device.deviceClass = vr::VRSystem()->GetTrackedDeviceClass(id);
+	device.present = device.deviceClass != vr::TrackedDeviceClass_Invalid;
+
+	if (device.present)
+	{
+		for (auto prop : DeviceProperties)
+			ReadProperty(id, prop, device);
+		if (id == vr::k_unTrackedDeviceIndex_Hmd)
+		{
+			for (auto prop : HmdProperties)
+				ReadProperty(id, prop, device);
+		}
+	}
+
+	Store(*this, id, device);
+}
+
+void DeviceRegistry::RefreshProperty(uint32_t id, vr::ETrackedDeviceProperty prop)
+{
+	if (id >= vr::k_unMaxTrackedDeviceCount || !devices[id].present)
+		return;
+
+	TrackedDeviceInfo device = devices[id];
+	if (ReadProperty(id, prop, device))
+		Store(*this, id, device);
+}
+
+void DeviceRegistry::PollEvents()
+{
+	vr::VREvent_t event;
+	while (vr::VRSystem()->PollNextEvent(&event, sizeof event))
+	{
+		switch (event.eventType)
+		{
+		case vr::VREvent_TrackedDeviceActivated:
+		case vr::VREvent_TrackedDeviceDeactivated:
+		case vr::VREvent_TrackedDeviceUpdated:
+			Refresh(event.trackedDeviceIndex);
+			break;
+
+		case vr::VREvent_PropertyChanged:
+			RefreshProperty(event.trackedDeviceIndex, event.data.property.prop);
+			break;
+
+		case vr::VREvent_TrackedDeviceRoleChanged:
+			// Not reliably sent for a specific device, and role changes usually swap two controllers.
+			for (uint32_t id = 0; id < vr::k_unMaxTrackedDeviceCount; ++id)
+			{
+				if (devices[id].deviceClass == vr::TrackedDeviceClass_Controller)
+					RefreshProperty(id, vr::Prop_ControllerRoleHint_Int32);
+			}
+			break;
+
+		case vr::VREvent_ChaperoneUniverseHasChanged:
+			RefreshProperty(vr::k_unTrackedDeviceIndex_Hmd, vr::Prop_CurrentUniverseId_Uint64);
+			chaperoneChanged = true;
+			break;
+
+		case vr::VREvent_ChaperoneDataHasChanged:
+			chaperoneChanged = true;
+			break;
+
+		case vr::VREvent_Quit:
+			quitRequested = true;
+			break;
+
+		case vr::VREvent_DashboardActivated:
+			dashboardActive = true;
+			break;
+
+		case vr::VREvent_DashboardDeactivated:
+			dashboardActive = false;
+			break;
+		}
+	}
+}
@@ -0,0 +1,114 @@
+#pragma once
+
+#include "StringTable.h"
+
+#include <openvr.h>
+#include <cstdint>
+
+static_assert(vr::k_unMaxTrackedDeviceCount <= 64, "device masks expect at most 64 devices");
+
+struct TrackedDeviceInfo
+{
+	bool present = false;
+	vr::ETrackedDeviceClass deviceClass = vr::TrackedDeviceClass_Invalid;
+
+	// Strings are interned when the record is refreshed, so comparing records and matching
+	// them against profiles never touches the strings themselves.
+	bool hasTrackingSystem = false;
+	StringID trackingSystem = NoString;
+
+	StringID model = NoString;
+	StringID serial = NoString;
+	vr::ETrackedControllerRole controllerRole = vr::TrackedControllerRole_Invalid;
+	// Only read for the HMD.
+	uint64_t universeID = 0;
+	float displayFrequency = 0, vsyncToPhotons = 0; // Hz, seconds
+
+	bool operator==(const TrackedDeviceInfo &other) const
+	{
+		return present == other.present &&
+			deviceClass == other.deviceClass &&
+			hasTrackingSystem == other.hasTrackingSystem &&
+			trackingSystem == other.trackingSystem &&
+			model == other.model &&
+			serial == other.serial &&
+			controllerRole == other.controllerRole &&
+			universeID == other.universeID &&
+			displayFrequency == other.displayFrequency &&
+			vsyncToPhotons == other.vsyncToPhotons;
+	}
+
+	bool operator!=(const TrackedDeviceInfo &other) const
+	{
+		return !(*this == other);
+	}
+};
+
+/**
+ * Cached device properties, kept up to date from OpenVR device events instead of polling every
+ * id. Every property read is a round trip into vrserver and OpenVR has no batched read for
+ * applications, so a device is only read in full when it appears or is updated, and a
+ * VREvent_PropertyChanged re-reads just the one property it names. Reading the registry costs
+ * nothing, which lets per tick code like the pose prediction use it too.
+ */
+struct DeviceRegistry
+{
+	TrackedDeviceInfo devices[vr::k_unMaxTrackedDeviceCount];
+
+	// Devices whose record changed since the last call to TakeDirty.
+	uint64_t dirty = 0;
+
+	// Incremented whenever any device record changes, so caches built from the registry know to rebuild.
+	uint32_t generation = 0;
+
+	// Set when SteamVR reports a chaperone change. PollEvents drains the whole event queue,
+	// so it tracks this too. Starts out set so the first check always happens.
+	bool chaperoneChanged = true;
+
+	// Set once SteamVR asks applications to quit, for runs without an overlay to get the event from.
+	bool quitRequested = false;
+
+	// Whether the SteamVR dashboard is open at all, the UI only needs to poll for its overlay then.
+	bool dashboardActive = false;
+
+	// Also reads the dashboard state, which later comes from events.
+	void RefreshAll();
+	void Refresh(uint32_t id);
+	void RefreshProperty(uint32_t id, vr::ETrackedDeviceProperty prop);
+	void PollEvents();
+
+	// Devices currently present in the given tracking system.
+	uint64_t TrackingSystemMask(StringID trackingSystem) const
+	{
+		uint64_t mask = 0;
+		for (uint32_t id = 0; id < vr::k_unMaxTrackedDeviceCount; ++id)
+		{
+			if (devices[id].present && devices[id].hasTrackingSystem && devices[id].trackingSystem == trackingSystem)
+				mask |= 1ull << id;
+		}
+		return mask;
+	}
+
+	// The universe the HMD currently tracks in, 0 without an HMD.
+	uint64_t CurrentUniverse() const
+	{
+		auto &hmd = devices[vr::k_unTrackedDeviceIndex_Hmd];
+		return hmd.present ? hmd.universeID : 0;
+	}
+
+	uint64_t TakeDirty()
+	{
+		uint64_t mask = dirty;
+		dirty = 0;
+		return mask;
+	}
+};
+
+const uint64_t AllDevicesMask = ~0ull;
+
+inline uint64_t DeviceBit(uint32_t id)
+{
+	return 1ull << id;
+}
+
+extern DeviceRegistry Devices;
@@ -0,0 +1,234 @@
+#include "stdafx.h"
+#include "Diagnostics.h"
+#include "Configuration.h"
+#include "DeviceRegistry.h"
+#include "ClientTimings.h"
+#include "ProfileStore.h"
+#include "ProcessQoS.h"
+#include "../Version.h"
+
+#include <algorithm>
+#include <cstdarg>
+#include <cstdio>
+#include <ctime>
+
+// Upper bounds of the error histogram's bins in mm, the last bin takes everything above.
+static const double ErrorBins[] = { 1, 2, 5, 10, 20, 50 };
+static const size_t ErrorBinCount = sizeof ErrorBins / sizeof ErrorBins[0] + 1;
+static const int HistogramWidth = 40;
+
+static struct
+{
+	bool valid = false;
+	time_t time = 0;
+	CalibrationSolution solution;
+	size_t samples = 0;
+	size_t bins[ErrorBinCount] = { 0 };
+	double maxError = 0; // mm
+} LastSolve;
+
+void RecordSolveDiagnostics(const CalibrationSolution &solution, const std::vector<SampleResidual> &residuals)
+{
+	LastSolve.valid = true;
+	LastSolve.time = time(nullptr);
+	LastSolve.solution = solution;
+	LastSolve.solution.log.clear(); // Already in the message log.
+	LastSolve.samples = residuals.size();
+	LastSolve.maxError = 0;
+	for (auto &bin : LastSolve.bins)
+		bin = 0;
+
+	for (auto &residual : residuals)
+	{
+		double error = residual.error.norm() * 1000.0;
+		size_t bin = 0;
+		while (bin + 1 < ErrorBinCount && error >= ErrorBins[bin])
+			bin++;
+		LastSolve.bins[bin]++;
+		LastSolve.maxError = std::max(LastSolve.maxError, error);
+	}
+}
+
+static void Appendf(std::string &out, const char *format, ...)
+{
+	char buf[512];
+	va_list args;
+	va_start(args, format);
+	vsnprintf(buf, sizeof buf, format, args);
+	va_end(args);
+	out += buf;
+}
+
+static const char *Name(StringID id)
+{
+	return id != NoString ? InternedString(id).c_str() : "-";
+}
+
+static const char *DeviceClassName(vr::ETrackedDeviceClass deviceClass)
+{
+	switch (deviceClass)
+	{
+	case vr::TrackedDeviceClass_HMD: return "HMD";
+	case vr::TrackedDeviceClass_Controller: return "controller";
+	case vr::TrackedDeviceClass_GenericTracker: return "tracker";
+	case vr::TrackedDeviceClass_TrackingReference: return "base station";
+	case vr::TrackedDeviceClass_DisplayRedirect: return "display redirect";
+	default: return "other";
+	}
+}
+
+static const char *const StateNames[] = { "None", "Begin", "Rotation", "Translation", "Solving", "Editing", "Continuous", "Verifying" };
+static const char *const VerdictNames[] = { "none", "passed", "failed", "inconclusive" };
+
+static void AppendDevices(std::string &out, const CalibrationContext &ctx)
+{
+	out += "\n[Devices]\n";
+	Appendf(out, "%-3s %-16s %-20s %-24s %-20s %s\n", "id", "class", "tracking system", "model", "serial", "pose");
+	for (uint32_t id = 0; id < vr::k_unMaxTrackedDeviceCount; id++)
+	{
+		auto &device = Devices.devices[id];
+		if (!device.present)
+			continue;
+
+		auto &pose = ctx.devicePoses[id];
+		Appendf(out, "%-3u %-16s %-20s %-24s %-20s %s, result %d%s%s\n", id, DeviceClassName(device.deviceClass),
+			device.hasTrackingSystem ? Name(device.trackingSystem) : "-", Name(device.model), Name(device.serial),
+			pose.bPoseIsValid ? "valid" : "invalid", (int) pose.eTrackingResult,
+			id == ctx.referenceID ? ", reference" : "", id == ctx.targetID ? ", target" : "");
+	}
+	Appendf(out, "HMD universe %llu\n", (unsigned long long) Devices.CurrentUniverse());
+}
+
+static void AppendLastSolve(std::string &out)
+{
+	out += "\n[Last solve]\n";
+	if (!LastSolve.valid)
+	{
+		out += "none this run\n";
+		return;
+	}
+
+	auto &solution = LastSolve.solution;
+	char when[32];
+	tm local;
+	localtime_s(&local, &LastSolve.time);
+	strftime(when, sizeof when, "%Y-%m-%d %H:%M:%S", &local);
+
+	Appendf(out, "at %s, %s\n", when, solution.reject ? "rejected" : "accepted");
+	Appendf(out, "rotation %.3f %.3f %.3f deg, translation %.3f %.3f %.3f cm, scale %.5f\n",
+		solution.rotation(0), solution.rotation(1), solution.rotation(2),
+		solution.translation(0), solution.translation(1), solution.translation(2), solution.scale);
+	Appendf(out, "position error %.2f mm RMS, per axis %.2f %.2f %.2f mm\n", solution.positionError * 1000.0,
+		solution.axisError(0) * 1000.0, solution.axisError(1) * 1000.0, solution.axisError(2) * 1000.0);
+	Appendf(out, "uncertainty %.3f deg, %.3f cm, sensitivity %.2f %.2f %.2f cm\n",
+		solution.uncertainty.rotation, solution.uncertainty.translation,
+		solution.sensitivity(0) * 100.0, solution.sensitivity(1) * 100.0, solution.sensitivity(2) * 100.0);
+
+	Appendf(out, "per-sample error over %zu samples, largest %.2f mm:\n", LastSolve.samples, LastSolve.maxError);
+	size_t most = 1;
+	for (size_t count : LastSolve.bins)
+		most = std::max(most, count);
+	for (size_t bin = 0; bin < ErrorBinCount; bin++)
+	{
+		char range[32];
+		if (bin + 1 < ErrorBinCount)
+			snprintf(range, sizeof range, "%g-%g mm", bin ? ErrorBins[bin - 1] : 0.0, ErrorBins[bin]);
+		else
+			snprintf(range, sizeof range, ">= %g mm", ErrorBins[bin - 1]);
+
+		int width = (int) (LastSolve.bins[bin] * HistogramWidth / most);
+		Appendf(out, "  %-10s %5zu %s\n", range, LastSolve.bins[bin], std::string(width, '#').c_str());
+	}
+}
+
+std::string DiagnosticsReport(CalibrationContext &ctx)
+{
+	std::string out;
+	time_t now = time(nullptr);
+	tm local;
+	localtime_s(&local, &now);
+	char when[32];
+	strftime(when, sizeof when, "%Y-%m-%d %H:%M:%S", &local);
+	Appendf(out, "OpenVR Space Calibrator v" SPACECAL_VERSION_STRING " diagnostics, %s\n", when);
+
+	out += "\n[Status]\n";
+	Appendf(out, "state %s, driver %s, calibration %s\n",
+		(size_t) ctx.state < sizeof StateNames / sizeof StateNames[0] ? StateNames[(int) ctx.state] : "?",
+		ctx.driverConnected ? "connected" : "disconnected", ctx.enabled ? "enabled" : "disabled");
+	Appendf(out, "reference %s, target %s, %zu other targets, %zu other universes\n",
+		Name(ctx.referenceTrackingSystem), Name(ctx.targetTrackingSystem), ctx.otherTargets.size(), ctx.otherUniverses.size());
+	Appendf(out, "position error %.2f mm, target latency %.1f ms, profile saved %lld\n",
+		ctx.positionError * 1000.0, ctx.targetLatency * 1000.0, (long long) ctx.profileSavedTime);
+	Appendf(out, "tick %.2f ms (max %.2f), device scan %.2f ms (max %.2f)\n",
+		Timings[TimingSection::CalibrationTick].Mean(), Timings[TimingSection::CalibrationTick].Max(),
+		Timings[TimingSection::LoadVRState].Mean(), Timings[TimingSection::LoadVRState].Max());
+	Appendf(out, "profile apply %.3f ms (max %.3f), budget %.1f ms\n", Timings[TimingSection::ProfileApply].Mean(),
+		Timings[TimingSection::ProfileApply].Max(), ProfileApplyBudget * 1000.0);
+	size_t workingSet, peakWorkingSet;
+	ProcessWorkingSet(workingSet, peakWorkingSet);
+	Appendf(out, "working set %.1f MB (peak %.1f MB), low memory mode %s\n", workingSet / 1048576.0, peakWorkingSet / 1048576.0,
+		ctx.lowMemory ? "on" : "off");
+
+	AppendDevices(out, ctx);
+	AppendLastSolve(out);
+
+	out += "\n[Last verification]\n";
+	Appendf(out, "verdict %s", VerdictNames[(int) ctx.verifyVerdict]);
+	if (ctx.verify.valid)
+	{
+		Appendf(out, ", %zu samples, position %.2f cm, rotation %.2f deg, drift %.2f cm/s, rotated %.0f deg",
+			ctx.verify.samples, ctx.verify.positionError * 100.0, ctx.verify.rotationError, ctx.verify.drift, ctx.verify.rotated);
+	}
+	out += "\n";
+
+	out += "\n[Profile]\n";
+	std::string profile = ProfileJson(ctx);
+	out += profile.empty() ? "none\n" : profile;
+	if (!profile.empty() && profile.back() != '\n')
+		out += "\n";
+
+	out += "\n[Messages]\n";
+	for (size_t i = 0; i < ctx.messages.Size(); i++)
+	{
+		auto &line = ctx.messages[i];
+		if (line.type == MessageLog::Line::Progress)
+			Appendf(out, "[%d/%d]\n", line.progress, line.target);
+		else
+			out += line.text + (line.open ? "\n" : "");
+	}
+	return out;
+}
+
+bool WriteDiagnosticsReport(CalibrationContext &ctx, const std::string &path)
+{
+	std::string target = path;
+	if (target.empty())
+	{
+		auto directory = ProfileDirectory();
+		if (directory.empty())
+		{
+			ctx.Log("Couldn't write a diagnostics report, there is no local app data directory\n");
+			return false;
+		}
+
+		time_t now = time(nullptr);
+		tm local;
+		localtime_s(&local, &now);
+		char name[64];
+		strftime(name, sizeof name, "\\diagnostics-%Y%m%d-%H%M%S.txt", &local);
+		CreateDirectoryA(directory.c_str(), nullptr);
+		target = directory + name;
+	}
+
+	std::string report = DiagnosticsReport(ctx);
+	FILE *file = nullptr;
+	bool ok = fopen_s(&file, target.c_str(), "w") == 0 && file;
+	if (ok)
+	{
+		ok = fwrite(report.data(), 1, report.size(), file) == report.size();
+		ok = fclose(file) == 0 && ok;
+	}
+
+	ctx.Log((ok ? "Wrote a diagnostics report to " : "Couldn't write the diagnostics report ") + target + "\n");
+	return ok;
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "Calibration.h"
+#include "../CalibrationSolver/CalibrationSolver.h"
+
+#include <string>
+#include <vector>
+
+/**
+ * A plain text report for support tickets, put together from what the client already holds:
+ * the driver connection, the device registry, the profile as JSON, the last solve with a
+ * histogram of its per-sample errors, the last verification, the tick timings and the message
+ * log. Nothing is rendered, so a tray or headless run writes one without a GL window. Hold
+ * CalibrationMutex for all of these.
+ */
+
+// From the solve that just finished, rejected or not, keeps what the report shows of it.
+void RecordSolveDiagnostics(const CalibrationSolution &solution, const std::vector<SampleResidual> &residuals);
+
+std::string DiagnosticsReport(CalibrationContext &ctx);
+
+// Into the profile directory as diagnostics-<date>-<time>.txt when path is empty. Logs where
+// it went, returns false if it couldn't be written.
+bool WriteDiagnosticsReport(CalibrationContext &ctx, const std::string &path = "");
@@ -0,0 +1,347 @@
+#include "stdafx.h"
+#include "EventLog.h"
+#include "ProfileStore.h"
+
+#include <algorithm>
+#include <cstring>
+#include <ctime>
+#include <unordered_map>
+
+EventLog Events;
+
+struct EventInfo
+{
+	const char *name;
+	const char *format; // printf format taking the record's values, all as doubles.
+};
+
+static const EventInfo EventInfos[] = {
+	{ "Message", "" },
+	{ "EventsDropped", "%.0f events dropped, the event ring was full" },
+	{ "PoseCaptureOverrun", "Pose capture overrun, %.0f poses dropped" },
+	{ "LatencyEstimated", "Estimated reference latency: %.1f ms" },
+	{ "DriverUnavailable", "Space Calibrator driver unavailable, retrying in the background" },
+	{ "DriverConnected", "Connected to the Space Calibrator driver" },
+	{ "DriverContinuousCorrections", "Driver applied %.0f continuous corrections over %.0f samples" },
+	{ "DriverStoppedContinuous", "The driver stopped continuous calibration" },
+	{ "ContinuousDrift", "Continuous calibration drift: rotation %.2f deg, translation %.2f cm, correcting" },
+	{ "TrackingSystemNameFailed", "Failed to get tracking system name for id %.0f" },
+};
+
+static_assert(sizeof EventInfos / sizeof EventInfos[0] == (size_t) ClientEvent::Count, "every event needs an EventInfo");
+
+static void FormatEvent(const EventRecord &record, char *out, size_t size)
+{
+	if (record.event >= (uint16_t) ClientEvent::Count)
+	{
+		snprintf(out, size, "unknown event %u", record.event);
+		return;
+	}
+
+	const double *v = record.values;
+	snprintf(out, size, EventInfos[record.event].format, v[0], v[1], v[2], v[3], v[4], v[5]);
+}
+
+EventLog::EventLog()
+{
+	for (size_t i = 0; i < RingSize; i++)
+		ring[i].sequence.store(i, std::memory_order_relaxed);
+}
+
+EventLog::~EventLog()
+{
+	Stop();
+	if (file)
+		fclose(file);
+}
+
+// Bounded MPSC queue like the driver's log: producers claim a cell by advancing enqueuePos,
+// and each cell's sequence tells whether it's free for the producer of this lap or holds a
+// record for the writer.
+EventLog::Cell *EventLog::Claim(size_t &pos)
+{
+	pos = enqueuePos.load(std::memory_order_relaxed);
+	while (true)
+	{
+		Cell *cell = &ring[pos & (RingSize - 1)];
+		size_t sequence = cell->sequence.load(std::memory_order_acquire);
+		intptr_t diff = (intptr_t) sequence - (intptr_t) pos;
+		if (diff == 0)
+		{
+			if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+				return cell;
+		}
+		else if (diff < 0)
+		{
+			// Full, the writer hasn't caught up. Dropping beats blocking the calibration tick.
+			dropped.fetch_add(1, std::memory_order_relaxed);
+			return nullptr;
+		}
+		else
+		{
+			pos = enqueuePos.load(std::memory_order_relaxed);
+		}
+	}
+}
+
+void EventLog::Publish(Cell *cell, size_t pos)
+{
+	LARGE_INTEGER now;
+	QueryPerformanceCounter(&now);
+	cell->record.counter = now.QuadPart;
+	cell->record.thread = GetCurrentThreadId();
+	cell->sequence.store(pos + 1, std::memory_order_release);
+
+	if (!running.load(std::memory_order_acquire))
+	{
+		std::lock_guard<std::mutex> lock(drainMutex);
+		if (Drain() && file)
+			fflush(file);
+	}
+}
+
+void EventLog::Write(ClientEvent event, double a, double b, double c)
+{
+	size_t pos;
+	Cell *cell = Claim(pos);
+	if (!cell)
+		return;
+
+	auto &record = cell->record;
+	record.event = (uint16_t) event;
+	record.count = 3;
+	record.flags = 0;
+	record.values[0] = a;
+	record.values[1] = b;
+	record.values[2] = c;
+	std::fill(record.values + 3, record.values + EventRecord::MaxValues, 0.0);
+	Publish(cell, pos);
+}
+
+void EventLog::Text(const std::string &text)
+{
+	size_t offset = 0;
+	do
+	{
+		size_t pos;
+		Cell *cell = Claim(pos);
+		if (!cell)
+			return;
+
+		size_t bytes = std::min(text.size() - offset, EventRecord::MaxText);
+		auto &record = cell->record;
+		record.event = (uint16_t) ClientEvent::Message;
+		record.count = (uint8_t) bytes;
+		record.flags = offset + bytes < text.size() ? EventTextContinues : 0;
+		memcpy(record.text, text.data() + offset, bytes);
+		offset += bytes;
+		Publish(cell, pos);
+	} while (offset < text.size());
+}
+
+// Starts a new file, rolling the previous one over to events.1.bin, either the full one or the
+// one of the previous run.
+bool EventLog::OpenFile()
+{
+	if (fileFailed)
+		return false;
+
+	auto directory = ProfileDirectory();
+	if (directory.empty())
+	{
+		fileFailed = true;
+		return false;
+	}
+
+	CreateDirectoryA(directory.c_str(), nullptr);
+	auto path = directory + "\\events.bin";
+	if (file)
+		fclose(file);
+	MoveFileExA(path.c_str(), (directory + "\\events.1.bin").c_str(), MOVEFILE_REPLACE_EXISTING);
+
+	if (fopen_s(&file, path.c_str(), "wb") != 0)
+	{
+		file = nullptr;
+		fileFailed = true;
+		return false;
+	}
+
+	LARGE_INTEGER frequency, counter;
+	QueryPerformanceFrequency(&frequency);
+	QueryPerformanceCounter(&counter);
+	FILETIME now;
+	GetSystemTimeAsFileTime(&now);
+
+	EventFileHeader header = {};
+	header.magic = EventFileMagic;
+	header.version = EventFileVersion;
+	header.recordSize = sizeof(EventRecord);
+	header.counterFrequency = frequency.QuadPart;
+	header.counter = counter.QuadPart;
+	header.fileTime = ((uint64_t) now.dwHighDateTime << 32) | now.dwLowDateTime;
+	fwrite(&header, sizeof header, 1, file);
+	fileBytes = sizeof header;
+	return true;
+}
+
+// Writes out every queued record, the caller must hold drainMutex.
+bool EventLog::Drain()
+{
+	bool wrote = false;
+	uint64_t lost = dropped.exchange(0, std::memory_order_relaxed);
+	while (true)
+	{
+		auto &cell = ring[dequeuePos & (RingSize - 1)];
+		if (cell.sequence.load(std::memory_order_acquire) != dequeuePos + 1)
+			break;
+
+		if (!file || fileBytes + sizeof(EventRecord) > MaxFileBytes)
+			OpenFile();
+		if (file)
+		{
+			fwrite(&cell.record, sizeof(EventRecord), 1, file);
+			fileBytes += sizeof(EventRecord);
+		}
+
+#ifdef DEBUG_LOGS
+		if (cell.record.event == (uint16_t) ClientEvent::Message)
+		{
+			fwrite(cell.record.text, 1, cell.record.count, stderr);
+		}
+		else
+		{
+			char text[256];
+			FormatEvent(cell.record, text, sizeof text);
+			fprintf(stderr, "%s\n", text);
+		}
+#endif
+
+		cell.sequence.store(dequeuePos + RingSize, std::memory_order_release);
+		dequeuePos++;
+		wrote = true;
+	}
+
+	if (lost)
+	{
+		// Written here rather than queued, the ring may well be full again.
+		EventRecord record = {};
+		LARGE_INTEGER now;
+		QueryPerformanceCounter(&now);
+		record.counter = now.QuadPart;
+		record.thread = GetCurrentThreadId();
+		record.event = (uint16_t) ClientEvent::EventsDropped;
+		record.count = 1;
+		record.values[0] = (double) lost;
+		if (file || OpenFile())
+		{
+			fwrite(&record, sizeof record, 1, file);
+			fileBytes += sizeof record;
+		}
+		wrote = true;
+	}
+	return wrote;
+}
+
+void EventLog::RunWriter()
+{
+	while (WaitForSingleObject(stopEvent, 100) == WAIT_TIMEOUT)
+	{
+		std::lock_guard<std::mutex> lock(drainMutex);
+		if (Drain() && file)
+			fflush(file);
+	}
+}
+
+void EventLog::Start()
+{
+	if (running)
+		return;
+
+	stopEvent = CreateEvent(nullptr, FALSE, FALSE, nullptr);
+	if (!stopEvent)
+		return;
+
+	running = true;
+	writer = std::thread(&EventLog::RunWriter, this);
+}
+
+void EventLog::Stop()
+{
+	if (running)
+	{
+		SetEvent(stopEvent);
+		writer.join();
+		running = false;
+
+		CloseHandle(stopEvent);
+		stopEvent = nullptr;
+	}
+
+	// The file stays open, what's logged afterwards goes on in it.
+	std::lock_guard<std::mutex> lock(drainMutex);
+	Drain();
+	if (file)
+		fflush(file);
+}
+
+int DumpEventFile(const std::string &path)
+{
+	FILE *file;
+	if (fopen_s(&file, path.c_str(), "rb") != 0)
+	{
+		fprintf(stderr, "Couldn't open %s\n", path.c_str());
+		return -1;
+	}
+
+	EventFileHeader header;
+	if (fread(&header, sizeof header, 1, file) != 1 || header.magic != EventFileMagic ||
+		header.version != EventFileVersion || header.recordSize != sizeof(EventRecord) || header.counterFrequency <= 0)
+	{
+		fprintf(stderr, "%s isn't an event file of this version\n", path.c_str());
+		fclose(file);
+		return -1;
+	}
+
+	// FILETIME counts 100 ns intervals since 1601, time_t counts seconds since 1970.
+	double opened = (double) header.fileTime / 1e7 - 11644473600.0;
+
+	std::unordered_map<uint32_t, std::string> pending; // Message text by thread, until it ends.
+	EventRecord record;
+	while (fread(&record, sizeof record, 1, file) == 1)
+	{
+		if (record.event == (uint16_t) ClientEvent::Message)
+		{
+			auto &text = pending[record.thread];
+			text.append(record.text, std::min<size_t>(record.count, EventRecord::MaxText));
+			if (record.flags & EventTextContinues)
+				continue;
+		}
+
+		double seconds = opened + (double) (record.counter - header.counter) / (double) header.counterFrequency;
+		time_t wholeSeconds = (time_t) seconds;
+		tm local;
+		localtime_s(&local, &wholeSeconds);
+
+		printf("%02d:%02d:%02d.%03d %5u %-28s ", local.tm_hour, local.tm_min, local.tm_sec,
+			(int) ((seconds - (double) wholeSeconds) * 1000.0), record.thread,
+			record.event < (uint16_t) ClientEvent::Count ? EventInfos[record.event].name : "?");
+
+		if (record.event == (uint16_t) ClientEvent::Message)
+		{
+			auto &text = pending[record.thread];
+			while (!text.empty() && text.back() == '\n')
+				text.pop_back();
+			printf("%s\n", text.c_str());
+			text.clear();
+		}
+		else
+		{
+			char text[256];
+			FormatEvent(record, text, sizeof text);
+			printf("%s\n", text);
+		}
+	}
+
+	fclose(file);
+	return 0;
+}
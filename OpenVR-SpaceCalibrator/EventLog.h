@@ -0,0 +1,119 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+
+// Add new events at the end, the IDs are what the files hold. See EventInfos for how each is
+// printed.
+enum class ClientEvent : uint16_t
+{
+	Message, // Free text, continued over records of the same thread.
+	EventsDropped, // records, the ring was full
+	PoseCaptureOverrun, // poses dropped during continuous calibration
+	LatencyEstimated, // ms
+	DriverUnavailable,
+	DriverConnected,
+	DriverContinuousCorrections, // corrections, samples
+	DriverStoppedContinuous,
+	ContinuousDrift, // degrees, cm
+	TrackingSystemNameFailed, // OpenVR ID
+	Count
+};
+
+static const uint32_t EventFileMagic = 0x56454353; // "SCEV"
+static const uint32_t EventFileVersion = 1;
+
+// Starts every file, so its counters can be turned into wall clock time.
+struct EventFileHeader
+{
+	uint32_t magic;
+	uint32_t version;
+	uint32_t recordSize;
+	uint32_t reserved;
+	int64_t counterFrequency; // QueryPerformanceFrequency
+	int64_t counter; // QueryPerformanceCounter when the file was opened,
+	uint64_t fileTime; // and the system time then, as a FILETIME.
+};
+
+static const uint8_t EventTextContinues = 1 << 0; // The next Message record of the thread goes on.
+
+struct EventRecord
+{
+	static const size_t MaxValues = 6;
+	static const size_t MaxText = MaxValues * sizeof(double);
+
+	int64_t counter; // QueryPerformanceCounter.
+	uint32_t thread;
+	uint16_t event; // ClientEvent
+	uint8_t count; // Of values, or text bytes for a Message.
+	uint8_t flags;
+	union
+	{
+		double values[MaxValues];
+		char text[MaxText];
+	};
+};
+
+static_assert(sizeof(EventRecord) == 64, "event files are read by record size");
+
+/**
+ * The client's log, binary so a hot loop logs an event ID and a few numbers instead of
+ * formatting text. Records go through a fixed ring, like the driver's log, and are written
+ * unchanged by a background thread to events.bin in the profile directory, which rolls over
+ * to events.1.bin at MaxFileBytes. `OpenVR-SpaceCalibrator.exe -dumpevents <file>` prints a
+ * file as text. Before Start and after Stop every record is written synchronously, which
+ * covers the command line modes.
+ *
+ * Debug builds with DEBUG_LOGS print every record to the console too.
+ */
+class EventLog
+{
+public:
+	static const size_t RingSize = 4096; // Power of two.
+	static const uint64_t MaxFileBytes = 8 << 20;
+
+	EventLog();
+	~EventLog();
+
+	void Start();
+	void Stop();
+
+	void Write(ClientEvent event, double a = 0.0, double b = 0.0, double c = 0.0);
+	void Text(const std::string &text);
+
+private:
+	struct Cell
+	{
+		std::atomic<size_t> sequence;
+		EventRecord record;
+	};
+
+	Cell *Claim(size_t &pos);
+	void Publish(Cell *cell, size_t pos);
+	bool Drain(); // Holding drainMutex.
+	bool OpenFile();
+	void RunWriter();
+
+	Cell ring[RingSize];
+	std::atomic<size_t> enqueuePos{ 0 };
+	size_t dequeuePos = 0;
+	std::atomic<uint64_t> dropped{ 0 };
+
+	std::mutex drainMutex;
+	FILE *file = nullptr;
+	uint64_t fileBytes = 0;
+	bool fileFailed = false;
+
+	std::thread writer;
+	std::atomic<bool> running{ false };
+	void *stopEvent = nullptr; // HANDLE
+};
+
+extern EventLog Events;
+
+// Prints the records of an event file to stdout, returns the exit code.
+int DumpEventFile(const std::string &path);
@@ -0,0 +1,217 @@
+#include "stdafx.h"
+#include "IPCBenchmark.h"
+#include "IPCClient.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+static const double IPCBenchmarkSeconds = 2.0; // Per path and client count.
+
+enum IPCBenchmarkPath
+{
+	PathSingle, // One RequestSetDeviceTransform at a time, waiting for each response.
+	PathPipelined, // RequestSetDeviceTransform through SendAsync, as many in flight as IPCClient allows.
+	PathBatch, // RequestSetDeviceTransformBatch with every device.
+	PathSharedMemory, // Written straight into the driver's transform table.
+};
+
+static const char *PathNames[] = { "single", "pipelined", "batch", "shared memory" };
+
+struct BenchmarkClientResult
+{
+	std::vector<double> latencies; // Microseconds, per request.
+	uint64_t transforms = 0;
+	std::string error;
+};
+
+// Resends what the driver applies already, the drift stays as it is.
+static protocol::SetDeviceTransform ResendTransform(uint32_t openVRID, const protocol::DeviceTransform &tf)
+{
+	return protocol::SetDeviceTransform(openVRID, tf.enabled, tf.translation, tf.rotation, tf.scale);
+}
+
+static double MicrosecondsSince(std::chrono::steady_clock::time_point start)
+{
+	return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+}
+
+static void RunBenchmarkClient(IPCBenchmarkPath path, uint32_t index, const protocol::DeviceTransforms &current,
+	std::atomic<int> &connected, std::atomic<bool> &stop, BenchmarkClientResult &result)
+{
+	try
+	{
+		IPCClient driver;
+		driver.Connect();
+		if (path == PathBatch && !driver.Supports(protocol::CapabilityTransformBatch))
+			throw std::runtime_error("driver doesn't take transform batches");
+		if (path == PathSharedMemory && !driver.Shared())
+			throw std::runtime_error("driver shared memory unavailable");
+
+		protocol::SetDeviceTransform transforms[vr::k_unMaxTrackedDeviceCount];
+		for (uint32_t id = 0; id < vr::k_unMaxTrackedDeviceCount; id++)
+			transforms[id] = ResendTransform(id, current.devices[id]);
+
+		protocol::Request single(protocol::RequestSetDeviceTransform);
+		single.size = sizeof single.setDeviceTransform;
+
+		protocol::Request batch(protocol::RequestSetDeviceTransformBatch);
+		batch.setDeviceTransformBatch.count = vr::k_unMaxTrackedDeviceCount;
+		std::copy(std::begin(transforms), std::end(transforms), batch.setDeviceTransformBatch.transforms);
+		batch.size = batch.setDeviceTransformBatch.PayloadSize();
+
+		connected++;
+		while (connected.load() > 0 && !stop.load())
+			std::this_thread::yield();
+
+		// Clients start on different devices, so they don't all write the same one.
+		uint32_t device = index;
+		while (!stop.load(std::memory_order_relaxed))
+		{
+			auto sent = std::chrono::steady_clock::now();
+			switch (path)
+			{
+			case PathSingle:
+				single.setDeviceTransform = transforms[device++ % vr::k_unMaxTrackedDeviceCount];
+				if (driver.SendBlocking(single).type != protocol::ResponseSuccess)
+					throw std::runtime_error("transform request failed");
+				result.latencies.push_back(MicrosecondsSince(sent));
+				result.transforms++;
+				break;
+
+			case PathPipelined:
+				single.setDeviceTransform = transforms[device++ % vr::k_unMaxTrackedDeviceCount];
+				driver.SendAsync(single, [&result, sent](const protocol::Response &response) {
+					if (response.type != protocol::ResponseSuccess)
+						result.error = "transform request failed";
+					result.latencies.push_back(MicrosecondsSince(sent));
+					result.transforms++;
+				});
+				driver.PollResponses();
+				break;
+
+			case PathBatch:
+				if (driver.SendBlocking(batch).type != protocol::ResponseSuccess)
+					throw std::runtime_error("transform batch failed");
+				result.latencies.push_back(MicrosecondsSince(sent));
+				result.transforms += vr::k_unMaxTrackedDeviceCount;
+				break;
+
+			case PathSharedMemory:
+				driver.SetDeviceTransforms(transforms, vr::k_unMaxTrackedDeviceCount);
+				result.latencies.push_back(MicrosecondsSince(sent));
+				result.transforms += vr::k_unMaxTrackedDeviceCount;
+				break;
+			}
+
+			if (!driver.Connected())
+				throw std::runtime_error("lost the connection to the driver");
+			if (!result.error.empty())
+				return;
+		}
+
+		// Responses still in flight count, they were sent within the run.
+		while (driver.PendingRequests() && driver.Connected())
+			driver.PollResponses();
+	}
+	catch (std::runtime_error &e)
+	{
+		result.error = e.what();
+		connected++;
+	}
+}
+
+static double LatencyPercentile(const std::vector<double> &sorted, double fraction)
+{
+	if (sorted.empty())
+		return 0.0;
+	size_t index = (size_t) (fraction * (double) (sorted.size() - 1) + 0.5);
+	return sorted[std::min(index, sorted.size() - 1)];
+}
+
+// Returns false when a client failed, with its error printed.
+static bool RunBenchmarkPath(IPCBenchmarkPath path, uint32_t clients, const protocol::DeviceTransforms &current)
+{
+	std::vector<BenchmarkClientResult> results(clients);
+	std::vector<std::thread> threads;
+	std::atomic<int> connected(0);
+	std::atomic<bool> stop(false);
+
+	for (uint32_t i = 0; i < clients; i++)
+		threads.push_back(std::thread(RunBenchmarkClient, path, i, std::cref(current), std::ref(connected), std::ref(stop), std::ref(results[i])));
+
+	// Timed from when the last client has connected, which releases them all at once.
+	while (connected.load() < (int) clients)
+		std::this_thread::yield();
+	connected = 0;
+	auto start = std::chrono::steady_clock::now();
+	std::this_thread::sleep_for(std::chrono::duration<double>(IPCBenchmarkSeconds));
+	stop = true;
+
+	for (auto &thread : threads)
+		thread.join();
+	double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	std::vector<double> latencies;
+	uint64_t transforms = 0;
+	for (auto &result : results)
+	{
+		if (!result.error.empty())
+		{
+			printf("%8u %-14s %s\n", clients, PathNames[path], result.error.c_str());
+			return false;
+		}
+		latencies.insert(latencies.end(), result.latencies.begin(), result.latencies.end());
+		transforms += result.transforms;
+	}
+
+	std::sort(latencies.begin(), latencies.end());
+	double total = 0.0;
+	for (double latency : latencies)
+		total += latency;
+
+	printf("%8u %-14s %10.1f %10.1f %10.1f %10.1f %12.0f %12.0f\n", clients, PathNames[path],
+		latencies.empty() ? 0.0 : total / latencies.size(), LatencyPercentile(latencies, 0.5), LatencyPercentile(latencies, 0.99),
+		latencies.empty() ? 0.0 : latencies.back(), latencies.size() / elapsed, transforms / elapsed);
+	return true;
+}
+
+int RunIPCBenchmark(uint32_t clients)
+{
+	protocol::DeviceTransforms current;
+	try
+	{
+		IPCClient driver;
+		driver.Connect();
+		if (!driver.ReadDeviceTransforms(current))
+			throw std::runtime_error("driver doesn't report its transforms, they can't be written back unchanged");
+	}
+	catch (std::runtime_error &e)
+	{
+		fprintf(stderr, "%s\n", e.what());
+		return -1;
+	}
+
+	printf("%.1f s per run, latencies are round trips, writes for shared memory\n", IPCBenchmarkSeconds);
+	printf("%8s %-14s %10s %10s %10s %10s %12s %12s\n", "clients", "path", "mean us", "p50 us", "p99 us", "max us", "requests/s", "transforms/s");
+
+	std::vector<uint32_t> clientCounts = { 1 };
+	if (clients > 1)
+		clientCounts.push_back(clients);
+
+	int status = 0;
+	for (uint32_t count : clientCounts)
+	{
+		for (int path = PathSingle; path <= PathSharedMemory; path++)
+		{
+			if (!RunBenchmarkPath((IPCBenchmarkPath) path, count, current))
+				status = -1;
+		}
+	}
+	return status;
+}
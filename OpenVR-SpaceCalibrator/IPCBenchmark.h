@@ -0,0 +1,9 @@
+#pragma once
+
+#include <cstdint>
+
+// Measures the driver's transform paths: the pipe with one request at a time, pipelined and
+// batched, and the shared memory table. Each runs from one connection, then from the given
+// number of connections at once. Every transform written is one the driver already has, read
+// back first, so running it doesn't move devices. Results go to stdout, returns the exit code.
+int RunIPCBenchmark(uint32_t clients);
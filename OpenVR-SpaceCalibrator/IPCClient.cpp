@@ -2,6 +2,10 @@
 #include "IPCClient.h"
 
 #include <string>
+#include <algorithm>
+
+// Requests in flight before SendAsync waits for the oldest response.
+static const size_t MaxPendingRequests = 16;
 
 static std::string LastErrorString(DWORD lastError)
 {
@@ -18,31 +22,57 @@ static std::string LastErrorString(DWORD lastError)
 
 IPCClient::~IPCClient()
 {
-	if (pipe && pipe != INVALID_HANDLE_VALUE)
-		CloseHandle(pipe);
+	Disconnect();
 }
 
 void IPCClient::Connect()
 {
-	LPTSTR pipeName = TEXT(OPENVR_SPACECALIBRATOR_PIPE_NAME);
-
-	WaitNamedPipe(pipeName, 1000);
-	pipe = CreateFile(pipeName, GENERIC_READ | GENERIC_WRITE, 0, 0, OPEN_EXISTING, 0, 0);
-
-	if (pipe == INVALID_HANDLE_VALUE)
+	WaitNamedPipe(TEXT(OPENVR_SPACECALIBRATOR_PIPE_NAME), 1000);
+	if (!TryConnect())
 	{
 		throw std::runtime_error("Space Calibrator driver unavailable. Make sure SteamVR is running, and the Space Calibrator addon is enabled in SteamVR settings.");
 	}
+}
+
+bool IPCClient::TryConnect()
+{
+	if (Connected())
+		return true;
+
+	Disconnect();
+	pipe = CreateFile(TEXT(OPENVR_SPACECALIBRATOR_PIPE_NAME), GENERIC_READ | GENERIC_WRITE, 0, 0, OPEN_EXISTING, FILE_FLAG_OVERLAPPED, 0);
+	if (pipe == INVALID_HANDLE_VALUE)
+		return false;
 
 	DWORD mode = PIPE_READMODE_MESSAGE;
 	if (!SetNamedPipeHandleState(pipe, &mode, 0, 0))
 	{
-		throw std::runtime_error("Couldn't set pipe mode. Error: " + LastErrorString(GetLastError()));
+		ConnectionLost("setting the pipe mode", GetLastError());
+		return false;
+	}
+
+	readOverlap.hEvent = CreateEvent(0, TRUE, FALSE, 0);
+	writeOverlap.hEvent = CreateEvent(0, TRUE, FALSE, 0);
+	if (!readOverlap.hEvent || !writeOverlap.hEvent)
+	{
+		ConnectionLost("creating IPC events", GetLastError());
+		return false;
+	}
+
+	protocol::Request handshake(protocol::RequestHandshake);
+	handshake.protocol = protocol::Protocol();
+	handshake.size = sizeof handshake.protocol;
+
+	auto response = SendBlocking(handshake);
+	if (!Connected())
+	{
+		Disconnect();
+		return false;
 	}
 
-	auto response = SendBlocking(protocol::Request(protocol::RequestHandshake));
-	if (response.type != protocol::ResponseHandshake || response.protocol.version != protocol::Version)
+	if (response.type != protocol::ResponseHandshake || response.size != sizeof response.protocol || response.protocol.version != protocol::Version)
 	{
+		Disconnect();
 		throw std::runtime_error(
 			"Incorrect driver version installed, try reinstalling OpenVR-SpaceCalibrator. (Client: " +
 			std::to_string(protocol::Version) +
@@ -51,43 +81,274 @@ void IPCClient::Connect()
 			")"
 		);
 	}
+
+	capabilities = response.protocol.capabilities & protocol::Capabilities;
+	if (capabilities != protocol::Capabilities)
+		std::cerr << "Driver lacks capabilities 0x" << std::hex << (protocol::Capabilities & ~capabilities) << std::dec << ", using fallbacks" << std::endl;
+
+	if (Supports(protocol::CapabilitySharedMemory))
+		OpenSharedMemory();
+	return true;
+}
+
+void IPCClient::Disconnect()
+{
+	ClosePipe();
+
+	if (shared)
+		UnmapViewOfFile(shared);
+	if (sharedMapping)
+		CloseHandle(sharedMapping);
+	shared = nullptr;
+	sharedMapping = nullptr;
+}
+
+void IPCClient::ClosePipe()
+{
+	if (pipe != INVALID_HANDLE_VALUE)
+	{
+		if (readPending)
+		{
+			DWORD bytesRead;
+			CancelIo(pipe);
+			GetOverlappedResult(pipe, &readOverlap, &bytesRead, TRUE);
+		}
+		CloseHandle(pipe);
+	}
+	pipe = INVALID_HANDLE_VALUE;
+	readPending = false;
+	pending.clear();
+
+	if (readOverlap.hEvent)
+		CloseHandle(readOverlap.hEvent);
+	if (writeOverlap.hEvent)
+		CloseHandle(writeOverlap.hEvent);
+	readOverlap = {};
+	writeOverlap = {};
+}
+
+void IPCClient::ConnectionLost(const char *operation, DWORD lastError)
+{
+	std::cerr << "Lost connection to the driver while " << operation << ". Error: " << LastErrorString(lastError) << std::endl;
+	ClosePipe();
+}
+
+void IPCClient::OpenSharedMemory()
+{
+	sharedMapping = OpenFileMappingA(FILE_MAP_ALL_ACCESS, FALSE, OPENVR_SPACECALIBRATOR_SHARED_MEMORY_NAME);
+	if (!sharedMapping)
+	{
+		std::cerr << "Driver shared memory unavailable, using the pipe for transforms. Error: " << LastErrorString(GetLastError()) << std::endl;
+		return;
+	}
+
+	shared = (protocol::SharedMemory *) MapViewOfFile(sharedMapping, FILE_MAP_ALL_ACCESS, 0, 0, sizeof(protocol::SharedMemory));
+	if (!shared)
+	{
+		std::cerr << "Couldn't map driver shared memory, using the pipe for transforms. Error: " << LastErrorString(GetLastError()) << std::endl;
+		CloseHandle(sharedMapping);
+		sharedMapping = nullptr;
+	}
+}
+
+void IPCClient::SetDeviceTransforms(const protocol::SetDeviceTransform *transforms, uint32_t count)
+{
+	if (shared)
+	{
+		shared->transforms.Write(transforms, count);
+		return;
+	}
+
+	if (count == 1 || !Supports(protocol::CapabilityTransformBatch))
+	{
+		protocol::Request request(protocol::RequestSetDeviceTransform);
+		request.size = sizeof request.setDeviceTransform;
+		for (uint32_t i = 0; i < count; i++)
+		{
+			request.setDeviceTransform = transforms[i];
+			SendAsync(request);
+		}
+		return;
+	}
+
+	protocol::Request request(protocol::RequestSetDeviceTransformBatch);
+	request.setDeviceTransformBatch.count = count;
+	for (uint32_t i = 0; i < count; i++)
+		request.setDeviceTransformBatch.transforms[i] = transforms[i];
+	request.size = request.setDeviceTransformBatch.PayloadSize();
+	SendAsync(request);
+}
+
+bool IPCClient::ReadDeviceTransforms(protocol::DeviceTransforms &transforms)
+{
+	if (shared)
+	{
+		shared->transforms.Snapshot(transforms);
+		return true;
+	}
+	if (!Supports(protocol::CapabilityTransformReadback))
+		return false;
+
+	auto response = SendBlocking(protocol::Request(protocol::RequestGetDeviceTransforms));
+	if (response.type != protocol::ResponseDeviceTransforms || response.size != sizeof response.deviceTransforms)
+		return false;
+
+	transforms = response.deviceTransforms;
+	return true;
 }
 
 protocol::Response IPCClient::SendBlocking(const protocol::Request &request)
 {
-	Send(request);
-	return Receive();
+	protocol::Response response(protocol::ResponseInvalid);
+	bool done = false;
+
+	SendAsync(request, [&](const protocol::Response &r) { response = r; done = true; });
+	while (!done && Connected())
+		Receive(true);
+
+	return response;
+}
+
+uint32_t IPCClient::SendAsync(const protocol::Request &request, ResponseCallback callback)
+{
+	while (Connected() && pending.size() >= MaxPendingRequests)
+		Receive(true);
+
+	uint32_t id = nextRequestID++;
+	if (!Connected() || !Send(request, id))
+		return id;
+
+	pending.push_back({ id, request.type, std::chrono::steady_clock::now(), callback });
+	return id;
+}
+
+void IPCClient::PollResponses()
+{
+	while (!pending.empty() && Receive(false)) { }
+
+	if (Connected() && pending.empty())
+	{
+		// A server that closed its end fails the peek with ERROR_BROKEN_PIPE.
+		DWORD available;
+		if (!PeekNamedPipe(pipe, nullptr, 0, nullptr, &available, nullptr))
+			ConnectionLost("polling", GetLastError());
+	}
 }
 
-void IPCClient::Send(const protocol::Request &request)
+bool IPCClient::Send(const protocol::Request &request, uint32_t id)
 {
+	if (request.size > protocol::MaxPayloadSize)
+	{
+		throw std::runtime_error("IPC request too large: " + std::to_string(request.size));
+	}
+
+	// Only the used part of the message is copied and sent.
+	memcpy(&writeBuffer, &request, request.MessageSize());
+	writeBuffer.id = id;
+
+	// Writes only wait for the pipe to accept the message, never for the driver to answer it.
 	DWORD bytesWritten;
-	BOOL success = WriteFile(pipe, &request, sizeof request, &bytesWritten, 0);
+	BOOL success = WriteFile(pipe, &writeBuffer, writeBuffer.MessageSize(), &bytesWritten, &writeOverlap);
+	if (!success && GetLastError() == ERROR_IO_PENDING)
+	{
+		return WaitForIO(writeOverlap, bytesWritten, "writing a request");
+	}
+
 	if (!success)
 	{
-		throw std::runtime_error("Error writing IPC request. Error: " + LastErrorString(GetLastError()));
+		ConnectionLost("writing a request", GetLastError());
+		return false;
 	}
+	return true;
 }
 
-protocol::Response IPCClient::Receive()
+// Completes an overlapped operation within Timeout. ERROR_MORE_DATA counts as success, the
+// caller checks the message size.
+bool IPCClient::WaitForIO(OVERLAPPED &overlap, DWORD &bytes, const char *operation)
 {
-	protocol::Response response(protocol::ResponseInvalid);
-	DWORD bytesRead;
+	if (WaitForSingleObject(overlap.hEvent, Timeout) == WAIT_TIMEOUT)
+	{
+		// The buffers must outlive the operation, so it is cancelled and completed first.
+		CancelIo(pipe);
+		GetOverlappedResult(pipe, &overlap, &bytes, TRUE);
+		if (&overlap == &readOverlap)
+			readPending = false;
 
-	BOOL success = ReadFile(pipe, &response, sizeof response, &bytesRead, 0);
-	if (!success)
+		ConnectionLost(operation, ERROR_TIMEOUT);
+		return false;
+	}
+
+	if (!GetOverlappedResult(pipe, &overlap, &bytes, FALSE) && GetLastError() != ERROR_MORE_DATA)
+	{
+		if (&overlap == &readOverlap)
+			readPending = false;
+
+		ConnectionLost(operation, GetLastError());
+		return false;
+	}
+	return true;
+}
+
+// Completes the next response, starting a read if needed. Returns false if wait is
+// false and nothing has arrived yet, or if the connection was lost.
+bool IPCClient::Receive(bool wait)
+{
+	if (!readPending)
 	{
+		BOOL success = ReadFile(pipe, &readBuffer, sizeof readBuffer, nullptr, &readOverlap);
 		DWORD lastError = GetLastError();
+		if (!success && lastError != ERROR_IO_PENDING && lastError != ERROR_MORE_DATA)
+		{
+			ConnectionLost("reading a response", lastError);
+			return false;
+		}
+		readPending = true;
+	}
+
+	DWORD bytesRead;
+	if (wait)
+	{
+		if (!WaitForIO(readOverlap, bytesRead, "waiting for a response"))
+			return false;
+	}
+	else if (!GetOverlappedResult(pipe, &readOverlap, &bytesRead, FALSE))
+	{
+		DWORD lastError = GetLastError();
+		if (lastError == ERROR_IO_INCOMPLETE)
+			return false;
+
 		if (lastError != ERROR_MORE_DATA)
 		{
-			throw std::runtime_error("Error reading IPC response. Error: " + LastErrorString(lastError));
+			readPending = false;
+			ConnectionLost("reading a response", lastError);
+			return false;
 		}
 	}
+	readPending = false;
 
-	if (bytesRead != sizeof response)
+	if (bytesRead < protocol::MessageHeaderSize || bytesRead != readBuffer.MessageSize())
 	{
 		throw std::runtime_error("Invalid IPC response with size " + std::to_string(bytesRead));
 	}
 
-	return response;
+	if (pending.empty() || pending.front().id != readBuffer.id)
+	{
+		throw std::runtime_error("Unexpected IPC response with id " + std::to_string(readBuffer.id));
+	}
+
+	auto &request = pending.front();
+	double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - request.sent).count();
+	auto &stats = latency[request.type < MaxLatencyTypes ? request.type : 0];
+	stats.count++;
+	stats.total += elapsed;
+	stats.max = std::max(stats.max, elapsed);
+	stats.last = elapsed;
+	stats.recent.Add(elapsed);
+
+	auto callback = request.callback;
+	pending.pop_front();
+
+	if (callback)
+		callback(readBuffer);
+	return true;
 }
@@ -1,18 +1,107 @@
 #pragma once
 
 #include "../Protocol.h"
+#include "ClientTimings.h"
+
+#include <chrono>
+#include <deque>
+#include <functional>
+
+// Round trip times of the requests of one protocol::RequestType, in seconds.
+struct RequestLatency
+{
+	uint64_t count = 0;
+	double total = 0, max = 0, last = 0;
+	TimingHistory recent;
+
+	double Mean() const { return count ? total / count : 0.0; }
+};
 
 class IPCClient
 {
 public:
+	typedef std::function<void(const protocol::Response &)> ResponseCallback;
+
+	// No single pipe operation waits longer. A driver that takes longer to take a request or
+	// to answer one counts as gone, the connection is dropped and has to be made again.
+	static const DWORD Timeout = 1000; // ms
+	static const uint32_t MaxLatencyTypes = 16;
+
 	~IPCClient();
 
+	// Waits up to a second for the driver and throws if it doesn't answer.
 	void Connect();
+
+	// Never waits for the pipe, returns false if the driver isn't running or is busy. Still
+	// throws when the driver answers with a different protocol version, retrying won't help.
+	bool TryConnect();
+
+	// Drops the pipe, the shared memory and any requests in flight, their callbacks never run.
+	// Pipe errors only drop the pipe instead of throwing. The shared memory stays mapped until
+	// Disconnect, so readers pointing into it can be closed first.
+	void Disconnect();
+	bool Connected() const { return pipe != INVALID_HANDLE_VALUE; }
+
+	// The protocol::Capability bits both ends support, from the last handshake. Requests
+	// of a missing capability get ResponseInvalid from the driver.
+	uint32_t Capabilities() const { return capabilities; }
+	bool Supports(uint32_t capability) const { return (capabilities & capability) == capability; }
+
+	// Returns ResponseInvalid if the connection is lost before the response arrives.
 	protocol::Response SendBlocking(const protocol::Request &request);
 
-	void Send(const protocol::Request &request);
-	protocol::Response Receive();
+	// Sends without waiting for the driver. Responses arrive in request order, and their
+	// callbacks run from PollResponses or while a later blocking call waits. Dropped while
+	// disconnected.
+	uint32_t SendAsync(const protocol::Request &request, ResponseCallback callback = ResponseCallback());
+
+	// Dispatches responses that have already arrived, never blocks. With nothing in flight it
+	// checks whether the driver is still there, so a restarted SteamVR is noticed even while
+	// transforms only go through shared memory.
+	void PollResponses();
+	size_t PendingRequests() const { return pending.size(); }
+
+	// Writes straight into the driver's transform table when shared memory is mapped,
+	// otherwise falls back to a pipe request, one per device for drivers without batches.
+	void SetDeviceTransforms(const protocol::SetDeviceTransform *transforms, uint32_t count);
+
+	protocol::SharedMemory *Shared() const { return shared; }
+
+	// The transforms the driver applies right now, read from shared memory when it's mapped and
+	// with a blocking request otherwise. Returns false when neither is available.
+	bool ReadDeviceTransforms(protocol::DeviceTransforms &transforms);
+
+	// Kept across reconnects. Unknown types share the RequestInvalid slot.
+	const RequestLatency &Latency(uint32_t requestType) const { return latency[requestType < MaxLatencyTypes ? requestType : 0]; }
 
 private:
+	bool Send(const protocol::Request &request, uint32_t id);
+	bool Receive(bool wait);
+	void OpenSharedMemory();
+	void ClosePipe();
+	void ConnectionLost(const char *operation, DWORD lastError);
+
+	struct PendingRequest
+	{
+		uint32_t id;
+		uint32_t type;
+		std::chrono::steady_clock::time_point sent;
+		ResponseCallback callback;
+	};
+
+	RequestLatency latency[MaxLatencyTypes];
+	bool WaitForIO(OVERLAPPED &overlap, DWORD &bytes, const char *operation);
+
+	std::deque<PendingRequest> pending;
+	uint32_t nextRequestID = 1;
+
 	HANDLE pipe = INVALID_HANDLE_VALUE;
-};
\ No newline at end of file
+	OVERLAPPED readOverlap = {}, writeOverlap = {};
+	bool readPending = false;
+	protocol::Request writeBuffer;
+	protocol::Response readBuffer;
+
+	HANDLE sharedMapping = nullptr;
+	protocol::SharedMemory *shared = nullptr;
+	uint32_t capabilities = 0;
+};
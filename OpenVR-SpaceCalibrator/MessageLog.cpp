@@ -0,0 +1,70 @@
+#include "stdafx.h"
+#include "MessageLog.h"
+
+#include <algorithm>
+
+MessageLog::Line &MessageLog::PushLine(Line::Type type)
+{
+	if (count == Capacity)
+	{
+		start = (start + 1) % Capacity;
+		dropped++;
+	}
+	else
+		count++;
+
+	// Reuses the string's buffer from the line this slot held before.
+	Line &line = Back();
+	line.type = type;
+	line.text.clear();
+	line.open = false;
+	line.progress = line.target = 0;
+	return line;
+}
+
+void MessageLog::Append(const std::string &text)
+{
+	size_t pos = 0;
+	while (pos < text.size())
+	{
+		Line *line = (count > 0 && Back().type == Line::Text && Back().open) ? &Back() : &PushLine(Line::Text);
+
+		size_t end = text.find('\n', pos);
+		size_t length = (end == std::string::npos ? text.size() : end) - pos;
+		if (line->text.size() < MaxLineLength)
+			line->text.append(text, pos, std::min(length, MaxLineLength - line->text.size()));
+
+		line->open = end == std::string::npos;
+		pos = line->open ? text.size() : end + 1;
+	}
+	generation++;
+}
+
+void MessageLog::Append(const MessageLog &other)
+{
+	for (size_t i = 0; i < other.Size(); i++)
+	{
+		const Line &line = other[i];
+		if (line.type == Line::Text)
+			Append(line.open ? line.text : line.text + "\n");
+	}
+}
+
+void MessageLog::Progress(int current, int target)
+{
+	bool continues = count > 0 && Back().type == Line::Progress;
+	Line &line = continues ? Back() : PushLine(Line::Progress);
+	if (continues && line.progress == current && line.target == target)
+		return;
+
+	line.progress = current;
+	line.target = target;
+	generation++;
+}
+
+void MessageLog::Clear()
+{
+	dropped += count;
+	start = count = 0;
+	generation++;
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * Log shown in the calibration progress popup. Text is split into lines as it arrives and
+ * kept in a ring of Capacity lines, so continuous calibration can log forever without the
+ * log growing. Every change bumps the generation, which the UI compares to notice new lines.
+ */
+class MessageLog
+{
+public:
+	static const size_t Capacity = 256;
+	static const size_t MaxLineLength = 512; // Longer lines are cut off.
+
+	struct Line
+	{
+		enum Type
+		{
+			Text,
+			Progress
+		} type = Text;
+
+		std::string text;
+		bool open = false; // Text line that hasn't seen its newline yet, the next append continues it.
+		int progress = 0, target = 0;
+	};
+
+	MessageLog() : lines(Capacity) { }
+
+	// Continues the last line if it is still open.
+	void Append(const std::string &text);
+	void Append(const MessageLog &other);
+
+	// Updates the last line if it is a progress bar, otherwise starts one.
+	void Progress(int current, int target);
+
+	void Clear();
+
+	size_t Size() const { return count; }
+	bool Empty() const { return count == 0; }
+
+	// Oldest first.
+	const Line &operator[](size_t i) const { return lines[(start + i) % Capacity]; }
+
+	// Numbers lines in the order they arrived. A line keeps its number while it stays in the
+	// ring, so the UI can cache what it works out per line.
+	uint64_t Sequence(size_t i) const { return dropped + i; }
+
+	uint64_t Generation() const { return generation; }
+
+private:
+	Line &Back() { return lines[(start + count - 1) % Capacity]; }
+	Line &PushLine(Line::Type type);
+
+	std::vector<Line> lines;
+	size_t start = 0, count = 0;
+	uint64_t dropped = 0; // Lines that have left the ring, through Clear too.
+	uint64_t generation = 0;
+};
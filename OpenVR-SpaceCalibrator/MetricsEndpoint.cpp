@@ -0,0 +1,350 @@
+#include "stdafx.h"
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#include "MetricsEndpoint.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+
+#pragma comment(lib, "ws2_32.lib")
+
+MetricsEndpoint Metrics;
+
+static const DWORD AcceptTimeout = 250; // ms, how long Stop may wait for the server.
+static const DWORD ClientTimeout = 1000; // ms, a scraper slower than this is dropped.
+static const size_t MaxRequestBytes = 4096;
+
+// Label values of protocol::RequestType.
+static const char *const RequestTypeLabels[MetricsSnapshot::RequestTypes] = {
+	"other", "handshake", "transform", "transform_batch", "pose_hook_stats", "tracking_system_rules",
+	"continuous_calibration", "continuous_status", "driver_stats", "get_transforms", "pose_filters", "pose_hook_mode",
+};
+
+MetricsEndpoint::~MetricsEndpoint()
+{
+	Stop();
+}
+
+bool MetricsEndpoint::Start(uint16_t port)
+{
+	Stop();
+	if (port == 0)
+		return true;
+
+	WSADATA wsa;
+	if (WSAStartup(MAKEWORD(2, 2), &wsa) != 0)
+	{
+		std::cerr << "Couldn't start Winsock for the metrics endpoint" << std::endl;
+		return false;
+	}
+
+	SOCKET s = ::socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	bool ok = s != INVALID_SOCKET;
+
+	// On every interface, the scraper runs on another machine.
+	sockaddr_in local = {};
+	local.sin_family = AF_INET;
+	local.sin_port = htons(port);
+	local.sin_addr.s_addr = htonl(INADDR_ANY);
+	ok = ok && bind(s, (const sockaddr *) &local, sizeof local) == 0;
+	ok = ok && listen(s, 4) == 0;
+
+	if (!ok)
+	{
+		std::cerr << "Couldn't open metrics port " << port << ": " << WSAGetLastError() << std::endl;
+		if (s != INVALID_SOCKET)
+			closesocket(s);
+		WSACleanup();
+		return false;
+	}
+
+	socket = (uintptr_t) s;
+	socketOpen = true;
+	stopping = false;
+	server = std::thread(&MetricsEndpoint::RunServer, this);
+	return true;
+}
+
+void MetricsEndpoint::Stop()
+{
+	if (!socketOpen)
+		return;
+
+	stopping = true;
+	if (server.joinable())
+		server.join();
+
+	closesocket((SOCKET) socket);
+	socketOpen = false;
+	WSACleanup();
+}
+
+void MetricsEndpoint::Publish(const MetricsSnapshot &next)
+{
+	uint32_t current = sequence.load(std::memory_order_relaxed);
+	sequence.store(current + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+	snapshot = next;
+	sequence.store(current + 2, std::memory_order_release);
+}
+
+// Returns false if the tick was in the middle of publishing, call again.
+bool MetricsEndpoint::Read(MetricsSnapshot &out) const
+{
+	uint32_t before = sequence.load(std::memory_order_acquire);
+	if (before & 1)
+		return false;
+
+	out = snapshot;
+	std::atomic_thread_fence(std::memory_order_acquire);
+	return sequence.load(std::memory_order_relaxed) == before;
+}
+
+void MetricsEndpoint::RunServer()
+{
+	SOCKET listener = (SOCKET) socket;
+	while (!stopping)
+	{
+		fd_set readable;
+		FD_ZERO(&readable);
+		FD_SET(listener, &readable);
+		timeval timeout = { 0, (long) AcceptTimeout * 1000 };
+		if (select(0, &readable, nullptr, nullptr, &timeout) <= 0)
+			continue;
+
+		SOCKET client = accept(listener, nullptr, nullptr);
+		if (client == INVALID_SOCKET)
+			continue;
+
+		DWORD clientTimeout = ClientTimeout;
+		setsockopt(client, SOL_SOCKET, SO_RCVTIMEO, (const char *) &clientTimeout, sizeof clientTimeout);
+		setsockopt(client, SOL_SOCKET, SO_SNDTIMEO, (const char *) &clientTimeout, sizeof clientTimeout);
+		Serve((uintptr_t) client);
+		closesocket(client);
+	}
+}
+
+static void SendAll(SOCKET client, const std::string &data)
+{
+	size_t sent = 0;
+	while (sent < data.size())
+	{
+		int result = send(client, data.data() + sent, (int) (data.size() - sent), 0);
+		if (result <= 0)
+			return;
+		sent += result;
+	}
+}
+
+void MetricsEndpoint::Serve(uintptr_t clientSocket)
+{
+	SOCKET client = (SOCKET) clientSocket;
+
+	// Only the request line matters, the headers are read up to their end and ignored.
+	char request[MaxRequestBytes + 1];
+	size_t received = 0;
+	while (received < MaxRequestBytes)
+	{
+		int result = recv(client, request + received, (int) (MaxRequestBytes - received), 0);
+		if (result <= 0)
+			return;
+		received += result;
+		request[received] = 0;
+		if (strstr(request, "\r\n\r\n"))
+			break;
+	}
+
+	const char *path = "GET /metrics";
+	size_t pathLength = strlen(path);
+	bool found = received > pathLength && strncmp(request, path, pathLength) == 0 &&
+		(request[pathLength] == ' ' || request[pathLength] == '?');
+
+	std::string body, status = "200 OK";
+	MetricsSnapshot current;
+	bool read = false;
+	for (int attempt = 0; attempt < 100 && !read; attempt++)
+	{
+		read = Read(current);
+		if (!read)
+			std::this_thread::yield();
+	}
+
+	if (!found)
+	{
+		status = "404 Not Found";
+		body = "Metrics are at /metrics\n";
+	}
+	else if (!read || !sequence.load(std::memory_order_relaxed))
+	{
+		status = "503 Service Unavailable";
+		body = "No metrics yet\n";
+	}
+	else
+	{
+		int64_t now = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+		FormatMetrics(current, now, body);
+	}
+
+	char header[256];
+	snprintf(header, sizeof header, "HTTP/1.1 %s\r\nContent-Type: text/plain; version=0.0.4; charset=utf-8\r\n"
+		"Content-Length: %zu\r\nConnection: close\r\n\r\n", status.c_str(), body.size());
+	SendAll(client, header + body);
+}
+
+static void Describe(std::string &out, const char *name, const char *type, const char *help)
+{
+	char line[512];
+	snprintf(line, sizeof line, "# HELP %s %s\n# TYPE %s %s\n", name, help, name, type);
+	out += line;
+}
+
+// Whole numbers are written out in full, counters would lose digits to %g.
+static void Sample(std::string &out, const char *name, const char *labels, double value)
+{
+	char line[256];
+	bool whole = value == floor(value) && fabs(value) < 9007199254740992.0;
+	snprintf(line, sizeof line, whole ? "%s%s %.0f\n" : "%s%s %.9g\n", name, labels, value);
+	out += line;
+}
+
+static void Sample(std::string &out, const char *name, double value)
+{
+	Sample(out, name, "", value);
+}
+
+static int CountBits(uint64_t mask)
+{
+	int count = 0;
+	for (; mask; mask &= mask - 1)
+		count++;
+	return count;
+}
+
+void FormatMetrics(const MetricsSnapshot &s, int64_t now, std::string &out)
+{
+	char labels[64];
+	out.reserve(out.size() + 8192);
+
+	Describe(out, "spacecal_calibration_enabled", "gauge", "Whether the calibration is applied.");
+	Sample(out, "spacecal_calibration_enabled", (s.flags & protocol::StatusEnabled) ? 1 : 0);
+	Describe(out, "spacecal_profile_valid", "gauge", "Whether there is a calibrated profile.");
+	Sample(out, "spacecal_profile_valid", (s.flags & protocol::StatusValidProfile) ? 1 : 0);
+	Describe(out, "spacecal_driver_connected", "gauge", "Whether the client is connected to the driver.");
+	Sample(out, "spacecal_driver_connected", (s.flags & protocol::StatusDriverConnected) ? 1 : 0);
+	Describe(out, "spacecal_calibration_state", "gauge", "The client's CalibrationState, 0 when idle.");
+	Sample(out, "spacecal_calibration_state", s.state);
+
+	if (s.positionError >= 0.0)
+	{
+		Describe(out, "spacecal_calibration_error_meters", "gauge", "RMS error of the last accepted solve.");
+		Sample(out, "spacecal_calibration_error_meters", s.positionError);
+	}
+
+	Describe(out, "spacecal_continuous_rotation_drift_degrees", "gauge", "Rotation drift of the last continuous correction.");
+	Sample(out, "spacecal_continuous_rotation_drift_degrees", s.rotationDrift);
+	Describe(out, "spacecal_continuous_translation_drift_meters", "gauge", "Translation drift of the last continuous correction.");
+	Sample(out, "spacecal_continuous_translation_drift_meters", s.translationDrift / 100.0);
+	Describe(out, "spacecal_continuous_corrections_total", "counter", "Continuous calibration corrections since the client started.");
+	Sample(out, "spacecal_continuous_corrections_total", (double) s.continuousCorrections);
+
+	if (s.profileSavedTime > 0)
+	{
+		Describe(out, "spacecal_profile_saved_timestamp_seconds", "gauge", "When the profile was last saved.");
+		Sample(out, "spacecal_profile_saved_timestamp_seconds", (double) s.profileSavedTime);
+		Describe(out, "spacecal_profile_age_seconds", "gauge", "Time since the profile was last saved.");
+		Sample(out, "spacecal_profile_age_seconds", (double) (now - s.profileSavedTime));
+	}
+
+	Describe(out, "spacecal_devices_present", "gauge", "Devices SteamVR reports.");
+	Sample(out, "spacecal_devices_present", CountBits(s.presentMask));
+	Describe(out, "spacecal_devices_transformed", "gauge", "Devices the driver transforms.");
+	Sample(out, "spacecal_devices_transformed", CountBits(s.appliedMask));
+
+	Describe(out, "spacecal_client_tick_seconds", "gauge", "CPU time of the last calibration tick.");
+	Sample(out, "spacecal_client_tick_seconds", s.tickSeconds);
+	Describe(out, "spacecal_client_scan_seconds", "gauge", "CPU time of the last device scan for the UI.");
+	Sample(out, "spacecal_client_scan_seconds", s.scanSeconds);
+
+	Describe(out, "spacecal_driver_request_seconds", "summary", "Round trips of driver requests.");
+	for (uint32_t type = 0; type < MetricsSnapshot::RequestTypes; type++)
+	{
+		auto &request = s.requests[type];
+		if (!request.count)
+			continue;
+		snprintf(labels, sizeof labels, "{type=\"%s\"}", RequestTypeLabels[type]);
+		Sample(out, "spacecal_driver_request_seconds_sum", labels, request.total);
+		Sample(out, "spacecal_driver_request_seconds_count", labels, (double) request.count);
+	}
+	Describe(out, "spacecal_driver_request_max_seconds", "gauge", "Longest round trip of a driver request.");
+	for (uint32_t type = 0; type < MetricsSnapshot::RequestTypes; type++)
+	{
+		if (!s.requests[type].count)
+			continue;
+		snprintf(labels, sizeof labels, "{type=\"%s\"}", RequestTypeLabels[type]);
+		Sample(out, "spacecal_driver_request_max_seconds", labels, s.requests[type].max);
+	}
+
+	if (!s.haveDriverStats)
+		return;
+
+	// Bucket i of the driver's histogram counts calls of [2^i, 2^(i+1)) ns, the last one also
+	// everything longer, so it's left to +Inf.
+	auto &hook = s.driver.poseHook;
+	Describe(out, "spacecal_pose_hook_duration_seconds", "histogram", "Time the driver's pose hook adds to each pose update.");
+	uint64_t cumulative = 0;
+	for (uint32_t i = 0; i + 1 < protocol::PoseHookLatencyBuckets; i++)
+	{
+		cumulative += hook.latencyHistogram[i];
+		snprintf(labels, sizeof labels, "{le=\"%.9g\"}", (double) (2ull << i) / 1e9);
+		Sample(out, "spacecal_pose_hook_duration_seconds_bucket", labels, (double) cumulative);
+	}
+	Sample(out, "spacecal_pose_hook_duration_seconds_bucket", "{le=\"+Inf\"}", (double) hook.calls);
+	Sample(out, "spacecal_pose_hook_duration_seconds_sum", (double) hook.totalNanoseconds / 1e9);
+	Sample(out, "spacecal_pose_hook_duration_seconds_count", (double) hook.calls);
+	Describe(out, "spacecal_pose_hook_max_seconds", "gauge", "Longest pose hook call since the driver loaded.");
+	Sample(out, "spacecal_pose_hook_max_seconds", (double) hook.maxNanoseconds / 1e9);
+
+	Describe(out, "spacecal_device_updates_total", "counter", "Pose updates per OpenVR device ID since the driver loaded.");
+	for (uint32_t id = 0; id < vr::k_unMaxTrackedDeviceCount; id++)
+	{
+		if (!hook.deviceUpdates[id])
+			continue;
+		snprintf(labels, sizeof labels, "{device=\"%u\"}", id);
+		Sample(out, "spacecal_device_updates_total", labels, (double) hook.deviceUpdates[id]);
+	}
+
+	if (s.haveDriverPoseRates)
+	{
+		Describe(out, "spacecal_device_pose_interval_seconds", "gauge", "Moving average of the time between a device's poses.");
+		for (uint32_t id = 0; id < vr::k_unMaxTrackedDeviceCount; id++)
+		{
+			if (s.driver.poseRates[id].interval <= 0.0f)
+				continue;
+			snprintf(labels, sizeof labels, "{device=\"%u\"}", id);
+			Sample(out, "spacecal_device_pose_interval_seconds", labels, s.driver.poseRates[id].interval);
+		}
+		Describe(out, "spacecal_device_pose_jitter_seconds", "gauge", "Moving average of how far the time between a device's poses strays from its mean.");
+		for (uint32_t id = 0; id < vr::k_unMaxTrackedDeviceCount; id++)
+		{
+			if (s.driver.poseRates[id].interval <= 0.0f)
+				continue;
+			snprintf(labels, sizeof labels, "{device=\"%u\"}", id);
+			Sample(out, "spacecal_device_pose_jitter_seconds", labels, s.driver.poseRates[id].jitter);
+		}
+	}
+
+	Describe(out, "spacecal_driver_poses_transformed_total", "counter", "Pose updates the driver applied a transform to.");
+	Sample(out, "spacecal_driver_poses_transformed_total", (double) hook.transformedPoses);
+	Describe(out, "spacecal_driver_poses_queued_total", "counter", "Poses handed to consumers inside the driver.");
+	Sample(out, "spacecal_driver_poses_queued_total", (double) hook.queuedPoses);
+	Describe(out, "spacecal_driver_pose_queue_overflows_total", "counter", "Poses dropped because a consumer fell behind.");
+	Sample(out, "spacecal_driver_pose_queue_overflows_total", (double) hook.queueOverflows);
+	Describe(out, "spacecal_driver_requests_total", "counter", "Requests the driver handled.");
+	Sample(out, "spacecal_driver_requests_total", (double) s.driver.requestsHandled);
+	Describe(out, "spacecal_driver_invalid_requests_total", "counter", "Requests the driver rejected.");
+	Sample(out, "spacecal_driver_invalid_requests_total", (double) s.driver.invalidRequests);
+	Describe(out, "spacecal_driver_pipe_instances", "gauge", "Connected clients, plus the pipe instance waiting for the next.");
+	Sample(out, "spacecal_driver_pipe_instances", s.driver.pipeInstances);
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "../Protocol.h"
+
+#include <atomic>
+#include <string>
+#include <thread>
+
+// One copy of everything the endpoint serves, put together by the calibration tick.
+struct MetricsSnapshot
+{
+	static const uint32_t RequestTypes = 12; // protocol::RequestType values.
+
+	int64_t profileSavedTime; // Unix seconds, 0 if unknown.
+	uint32_t state; // CalibrationState
+	uint32_t flags; // protocol::StatusFlags
+	double positionError; // meters, negative before a solve.
+	double rotationDrift; // degrees, of the last continuous correction.
+	double translationDrift; // cm
+	uint64_t continuousCorrections;
+	uint64_t presentMask;
+	uint64_t appliedMask;
+
+	// seconds, of the last run.
+	double tickSeconds;
+	double scanSeconds;
+
+	struct
+	{
+		uint64_t count;
+		double total, max; // seconds
+	} requests[RequestTypes];
+
+	bool haveDriverStats, haveDriverPoseRates;
+	protocol::DriverStats driver;
+};
+
+/**
+ * Serves the calibrator's health at http://<station>:<port>/metrics in the Prometheus text
+ * format, for scraping a fleet of stations centrally: the calibration's error and drift, the
+ * profile's age, the client's tick and device scan times, driver round trips, and the
+ * driver's pose hook latency histogram and per device update counters and pose rates.
+ *
+ * The calibration tick publishes a snapshot through a seqlock like protocol::StatusBlock, and a
+ * thread of the endpoint's own formats it whenever it's scraped, so neither waits on the other
+ * and nothing on the tick or pose paths takes a lock. Driver statistics are polled every
+ * couple of seconds while the endpoint runs, see WantDriverStats.
+ */
+class MetricsEndpoint
+{
+public:
+	static const uint16_t DefaultPort = 9464;
+
+	~MetricsEndpoint();
+
+	// Restarts on the port, 0 stops. Returns false if the port couldn't be opened.
+	bool Start(uint16_t port);
+	void Stop();
+	bool IsRunning() const { return socketOpen; }
+
+	// From the calibration tick only.
+	void Publish(const MetricsSnapshot &next);
+
+private:
+	bool Read(MetricsSnapshot &out) const;
+	void RunServer();
+	void Serve(uintptr_t client);
+
+	std::atomic<uint32_t> sequence{ 0 }; // Odd while snapshot is being written.
+	MetricsSnapshot snapshot = {};
+
+	uintptr_t socket = 0; // SOCKET
+	bool socketOpen = false;
+	std::thread server;
+	std::atomic<bool> stopping{ false };
+};
+
+extern MetricsEndpoint Metrics;
+
+// Appends the snapshot in the Prometheus text exposition format, now in Unix seconds.
+void FormatMetrics(const MetricsSnapshot &snapshot, int64_t now, std::string &out);
@@ -0,0 +1,216 @@
+#include "stdafx.h"
+#include <winsock2.h>
+#include "NetworkPoses.h"
+
+#include <Eigen/Geometry>
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+#pragma comment(lib, "ws2_32.lib")
+
+NetworkPoseSource NetworkPoses;
+
+static const DWORD ReceiveTimeout = 250; // ms, how long Stop may wait for the receiver.
+static const double MaxRotationNormError = 0.01; // A bridge's quaternions are unit up to its float precision.
+
+static double CaptureClockSeconds()
+{
+	LARGE_INTEGER now, frequency;
+	QueryPerformanceCounter(&now);
+	QueryPerformanceFrequency(&frequency);
+	return (double) now.QuadPart / (double) frequency.QuadPart;
+}
+
+NetworkPoseSource::~NetworkPoseSource()
+{
+	Stop();
+}
+
+bool NetworkPoseSource::Start(uint16_t port, uint32_t newBody)
+{
+	Stop();
+	if (ring.empty())
+		ring.resize(Capacity);
+
+	WSADATA wsa;
+	if (WSAStartup(MAKEWORD(2, 2), &wsa) != 0)
+	{
+		std::cerr << "Couldn't start Winsock for network poses" << std::endl;
+		return false;
+	}
+
+	SOCKET s = ::socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+	bool ok = s != INVALID_SOCKET;
+
+	sockaddr_in local = {};
+	local.sin_family = AF_INET;
+	local.sin_port = htons(port);
+	local.sin_addr.s_addr = htonl(INADDR_ANY);
+	ok = ok && bind(s, (const sockaddr *) &local, sizeof local) == 0;
+
+	DWORD timeout = ReceiveTimeout;
+	ok = ok && setsockopt(s, SOL_SOCKET, SO_RCVTIMEO, (const char *) &timeout, sizeof timeout) == 0;
+
+	if (!ok)
+	{
+		std::cerr << "Couldn't set up the network pose socket on port " << port << ": " << WSAGetLastError() << std::endl;
+		if (s != INVALID_SOCKET)
+			closesocket(s);
+		WSACleanup();
+		return false;
+	}
+
+	body = newBody;
+	hasLast = false;
+	lost = 0;
+	readIndex = writeIndex.load();
+
+	socket = (uintptr_t) s;
+	socketOpen = true;
+	stopping = false;
+	receiver = std::thread(&NetworkPoseSource::RunReceiver, this);
+	return true;
+}
+
+void NetworkPoseSource::Stop()
+{
+	if (!socketOpen)
+		return;
+
+	stopping = true;
+	if (receiver.joinable())
+		receiver.join();
+
+	closesocket((SOCKET) socket);
+	WSACleanup();
+	socketOpen = false;
+}
+
+// Anyone on the network can send records, so whatever would throw the solver off is dropped
+// before it gets there. Rotations off unit length by no more than rounding are normalized.
+static bool Sanitize(protocol::PoseCaptureSample &sample)
+{
+	auto finite = [](double value) { return std::isfinite(value); };
+	const auto &q = sample.rotation;
+	if (!std::all_of(sample.position, sample.position + 3, finite) ||
+		!finite(q.w) || !finite(q.x) || !finite(q.y) || !finite(q.z) ||
+		!finite(sample.timestamp) || !finite(sample.linearSpeed) || !finite(sample.angularSpeed))
+		return false;
+
+	double norm = sqrt(q.w * q.w + q.x * q.x + q.y * q.y + q.z * q.z);
+	if (fabs(norm - 1.0) > MaxRotationNormError)
+		return false;
+
+	sample.rotation.w /= norm;
+	sample.rotation.x /= norm;
+	sample.rotation.y /= norm;
+	sample.rotation.z /= norm;
+	return true;
+}
+
+// Speeds the bridge didn't send come from the previous pose, the latency estimate needs them.
+void NetworkPoseSource::Stamp(protocol::PoseCaptureSample &sample, double arrival)
+{
+	sample.timestamp = arrival - std::max(sample.timestamp, 0.0);
+
+	bool derive = sample.linearSpeed < 0.0 || sample.angularSpeed < 0.0;
+	double elapsed = sample.timestamp - last.timestamp;
+	if (derive && hasLast && elapsed > 0.0)
+	{
+		double dx = sample.position[0] - last.position[0];
+		double dy = sample.position[1] - last.position[1];
+		double dz = sample.position[2] - last.position[2];
+		Eigen::Quaterniond from(last.rotation.w, last.rotation.x, last.rotation.y, last.rotation.z);
+		Eigen::Quaterniond to(sample.rotation.w, sample.rotation.x, sample.rotation.y, sample.rotation.z);
+		sample.linearSpeed = sqrt(dx * dx + dy * dy + dz * dz) / elapsed;
+		sample.angularSpeed = from.angularDistance(to) / elapsed;
+	}
+	else if (derive)
+	{
+		sample.linearSpeed = hasLast ? last.linearSpeed : 0.0;
+		sample.angularSpeed = hasLast ? last.angularSpeed : 0.0;
+	}
+
+	last = sample;
+	hasLast = true;
+}
+
+void NetworkPoseSource::RunReceiver()
+{
+	const size_t recordBytes = sizeof(protocol::PoseCaptureSample);
+	NetworkPoseHeader header;
+
+	while (!stopping)
+	{
+		uint64_t write = writeIndex.load(std::memory_order_relaxed);
+		uint64_t free = Capacity - (write - readIndex.load(std::memory_order_acquire));
+		uint32_t room = (uint32_t) std::min<uint64_t>(free, MaxDatagramRecords);
+
+		// The records land in the ring's free slots, split where it wraps around.
+		uint32_t first = write % Capacity;
+		uint32_t tail = std::min(room, Capacity - first);
+		WSABUF buffers[3] = {
+			{ (ULONG) sizeof header, (char *) &header },
+			{ (ULONG) (tail * recordBytes), (char *) &ring[first] },
+			{ (ULONG) ((room - tail) * recordBytes), (char *) &ring[0] },
+		};
+
+		DWORD bytes = 0, flags = 0;
+		if (WSARecvFrom((SOCKET) socket, buffers, 3, &bytes, &flags, nullptr, nullptr, nullptr, nullptr) != 0)
+		{
+			int error = WSAGetLastError();
+			if (error != WSAEMSGSIZE)
+			{
+				if (error != WSAETIMEDOUT)
+					Sleep(ReceiveTimeout); // Network gone, e.g. the adapter reset. Keep trying.
+				continue;
+			}
+
+			// More records than there was room for, the buffers hold what fit and the rest is lost.
+			bytes = (DWORD) (sizeof header + room * recordBytes);
+		}
+
+		if (bytes < sizeof header || header.magic != NetworkPoseMagic)
+			continue;
+
+		uint32_t received = (uint32_t) std::min<uint64_t>((bytes - sizeof header) / recordBytes, header.count);
+		if (header.count > received)
+			lost += header.count - received;
+
+		double arrival = CaptureClockSeconds();
+		uint32_t kept = 0;
+		for (uint32_t i = 0; i < received; i++)
+		{
+			auto &sample = ring[(write + i) % Capacity];
+			if (sample.openVRID != body || !Sanitize(sample))
+				continue;
+
+			Stamp(sample, arrival);
+			if (kept != i)
+				ring[(write + kept) % Capacity] = sample;
+			kept++;
+		}
+
+		writeIndex.store(write + kept, std::memory_order_release);
+	}
+}
+
+uint64_t NetworkPoseSource::Drain(std::vector<protocol::PoseCaptureSample> &out, uint32_t openVRID)
+{
+	uint64_t read = readIndex.load(std::memory_order_relaxed);
+	uint64_t write = writeIndex.load(std::memory_order_acquire);
+	for (; read < write; read++)
+	{
+		out.push_back(ring[read % Capacity]);
+		out.back().openVRID = openVRID;
+	}
+	readIndex.store(read, std::memory_order_release);
+	return lost.exchange(0);
+}
+
+void NetworkPoseSource::Flush()
+{
+	readIndex.store(writeIndex.load(std::memory_order_acquire), std::memory_order_release);
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "../Protocol.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+static const uint32_t NetworkPoseMagic = 0x504e4353; // "SCNP"
+
+// Starts every datagram of an external system's bridge, followed by count records laid out as
+// protocol::PoseCaptureSample is on x64: openVRID holds the rigid body's ID, timestamp the
+// seconds since the pose was measured, and negative speeds are derived here. Records with
+// values that aren't finite or a rotation that isn't a unit quaternion are dropped.
+struct NetworkPoseHeader
+{
+	uint32_t magic;
+	uint32_t count;
+};
+
+/**
+ * Poses of an external tracking system, e.g. optical motion capture, taken over UDP straight
+ * from its bridge instead of through a virtual driver and the pose hook. They stand in for the
+ * captured poses of the device the bridge shows in SteamVR, so the external system can be the
+ * reference or the target of a calibration without the extra hop's latency.
+ *
+ * Records are received in place into a preallocated ring of samples: the header into a buffer
+ * of its own and the records straight into the ring's free slots, scattered over its end and
+ * start. Each is then stamped on the pose capture clock and relabeled in its slot, records of
+ * other bodies being compacted away, before the receiver publishes them. One receiver thread
+ * writes and the calibration tick drains, so the ring needs no lock.
+ */
+class NetworkPoseSource
+{
+public:
+	static const uint32_t Capacity = 4096;
+	static const uint32_t MaxDatagramRecords = 64;
+
+	~NetworkPoseSource();
+
+	// Restarts with the poses of body on the port. Returns false if the socket couldn't be set up.
+	bool Start(uint16_t port, uint32_t body);
+	void Stop();
+	bool IsRunning() const { return socketOpen; }
+
+	// Appends the body's poses received since the last call, labeled as openVRID. Returns how
+	// many were lost because the ring was full.
+	uint64_t Drain(std::vector<protocol::PoseCaptureSample> &out, uint32_t openVRID);
+
+	// Drops what was received so far, e.g. while nothing drained it.
+	void Flush();
+
+private:
+	void RunReceiver();
+	void Stamp(protocol::PoseCaptureSample &sample, double arrival);
+
+	std::vector<protocol::PoseCaptureSample> ring;
+	std::atomic<uint64_t> writeIndex{ 0 }, readIndex{ 0 };
+	std::atomic<uint64_t> lost{ 0 };
+
+	uint32_t body = 0;
+	protocol::PoseCaptureSample last; // The body's previous pose, for deriving speeds.
+	bool hasLast = false;
+
+	uintptr_t socket = 0; // SOCKET, without pulling winsock2.h into every user.
+	bool socketOpen = false;
+	std::thread receiver;
+	std::atomic<bool> stopping{ false };
+};
+
+extern NetworkPoseSource NetworkPoses;
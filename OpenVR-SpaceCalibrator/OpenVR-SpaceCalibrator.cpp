@@ -1,8 +1,23 @@
 ﻿#include "stdafx.h"
 #include "Calibration.h"
+#include "CalibrationSnapshot.h"
 #include "Configuration.h"
-#include "EmbeddedFiles.h"
+#include "ProfileStore.h"
+#include "BakedFont.h"
 #include "UserInterface.h"
+#include "IPCClient.h"
+#include "IPCBenchmark.h"
+#include "TrackingSimulator.h"
+#include "DeviceRegistry.h"
+#include "OverlayTexture.h"
+#include "TrayIcon.h"
+#include "ProcessQoS.h"
+#include "ClientTimings.h"
+#include "EventLog.h"
+#include "Diagnostics.h"
+#include "StartupTimings.h"
+#include "SampleView.h"
+#include "../Instrumentation.h"
 
 #include <imgui/imgui.h>
 #include <imgui/imgui_impl_glfw.h>
@@ -11,6 +26,8 @@
 #include <GLFW/glfw3.h>
 #include <openvr.h>
 #include <direct.h>
+#include <algorithm>
+#include <cstring>
 
 #pragma comment(linker,"\"/manifestdependency:type='win32' \
 name='Microsoft.Windows.Common-Controls' version='6.0.0.0' \
@@ -18,6 +35,8 @@ processorArchitecture='*' publicKeyToken='6595b64144ccf1df' language='*'\"")
 
 #define OPENVR_APPLICATION_KEY "pushrax.SpaceCalibrator"
 
+SPACECAL_DEFINE_TRACE_PROVIDER
+
 extern "C" __declspec(dllexport) DWORD NvOptimusEnablement = 0x00000001;
 extern "C" __declspec(dllexport) DWORD AmdPowerXpressRequestHighPerformance = 0x00000001;
 
@@ -54,55 +73,419 @@ static vr::VROverlayHandle_t overlayMainHandle = 0, overlayThumbnailHandle = 0;
 static GLuint fboHandle = 0, fboTextureHandle = 0;
 static int fboTextureWidth = 0, fboTextureHeight = 0;
 
+// ImGui lays the UI out at this size, the overlay texture is scaled to the overlay's physical size.
+static const int UIWidth = 1200, UIHeight = 800;
+static const float OverlayWidthInMeters = 3.0f;
+static const float OverlayPixelsPerMeter = 320.0f;
+static SharedOverlayTexture overlayTexture;
+
 static char cwd[MAX_PATH];
 
+// Set by -overlayonly. The desktop window stays hidden and the dashboard overlay is the only way in.
+static bool overlayOnly = false;
+
+/**
+ * Set by -tray. Only the tray icon and the dashboard thumbnail exist until the UI is opened
+ * from either, and the window, GL context and ImGui are destroyed again once nobody has
+ * looked at the UI for UIIdleTimeout, or when the window is closed.
+ */
+static bool trayMode = false;
+static TrayIcon tray;
+static const double UIIdleTimeout = 10.0;
+
+// Set by VREvent_Quit, or by the tray's quit command.
+static bool quitting = false;
+
+/**
+ * Set by -startupbenchmark. Starts like a normal run, draws frames even while the window is
+ * minimized, and quits once the profile was applied and the first frame drawn, writing
+ * StartupReport to startupReportPath, or stdout without one. Phases still missing after
+ * StartupBenchmarkTimeout are reported as null and the exit code is 1.
+ */
+static bool startupBenchmark = false;
+static std::string startupReportPath;
+static int exitCode = 0;
+static const double StartupBenchmarkTimeout = 60.0;
+
+// Returns true once the benchmark is over and the loop should end.
+static bool FinishStartupBenchmark(double time)
+{
+	bool complete = StartupPhaseDone(StartupPhase::ProfileApplied) && StartupPhaseDone(StartupPhase::FirstFrame);
+	if (!startupBenchmark || (!complete && time < StartupBenchmarkTimeout))
+		return false;
+
+	std::string report = StartupReport();
+	FILE *file = stdout;
+	if (!startupReportPath.empty() && (fopen_s(&file, startupReportPath.c_str(), "w") != 0 || !file))
+	{
+		fprintf(stderr, "Couldn't write the startup report to %s\n", startupReportPath.c_str());
+		file = stdout;
+	}
+	fputs(report.c_str(), file);
+	if (file != stdout)
+		fclose(file);
+
+	exitCode = complete ? 0 : 1;
+	return true;
+}
+
+/**
+ * Frames are only rendered when something the UI shows may have changed: input, calibration
+ * state, log messages or the device list. ImGui needs a few frames to settle after a change
+ * (hover states, popups opening), so each change renders several frames.
+ */
+static const int FramesAfterChange = 3;
+static const double MaxFrameInterval = 1.0; // Redraws at least this often, in case a change wasn't noticed.
+static int framesToRender = FramesAfterChange;
+
+static void RequestFrames()
+{
+	framesToRender = FramesAfterChange;
+}
+
+/**
+ * The main loop sleeps until GLFW has an event for it. The calibration thread posts one when
+ * a tick changes what the UI shows, and input arrives as window messages. While nothing shows
+ * the UI, the only thing without an event is the dashboard picking our overlay, so that's
+ * polled only while the dashboard is open. Otherwise the loop just wakes for the idle
+ * timeouts and to retry creating the overlay.
+ */
+static const double DashboardPollInterval = 0.25;
+static const double MaxHiddenWait = 30.0;
+
+/**
+ * The process goes idle, see SetProcessIdle, once nobody can see the UI, the dashboard is
+ * closed, no calibration runs and nothing the UI shows changed for IdleQoSDelay. A device
+ * coming or going and the dashboard opening change it, the tick's event wakes the loop and
+ * full QoS is back before the next frame.
+ */
+static const double IdleQoSDelay = 5.0;
+
+/**
+ * Frames are paced at the HMD's refresh rate while the user is pointing at the overlay or
+ * using the window, and at IdleFrameRate otherwise. A running calibration only changes what
+ * the UI shows once per calibration tick, so without input it's drawn at CalibratingFrameRate,
+ * which keeps a calibration from costing a core on a machine that's already busy with VR.
+ * Vsync also limits the desktop window.
+ */
+static const double IdleFrameRate = 30.0;
+static const double CalibratingFrameRate = 20.0;
+static const double InteractionHoldTime = 0.5; // Stays at full rate this long after the last input.
+static double interactiveFrameRate = 90.0;
+static double timeLastInput = -1.0;
+
+static void NoteInput()
+{
+	timeLastInput = glfwGetTime();
+	RequestFrames();
+}
+
+/**
+ * The laser pointer sends a move event per compositor frame or more, so the overlay's events
+ * are drained once per loop and moves only keep the last position, which requests frames if
+ * it actually moved. ImGui reads the buttons once per frame, and a press and release from the
+ * same drain would never be seen as a click: draining stops after a button changes, that
+ * frame is drawn without waiting out the frame interval, and the events left over are taken
+ * by the next loop.
+ */
+static bool PollOverlayInput(bool &keyboardJustClosed)
+{
+	auto &io = ImGui::GetIO();
+	ImVec2 pointer = io.MousePos;
+	bool pointerMoved = false, buttonChanged = false;
+
+	vr::VREvent_t vrEvent;
+	while (!buttonChanged && vr::VROverlay()->PollNextOverlayEvent(overlayMainHandle, &vrEvent, sizeof(vrEvent)))
+	{
+		switch (vrEvent.eventType) {
+		case vr::VREvent_MouseMove:
+			pointer = ImVec2(vrEvent.data.mouse.x, vrEvent.data.mouse.y);
+			pointerMoved = true;
+			break;
+		case vr::VREvent_MouseButtonDown:
+		case vr::VREvent_MouseButtonUp: {
+			bool &down = io.MouseDown[vrEvent.data.mouse.button == vr::VRMouseButton_Left ? 0 : 1];
+			bool pressed = vrEvent.eventType == vr::VREvent_MouseButtonDown;
+			buttonChanged = down != pressed;
+			down = pressed;
+			NoteInput();
+			break;
+		}
+		case vr::VREvent_ScrollDiscrete:
+			io.MouseWheelH += vrEvent.data.scroll.xdelta * 360.0f * 8.0f;
+			io.MouseWheel += vrEvent.data.scroll.ydelta * 360.0f * 8.0f;
+			NoteInput();
+			break;
+		case vr::VREvent_KeyboardDone: {
+			char buf[0x400];
+			vr::VROverlay()->GetKeyboardText(buf, sizeof buf);
+			ImGui::SetActiveText(buf, sizeof buf);
+			keyboardJustClosed = true;
+			NoteInput();
+			break;
+		}
+		case vr::VREvent_Quit:
+			quitting = true;
+			return false;
+		}
+	}
+
+	if (pointerMoved)
+	{
+		timeLastInput = glfwGetTime();
+		if (pointer.x != io.MousePos.x || pointer.y != io.MousePos.y)
+		{
+			io.MousePos = pointer;
+			RequestFrames();
+		}
+	}
+	return buttonChanged;
+}
+
+// The previous callbacks are ImGui's, which still need to see every event.
+static GLFWmousebuttonfun previousMouseButtonCallback;
+static GLFWscrollfun previousScrollCallback;
+static GLFWkeyfun previousKeyCallback;
+static GLFWcharfun previousCharCallback;
+
+static void MouseButtonCallback(GLFWwindow *window, int button, int action, int mods)
+{
+	NoteInput();
+	if (previousMouseButtonCallback)
+		previousMouseButtonCallback(window, button, action, mods);
+}
+
+static void ScrollCallback(GLFWwindow *window, double xoffset, double yoffset)
+{
+	NoteInput();
+	if (previousScrollCallback)
+		previousScrollCallback(window, xoffset, yoffset);
+}
+
+static void KeyCallback(GLFWwindow *window, int key, int scancode, int action, int mods)
+{
+	NoteInput();
+	if (previousKeyCallback)
+		previousKeyCallback(window, key, scancode, action, mods);
+}
+
+static void CharCallback(GLFWwindow *window, unsigned int c)
+{
+	NoteInput();
+	if (previousCharCallback)
+		previousCharCallback(window, c);
+}
+
+static void InstallFrameRequestCallbacks(GLFWwindow *window)
+{
+	previousMouseButtonCallback = glfwSetMouseButtonCallback(window, MouseButtonCallback);
+	previousScrollCallback = glfwSetScrollCallback(window, ScrollCallback);
+	previousKeyCallback = glfwSetKeyCallback(window, KeyCallback);
+	previousCharCallback = glfwSetCharCallback(window, CharCallback);
+	glfwSetCursorPosCallback(window, [](GLFWwindow *, double, double) { NoteInput(); });
+	glfwSetWindowIconifyCallback(window, [](GLFWwindow *, int) { RequestFrames(); });
+	glfwSetWindowFocusCallback(window, [](GLFWwindow *, int) { RequestFrames(); });
+	glfwSetWindowRefreshCallback(window, [](GLFWwindow *) { RequestFrames(); });
+}
+
+// What the UI shows from outside ImGui, compared every iteration to notice changes.
+struct UIStateSnapshot
+{
+	CalibrationState state;
+	bool validProfile, enabled, driverConnected, chaperoneValid, dashboardVisible, dashboardActive;
+	uint32_t deviceGeneration;
+	uint64_t messageGeneration;
+
+	bool operator!=(const UIStateSnapshot &other) const
+	{
+		return state != other.state || validProfile != other.validProfile || enabled != other.enabled ||
+			driverConnected != other.driverConnected || chaperoneValid != other.chaperoneValid || dashboardVisible != other.dashboardVisible ||
+			dashboardActive != other.dashboardActive ||
+			deviceGeneration != other.deviceGeneration || messageGeneration != other.messageGeneration;
+	}
+};
+
+// From what the calibration thread published, without CalibrationMutex.
+static UIStateSnapshot TakeUIStateSnapshot(bool dashboardVisible)
+{
+	auto published = LatestCalibrationSnapshot();
+	UIStateSnapshot snapshot;
+	snapshot.state = published->state;
+	snapshot.validProfile = published->validProfile;
+	snapshot.enabled = published->enabled;
+	snapshot.driverConnected = published->driverConnected;
+	snapshot.chaperoneValid = published->chaperoneValid;
+	snapshot.dashboardVisible = dashboardVisible;
+	snapshot.dashboardActive = published->dashboardActive;
+	snapshot.deviceGeneration = published->deviceGeneration;
+	snapshot.messageGeneration = published->messageGeneration;
+	return snapshot;
+}
+
+// Runs on the calibration thread, wakes the UI when the tick changed something it shows.
+static void OnCalibrationTick()
+{
+	static uint64_t lastVersion = 0;
+	uint64_t version = LatestCalibrationSnapshot()->version;
+	if (version != lastVersion)
+	{
+		lastVersion = version;
+		glfwPostEmptyEvent();
+	}
+}
+
+static void SetOverlayTextureBounds()
+{
+	if (!overlayMainHandle || !vr::VROverlay())
+		return;
+
+	// GL rendered it bottom row first, the compositor flips GL textures but not D3D ones.
+	vr::VRTextureBounds_t bounds = { 0.0f, 0.0f, 1.0f, 1.0f };
+	if (overlayTexture.Active())
+		bounds = { 0.0f, 1.0f, 1.0f, 0.0f };
+	vr::VROverlay()->SetOverlayTextureBounds(overlayMainHandle, &bounds);
+}
+
 void CreateGLFWWindow()
 {
 	glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
-	glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 2);
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
 	glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
 	glfwWindowHint(GLFW_RESIZABLE, false);
+	glfwWindowHint(GLFW_VISIBLE, !overlayOnly && !trayMode);
 
 #ifdef DEBUG_LOGS
 	glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, GL_TRUE);
 #endif
 
-	fboTextureWidth = 1200;
-	fboTextureHeight = 800;
+	fboTextureWidth = std::min((int) (OverlayWidthInMeters * OverlayPixelsPerMeter), UIWidth);
+	fboTextureHeight = fboTextureWidth * UIHeight / UIWidth;
 
-	glfwWindow = glfwCreateWindow(fboTextureWidth, fboTextureHeight, "OpenVR-SpaceCalibrator", NULL, NULL);
+	glfwWindow = glfwCreateWindow(UIWidth, UIHeight, "OpenVR-SpaceCalibrator", NULL, NULL);
 	if (!glfwWindow)
 		throw std::runtime_error("Failed to create window");
 
 	glfwMakeContextCurrent(glfwWindow);
-	glfwSwapInterval(1);
+	glfwSwapInterval(overlayOnly ? 0 : 1);
 	gl3wInit();
 
-	glfwIconifyWindow(glfwWindow);
+	if (!overlayOnly && !trayMode)
+		glfwIconifyWindow(glfwWindow);
 
 #ifdef DEBUG_LOGS
 	glDebugMessageCallback(openGLDebugCallback, nullptr);
 	glEnable(GL_DEBUG_OUTPUT);
 #endif
 
+	MarkStartupPhase(StartupPhase::CreateWindow);
+
 	ImGui::CreateContext();
 	ImGuiIO &io = ImGui::GetIO();
+	io.DisplaySize = ImVec2((float) UIWidth, (float) UIHeight);
+	io.DisplayFramebufferScale = ImVec2((float) fboTextureWidth / UIWidth, (float) fboTextureHeight / UIHeight);
 	io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard;
 	io.ConfigFlags |= ImGuiConfigFlags_NavEnableGamepad;
 	io.IniFilename = nullptr;
-	io.Fonts->AddFontFromMemoryCompressedTTF(DroidSans_compressed_data, DroidSans_compressed_size, 24.0f);
+	LoadBakedFont(io.Fonts);
+	MarkStartupPhase(StartupPhase::FontAtlas);
 
 	ImGui_ImplGlfw_InitForOpenGL(glfwWindow, true);
+	InstallFrameRequestCallbacks(glfwWindow);
 	ImGui_ImplOpenGL3_Init("#version 330");
 
 	ImGui::StyleColorsDark();
+}
 
+/**
+ * The texture frames are rendered into, for the desktop window and the dashboard alike, and
+ * ImGui's GL objects are only created for the first frame someone can see. Once neither has
+ * shown the UI for RenderIdleTimeout they're released again, which matters on GPUs whose
+ * memory a VR title already fills.
+ */
+static const double RenderIdleTimeout = 30.0;
+
+/**
+ * Low memory mode, see lowMemory, gives back what it can once nobody has seen the UI for
+ * LowMemoryIdleTimeout instead of the timeouts above: with the render target and ImGui's GL
+ * objects go the UI's caches and the calibration's session buffers, and then the working set
+ * is trimmed. ImGui keeps no CPU copy of the font atlas either, it's decoded again whenever
+ * the font texture is made.
+ */
+static const double LowMemoryIdleTimeout = 3.0;
+
+static double RenderIdleTime()
+{
+	return CalCtx.lowMemory ? LowMemoryIdleTimeout : RenderIdleTimeout;
+}
+
+static double UIIdleTime()
+{
+	return CalCtx.lowMemory ? LowMemoryIdleTimeout : UIIdleTimeout;
+}
+
+/**
+ * While nothing ImGui shows changes, it builds the same draw lists frame after frame, which
+ * most frames requested after a change turn out to be. A hash of them stands for what the
+ * texture holds: a frame that hashes like the last one isn't rendered into it again, and isn't
+ * submitted to the compositor, which copies or at least rebinds every submission. 0 means
+ * nothing is known about the texture's content, or nothing was submitted since it was made.
+ */
+static uint64_t renderedContent = 0, submittedContent = 0;
+
+static uint64_t HashBytes(uint64_t hash, const void *data, size_t size)
+{
+	// FNV-1a a word at a time, vertex data is large enough for bytewise to show up in the frame.
+	const uint8_t *bytes = (const uint8_t *) data;
+	for (; size >= sizeof(uint64_t); bytes += sizeof(uint64_t), size -= sizeof(uint64_t))
+	{
+		uint64_t word;
+		memcpy(&word, bytes, sizeof word);
+		hash = (hash ^ word) * 1099511628211ull;
+	}
+	for (; size; bytes++, size--)
+		hash = (hash ^ *bytes) * 1099511628211ull;
+	return hash;
+}
+
+static uint64_t HashDrawData(const ImDrawData *drawData)
+{
+	uint64_t hash = HashBytes(14695981039346656037ull, &drawData->DisplaySize, sizeof drawData->DisplaySize);
+	for (int i = 0; i < drawData->CmdListsCount; i++)
+	{
+		const ImDrawList *list = drawData->CmdLists[i];
+		hash = HashBytes(hash, list->VtxBuffer.Data, list->VtxBuffer.Size * sizeof(ImDrawVert));
+		hash = HashBytes(hash, list->IdxBuffer.Data, list->IdxBuffer.Size * sizeof(ImDrawIdx));
+		for (auto &cmd : list->CmdBuffer)
+		{
+			hash = HashBytes(hash, &cmd.ClipRect, sizeof cmd.ClipRect);
+			hash = HashBytes(hash, &cmd.TextureId, sizeof cmd.TextureId);
+			hash = HashBytes(hash, &cmd.ElemCount, sizeof cmd.ElemCount);
+
+			// The only callback is the sample view, which draws what the lists don't hold.
+			if (cmd.UserCallback)
+			{
+				uint64_t content = SampleViewContent();
+				hash = HashBytes(hash, &content, sizeof content);
+			}
+		}
+	}
+	return hash ? hash : 1;
+}
+
+static void CreateRenderTarget()
+{
 	glGenTextures(1, &fboTextureHandle);
+
+	// Render straight into a texture the compositor can use as is, if the driver supports it.
+	bool sharedTexture = overlayTexture.Init(fboTextureWidth, fboTextureHeight, fboTextureHandle);
+
 	glBindTexture(GL_TEXTURE_2D, fboTextureHandle);
-	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, fboTextureWidth, fboTextureHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+	if (!sharedTexture)
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, fboTextureWidth, fboTextureHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, 0);
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
 
+	overlayTexture.Lock();
 	glGenFramebuffers(1, &fboHandle);
 	glBindFramebuffer(GL_FRAMEBUFFER, fboHandle);
 	glFramebufferTexture(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, fboTextureHandle, 0);
@@ -110,10 +493,98 @@ void CreateGLFWWindow()
 	GLenum drawBuffers[1] = { GL_COLOR_ATTACHMENT0 };
 	glDrawBuffers(1, drawBuffers);
 
-	if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+	GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+	overlayTexture.Unlock();
+
+	if (status != GL_FRAMEBUFFER_COMPLETE)
 	{
 		throw std::runtime_error("OpenGL framebuffer incomplete");
 	}
+
+	// The overlay usually exists before the texture, which decides the bounds.
+	SetOverlayTextureBounds();
+}
+
+// ImGui_ImplOpenGL3_NewFrame recreates its objects, CreateRenderTarget must be called before rendering again.
+static void ReleaseRenderResources()
+{
+	if (overlayMainHandle && vr::VROverlay())
+		vr::VROverlay()->ClearOverlayTexture(overlayMainHandle);
+
+	if (fboHandle)
+		glDeleteFramebuffers(1, &fboHandle);
+	fboHandle = 0;
+
+	overlayTexture.Shutdown();
+
+	if (fboTextureHandle)
+		glDeleteTextures(1, &fboTextureHandle);
+	fboTextureHandle = 0;
+	renderedContent = submittedContent = 0;
+
+	ReleaseSampleView();
+	if (ImGui::GetCurrentContext())
+		ImGui_ImplOpenGL3_DestroyDeviceObjects();
+}
+
+// What low memory mode frees besides the render resources.
+static void TrimMemory()
+{
+	ReleaseUICaches();
+	PostCalibrationCommand([](CalibrationContext &ctx) {
+		TrimCalibrationMemory(ctx);
+		TrimProcessWorkingSet();
+		return true;
+	});
+}
+
+static double HiddenWaitTimeout(bool dashboardActive, double timeSinceSeen)
+{
+	if (dashboardActive)
+		return DashboardPollInterval;
+
+	double timeout = MaxHiddenWait;
+	if (trayMode)
+		timeout = UIIdleTime() - timeSinceSeen;
+	else if (fboHandle)
+		timeout = RenderIdleTime() - timeSinceSeen;
+	return std::max(std::min(timeout, MaxHiddenWait), 0.0);
+}
+
+// Safe to call after a partial CreateGLFWWindow. The dashboard overlay itself stays.
+void DestroyGLFWWindow()
+{
+	if (glfwWindow)
+		ReleaseRenderResources();
+
+	if (ImGui::GetCurrentContext())
+	{
+		ImGui_ImplOpenGL3_Shutdown();
+		ImGui_ImplGlfw_Shutdown();
+		ImGui::DestroyContext();
+	}
+
+	if (glfwWindow)
+		glfwDestroyWindow(glfwWindow);
+	glfwWindow = nullptr;
+}
+
+static void ShowDesktopWindow()
+{
+	glfwShowWindow(glfwWindow);
+	glfwRestoreWindow(glfwWindow);
+	glfwFocusWindow(glfwWindow);
+	RequestFrames();
+}
+
+// Written on the calibration thread, which has everything the report needs.
+static void TakeDiagnosticsRequest()
+{
+	if (!tray.diagnosticsRequested)
+		return;
+
+	tray.diagnosticsRequested = false;
+	PostCalibrationCommand([](CalibrationContext &ctx) { return WriteDiagnosticsReport(ctx); });
 }
 
 void TryCreateVROverlay()
@@ -135,13 +606,19 @@ void TryCreateVROverlay()
 		throw std::runtime_error("Error creating VR overlay: " + std::string(vr::VROverlay()->GetOverlayErrorNameFromEnum(error)));
 	}
 
-	vr::VROverlay()->SetOverlayWidthInMeters(overlayMainHandle, 3.0f);
+	vr::VROverlay()->SetOverlayWidthInMeters(overlayMainHandle, OverlayWidthInMeters);
 	vr::VROverlay()->SetOverlayInputMethod(overlayMainHandle, vr::VROverlayInputMethod_Mouse);
 	vr::VROverlay()->SetOverlayFlag(overlayMainHandle, vr::VROverlayFlags_SendVRDiscreteScrollEvents, true);
 
+	SetOverlayTextureBounds();
+
 	std::string iconPath = cwd;
 	iconPath += "\\icon.png";
 	vr::VROverlay()->SetOverlayFromFile(overlayThumbnailHandle, iconPath.c_str());
+
+	float frequency = vr::VRSystem()->GetFloatTrackedDeviceProperty(vr::k_unTrackedDeviceIndex_Hmd, vr::Prop_DisplayFrequency_Float);
+	if (frequency > 0.0f)
+		interactiveFrameRate = frequency;
 }
 
 void ActivateMultipleDrivers()
@@ -198,20 +675,34 @@ void InitVR()
 	{
 		throw std::runtime_error("OpenVR error: Outdated IVROverlay_Version");
 	}
+	MarkStartupPhase(StartupPhase::InitVR);
 
 	ActivateMultipleDrivers();
+	MarkStartupPhase(StartupPhase::ActivateDrivers);
 }
 
 void RunLoop()
 {
+	UIStateSnapshot lastState = TakeUIStateSnapshot(false);
+	double timeLastFrame = 0, timeLastSeen = glfwGetTime(), timeLastChange = timeLastSeen;
+
 	while (!glfwWindowShouldClose(glfwWindow))
 	{
+		CheckCalibrationThread();
 		TryCreateVROverlay();
 
 		double time = glfwGetTime();
-		CalibrationTick(time);
 
-		bool dashboardVisible = false;
+		if (tray.quitRequested || FinishStartupBenchmark(time))
+			return;
+		if (tray.openRequested)
+		{
+			tray.openRequested = false;
+			ShowDesktopWindow();
+		}
+		TakeDiagnosticsRequest();
+
+		bool dashboardVisible = false, immediateFrame = false;
 		int width, height;
 		glfwGetFramebufferSize(glfwWindow, &width, &height);
 
@@ -253,100 +744,239 @@ void RunLoop()
 				keyboardOpen = true;
 			}
 
-			vr::VREvent_t vrEvent;
-			while (vr::VROverlay()->PollNextOverlayEvent(overlayMainHandle, &vrEvent, sizeof(vrEvent)))
-			{
-				switch (vrEvent.eventType) {
-				case vr::VREvent_MouseMove:
-					io.MousePos.x = vrEvent.data.mouse.x;
-					io.MousePos.y = vrEvent.data.mouse.y;
-					break;
-				case vr::VREvent_MouseButtonDown:
-					io.MouseDown[vrEvent.data.mouse.button == vr::VRMouseButton_Left ? 0 : 1] = true;
-					break;
-				case vr::VREvent_MouseButtonUp:
-					io.MouseDown[vrEvent.data.mouse.button == vr::VRMouseButton_Left ? 0 : 1] = false;
-					break;
-				case vr::VREvent_ScrollDiscrete:
-					io.MouseWheelH += vrEvent.data.scroll.xdelta * 360.0f * 8.0f;
-					io.MouseWheel += vrEvent.data.scroll.ydelta * 360.0f * 8.0f;
-					break;
-				case vr::VREvent_KeyboardDone: {
-					char buf[0x400];
-					vr::VROverlay()->GetKeyboardText(buf, sizeof buf);
-					ImGui::SetActiveText(buf, sizeof buf);
-					keyboardJustClosed = true;
-					break;
-				}
-				case vr::VREvent_Quit:
-					return;
-				}
-			}
+			immediateFrame = PollOverlayInput(keyboardJustClosed);
+			if (quitting)
+				return;
+		}
+
+		auto state = TakeUIStateSnapshot(dashboardVisible);
+		quitting |= LatestCalibrationSnapshot()->quitRequested;
+
+		if (quitting)
+			return;
+
+		if (state != lastState)
+		{
+			lastState = state;
+			timeLastChange = time;
+			RequestFrames();
 		}
 
-		ImGui::GetIO().DisplaySize = ImVec2((float) fboTextureWidth, (float) fboTextureHeight);
+		// The text cursor blinks while a field is being edited.
+		if (ImGui::GetIO().WantTextInput || (time - timeLastFrame) >= MaxFrameInterval)
+			RequestFrames();
+
+		bool calibrating = state.state == CalibrationState::Begin || state.state == CalibrationState::Rotation ||
+			state.state == CalibrationState::Translation || state.state == CalibrationState::Solving || state.state == CalibrationState::Verifying;
+		bool interactive = (time - timeLastInput) < InteractionHoldTime;
+		double frameInterval = 1.0 / (interactive ? interactiveFrameRate : calibrating ? CalibratingFrameRate : IdleFrameRate);
+
+		// With the window minimized or hidden, frames are only worth rendering for the dashboard.
+		// Requested frames are kept until someone can see them.
+		bool windowVisible = !overlayOnly && glfwGetWindowAttrib(glfwWindow, GLFW_VISIBLE) && !glfwGetWindowAttrib(glfwWindow, GLFW_ICONIFIED);
+		bool benchmarkFrame = startupBenchmark && !StartupPhaseDone(StartupPhase::FirstFrame);
+
+		if (windowVisible || dashboardVisible || calibrating)
+			timeLastSeen = time;
+		else if (trayMode && (time - timeLastSeen) >= UIIdleTime())
+			return;
+		else if (fboHandle && (time - timeLastSeen) >= RenderIdleTime())
+		{
+			ReleaseRenderResources();
+			if (CalCtx.lowMemory)
+				TrimMemory();
+		}
+
+		bool unseen = !windowVisible && !state.dashboardActive && state.state == CalibrationState::None;
+		double timeUnchanged = time - timeLastChange;
+		SetProcessIdle(unseen && timeUnchanged >= IdleQoSDelay);
+
+		double waitEventsTimeout = HiddenWaitTimeout(state.dashboardActive, time - timeLastSeen);
+		if (dashboardVisible)
+			waitEventsTimeout = frameInterval;
+		else if (windowVisible)
+			waitEventsTimeout = MaxFrameInterval;
+		else if (unseen && timeUnchanged < IdleQoSDelay)
+			waitEventsTimeout = std::min(waitEventsTimeout, IdleQoSDelay - timeUnchanged);
+
+		if (framesToRender == 0 || (!windowVisible && !dashboardVisible && !benchmarkFrame))
+		{
+			glfwWaitEventsTimeout(waitEventsTimeout);
+			continue;
+		}
+
+		if (!immediateFrame && (time - timeLastFrame) < frameInterval)
+		{
+			glfwWaitEventsTimeout(std::min(frameInterval - (time - timeLastFrame), waitEventsTimeout));
+			continue;
+		}
+
+		framesToRender--;
+		timeLastFrame = time;
+
+		if (!fboHandle)
+		{
+			LoadBakedFontPixels(ImGui::GetIO().Fonts);
+			CreateRenderTarget();
+		}
 
 		ImGui_ImplGlfw_SetReadMouseFromGlfw(!dashboardVisible);
 		ImGui_ImplOpenGL3_NewFrame();
+		if (CalCtx.lowMemory)
+			ImGui::GetIO().Fonts->ClearTexData(); // In the font texture now, nothing else reads it.
 		ImGui_ImplGlfw_NewFrame();
 		ImGui::NewFrame();
 
-		BuildMainWindow(dashboardVisible);
+		{
+			std::lock_guard<std::mutex> lock(CalibrationMutex);
+			ScopedTiming timing(TimingSection::BuildUI);
+			SPACECAL_ZONE("BuildUI");
+			BuildMainWindow(dashboardVisible);
+		}
 
-		ImGui::Render();
+		overlayTexture.Lock();
+		{
+			ScopedTiming timing(TimingSection::RenderUI);
+			SPACECAL_ZONE("RenderUI");
+			ImGui::Render();
 
-		glBindFramebuffer(GL_FRAMEBUFFER, fboHandle);
-		glViewport(0, 0, fboTextureWidth, fboTextureHeight);
-		glClearColor(0, 0, 0, 1);
-		glClear(GL_COLOR_BUFFER_BIT);
+			uint64_t content = HashDrawData(ImGui::GetDrawData());
+			if (content != renderedContent)
+			{
+				glBindFramebuffer(GL_FRAMEBUFFER, fboHandle);
+				glViewport(0, 0, fboTextureWidth, fboTextureHeight);
+				glClearColor(0, 0, 0, 1);
+				glClear(GL_COLOR_BUFFER_BIT);
 
-		ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+				ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
 
-		glBindFramebuffer(GL_FRAMEBUFFER, 0);
+				glBindFramebuffer(GL_FRAMEBUFFER, 0);
+				renderedContent = content;
+			}
+		}
 
-		if (width && height)
+		if (windowVisible && width && height)
 		{
-			glBindFramebuffer(GL_READ_FRAMEBUFFER, fboHandle);
-			glBlitFramebuffer(0, 0, width, height, 0, 0, width, height, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+			{
+				// Without the swap, which waits for vsync.
+				ScopedTiming timing(TimingSection::Blit);
+				SPACECAL_ZONE("Blit");
+				glBindFramebuffer(GL_READ_FRAMEBUFFER, fboHandle);
+				GLenum filter = (width == fboTextureWidth && height == fboTextureHeight) ? GL_NEAREST : GL_LINEAR;
+				glBlitFramebuffer(0, 0, fboTextureWidth, fboTextureHeight, 0, 0, width, height, GL_COLOR_BUFFER_BIT, filter);
+			}
 			glfwSwapBuffers(glfwWindow);
 		}
 
-		if (dashboardVisible)
+		overlayTexture.Unlock();
+		MarkStartupPhase(StartupPhase::FirstFrame);
+
+		// Frames are already paced at the HMD's refresh rate, see interactiveFrameRate, so
+		// this submits at most once per compositor frame.
+		if (dashboardVisible && submittedContent != renderedContent)
 		{
+			ScopedTiming timing(TimingSection::SubmitOverlay);
+			SPACECAL_ZONE("SubmitOverlay");
 			vr::Texture_t vrTex;
-			vrTex.eType = vr::TextureType_OpenGL;
-			vrTex.eColorSpace = vr::ColorSpace_Auto;
+			if (overlayTexture.Active())
+			{
+				vrTex = overlayTexture.VRTexture();
+			}
+			else
+			{
+				vrTex.eType = vr::TextureType_OpenGL;
+				vrTex.eColorSpace = vr::ColorSpace_Auto;
 
-			vrTex.handle = (void *)
+				vrTex.handle = (void *)
 #if defined _WIN64 || defined _LP64
-			(uint64_t)
+				(uint64_t)
 #endif
-				fboTextureHandle;
+					fboTextureHandle;
+			}
 
-			vr::HmdVector2_t mouseScale = { (float) fboTextureWidth, (float) fboTextureHeight };
+			vr::HmdVector2_t mouseScale = { (float) UIWidth, (float) UIHeight };
 
 			vr::VROverlay()->SetOverlayTexture(overlayMainHandle, &vrTex);
 			vr::VROverlay()->SetOverlayMouseScale(overlayMainHandle, &mouseScale);
+			submittedContent = renderedContent;
 		}
 
-		const double dashboardInterval = 1.0 / 90.0; // fps
-		double waitEventsTimeout = CalCtx.wantedUpdateInterval;
+		SPACECAL_FRAME_MARK("UI frame");
+		glfwWaitEventsTimeout(waitEventsTimeout);
+	}
+}
 
-		if (dashboardVisible && waitEventsTimeout > dashboardInterval)
-			waitEventsTimeout = dashboardInterval;
+/**
+ * Waits with only the tray icon and the dashboard overlay's thumbnail, which need no GL, and
+ * brings the UI up when either is opened. glfwWaitEventsTimeout pumps the tray's messages too.
+ */
+static void RunTray()
+{
+	tray.Add(L"Space Calibrator");
 
-		glfwWaitEventsTimeout(waitEventsTimeout);
+	while (true)
+	{
+		CheckCalibrationThread();
+		TryCreateVROverlay();
+
+		bool dashboardVisible = false;
+		if (overlayMainHandle && vr::VROverlay())
+		{
+			dashboardVisible = vr::VROverlay()->IsActiveDashboardOverlay(overlayMainHandle);
+
+			vr::VREvent_t vrEvent;
+			while (vr::VROverlay()->PollNextOverlayEvent(overlayMainHandle, &vrEvent, sizeof(vrEvent)))
+			{
+				if (vrEvent.eventType == vr::VREvent_Quit)
+					quitting = true;
+			}
+		}
+
+		auto published = LatestCalibrationSnapshot();
+		quitting |= published->quitRequested;
+		if (quitting || tray.quitRequested)
+			return;
+		TakeDiagnosticsRequest();
+
+		if (tray.openRequested || dashboardVisible)
+		{
+			bool openWindow = tray.openRequested;
+			tray.openRequested = false;
+
+			SetProcessIdle(false);
+
+			CreateGLFWWindow();
+			if (openWindow)
+				ShowDesktopWindow();
+			RunLoop();
+			DestroyGLFWWindow();
+			if (CalCtx.lowMemory)
+				TrimMemory();
+			continue;
+		}
+
+		bool dashboardActive = published->dashboardActive;
+		bool calibrating = published->state != CalibrationState::None;
+
+		// The UI was unseen for UIIdleTimeout before it closed, there's no need to wait for IdleQoSDelay.
+		SetProcessIdle(!dashboardActive && !calibrating);
+		glfwWaitEventsTimeout(HiddenWaitTimeout(dashboardActive, 0));
 	}
 }
 
 int APIENTRY wWinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance, _In_ LPWSTR lpCmdLine, _In_ int nCmdShow)
 {
+	StartStartupTimings();
 	_getcwd(cwd, MAX_PATH);
+
+	// Before the command line, the headless modes tick too. Their exit unregisters with the process.
+	SPACECAL_INSTRUMENTATION_START();
 	HandleCommandLine(lpCmdLine);
 
 #ifdef DEBUG_LOGS
 	CreateConsole();
 #endif
+	Events.Start();
 
 	if (!glfwInit())
 	{
@@ -358,25 +988,26 @@ int APIENTRY wWinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance
 
 	try {
 		InitVR();
-		CreateGLFWWindow();
-		InitCalibrator();
-		LoadProfile(CalCtx);
-		RunLoop();
+		StartCalibrationThread(glfwGetTime, OnCalibrationTick);
+		if (trayMode)
+		{
+			RunTray();
+		}
+		else
+		{
+			CreateGLFWWindow();
+			RunLoop();
+		}
+		StopCalibrationThread();
 
+		DestroyGLFWWindow();
+		tray.Remove();
 		vr::VR_Shutdown();
-
-		if (fboHandle)
-			glDeleteFramebuffers(1, &fboHandle);
-
-		if (fboTextureHandle)
-			glDeleteTextures(1, &fboTextureHandle);
-
-		ImGui_ImplOpenGL3_Shutdown();
-		ImGui_ImplGlfw_Shutdown();
-		ImGui::DestroyContext();
 	}
 	catch (std::runtime_error &e)
 	{
+		StopCalibrationThread();
+
 		std::cerr << "Runtime error: " << e.what() << std::endl;
 		wchar_t message[1024];
 		swprintf(message, 1024, L"%hs", e.what());
@@ -387,12 +1018,279 @@ int APIENTRY wWinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance
 		glfwDestroyWindow(glfwWindow);
 
 	glfwTerminate();
+	Events.Stop();
+	SPACECAL_INSTRUMENTATION_STOP();
+	return exitCode;
+}
+
+// Upper bound in nanoseconds of the histogram bucket containing the given fraction of calls.
+static uint64_t PoseHookPercentile(const protocol::PoseHookStats &stats, double fraction)
+{
+	uint64_t seen = 0;
+	for (uint32_t i = 0; i < protocol::PoseHookLatencyBuckets; i++)
+	{
+		seen += stats.latencyHistogram[i];
+		if (seen >= fraction * stats.calls)
+			return 2ull << i;
+	}
 	return 0;
 }
 
+static int PrintPoseHookStats()
+{
+	try
+	{
+		IPCClient driver;
+		driver.Connect();
+		if (!driver.Supports(protocol::CapabilityPoseHookStats))
+			throw std::runtime_error("driver doesn't report pose hook statistics");
+
+		protocol::Response first = driver.SendBlocking(protocol::Request(protocol::RequestPoseHookStats));
+		Sleep(1000);
+		protocol::Response second = driver.SendBlocking(protocol::Request(protocol::RequestPoseHookStats));
+		if (first.type != protocol::ResponsePoseHookStats || second.type != protocol::ResponsePoseHookStats)
+			throw std::runtime_error("driver doesn't report pose hook statistics");
+
+		auto &stats = second.poseHookStats;
+		double elapsed = stats.timestamp - first.poseHookStats.timestamp;
+
+		printf("Pose hook calls: %llu\n", (unsigned long long) stats.calls);
+		if (stats.calls)
+		{
+			printf("Mean: %.0f ns, max: %llu ns, p50 < %llu ns, p99 < %llu ns, p99.9 < %llu ns\n",
+				(double) stats.totalNanoseconds / stats.calls, (unsigned long long) stats.maxNanoseconds,
+				(unsigned long long) PoseHookPercentile(stats, 0.5), (unsigned long long) PoseHookPercentile(stats, 0.99),
+				(unsigned long long) PoseHookPercentile(stats, 0.999));
+		}
+
+		printf("Poses queued in the driver: %llu, dropped: %llu\n", (unsigned long long) stats.queuedPoses, (unsigned long long) stats.queueOverflows);
+		printf("Transformed poses: %llu\n", (unsigned long long) stats.transformedPoses);
+
+		for (uint32_t id = 0; id < vr::k_unMaxTrackedDeviceCount; id++)
+		{
+			uint64_t updates = stats.deviceUpdates[id] - first.poseHookStats.deviceUpdates[id];
+			if (updates)
+				printf("Device %u: %.1f updates/s\n", id, updates / elapsed);
+		}
+		return 0;
+	}
+	catch (std::runtime_error &e)
+	{
+		fprintf(stderr, "%s\n", e.what());
+		return -1;
+	}
+}
+
+// Sets the driver's runtime trace categories, a protocol::TraceCategory mask.
+static int SetDriverTraceCategories(uint32_t categories)
+{
+	try
+	{
+		IPCClient driver;
+		driver.Connect();
+		if (!driver.Shared())
+			throw std::runtime_error("driver shared memory unavailable");
+
+		driver.Shared()->traceCategories.store(categories);
+		printf("Driver trace categories set to 0x%x\n", categories);
+		return 0;
+	}
+	catch (std::runtime_error &e)
+	{
+		fprintf(stderr, "%s\n", e.what());
+		return -1;
+	}
+}
+
+// Path argument of a command line option, optionally quoted.
+static std::string CommandLinePath(LPCWSTR arg)
+{
+	std::wstring widePath = arg;
+	if (widePath.size() >= 2 && widePath.front() == L'"' && widePath.back() == L'"')
+		widePath = widePath.substr(1, widePath.size() - 2);
+
+	char path[MAX_PATH] = { 0 };
+	WideCharToMultiByte(CP_ACP, 0, widePath.c_str(), -1, path, MAX_PATH, nullptr, nullptr);
+	return path;
+}
+
+// Replaces the saved profile with a JSON profile file.
+static int ImportProfileFile(const std::string &path)
+{
+	try
+	{
+		ImportProfile(CalCtx, path);
+		SaveProfile(CalCtx);
+		Profiles.Flush();
+		printf("Imported profile from %s\n", path.c_str());
+		return 0;
+	}
+	catch (std::runtime_error &e)
+	{
+		fprintf(stderr, "Error importing profile: %s\n", e.what());
+		return -1;
+	}
+}
+
+static int ExportProfileFile(const std::string &path)
+{
+	try
+	{
+		LoadProfile(CalCtx);
+		ExportProfile(CalCtx, path);
+		printf("Exported profile to %s\n", path.c_str());
+		return 0;
+	}
+	catch (std::runtime_error &e)
+	{
+		fprintf(stderr, "Error exporting profile: %s\n", e.what());
+		return -1;
+	}
+}
+
+static double HeadlessClock()
+{
+	static LARGE_INTEGER frequency, start;
+	if (!frequency.QuadPart)
+	{
+		QueryPerformanceFrequency(&frequency);
+		QueryPerformanceCounter(&start);
+	}
+
+	LARGE_INTEGER now;
+	QueryPerformanceCounter(&now);
+	return (double) (now.QuadPart - start.QuadPart) / frequency.QuadPart;
+}
+
+// How long -applyprofile waits for the driver, its reconnect backoff gets past this only when it's missing.
+static const double HeadlessConnectTimeout = 15.0;
+
+/**
+ * Writes a diagnostics report without a window, see Diagnostics.h, for support to ask for
+ * while SteamVR runs. Waits until the driver connected, or gives up waiting like
+ * -applyprofile and reports it disconnected, so the report shows the devices with the profile
+ * applied either way.
+ */
+static int RunDiagnostics(const std::string &path)
+{
+	int ret = 0;
+	try
+	{
+		InitVR();
+		HeadlessClock();
+		StartCalibrationThread(HeadlessClock, nullptr);
+
+		while (!LatestCalibrationSnapshot()->driverConnected && HeadlessClock() < HeadlessConnectTimeout)
+		{
+			Sleep(100);
+			CheckCalibrationThread();
+		}
+
+		auto result = PostCalibrationCommand([path](CalibrationContext &ctx) {
+			if (!WriteDiagnosticsReport(ctx, path))
+				return false;
+			printf("%s", ctx.messages[ctx.messages.Size() - 1].text.c_str());
+			return true;
+		});
+		while (!result->Done())
+		{
+			Sleep(10);
+			CheckCalibrationThread();
+		}
+		if (result->Status() != CommandStatus::Succeeded)
+		{
+			fprintf(stderr, "Couldn't write the diagnostics report\n");
+			ret = -1;
+		}
+	}
+	catch (std::runtime_error &e)
+	{
+		fprintf(stderr, "%s\n", e.what());
+		ret = -1;
+	}
+
+	StopCalibrationThread();
+	vr::VR_Shutdown();
+	return ret;
+}
+
+/**
+ * Runs the calibration thread without a window, GL context or ImGui. The thread loads the
+ * profile and applies it to every device in the tick that connects to the driver, so with
+ * exitWhenApplied the first tick that sees the driver connected is the last one needed, and
+ * the transforms stay in the driver after we exit. Otherwise it keeps going like the UI would,
+ * following devices and universes, until SteamVR quits.
+ */
+static int RunHeadless(bool exitWhenApplied)
+{
+	int ret = 0;
+	try
+	{
+		InitVR();
+		HeadlessClock(); // Starts the clock before the thread can race to it.
+		StartCalibrationThread(HeadlessClock, nullptr);
+
+		while (true)
+		{
+			Sleep(100);
+			CheckCalibrationThread();
+
+			auto published = LatestCalibrationSnapshot();
+			if (published->quitRequested)
+				break;
+
+			if (exitWhenApplied && published->driverConnected)
+			{
+				if (!published->validProfile && !published->hasOtherTargets)
+					printf("Connected to the driver, but there is no calibration to apply\n");
+				else
+					printf("Applied profile to the driver\n");
+				break;
+			}
+			if (exitWhenApplied && HeadlessClock() >= HeadlessConnectTimeout)
+			{
+				fprintf(stderr, "Space Calibrator driver unavailable\n");
+				ret = -1;
+				break;
+			}
+		}
+	}
+	catch (std::runtime_error &e)
+	{
+		fprintf(stderr, "%s\n", e.what());
+		ret = -1;
+	}
+
+	StopCalibrationThread();
+	vr::VR_Shutdown();
+	return ret;
+}
+
 static void HandleCommandLine(LPWSTR lpCmdLine)
 {
-	if (lstrcmp(lpCmdLine, L"-openvrpath") == 0)
+	// -lowmemory can follow any of the others.
+	size_t length = wcslen(lpCmdLine);
+	if (length >= 10 && wcscmp(lpCmdLine + length - 10, L"-lowmemory") == 0 && (length == 10 || lpCmdLine[length - 11] == L' '))
+	{
+		CalCtx.lowMemory = true;
+		lpCmdLine[length == 10 ? 0 : length - 11] = 0;
+	}
+
+	if (lstrcmp(lpCmdLine, L"-overlayonly") == 0)
+	{
+		overlayOnly = true;
+	}
+	else if (lstrcmp(lpCmdLine, L"-tray") == 0)
+	{
+		trayMode = true;
+	}
+	else if (lstrcmp(lpCmdLine, L"-startupbenchmark") == 0 || wcsncmp(lpCmdLine, L"-startupbenchmark ", 18) == 0)
+	{
+		startupBenchmark = true;
+		if (lpCmdLine[17])
+			startupReportPath = CommandLinePath(lpCmdLine + 18);
+	}
+	else if (lstrcmp(lpCmdLine, L"-openvrpath") == 0)
 	{
 		auto vrErr = vr::VRInitError_None;
 		vr::VR_Init(&vrErr, vr::VRApplication_Utility);
@@ -496,4 +1394,64 @@ static void HandleCommandLine(LPWSTR lpCmdLine)
 		vr::VR_Shutdown();
 		exit(ret);
 	}
+	else if (lstrcmp(lpCmdLine, L"-hookstats") == 0)
+	{
+		exit(PrintPoseHookStats());
+	}
+	else if (wcsncmp(lpCmdLine, L"-trace ", 7) == 0)
+	{
+		exit(SetDriverTraceCategories((uint32_t) wcstoul(lpCmdLine + 7, nullptr, 0)));
+	}
+	else if (wcsncmp(lpCmdLine, L"-benchmark ", 11) == 0)
+	{
+		// Offline, so no OpenVR. Results go to stdout like -openvrpath, redirect them to keep them.
+		exit(RunCalibrationBenchmark(CommandLinePath(lpCmdLine + 11)));
+	}
+	else if (wcsncmp(lpCmdLine, L"-batch ", 7) == 0)
+	{
+		exit(RunBatchCalibration(CommandLinePath(lpCmdLine + 7)));
+	}
+	else if (lstrcmp(lpCmdLine, L"-simulate") == 0 || wcsncmp(lpCmdLine, L"-simulate ", 10) == 0)
+	{
+		// Offline like -benchmark, the options are key=value pairs, see ParseSimulationOptions.
+		SimulationOptions options;
+		if (!ParseSimulationOptions(lpCmdLine[9] ? CommandLinePath(lpCmdLine + 10) : "", options))
+		{
+			fprintf(stderr, "Usage: -simulate [targets=1] [samples=250] [seconds=60] [rate=250] [noise=1 mm] [rotationnoise=0.1 deg] "
+				"[latency=20 ms] [drift=0 mm/min] [rotationdrift=0 deg/min] [seed=1] [gravity=0]\n");
+			exit(-1);
+		}
+		exit(RunCalibrationSimulation(options));
+	}
+	else if (lstrcmp(lpCmdLine, L"-ipcbenchmark") == 0 || wcsncmp(lpCmdLine, L"-ipcbenchmark ", 14) == 0)
+	{
+		// Against the driver SteamVR has loaded, with four connections at once unless told otherwise.
+		uint32_t clients = lpCmdLine[13] ? (uint32_t) wcstoul(lpCmdLine + 14, nullptr, 10) : 4;
+		exit(RunIPCBenchmark(clients ? clients : 1));
+	}
+	else if (wcsncmp(lpCmdLine, L"-dumpevents ", 12) == 0)
+	{
+		exit(DumpEventFile(CommandLinePath(lpCmdLine + 12)));
+	}
+	else if (wcsncmp(lpCmdLine, L"-importprofile ", 15) == 0)
+	{
+		exit(ImportProfileFile(CommandLinePath(lpCmdLine + 15)));
+	}
+	else if (wcsncmp(lpCmdLine, L"-exportprofile ", 15) == 0)
+	{
+		exit(ExportProfileFile(CommandLinePath(lpCmdLine + 15)));
+	}
+	else if (lstrcmp(lpCmdLine, L"-diagnostics") == 0 || wcsncmp(lpCmdLine, L"-diagnostics ", 13) == 0)
+	{
+		// Into the profile directory unless given a file.
+		exit(RunDiagnostics(lpCmdLine[12] ? CommandLinePath(lpCmdLine + 13) : ""));
+	}
+	else if (lstrcmp(lpCmdLine, L"-applyprofile") == 0)
+	{
+		exit(RunHeadless(true));
+	}
+	else if (lstrcmp(lpCmdLine, L"-headless") == 0)
+	{
+		exit(RunHeadless(false));
+	}
 }
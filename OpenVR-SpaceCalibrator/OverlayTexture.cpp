@@ -0,0 +1,154 @@
+#include "stdafx.h"
+#include "OverlayTexture.h"
+
+#include <d3d11.h>
+#include <dxgi.h>
+
+#pragma comment(lib, "d3d11.lib")
+#pragma comment(lib, "dxgi.lib")
+
+// WGL_NV_DX_interop, not covered by gl3w.
+#define WGL_ACCESS_WRITE_DISCARD_NV 0x0002
+
+typedef HANDLE (WINAPI *PFNWGLDXOPENDEVICENVPROC)(void *dxDevice);
+typedef BOOL (WINAPI *PFNWGLDXCLOSEDEVICENVPROC)(HANDLE hDevice);
+typedef HANDLE (WINAPI *PFNWGLDXREGISTEROBJECTNVPROC)(HANDLE hDevice, void *dxObject, GLuint name, GLenum type, GLenum access);
+typedef BOOL (WINAPI *PFNWGLDXUNREGISTEROBJECTNVPROC)(HANDLE hDevice, HANDLE hObject);
+typedef BOOL (WINAPI *PFNWGLDXLOCKOBJECTSNVPROC)(HANDLE hDevice, GLint count, HANDLE *hObjects);
+typedef BOOL (WINAPI *PFNWGLDXUNLOCKOBJECTSNVPROC)(HANDLE hDevice, GLint count, HANDLE *hObjects);
+
+static PFNWGLDXOPENDEVICENVPROC wglDXOpenDeviceNV;
+static PFNWGLDXCLOSEDEVICENVPROC wglDXCloseDeviceNV;
+static PFNWGLDXREGISTEROBJECTNVPROC wglDXRegisterObjectNV;
+static PFNWGLDXUNREGISTEROBJECTNVPROC wglDXUnregisterObjectNV;
+static PFNWGLDXLOCKOBJECTSNVPROC wglDXLockObjectsNV;
+static PFNWGLDXUNLOCKOBJECTSNVPROC wglDXUnlockObjectsNV;
+
+static bool LoadInteropFunctions()
+{
+	wglDXOpenDeviceNV = (PFNWGLDXOPENDEVICENVPROC) wglGetProcAddress("wglDXOpenDeviceNV");
+	wglDXCloseDeviceNV = (PFNWGLDXCLOSEDEVICENVPROC) wglGetProcAddress("wglDXCloseDeviceNV");
+	wglDXRegisterObjectNV = (PFNWGLDXREGISTEROBJECTNVPROC) wglGetProcAddress("wglDXRegisterObjectNV");
+	wglDXUnregisterObjectNV = (PFNWGLDXUNREGISTEROBJECTNVPROC) wglGetProcAddress("wglDXUnregisterObjectNV");
+	wglDXLockObjectsNV = (PFNWGLDXLOCKOBJECTSNVPROC) wglGetProcAddress("wglDXLockObjectsNV");
+	wglDXUnlockObjectsNV = (PFNWGLDXUNLOCKOBJECTSNVPROC) wglGetProcAddress("wglDXUnlockObjectsNV");
+
+	return wglDXOpenDeviceNV && wglDXCloseDeviceNV && wglDXRegisterObjectNV
+		&& wglDXUnregisterObjectNV && wglDXLockObjectsNV && wglDXUnlockObjectsNV;
+}
+
+// The compositor rejects textures created on a different adapter than the HMD's.
+static IDXGIAdapter1 *FindHMDAdapter()
+{
+	int32_t adapterIndex = 0;
+	vr::VRSystem()->GetDXGIOutputInfo(&adapterIndex);
+
+	IDXGIFactory1 *factory = nullptr;
+	if (FAILED(CreateDXGIFactory1(__uuidof(IDXGIFactory1), (void **) &factory)))
+		return nullptr;
+
+	IDXGIAdapter1 *adapter = nullptr;
+	if (adapterIndex < 0 || FAILED(factory->EnumAdapters1((UINT) adapterIndex, &adapter)))
+		adapter = nullptr;
+
+	factory->Release();
+	return adapter;
+}
+
+bool SharedOverlayTexture::Init(int width, int height, GLuint glTexture)
+{
+	if (!vr::VRSystem() || !LoadInteropFunctions())
+		return false;
+
+	IDXGIAdapter1 *adapter = FindHMDAdapter();
+	if (!adapter)
+		return false;
+
+	D3D_FEATURE_LEVEL featureLevel = D3D_FEATURE_LEVEL_11_0;
+	HRESULT hr = D3D11CreateDevice(adapter, D3D_DRIVER_TYPE_UNKNOWN, nullptr, 0, &featureLevel, 1, D3D11_SDK_VERSION, &device, nullptr, &context);
+	adapter->Release();
+
+	if (FAILED(hr))
+	{
+		std::cerr << "Shared overlay texture: could not create D3D11 device" << std::endl;
+		Shutdown();
+		return false;
+	}
+
+	D3D11_TEXTURE2D_DESC desc = {};
+	desc.Width = width;
+	desc.Height = height;
+	desc.MipLevels = 1;
+	desc.ArraySize = 1;
+	desc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+	desc.SampleDesc.Count = 1;
+	desc.Usage = D3D11_USAGE_DEFAULT;
+	desc.BindFlags = D3D11_BIND_RENDER_TARGET | D3D11_BIND_SHADER_RESOURCE;
+	desc.MiscFlags = D3D11_RESOURCE_MISC_SHARED;
+
+	if (FAILED(device->CreateTexture2D(&desc, nullptr, &texture)))
+	{
+		std::cerr << "Shared overlay texture: could not create D3D11 texture" << std::endl;
+		Shutdown();
+		return false;
+	}
+
+	interopDevice = wglDXOpenDeviceNV(device);
+	if (interopDevice)
+		interopObject = wglDXRegisterObjectNV(interopDevice, texture, glTexture, GL_TEXTURE_2D, WGL_ACCESS_WRITE_DISCARD_NV);
+
+	if (!interopObject)
+	{
+		std::cerr << "Shared overlay texture: WGL_NV_DX_interop registration failed" << std::endl;
+		Shutdown();
+		return false;
+	}
+
+	return true;
+}
+
+void SharedOverlayTexture::Shutdown()
+{
+	Unlock();
+
+	if (interopObject)
+		wglDXUnregisterObjectNV(interopDevice, interopObject);
+	if (interopDevice)
+		wglDXCloseDeviceNV(interopDevice);
+	interopObject = nullptr;
+	interopDevice = nullptr;
+
+	if (texture)
+		texture->Release();
+	if (context)
+		context->Release();
+	if (device)
+		device->Release();
+	texture = nullptr;
+	context = nullptr;
+	device = nullptr;
+}
+
+void SharedOverlayTexture::Lock()
+{
+	if (interopObject && !locked)
+		locked = wglDXLockObjectsNV(interopDevice, 1, &interopObject) != FALSE;
+}
+
+void SharedOverlayTexture::Unlock()
+{
+	if (interopObject && locked)
+	{
+		wglDXUnlockObjectsNV(interopDevice, 1, &interopObject);
+		locked = false;
+	}
+}
+
+vr::Texture_t SharedOverlayTexture::VRTexture() const
+{
+	vr::Texture_t vrTex;
+	vrTex.eType = vr::TextureType_DirectX;
+	vrTex.eColorSpace = vr::ColorSpace_Auto;
+	vrTex.handle = texture;
+	return vrTex;
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <GL/gl3w.h>
+#include <openvr.h>
+
+struct ID3D11Device;
+struct ID3D11DeviceContext;
+struct ID3D11Texture2D;
+
+/**
+ * A D3D11 texture that GL renders into through WGL_NV_DX_interop. SteamVR's compositor is
+ * D3D11, so handing it this texture skips the copy it makes for every TextureType_OpenGL
+ * submission. GL may only touch the texture between Lock and Unlock, and the compositor
+ * should only be given it while unlocked.
+ */
+class SharedOverlayTexture
+{
+public:
+	~SharedOverlayTexture() { Shutdown(); }
+
+	// Creates the texture on the HMD's adapter and binds it to glTexture, which must be a
+	// name from glGenTextures that has no storage yet. Returns false if interop isn't
+	// available, in which case glTexture is left untouched.
+	bool Init(int width, int height, GLuint glTexture);
+	void Shutdown();
+
+	bool Active() const { return interopObject != nullptr; }
+
+	// No-ops when not active.
+	void Lock();
+	void Unlock();
+
+	vr::Texture_t VRTexture() const;
+
+private:
+	ID3D11Device *device = nullptr;
+	ID3D11DeviceContext *context = nullptr;
+	ID3D11Texture2D *texture = nullptr;
+	void *interopDevice = nullptr;
+	void *interopObject = nullptr;
+	bool locked = false;
+};
@@ -0,0 +1,272 @@
+#include "stdafx.h"
+#include "PoseCapture.h"
+#include "../QuaternionMath.h"
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+
+PoseCaptureReader::~PoseCaptureReader()
+{
+	Close();
+}
+
+bool PoseCaptureReader::Open(protocol::PoseCaptureBuffer *captureBuffer)
+{
+	buffer = captureBuffer;
+	if (!buffer)
+		return false;
+
+	SetDevices(0);
+	return true;
+}
+
+void PoseCaptureReader::Close()
+{
+	if (buffer)
+		buffer->deviceMask.store(0, std::memory_order_relaxed);
+
+	buffer = nullptr;
+}
+
+void PoseCaptureReader::SetDevices(uint64_t deviceMask)
+{
+	if (!buffer)
+		return;
+
+	buffer->deviceMask.store(deviceMask, std::memory_order_relaxed);
+	readIndex = buffer->writeIndex.load(std::memory_order_acquire);
+}
+
+void PoseCaptureReader::SetMaxRate(uint64_t deviceMask, double rate)
+{
+	if (!buffer)
+		return;
+
+	uint32_t interval = rate > 0 ? (uint32_t) (1e6 / rate) : 0;
+	for (uint32_t id = 0; id < vr::k_unMaxTrackedDeviceCount; id++)
+	{
+		if (deviceMask & (1ull << id))
+			buffer->minInterval[id].store(interval, std::memory_order_relaxed);
+	}
+}
+
+uint64_t PoseCaptureReader::Drain(std::vector<protocol::PoseCaptureSample> &out)
+{
+	if (!buffer)
+		return 0;
+
+	return buffer->Drain(readIndex, [&](const protocol::PoseCaptureSample &sample) { out.push_back(sample); });
+}
+
+void PoseHistory::Push(const protocol::PoseCaptureSample &sample)
+{
+	// Interpolation needs increasing timestamps, late arrivals are dropped.
+	if (count > 0 && sample.timestamp <= LatestTime())
+		return;
+
+	if (count < Capacity)
+	{
+		samples[(start + count) % Capacity] = sample;
+		count++;
+	}
+	else
+	{
+		samples[start] = sample;
+		start = (start + 1) % Capacity;
+	}
+}
+
+// Finds the stored poses around time, after is the index of the later one and t the blend factor.
+bool PoseHistory::Bracket(double time, size_t &after, double &t) const
+{
+	if (count < 2 || time < OldestTime() || time > LatestTime())
+		return false;
+
+	size_t lo = 1, hi = count - 1;
+	while (lo < hi)
+	{
+		size_t mid = (lo + hi) / 2;
+		if (At(mid).timestamp < time)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+
+	const auto &a = At(lo - 1), &b = At(lo);
+	if (!a.valid || !b.valid)
+		return false;
+
+	after = lo;
+	t = (time - a.timestamp) / (b.timestamp - a.timestamp);
+	return true;
+}
+
+bool PoseHistory::Interpolate(double time, protocol::PoseCaptureSample &out) const
+{
+	size_t after;
+	double t;
+	if (!Bracket(time, after, t))
+		return false;
+
+	const auto &a = At(after - 1), &b = At(after);
+
+	out = b;
+	out.timestamp = time;
+	for (int i = 0; i < 3; i++)
+		out.position[i] = a.position[i] + (b.position[i] - a.position[i]) * t;
+	out.rotation = quaternionSlerp(a.rotation, b.rotation, t);
+	out.linearSpeed = a.linearSpeed + (b.linearSpeed - a.linearSpeed) * t;
+	out.angularSpeed = a.angularSpeed + (b.angularSpeed - a.angularSpeed) * t;
+	if (a.trackingResult != vr::TrackingResult_Running_OK)
+		out.trackingResult = a.trackingResult;
+	return true;
+}
+
+bool PoseHistory::InterpolateAngularSpeed(double time, double &speed) const
+{
+	size_t after;
+	double t;
+	if (!Bracket(time, after, t))
+		return false;
+
+	const auto &a = At(after - 1), &b = At(after);
+	speed = a.angularSpeed + (b.angularSpeed - a.angularSpeed) * t;
+	return true;
+}
+
+// Search range and resolution for the latency estimate, and the history it looks at. Lags
+// are whole grid steps, the peak is refined between them.
+static const double MaxCaptureLatency = 0.05;
+static const double LatencyWindow = 1.0;
+static const double LatencyGridStep = 0.002;
+static const int LatencyLags = (int) (MaxCaptureLatency / LatencyGridStep + 0.5);
+
+// In place, radix 2, data.size() a power of two. inverse leaves out the 1/n.
+static void FFT(std::vector<std::complex<double>> &data, bool inverse)
+{
+	size_t n = data.size();
+	for (size_t i = 1, j = 0; i < n; i++)
+	{
+		size_t bit = n >> 1;
+		for (; j & bit; bit >>= 1)
+			j ^= bit;
+		j ^= bit;
+		if (i < j)
+			std::swap(data[i], data[j]);
+	}
+
+	for (size_t length = 2; length <= n; length <<= 1)
+	{
+		double angle = (inverse ? 2 : -2) * 3.14159265358979323846 / length;
+		std::complex<double> step(cos(angle), sin(angle));
+		for (size_t i = 0; i < n; i += length)
+		{
+			std::complex<double> w(1);
+			for (size_t k = 0; k < length / 2; k++)
+			{
+				auto a = data[i + k], b = data[i + k + length / 2] * w;
+				data[i + k] = a + b;
+				data[i + k + length / 2] = a - b;
+				w *= step;
+			}
+		}
+	}
+}
+
+bool EstimateCaptureLatency(const PoseHistory &reference, const PoseHistory &target, double &latency)
+{
+	if (reference.Empty() || target.Empty())
+		return false;
+
+	// Target times whose reference counterpart is available for every candidate latency.
+	double end = std::min(target.LatestTime(), reference.LatestTime() - MaxCaptureLatency);
+	double begin = std::max(end - LatencyWindow, std::max(target.OldestTime(), reference.OldestTime() + MaxCaptureLatency));
+	if (end - begin < LatencyWindow * 0.5)
+		return false;
+
+	std::vector<double> targetSpeed;
+	for (double t = begin; t <= end; t += LatencyGridStep)
+	{
+		double speed;
+		if (!target.InterpolateAngularSpeed(t, speed))
+			return false;
+		targetSpeed.push_back(speed);
+	}
+
+	size_t count = targetSpeed.size();
+	double mean = 0, variance = 0;
+	for (double v : targetSpeed)
+		mean += v;
+	mean /= count;
+	for (double v : targetSpeed)
+		variance += (v - mean) * (v - mean);
+
+	// Needs the devices to actually speed up and slow down for the correlation to mean anything.
+	if (variance / count < 0.1)
+		return false;
+
+	// The reference on the same grid, widened by the largest lag on both sides. Lag k compares
+	// target sample i with reference sample i + k.
+	size_t lags = 2 * LatencyLags + 1;
+	std::vector<double> referenceSpeed(count + lags - 1);
+	for (size_t j = 0; j < referenceSpeed.size(); j++)
+	{
+		if (!reference.InterpolateAngularSpeed(begin + ((int) j - LatencyLags) * LatencyGridStep, referenceSpeed[j]))
+			return false;
+	}
+
+	// Every lag's cross term at once, as the inverse transform of the reference's spectrum
+	// times the conjugate of the centred target's. Padded so the circular correlation doesn't
+	// wrap into the lags looked at.
+	size_t size = 1;
+	while (size < referenceSpeed.size() + count)
+		size <<= 1;
+	std::vector<std::complex<double>> referenceSpectrum(size), targetSpectrum(size);
+	for (size_t j = 0; j < referenceSpeed.size(); j++)
+		referenceSpectrum[j] = referenceSpeed[j];
+	for (size_t i = 0; i < count; i++)
+		targetSpectrum[i] = targetSpeed[i] - mean;
+	FFT(referenceSpectrum, false);
+	FFT(targetSpectrum, false);
+	for (size_t i = 0; i < size; i++)
+		referenceSpectrum[i] *= std::conj(targetSpectrum[i]);
+	FFT(referenceSpectrum, true);
+
+	// The target is centred, so the reference's mean drops out of the cross term but not out
+	// of its variance over each lag's window, taken from running sums.
+	std::vector<double> sums(referenceSpeed.size() + 1, 0.0), squares(referenceSpeed.size() + 1, 0.0);
+	for (size_t j = 0; j < referenceSpeed.size(); j++)
+	{
+		sums[j + 1] = sums[j] + referenceSpeed[j];
+		squares[j + 1] = squares[j] + referenceSpeed[j] * referenceSpeed[j];
+	}
+
+	std::vector<double> correlation(lags);
+	size_t best = 0;
+	for (size_t k = 0; k < lags; k++)
+	{
+		double sum = sums[k + count] - sums[k];
+		double refVariance = squares[k + count] - squares[k] - sum * sum / count;
+		double cross = referenceSpectrum[k].real() / size;
+		correlation[k] = refVariance > 0 ? cross / sqrt(refVariance * variance) : 0;
+		if (correlation[k] > correlation[best])
+			best = k;
+	}
+
+	if (correlation[best] < 0.8)
+		return false;
+
+	// A parabola through the peak and its neighbours places it between grid steps.
+	double offset = 0;
+	if (best > 0 && best + 1 < lags)
+	{
+		double a = correlation[best - 1], b = correlation[best], c = correlation[best + 1];
+		double curvature = a - 2 * b + c;
+		if (curvature < 0)
+			offset = std::max(-0.5, std::min(0.5 * (a - c) / curvature, 0.5));
+	}
+
+	latency = ((int) best - LatencyLags + offset) * LatencyGridStep;
+	return true;
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "../Protocol.h"
+
+#include <vector>
+
+// Reads raw poses that the driver captures at tracking rate, see protocol::PoseCaptureBuffer.
+class PoseCaptureReader
+{
+public:
+	~PoseCaptureReader();
+
+	bool Open(protocol::PoseCaptureBuffer *buffer);
+	void Close();
+	bool IsOpen() const { return buffer != nullptr; }
+
+	// Selects the devices the driver should capture and drops anything captured so far.
+	void SetDevices(uint64_t deviceMask);
+
+	// Decimates the captured poses of the devices in deviceMask to at most rate per second,
+	// for the client and the driver's own consumers alike. 0 captures every pose.
+	void SetMaxRate(uint64_t deviceMask, double rate);
+
+	// Appends every sample published since the last call, returns how many were lost to overruns.
+	uint64_t Drain(std::vector<protocol::PoseCaptureSample> &out);
+
+private:
+	protocol::PoseCaptureBuffer *buffer = nullptr;
+	uint64_t readIndex = 0;
+};
+
+// Recent captured poses of one device, for sampling it at arbitrary times.
+class PoseHistory
+{
+public:
+	static const size_t Capacity = 4096;
+
+	PoseHistory() : samples(Capacity) { }
+
+	void Clear() { start = 0; count = 0; }
+	void Push(const protocol::PoseCaptureSample &sample);
+
+	bool Empty() const { return count == 0; }
+	double OldestTime() const { return At(0).timestamp; }
+	double LatestTime() const { return At(count - 1).timestamp; }
+
+	// Linear interpolation of position and speeds, slerp of rotation. Fails outside the stored
+	// range or when either neighbouring pose is invalid.
+	bool Interpolate(double time, protocol::PoseCaptureSample &out) const;
+	bool InterpolateAngularSpeed(double time, double &speed) const;
+
+private:
+	bool Bracket(double time, size_t &after, double &t) const;
+
+	const protocol::PoseCaptureSample &At(size_t i) const { return samples[(start + i) % Capacity]; }
+
+	std::vector<protocol::PoseCaptureSample> samples;
+	size_t start = 0, count = 0;
+};
+
+// Estimates how much later the reference system reports the same motion than the target
+// system, by cross-correlating the angular speed of the two rigidly attached devices over
+// their recent shared history. All lags are correlated at once through an FFT and the peak is
+// interpolated between grid steps. Returns false when there was too little motion to tell.
+bool EstimateCaptureLatency(const PoseHistory &reference, const PoseHistory &target, double &latency);
@@ -0,0 +1,38 @@
+#include "stdafx.h"
+#include "ProcessQoS.h"
+
+#include <psapi.h>
+
+#pragma comment(lib, "psapi.lib")
+
+static bool processIdle = false;
+
+void SetProcessIdle(bool idle)
+{
+	if (idle == processIdle)
+		return;
+	processIdle = idle;
+
+	// Windows before 10 1709 rejects the request, the priority still applies there.
+	PROCESS_POWER_THROTTLING_STATE throttling = {};
+	throttling.Version = PROCESS_POWER_THROTTLING_CURRENT_VERSION;
+	throttling.ControlMask = PROCESS_POWER_THROTTLING_EXECUTION_SPEED;
+	throttling.StateMask = idle ? PROCESS_POWER_THROTTLING_EXECUTION_SPEED : 0;
+	SetProcessInformation(GetCurrentProcess(), ProcessPowerThrottling, &throttling, sizeof throttling);
+
+	SetPriorityClass(GetCurrentProcess(), idle ? BELOW_NORMAL_PRIORITY_CLASS : NORMAL_PRIORITY_CLASS);
+}
+
+void ProcessWorkingSet(size_t &current, size_t &peak)
+{
+	PROCESS_MEMORY_COUNTERS counters = {};
+	counters.cb = sizeof counters;
+	bool ok = GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof counters) != FALSE;
+	current = ok ? counters.WorkingSetSize : 0;
+	peak = ok ? counters.PeakWorkingSetSize : 0;
+}
+
+void TrimProcessWorkingSet()
+{
+	SetProcessWorkingSetSize(GetCurrentProcess(), (SIZE_T) -1, (SIZE_T) -1);
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstddef>
+
+/**
+ * While the client is idle, nothing on screen and nothing calibrating, the whole process runs
+ * below normal priority and opts into Windows power throttling (EcoQoS), so its once a second
+ * scan runs on efficient cores at low clocks and never competes with the VR application.
+ * Leaving idle restores both at once. Only called from the main thread, repeated calls with
+ * the same value do nothing.
+ */
+void SetProcessIdle(bool idle);
+
+// Bytes of the client's working set now and at its largest, both 0 if Windows won't say.
+void ProcessWorkingSet(size_t &current, size_t &peak);
+
+// Hands the working set back to Windows. Pages the client touches again fault back in.
+void TrimProcessWorkingSet();
@@ -0,0 +1,73 @@
+#include "stdafx.h"
+#include "ProfileDelta.h"
+
+#include <cstring>
+
+// Unchanged bytes between two runs are sent along when they're fewer than a run header.
+static const size_t MinRunGap = sizeof(uint32_t) * 2;
+
+std::vector<uint8_t> EncodeProfileDelta(const std::vector<uint8_t> &from, const std::vector<uint8_t> &to)
+{
+	std::vector<uint8_t> delta;
+	size_t i = 0;
+	while (i < to.size())
+	{
+		if (i < from.size() && from[i] == to[i])
+		{
+			i++;
+			continue;
+		}
+
+		size_t end = i + 1, same = 0;
+		for (size_t j = end; j < to.size() && same < MinRunGap; j++)
+		{
+			if (j < from.size() && from[j] == to[j])
+			{
+				same++;
+			}
+			else
+			{
+				same = 0;
+				end = j + 1;
+			}
+		}
+
+		uint32_t run[2] = { (uint32_t) i, (uint32_t) (end - i) };
+		auto header = reinterpret_cast<const uint8_t *>(run);
+		delta.insert(delta.end(), header, header + sizeof run);
+		delta.insert(delta.end(), to.begin() + i, to.begin() + end);
+		i = end;
+	}
+	return delta;
+}
+
+bool ApplyProfileDelta(std::vector<uint8_t> &profile, const uint8_t *delta, size_t size, uint32_t profileBytes)
+{
+	profile.resize(profileBytes);
+	size_t pos = 0;
+	while (pos < size)
+	{
+		uint32_t run[2];
+		if (size - pos < sizeof run)
+			return false;
+		memcpy(run, delta + pos, sizeof run);
+		pos += sizeof run;
+
+		if (run[0] > profileBytes || run[1] > profileBytes - run[0] || run[1] > size - pos)
+			return false;
+		memcpy(profile.data() + run[0], delta + pos, run[1]);
+		pos += run[1];
+	}
+	return true;
+}
+
+uint64_t HashProfile(const std::vector<uint8_t> &profile)
+{
+	uint64_t hash = 14695981039346656037ull;
+	for (uint8_t byte : profile)
+	{
+		hash ^= byte;
+		hash *= 1099511628211ull;
+	}
+	return hash;
+}
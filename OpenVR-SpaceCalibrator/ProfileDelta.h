@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * Binary profiles keep their layout from one save to the next, so two versions of a profile
+ * differ in a few byte runs. A delta is those runs, each a uint32_t offset, a uint32_t length
+ * and the bytes, which turn the older version into the newer one. Shared by the profile
+ * history and the profile sync between stations.
+ */
+std::vector<uint8_t> EncodeProfileDelta(const std::vector<uint8_t> &from, const std::vector<uint8_t> &to);
+
+// Turns profile into the version the delta was encoded for, which is profileBytes long. False
+// if the delta doesn't fit, the profile is then left partly applied.
+bool ApplyProfileDelta(std::vector<uint8_t> &profile, const uint8_t *delta, size_t size, uint32_t profileBytes);
+
+// FNV-1a, to check a rebuilt version against what it was encoded from.
+uint64_t HashProfile(const std::vector<uint8_t> &profile);
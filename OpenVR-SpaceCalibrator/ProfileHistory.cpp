@@ -0,0 +1,217 @@
+#include "stdafx.h"
+#include "ProfileHistory.h"
+#include "ProfileDelta.h"
+
+#include <iostream>
+
+static const uint32_t HistoryRecordMagic = 0x48504353; // "SCPH"
+
+enum HistoryRecordType : uint32_t
+{
+	HistorySnapshot = 1, // The whole profile.
+	HistoryDelta = 2, // See EncodeProfileDelta.
+};
+
+struct HistoryRecord
+{
+	uint32_t magic;
+	uint32_t type;
+	int64_t time;
+	uint32_t payloadBytes;
+	uint32_t profileBytes;
+	uint64_t hash; // Of the profile the record leads to.
+};
+
+static bool WriteHistoryFile(const std::string &path, const std::vector<uint8_t> &contents, size_t from, DWORD disposition)
+{
+	HANDLE file = CreateFileA(path.c_str(), GENERIC_WRITE, 0, nullptr, disposition, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+		return false;
+
+	LARGE_INTEGER offset;
+	offset.QuadPart = (LONGLONG) from;
+	DWORD bytesWritten = 0;
+	DWORD size = (DWORD) (contents.size() - from);
+	bool ok = SetFilePointerEx(file, offset, nullptr, FILE_BEGIN) &&
+		(size == 0 || (WriteFile(file, contents.data() + from, size, &bytesWritten, nullptr) && bytesWritten == size)) &&
+		SetEndOfFile(file) && FlushFileBuffers(file);
+	CloseHandle(file);
+	return ok;
+}
+
+void ProfileHistory::Open(const std::string &historyPath)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	if (opened)
+		return;
+	opened = true;
+	path = historyPath;
+	if (path.empty())
+		return;
+
+	HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+		return;
+
+	LARGE_INTEGER size;
+	DWORD bytesRead = 0;
+	if (GetFileSizeEx(file, &size) && size.QuadPart > 0 && size.QuadPart < MAXDWORD)
+	{
+		contents.resize((size_t) size.QuadPart);
+		if (!ReadFile(file, contents.data(), (DWORD) contents.size(), &bytesRead, nullptr))
+			bytesRead = 0;
+		contents.resize(bytesRead);
+	}
+	CloseHandle(file);
+
+	Scan();
+}
+
+// Indexes contents and cuts it off after the last intact record.
+void ProfileHistory::Scan()
+{
+	entries.clear();
+	size_t offset = 0;
+	while (contents.size() - offset >= sizeof(HistoryRecord))
+	{
+		HistoryRecord record;
+		memcpy(&record, contents.data() + offset, sizeof record);
+		bool snapshot = record.type == HistorySnapshot;
+		if (record.magic != HistoryRecordMagic || (!snapshot && record.type != HistoryDelta) || (entries.empty() && !snapshot) ||
+			record.payloadBytes > contents.size() - offset - sizeof record)
+			break;
+
+		entries.push_back({ offset, snapshot, { record.time, record.profileBytes } });
+		offset += sizeof record + record.payloadBytes;
+	}
+
+	if (offset != contents.size())
+		std::cerr << "Profile history is damaged after " << entries.size() << " versions, keeping those" << std::endl;
+	contents.resize(offset);
+
+	latestKnown = !entries.empty() && Rebuild(entries.size() - 1, latest);
+}
+
+bool ProfileHistory::Rebuild(size_t index, std::vector<uint8_t> &profile) const
+{
+	if (index >= entries.size())
+		return false;
+
+	size_t first = index;
+	while (!entries[first].snapshot)
+		first--;
+
+	HistoryRecord record;
+	for (size_t i = first; i <= index; i++)
+	{
+		const uint8_t *data = contents.data() + entries[i].offset;
+		memcpy(&record, data, sizeof record);
+		data += sizeof record;
+
+		if (record.type == HistorySnapshot)
+			profile.assign(data, data + record.payloadBytes);
+		else if (!ApplyProfileDelta(profile, data, record.payloadBytes, record.profileBytes))
+			return false;
+	}
+
+	return profile.size() == record.profileBytes && HashProfile(profile) == record.hash;
+}
+
+// Starts the file over at a snapshot of the oldest version kept, the deltas after it follow as
+// they are. If that version can't be rebuilt, at the first one after it that can, and if none
+// can the file stays as it is.
+void ProfileHistory::Compact()
+{
+	size_t first = entries.size() - MaxVersions / 2;
+	std::vector<uint8_t> profile;
+	while (first < entries.size() && !Rebuild(first, profile))
+		first++;
+	if (first == entries.size())
+	{
+		std::cerr << "Couldn't compact profile history " << path << ": no version after " << entries.size() - MaxVersions / 2 << " is intact" << std::endl;
+		return;
+	}
+
+	std::vector<uint8_t> compacted;
+	HistoryRecord record = { HistoryRecordMagic, HistorySnapshot, entries[first].version.time, (uint32_t) profile.size(), (uint32_t) profile.size(), HashProfile(profile) };
+	auto header = reinterpret_cast<const uint8_t *>(&record);
+	compacted.insert(compacted.end(), header, header + sizeof record);
+	compacted.insert(compacted.end(), profile.begin(), profile.end());
+	if (first + 1 < entries.size())
+		compacted.insert(compacted.end(), contents.begin() + entries[first + 1].offset, contents.end());
+
+	auto temporaryPath = path + ".tmp";
+	if (!WriteHistoryFile(temporaryPath, compacted, 0, CREATE_ALWAYS) ||
+		!MoveFileExA(temporaryPath.c_str(), path.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH))
+	{
+		std::cerr << "Couldn't compact profile history " << path << ": " << GetLastError() << std::endl;
+		DeleteFileA(temporaryPath.c_str());
+		return;
+	}
+
+	contents.swap(compacted);
+	Scan();
+	compactions++;
+}
+
+void ProfileHistory::Append(const std::vector<uint8_t> &profile, int64_t time)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	if (path.empty() || profile.empty() || (latestKnown && profile == latest))
+		return;
+
+	if (entries.size() >= MaxVersions)
+		Compact();
+
+	size_t sinceSnapshot = 0;
+	for (size_t i = entries.size(); i > 0 && !entries[i - 1].snapshot; i--)
+		sinceSnapshot++;
+
+	std::vector<uint8_t> payload;
+	bool snapshot = !latestKnown || sinceSnapshot + 1 >= SnapshotInterval;
+	if (!snapshot)
+	{
+		payload = EncodeProfileDelta(latest, profile);
+		snapshot = payload.size() >= profile.size();
+	}
+	if (snapshot)
+		payload = profile;
+
+	HistoryRecord record = { HistoryRecordMagic, snapshot ? HistorySnapshot : HistoryDelta, time, (uint32_t) payload.size(), (uint32_t) profile.size(), HashProfile(profile) };
+	size_t offset = contents.size();
+	auto header = reinterpret_cast<const uint8_t *>(&record);
+	contents.insert(contents.end(), header, header + sizeof record);
+	contents.insert(contents.end(), payload.begin(), payload.end());
+
+	if (!WriteHistoryFile(path, contents, offset, OPEN_ALWAYS))
+	{
+		std::cerr << "Couldn't append to profile history " << path << ": " << GetLastError() << std::endl;
+		contents.resize(offset);
+		return;
+	}
+
+	entries.push_back({ offset, snapshot, { time, (uint32_t) profile.size() } });
+	latest = profile;
+	latestKnown = true;
+}
+
+std::vector<ProfileHistory::Version> ProfileHistory::Versions()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	std::vector<Version> versions;
+	for (auto &entry : entries)
+		versions.push_back(entry.version);
+	return versions;
+}
+
+uint32_t ProfileHistory::Compactions()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return compactions;
+}
+
+bool ProfileHistory::Read(size_t index, std::vector<uint8_t> &profile)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return Rebuild(index, profile);
+}
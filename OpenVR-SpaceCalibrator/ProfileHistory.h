@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * Every profile saved, kept in an append-only file next to the profile and in memory. A version
+ * is stored as the byte ranges that differ from the version before it, or as the whole profile
+ * every SnapshotInterval versions and whenever that's no bigger. Binary profiles keep their
+ * layout from one save to the next, so a recalibration costs a few dozen bytes and unchanged
+ * chaperone bounds nothing. Reading a version applies at most SnapshotInterval - 1 deltas to
+ * the snapshot before it. Once MaxVersions are kept, the older half is dropped.
+ */
+class ProfileHistory
+{
+public:
+	static const size_t SnapshotInterval = 16;
+	static const size_t MaxVersions = 512;
+
+	struct Version
+	{
+		int64_t time; // Unix seconds it was saved at.
+		uint32_t size; // Of the profile.
+	};
+
+	// Reads the file the first time, later calls do nothing. A record torn by a crash ends the
+	// history there and is overwritten by the next Append.
+	void Open(const std::string &path);
+
+	// Stores the newest version, nothing if it equals the one before or is empty.
+	void Append(const std::vector<uint8_t> &profile, int64_t time);
+
+	// Oldest first.
+	std::vector<Version> Versions();
+
+	// How often the older half was dropped, which moves every version to a lower index.
+	uint32_t Compactions();
+
+	// Rebuilds the profile of a version, false if the history doesn't hold it intact.
+	bool Read(size_t index, std::vector<uint8_t> &profile);
+
+private:
+	struct Entry
+	{
+		size_t offset; // Of the record in contents.
+		bool snapshot;
+		Version version;
+	};
+
+	void Scan();
+	bool Rebuild(size_t index, std::vector<uint8_t> &profile) const;
+	void Compact();
+
+	std::mutex mutex;
+	bool opened = false;
+	std::string path;
+	std::vector<uint8_t> contents; // The file, up to its last intact record.
+	std::vector<Entry> entries;
+	std::vector<uint8_t> latest; // Profile of the last entry.
+	bool latestKnown = false;
+	uint32_t compactions = 0;
+};
@@ -0,0 +1,194 @@
+#include "stdafx.h"
+#include "ProfileStore.h"
+
+#include <shlobj.h>
+#include <ctime>
+#include <iostream>
+
+ProfileStore Profiles;
+
+std::string ProfileDirectory()
+{
+	char appData[MAX_PATH] = { 0 };
+	if (SHGetFolderPathA(nullptr, CSIDL_LOCAL_APPDATA, nullptr, SHGFP_TYPE_CURRENT, appData) != S_OK)
+		return "";
+
+	return std::string(appData) + "\\OpenVR-SpaceCalibrator";
+}
+
+static std::string ProfilePath()
+{
+	auto directory = ProfileDirectory();
+	return directory.empty() ? "" : directory + "\\profile.bin";
+}
+
+static std::string HistoryPath()
+{
+	auto directory = ProfileDirectory();
+	return directory.empty() ? "" : directory + "\\history.bin";
+}
+
+ProfileStore::~ProfileStore()
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		stopping = true;
+	}
+	wake.notify_one();
+
+	if (writer.joinable())
+		writer.join();
+}
+
+bool ProfileStore::Read(const std::function<void(const uint8_t *data, size_t size)> &parse)
+{
+	auto path = ProfilePath();
+	if (path.empty())
+		return false;
+
+	HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+		return false;
+
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(file, &size))
+	{
+		CloseHandle(file);
+		return false;
+	}
+
+	// Empty files can't be mapped, they hold a cleared profile.
+	if (size.QuadPart == 0)
+	{
+		CloseHandle(file);
+		parse(nullptr, 0);
+		return true;
+	}
+
+	HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	const void *view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+	if (!view)
+	{
+		std::cerr << "Couldn't map profile file " << path << ": " << GetLastError() << std::endl;
+		if (mapping)
+			CloseHandle(mapping);
+		CloseHandle(file);
+		return false;
+	}
+
+	try
+	{
+		parse(static_cast<const uint8_t *>(view), (size_t) size.QuadPart);
+	}
+	catch (...)
+	{
+		UnmapViewOfFile(view);
+		CloseHandle(mapping);
+		CloseHandle(file);
+		throw;
+	}
+
+	UnmapViewOfFile(view);
+	CloseHandle(mapping);
+	CloseHandle(file);
+	return true;
+}
+
+int64_t ProfileStore::ModifiedTime() const
+{
+	WIN32_FILE_ATTRIBUTE_DATA attributes;
+	auto path = ProfilePath();
+	if (path.empty() || !GetFileAttributesExA(path.c_str(), GetFileExInfoStandard, &attributes))
+		return 0;
+
+	// FILETIME counts 100 ns intervals since 1601.
+	ULARGE_INTEGER written;
+	written.LowPart = attributes.ftLastWriteTime.dwLowDateTime;
+	written.HighPart = attributes.ftLastWriteTime.dwHighDateTime;
+	return (int64_t) (written.QuadPart / 10000000ull) - 11644473600ll;
+}
+
+ProfileHistory &ProfileStore::History()
+{
+	history.Open(HistoryPath());
+	return history;
+}
+
+void ProfileStore::Write(std::vector<uint8_t> data)
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		pending = std::move(data);
+		hasPending = true;
+
+		if (!writer.joinable())
+			writer = std::thread(&ProfileStore::RunWriter, this);
+	}
+	wake.notify_one();
+}
+
+void ProfileStore::Flush()
+{
+	std::unique_lock<std::mutex> lock(mutex);
+	written.wait(lock, [this] { return !hasPending && !busy; });
+}
+
+void ProfileStore::RunWriter()
+{
+	std::vector<uint8_t> data;
+
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			busy = false;
+			written.notify_all();
+
+			wake.wait(lock, [this] { return stopping || hasPending; });
+			if (!hasPending)
+				return;
+
+			data.swap(pending);
+			hasPending = false;
+			busy = true;
+		}
+
+		WriteProfileFile(data);
+	}
+}
+
+void ProfileStore::WriteProfileFile(const std::vector<uint8_t> &data)
+{
+	auto directory = ProfileDirectory();
+	if (directory.empty())
+	{
+		std::cerr << "Couldn't find the local app data directory, profile not saved" << std::endl;
+		return;
+	}
+
+	CreateDirectoryA(directory.c_str(), nullptr);
+
+	auto path = ProfilePath();
+	auto temporaryPath = path + ".tmp";
+
+	HANDLE file = CreateFileA(temporaryPath.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+	{
+		std::cerr << "Couldn't create " << temporaryPath << ": " << GetLastError() << std::endl;
+		return;
+	}
+
+	DWORD bytesWritten = 0;
+	bool ok = data.empty() || (WriteFile(file, data.data(), (DWORD) data.size(), &bytesWritten, nullptr) && bytesWritten == data.size());
+	ok = ok && FlushFileBuffers(file);
+	CloseHandle(file);
+
+	if (!ok || !MoveFileExA(temporaryPath.c_str(), path.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH))
+	{
+		std::cerr << "Couldn't write profile to " << path << ": " << GetLastError() << std::endl;
+		DeleteFileA(temporaryPath.c_str());
+		return;
+	}
+
+	History().Append(data, (int64_t) time(nullptr));
+}
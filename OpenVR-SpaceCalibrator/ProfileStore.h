@@ -0,0 +1,55 @@
+#pragma once
+
+#include "ProfileHistory.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+// %LOCALAPPDATA%\OpenVR-SpaceCalibrator, empty if there's no local app data directory.
+std::string ProfileDirectory();
+
+/**
+ * The saved profile, kept in a file under the user's local app data directory. Writes go
+ * to a temporary file that is then renamed over the old one, so a crash mid-write leaves
+ * the previous profile intact. They happen on a background thread, so saving never waits
+ * on the disk. Each profile written also goes to the history file.
+ */
+class ProfileStore
+{
+public:
+	~ProfileStore();
+
+	// Maps the file and passes its contents to parse. Returns false if there is no profile file.
+	bool Read(const std::function<void(const uint8_t *data, size_t size)> &parse);
+
+	// Queues the data to be written, replacing anything queued but not written yet.
+	void Write(std::vector<uint8_t> data);
+
+	// Blocks until everything queued has been written.
+	void Flush();
+
+	// Unix seconds the profile file was last written, 0 if there is none.
+	int64_t ModifiedTime() const;
+
+	// The profiles written so far, read from the disk the first time it's needed.
+	ProfileHistory &History();
+
+private:
+	void RunWriter();
+	void WriteProfileFile(const std::vector<uint8_t> &data);
+
+	std::thread writer;
+	ProfileHistory history;
+
+	std::mutex mutex;
+	std::condition_variable wake, written;
+	std::vector<uint8_t> pending;
+	bool hasPending = false, busy = false, stopping = false;
+};
+
+extern ProfileStore Profiles;
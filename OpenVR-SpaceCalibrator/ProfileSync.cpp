@@ -0,0 +1,509 @@
+#include "stdafx.h"
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#include <bcrypt.h>
+#include "ProfileSync.h"
+#include "ProfileDelta.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <random>
+
+#pragma comment(lib, "ws2_32.lib")
+#pragma comment(lib, "bcrypt.lib")
+
+ProfileSync SharedProfiles;
+
+static const uint32_t SyncMagic = 0x53504353; // "SCPS"
+static const uint16_t SyncVersion = 3;
+static const char *SyncGroup = "239.255.83.67"; // Organization-local scope.
+static const DWORD ReceiveTimeout = 250; // ms, how long Stop may wait for the receiver.
+static const uint64_t AssemblyTimeout = 2000; // ms from a version's first fragment to its last.
+static const int64_t ReplayWindow = 30000; // ms a datagram's send time may be off, the stations' clocks included.
+
+enum SyncKind : uint16_t
+{
+	SyncSnapshot = 1, // The whole profile.
+	SyncDelta = 2, // EncodeProfileDelta on top of the station's baseSequence.
+	SyncRequest = 3, // Asks the target station for its whole profile.
+	SyncAnchorRequest = 4, // Asks every station to align to its anchor.
+	SyncAnchorReport = 5, // A station's AnchorReportPayload, for the publisher.
+};
+
+// HMAC-SHA256 of the header and the fragment, ends every datagram.
+static const size_t SyncTagBytes = 32;
+
+// Starts every datagram, followed by up to MaxFragmentBytes of the message and the tag.
+struct SyncHeader
+{
+	uint32_t magic;
+	uint16_t version;
+	uint16_t kind;
+	uint32_t channel;
+	uint32_t sequence; // Of the sender's profile, counting from 1.
+	uint64_t station;
+	uint64_t counter; // Of the sender's datagrams since it started, counting from 1.
+	uint64_t time; // UTC ms when it was sent, see WallClock.
+	uint64_t target; // Requests only.
+	uint64_t hash; // HashProfile of the profile the message leads to.
+	uint32_t baseSequence; // Deltas only.
+	uint32_t payloadBytes; // Of the whole message.
+	uint32_t profileBytes;
+	uint16_t fragment, fragments;
+};
+
+static_assert(sizeof(SyncHeader) == 72, "sync header layout is part of the protocol");
+
+struct AnchorReportPayload
+{
+	int32_t status;
+	float spread;
+	char host[64];
+};
+
+// Milliseconds since 1601, the same on every station whose clock is synced.
+static uint64_t WallClock()
+{
+	FILETIME now;
+	GetSystemTimeAsFileTime(&now);
+	return ((((uint64_t) now.dwHighDateTime) << 32) | now.dwLowDateTime) / 10000;
+}
+
+ProfileSync::~ProfileSync()
+{
+	Stop();
+}
+
+bool ProfileSync::Start(uint32_t newMode, uint32_t newChannel, const std::string &newKey)
+{
+	Stop();
+	if (newMode == ProfileSyncOff)
+		return true;
+
+	if (newKey.empty())
+	{
+		std::cerr << "Profile sync needs the venue's shared key" << std::endl;
+		return false;
+	}
+
+	BCRYPT_ALG_HANDLE algorithm = nullptr;
+	if (!BCRYPT_SUCCESS(BCryptOpenAlgorithmProvider(&algorithm, BCRYPT_SHA256_ALGORITHM, nullptr, BCRYPT_ALG_HANDLE_HMAC_FLAG)))
+	{
+		std::cerr << "Couldn't open HMAC-SHA256 for profile sync" << std::endl;
+		return false;
+	}
+
+	WSADATA wsa;
+	if (WSAStartup(MAKEWORD(2, 2), &wsa) != 0)
+	{
+		std::cerr << "Couldn't start Winsock for profile sync" << std::endl;
+		BCryptCloseAlgorithmProvider(algorithm, 0);
+		return false;
+	}
+
+	SOCKET s = ::socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+	bool ok = s != INVALID_SOCKET;
+
+	// Stations on one machine, e.g. when testing, share the port.
+	BOOL reuse = TRUE;
+	ok = ok && setsockopt(s, SOL_SOCKET, SO_REUSEADDR, (const char *) &reuse, sizeof reuse) == 0;
+
+	sockaddr_in local = {};
+	local.sin_family = AF_INET;
+	local.sin_port = htons(Port);
+	local.sin_addr.s_addr = htonl(INADDR_ANY);
+	ok = ok && bind(s, (const sockaddr *) &local, sizeof local) == 0;
+
+	// Publishers listen too, for requests.
+	ip_mreq membership = {};
+	membership.imr_interface.s_addr = htonl(INADDR_ANY);
+	ok = ok && inet_pton(AF_INET, SyncGroup, &membership.imr_multiaddr) == 1;
+	ok = ok && setsockopt(s, IPPROTO_IP, IP_ADD_MEMBERSHIP, (const char *) &membership, sizeof membership) == 0;
+
+	// The venue's network only.
+	DWORD ttl = 1;
+	ok = ok && setsockopt(s, IPPROTO_IP, IP_MULTICAST_TTL, (const char *) &ttl, sizeof ttl) == 0;
+
+	DWORD timeout = ReceiveTimeout;
+	ok = ok && setsockopt(s, SOL_SOCKET, SO_RCVTIMEO, (const char *) &timeout, sizeof timeout) == 0;
+
+	if (!ok)
+	{
+		std::cerr << "Couldn't set up the profile sync socket: " << WSAGetLastError() << std::endl;
+		if (s != INVALID_SOCKET)
+			closesocket(s);
+		WSACleanup();
+		BCryptCloseAlgorithmProvider(algorithm, 0);
+		return false;
+	}
+
+	std::random_device random;
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		stationID = ((uint64_t) random() << 32) | random();
+		channel = newChannel;
+		sequence = 0;
+		counter = 0;
+		sent.clear();
+		current.clear();
+		stations.clear();
+		hasReceived = false;
+		anchorRequested = false;
+		anchorReports.clear();
+	}
+
+	hmac = algorithm;
+	key.assign(newKey.begin(), newKey.end());
+	socket = (uintptr_t) s;
+	socketOpen = true;
+	stopping = false;
+	mode = newMode;
+	receiver = std::thread(&ProfileSync::RunReceiver, this);
+	return true;
+}
+
+void ProfileSync::Stop()
+{
+	if (!socketOpen)
+		return;
+
+	mode = ProfileSyncOff;
+	stopping = true;
+	if (receiver.joinable())
+		receiver.join();
+
+	closesocket((SOCKET) socket);
+	WSACleanup();
+	socketOpen = false;
+	BCryptCloseAlgorithmProvider(hmac, 0);
+	hmac = nullptr;
+}
+
+// The tag of a datagram without its own, SyncTagBytes long.
+bool ProfileSync::Sign(const uint8_t *data, size_t size, uint8_t *tag) const
+{
+	BCRYPT_HASH_HANDLE hash = nullptr;
+	if (!BCRYPT_SUCCESS(BCryptCreateHash(hmac, &hash, nullptr, 0, (PUCHAR) key.data(), (ULONG) key.size(), 0)))
+		return false;
+
+	bool ok = BCRYPT_SUCCESS(BCryptHashData(hash, (PUCHAR) data, (ULONG) size, 0)) &&
+		BCRYPT_SUCCESS(BCryptFinishHash(hash, tag, (ULONG) SyncTagBytes, 0));
+	BCryptDestroyHash(hash);
+	return ok;
+}
+
+void ProfileSync::Send(uint16_t kind, uint32_t messageSequence, uint32_t baseSequence, uint64_t hash, uint32_t profileBytes, const std::vector<uint8_t> &payload, uint64_t target)
+{
+	size_t fragments = std::max<size_t>(1, (payload.size() + MaxFragmentBytes - 1) / MaxFragmentBytes);
+	if (payload.size() > MaxProfileBytes || profileBytes > MaxProfileBytes)
+	{
+		std::cerr << "Profile too large to sync, " << payload.size() << " bytes" << std::endl;
+		return;
+	}
+
+	sockaddr_in group = {};
+	group.sin_family = AF_INET;
+	group.sin_port = htons(Port);
+	inet_pton(AF_INET, SyncGroup, &group.sin_addr);
+
+	SyncHeader header = {};
+	header.magic = SyncMagic;
+	header.version = SyncVersion;
+	header.kind = kind;
+	header.channel = channel;
+	header.sequence = messageSequence;
+	header.station = stationID;
+	header.time = WallClock();
+	header.target = target;
+	header.hash = hash;
+	header.baseSequence = baseSequence;
+	header.payloadBytes = (uint32_t) payload.size();
+	header.profileBytes = profileBytes;
+	header.fragments = (uint16_t) fragments;
+
+	uint8_t datagram[sizeof(SyncHeader) + MaxFragmentBytes + SyncTagBytes];
+	for (size_t i = 0; i < fragments; i++)
+	{
+		size_t offset = i * MaxFragmentBytes;
+		size_t bytes = std::min(MaxFragmentBytes, payload.size() - offset);
+		header.fragment = (uint16_t) i;
+		header.counter = ++counter;
+		memcpy(datagram, &header, sizeof header);
+		if (bytes > 0)
+			memcpy(datagram + sizeof header, payload.data() + offset, bytes);
+		if (!Sign(datagram, sizeof header + bytes, datagram + sizeof header + bytes))
+		{
+			std::cerr << "Couldn't sign profile sync datagram" << std::endl;
+			return;
+		}
+
+		if (sendto((SOCKET) socket, (const char *) datagram, (int) (sizeof header + bytes + SyncTagBytes), 0, (const sockaddr *) &group, sizeof group) < 0)
+			std::cerr << "Couldn't send profile sync datagram: " << WSAGetLastError() << std::endl;
+	}
+}
+
+void ProfileSync::SendProfile(const std::vector<uint8_t> &profile, bool whole)
+{
+	std::vector<uint8_t> payload;
+	bool delta = !whole && !sent.empty();
+	if (delta)
+	{
+		payload = EncodeProfileDelta(sent, profile);
+		delta = payload.size() < profile.size();
+	}
+	if (!delta)
+		payload = profile;
+
+	uint32_t base = sequence++;
+	Send(delta ? SyncDelta : SyncSnapshot, sequence, delta ? base : 0, HashProfile(profile), (uint32_t) profile.size(), payload, 0);
+	sent = profile;
+}
+
+void ProfileSync::Publish(const std::vector<uint8_t> &profile)
+{
+	if (!(mode & ProfileSyncPublish) || profile.empty())
+		return;
+
+	std::lock_guard<std::mutex> lock(mutex);
+	if (profile == current)
+		return;
+	current = profile;
+	SendProfile(profile, false);
+}
+
+void ProfileSync::Push(const std::vector<uint8_t> &profile)
+{
+	if (!(mode & ProfileSyncPublish) || profile.empty())
+		return;
+
+	std::lock_guard<std::mutex> lock(mutex);
+	current = profile;
+	SendProfile(profile, true);
+}
+
+void ProfileSync::Adopt(const std::vector<uint8_t> &profile)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	current = profile;
+}
+
+bool ProfileSync::TakeReceived(std::vector<uint8_t> &profile)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	if (!hasReceived)
+		return false;
+
+	profile.swap(received);
+	hasReceived = false;
+	return true;
+}
+
+void ProfileSync::RequestAnchorAlignment()
+{
+	if (!(mode & ProfileSyncPublish))
+		return;
+
+	std::lock_guard<std::mutex> lock(mutex);
+	anchorReports.clear();
+	Send(SyncAnchorRequest, sequence, 0, 0, 0, std::vector<uint8_t>(), 0);
+}
+
+bool ProfileSync::TakeAnchorRequest()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	bool requested = anchorRequested;
+	anchorRequested = false;
+	return requested;
+}
+
+void ProfileSync::ReportAnchor(int32_t status, double spread)
+{
+	if (mode == ProfileSyncOff)
+		return;
+
+	AnchorReportPayload report = {};
+	report.status = status;
+	report.spread = (float) spread;
+	if (gethostname(report.host, sizeof report.host) != 0)
+		report.host[0] = 0;
+	report.host[sizeof report.host - 1] = 0;
+
+	auto bytes = (const uint8_t *) &report;
+	std::vector<uint8_t> payload(bytes, bytes + sizeof report);
+
+	std::lock_guard<std::mutex> lock(mutex);
+	Send(SyncAnchorReport, sequence, 0, 0, 0, payload, 0);
+}
+
+std::vector<ProfileSync::AnchorReport> ProfileSync::AnchorReports()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return anchorReports;
+}
+
+void ProfileSync::RunReceiver()
+{
+	std::vector<uint8_t> datagram(sizeof(SyncHeader) + MaxFragmentBytes + SyncTagBytes);
+	while (!stopping)
+	{
+		int size = recvfrom((SOCKET) socket, (char *) datagram.data(), (int) datagram.size(), 0, nullptr, nullptr);
+		if (size > 0)
+			HandleDatagram(datagram.data(), (size_t) size);
+		else if (WSAGetLastError() != WSAETIMEDOUT)
+			Sleep(ReceiveTimeout); // Network gone, e.g. the adapter reset. Keep trying.
+		ExpireAssemblies();
+	}
+}
+
+// A version still missing fragments after AssemblyTimeout lost one, the sender only sends each
+// once. Its whole profile is asked for instead, like for a delta on a version we missed.
+void ProfileSync::ExpireAssemblies()
+{
+	uint64_t now = GetTickCount64();
+	std::lock_guard<std::mutex> lock(mutex);
+	for (auto &entry : stations)
+	{
+		auto &assembly = entry.second.assembly;
+		if (!assembly.fragments || now - assembly.started < AssemblyTimeout)
+			continue;
+
+		assembly = Assembly();
+		if (mode & ProfileSyncSubscribe)
+			Send(SyncRequest, 0, 0, 0, 0, std::vector<uint8_t>(), entry.first);
+	}
+}
+
+void ProfileSync::HandleDatagram(const uint8_t *data, size_t size)
+{
+	// Nothing of a datagram is looked at before its tag checks out. Every byte of the tags is
+	// compared, so the time taken doesn't tell how much of a forged one was right.
+	uint8_t tag[SyncTagBytes];
+	if (size < sizeof(SyncHeader) + SyncTagBytes)
+		return;
+	size -= SyncTagBytes;
+	if (!Sign(data, size, tag))
+		return;
+	uint8_t difference = 0;
+	for (size_t i = 0; i < SyncTagBytes; i++)
+		difference |= tag[i] ^ data[size + i];
+	if (difference)
+		return;
+
+	SyncHeader header;
+	memcpy(&header, data, sizeof header);
+
+	std::lock_guard<std::mutex> lock(mutex);
+	if (header.magic != SyncMagic || header.version != SyncVersion || header.channel != channel || header.station == stationID)
+		return;
+
+	// The tag doesn't keep a recorded datagram from being sent again. One sent long ago is too
+	// old, one sent again within the window has a counter we've seen from its station already.
+	// A station's datagrams that arrive out of order are dropped too, costing a request.
+	int64_t age = (int64_t) (WallClock() - header.time);
+	auto &station = stations[header.station];
+	if (age > ReplayWindow || age < -ReplayWindow || header.counter <= station.counter)
+		return;
+	station.counter = header.counter;
+
+	if (header.kind == SyncRequest)
+	{
+		if ((mode & ProfileSyncPublish) && header.target == stationID && !sent.empty())
+			Send(SyncSnapshot, sequence, 0, HashProfile(sent), (uint32_t) sent.size(), sent, 0);
+		return;
+	}
+
+	if (header.kind == SyncAnchorRequest)
+	{
+		if (mode & ProfileSyncSubscribe)
+			anchorRequested = true;
+		return;
+	}
+
+	if (header.kind == SyncAnchorReport)
+	{
+		AnchorReportPayload payload;
+		if (!(mode & ProfileSyncPublish) || size != sizeof header + sizeof payload)
+			return;
+		memcpy(&payload, data + sizeof header, sizeof payload);
+		payload.host[sizeof payload.host - 1] = 0;
+
+		AnchorReport report = { header.station, payload.host, payload.status, payload.spread };
+		auto existing = std::find_if(anchorReports.begin(), anchorReports.end(),
+			[&](const AnchorReport &other) { return other.station == report.station; });
+		if (existing != anchorReports.end())
+			*existing = report;
+		else
+			anchorReports.push_back(report);
+		return;
+	}
+
+	if (!(mode & ProfileSyncSubscribe) || (header.kind != SyncSnapshot && header.kind != SyncDelta))
+		return;
+
+	// Whole profiles sent for another station's request repeat versions we may have already.
+	if (header.sequence <= station.sequence)
+		return;
+
+	size_t offset = (size_t) header.fragment * MaxFragmentBytes;
+	size_t bytes = size - sizeof header;
+	if (header.payloadBytes > MaxProfileBytes || header.profileBytes > MaxProfileBytes ||
+		header.fragments != std::max<size_t>(1, (header.payloadBytes + MaxFragmentBytes - 1) / MaxFragmentBytes) ||
+		header.fragment >= header.fragments || offset > header.payloadBytes || bytes != std::min(MaxFragmentBytes, header.payloadBytes - offset))
+		return;
+
+	auto &assembly = station.assembly;
+	if (assembly.kind != header.kind || assembly.sequence != header.sequence || assembly.hash != header.hash ||
+		assembly.payloadBytes != header.payloadBytes || assembly.fragments != header.fragments)
+	{
+		assembly = Assembly();
+		assembly.kind = header.kind;
+		assembly.sequence = header.sequence;
+		assembly.baseSequence = header.baseSequence;
+		assembly.payloadBytes = header.payloadBytes;
+		assembly.profileBytes = header.profileBytes;
+		assembly.hash = header.hash;
+		assembly.fragments = header.fragments;
+		assembly.started = GetTickCount64();
+		assembly.have.assign(header.fragments, false);
+		assembly.payload.resize(header.payloadBytes);
+	}
+
+	if (assembly.have[header.fragment])
+		return;
+	assembly.have[header.fragment] = true;
+	assembly.received++;
+	if (bytes > 0)
+		memcpy(assembly.payload.data() + offset, data + sizeof header, bytes);
+	if (assembly.received < assembly.fragments)
+		return;
+
+	std::vector<uint8_t> profile;
+	bool ok;
+	if (assembly.kind == SyncSnapshot)
+	{
+		profile.swap(assembly.payload);
+		ok = profile.size() == assembly.profileBytes;
+	}
+	else
+	{
+		// A delta on top of a version we missed can't be used, the whole profile can.
+		profile = station.profile;
+		ok = station.sequence != 0 && assembly.baseSequence == station.sequence &&
+			ApplyProfileDelta(profile, assembly.payload.data(), assembly.payload.size(), assembly.profileBytes);
+	}
+	ok = ok && HashProfile(profile) == assembly.hash;
+
+	uint32_t version = assembly.sequence;
+	assembly = Assembly();
+	if (!ok)
+	{
+		Send(SyncRequest, 0, 0, 0, 0, std::vector<uint8_t>(), header.station);
+		return;
+	}
+
+	station.sequence = version;
+	station.profile = profile;
+	received.swap(profile);
+	hasReceived = true;
+}
@@ -0,0 +1,144 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+enum ProfileSyncMode : uint32_t
+{
+	ProfileSyncOff = 0,
+	ProfileSyncPublish = 1 << 0, // Profiles saved here go to the other stations.
+	ProfileSyncSubscribe = 1 << 1, // Profiles the other stations publish are applied here.
+};
+
+/**
+ * Shares calibration profiles between the stations of one venue over UDP multicast on the
+ * local network. Every profile a publishing station saves goes out as a delta against the last
+ * one it sent, see EncodeProfileDelta, so a recalibration is a single datagram. Whole profiles
+ * go out the first time and whenever the delta isn't smaller, split into datagrams of at most
+ * MaxFragmentBytes. A subscriber that missed the version a delta builds on asks that station
+ * for its whole profile, so a lost datagram only costs a round trip. So does one fragment lost
+ * of several: a version not complete within AssemblyTimeout is asked for again. Stations only hear others
+ * on the same channel, so several venues can share a network. Every datagram carries an
+ * HMAC-SHA256 of itself keyed with the venue's shared key, and those that don't check out are
+ * dropped unread, so a host on the network without the key can't push a profile. Nor can it
+ * replay one it recorded: datagrams carry their send time and a count per station, and those
+ * sent more than ReplayWindow ago or counted already are dropped too, so the stations' clocks
+ * have to be synced.
+ *
+ * Profiles arrive on a thread of their own, and are taken from the calibration tick.
+ *
+ * The channel also lines up the stations' play spaces on a shared anchor: a publisher asks, the
+ * subscribers each align to their anchor device, see AnchorStandingZero, and report back.
+ */
+enum AnchorStatus : int32_t
+{
+	AnchorAligned = 0,
+	AnchorNotFound = 1, // No anchor set, or it isn't tracking.
+	AnchorMoved = 2, // It didn't rest while its pose was measured.
+};
+
+class ProfileSync
+{
+public:
+	struct AnchorReport
+	{
+		uint64_t station;
+		std::string host;
+		int32_t status; // AnchorStatus
+		double spread; // meters, see AnchorEstimator::Spread
+	};
+
+	static const uint16_t Port = 27183;
+	static const size_t MaxFragmentBytes = 1200;
+
+	// Largest profile sent or taken, a scanned room of some ten thousand quads. A datagram claiming
+	// more is dropped before anything is allocated for it.
+	static const uint32_t MaxProfileBytes = 1 << 20;
+
+	~ProfileSync();
+
+	// Restarts with the ProfileSyncMode bits, ProfileSyncOff stops. Returns false without a key
+	// or if the socket couldn't be set up, syncing is then off.
+	bool Start(uint32_t mode, uint32_t channel, const std::string &key);
+	void Stop();
+	uint32_t Mode() const { return mode; }
+
+	// Sends a profile saved here, unless this station isn't publishing or already has it.
+	void Publish(const std::vector<uint8_t> &profile);
+
+	// Sends the whole profile even if the others have it, e.g. from the master station.
+	void Push(const std::vector<uint8_t> &profile);
+
+	// A profile taken from another station, so saving it doesn't send it on.
+	void Adopt(const std::vector<uint8_t> &profile);
+
+	// The newest profile another station published, once.
+	bool TakeReceived(std::vector<uint8_t> &profile);
+
+	// Asks the subscribed stations to align to their anchors, the reports of an earlier request
+	// are dropped. Only while publishing.
+	void RequestAnchorAlignment();
+
+	// Whether a publisher asked for an alignment since the last call, while subscribing.
+	bool TakeAnchorRequest();
+
+	void ReportAnchor(int32_t status, double spread);
+	std::vector<AnchorReport> AnchorReports();
+
+private:
+	// What's being put together from the datagrams of a station's latest version.
+	struct Assembly
+	{
+		uint16_t kind = 0;
+		uint32_t sequence = 0, baseSequence = 0;
+		uint32_t payloadBytes = 0, profileBytes = 0;
+		uint64_t hash = 0;
+		uint16_t fragments = 0, received = 0;
+		uint64_t started = 0; // GetTickCount64 at the first fragment.
+		std::vector<bool> have;
+		std::vector<uint8_t> payload;
+	};
+
+	struct Station
+	{
+		uint64_t counter = 0; // Of its last datagram taken, see SyncHeader.
+		uint32_t sequence = 0; // Of profile, 0 before the first.
+		std::vector<uint8_t> profile;
+		Assembly assembly;
+	};
+
+	void RunReceiver();
+	void HandleDatagram(const uint8_t *data, size_t size);
+	void ExpireAssemblies();
+	bool Sign(const uint8_t *data, size_t size, uint8_t *tag) const;
+	void Send(uint16_t kind, uint32_t sequence, uint32_t baseSequence, uint64_t hash, uint32_t profileBytes, const std::vector<uint8_t> &payload, uint64_t target);
+	void SendProfile(const std::vector<uint8_t> &profile, bool whole);
+
+	std::atomic<uint32_t> mode{ ProfileSyncOff };
+	uint32_t channel = 0;
+	uint64_t stationID = 0; // Random per start, tells our own datagrams apart.
+	uintptr_t socket = 0; // SOCKET, without pulling winsock2.h into every user.
+	bool socketOpen = false;
+	void *hmac = nullptr; // BCRYPT_ALG_HANDLE of HMAC-SHA256.
+	std::vector<uint8_t> key; // Only changed by Start while the receiver isn't running.
+	std::thread receiver;
+	std::atomic<bool> stopping{ false };
+
+	std::mutex mutex;
+	uint32_t sequence = 0; // Of sent.
+	uint64_t counter = 0; // Of the datagrams sent.
+	std::vector<uint8_t> sent; // Last profile sent, deltas build on it.
+	std::vector<uint8_t> current; // Last profile saved or adopted here.
+	std::unordered_map<uint64_t, Station> stations;
+	std::vector<uint8_t> received;
+	bool hasReceived = false;
+	bool anchorRequested = false;
+	std::vector<AnchorReport> anchorReports;
+};
+
+extern ProfileSync SharedProfiles;
@@ -0,0 +1,55 @@
+#include "stdafx.h"
+#include "ResidualFile.h"
+#include "TaskPool.h"
+
+#include <cstdio>
+#include <iostream>
+#include <memory>
+
+static void WriteResiduals(const std::string &path, const std::vector<SampleResidual> &residuals, const Eigen::Vector3d &axisError)
+{
+	FILE *file = nullptr;
+	if (fopen_s(&file, path.c_str(), "w") != 0 || !file)
+	{
+		std::cerr << "Couldn't create residual file " << path << std::endl;
+		return;
+	}
+
+	fprintf(file, "# %zu samples, RMS error per axis in mm: %.3f, %.3f, %.3f\n", residuals.size(),
+		axisError(0) * 1000.0, axisError(1) * 1000.0, axisError(2) * 1000.0);
+	fprintf(file, "sample,quality,x,y,z,error_x,error_y,error_z,device_error_x,device_error_y,device_error_z,error\n");
+
+	for (size_t i = 0; i < residuals.size(); i++)
+	{
+		auto &r = residuals[i];
+		Eigen::Vector3d error = r.error * 1000.0, device = r.deviceError * 1000.0;
+		fprintf(file, "%zu,%.3f,%.4f,%.4f,%.4f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f\n", i, r.quality,
+			r.position(0), r.position(1), r.position(2), error(0), error(1), error(2),
+			device(0), device(1), device(2), error.norm());
+	}
+
+	if (fclose(file) != 0)
+		std::cerr << "Couldn't write residual file " << path << std::endl;
+	else
+		std::cerr << "Wrote residuals to " << path << std::endl;
+}
+
+ResidualExporter::~ResidualExporter()
+{
+	Join();
+}
+
+void ResidualExporter::Join()
+{
+	if (writer.valid())
+		writer.get();
+}
+
+void ResidualExporter::Start(const std::string &path, std::vector<SampleResidual> residuals, const Eigen::Vector3d &axisError)
+{
+	Join();
+	auto shared = std::make_shared<std::vector<SampleResidual>>(std::move(residuals));
+	writer = Tasks().Submit([path, axisError, shared]() {
+		WriteResiduals(path, *shared, axisError);
+	});
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "../CalibrationSolver/CalibrationSolver.h"
+
+#include <future>
+#include <string>
+#include <vector>
+
+/**
+ * Writes the per-sample residuals of a solve to a CSV file from the task pool, for
+ * finding systematic tracking defects afterwards, e.g. one base station being occluded from
+ * part of the room showing as large errors clustered at some reference positions. One row per
+ * sample: its index among the solve's samples, quality, the reference position in meters, the
+ * error in reference space and in the reference device's frame in mm, and the error's length.
+ */
+class ResidualExporter
+{
+public:
+	~ResidualExporter();
+
+	// Takes the residuals, waiting for the previous export to finish first.
+	void Start(const std::string &path, std::vector<SampleResidual> residuals, const Eigen::Vector3d &axisError);
+
+private:
+	void Join();
+
+	std::future<void> writer;
+};
@@ -0,0 +1,125 @@
+#include "stdafx.h"
+#include "SampleFile.h"
+
+#include <fstream>
+#include <cstring>
+
+void ReadSampleFile(const std::string &path, SampleFileHeader &header, std::vector<SampleRecord> &records)
+{
+	std::ifstream file(path, std::ios::binary);
+	if (!file.good())
+		throw std::runtime_error("couldn't open sample file " + path);
+
+	file.read((char *) &header, sizeof header);
+	if (file.gcount() != sizeof header || header.magic != SampleFileMagic)
+		throw std::runtime_error(path + " is not a sample file");
+
+	if (header.version != SampleFileVersion || header.recordSize != sizeof(SampleRecord))
+		throw std::runtime_error("unsupported sample file version " + std::to_string(header.version));
+
+	header.referenceSerial[sizeof header.referenceSerial - 1] = 0;
+	header.targetSerial[sizeof header.targetSerial - 1] = 0;
+
+	records.clear();
+	SampleRecord record;
+	while (file.read((char *) &record, sizeof record))
+		records.push_back(record);
+
+	// A partial record at the end is what's left of a recording that was cut off, it's ignored.
+}
+
+SampleRecorder::~SampleRecorder()
+{
+	Stop();
+	JoinWriter();
+}
+
+bool SampleRecorder::Start(const std::string &path, const std::string &referenceSerial, const std::string &targetSerial)
+{
+	Stop();
+	JoinWriter();
+
+	if (fopen_s(&file, path.c_str(), "wb") != 0 || !file)
+	{
+		file = nullptr;
+		return false;
+	}
+	this->path = path;
+
+	SampleFileHeader header = {};
+	header.magic = SampleFileMagic;
+	header.version = SampleFileVersion;
+	header.recordSize = sizeof(SampleRecord);
+	strncpy_s(header.referenceSerial, referenceSerial.c_str(), _TRUNCATE);
+	strncpy_s(header.targetSerial, targetSerial.c_str(), _TRUNCATE);
+	fwrite(&header, sizeof header, 1, file);
+
+	pending.clear();
+	stopping = false;
+	discarding = false;
+	recording = true;
+	writer = std::thread(&SampleRecorder::RunWriter, this);
+	return true;
+}
+
+void SampleRecorder::Stop(bool discard)
+{
+	if (!recording)
+		return;
+
+	recording = false;
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		stopping = true;
+		discarding = discard;
+	}
+	wake.notify_one();
+}
+
+void SampleRecorder::JoinWriter()
+{
+	if (writer.joinable())
+		writer.join();
+}
+
+void SampleRecorder::Record(const SampleRecord &record)
+{
+	if (!recording)
+		return;
+
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		pending.push_back(record);
+	}
+	wake.notify_one();
+}
+
+void SampleRecorder::RunWriter()
+{
+	std::vector<SampleRecord> writing;
+	bool done = false, discard = false;
+
+	while (!done)
+	{
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			wake.wait(lock, [this] { return stopping || !pending.empty(); });
+			writing.swap(pending);
+			done = stopping;
+			discard = discarding;
+		}
+
+		// Flushed after every batch, so a recording cut off by a crash still loads up to that point.
+		if (!writing.empty())
+		{
+			fwrite(writing.data(), sizeof(SampleRecord), writing.size(), file);
+			fflush(file);
+			writing.clear();
+		}
+	}
+
+	fclose(file);
+	file = nullptr;
+	if (discard)
+		remove(path.c_str());
+}
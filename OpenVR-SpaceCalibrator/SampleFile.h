@@ -0,0 +1,69 @@
+#pragma once
+
+#include "../Protocol.h"
+
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <cstdio>
+
+// Calibration samples recorded to disk, so a session can be replayed through the solver offline.
+// A file is a SampleFileHeader followed by fixed-size SampleRecords up to the end of the file.
+const uint32_t SampleFileMagic = 0x53435053; // "SPCS"
+const uint32_t SampleFileVersion = 1;
+
+struct SampleFileHeader
+{
+	uint32_t magic;
+	uint32_t version;
+	uint32_t recordSize;
+	uint32_t reserved;
+	char referenceSerial[64];
+	char targetSerial[64];
+};
+
+struct SampleRecord
+{
+	protocol::PoseCaptureSample reference, target;
+	double quality;
+};
+
+// Throws std::runtime_error if the file can't be read or isn't a sample file.
+void ReadSampleFile(const std::string &path, SampleFileHeader &header, std::vector<SampleRecord> &records);
+
+/**
+ * Appends records to a sample file from a background thread. Record only copies into the
+ * pending buffer, and the writer swaps it with its own buffer before touching the disk, so
+ * the calibration tick never waits on I/O.
+ */
+class SampleRecorder
+{
+public:
+	~SampleRecorder();
+
+	// Returns false if the file couldn't be created.
+	bool Start(const std::string &path, const std::string &referenceSerial, const std::string &targetSerial);
+
+	// Stops accepting records. The writer flushes what's left and closes the file in the
+	// background, and with discard deletes it afterwards.
+	void Stop(bool discard = false);
+
+	bool IsRecording() const { return recording; }
+	void Record(const SampleRecord &record);
+
+private:
+	void RunWriter();
+	void JoinWriter();
+
+	bool recording = false;
+	FILE *file = nullptr;
+	std::string path;
+	std::thread writer;
+
+	std::mutex mutex;
+	std::condition_variable wake;
+	std::vector<SampleRecord> pending;
+	bool stopping = false, discarding = false;
+};
@@ -0,0 +1,396 @@
+#include "stdafx.h"
+#include "SampleView.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <imgui/imgui.h>
+#include <GL/gl3w.h>
+#include <Eigen/Geometry>
+
+static const char *const VertexShader =
+	"#version 330\n"
+	"layout (location = 0) in vec2 Corner;\n"
+	"layout (location = 1) in vec3 Position;\n"
+	"layout (location = 2) in float Size;\n"
+	"layout (location = 3) in vec4 Color;\n"
+	"uniform mat4 ViewProjection;\n"
+	"uniform vec2 PixelScale;\n"
+	"out vec2 Frag_Corner;\n"
+	"out vec4 Frag_Color;\n"
+	"void main()\n"
+	"{\n"
+	"	Frag_Corner = Corner;\n"
+	"	Frag_Color = Color;\n"
+	"	gl_Position = ViewProjection * vec4(Position, 1.0);\n"
+	"	gl_Position.xy += Corner * Size * PixelScale * gl_Position.w;\n"
+	"}\n";
+
+static const char *const FragmentShader =
+	"#version 330\n"
+	"in vec2 Frag_Corner;\n"
+	"in vec4 Frag_Color;\n"
+	"out vec4 Out_Color;\n"
+	"void main()\n"
+	"{\n"
+	"	if (dot(Frag_Corner, Frag_Corner) > 1.0)\n"
+	"		discard;\n"
+	"	Out_Color = Frag_Color;\n"
+	"}\n";
+
+static const size_t RegionCount = 3;
+static const size_t MinCapacity = 1024; // Points, the buffer doubles past it.
+static const float AxisViewShare = 0.3f; // Of the view's height, in its top right corner.
+static const float DragSpeed = 0.01f; // Radians per pixel.
+
+static struct
+{
+	GLuint program = 0, vao = 0, corners = 0, instances = 0;
+	GLint viewProjection = -1, pixelScale = -1;
+	bool persistent = false;
+
+	// Points per region, the mapped buffer when persistent.
+	size_t capacity = 0;
+	SampleViewPoint *mapped = nullptr;
+	GLsync fences[RegionCount] = {};
+	size_t region = 0;
+
+	// What the regions hold, region being the latest.
+	bool uploaded = false;
+	uint64_t generation = 0;
+	size_t pointCount = 0, axisCount = 0;
+	Eigen::Vector3f center = Eigen::Vector3f::Zero();
+	float radius = 1.0f;
+
+	// Display coordinates of the view, and the camera.
+	ImVec2 min, max;
+	float yaw = 0.6f, pitch = 0.4f;
+	uint64_t content = 1;
+} View;
+
+static GLuint CompileShader(GLenum type, const char *source)
+{
+	GLuint shader = glCreateShader(type);
+	glShaderSource(shader, 1, &source, nullptr);
+	glCompileShader(shader);
+
+	GLint ok = GL_FALSE;
+	glGetShaderiv(shader, GL_COMPILE_STATUS, &ok);
+	if (!ok)
+	{
+		char log[512] = "";
+		glGetShaderInfoLog(shader, sizeof log, nullptr, log);
+		std::cerr << "Sample view shader failed to compile: " << log << std::endl;
+	}
+	return shader;
+}
+
+static bool CreateViewObjects()
+{
+	GLuint vertex = CompileShader(GL_VERTEX_SHADER, VertexShader);
+	GLuint fragment = CompileShader(GL_FRAGMENT_SHADER, FragmentShader);
+	View.program = glCreateProgram();
+	glAttachShader(View.program, vertex);
+	glAttachShader(View.program, fragment);
+	glLinkProgram(View.program);
+	glDeleteShader(vertex);
+	glDeleteShader(fragment);
+
+	GLint ok = GL_FALSE;
+	glGetProgramiv(View.program, GL_LINK_STATUS, &ok);
+	if (!ok)
+	{
+		std::cerr << "Sample view shaders failed to link" << std::endl;
+		glDeleteProgram(View.program);
+		View.program = 0;
+		return false;
+	}
+	View.viewProjection = glGetUniformLocation(View.program, "ViewProjection");
+	View.pixelScale = glGetUniformLocation(View.program, "PixelScale");
+
+	GLint lastArrayBuffer, lastVertexArray;
+	glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &lastArrayBuffer);
+	glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &lastVertexArray);
+
+	const float corners[] = { -1, -1, 1, -1, -1, 1, 1, 1 };
+	glGenVertexArrays(1, &View.vao);
+	glBindVertexArray(View.vao);
+	glGenBuffers(1, &View.corners);
+	glBindBuffer(GL_ARRAY_BUFFER, View.corners);
+	glBufferData(GL_ARRAY_BUFFER, sizeof corners, corners, GL_STATIC_DRAW);
+	glEnableVertexAttribArray(0);
+	glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, nullptr);
+	for (GLuint attribute = 1; attribute <= 3; attribute++)
+	{
+		glEnableVertexAttribArray(attribute);
+		glVertexAttribDivisor(attribute, 1);
+	}
+
+	glBindVertexArray(lastVertexArray);
+	glBindBuffer(GL_ARRAY_BUFFER, lastArrayBuffer);
+
+	// GL 4.4 or ARB_buffer_storage, without either wglGetProcAddress found nothing.
+	View.persistent = glBufferStorage != nullptr;
+	return true;
+}
+
+static void DeleteInstanceBuffer()
+{
+	for (auto &fence : View.fences)
+	{
+		if (fence)
+			glDeleteSync(fence);
+		fence = nullptr;
+	}
+
+	if (View.instances)
+	{
+		if (View.mapped)
+		{
+			glBindBuffer(GL_ARRAY_BUFFER, View.instances);
+			glUnmapBuffer(GL_ARRAY_BUFFER);
+		}
+		glDeleteBuffers(1, &View.instances);
+	}
+	View.instances = 0;
+	View.mapped = nullptr;
+	View.capacity = 0;
+	View.uploaded = false;
+}
+
+void ReleaseSampleView()
+{
+	DeleteInstanceBuffer();
+	if (View.vao)
+		glDeleteVertexArrays(1, &View.vao);
+	if (View.corners)
+		glDeleteBuffers(1, &View.corners);
+	if (View.program)
+		glDeleteProgram(View.program);
+	View.vao = View.corners = View.program = 0;
+}
+
+static void ReserveInstances(size_t count)
+{
+	if (count <= View.capacity)
+		return;
+
+	size_t capacity = std::max(std::max(count, View.capacity * 2), MinCapacity);
+	DeleteInstanceBuffer();
+	View.capacity = capacity;
+
+	glGenBuffers(1, &View.instances);
+	glBindBuffer(GL_ARRAY_BUFFER, View.instances);
+	if (View.persistent)
+	{
+		GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+		GLsizeiptr bytes = (GLsizeiptr) (capacity * RegionCount * sizeof(SampleViewPoint));
+		glBufferStorage(GL_ARRAY_BUFFER, bytes, nullptr, flags);
+		View.mapped = (SampleViewPoint *) glMapBufferRange(GL_ARRAY_BUFFER, 0, bytes, flags);
+		if (!View.mapped)
+		{
+			// Plain buffers from here on.
+			View.persistent = false;
+			DeleteInstanceBuffer();
+			ReserveInstances(count);
+			return;
+		}
+	}
+	else
+	{
+		glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr) (capacity * sizeof(SampleViewPoint)), nullptr, GL_DYNAMIC_DRAW);
+	}
+}
+
+static void Upload(const SampleViewData &data)
+{
+	size_t count = data.points.size() + data.axes.size();
+	ReserveInstances(count);
+
+	SampleViewPoint *target = nullptr;
+	std::vector<SampleViewPoint> staging;
+	if (View.persistent)
+	{
+		// The GPU may still be drawing the other regions, this one last drew two uploads ago.
+		View.region = (View.region + 1) % RegionCount;
+		GLsync &fence = View.fences[View.region];
+		if (fence)
+		{
+			while (glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000) == GL_TIMEOUT_EXPIRED)
+				;
+			glDeleteSync(fence);
+			fence = nullptr;
+		}
+		target = View.mapped + View.region * View.capacity;
+	}
+	else
+	{
+		staging.resize(count);
+		target = staging.data();
+	}
+
+	if (!data.points.empty())
+		memcpy(target, data.points.data(), data.points.size() * sizeof(SampleViewPoint));
+	if (!data.axes.empty())
+		memcpy(target + data.points.size(), data.axes.data(), data.axes.size() * sizeof(SampleViewPoint));
+
+	if (!View.persistent)
+	{
+		GLint lastArrayBuffer;
+		glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &lastArrayBuffer);
+		glBindBuffer(GL_ARRAY_BUFFER, View.instances);
+		glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr) (View.capacity * sizeof(SampleViewPoint)), nullptr, GL_DYNAMIC_DRAW);
+		glBufferSubData(GL_ARRAY_BUFFER, 0, (GLsizeiptr) (count * sizeof(SampleViewPoint)), staging.data());
+		glBindBuffer(GL_ARRAY_BUFFER, lastArrayBuffer);
+	}
+
+	// Framed around the cloud's bounding box.
+	Eigen::Vector3f lo = Eigen::Vector3f::Constant(1e9f), hi = Eigen::Vector3f::Constant(-1e9f);
+	for (auto &point : data.points)
+	{
+		Eigen::Map<const Eigen::Vector3f> position(point.position);
+		lo = lo.cwiseMin(position);
+		hi = hi.cwiseMax(position);
+	}
+	View.center = data.points.empty() ? Eigen::Vector3f::Zero() : Eigen::Vector3f(0.5f * (lo + hi));
+	View.radius = data.points.empty() ? 1.0f : std::max(0.5f * (hi - lo).norm(), 0.05f);
+
+	View.pointCount = data.points.size();
+	View.axisCount = data.axes.size();
+	View.generation = data.generation;
+	View.uploaded = true;
+}
+
+// Fits a sphere of radius around center into a viewport of width by height, seen from the camera.
+static Eigen::Matrix4f ViewProjection(const Eigen::Vector3f &center, float radius, float width, float height)
+{
+	Eigen::Matrix3f rotation = (Eigen::AngleAxisf(View.pitch, Eigen::Vector3f::UnitX()) * Eigen::AngleAxisf(View.yaw, Eigen::Vector3f::UnitY())).toRotationMatrix();
+	float scale = 0.9f / radius, side = std::min(width, height);
+	Eigen::Vector3f axes(scale * side / width, scale * side / height, 0.5f * scale);
+
+	Eigen::Matrix4f matrix = Eigen::Matrix4f::Identity();
+	matrix.topLeftCorner<3, 3>() = axes.asDiagonal() * rotation;
+	matrix.topRightCorner<3, 1>() = -(matrix.topLeftCorner<3, 3>() * center);
+	return matrix;
+}
+
+// Where a range of instances starts, the VAO bound.
+static void PointInstancesAt(size_t first)
+{
+	size_t base = first * sizeof(SampleViewPoint);
+	auto offset = [base](size_t field) { return (const GLvoid *) (uintptr_t) (base + field); };
+	glBindBuffer(GL_ARRAY_BUFFER, View.instances);
+	glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(SampleViewPoint), offset(offsetof(SampleViewPoint, position)));
+	glVertexAttribPointer(2, 1, GL_FLOAT, GL_FALSE, sizeof(SampleViewPoint), offset(offsetof(SampleViewPoint, size)));
+	glVertexAttribPointer(3, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(SampleViewPoint), offset(offsetof(SampleViewPoint, color)));
+}
+
+static void DrawPoints(size_t first, size_t count, const Eigen::Matrix4f &viewProjection, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+	if (!count || width <= 0 || height <= 0)
+		return;
+
+	glViewport(x, y, width, height);
+	glUniformMatrix4fv(View.viewProjection, 1, GL_FALSE, viewProjection.data());
+	glUniform2f(View.pixelScale, 1.0f / width, 1.0f / height);
+	PointInstancesAt(first);
+	glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, (GLsizei) count);
+}
+
+// Runs while ImGui renders, with its blending and the framebuffer already set up.
+static void DrawSampleView(const ImDrawList *, const ImDrawCmd *cmd)
+{
+	if (!View.uploaded || !View.program)
+		return;
+
+	GLint lastProgram, lastArrayBuffer, lastVertexArray, lastViewport[4], lastScissor[4];
+	glGetIntegerv(GL_CURRENT_PROGRAM, &lastProgram);
+	glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &lastArrayBuffer);
+	glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &lastVertexArray);
+	glGetIntegerv(GL_VIEWPORT, lastViewport);
+	glGetIntegerv(GL_SCISSOR_BOX, lastScissor);
+
+	// ImGui scaled the clip rectangles to framebuffer pixels already, GL counts rows from the bottom.
+	auto &io = ImGui::GetIO();
+	float scaleX = io.DisplayFramebufferScale.x, scaleY = io.DisplayFramebufferScale.y;
+	float framebufferHeight = io.DisplaySize.y * scaleY;
+	glScissor((GLint) cmd->ClipRect.x, (GLint) (framebufferHeight - cmd->ClipRect.w),
+		(GLsizei) (cmd->ClipRect.z - cmd->ClipRect.x), (GLsizei) (cmd->ClipRect.w - cmd->ClipRect.y));
+
+	glUseProgram(View.program);
+	glBindVertexArray(View.vao);
+
+	GLint x = (GLint) (View.min.x * scaleX), y = (GLint) (framebufferHeight - View.max.y * scaleY);
+	GLsizei width = (GLsizei) ((View.max.x - View.min.x) * scaleX), height = (GLsizei) ((View.max.y - View.min.y) * scaleY);
+	size_t first = View.persistent ? View.region * View.capacity : 0;
+	DrawPoints(first, View.pointCount, ViewProjection(View.center, View.radius, (float) width, (float) height), x, y, width, height);
+
+	GLsizei side = (GLsizei) (height * AxisViewShare);
+	DrawPoints(first + View.pointCount, View.axisCount, ViewProjection(Eigen::Vector3f::Zero(), 1.0f, (float) side, (float) side),
+		x + width - side, y + height - side, side, side);
+
+	// Until this signals, Upload leaves the region alone.
+	if (View.persistent)
+	{
+		GLsync &fence = View.fences[View.region];
+		if (fence)
+			glDeleteSync(fence);
+		fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	}
+
+	glUseProgram(lastProgram);
+	glBindVertexArray(lastVertexArray);
+	glBindBuffer(GL_ARRAY_BUFFER, lastArrayBuffer);
+	glViewport(lastViewport[0], lastViewport[1], lastViewport[2], lastViewport[3]);
+	glScissor(lastScissor[0], lastScissor[1], lastScissor[2], lastScissor[3]);
+}
+
+void BuildSampleView(const SampleViewData &data, float height)
+{
+	if (data.points.empty() && data.axes.empty())
+		return;
+	if (!View.program && !CreateViewObjects())
+		return;
+
+	if (!View.uploaded || data.generation != View.generation)
+	{
+		Upload(data);
+		View.content++;
+	}
+
+	ImGui::Text("");
+	ImVec2 size(ImGui::GetContentRegionAvail().x, height);
+	ImGui::InvisibleButton("sample view", size);
+	if (ImGui::IsItemActive())
+	{
+		auto &io = ImGui::GetIO();
+		if (io.MouseDelta.x != 0.0f || io.MouseDelta.y != 0.0f)
+		{
+			View.yaw += io.MouseDelta.x * DragSpeed;
+			View.pitch = std::max(-1.5f, std::min(View.pitch + io.MouseDelta.y * DragSpeed, 1.5f));
+			View.content++;
+		}
+	}
+	if (ImGui::IsItemHovered())
+		ImGui::SetTooltip("Drag to turn. Top right: the rotation axes seen so far, green once covered");
+
+	ImVec2 min = ImGui::GetItemRectMin(), max = ImGui::GetItemRectMax();
+	if (min.x != View.min.x || min.y != View.min.y || max.x != View.max.x || max.y != View.max.y)
+	{
+		View.min = min;
+		View.max = max;
+		View.content++;
+	}
+
+	auto *drawList = ImGui::GetWindowDrawList();
+	drawList->AddRectFilled(min, max, ImColor(0.05f, 0.05f, 0.05f));
+	drawList->AddCallback(DrawSampleView, nullptr);
+	drawList->AddText(ImVec2(min.x + 4.0f, min.y + 2.0f), ImColor(0.6f, 0.6f, 0.6f),
+		data.residuals ? "Sample residuals, green under 1 mm, red over 1 cm" : "Reference device positions of the samples");
+}
+
+uint64_t SampleViewContent()
+{
+	return View.content;
+}
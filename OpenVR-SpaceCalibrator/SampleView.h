@@ -0,0 +1,22 @@
+#pragma once
+
+#include "Calibration.h"
+
+#include <cstdint>
+
+/**
+ * The calibration popup's 3D view of a SampleViewData: the sample cloud, dragged to turn it,
+ * with the rotation axis sphere in its corner. Points are instances of one camera facing quad,
+ * drawn with glDrawArraysInstanced from a draw list callback straight into the frame's render
+ * target, so tens of thousands of them cost one draw call and no ImGui vertices. The instance
+ * buffer is persistently mapped where GL 4.4 or ARB_buffer_storage allows, in three regions
+ * fenced round robin so the CPU never writes what the GPU still reads. Elsewhere it's sent
+ * with glBufferSubData. Only a new generation of the data is written at all.
+ */
+void BuildSampleView(const SampleViewData &data, float height);
+
+// Changes whenever the view would draw something different, the draw lists don't show it.
+uint64_t SampleViewContent();
+
+// Deletes the GL objects, the next BuildSampleView creates them again and writes the data.
+void ReleaseSampleView();
@@ -0,0 +1,98 @@
+#include "stdafx.h"
+#include "SharedAnchor.h"
+
+#include <algorithm>
+#include <cmath>
+
+// Below this length, the anchor's forward axis points too steeply up or down to give a heading.
+static const double MinHeadingLength = 0.3;
+
+Eigen::Isometry3d IsometryFromMatrix(const vr::HmdMatrix34_t &matrix)
+{
+	Eigen::Isometry3d pose = Eigen::Isometry3d::Identity();
+	for (int i = 0; i < 3; i++)
+	{
+		for (int j = 0; j < 3; j++)
+			pose.linear()(i, j) = matrix.m[i][j];
+		pose.translation()(i) = matrix.m[i][3];
+	}
+	return pose;
+}
+
+vr::HmdMatrix34_t MatrixFromIsometry(const Eigen::Isometry3d &pose)
+{
+	vr::HmdMatrix34_t matrix;
+	for (int i = 0; i < 3; i++)
+	{
+		for (int j = 0; j < 3; j++)
+			matrix.m[i][j] = (float) pose.linear()(i, j);
+		matrix.m[i][3] = (float) pose.translation()(i);
+	}
+	return matrix;
+}
+
+void AnchorEstimator::Reset()
+{
+	*this = AnchorEstimator();
+}
+
+void AnchorEstimator::Push(const vr::HmdMatrix34_t &pose)
+{
+	Eigen::Isometry3d transform = IsometryFromMatrix(pose);
+	Eigen::Quaterniond rotation(transform.linear());
+	Eigen::Vector4d coefficients = rotation.coeffs();
+	if (count > 0 && coefficients.dot(rotationSum) < 0.0)
+		coefficients = -coefficients;
+
+	count++;
+	positionSum += transform.translation();
+	squaredSum += transform.translation().squaredNorm();
+	rotationSum += coefficients;
+}
+
+Eigen::Vector3d AnchorEstimator::Position() const
+{
+	return positionSum / (double) count;
+}
+
+Eigen::Quaterniond AnchorEstimator::Rotation() const
+{
+	Eigen::Quaterniond mean;
+	mean.coeffs() = rotationSum;
+	return mean.normalized();
+}
+
+double AnchorEstimator::Spread() const
+{
+	if (count == 0)
+		return 0.0;
+	double variance = squaredSum / (double) count - Position().squaredNorm();
+	return sqrt(std::max(variance, 0.0));
+}
+
+vr::HmdMatrix34_t AnchorStandingZero(const Eigen::Vector3d &position, const Eigen::Quaterniond &rotation, double floorHeight)
+{
+	// Forward is -Z, like the HMD's view. A device lying flat faces along its top instead.
+	Eigen::Vector3d forward = rotation * -Eigen::Vector3d::UnitZ();
+	forward.y() = 0.0;
+	if (forward.norm() < MinHeadingLength)
+	{
+		forward = rotation * Eigen::Vector3d::UnitY();
+		forward.y() = 0.0;
+	}
+	double yaw = atan2(-forward.x(), -forward.z());
+
+	Eigen::Isometry3d zero = Eigen::Isometry3d::Identity();
+	zero.linear() = Eigen::AngleAxisd(yaw, Eigen::Vector3d::UnitY()).toRotationMatrix();
+	zero.translation() = Eigen::Vector3d(position.x(), floorHeight, position.z());
+	return MatrixFromIsometry(zero);
+}
+
+void KeepChaperoneInPlace(std::vector<vr::HmdQuad_t> &quads, const vr::HmdMatrix34_t &from, const vr::HmdMatrix34_t &to)
+{
+	Eigen::Isometry3f change = (IsometryFromMatrix(to).inverse() * IsometryFromMatrix(from)).cast<float>();
+
+	static_assert(sizeof(vr::HmdQuad_t) == 12 * sizeof(float), "quads expected to be four packed float corners");
+	Eigen::Map<Eigen::Matrix3Xf> corners((float *) quads.data(), 3, quads.size() * 4);
+	corners = (change.linear() * corners).colwise() + change.translation();
+}
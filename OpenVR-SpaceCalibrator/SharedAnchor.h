@@ -0,0 +1,51 @@
+#pragma once
+
+#include <openvr.h>
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+
+#include <vector>
+
+/**
+ * Where a resting anchor device is, from a stream of its poses. Positions and quaternions go
+ * into running sums, quaternions flipped into the hemisphere of the first, so each pose costs
+ * the same however long the anchor has been watched. The spread of the positions around their
+ * mean tells an anchor that was bumped apart from one that stayed put.
+ */
+class AnchorEstimator
+{
+public:
+	void Reset();
+	void Push(const vr::HmdMatrix34_t &pose);
+
+	size_t Count() const { return count; }
+
+	// Means of the poses so far, once Count is above zero.
+	Eigen::Vector3d Position() const;
+	Eigen::Quaterniond Rotation() const;
+
+	// RMS distance of the positions from their mean, meters.
+	double Spread() const;
+
+private:
+	size_t count = 0;
+	Eigen::Vector3d positionSum = Eigen::Vector3d::Zero();
+	double squaredSum = 0;
+	Eigen::Vector4d rotationSum = Eigen::Vector4d::Zero(); // x, y, z, w
+};
+
+/**
+ * The standing zero pose that puts the anchor at the origin of every station's play space. The
+ * origin sits on the floor below the anchor, floorHeight being the raw height of the floor, and
+ * faces where the anchor faces, turned about the vertical only. Stations that see one anchor
+ * then share a play space, whatever their room setups made of it.
+ */
+vr::HmdMatrix34_t AnchorStandingZero(const Eigen::Vector3d &position, const Eigen::Quaterniond &rotation, double floorHeight);
+
+// Between OpenVR's rigid 3x4 poses and Eigen's.
+Eigen::Isometry3d IsometryFromMatrix(const vr::HmdMatrix34_t &matrix);
+vr::HmdMatrix34_t MatrixFromIsometry(const Eigen::Isometry3d &pose);
+
+// Moves collision bounds, which are relative to the standing zero pose, from one standing zero
+// to another so they stay where they are in the room.
+void KeepChaperoneInPlace(std::vector<vr::HmdQuad_t> &quads, const vr::HmdMatrix34_t &from, const vr::HmdMatrix34_t &to);
@@ -0,0 +1,62 @@
+#include "stdafx.h"
+#include "StartupTimings.h"
+#include "../Version.h"
+
+#include <atomic>
+#include <cstdio>
+
+static const char *const PhaseNames[] = {
+	"init_vr", "activate_drivers", "create_window", "font_atlas", "init_calibrator",
+	"load_profile", "driver_connected", "profile_applied", "first_frame",
+};
+static_assert(sizeof PhaseNames / sizeof PhaseNames[0] == (size_t) StartupPhase::Count, "a phase without a name");
+
+static long long startCounter = 0;
+static std::atomic<long long> phaseEnds[(size_t) StartupPhase::Count]; // 0 until the phase ended.
+
+static long long Counter()
+{
+	LARGE_INTEGER value;
+	QueryPerformanceCounter(&value);
+	return value.QuadPart;
+}
+
+void StartStartupTimings()
+{
+	startCounter = Counter();
+}
+
+void MarkStartupPhase(StartupPhase phase)
+{
+	auto &end = phaseEnds[(size_t) phase];
+	if (end.load(std::memory_order_relaxed))
+		return;
+
+	long long expected = 0;
+	end.compare_exchange_strong(expected, Counter(), std::memory_order_relaxed);
+}
+
+bool StartupPhaseDone(StartupPhase phase)
+{
+	return phaseEnds[(size_t) phase].load(std::memory_order_relaxed) != 0;
+}
+
+std::string StartupReport()
+{
+	LARGE_INTEGER frequency;
+	QueryPerformanceFrequency(&frequency);
+
+	std::string out = "{\"version\": \"" SPACECAL_VERSION_STRING "\", \"phases\": {";
+	for (size_t i = 0; i < (size_t) StartupPhase::Count; i++)
+	{
+		char buf[96];
+		long long end = phaseEnds[i].load(std::memory_order_relaxed);
+		if (end)
+			snprintf(buf, sizeof buf, "%s\"%s\": %.3f", i ? ", " : "", PhaseNames[i], (end - startCounter) * 1000.0 / frequency.QuadPart);
+		else
+			snprintf(buf, sizeof buf, "%s\"%s\": null", i ? ", " : "", PhaseNames[i]);
+		out += buf;
+	}
+	out += "}}\n";
+	return out;
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <string>
+
+// In the order of a normal start, the report names them. Add new ones at the end.
+enum class StartupPhase
+{
+	InitVR, // VR_Init and the interface version checks.
+	ActivateDrivers, // ActivateMultipleDrivers
+	CreateWindow, // The GLFW window and GL context.
+	FontAtlas,
+	InitCalibrator, // The device registry's first scan, on the calibration thread from here on.
+	LoadProfile,
+	DriverConnected,
+	ProfileApplied, // The first full pass over the devices with the driver connected.
+	FirstFrame, // The first UI frame rendered.
+	Count
+};
+
+/**
+ * When each phase of startup ended, as QueryPerformanceCounter time since StartStartupTimings,
+ * for `-startupbenchmark`. Phases end on the main and the calibration thread, only the first
+ * mark of each counts and is a single atomic store, so they're marked in every run.
+ */
+void StartStartupTimings();
+void MarkStartupPhase(StartupPhase phase);
+bool StartupPhaseDone(StartupPhase phase);
+
+// One JSON object: the version, and per phase the milliseconds from the start until it ended,
+// null for phases that didn't end.
+std::string StartupReport();
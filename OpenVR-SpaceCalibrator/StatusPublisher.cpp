@@ -0,0 +1,57 @@
+#include "stdafx.h"
+#include "StatusPublisher.h"
+
+#include <cstring>
+#include <iostream>
+
+static const int64_t HeartbeatMilliseconds = 1000;
+
+StatusPublisher::~StatusPublisher()
+{
+	if (block)
+		UnmapViewOfFile(block);
+	if (mapping)
+		CloseHandle(mapping);
+}
+
+void StatusPublisher::Open()
+{
+	mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, 0, sizeof(protocol::StatusBlock), OPENVR_SPACECALIBRATOR_STATUS_NAME);
+	if (!mapping)
+	{
+		std::cerr << "Couldn't create the status section, monitoring tools won't see the calibration. Error: " << GetLastError() << std::endl;
+		openFailed = true;
+		return;
+	}
+
+	block = (protocol::StatusBlock *) MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, sizeof(protocol::StatusBlock));
+	if (!block)
+	{
+		std::cerr << "Couldn't map the status section. Error: " << GetLastError() << std::endl;
+		CloseHandle(mapping);
+		mapping = nullptr;
+		openFailed = true;
+		return;
+	}
+
+	// A second client instance shares the section, the last writer wins.
+	block->version = protocol::StatusVersion;
+	block->size = sizeof(protocol::CalibrationStatus);
+}
+
+void StatusPublisher::Publish(const protocol::CalibrationStatus &status)
+{
+	if (!block && !openFailed)
+		Open();
+	if (!block)
+		return;
+
+	protocol::CalibrationStatus compared = status;
+	compared.publishedTime = last.publishedTime;
+	bool changed = memcmp(&compared, &last, sizeof last) != 0;
+	if (!changed && status.publishedTime - last.publishedTime < HeartbeatMilliseconds)
+		return;
+
+	last = status;
+	block->Publish(status);
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "../Protocol.h"
+
+#include <windows.h>
+
+/**
+ * Publishes protocol::CalibrationStatus for monitoring tools, which read it from shared memory
+ * without touching the driver pipe or the profile. Publishing only copies the status when it
+ * changed, apart from the timestamp, which is refreshed about once a second.
+ */
+class StatusPublisher
+{
+public:
+	~StatusPublisher();
+
+	// Creates the section on the first call, does nothing if that failed.
+	void Publish(const protocol::CalibrationStatus &status);
+
+private:
+	void Open();
+
+	HANDLE mapping = nullptr;
+	protocol::StatusBlock *block = nullptr;
+	bool openFailed = false;
+	protocol::CalibrationStatus last = {};
+};
@@ -0,0 +1,33 @@
+#include "stdafx.h"
+#include "StringTable.h"
+
+#include <deque>
+#include <unordered_map>
+
+// A deque keeps references to existing strings valid as new ones are added.
+static std::deque<std::string> Strings(1);
+static std::unordered_map<std::string, StringID> Ids = { { "", NoString } };
+
+StringID Intern(const std::string &str)
+{
+	auto existing = Ids.find(str);
+	if (existing != Ids.end())
+		return existing->second;
+
+	StringID id = (StringID) Strings.size();
+	Strings.push_back(str);
+	Ids.emplace(str, id);
+	return id;
+}
+
+StringID Intern(const char *str)
+{
+	return Intern(std::string(str));
+}
+
+const std::string &InternedString(StringID id)
+{
+	if (id >= Strings.size())
+		return Strings[NoString];
+	return Strings[id];
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+// Process-wide table of interned strings, so device records and profiles can be compared
+// as small integers. Entries are never removed. Only used from the main thread.
+typedef uint32_t StringID;
+
+const StringID NoString = 0; // Interned id of the empty string.
+
+StringID Intern(const std::string &str);
+StringID Intern(const char *str);
+
+// Returns the empty string for ids that were never handed out.
+const std::string &InternedString(StringID id);
@@ -0,0 +1,140 @@
+#include "stdafx.h"
+#include "TaskPool.h"
+
+#include <vector>
+
+// The worker a thread is, or -1 off the pool.
+static thread_local size_t CurrentWorker = (size_t) -1;
+
+TaskPool &Tasks()
+{
+	static TaskPool pool;
+	return pool;
+}
+
+size_t PhysicalCoreCount()
+{
+	DWORD length = 0;
+	GetLogicalProcessorInformation(nullptr, &length);
+	std::vector<SYSTEM_LOGICAL_PROCESSOR_INFORMATION> info(length / sizeof(SYSTEM_LOGICAL_PROCESSOR_INFORMATION));
+	size_t cores = 0;
+	if (!info.empty() && GetLogicalProcessorInformation(info.data(), &length))
+	{
+		for (auto &entry : info)
+		{
+			if (entry.Relationship == RelationProcessorCore)
+				cores++;
+		}
+	}
+
+	if (cores == 0)
+		cores = std::thread::hardware_concurrency();
+	return cores ? cores : 1;
+}
+
+TaskPool::~TaskPool()
+{
+	if (!workers)
+		return;
+
+	{
+		std::lock_guard<std::mutex> lock(sleepMutex);
+		stopping = true;
+	}
+	wake.notify_all();
+
+	// Workers run out their queues before they see stopping.
+	for (size_t i = 0; i < workerCount; i++)
+		workers[i].thread.join();
+}
+
+size_t TaskPool::WorkerCount()
+{
+	std::call_once(started, &TaskPool::Start, this);
+	return workerCount;
+}
+
+void TaskPool::Start()
+{
+	workerCount = PhysicalCoreCount();
+	workers.reset(new Worker[workerCount]);
+	for (size_t i = 0; i < workerCount; i++)
+	{
+		workers[i].thread = std::thread(&TaskPool::Run, this, i);
+		SetThreadPriority(workers[i].thread.native_handle(), THREAD_PRIORITY_BELOW_NORMAL);
+	}
+}
+
+void TaskPool::Push(std::function<void()> task)
+{
+	std::call_once(started, &TaskPool::Start, this);
+
+	if (CurrentWorker < workerCount)
+	{
+		auto &worker = workers[CurrentWorker];
+		std::lock_guard<std::mutex> lock(worker.mutex);
+		worker.tasks.push_front(std::move(task));
+	}
+	else
+	{
+		auto &worker = workers[nextQueue++ % workerCount];
+		std::lock_guard<std::mutex> lock(worker.mutex);
+		worker.tasks.push_back(std::move(task));
+	}
+
+	{
+		// Under the sleep mutex, so a worker checking queued before it sleeps can't miss it.
+		std::lock_guard<std::mutex> lock(sleepMutex);
+		queued++;
+	}
+	wake.notify_one();
+}
+
+bool TaskPool::Take(size_t self, std::function<void()> &task)
+{
+	{
+		auto &own = workers[self];
+		std::lock_guard<std::mutex> lock(own.mutex);
+		if (!own.tasks.empty())
+		{
+			task = std::move(own.tasks.front());
+			own.tasks.pop_front();
+			queued--;
+			return true;
+		}
+	}
+
+	for (size_t i = 1; i < workerCount; i++)
+	{
+		auto &victim = workers[(self + i) % workerCount];
+		std::lock_guard<std::mutex> lock(victim.mutex);
+		if (!victim.tasks.empty())
+		{
+			task = std::move(victim.tasks.back());
+			victim.tasks.pop_back();
+			queued--;
+			return true;
+		}
+	}
+	return false;
+}
+
+void TaskPool::Run(size_t self)
+{
+	CurrentWorker = self;
+	std::function<void()> task;
+	while (true)
+	{
+		if (Take(self, task))
+		{
+			task();
+			task = nullptr;
+			continue;
+		}
+
+		std::unique_lock<std::mutex> lock(sleepMutex);
+		wake.wait(lock, [this]() { return stopping || queued > 0; });
+		if (stopping)
+			return;
+	}
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+
+/**
+ * One set of worker threads for the client's short background jobs: solves, probes, exports
+ * and batch runs. There is a worker per physical core, all below normal priority, so a solve
+ * uses the cores hyperthreading doesn't share and the VR application still wins any contention.
+ * Each worker has its own queue. Tasks submitted from a worker go to the front of its queue and
+ * run next, tasks from other threads are dealt out to the back of the queues in turn, and an
+ * idle worker steals from the back of another's queue before it sleeps.
+ *
+ * Tasks shouldn't block on other tasks or wait on the network, since either ties up a core's
+ * worker for everyone. Threads that spend their life waiting, like the log writers and the
+ * receivers, keep their own threads.
+ *
+ * The workers start with the first task. Unlike std::async, a dropped future doesn't wait for
+ * its task, so wait before reusing whatever the task works on.
+ */
+class TaskPool
+{
+public:
+	~TaskPool();
+
+	template<class Task>
+	auto Submit(Task &&task) -> std::future<typename std::result_of<typename std::decay<Task>::type()>::type>
+	{
+		typedef typename std::result_of<typename std::decay<Task>::type()>::type Result;
+		auto packaged = std::make_shared<std::packaged_task<Result()>>(std::forward<Task>(task));
+		auto future = packaged->get_future();
+		Push([packaged]() { (*packaged)(); });
+		return future;
+	}
+
+	// Starts the workers if they aren't yet.
+	size_t WorkerCount();
+
+private:
+	struct Worker
+	{
+		std::mutex mutex;
+		std::deque<std::function<void()>> tasks;
+		std::thread thread;
+	};
+
+	void Start();
+	void Push(std::function<void()> task);
+	bool Take(size_t self, std::function<void()> &task);
+	void Run(size_t self);
+
+	std::once_flag started;
+	std::unique_ptr<Worker[]> workers;
+	size_t workerCount = 0;
+	std::atomic<size_t> nextQueue{ 0 };
+
+	// Queued tasks over all workers, sleeping waits on it.
+	std::mutex sleepMutex;
+	std::condition_variable wake;
+	std::atomic<size_t> queued{ 0 };
+	bool stopping = false;
+};
+
+// Shared by everything in the client.
+TaskPool &Tasks();
+
+// Cores, not logical processors. At least 1.
+size_t PhysicalCoreCount();
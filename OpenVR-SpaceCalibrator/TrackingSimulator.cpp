@@ -0,0 +1,168 @@
+#include "stdafx.h"
+#include "TrackingSimulator.h"
+#include "../CalibrationSolver/CalibrationSolver.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <sstream>
+
+bool ParseSimulationOptions(const std::string &args, SimulationOptions &options)
+{
+	std::istringstream words(args);
+	std::string word;
+	while (words >> word)
+	{
+		size_t equals = word.find('=');
+		if (equals == std::string::npos)
+			return false;
+
+		std::string key = word.substr(0, equals);
+		const char *text = word.c_str() + equals + 1;
+		char *end;
+		double value = strtod(text, &end);
+		if (end == text || *end || value < 0.0)
+			return false;
+
+		if (key == "targets")
+			options.targets = (uint32_t) value;
+		else if (key == "samples")
+			options.samples = (size_t) value;
+		else if (key == "seconds")
+			options.seconds = value;
+		else if (key == "rate")
+			options.rate = value;
+		else if (key == "noise")
+			options.positionNoise = value;
+		else if (key == "rotationnoise")
+			options.rotationNoise = value;
+		else if (key == "latency")
+			options.latency = value;
+		else if (key == "drift")
+			options.translationDrift = value;
+		else if (key == "rotationdrift")
+			options.rotationDrift = value;
+		else if (key == "seed")
+			options.seed = (uint32_t) value;
+		else if (key == "gravity")
+			options.gravityAligned = value != 0.0;
+		else
+			return false;
+	}
+
+	return options.targets >= 1 && options.targets < vr::k_unMaxTrackedDeviceCount &&
+		options.samples >= 2 && options.seconds > 0.0 && options.rate > 0.0;
+}
+
+// The target system's world, before any drift: turned most of the way around and a couple of
+// meters off, as two systems set up on their own usually are.
+static const double TruthRotation[3] = { 5.0, 120.0, -8.0 }; // degrees, see EulerQuat
+static const double TruthTranslation[3] = { 1.5, -0.2, 0.8 }; // meters
+
+// Frequencies of the rig's motion, incommensurate so it never repeats. The turns speed up and
+// slow down all the time, which the latency estimate needs.
+static const double RotationAmplitude = 1.2; // radians
+static const double RotationFrequencies[3] = { 0.71, 1.13, 0.93 }; // radians per second
+static const double PositionAmplitude = 0.25; // meters
+static const double PositionFrequencies[3] = { 0.53, 0.37, 0.61 };
+
+TrackingSimulator::TrackingSimulator(const SimulationOptions &options) : options(options), random(options.seed)
+{
+	std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+	for (uint32_t i = 0; i < options.targets; i++)
+	{
+		Eigen::Quaterniond rotation(uniform(random), uniform(random), uniform(random), uniform(random));
+		attachRotations.push_back(rotation.normalized());
+		attachOffsets.push_back(Eigen::Vector3d(uniform(random), uniform(random), uniform(random)) * 0.1);
+	}
+}
+
+void TrackingSimulator::GroundTruth(double time, Eigen::Matrix3d &rotation, Eigen::Vector3d &translation) const
+{
+	double minutes = time / 60.0;
+	Eigen::AngleAxisd drift(options.rotationDrift * minutes * EIGEN_PI / 180.0, Eigen::Vector3d::UnitY());
+	Eigen::Vector3d euler(TruthRotation[0], TruthRotation[1], TruthRotation[2]);
+	if (options.gravityAligned)
+		euler(0) = euler(2) = 0.0;
+	rotation = drift * EulerQuat(euler).toRotationMatrix();
+	translation = Eigen::Vector3d(TruthTranslation[0], TruthTranslation[1], TruthTranslation[2]);
+	translation.x() += options.translationDrift * minutes / 1000.0;
+}
+
+void TrackingSimulator::RigPose(double time, Eigen::Quaterniond &rotation, Eigen::Vector3d &position) const
+{
+	Eigen::Vector3d turn, offset;
+	for (int i = 0; i < 3; i++)
+	{
+		turn(i) = RotationAmplitude * sin(RotationFrequencies[i] * time + i);
+		offset(i) = PositionAmplitude * sin(PositionFrequencies[i] * time + 2 * i);
+	}
+
+	double angle = turn.norm();
+	rotation = angle > 0.0 ? Eigen::Quaterniond(Eigen::AngleAxisd(angle, turn / angle)) : Eigen::Quaterniond::Identity();
+	position = Eigen::Vector3d(0.0, 1.2, 0.0) + offset;
+}
+
+// In the reference system's world.
+void TrackingSimulator::DevicePose(uint32_t openVRID, double time, Eigen::Quaterniond &rotation, Eigen::Vector3d &position) const
+{
+	RigPose(time, rotation, position);
+	if (openVRID == ReferenceID)
+		return;
+
+	position += rotation * attachOffsets[openVRID - 1];
+	rotation = rotation * attachRotations[openVRID - 1];
+}
+
+protocol::PoseCaptureSample TrackingSimulator::Report(uint32_t openVRID, double time)
+{
+	// The reference system shows what the rig did latency ago, the target system shows it now.
+	double motionTime = openVRID == ReferenceID ? time - options.latency / 1000.0 : time;
+
+	Eigen::Quaterniond rotation, before, after;
+	Eigen::Vector3d position, positionBefore, positionAfter;
+	DevicePose(openVRID, motionTime, rotation, position);
+
+	// Speeds as tracking reports them, without the noise.
+	const double step = 0.0005;
+	DevicePose(openVRID, motionTime - step, before, positionBefore);
+	DevicePose(openVRID, motionTime + step, after, positionAfter);
+
+	if (openVRID != ReferenceID)
+	{
+		Eigen::Matrix3d truthRotation;
+		Eigen::Vector3d truthTranslation;
+		GroundTruth(time, truthRotation, truthTranslation);
+		rotation = Eigen::Quaterniond(truthRotation.transpose()) * rotation;
+		position = truthRotation.transpose() * (position - truthTranslation);
+	}
+
+	double positionSigma = options.positionNoise / 1000.0, rotationSigma = options.rotationNoise * EIGEN_PI / 180.0;
+	Eigen::Vector3d turn(gaussian(random), gaussian(random), gaussian(random));
+	turn *= rotationSigma;
+	if (turn.norm() > 0.0)
+		rotation = Eigen::Quaterniond(Eigen::AngleAxisd(turn.norm(), turn.normalized())) * rotation;
+	position += Eigen::Vector3d(gaussian(random), gaussian(random), gaussian(random)) * positionSigma;
+
+	protocol::PoseCaptureSample sample;
+	sample.openVRID = openVRID;
+	sample.valid = true;
+	sample.trackingResult = vr::TrackingResult_Running_OK;
+	sample.timestamp = time;
+	for (int i = 0; i < 3; i++)
+		sample.position[i] = position(i);
+	sample.rotation = { rotation.w(), rotation.x(), rotation.y(), rotation.z() };
+	sample.linearSpeed = (positionAfter - positionBefore).norm() / (2 * step);
+	sample.angularSpeed = before.angularDistance(after) / (2 * step);
+	return sample;
+}
+
+void TrackingSimulator::Capture(double from, double to, std::vector<protocol::PoseCaptureSample> &out)
+{
+	// Every device reports on the same grid, the reference first.
+	for (double tick = floor(from * options.rate) + 1.0; tick <= to * options.rate; tick++)
+	{
+		double time = tick / options.rate;
+		for (uint32_t id = 0; id <= options.targets; id++)
+			out.push_back(Report(id, time));
+	}
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "../Protocol.h"
+
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+
+#include <random>
+#include <string>
+#include <vector>
+
+struct SimulationOptions
+{
+	uint32_t targets = 1; // Target devices on the rig, up to 63 next to the reference.
+	size_t samples = 250; // Collected per target device, like a session of custom speed.
+	double seconds = 60.0; // Longest the session may take to collect them.
+	double rate = 250.0; // Poses per second of every device.
+	double positionNoise = 1.0; // mm, standard deviation per axis.
+	double rotationNoise = 0.1; // degrees, standard deviation per axis.
+	double latency = 20.0; // ms the reference system reports motion after the target system.
+	double translationDrift = 0.0; // mm per minute the target system's world moves by.
+	double rotationDrift = 0.0; // degrees per minute it turns by about the vertical axis.
+	uint32_t seed = 1;
+	bool gravityAligned = false; // Both systems level their worlds, and the solve only looks for yaw.
+};
+
+// Reads space separated key=value pairs named like the members above without their units,
+// e.g. "targets=8 noise=2 latency=30", gravity=1 for gravityAligned. Returns false on anything
+// it doesn't know.
+bool ParseSimulationOptions(const std::string &args, SimulationOptions &options);
+
+/**
+ * Two tracking systems seeing one rig of devices: the reference device, and target devices
+ * rigidly attached to it at offsets of their own. The target system's world is the reference
+ * system's moved by a known transform, which may drift, and each device's poses get noise of
+ * their own. Poses come out as the driver captures them, so they go through the same history,
+ * latency estimation and sample selection as the poses of a live session.
+ */
+class TrackingSimulator
+{
+public:
+	static const uint32_t ReferenceID = 0; // Target device i has OpenVR ID i + 1.
+
+	explicit TrackingSimulator(const SimulationOptions &options);
+
+	// Maps target space positions into reference space as rotation * p + translation, like a
+	// CalibrationSolution. Translation in meters.
+	void GroundTruth(double time, Eigen::Matrix3d &rotation, Eigen::Vector3d &translation) const;
+
+	// Appends the poses every device reports after from, up to and including to, in seconds.
+	void Capture(double from, double to, std::vector<protocol::PoseCaptureSample> &out);
+
+private:
+	void RigPose(double time, Eigen::Quaterniond &rotation, Eigen::Vector3d &position) const;
+	void DevicePose(uint32_t openVRID, double time, Eigen::Quaterniond &rotation, Eigen::Vector3d &position) const;
+	protocol::PoseCaptureSample Report(uint32_t openVRID, double time);
+
+	SimulationOptions options;
+	std::mt19937 random;
+	std::normal_distribution<double> gaussian;
+
+	// Of each target device relative to the reference device.
+	std::vector<Eigen::Quaterniond> attachRotations;
+	std::vector<Eigen::Vector3d> attachOffsets;
+};
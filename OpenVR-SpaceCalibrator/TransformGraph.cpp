@@ -0,0 +1,93 @@
+#include "stdafx.h"
+#include "TransformGraph.h"
+
+void TransformGraph::SetRoot(StringID system)
+{
+	if (system == root)
+		return;
+
+	root = system;
+	nodes.clear();
+}
+
+bool TransformGraph::SetEdge(StringID system, StringID parent, const Transform &transform)
+{
+	if (system == root)
+		return false;
+
+	auto existing = nodes.find(system);
+	if (existing != nodes.end())
+	{
+		auto &edge = existing->second.edge;
+		if (existing->second.parent == parent && edge.scale == transform.scale &&
+			edge.rotation == transform.rotation && edge.translation == transform.translation)
+			return false;
+	}
+
+	Invalidate(system);
+	auto &node = nodes[system];
+	node.parent = parent;
+	node.edge = transform;
+	return true;
+}
+
+bool TransformGraph::RemoveEdge(StringID system)
+{
+	if (!nodes.count(system))
+		return false;
+
+	Invalidate(system);
+	nodes.erase(system);
+	return true;
+}
+
+// Drops the cached transform of the system and of every system whose path runs through it.
+// The system itself may have no node yet, children that failed to resolve without it still do.
+void TransformGraph::Invalidate(StringID system)
+{
+	auto node = nodes.find(system);
+	if (node != nodes.end())
+		node->second.cached = false;
+
+	// Only cached children can have cached descendants, which also ends the walk on a cycle.
+	for (auto &entry : nodes)
+	{
+		if (entry.second.parent == system && entry.second.cached)
+			Invalidate(entry.first);
+	}
+}
+
+bool TransformGraph::Resolve(StringID system, Transform &out)
+{
+	if (system == root)
+	{
+		out = Transform();
+		return true;
+	}
+
+	auto found = nodes.find(system);
+	if (found == nodes.end())
+		return false;
+
+	auto &node = found->second;
+	if (!node.cached)
+	{
+		// Marked before recursing, so a cycle finds a cached, unresolvable node and ends there.
+		node.cached = true;
+		node.resolvable = false;
+
+		Transform parent;
+		if (Resolve(node.parent, parent))
+		{
+			node.toRoot.scale = parent.scale * node.edge.scale;
+			node.toRoot.rotation = parent.rotation * node.edge.rotation;
+			node.toRoot.translation = parent.scale * (parent.rotation * node.edge.translation) + parent.translation;
+			node.resolvable = true;
+		}
+		compositions++;
+	}
+
+	if (node.resolvable)
+		out = node.toRoot;
+	return node.resolvable;
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "StringTable.h"
+
+#include <Eigen/Core>
+#include <unordered_map>
+
+/**
+ * Calibrations between tracking systems as a graph. Systems are nodes, and each calibration is
+ * an edge from the calibrated system to the one it was measured against. A system's transform
+ * into the root, the reference the HMD tracks in, is the composition along its path, and is
+ * cached until an edge on that path changes. Changing an edge only drops the cached transforms
+ * of the systems below it.
+ */
+class TransformGraph
+{
+public:
+	// Maps a point x of the system to scale * rotation * x + translation in its parent.
+	struct Transform
+	{
+		Eigen::Matrix3d rotation = Eigen::Matrix3d::Identity();
+		Eigen::Vector3d translation = Eigen::Vector3d::Zero(); // cm
+		double scale = 1.0;
+	};
+
+	// Drops every edge when the root changes.
+	void SetRoot(StringID system);
+	StringID Root() const { return root; }
+
+	// Nothing is recomputed when the edge is unchanged. Both return whether the edge changed.
+	bool SetEdge(StringID system, StringID parent, const Transform &transform);
+	bool RemoveEdge(StringID system);
+	bool HasEdge(StringID system) const { return nodes.count(system) != 0; }
+
+	// Fails for systems without a path to the root, including ones on a cycle.
+	bool Resolve(StringID system, Transform &out);
+
+	// Number of cached transforms composed so far, for seeing what an edit really recomputed.
+	uint64_t Compositions() const { return compositions; }
+
+private:
+	struct Node
+	{
+		StringID parent = NoString;
+		Transform edge;
+		bool cached = false, resolvable = false;
+		Transform toRoot;
+	};
+
+	void Invalidate(StringID system);
+
+	StringID root = NoString;
+	std::unordered_map<StringID, Node> nodes;
+	uint64_t compositions = 0;
+};
@@ -0,0 +1,110 @@
+#include "stdafx.h"
+#include "TrayIcon.h"
+#include "Resource.h"
+
+#include <shellapi.h>
+
+static const UINT TrayCallbackMessage = WM_APP + 1;
+static const UINT TrayIconID = 1;
+
+enum TrayCommand
+{
+	TrayCommandOpen = 1,
+	TrayCommandDiagnostics,
+	TrayCommandQuit,
+};
+
+static void NotifyIcon(HWND window, DWORD operation, const wchar_t *tooltip)
+{
+	NOTIFYICONDATAW data = { sizeof data };
+	data.hWnd = window;
+	data.uID = TrayIconID;
+	data.uFlags = NIF_ICON | NIF_MESSAGE | NIF_TIP;
+	data.uCallbackMessage = TrayCallbackMessage;
+	data.hIcon = LoadIconW(GetModuleHandleW(nullptr), MAKEINTRESOURCEW(IDI_SMALL));
+	wcsncpy_s(data.szTip, tooltip, _TRUNCATE);
+	Shell_NotifyIconW(operation, &data);
+}
+
+void TrayIcon::Add(const wchar_t *text)
+{
+	if (window)
+		return;
+
+	WNDCLASSW windowClass = { 0 };
+	windowClass.lpfnWndProc = WindowProc;
+	windowClass.hInstance = GetModuleHandleW(nullptr);
+	windowClass.lpszClassName = L"SpaceCalibratorTray";
+	RegisterClassW(&windowClass);
+
+	window = CreateWindowW(windowClass.lpszClassName, L"", 0, 0, 0, 0, 0, HWND_MESSAGE, nullptr, windowClass.hInstance, nullptr);
+	if (!window)
+		throw std::runtime_error("Failed to create the tray icon window");
+	SetWindowLongPtrW(window, GWLP_USERDATA, (LONG_PTR) this);
+
+	// Explorer forgets every icon when it restarts, and broadcasts this once it's back.
+	taskbarCreatedMessage = RegisterWindowMessageW(L"TaskbarCreated");
+
+	wcsncpy_s(tooltip, text, _TRUNCATE);
+	NotifyIcon(window, NIM_ADD, tooltip);
+}
+
+void TrayIcon::Remove()
+{
+	if (!window)
+		return;
+
+	NotifyIcon(window, NIM_DELETE, tooltip);
+	DestroyWindow(window);
+	window = nullptr;
+}
+
+void TrayIcon::ShowMenu()
+{
+	HMENU menu = CreatePopupMenu();
+	AppendMenuW(menu, MF_STRING, TrayCommandOpen, L"Open Space Calibrator");
+	AppendMenuW(menu, MF_STRING, TrayCommandDiagnostics, L"Save diagnostics report");
+	AppendMenuW(menu, MF_SEPARATOR, 0, nullptr);
+	AppendMenuW(menu, MF_STRING, TrayCommandQuit, L"Quit");
+
+	// Without the foreground the menu doesn't close when clicking elsewhere.
+	POINT cursor;
+	GetCursorPos(&cursor);
+	SetForegroundWindow(window);
+	UINT command = TrackPopupMenu(menu, TPM_RETURNCMD | TPM_RIGHTBUTTON | TPM_NONOTIFY, cursor.x, cursor.y, 0, window, nullptr);
+	DestroyMenu(menu);
+
+	if (command == TrayCommandOpen)
+		openRequested = true;
+	else if (command == TrayCommandDiagnostics)
+		diagnosticsRequested = true;
+	else if (command == TrayCommandQuit)
+		quitRequested = true;
+}
+
+LRESULT CALLBACK TrayIcon::WindowProc(HWND window, UINT message, WPARAM wParam, LPARAM lParam)
+{
+	auto tray = (TrayIcon *) GetWindowLongPtrW(window, GWLP_USERDATA);
+	if (!tray)
+		return DefWindowProcW(window, message, wParam, lParam);
+
+	if (message == TrayCallbackMessage)
+	{
+		switch (LOWORD(lParam))
+		{
+		case WM_LBUTTONUP:
+			tray->openRequested = true;
+			break;
+		case WM_RBUTTONUP:
+			tray->ShowMenu();
+			break;
+		}
+		return 0;
+	}
+	if (tray->taskbarCreatedMessage && message == tray->taskbarCreatedMessage)
+	{
+		NotifyIcon(window, NIM_ADD, tray->tooltip);
+		return 0;
+	}
+	return DefWindowProcW(window, message, wParam, lParam);
+}
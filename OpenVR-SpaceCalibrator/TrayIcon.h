@@ -0,0 +1,27 @@
+#pragma once
+
+/**
+ * A notification area icon for running without a desktop window. It lives on a message-only
+ * window of the calling thread, so whatever pumps that thread's messages (glfwWaitEvents
+ * does) delivers its clicks. Clicks only set the request flags, the owner acts on them.
+ */
+class TrayIcon
+{
+public:
+	~TrayIcon() { Remove(); }
+
+	void Add(const wchar_t *tooltip);
+	void Remove();
+
+	bool openRequested = false; // Left click or "Open".
+	bool quitRequested = false;
+	bool diagnosticsRequested = false; // "Save diagnostics report".
+
+private:
+	static LRESULT CALLBACK WindowProc(HWND window, UINT message, WPARAM wParam, LPARAM lParam);
+	void ShowMenu();
+
+	HWND window = nullptr;
+	UINT taskbarCreatedMessage = 0;
+	wchar_t tooltip[128] = { 0 };
+};
@@ -2,37 +2,70 @@
 #include "UserInterface.h"
 #include "Calibration.h"
 #include "Configuration.h"
+#include "DeviceRegistry.h"
+#include "IPCClient.h"
+#include "ClientTimings.h"
+#include "ProfileStore.h"
+#include "ProfileSync.h"
+#include "NetworkPoses.h"
+#include "MetricsEndpoint.h"
+#include "CalibrationSnapshot.h"
+#include "Diagnostics.h"
+#include "SampleView.h"
+#include "ProcessQoS.h"
+#include "../CalibrationSolver/CalibrationSolver.h"
 #include "../Version.h"
 
-#include <thread>
 #include <string>
 #include <vector>
 #include <algorithm>
+#include <unordered_map>
+#include <ctime>
 #include <imgui/imgui.h>
 
 struct VRDevice
 {
 	int id = -1;
 	vr::TrackedDeviceClass deviceClass;
-	std::string model = "";
-	std::string serial = "";
-	std::string trackingSystem = "";
+	StringID model = NoString;
+	StringID serial = NoString;
+	StringID trackingSystem = NoString;
 	vr::ETrackedControllerRole controllerRole = vr::TrackedControllerRole_Invalid;
+	std::string label; // LabelString, built with the rest of the record.
 };
 
 struct VRState
 {
-	std::vector<std::string> trackingSystems;
+	std::vector<StringID> trackingSystems;
 	std::vector<VRDevice> devices;
 };
 
 void TextWithWidth(const char *label, const char *text, float width);
 
+const VRState &CachedVRState();
 VRState LoadVRState();
 void BuildSystemSelection(const VRState &state);
+void BuildCalibrateAgainstSelection();
 void BuildDeviceSelections(const VRState &state);
+void BuildExtraTargetSelection(const VRState &state);
+void BuildExtraReferenceSelection(const VRState &state);
+void BuildMotionCompensation();
+void BuildDeviceLink();
+void BuildNetworkPoses();
+void BuildMetricsEndpoint();
+void BuildProfileHistory();
+void BuildProfileSharing();
+void BuildSharedAnchor();
 void BuildProfileEditor();
+void BuildDeviceOffsetEditor();
+void AppendSeparated(std::string &buffer, const std::string &suffix);
 void BuildMenu(bool runningInOverlay);
+void BuildDriverStatus();
+void BuildClientTimings(bool open);
+void BuildDriverStatistics(bool open);
+void BuildCollectionMetrics(const CollectionMetrics &metrics);
+void BuildVerifyMetrics(const VerifyMetrics &metrics);
+void BuildMessageLog(const MessageLog &messages);
 
 static const ImGuiWindowFlags bareWindowFlags =
 	ImGuiWindowFlags_NoTitleBar |
@@ -54,7 +87,7 @@ void BuildMainWindow(bool runningInOverlay)
 
 	ImGui::PushStyleColor(ImGuiCol_PlotHistogram, ImGui::GetStyleColorVec4(ImGuiCol_Button));
 
-	auto state = LoadVRState();
+	auto &state = CachedVRState();
 	BuildSystemSelection(state);
 	BuildDeviceSelections(state);
 	BuildMenu(runningInOverlay);
@@ -63,31 +96,249 @@ void BuildMainWindow(bool runningInOverlay)
 	ImGui::End();
 }
 
+static const char *const RequestTypeNames[] = {
+	"Other", "Handshake", "Transform", "Transform batch", "Pose hook stats", "Tracking system rules",
+	"Continuous calibration", "Continuous status", "Driver stats",
+};
+
+// Round trip times show when hovering the connection state.
+void BuildDriverStatus()
+{
+	ImGui::TextColored(ImColor(0.5f, 0.5f, 0.5f), CalCtx.driverConnected ? "- driver connected" : "- driver disconnected");
+	if (!ImGui::IsItemHovered())
+		return;
+
+	ImGui::BeginTooltip();
+	bool any = false;
+	for (uint32_t type = 0; type < sizeof RequestTypeNames / sizeof RequestTypeNames[0]; type++)
+	{
+		auto &latency = DriverRequestLatency(type);
+		if (!latency.count)
+			continue;
+
+		ImGui::Text("%s: %llu requests, last %.2f ms, mean %.2f ms, max %.2f ms", RequestTypeNames[type],
+			(unsigned long long) latency.count, latency.last * 1000.0, latency.Mean() * 1000.0, latency.max * 1000.0);
+		any = true;
+	}
+	if (!any)
+		ImGui::Text("No driver requests answered yet");
+	ImGui::EndTooltip();
+}
+
+static void PlotTimingHistory(const char *label, const TimingHistory &history)
+{
+	char overlay[128];
+	snprintf(overlay, sizeof overlay, "%s: last %.2f ms, mean %.2f ms, max %.2f ms", label, history.Last(), history.Mean(), history.Max());
+
+	ImGui::PushID(label);
+	ImGui::PlotHistogram("", history.ms, (int) history.count, history.PlotOffset(), overlay,
+		0.0f, std::max(history.Max() * 1.1f, 0.01f), ImVec2(-1.0f, ImGui::GetTextLineHeight() * 2));
+	ImGui::PopID();
+}
+
+// Where the client spends its time, for users to report on machines we can't test on.
+void BuildClientTimings(bool open)
+{
+	auto &io = ImGui::GetIO();
+	if (open)
+		ImGui::OpenPopup("Client Timings");
+
+	ImGui::SetNextWindowPos(ImVec2(20.0f, 20.0f), ImGuiSetCond_Always);
+	ImGui::SetNextWindowSize(ImVec2(io.DisplaySize.x - 40.0f, io.DisplaySize.y - 40.0f), ImGuiSetCond_Always);
+	if (!ImGui::BeginPopupModal("Client Timings", nullptr, bareWindowFlags))
+		return;
+
+	ImGui::Columns(2, nullptr, false);
+	ImGui::Text("CPU time of the last %d runs", (int) TimingHistory::Length);
+	for (size_t i = 0; i < (size_t) TimingSection::Count; i++)
+	{
+		auto section = (TimingSection) i;
+		if (Timings[section].count)
+			PlotTimingHistory(TimingSectionName(section), Timings[section]);
+	}
+
+	ImGui::NextColumn();
+	ImGui::Text("Driver round trips of the last %d requests", (int) TimingHistory::Length);
+	for (uint32_t type = 0; type < sizeof RequestTypeNames / sizeof RequestTypeNames[0]; type++)
+	{
+		auto &latency = DriverRequestLatency(type);
+		if (latency.count)
+			PlotTimingHistory(RequestTypeNames[type], latency.recent);
+	}
+	ImGui::Columns(1);
+
+	size_t workingSet, peakWorkingSet;
+	ProcessWorkingSet(workingSet, peakWorkingSet);
+	ImGui::Text("");
+	ImGui::Text("Working set %.1f MB, at most %.1f MB%s", workingSet / 1048576.0, peakWorkingSet / 1048576.0,
+		CalCtx.lowMemory ? ", low memory mode" : "");
+
+	ImGui::Text("");
+	if (ImGui::Button("Close", ImVec2(ImGui::GetWindowContentRegionWidth(), ImGui::GetTextLineHeight() * 2)))
+		ImGui::CloseCurrentPopup();
+
+	ImGui::EndPopup();
+}
+
+// Rates between the last two snapshots, so devices flooding updates and a slow pose hook stand out.
+void BuildDriverStatistics(bool open)
+{
+	auto &io = ImGui::GetIO();
+	if (open)
+		ImGui::OpenPopup("Driver Statistics");
+
+	ImGui::SetNextWindowPos(ImVec2(20.0f, 20.0f), ImGuiSetCond_Always);
+	ImGui::SetNextWindowSize(ImVec2(io.DisplaySize.x - 40.0f, io.DisplaySize.y - 40.0f), ImGuiSetCond_Always);
+	if (!ImGui::BeginPopupModal("Driver Statistics", nullptr, bareWindowFlags))
+		return;
+
+	WantDriverStats();
+
+	const protocol::DriverStats *previous, *latest;
+	double elapsed = 0.0;
+	if (DriverStatsSnapshots(previous, latest))
+		elapsed = latest->poseHook.timestamp - previous->poseHook.timestamp;
+
+	if (!CalCtx.driverConnected)
+	{
+		ImGui::Text("The driver isn't connected");
+	}
+	else if (elapsed <= 0.0)
+	{
+		ImGui::Text("Waiting for the driver's counters...");
+	}
+	else
+	{
+		auto &hook = latest->poseHook, &before = previous->poseHook;
+		uint64_t calls = hook.calls - before.calls;
+		double meanMicroseconds = calls ? (hook.totalNanoseconds - before.totalNanoseconds) / 1000.0 / calls : 0.0;
+
+		ImGui::Text("Pose hook: %.0f calls/s, mean %.2f us, max %.2f us since SteamVR started",
+			calls / elapsed, meanMicroseconds, hook.maxNanoseconds / 1000.0);
+		ImGui::Text("Transformed poses: %.0f/s, queued for the driver: %.0f/s, dropped in total: %llu",
+			(hook.transformedPoses - before.transformedPoses) / elapsed, (hook.queuedPoses - before.queuedPoses) / elapsed,
+			(unsigned long long) hook.queueOverflows);
+		ImGui::Text("IPC: %.1f requests/s, %llu invalid in total, %u pipe instances",
+			(latest->requestsHandled - previous->requestsHandled) / elapsed, (unsigned long long) latest->invalidRequests,
+			latest->pipeInstances);
+
+		struct DeviceRate { uint32_t id; double rate; };
+		std::vector<DeviceRate> rates;
+		for (uint32_t id = 0; id < vr::k_unMaxTrackedDeviceCount; id++)
+		{
+			uint64_t updates = hook.deviceUpdates[id] - before.deviceUpdates[id];
+			if (updates)
+				rates.push_back({ id, updates / elapsed });
+		}
+		std::sort(rates.begin(), rates.end(), [](const DeviceRate &a, const DeviceRate &b) { return a.rate > b.rate; });
+
+		ImGui::Text("");
+		static const char *const RateClassNames[] = { "", "steady", "irregular", "stalled" };
+		ImGui::Columns(6, nullptr, false);
+		ImGui::Text("Device"); ImGui::NextColumn();
+		ImGui::Text("Serial"); ImGui::NextColumn();
+		ImGui::Text("Tracking system"); ImGui::NextColumn();
+		ImGui::Text("Updates/s"); ImGui::NextColumn();
+		ImGui::Text("Jitter"); ImGui::NextColumn();
+		ImGui::Text("Timing"); ImGui::NextColumn();
+		for (auto &rate : rates)
+		{
+			auto &device = Devices.devices[rate.id];
+			ImGui::Text("%u", rate.id); ImGui::NextColumn();
+			ImGui::Text("%s", InternedString(device.serial).c_str()); ImGui::NextColumn();
+			ImGui::Text("%s", device.hasTrackingSystem ? InternedString(device.trackingSystem).c_str() : ""); ImGui::NextColumn();
+			ImGui::Text("%.1f", rate.rate); ImGui::NextColumn();
+
+			protocol::DevicePoseRate poseRate;
+			bool haveRate = DriverPoseRate(rate.id, poseRate) && poseRate.rateClass <= protocol::PoseRateStalled;
+			if (haveRate && poseRate.interval > 0.0f)
+				ImGui::Text("%.2f ms", poseRate.jitter * 1000.0f);
+			ImGui::NextColumn();
+			ImGui::Text("%s", haveRate ? RateClassNames[poseRate.rateClass] : ""); ImGui::NextColumn();
+		}
+		ImGui::Columns(1);
+	}
+
+	ImGui::Text("");
+	if (ImGui::Button("Close", ImVec2(ImGui::GetWindowContentRegionWidth(), ImGui::GetTextLineHeight() * 2)))
+		ImGui::CloseCurrentPopup();
+
+	ImGui::EndPopup();
+}
+
+// The last command a button posted. Until it ran the UI still shows the state from before it.
+static std::shared_ptr<const CalibrationCommandResult> PendingCommand;
+
+static void Post(std::function<bool(CalibrationContext &ctx)> command)
+{
+	PendingCommand = PostCalibrationCommand(std::move(command));
+}
+
+static bool CommandPending()
+{
+	return PendingCommand && !PendingCommand->Done();
+}
+
 void BuildMenu(bool runningInOverlay)
 {
 	auto &io = ImGui::GetIO();
 	ImGuiStyle &style = ImGui::GetStyle();
 	ImGui::Text("");
 
+	if (!CalCtx.driverConnected)
+	{
+		ImGui::TextColored(ImColor(0.8f, 0.2f, 0.2f), "Waiting for the Space Calibrator driver, make sure the addon is enabled in SteamVR settings");
+		ImGui::Text("");
+	}
+
 	if (CalCtx.state == CalibrationState::None)
 	{
-		if (CalCtx.validProfile && !CalCtx.enabled)
+		if ((CalCtx.validProfile || !CalCtx.otherTargets.empty()) && !CalCtx.enabled)
+		{
+			ImGui::TextColored(ImColor(0.8f, 0.2f, 0.2f), "Reference (%s) HMD not detected, profile disabled", InternedString(CalCtx.referenceTrackingSystem).c_str());
+			ImGui::Text("");
+		}
+
+		if (!CalCtx.otherTargets.empty())
 		{
-			ImGui::TextColored(ImColor(0.8f, 0.2f, 0.2f), "Reference (%s) HMD not detected, profile disabled", CalCtx.referenceTrackingSystem.c_str());
+			std::string systems;
+			for (auto &target : CalCtx.otherTargets)
+				AppendSeparated(systems, InternedString(target.trackingSystem));
+			ImGui::TextColored(ImColor(0.5f, 0.5f, 0.5f), "Also calibrated: %s", systems.c_str());
+			ImGui::Text("");
+		}
+
+		if (!CalCtx.otherUniverses.empty())
+		{
+			ImGui::TextColored(ImColor(0.5f, 0.5f, 0.5f), "Profiles of %d other universes are ready for when the HMD switches rooms", (int) CalCtx.otherUniverses.size());
+			ImGui::Text("");
+		}
+
+		if (CalCtx.checkpointSamples)
+		{
+			ImGui::TextColored(ImColor(0.5f, 0.5f, 0.5f), "A calibration was cut off after %d samples", (int) CalCtx.checkpointSamples);
+			ImGui::SameLine();
+			if (ImGui::SmallButton("Resume"))
+			{
+				ImGui::OpenPopup("Calibration Progress");
+				Post([](CalibrationContext &) { return ResumeCalibration(); });
+			}
+			if (ImGui::IsItemHovered())
+				ImGui::SetTooltip("Collects only the samples it still needs, with the same devices selected");
 			ImGui::Text("");
 		}
 
 		float width = ImGui::GetWindowContentRegionWidth(), scale = 1.0f;
 		if (CalCtx.validProfile)
 		{
-			width -= style.FramePadding.x * 4.0f;
-			scale = 1.0f / 3.0f;
+			width -= style.FramePadding.x * 8.0f;
+			scale = 1.0f / 5.0f;
 		}
 
 		if (ImGui::Button("Start Calibration", ImVec2(width * scale, ImGui::GetTextLineHeight() * 2)))
 		{
 			ImGui::OpenPopup("Calibration Progress");
-			StartCalibration();
+			Post([](CalibrationContext &) { StartCalibration(); return true; });
 		}
 
 		if (CalCtx.validProfile)
@@ -95,14 +346,30 @@ void BuildMenu(bool runningInOverlay)
 			ImGui::SameLine();
 			if (ImGui::Button("Edit Calibration", ImVec2(width * scale, ImGui::GetTextLineHeight() * 2)))
 			{
-				CalCtx.state = CalibrationState::Editing;
+				Post([](CalibrationContext &ctx) { ctx.state = CalibrationState::Editing; return true; });
+			}
+
+			ImGui::SameLine();
+			if (ImGui::Button("Verify Calibration", ImVec2(width * scale, ImGui::GetTextLineHeight() * 2)))
+			{
+				ImGui::OpenPopup("Calibration Progress");
+				Post([](CalibrationContext &) { return StartVerification(); });
+			}
+
+			ImGui::SameLine();
+			if (ImGui::Button("Continuous Calibration", ImVec2(width * scale, ImGui::GetTextLineHeight() * 2)))
+			{
+				Post([](CalibrationContext &) { return StartContinuousCalibration(); });
 			}
 
 			ImGui::SameLine();
 			if (ImGui::Button("Clear Calibration", ImVec2(width * scale, ImGui::GetTextLineHeight() * 2)))
 			{
-				CalCtx.Clear();
-				SaveProfile(CalCtx);
+				Post([](CalibrationContext &ctx) {
+					ctx.Clear();
+					SaveProfile(ctx);
+					return true;
+				});
 			}
 		}
 
@@ -117,8 +384,11 @@ void BuildMenu(bool runningInOverlay)
 		ImGui::Text("");
 		if (ImGui::Button("Copy Chaperone Bounds to profile", ImVec2(width * scale, ImGui::GetTextLineHeight() * 2)))
 		{
-			LoadChaperoneBounds();
-			SaveProfile(CalCtx);
+			Post([](CalibrationContext &ctx) {
+				LoadChaperoneBounds();
+				SaveProfile(ctx);
+				return true;
+			});
 		}
 
 		if (CalCtx.chaperone.valid)
@@ -126,13 +396,20 @@ void BuildMenu(bool runningInOverlay)
 			ImGui::SameLine();
 			if (ImGui::Button("Paste Chaperone Bounds", ImVec2(width * scale, ImGui::GetTextLineHeight() * 2)))
 			{
-				ApplyChaperoneBounds();
+				Post([](CalibrationContext &) { return ApplyChaperoneBounds(); });
 			}
 
 			if (ImGui::Checkbox(" Paste Chaperone Bounds automatically when geometry resets", &CalCtx.chaperone.autoApply))
 			{
 				SaveProfile(CalCtx);
 			}
+
+			if (ImGui::Checkbox(" Move Chaperone Bounds with the target's calibration", &CalCtx.chaperone.followCalibration))
+			{
+				SaveProfile(CalCtx);
+			}
+			if (ImGui::IsItemHovered())
+				ImGui::SetTooltip("For bounds traced with the target system's controllers, keeps them where those controllers put them after a recalibration");
 		}
 
 		ImGui::Text("");
@@ -153,16 +430,92 @@ void BuildMenu(bool runningInOverlay)
 		if (ImGui::RadioButton(" Very Slow     ", speed == CalibrationContext::VERY_SLOW))
 			CalCtx.calibrationSpeed = CalibrationContext::VERY_SLOW;
 
+		ImGui::NextColumn();
+		ImGui::NextColumn();
+		if (ImGui::RadioButton(" Adaptive      ", speed == CalibrationContext::ADAPTIVE))
+			CalCtx.calibrationSpeed = CalibrationContext::ADAPTIVE;
+		if (ImGui::IsItemHovered())
+			ImGui::SetTooltip("Collects until the calibration is certain, longer for noisy tracking");
+
+		ImGui::NextColumn();
+		if (ImGui::RadioButton(" Custom        ", speed == CalibrationContext::CUSTOM))
+			CalCtx.calibrationSpeed = CalibrationContext::CUSTOM;
+
+		ImGui::NextColumn();
+		if (speed == CalibrationContext::CUSTOM)
+		{
+			int count = (int) CalCtx.customSampleCount;
+			if (ImGui::InputInt(" samples", &count, 50, 250))
+			{
+				count = std::max(count, (int) CalibrationContext::MinCustomSampleCount);
+				CalCtx.customSampleCount = (size_t) std::min(count, (int) CalibrationContext::MaxCustomSampleCount);
+			}
+		}
+
 		ImGui::Columns(1);
+
+		ImGui::Checkbox(" Record calibration samples to file", &CalCtx.recordSamples);
+		ImGui::Checkbox(" Export each calibration's per-sample errors to CSV", &CalCtx.exportResiduals);
+		ImGui::Checkbox(" Predict polled poses to the next displayed frame", &CalCtx.vsyncAlignedPoses);
+		ImGui::Checkbox(" Estimate scale", &CalCtx.estimateScale);
+		ImGui::Checkbox(" Both systems are level (solve yaw and translation only)", &CalCtx.gravityAligned);
+		ImGui::PushItemWidth(ImGui::GetFontSize() * 14);
+		ImGui::Combo(" Outlier weighting of the translation solve", &CalCtx.robustLoss, "None (least squares)\0Huber\0Tukey\0");
+		ImGui::PopItemWidth();
+		if (ImGui::IsItemHovered())
+			ImGui::SetTooltip("Huber and Tukey weigh down samples far from the fit, such as reflections or tracking jumps, instead of letting them pull the result");
+		ImGui::Checkbox(" Compare the solver's options on each calibration's samples", &CalCtx.compareSolvers);
+		if (ImGui::IsItemHovered())
+			ImGui::SetTooltip("Solves the samples with and without level systems, scale and the current profile as a prior, and logs how each fits");
+		ImGui::Checkbox(" Run continuous calibration inside the driver", &CalCtx.driverContinuous);
+		ImGui::Checkbox(" Low memory mode", &CalCtx.lowMemory);
+		if (ImGui::IsItemHovered())
+			ImGui::SetTooltip("Frees the GL resources, UI caches and calibration buffers a few seconds after the window and dashboard close, for machines short on memory");
+
+		char latencyLabel[96];
+		snprintf(latencyLabel, sizeof latencyLabel, " Compensate the target system's latency (%+.1f ms behind the reference)", -CalCtx.targetLatency * 1000.0);
+		if (ImGui::Checkbox(latencyLabel, &CalCtx.latencyCompensation))
+			ProfileEdited(Devices.TrackingSystemMask(CalCtx.targetTrackingSystem));
+
+		float transition = (float) CalCtx.transformTransition;
+		if (ImGui::SliderFloat(" Transform transition (seconds)", &transition, 0.0f, 3.0f, "%.1f"))
+			CalCtx.transformTransition = transition;
+
+		float tolerance = (float) CalCtx.chaperoneTolerance;
+		if (ImGui::SliderFloat(" Simplify copied chaperone bounds (cm)", &tolerance, 0.0f, 10.0f, "%.1f"))
+			CalCtx.chaperoneTolerance = tolerance;
+		if (ImGui::IsItemHovered())
+			ImGui::SetTooltip("Merges wall segments that stay within this distance of a straight wall, for bounds scanned with thousands of quads");
+
+		BuildMotionCompensation();
+		BuildDeviceLink();
+		BuildNetworkPoses();
+		BuildProfileHistory();
+		BuildProfileSharing();
+		BuildSharedAnchor();
+		BuildMetricsEndpoint();
 	}
 	else if (CalCtx.state == CalibrationState::Editing)
 	{
 		BuildProfileEditor();
+		BuildDeviceOffsetEditor();
 
 		if (ImGui::Button("Save Profile", ImVec2(ImGui::GetWindowContentRegionWidth(), ImGui::GetTextLineHeight() * 2)))
 		{
-			SaveProfile(CalCtx);
-			CalCtx.state = CalibrationState::None;
+			Post([](CalibrationContext &ctx) {
+				SaveProfile(ctx);
+				ctx.state = CalibrationState::None;
+				return true;
+			});
+		}
+	}
+	else if (CalCtx.state == CalibrationState::Continuous)
+	{
+		ImGui::Text("Continuous calibration is refining the profile while both devices move.");
+		ImGui::Text("");
+		if (ImGui::Button("Stop Continuous Calibration", ImVec2(ImGui::GetWindowContentRegionWidth(), ImGui::GetTextLineHeight() * 2)))
+		{
+			Post([](CalibrationContext &) { StopContinuousCalibration(); return true; });
 		}
 	}
 	else
@@ -178,35 +531,59 @@ void BuildMenu(bool runningInOverlay)
 		ImGui::SameLine();
 		ImGui::Text("- close VR overlay to use mouse");
 	}
+	ImGui::SameLine();
+	BuildDriverStatus();
+	ImGui::SameLine();
+	bool openTimings = ImGui::SmallButton("Timings");
+	ImGui::SameLine();
+	bool openDriverStats = ImGui::SmallButton("Driver stats");
+	ImGui::SameLine();
+	if (ImGui::SmallButton("Diagnostics"))
+		Post([](CalibrationContext &ctx) { return WriteDiagnosticsReport(ctx); });
+	if (ImGui::IsItemHovered())
+		ImGui::SetTooltip("Saves a report for support to the profile directory, see the log for where");
 	ImGui::EndChild();
 
+	// Opened out here, the popups have to be in the same window as their OpenPopup.
+	BuildClientTimings(openTimings);
+	BuildDriverStatistics(openDriverStats);
+
 	ImGui::SetNextWindowPos(ImVec2(20.0f, 20.0f), ImGuiSetCond_Always);
 	ImGui::SetNextWindowSize(ImVec2(io.DisplaySize.x - 40.0f, io.DisplaySize.y - 40.0f), ImGuiSetCond_Always);
 	if (ImGui::BeginPopupModal("Calibration Progress", nullptr, bareWindowFlags))
 	{
 		ImGui::PushStyleColor(ImGuiCol_FrameBg, (ImVec4)ImColor(0, 0, 0));
-		for (auto &message : CalCtx.messages)
-		{
-			switch (message.type)
-			{
-			case CalibrationContext::Message::String:
-				ImGui::TextWrapped(message.str.c_str());
-				break;
-			case CalibrationContext::Message::Progress:
-				float fraction = (float)message.progress / (float)message.target;
-				ImGui::Text("");
-				ImGui::ProgressBar(fraction, ImVec2(-1.0f, 0.0f), "");
-				ImGui::SetCursorPosY(ImGui::GetCursorPosY() - ImGui::GetFontSize() - style.FramePadding.y * 2);
-				ImGui::Text(" %d%%", (int)(fraction * 100));
-				break;
-			}
-		}
+		BuildMessageLog(CalCtx.messages);
 		ImGui::PopStyleColor();
 
-		if (CalCtx.state == CalibrationState::None)
+		if (CalCtx.state == CalibrationState::Rotation)
+			BuildCollectionMetrics(CalCtx.collection);
+		if (CalCtx.state == CalibrationState::Verifying)
+			BuildVerifyMetrics(CalCtx.verify);
+		else
+			BuildSampleView(CalCtx.sampleView, ImGui::GetTextLineHeightWithSpacing() * 14);
+
+		// Not before the button's command ran, the state is still the one from before it.
+		if (CalCtx.state == CalibrationState::None && !CommandPending())
 		{
 			ImGui::Text("");
-			if (ImGui::Button("Close", ImVec2(ImGui::GetWindowContentRegionWidth(), ImGui::GetTextLineHeight() * 2)))
+			float width = ImGui::GetWindowContentRegionWidth(), scale = 1.0f;
+			bool recalibrate = CalCtx.verifyVerdict == VerifyVerdict::Failed;
+			if (recalibrate)
+			{
+				width -= style.FramePadding.x * 2.0f;
+				scale = 0.5f;
+				if (ImGui::Button("Recalibrate", ImVec2(width * scale, ImGui::GetTextLineHeight() * 2)))
+				{
+					Post([](CalibrationContext &ctx) {
+						ctx.verifyVerdict = VerifyVerdict::None;
+						StartCalibration();
+						return true;
+					});
+				}
+				ImGui::SameLine();
+			}
+			if (ImGui::Button("Close", ImVec2(width * scale, ImGui::GetTextLineHeight() * 2)))
 				ImGui::CloseCurrentPopup();
 		}
 
@@ -214,6 +591,187 @@ void BuildMenu(bool runningInOverlay)
 	}
 }
 
+// A log line broken into rows the way TextWrapped would break it, offsets into its text.
+struct WrappedLogLine
+{
+	uint64_t sequence = 0;
+	size_t length = 0; // Of the text when it was wrapped, open lines grow.
+	std::vector<std::pair<uint32_t, uint32_t>> rows;
+};
+
+static void WrapLogLine(const MessageLog::Line &line, float width, WrappedLogLine &wrapped)
+{
+	wrapped.length = line.text.size();
+	wrapped.rows.clear();
+
+	// The bar goes one row down, as it did under an empty line of text.
+	if (line.type == MessageLog::Line::Progress || line.text.empty())
+	{
+		wrapped.rows.push_back({ 0, 0 });
+		if (line.type == MessageLog::Line::Progress)
+			wrapped.rows.push_back({ 0, 0 });
+		return;
+	}
+
+	ImFont *font = ImGui::GetFont();
+	float scale = ImGui::GetFontSize() / font->FontSize;
+	const char *text = line.text.c_str(), *end = text + line.text.size(), *s = text;
+	while (s < end)
+	{
+		const char *eol = font->CalcWordWrapPositionA(scale, s, end, width);
+		if (eol == s)
+			eol++; // Nothing fits, ImGui shows one character per row then.
+		wrapped.rows.push_back({ (uint32_t) (s - text), (uint32_t) (eol - text) });
+
+		// Blanks a row was broken at don't start the next one.
+		s = eol;
+		while (s < end && (*s == ' ' || *s == '\t'))
+			s++;
+	}
+}
+
+// Only the rows scrolled into view are submitted, and a line is only wrapped again when its
+// text or the width changes, so a log of thousands of rows costs what a screenful does.
+// BuildMessageLog's rows, rebuilt only when the log or the width changes.
+static struct
+{
+	struct Row
+	{
+		uint32_t line;
+		uint32_t begin, end;
+		bool bar;
+	};
+
+	std::vector<WrappedLogLine> wrapped; // One per line of messages.
+	std::vector<Row> rows;
+	uint64_t generation = 0;
+	float wrapWidth = -1.0f;
+} LogLayout;
+
+void ReleaseUICaches()
+{
+	std::vector<WrappedLogLine>().swap(LogLayout.wrapped);
+	decltype(LogLayout.rows)().swap(LogLayout.rows);
+	LogLayout.wrapWidth = -1.0f;
+}
+
+void BuildMessageLog(const MessageLog &messages)
+{
+	auto &wrapped = LogLayout.wrapped;
+	auto &rows = LogLayout.rows;
+	auto &generation = LogLayout.generation;
+	auto &wrapWidth = LogLayout.wrapWidth;
+
+	float width = ImGui::GetContentRegionAvail().x;
+	if (messages.Generation() != generation || width != wrapWidth)
+	{
+		std::vector<WrappedLogLine> previous;
+		previous.swap(wrapped);
+
+		size_t reused = 0;
+		for (size_t i = 0; i < messages.Size(); i++)
+		{
+			auto &line = messages[i];
+			uint64_t sequence = messages.Sequence(i);
+			while (reused < previous.size() && previous[reused].sequence < sequence)
+				reused++;
+
+			if (width == wrapWidth && reused < previous.size() && previous[reused].sequence == sequence && previous[reused].length == line.text.size())
+			{
+				wrapped.push_back(std::move(previous[reused]));
+				continue;
+			}
+
+			WrappedLogLine fresh;
+			fresh.sequence = sequence;
+			WrapLogLine(line, width, fresh);
+			wrapped.push_back(std::move(fresh));
+		}
+
+		rows.clear();
+		for (uint32_t i = 0; i < (uint32_t) wrapped.size(); i++)
+		{
+			bool progress = messages[i].type == MessageLog::Line::Progress;
+			for (size_t r = 0; r < wrapped[i].rows.size(); r++)
+				rows.push_back({ i, wrapped[i].rows[r].first, wrapped[i].rows[r].second, progress && r == 1 });
+		}
+
+		generation = messages.Generation();
+		wrapWidth = width;
+	}
+
+	// Every row is one line high, the bar is made to fit.
+	float rowHeight = ImGui::GetTextLineHeightWithSpacing();
+	ImGuiListClipper clipper((int) rows.size(), rowHeight);
+	while (clipper.Step())
+	{
+		for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
+		{
+			auto &row = rows[i];
+			auto &line = messages[row.line];
+			if (!row.bar)
+			{
+				const char *text = line.text.c_str();
+				ImGui::TextUnformatted(text + row.begin, text + row.end);
+				continue;
+			}
+
+			float fraction = (float) line.progress / (float) line.target;
+			ImGui::ProgressBar(fraction, ImVec2(-1.0f, ImGui::GetTextLineHeight()), "");
+			ImGui::SetCursorPosY(ImGui::GetCursorPosY() - rowHeight);
+			ImGui::Text(" %d%%", (int) (fraction * 100));
+		}
+	}
+}
+
+void BuildVerifyMetrics(const VerifyMetrics &metrics)
+{
+	if (!metrics.valid)
+		return;
+
+	ImGui::Text("");
+	ImGui::Text("Rotated: %.0f deg", metrics.rotated);
+	ImGui::Text("Position error (RMS): %.2f cm", metrics.positionError * 100.0);
+	ImGui::Text("Rotation error (RMS): %.2f deg", metrics.rotationError);
+	ImGui::Text("Drift: %.2f cm/s", metrics.drift);
+}
+
+// Below these the result is likely to be rejected, see ComputeSensitivity.
+static const double LowAxisCoverage = 0.15;
+static const double LowSensitivity = 0.2;
+
+void BuildCollectionMetrics(const CollectionMetrics &metrics)
+{
+	if (!metrics.valid)
+		return;
+
+	ImColor good(0.5f, 0.8f, 0.5f), bad(0.8f, 0.2f, 0.2f);
+
+	ImGui::Text("");
+	bool coverageOk = metrics.axisCoverage >= LowAxisCoverage;
+	ImGui::TextColored(coverageOk ? good : bad, "Rotation axis coverage: %d%%%s", (int) (metrics.axisCoverage * 100.0),
+		coverageOk ? "" : " - rotate around more directions");
+	ImGui::Text("Rotation axis directions seen: %d of %d", metrics.axisDirections, metrics.axisDirectionCount);
+	if (metrics.redundantSamples)
+	{
+		ImGui::SameLine();
+		ImGui::TextColored(ImColor(0.5f, 0.5f, 0.5f), "(%zu samples skipped, try new directions)", metrics.redundantSamples);
+	}
+	ImGui::Text("Rotation axis agreement (RMS): %.2f deg", metrics.axisError);
+
+	const char axisNames[] = "XYZ";
+	for (int axis = 0; axis < 3; axis++)
+	{
+		if (axis > 0)
+			ImGui::SameLine();
+		bool ok = metrics.sensitivity(axis) >= LowSensitivity;
+		ImGui::TextColored(ok ? good : bad, "Sensitivity %c: %.2f   ", axisNames[axis], metrics.sensitivity(axis));
+	}
+
+	if (metrics.positionError >= 0.0)
+		ImGui::Text("Position error of the last interim solve (RMS): %.3f", metrics.positionError);
+}
+
 void BuildSystemSelection(const VRState &state)
 {
 	if (state.trackingSystems.empty())
@@ -234,20 +792,20 @@ void BuildSystemSelection(const VRState &state)
 	int firstReferenceSystemNotTargetSystem = -1;
 
 	std::vector<const char *> referenceSystems;
-	for (auto &str : state.trackingSystems)
+	for (auto system : state.trackingSystems)
 	{
-		if (str == CalCtx.referenceTrackingSystem)
+		if (system == CalCtx.referenceTrackingSystem)
 		{
 			currentReferenceSystem = (int) referenceSystems.size();
 		}
-		else if (firstReferenceSystemNotTargetSystem == -1 && str != CalCtx.targetTrackingSystem)
+		else if (firstReferenceSystemNotTargetSystem == -1 && system != CalCtx.targetTrackingSystem)
 		{
 			firstReferenceSystemNotTargetSystem = (int) referenceSystems.size();
 		}
-		referenceSystems.push_back(str.c_str());
+		referenceSystems.push_back(InternedString(system).c_str());
 	}
 
-	if (currentReferenceSystem == -1 && CalCtx.referenceTrackingSystem == "")
+	if (currentReferenceSystem == -1 && CalCtx.referenceTrackingSystem == NoString)
 	{
 		currentReferenceSystem = firstReferenceSystemNotTargetSystem;
 	}
@@ -257,22 +815,24 @@ void BuildSystemSelection(const VRState &state)
 
 	if (currentReferenceSystem != -1 && currentReferenceSystem < (int) referenceSystems.size())
 	{
-		CalCtx.referenceTrackingSystem = std::string(referenceSystems[currentReferenceSystem]);
+		CalCtx.referenceTrackingSystem = state.trackingSystems[currentReferenceSystem];
 		if (CalCtx.referenceTrackingSystem == CalCtx.targetTrackingSystem)
-			CalCtx.targetTrackingSystem = "";
+			SelectTargetSystem(NoString);
 	}
 
-	if (CalCtx.targetTrackingSystem == "")
+	if (CalCtx.targetTrackingSystem == NoString)
 		currentTargetSystem = 0;
 
+	std::vector<StringID> targetSystemIDs;
 	std::vector<const char *> targetSystems;
-	for (auto &str : state.trackingSystems)
+	for (auto system : state.trackingSystems)
 	{
-		if (str != CalCtx.referenceTrackingSystem)
+		if (system != CalCtx.referenceTrackingSystem)
 		{
-			if (str != "" && str == CalCtx.targetTrackingSystem)
+			if (system != NoString && system == CalCtx.targetTrackingSystem)
 				currentTargetSystem = (int) targetSystems.size();
-			targetSystems.push_back(str.c_str());
+			targetSystemIDs.push_back(system);
+			targetSystems.push_back(InternedString(system).c_str());
 		}
 	}
 
@@ -281,9 +841,60 @@ void BuildSystemSelection(const VRState &state)
 
 	if (currentTargetSystem != -1 && currentTargetSystem < targetSystems.size())
 	{
-		CalCtx.targetTrackingSystem = std::string(targetSystems[currentTargetSystem]);
+		SelectTargetSystem(targetSystemIDs[currentTargetSystem]);
+	}
+
+	ImGui::PopItemWidth();
+	BuildCalibrateAgainstSelection();
+}
+
+// Whether the target's chain to the reference runs through the system, which couldn't then be
+// calibrated against it without closing a cycle.
+static bool ChainsThrough(const TargetProfile &target, StringID system)
+{
+	StringID parent = target.parentSystem;
+	for (size_t steps = 0; parent != NoString && steps <= CalCtx.otherTargets.size(); steps++)
+	{
+		if (parent == system)
+			return true;
+
+		auto next = std::find_if(CalCtx.otherTargets.begin(), CalCtx.otherTargets.end(), [parent](const TargetProfile &other) {
+			return other.trackingSystem == parent;
+		});
+		parent = next != CalCtx.otherTargets.end() ? next->parentSystem : NoString;
+	}
+	return false;
+}
+
+// Systems that share no device with the reference can be calibrated against another system
+// that is calibrated already, the transforms are chained through it.
+void BuildCalibrateAgainstSelection()
+{
+	std::vector<StringID> systems = { NoString };
+	std::vector<std::string> labels = { InternedString(CalCtx.referenceTrackingSystem) + " (reference)" };
+	for (auto &target : CalCtx.otherTargets)
+	{
+		if (target.trackingSystem == CalCtx.targetTrackingSystem || ChainsThrough(target, CalCtx.targetTrackingSystem))
+			continue;
+		systems.push_back(target.trackingSystem);
+		labels.push_back(InternedString(target.trackingSystem));
 	}
 
+	auto current = std::find(systems.begin(), systems.end(), CalCtx.calibrateAgainst);
+	int index = current != systems.end() ? (int) (current - systems.begin()) : 0;
+	CalCtx.calibrateAgainst = systems[index];
+	if (systems.size() < 2)
+		return;
+
+	std::vector<const char *> items;
+	for (auto &label : labels)
+		items.push_back(label.c_str());
+
+	TextWithWidth("CalibrateAgainstLabel", "Calibrate the target against", ImGui::GetWindowContentRegionWidth() / 2);
+	ImGui::SameLine();
+	ImGui::PushItemWidth(-1);
+	if (ImGui::Combo("##CalibrateAgainst", &index, &items[0], (int) items.size()))
+		CalCtx.calibrateAgainst = systems[index];
 	ImGui::PopItemWidth();
 }
 
@@ -309,24 +920,28 @@ std::string LabelString(const VRDevice &device)
 	else if (device.deviceClass == vr::TrackedDeviceClass_GenericTracker)
 		label = "Tracker";*/
 
-	AppendSeparated(label, device.model);
-	AppendSeparated(label, device.serial);
+	AppendSeparated(label, InternedString(device.model));
+	AppendSeparated(label, InternedString(device.serial));
 	return label;
 }
 
-void BuildDeviceSelection(const VRState &state, int &selected, const std::string &system)
+void BuildDeviceSelection(const VRState &state, int &selected, StringID system)
 {
-	ImGui::TextColored(ImColor(0.5f, 0.5f, 0.5f), "Devices from: %s", system.c_str());
+	ImGui::TextColored(ImColor(0.5f, 0.5f, 0.5f), "Devices from: %s", InternedString(system).c_str());
+
+	std::vector<const VRDevice *> devices;
+	for (auto &device : state.devices)
+	{
+		if (device.trackingSystem == system)
+			devices.push_back(&device);
+	}
 
 	if (selected != -1)
 	{
 		bool matched = false;
-		for (auto &device : state.devices)
+		for (auto device : devices)
 		{
-			if (device.trackingSystem != system)
-				continue;
-
-			if (selected == device.id)
+			if (selected == device->id)
 			{
 				matched = true;
 				break;
@@ -342,30 +957,31 @@ void BuildDeviceSelection(const VRState &state, int &selected, const std::string
 
 	if (selected == -1)
 	{
-		for (auto &device : state.devices)
+		for (auto device : devices)
 		{
-			if (device.trackingSystem != system)
-				continue;
-
-			if (device.controllerRole == vr::TrackedControllerRole_LeftHand)
+			if (device->controllerRole == vr::TrackedControllerRole_LeftHand)
 			{
-				selected = device.id;
+				selected = device->id;
 				break;
 			}
 		}
 	}
 
-	for (auto &device : state.devices)
-	{
-		if (device.trackingSystem != system)
-			continue;
-
-		if (selected == -1)
-			selected = device.id;
+	if (selected == -1 && !devices.empty())
+		selected = devices.front()->id;
 
-		auto label = LabelString(device);
-		if (ImGui::Selectable(label.c_str(), selected == device.id))
-			selected = device.id;
+	// Only the rows scrolled into the pane are submitted, a room may have dozens of devices.
+	ImGuiListClipper clipper((int) devices.size());
+	while (clipper.Step())
+	{
+		for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
+		{
+			auto device = devices[i];
+			ImGui::PushID(device->id);
+			if (ImGui::Selectable(device->label.c_str(), selected == device->id))
+				selected = device->id;
+			ImGui::PopID();
+		}
 	}
 }
 
@@ -373,30 +989,155 @@ void BuildDeviceSelections(const VRState &state)
 {
 	ImGuiStyle &style = ImGui::GetStyle();
 	ImVec2 paneSize(ImGui::GetWindowContentRegionWidth() / 2 - style.FramePadding.x, ImGui::GetTextLineHeightWithSpacing() * 5 + style.ItemSpacing.y * 4);
+	static int selectedRefDevice = -1;
+	static int selectedCalDevice = -1;
+
+	// A found pair is selected once, picking other devices by hand afterwards still works.
+	static uint32_t pairedRefDevice = -1, pairedCalDevice = -1;
+	uint32_t refDevice, calDevice;
+	double correlation;
+	bool paired = CalCtx.autoSelectDevices && AutoSelectedDevices(refDevice, calDevice, correlation);
+	if (paired && (refDevice != pairedRefDevice || calDevice != pairedCalDevice))
+	{
+		selectedRefDevice = pairedRefDevice = refDevice;
+		selectedCalDevice = pairedCalDevice = calDevice;
+	}
 
 	ImGui::BeginChild("left device pane", paneSize, true);
-	static int selectedRefDevice = -1;
-	BuildDeviceSelection(state, selectedRefDevice, CalCtx.referenceTrackingSystem);
+	BuildDeviceSelection(state, selectedRefDevice, CalCtx.SessionReferenceSystem());
 	CalCtx.referenceID = selectedRefDevice;
 	ImGui::EndChild();
 
 	ImGui::SameLine();
 
 	ImGui::BeginChild("right device pane", paneSize, true);
-	static int selectedCalDevice = -1;
 	BuildDeviceSelection(state, selectedCalDevice, CalCtx.targetTrackingSystem);
 	CalCtx.targetID = selectedCalDevice;
 	ImGui::EndChild();
 
 	if (ImGui::Button("Identify selected devices (blinks LED or vibrates)", ImVec2(ImGui::GetWindowContentRegionWidth(), ImGui::GetTextLineHeightWithSpacing() + 4.0f)))
 	{
-		for (unsigned i = 0; i < 100; ++i)
+		uint64_t mask = 0;
+		for (uint32_t id : { CalCtx.referenceID, CalCtx.targetID })
+		{
+			if (id < vr::k_unMaxTrackedDeviceCount)
+				mask |= 1ull << id;
+		}
+		for (auto ids : { &CalCtx.extraTargetIDs, &CalCtx.extraReferenceIDs })
 		{
-			vr::VRSystem()->TriggerHapticPulse(CalCtx.targetID, 0, 2000);
-			vr::VRSystem()->TriggerHapticPulse(CalCtx.referenceID, 0, 2000);
-			std::this_thread::sleep_for(std::chrono::milliseconds(5));
+			for (uint32_t id : *ids)
+			{
+				if (id < vr::k_unMaxTrackedDeviceCount)
+					mask |= 1ull << id;
+			}
 		}
+		IdentifyDevices(mask);
+	}
+
+	ImGui::Checkbox(" Select devices automatically by moving a reference and a target device together", &CalCtx.autoSelectDevices);
+	if (CalCtx.autoSelectDevices && CalCtx.state == CalibrationState::None)
+	{
+		if (paired)
+			ImGui::TextColored(ImColor(0.5f, 0.5f, 0.5f), "Devices moving together selected, correlation %.2f", correlation);
+		else
+			ImGui::TextColored(ImColor(0.5f, 0.5f, 0.5f), "Hold a device of each space together and turn them around");
 	}
+
+	BuildExtraTargetSelection(state);
+	BuildExtraReferenceSelection(state);
+}
+
+// One device per further tracking system, held along with the target during the same motion.
+void BuildExtraTargetSelection(const VRState &state)
+{
+	CalCtx.extraTargetIDs.clear();
+	if (state.trackingSystems.size() <= 2)
+		return;
+
+	static std::unordered_map<StringID, int> selected;
+	ImGui::TextColored(ImColor(0.5f, 0.5f, 0.5f), "Also calibrate in the same session:");
+
+	for (auto system : state.trackingSystems)
+	{
+		if (system == CalCtx.referenceTrackingSystem || system == CalCtx.SessionReferenceSystem() || system == CalCtx.targetTrackingSystem)
+			continue;
+
+		std::vector<int> ids = { -1 };
+		std::vector<std::string> labels = { "Not calibrated" };
+		for (auto &device : state.devices)
+		{
+			if (device.trackingSystem != system)
+				continue;
+			ids.push_back(device.id);
+			labels.push_back(device.label);
+		}
+
+		int current = 0;
+		auto existing = selected.find(system);
+		if (existing != selected.end())
+		{
+			auto match = std::find(ids.begin(), ids.end(), existing->second);
+			current = match != ids.end() ? (int) (match - ids.begin()) : 0;
+		}
+
+		std::vector<const char *> items;
+		for (auto &label : labels)
+			items.push_back(label.c_str());
+
+		std::string name = "##ExtraTarget" + InternedString(system);
+		TextWithWidth((name + "Label").c_str(), InternedString(system).c_str(), ImGui::GetWindowContentRegionWidth() / 4);
+		ImGui::SameLine();
+		ImGui::PushItemWidth(-1);
+		ImGui::Combo(name.c_str(), &current, &items[0], (int) items.size());
+		ImGui::PopItemWidth();
+
+		selected[system] = ids[current];
+		if (ids[current] != -1)
+			CalCtx.extraTargetIDs.push_back((uint32_t) ids[current]);
+	}
+}
+
+// Further devices of the reference's system, strapped to the reference device.
+void BuildExtraReferenceSelection(const VRState &state)
+{
+	CalCtx.extraReferenceIDs.clear();
+
+	std::vector<const VRDevice *> candidates;
+	for (auto &device : state.devices)
+	{
+		if (device.trackingSystem == CalCtx.SessionReferenceSystem() && (uint32_t) device.id != CalCtx.referenceID)
+			candidates.push_back(&device);
+	}
+	if (candidates.empty())
+		return;
+
+	static bool selected[vr::k_unMaxTrackedDeviceCount] = {};
+	ImGui::TextColored(ImColor(0.5f, 0.5f, 0.5f), "Average with reference devices on the same rig:");
+
+	for (auto device : candidates)
+	{
+		std::string label = " " + device->label + "##ExtraReference" + std::to_string(device->id);
+		ImGui::Checkbox(label.c_str(), &selected[device->id]);
+		if (selected[device->id])
+			CalCtx.extraReferenceIDs.push_back((uint32_t) device->id);
+	}
+}
+
+// Rebuilt from the device registry only when a device record has changed.
+const VRState &CachedVRState()
+{
+	static VRState state;
+	static uint32_t stateGeneration = 0;
+	static bool loaded = false;
+
+	if (!loaded || stateGeneration != Devices.generation)
+	{
+		ScopedTiming timing(TimingSection::LoadVRState);
+		state = LoadVRState();
+		stateGeneration = Devices.generation;
+		loaded = true;
+	}
+	return state;
 }
 
 VRState LoadVRState()
@@ -404,26 +1145,21 @@ VRState LoadVRState()
 	VRState state;
 	auto &trackingSystems = state.trackingSystems;
 
-	char buffer[vr::k_unMaxPropertyStringSize];
-
 	for (uint32_t id = 0; id < vr::k_unMaxTrackedDeviceCount; ++id)
 	{
-		vr::ETrackedPropertyError err = vr::TrackedProp_Success;
-		auto deviceClass = vr::VRSystem()->GetTrackedDeviceClass(id);
-		if (deviceClass == vr::TrackedDeviceClass_Invalid)
+		auto &info = Devices.devices[id];
+		if (!info.present)
 			continue;
 
-		if (deviceClass != vr::TrackedDeviceClass_TrackingReference)
+		if (info.deviceClass != vr::TrackedDeviceClass_TrackingReference)
 		{
-			vr::VRSystem()->GetStringTrackedDeviceProperty(id, vr::Prop_TrackingSystemName_String, buffer, vr::k_unMaxPropertyStringSize, &err);
-
-			if (err == vr::TrackedProp_Success)
+			if (info.hasTrackingSystem)
 			{
-				std::string system(buffer);
+				auto system = info.trackingSystem;
 				auto existing = std::find(trackingSystems.begin(), trackingSystems.end(), system);
 				if (existing != trackingSystems.end())
 				{
-					if (deviceClass == vr::TrackedDeviceClass_HMD)
+					if (info.deviceClass == vr::TrackedDeviceClass_HMD)
 					{
 						trackingSystems.erase(existing);
 						trackingSystems.insert(trackingSystems.begin(), system);
@@ -436,21 +1172,17 @@ VRState LoadVRState()
 
 				VRDevice device;
 				device.id = id;
-				device.deviceClass = deviceClass;
+				device.deviceClass = info.deviceClass;
 				device.trackingSystem = system;
-
-				vr::VRSystem()->GetStringTrackedDeviceProperty(id, vr::Prop_ModelNumber_String, buffer, vr::k_unMaxPropertyStringSize, &err);
-				device.model = std::string(buffer);
-
-				vr::VRSystem()->GetStringTrackedDeviceProperty(id, vr::Prop_SerialNumber_String, buffer, vr::k_unMaxPropertyStringSize, &err);
-				device.serial = std::string(buffer);
-
-				device.controllerRole = (vr::ETrackedControllerRole) vr::VRSystem()->GetInt32TrackedDeviceProperty(id, vr::Prop_ControllerRoleHint_Int32, &err);
+				device.model = info.model;
+				device.serial = info.serial;
+				device.controllerRole = info.controllerRole;
+				device.label = LabelString(device);
 				state.devices.push_back(device);
 			}
 			else
 			{
-				printf("failed to get tracking system name for id %d\n", id);
+				Events.Write(ClientEvent::TrackingSystemNameFailed, id);
 			}
 		}
 	}
@@ -458,11 +1190,212 @@ VRState LoadVRState()
 	return state;
 }
 
+// The devices other than the HMD, after an entry for none.
+static void LinkableDevices(std::vector<int> &ids, std::vector<std::string> &labels, const char *none)
+{
+	ids = { -1 };
+	labels = { none };
+	for (auto &device : CachedVRState().devices)
+	{
+		if (device.id == (int) vr::k_unTrackedDeviceIndex_Hmd)
+			continue;
+		ids.push_back(device.id);
+		labels.push_back(device.label);
+	}
+}
+
+static bool DeviceCombo(const char *id, const std::vector<int> &ids, const std::vector<std::string> &labels, int &device)
+{
+	int current = (int) (std::find(ids.begin(), ids.end(), device) - ids.begin());
+	if (current == (int) ids.size())
+		current = 0;
+
+	std::vector<const char *> items;
+	for (auto &label : labels)
+		items.push_back(label.c_str());
+
+	int selected = current;
+	if (!ImGui::Combo(id, &selected, &items[0], (int) items.size()) || selected == current)
+		return false;
+	device = ids[selected];
+	return true;
+}
+
+// A tracker mounted on a motion platform, whose motion comes out of the HMD and its controllers.
+void BuildMotionCompensation()
+{
+	std::vector<int> ids;
+	std::vector<std::string> labels;
+	LinkableDevices(ids, labels, "No motion platform");
+	int rig = CalCtx.motionRigID < vr::k_unMaxTrackedDeviceCount ? (int) CalCtx.motionRigID : -1;
+
+	TextWithWidth("MotionRigLabel", "Motion platform tracker", ImGui::GetWindowContentRegionWidth() / 4);
+	ImGui::SameLine();
+	ImGui::PushItemWidth(ImGui::GetWindowContentRegionWidth() / 2);
+	int selected = rig;
+	if (DeviceCombo("##MotionRig", ids, labels, selected))
+	{
+		uint32_t rigID = selected < 0 ? vr::k_unTrackedDeviceIndexInvalid : (uint32_t) selected;
+		Post([rigID](CalibrationContext &) { return SetMotionRig(rigID); });
+	}
+	ImGui::PopItemWidth();
+	if (ImGui::IsItemHovered())
+		ImGui::SetTooltip("The driver takes this tracker's motion out of the HMD's tracking system, start with the platform at rest");
+
+	if (rig >= 0 && std::find(ids.begin(), ids.end(), rig) != ids.end())
+	{
+		ImGui::SameLine();
+		if (ImGui::Button("Set neutral"))
+			Post([](CalibrationContext &ctx) { return SetMotionRig(ctx.motionRigID); });
+	}
+}
+
+static const char *const DeviceLinkModeNames[] = { "Fuse both", "Stand in while lost" };
+
+// Two devices on one body part, e.g. a tracker strapped to an inside-out controller, whose
+// tracking the driver fuses or which only carries the device while it is lost.
+void BuildDeviceLink()
+{
+	// Picked here before they are linked, the link itself is CalCtx's.
+	static int linked = -1, source = -1, mode = (int) DeviceLinkMode::Fuse;
+	if (CalCtx.linkedID < vr::k_unMaxTrackedDeviceCount)
+	{
+		linked = (int) CalCtx.linkedID;
+		source = (int) CalCtx.linkSourceID;
+		mode = (int) CalCtx.linkMode;
+	}
+
+	std::vector<int> ids;
+	std::vector<std::string> labels;
+	LinkableDevices(ids, labels, "No linked device");
+
+	TextWithWidth("DeviceLinkLabel", "Linked device", ImGui::GetWindowContentRegionWidth() / 4);
+	ImGui::SameLine();
+	ImGui::PushItemWidth(ImGui::GetWindowContentRegionWidth() / 5);
+	bool changed = DeviceCombo("##LinkedDevice", ids, labels, linked);
+	if (ImGui::IsItemHovered())
+		ImGui::SetTooltip("The driver carries this device on the other's tracking while it is lost, fusing the two if asked");
+
+	labels[0] = "Tracked with";
+	ImGui::SameLine();
+	changed |= DeviceCombo("##LinkSource", ids, labels, source);
+	ImGui::SameLine();
+	changed |= ImGui::Combo("##LinkMode", &mode, DeviceLinkModeNames, IM_ARRAYSIZE(DeviceLinkModeNames));
+	if (ImGui::IsItemHovered())
+		ImGui::SetTooltip("Fusing steadies the device all along, standing in leaves its tracking alone until it is lost");
+	ImGui::PopItemWidth();
+
+	bool valid = linked >= 0 && source >= 0 && linked != source;
+	bool active = CalCtx.linkedID < vr::k_unMaxTrackedDeviceCount;
+	if (changed && active)
+	{
+		uint32_t linkedID = valid ? (uint32_t) linked : vr::k_unTrackedDeviceIndexInvalid, sourceID = (uint32_t) source;
+		auto linkMode = (DeviceLinkMode) mode;
+		Post([linkedID, sourceID, linkMode](CalibrationContext &) { return SetDeviceLink(linkedID, sourceID, linkMode); });
+	}
+	else if (valid)
+	{
+		ImGui::SameLine();
+		if (ImGui::Button(active ? "Set offset##DeviceLink" : "Link##DeviceLink"))
+		{
+			uint32_t linkedID = (uint32_t) linked, sourceID = (uint32_t) source;
+			auto linkMode = (DeviceLinkMode) mode;
+			Post([linkedID, sourceID, linkMode](CalibrationContext &) { return SetDeviceLink(linkedID, sourceID, linkMode); });
+		}
+		if (ImGui::IsItemHovered())
+			ImGui::SetTooltip("Takes how the two are placed on the body now as their offset, both need to be tracking");
+	}
+}
+
+static const char *const NetworkPoseRoleNames[] = { "No external poses", "Stand in for reference", "Stand in for target" };
+
+// An external system's bridge sending poses straight here, see NetworkPoseSource.
+void BuildNetworkPoses()
+{
+	static int port = 27184, body = 1;
+	static bool failed = false;
+
+	TextWithWidth("NetworkPosesLabel", "External poses", ImGui::GetWindowContentRegionWidth() / 4);
+	ImGui::SameLine();
+	ImGui::PushItemWidth(ImGui::GetWindowContentRegionWidth() / 4);
+	int role = (int) CalCtx.networkPoseRole;
+	bool changed = ImGui::Combo("##NetworkPoseRole", &role, NetworkPoseRoleNames, IM_ARRAYSIZE(NetworkPoseRoleNames));
+	if (ImGui::IsItemHovered())
+		ImGui::SetTooltip("Poses of a motion capture rigid body, received over UDP, replace those of the selected device its bridge shows in SteamVR");
+	if (role != (int) NetworkPoseRole::None)
+	{
+		ImGui::SameLine();
+		changed |= ImGui::InputInt("Port##NetworkPoses", &port);
+		ImGui::SameLine();
+		changed |= ImGui::InputInt("Body##NetworkPoses", &body);
+	}
+	ImGui::PopItemWidth();
+
+	if (changed)
+	{
+		port = std::min(std::max(port, 1), 65535);
+		body = std::max(body, 0);
+		CalCtx.networkPoseRole = (NetworkPoseRole) role;
+		if (CalCtx.networkPoseRole == NetworkPoseRole::None)
+			NetworkPoses.Stop();
+		failed = CalCtx.networkPoseRole != NetworkPoseRole::None && !NetworkPoses.Start((uint16_t) port, (uint32_t) body);
+	}
+
+	if (failed)
+		ImGui::TextColored(ImColor(0.8f, 0.2f, 0.2f), "Couldn't listen for external poses on port %d", port);
+}
+
+// For scraping the station's health, see MetricsEndpoint.
+void BuildMetricsEndpoint()
+{
+	static bool loaded = false, enabled = false;
+	static int port = MetricsEndpoint::DefaultPort;
+	if (!loaded)
+	{
+		uint16_t saved = LoadMetricsPort();
+		enabled = saved != 0;
+		port = saved ? saved : MetricsEndpoint::DefaultPort;
+		loaded = true;
+	}
+
+	bool changed = ImGui::Checkbox(" Serve metrics for Prometheus", &enabled);
+	if (ImGui::IsItemHovered())
+		ImGui::SetTooltip("At http://<this machine>:<port>/metrics, reachable from the network");
+	if (enabled)
+	{
+		ImGui::SameLine();
+		ImGui::PushItemWidth(ImGui::GetWindowContentRegionWidth() / 4);
+		changed |= ImGui::InputInt("Port##Metrics", &port);
+		ImGui::PopItemWidth();
+	}
+
+	if (changed)
+	{
+		port = std::min(std::max(port, 1), 65535);
+		SaveMetricsPort(enabled ? (uint16_t) port : 0);
+		Metrics.Start(enabled ? (uint16_t) port : 0);
+	}
+
+	if (enabled && !Metrics.IsRunning())
+		ImGui::TextColored(ImColor(0.8f, 0.2f, 0.2f), "Couldn't serve metrics on port %d", port);
+}
+
 void BuildProfileEditor()
 {
 	ImGuiStyle &style = ImGui::GetStyle();
 	float width = ImGui::GetWindowContentRegionWidth() / 3.0f - style.FramePadding.x;
 	float widthF = width - style.FramePadding.x;
+	bool changed = false, rotated = false;
+
+	// The angles are converted again only when the rotation changed elsewhere, so stepping one
+	// of them never flips the others to an equivalent set.
+	static Eigen::Vector3d euler = Eigen::Vector3d::Zero();
+	static Eigen::Quaterniond shown = Eigen::Quaterniond::Identity();
+	if (CalCtx.calibratedRotation.coeffs() != shown.coeffs())
+	{
+		shown = CalCtx.calibratedRotation;
+		euler = EulerFromQuat(shown);
+	}
 
 	TextWithWidth("YawLabel", "Yaw", width);
 	ImGui::SameLine();
@@ -471,11 +1404,16 @@ void BuildProfileEditor()
 	TextWithWidth("RollLabel", "Roll", width);
 
 	ImGui::PushItemWidth(widthF);
-	ImGui::InputDouble("##Yaw", &CalCtx.calibratedRotation(1), 0.1, 1.0, "%.8f");
+	rotated |= ImGui::InputDouble("##Yaw", &euler(1), 0.1, 1.0, "%.8f");
 	ImGui::SameLine();
-	ImGui::InputDouble("##Pitch", &CalCtx.calibratedRotation(2), 0.1, 1.0, "%.8f");
+	rotated |= ImGui::InputDouble("##Pitch", &euler(2), 0.1, 1.0, "%.8f");
 	ImGui::SameLine();
-	ImGui::InputDouble("##Roll", &CalCtx.calibratedRotation(0), 0.1, 1.0, "%.8f");
+	rotated |= ImGui::InputDouble("##Roll", &euler(0), 0.1, 1.0, "%.8f");
+	if (rotated)
+	{
+		CalCtx.calibratedRotation = shown = EulerQuat(euler);
+		changed = true;
+	}
 
 	TextWithWidth("XLabel", "X", width);
 	ImGui::SameLine();
@@ -483,16 +1421,280 @@ void BuildProfileEditor()
 	ImGui::SameLine();
 	TextWithWidth("ZLabel", "Z", width);
 
-	ImGui::InputDouble("##X", &CalCtx.calibratedTranslation(0), 1.0, 10.0, "%.8f");
+	changed |= ImGui::InputDouble("##X", &CalCtx.calibratedTranslation(0), 1.0, 10.0, "%.8f");
 	ImGui::SameLine();
-	ImGui::InputDouble("##Y", &CalCtx.calibratedTranslation(1), 1.0, 10.0, "%.8f");
+	changed |= ImGui::InputDouble("##Y", &CalCtx.calibratedTranslation(1), 1.0, 10.0, "%.8f");
 	ImGui::SameLine();
-	ImGui::InputDouble("##Z", &CalCtx.calibratedTranslation(2), 1.0, 10.0, "%.8f");
+	changed |= ImGui::InputDouble("##Z", &CalCtx.calibratedTranslation(2), 1.0, 10.0, "%.8f");
 
 	TextWithWidth("ScaleLabel", "Scale", width);
 
-	ImGui::InputDouble("##Scale", &CalCtx.calibratedScale, 0.0001, 0.01, "%.8f");
+	changed |= ImGui::InputDouble("##Scale", &CalCtx.calibratedScale, 0.0001, 0.01, "%.8f");
+	ImGui::PopItemWidth();
+
+	if (changed)
+		ProfileEdited(Devices.TrackingSystemMask(CalCtx.targetTrackingSystem));
+}
+
+// Edits the offset of the selected target device, layered on top of the system's calibration.
+void BuildDeviceOffsetEditor()
+{
+	if (CalCtx.targetID >= vr::k_unMaxTrackedDeviceCount)
+		return;
+
+	auto &device = Devices.devices[CalCtx.targetID];
+	if (!device.present || device.serial == NoString)
+		return;
+
+	DeviceOffset offset;
+	auto existing = CalCtx.deviceOffsets.find(device.serial);
+	if (existing != CalCtx.deviceOffsets.end())
+		offset = existing->second;
+
+	ImGuiStyle &style = ImGui::GetStyle();
+	float width = ImGui::GetWindowContentRegionWidth() / 3.0f - style.FramePadding.x;
+	float widthF = width - style.FramePadding.x;
+	bool changed = false;
+
+	ImGui::Text("");
+	ImGui::Text("Offset for %s only", InternedString(device.serial).c_str());
+
+	TextWithWidth("OffsetYawLabel", "Yaw", width);
+	ImGui::SameLine();
+	TextWithWidth("OffsetPitchLabel", "Pitch", width);
+	ImGui::SameLine();
+	TextWithWidth("OffsetRollLabel", "Roll", width);
+
+	ImGui::PushItemWidth(widthF);
+	changed |= ImGui::InputDouble("##OffsetYaw", &offset.rotation(1), 0.1, 1.0, "%.8f");
+	ImGui::SameLine();
+	changed |= ImGui::InputDouble("##OffsetPitch", &offset.rotation(2), 0.1, 1.0, "%.8f");
+	ImGui::SameLine();
+	changed |= ImGui::InputDouble("##OffsetRoll", &offset.rotation(0), 0.1, 1.0, "%.8f");
+
+	TextWithWidth("OffsetXLabel", "X", width);
+	ImGui::SameLine();
+	TextWithWidth("OffsetYLabel", "Y", width);
+	ImGui::SameLine();
+	TextWithWidth("OffsetZLabel", "Z", width);
+
+	changed |= ImGui::InputDouble("##OffsetX", &offset.translation(0), 0.1, 1.0, "%.8f");
+	ImGui::SameLine();
+	changed |= ImGui::InputDouble("##OffsetY", &offset.translation(1), 0.1, 1.0, "%.8f");
+	ImGui::SameLine();
+	changed |= ImGui::InputDouble("##OffsetZ", &offset.translation(2), 0.1, 1.0, "%.8f");
+	ImGui::PopItemWidth();
+
+	if (!changed)
+		return;
+
+	if (offset.rotation.isZero(0.0) && offset.translation.isZero(0.0))
+		CalCtx.deviceOffsets.erase(device.serial);
+	else
+		CalCtx.deviceOffsets[device.serial] = offset;
+
+	ProfileEdited(DeviceBit(CalCtx.targetID));
+}
+
+static void FormatProfileVersion(char *buf, size_t size, const ProfileHistory::Version &version)
+{
+	time_t saved = (time_t) version.time;
+	tm local;
+	if (localtime_s(&local, &saved) != 0 || !strftime(buf, size, "%Y-%m-%d %H:%M:%S", &local))
+		snprintf(buf, size, "%lld", (long long) version.time);
+}
+
+// Rolls the profile back to one saved before, e.g. when a recalibration came out worse.
+void BuildProfileHistory()
+{
+	static std::vector<ProfileHistory::Version> versions;
+	static int selected = -1; // Into versions, which lists the newest last.
+	static uint32_t listedCompactions = 0; // Of the history when versions was listed.
+	static bool wasOpen = false;
+	static std::string error;
+
+	char preview[64] = "Pick a saved profile";
+	if (selected >= 0 && selected < (int) versions.size())
+		FormatProfileVersion(preview, sizeof preview, versions[selected]);
+
+	TextWithWidth("ProfileHistoryLabel", "Profile history", ImGui::GetWindowContentRegionWidth() / 4);
+	ImGui::SameLine();
+	ImGui::PushItemWidth(ImGui::GetWindowContentRegionWidth() / 2);
+
+	// Only listed again when opened, the history's lock is shared with the profile writer.
+	bool open = ImGui::BeginCombo("##ProfileHistory", preview);
+	if (open)
+	{
+		if (!wasOpen)
+		{
+			auto &history = Profiles.History();
+			uint32_t compactions = history.Compactions();
+			if (compactions != listedCompactions)
+				selected = -1;
+			listedCompactions = compactions;
+			versions = history.Versions();
+		}
+
+		for (int i = (int) versions.size() - 1; i >= 0; i--)
+		{
+			char label[64];
+			FormatProfileVersion(label, sizeof label, versions[i]);
+			ImGui::PushID(i);
+			if (ImGui::Selectable(label, selected == i))
+				selected = i;
+			ImGui::PopID();
+		}
+		ImGui::EndCombo();
+	}
+	wasOpen = open;
 	ImGui::PopItemWidth();
+
+	ImGui::SameLine();
+	if (ImGui::Button("Restore##ProfileHistory") && selected >= 0)
+	{
+		// A save since the list was made may have compacted the history, the index would pick
+		// another version then.
+		if (Profiles.History().Compactions() != listedCompactions)
+		{
+			selected = -1;
+			error = "the history was compacted, pick the version again";
+		}
+		else
+		{
+			try
+			{
+				RestoreProfileVersion(CalCtx, (size_t) selected);
+				ProfileEdited(AllDevicesMask);
+				error.clear();
+			}
+			catch (std::runtime_error &e)
+			{
+				error = e.what();
+			}
+		}
+	}
+
+	if (!error.empty())
+		ImGui::TextColored(ImColor(0.8f, 0.2f, 0.2f), "Couldn't restore the profile: %s", error.c_str());
+}
+
+static const char *const ProfileSyncModeNames[] = { "Off", "Publish", "Subscribe", "Publish and subscribe" };
+
+// Stations of a venue on one channel get each other's profiles, see ProfileSync.
+void BuildProfileSharing()
+{
+	static bool loaded = false;
+	static int mode = ProfileSyncOff, channel = 0;
+	static char key[128] = "";
+	if (!loaded)
+	{
+		uint32_t savedMode, savedChannel;
+		LoadProfileSyncSettings(savedMode, savedChannel);
+		mode = (int) savedMode;
+		channel = (int) savedChannel;
+		snprintf(key, sizeof key, "%s", LoadProfileSyncKey().c_str());
+		loaded = true;
+	}
+
+	TextWithWidth("ProfileSharingLabel", "Share with stations", ImGui::GetWindowContentRegionWidth() / 4);
+	ImGui::SameLine();
+	ImGui::PushItemWidth(ImGui::GetWindowContentRegionWidth() / 4);
+	bool changed = ImGui::Combo("##ProfileSyncMode", &mode, ProfileSyncModeNames, IM_ARRAYSIZE(ProfileSyncModeNames));
+	ImGui::SameLine();
+	changed |= ImGui::InputInt("Channel##ProfileSync", &channel);
+	ImGui::SameLine();
+	bool keyChanged = ImGui::InputText("Key##ProfileSync", key, sizeof key, ImGuiInputTextFlags_Password | ImGuiInputTextFlags_EnterReturnsTrue);
+	if (ImGui::IsItemHovered())
+		ImGui::SetTooltip("Shared by every station of the venue, press Enter to use it");
+	ImGui::PopItemWidth();
+
+	if (changed || keyChanged)
+	{
+		channel = std::max(channel, 0);
+		SaveProfileSyncSettings((uint32_t) mode, (uint32_t) channel);
+		if (keyChanged)
+			SaveProfileSyncKey(key);
+		SharedProfiles.Start((uint32_t) mode, (uint32_t) channel, key);
+	}
+
+	if (SharedProfiles.Mode() & ProfileSyncPublish)
+	{
+		ImGui::SameLine();
+		if (ImGui::Button("Push to stations"))
+			ShareProfile(CalCtx);
+		if (ImGui::IsItemHovered())
+			ImGui::SetTooltip("Sends the whole profile, for stations that joined after it was saved");
+	}
+	else if (mode != ProfileSyncOff && SharedProfiles.Mode() == ProfileSyncOff)
+	{
+		if (!key[0])
+			ImGui::TextColored(ImColor(0.8f, 0.2f, 0.2f), "Enter the key all stations share to start profile sharing");
+		else
+			ImGui::TextColored(ImColor(0.8f, 0.2f, 0.2f), "Couldn't open the network for profile sharing");
+	}
+}
+
+static const char *const AnchorStatusNames[] = { "aligned", "anchor not tracking", "anchor moved" };
+
+// Co-location: every station aligns its play space to the one anchor they all see.
+void BuildSharedAnchor()
+{
+	auto &state = CachedVRState();
+	std::vector<StringID> serials = { NoString };
+	std::vector<const char *> items = { "No shared anchor" };
+	int current = 0;
+	for (auto &device : state.devices)
+	{
+		if (device.id == (int) vr::k_unTrackedDeviceIndex_Hmd || device.serial == NoString)
+			continue;
+		if (device.serial == CalCtx.anchorSerial)
+			current = (int) serials.size();
+		serials.push_back(device.serial);
+		items.push_back(device.label.c_str());
+	}
+
+	TextWithWidth("SharedAnchorLabel", "Shared anchor", ImGui::GetWindowContentRegionWidth() / 4);
+	ImGui::SameLine();
+	ImGui::PushItemWidth(ImGui::GetWindowContentRegionWidth() / 2);
+	int selected = current;
+	if (ImGui::Combo("##SharedAnchor", &selected, &items[0], (int) items.size()) && selected != current)
+	{
+		CalCtx.anchorSerial = serials[selected];
+		SaveAnchorSerial(InternedString(CalCtx.anchorSerial));
+	}
+	ImGui::PopItemWidth();
+	if (ImGui::IsItemHovered())
+		ImGui::SetTooltip("A resting device every station sees, their play spaces meet at it");
+
+	if (CalCtx.anchorSerial == NoString)
+		return;
+
+	ImGui::SameLine();
+	if (AnchorAlignmentRunning())
+		ImGui::Text("Measuring...");
+	else if (ImGui::Button("Align"))
+		Post([](CalibrationContext &) { return StartAnchorAlignment(); });
+
+	if (!(SharedProfiles.Mode() & ProfileSyncPublish))
+		return;
+
+	ImGui::SameLine();
+	if (ImGui::Button("Align all stations") && !AnchorAlignmentRunning())
+	{
+		Post([](CalibrationContext &) {
+			SharedProfiles.RequestAnchorAlignment();
+			return StartAnchorAlignment();
+		});
+	}
+
+	for (auto &report : SharedProfiles.AnchorReports())
+	{
+		const char *status = report.status >= 0 && report.status < IM_ARRAYSIZE(AnchorStatusNames) ? AnchorStatusNames[report.status] : "unknown";
+		if (report.status == AnchorAligned)
+			ImGui::Text("%s: %s, %.1f mm spread", report.host.c_str(), status, report.spread * 1000.0);
+		else
+			ImGui::TextColored(ImColor(0.8f, 0.2f, 0.2f), "%s: %s", report.host.c_str(), status);
+	}
 }
 
 void TextWithWidth(const char *label, const char *text, float width)
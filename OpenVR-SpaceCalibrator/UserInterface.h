@@ -1,3 +1,5 @@
 #pragma once
 
-void BuildMainWindow(bool runningInOverlay);
\ No newline at end of file
+void BuildMainWindow(bool runningInOverlay);
+// Frees what the UI keeps between frames to avoid rebuilding it, see lowMemory.
+void ReleaseUICaches();
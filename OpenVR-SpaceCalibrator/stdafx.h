@@ -3,6 +3,7 @@
 #include "targetver.h"
 
 #define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
 #include <windows.h>
 
 #include <stdlib.h>
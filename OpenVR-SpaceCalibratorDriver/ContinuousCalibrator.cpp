@@ -0,0 +1,459 @@
+#include "ContinuousCalibrator.h"
+#include "Logging.h"
+#include "ThreadQoS.h"
+
+#include <algorithm>
+#include <cmath>
+
+// Same spacing, quality floor, pacing and correction rate as the client's continuous mode.
+static const double SampleInterval = 0.02; // seconds of pose time
+static const double MinSampleQuality = 0.25;
+static const DWORD PollInterval = 10; // ms
+static const uint64_t SolveInterval = 5000; // ms
+static const uint64_t MaxSolveInterval = 60000; // ms, while the drift model predicts well
+static const double RotationThreshold = 0.5; // degrees
+static const double TranslationThreshold = 0.5; // cm
+static const double CorrectionRate = 0.5;
+
+// The drift model is a constant rate fitted to the last few solves. It needs enough of them
+// over enough time to tell drift from noise, and rates beyond the limits are taken for jumps.
+static const size_t MaxDriftPoints = 8;
+static const size_t MinDriftPoints = 3;
+static const double MinDriftSpan = 20.0; // seconds
+static const double MaxAngularDrift = 0.5 * EIGEN_PI / 180.0; // rad/s
+static const double MaxLinearDrift = 0.005; // m/s
+
+static double Now()
+{
+	static double frequency = 0;
+	if (frequency == 0)
+	{
+		LARGE_INTEGER f;
+		QueryPerformanceFrequency(&f);
+		frequency = (double) f.QuadPart;
+	}
+
+	LARGE_INTEGER now;
+	QueryPerformanceCounter(&now);
+	return (double) now.QuadPart / frequency;
+}
+
+static Eigen::Quaterniond ToEigen(const vr::HmdQuaternion_t &q)
+{
+	return Eigen::Quaterniond(q.w, q.x, q.y, q.z);
+}
+
+static Eigen::Vector3d ToEigen(const vr::HmdVector3d_t &v)
+{
+	return Eigen::Vector3d(v.v[0], v.v[1], v.v[2]);
+}
+
+static vr::HmdQuaternion_t ToOpenVR(const Eigen::Quaterniond &q)
+{
+	return { q.w(), q.x(), q.y(), q.z() };
+}
+
+static vr::HmdVector3d_t ToOpenVR(const Eigen::Vector3d &v)
+{
+	return { v(0), v(1), v(2) };
+}
+
+static Pose PoseFromCapture(const protocol::PoseCaptureSample &sample)
+{
+	return Pose(ToEigen(sample.rotation).toRotationMatrix(), Eigen::Vector3d(sample.position[0], sample.position[1], sample.position[2]));
+}
+
+static double CapturedPoseQuality(const protocol::PoseCaptureSample &pose)
+{
+	return PoseQuality(pose.valid && pose.trackingResult == vr::TrackingResult_Running_OK, pose.linearSpeed, pose.angularSpeed);
+}
+
+void ContinuousCalibrator::Recent::Push(const protocol::PoseCaptureSample &sample)
+{
+	if (!poses.empty() && sample.timestamp <= poses.back().timestamp)
+		return;
+
+	poses.push_back(sample);
+	if (poses.size() > Capacity)
+		poses.pop_front();
+}
+
+bool ContinuousCalibrator::Recent::Interpolate(double time, protocol::PoseCaptureSample &out) const
+{
+	if (poses.size() < 2 || time < poses.front().timestamp || time > poses.back().timestamp)
+		return false;
+
+	size_t after = 1;
+	while (poses[after].timestamp < time)
+		after++;
+
+	const auto &a = poses[after - 1], &b = poses[after];
+	if (!a.valid || !b.valid)
+		return false;
+
+	double t = (time - a.timestamp) / (b.timestamp - a.timestamp);
+	out = b;
+	out.timestamp = time;
+	for (int i = 0; i < 3; i++)
+		out.position[i] = a.position[i] + (b.position[i] - a.position[i]) * t;
+	out.rotation = ToOpenVR(ToEigen(a.rotation).slerp(t, ToEigen(b.rotation)));
+	out.linearSpeed = a.linearSpeed + (b.linearSpeed - a.linearSpeed) * t;
+	out.angularSpeed = a.angularSpeed + (b.angularSpeed - a.angularSpeed) * t;
+	if (a.trackingResult != vr::TrackingResult_Running_OK)
+		out.trackingResult = a.trackingResult;
+	return true;
+}
+
+void ContinuousCalibrator::Init(protocol::SharedMemory *sharedMemory, PoseQueue *poseQueue)
+{
+	shared = sharedMemory;
+	poses = poseQueue;
+}
+
+void ContinuousCalibrator::Stop()
+{
+	std::lock_guard<std::mutex> lock(controlMutex);
+	StopThread();
+}
+
+void ContinuousCalibrator::StopThread()
+{
+	if (!thread.joinable())
+		return;
+
+	SetEvent(stopEvent);
+	thread.join();
+	CloseHandle(stopEvent);
+	stopEvent = nullptr;
+
+	// The engine is gone, the devices keep what was predicted so far and stop moving.
+	ClearDrift();
+
+	captureMask = 0;
+	running = false;
+	LOG("Stopped continuous calibration");
+}
+
+void ContinuousCalibrator::Configure(const protocol::SetContinuousCalibration &newConfig)
+{
+	std::lock_guard<std::mutex> lock(controlMutex);
+	StopThread();
+
+	if (!newConfig.enabled || !shared || !poses)
+		return;
+
+	if (newConfig.referenceID >= vr::k_unMaxTrackedDeviceCount || newConfig.targetID >= vr::k_unMaxTrackedDeviceCount || newConfig.windowSize < 2)
+	{
+		LOG("Invalid continuous calibration settings: reference %d, target %d, window %d", newConfig.referenceID, newConfig.targetID, newConfig.windowSize);
+		return;
+	}
+
+	stopEvent = CreateEvent(nullptr, FALSE, FALSE, nullptr);
+	if (!stopEvent)
+		return;
+
+	config = newConfig;
+	reference.poses.clear();
+	target.poses.clear();
+	nextSampleTime = 0;
+	window.clear();
+	workspace.Reserve(config.windowSize);
+	lastAccepted = Sample();
+	samplesSinceSolve = 0;
+	timeLastSolve = GetTickCount64();
+	solveInterval = SolveInterval;
+
+	driftHistory.clear();
+	appliedRotation.setIdentity();
+	appliedTranslation.setZero();
+	angularDrift.setZero();
+	linearDrift.setZero();
+	driftEpoch = Now();
+	driftPublished = false;
+
+	// Poses queued before now belong to whatever the devices were doing back then. The
+	// engine thread isn't running, so this is the only consumer.
+	poses->Discard();
+
+	{
+		std::lock_guard<std::mutex> statusLock(statusMutex);
+		pendingRotation = { 1, 0, 0, 0 };
+		pendingTranslation = { 0, 0, 0 };
+		pendingCorrections = 0;
+		windowSamples = 0;
+	}
+
+	captureMask = (1ull << config.referenceID) | (1ull << config.targetID);
+	running = true;
+	thread = std::thread(&ContinuousCalibrator::Run, this);
+	LOG("Started continuous calibration, reference %d, target %d, window of %d samples", config.referenceID, config.targetID, config.windowSize);
+}
+
+void ContinuousCalibrator::TakeStatus(protocol::ContinuousCalibrationStatus &status)
+{
+	std::lock_guard<std::mutex> lock(statusMutex);
+	status.running = running;
+	status.corrections = pendingCorrections;
+	status.samples = windowSamples;
+	status.rotation = pendingRotation;
+	status.translation = pendingTranslation;
+
+	pendingRotation = { 1, 0, 0, 0 };
+	pendingTranslation = { 0, 0, 0 };
+	pendingCorrections = 0;
+}
+
+void ContinuousCalibrator::Run()
+{
+	// Solving takes a while, poses and the rest of the server come first.
+	SetCurrentThreadRole(L"SpaceCalibrator continuous calibration", ThreadRole::Background);
+
+	while (WaitForSingleObject(stopEvent, PollInterval) == WAIT_TIMEOUT)
+	{
+		poses->Drain([&](const protocol::PoseCaptureSample &captured) { Process(captured); });
+
+		if (window.size() >= config.windowSize &&
+			samplesSinceSolve >= config.windowSize / 2 &&
+			GetTickCount64() - timeLastSolve >= solveInterval)
+		{
+			Solve();
+		}
+	}
+}
+
+void ContinuousCalibrator::Process(const protocol::PoseCaptureSample &captured)
+{
+	if (captured.openVRID == config.referenceID)
+		reference.Push(captured);
+	else if (captured.openVRID == config.targetID)
+		target.Push(captured);
+	else
+		return;
+
+	if (reference.poses.empty() || target.poses.empty())
+		return;
+
+	double begin = std::max(reference.poses.front().timestamp, target.poses.front().timestamp);
+	double end = std::min(reference.poses.back().timestamp, target.poses.back().timestamp);
+	nextSampleTime = std::max(nextSampleTime, begin);
+
+	for (; nextSampleTime <= end; nextSampleTime += SampleInterval)
+	{
+		protocol::PoseCaptureSample referencePose, targetPose;
+		if (!reference.Interpolate(nextSampleTime, referencePose) || !target.Interpolate(nextSampleTime, targetPose))
+			continue;
+
+		double quality = std::min(CapturedPoseQuality(referencePose), CapturedPoseQuality(targetPose));
+		Sample sample(PoseFromCapture(referencePose), PoseFromCapture(targetPose), quality);
+		if (quality < MinSampleQuality || !MovedEnough(lastAccepted, sample))
+			continue;
+
+		lastAccepted = sample;
+		window.push_back(sample);
+		if (window.size() > config.windowSize)
+			window.pop_front();
+		samplesSinceSolve++;
+
+		std::lock_guard<std::mutex> lock(statusMutex);
+		windowSamples = (uint32_t) window.size();
+	}
+}
+
+void ContinuousCalibrator::Solve()
+{
+	samplesSinceSolve = 0;
+	timeLastSolve = GetTickCount64();
+
+	// Samples hold the target's raw poses, the solve runs on them as the target currently
+	// appears, so its result is what's left to correct. Exact while the target's driver
+	// reports no world-from-driver translation, which is the usual case.
+	auto tf = shared->transforms.ReadLayer(config.targetID);
+	Eigen::Matrix3d rotation = Eigen::Matrix3d::Identity();
+	Eigen::Vector3d translation = Eigen::Vector3d::Zero();
+	double scale = 1.0;
+	if (tf.enabled)
+	{
+		rotation = ToEigen(tf.rotation).toRotationMatrix();
+		translation = ToEigen(tf.translation);
+		scale = tf.scale;
+	}
+
+	auto &samples = workspace.samples;
+	samples.assign(window.begin(), window.end());
+	for (auto &sample : samples)
+	{
+		sample.target.rot = rotation * sample.target.rot;
+		sample.target.trans = scale * rotation * sample.target.trans + translation;
+	}
+
+	workspace.rotations.Assign(samples);
+	RotationAccumulator pairs = AccumulateAllRotationPairs(workspace.rotations);
+	// Only rotation and translation drift are followed, like the client's continuous mode.
+	auto solution = SolveCalibration(workspace, pairs, false);
+	if (solution.reject)
+	{
+		TRACE(protocol::TraceTransforms, "Continuous calibration rejected a solve, position error %.2f mm", solution.positionError * 1000.0);
+		return;
+	}
+
+	// The solve measured the correction still needed on top of the transforms as written,
+	// the drift model has already shown part of it.
+	double now = Now();
+	Eigen::Matrix3d measuredRotation = EulerQuat(solution.rotation).toRotationMatrix();
+	Eigen::Vector3d measuredTranslation = solution.translation / 100.0;
+
+	Eigen::Matrix3d predictedRotation;
+	Eigen::Vector3d predictedTranslation;
+	PredictedDrift(now, predictedRotation, predictedTranslation);
+
+	Eigen::Matrix3d residualRotation = measuredRotation * predictedRotation.transpose();
+	Eigen::Vector3d residualTranslation = measuredTranslation - residualRotation * predictedTranslation;
+
+	driftHistory.push_back({ now, measuredRotation * appliedRotation, measuredRotation * appliedTranslation + measuredTranslation });
+	if (driftHistory.size() > MaxDriftPoints)
+		driftHistory.pop_front();
+	FitDrift();
+
+	double rotationDrift = Eigen::AngleAxisd(residualRotation).angle() * 180.0 / EIGEN_PI;
+	double translationDrift = residualTranslation.norm() * 100.0;
+	bool correct = rotationDrift >= RotationThreshold || translationDrift >= TranslationThreshold;
+
+	// Solves are spaced out further for as long as the prediction keeps up on its own.
+	solveInterval = correct ? SolveInterval : std::min(solveInterval * 2, MaxSolveInterval);
+
+	// Move part of the way each time, so a single noisy window can't make the space jump.
+	Eigen::Matrix3d correctionRotation = Eigen::Matrix3d::Identity();
+	Eigen::Vector3d correctionTranslation = Eigen::Vector3d::Zero();
+	if (correct)
+	{
+		LOG("Continuous calibration drift: rotation %.2f deg, translation %.2f cm, correcting", rotationDrift, translationDrift);
+		correctionRotation = Eigen::Quaterniond::Identity().slerp(CorrectionRate, Eigen::Quaterniond(residualRotation)).toRotationMatrix();
+		correctionTranslation = residualTranslation * CorrectionRate;
+	}
+
+	// The prediction so far goes into the transforms, the new model starts from there.
+	ApplyCorrection(correctionRotation * predictedRotation, correctionRotation * predictedTranslation + correctionTranslation, now);
+}
+
+/**
+ * Least squares line through the total corrections over time, rotations taken as rotation
+ * vectors relative to the latest one. A point p moved by the drift rotation changes at
+ * angularDrift x p on top of linearDrift, which is taken back out of the translation's slope.
+ */
+void ContinuousCalibrator::FitDrift()
+{
+	angularDrift.setZero();
+	linearDrift.setZero();
+
+	if (driftHistory.size() < MinDriftPoints || driftHistory.back().time - driftHistory.front().time < MinDriftSpan)
+		return;
+
+	const auto &latest = driftHistory.back();
+	double meanTime = 0;
+	Eigen::Vector3d meanRotation = Eigen::Vector3d::Zero(), meanTranslation = Eigen::Vector3d::Zero();
+	std::vector<Eigen::Vector3d> rotations;
+	for (auto &point : driftHistory)
+	{
+		Eigen::AngleAxisd relative(point.rotation * latest.rotation.transpose());
+		rotations.push_back(relative.angle() * relative.axis());
+		meanTime += point.time;
+		meanRotation += rotations.back();
+		meanTranslation += point.translation;
+	}
+	meanTime /= driftHistory.size();
+	meanRotation /= (double) driftHistory.size();
+	meanTranslation /= (double) driftHistory.size();
+
+	double timeVariance = 0;
+	Eigen::Vector3d rotationSlope = Eigen::Vector3d::Zero(), translationSlope = Eigen::Vector3d::Zero();
+	for (size_t i = 0; i < driftHistory.size(); i++)
+	{
+		double dt = driftHistory[i].time - meanTime;
+		timeVariance += dt * dt;
+		rotationSlope += dt * (rotations[i] - meanRotation);
+		translationSlope += dt * (driftHistory[i].translation - meanTranslation);
+	}
+	rotationSlope /= timeVariance;
+	translationSlope /= timeVariance;
+
+	Eigen::Vector3d linear = translationSlope - rotationSlope.cross(meanTranslation);
+	if (rotationSlope.norm() > MaxAngularDrift || linear.norm() > MaxLinearDrift)
+	{
+		TRACE(protocol::TraceTransforms, "Continuous calibration ignoring drift of %.3f deg/s, %.3f cm/s", rotationSlope.norm() * 180.0 / EIGEN_PI, linear.norm() * 100.0);
+		return;
+	}
+
+	angularDrift = rotationSlope;
+	linearDrift = linear;
+}
+
+// The same extrapolation the pose hook applies, see protocol::DeviceTransform.
+void ContinuousCalibrator::PredictedDrift(double time, Eigen::Matrix3d &rotation, Eigen::Vector3d &translation) const
+{
+	double elapsed = std::max(0.0, std::min(time - driftEpoch, protocol::MaxDriftExtrapolation));
+	double angle = angularDrift.norm() * elapsed;
+	rotation = angle > 0.0 ? Eigen::AngleAxisd(angle, angularDrift.normalized()).toRotationMatrix() : Eigen::Matrix3d::Identity();
+	translation = linearDrift * elapsed;
+}
+
+void ContinuousCalibrator::ClearDrift()
+{
+	if (angularDrift.isZero() && linearDrift.isZero())
+		return;
+
+	double now = Now();
+	Eigen::Matrix3d rotation;
+	Eigen::Vector3d translation;
+	PredictedDrift(now, rotation, translation);
+
+	angularDrift.setZero();
+	linearDrift.setZero();
+	ApplyCorrection(rotation, translation, now);
+}
+
+void ContinuousCalibrator::ApplyCorrection(const Eigen::Matrix3d &rotation, const Eigen::Vector3d &translation, double time)
+{
+	bool drifting = !angularDrift.isZero() || !linearDrift.isZero();
+	driftEpoch = time;
+	if (rotation.isIdentity() && translation.isZero() && !drifting && !driftPublished)
+		return;
+
+	// Devices without a transform aren't part of the calibrated space.
+	protocol::SetDeviceTransformBatch batch;
+	batch.count = 0;
+	for (uint32_t id = 0; id < vr::k_unMaxTrackedDeviceCount; id++)
+	{
+		if (!(config.correctMask & (1ull << id)))
+			continue;
+
+		// Read first, so a device that disconnects after its transform was read doesn't get it.
+		uint32_t generation = shared->transforms.Generation(id);
+		auto tf = shared->transforms.ReadLayer(id);
+		if (!tf.enabled)
+			continue;
+
+		Eigen::Quaterniond corrected = Eigen::Quaterniond(rotation) * ToEigen(tf.rotation);
+		Eigen::Vector3d moved = rotation * ToEigen(tf.translation) + translation;
+
+		auto &update = batch.transforms[batch.count++];
+		update = protocol::SetDeviceTransform(id, true, ToOpenVR(moved), ToOpenVR(corrected.normalized()));
+		update.generation = generation;
+		update.updateDrift = true;
+		update.angularDrift = ToOpenVR(angularDrift);
+		update.linearDrift = ToOpenVR(linearDrift);
+		update.driftEpoch = time;
+	}
+
+	if (batch.count == 0 || !shared->transforms.Write(batch.transforms, batch.count))
+		return;
+
+	driftPublished = drifting;
+	appliedRotation = rotation * appliedRotation;
+	appliedTranslation = rotation * appliedTranslation + translation;
+
+	std::lock_guard<std::mutex> lock(statusMutex);
+	Eigen::Quaterniond pending = Eigen::Quaterniond(rotation) * ToEigen(pendingRotation);
+	pendingTranslation = ToOpenVR(rotation * ToEigen(pendingTranslation) + translation);
+	pendingRotation = ToOpenVR(pending.normalized());
+	pendingCorrections++;
+}
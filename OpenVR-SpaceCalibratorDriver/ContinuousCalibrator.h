@@ -0,0 +1,102 @@
+#pragma once
+
+#include "../Protocol.h"
+#include "PoseQueue.h"
+#include "../CalibrationSolver/CalibrationSolver.h"
+
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+/**
+ * Continuous calibration run inside the driver, on a low priority thread of its own. Pairs
+ * the reference and target poses from the pose queue, re-solves over a sliding window and
+ * nudges the transforms of the configured devices straight in the shared transform table, so
+ * a correction reaches the next pose update without a round trip through the client. The
+ * client picks up what was applied with TakeStatus to keep its profile in step.
+ */
+class ContinuousCalibrator
+{
+public:
+	~ContinuousCalibrator() { Stop(); }
+
+	void Init(protocol::SharedMemory *shared, PoseQueue *poses);
+	void Stop();
+
+	// From the IPC threads. Restarts the engine with the new settings, or stops it.
+	void Configure(const protocol::SetContinuousCalibration &config);
+
+	// Devices whose poses the engine needs captured, read by the pose hook.
+	uint64_t CaptureMask() const { return captureMask.load(std::memory_order_relaxed); }
+
+	// Returns the corrections applied since the previous call and starts accumulating anew.
+	void TakeStatus(protocol::ContinuousCalibrationStatus &status);
+
+private:
+	void StopThread();
+	void Run();
+	void Process(const protocol::PoseCaptureSample &captured);
+	void Solve();
+	void FitDrift();
+	void ClearDrift();
+	void PredictedDrift(double time, Eigen::Matrix3d &rotation, Eigen::Vector3d &translation) const;
+	void ApplyCorrection(const Eigen::Matrix3d &rotation, const Eigen::Vector3d &translation, double time);
+
+	// The few most recent poses of a device, enough to bracket a sample time.
+	struct Recent
+	{
+		static const size_t Capacity = 64;
+		std::deque<protocol::PoseCaptureSample> poses;
+
+		void Push(const protocol::PoseCaptureSample &sample);
+		bool Interpolate(double time, protocol::PoseCaptureSample &out) const;
+	};
+
+	protocol::SharedMemory *shared = nullptr;
+	PoseQueue *poses = nullptr; // Drained by the engine thread only.
+
+	// Serializes starting and stopping the thread.
+	std::mutex controlMutex;
+	std::thread thread;
+	HANDLE stopEvent = nullptr;
+	std::atomic<bool> running{false};
+	std::atomic<uint64_t> captureMask{0};
+
+	// Set up before the thread starts and only touched by it afterwards.
+	protocol::SetContinuousCalibration config = {};
+	Recent reference, target;
+	double nextSampleTime = 0;
+	std::deque<Sample> window;
+	SolveWorkspace workspace; // Reserved for the window, kept across restarts.
+	Sample lastAccepted;
+	size_t samplesSinceSolve = 0;
+	uint64_t timeLastSolve = 0;
+	uint64_t solveInterval = 0; // ms, grows while the drift model keeps predicting well.
+
+	// Drift model, see FitDrift. Each point is the total correction an accepted solve found
+	// necessary since the engine started, times in seconds on the QueryPerformanceCounter clock.
+	struct DriftPoint
+	{
+		double time;
+		Eigen::Matrix3d rotation;
+		Eigen::Vector3d translation;
+	};
+	std::deque<DriftPoint> driftHistory;
+	Eigen::Matrix3d appliedRotation; // Total correction written into the transforms so far.
+	Eigen::Vector3d appliedTranslation;
+	Eigen::Vector3d angularDrift, linearDrift; // Published with the transforms, rad/s and m/s.
+	double driftEpoch = 0;
+	bool driftPublished = false; // The transforms carry a non-zero model that has to be cleared.
+
+	// Guarded by statusMutex.
+	std::mutex statusMutex;
+	// Kept in OpenVR types, an aligned Eigen quaternion member would need an aligned allocation.
+	vr::HmdQuaternion_t pendingRotation = { 1, 0, 0, 0 };
+	vr::HmdVector3d_t pendingTranslation = { 0, 0, 0 };
+	uint32_t pendingCorrections = 0;
+	uint32_t windowSamples = 0;
+};
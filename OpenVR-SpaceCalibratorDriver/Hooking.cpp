@@ -1,27 +1,70 @@
 #include "Hooking.h"
 
-std::map<std::string, IHook *> IHook::hooks;
-
-bool IHook::Exists(const std::string &name)
-{
-	return hooks.find(name) != hooks.end();
-}
+IHook *IHook::hooks[IHook::MaxHooks];
+int IHook::hookCount = 0;
 
 void IHook::Register(IHook *hook)
 {
-	hooks[hook->name] = hook;
+	if (hook->registered)
+		return;
+
+	if (hookCount == MaxHooks)
+	{
+		LOG("Too many hooks, can't register %s", hook->name);
+		return;
+	}
+
+	hooks[hookCount++] = hook;
+	hook->registered = true;
 }
 
 void IHook::Unregister(IHook *hook)
 {
-	hooks.erase(hook->name);
+	for (int i = 0; i < hookCount; i++)
+	{
+		if (hooks[i] == hook)
+		{
+			hooks[i] = hooks[--hookCount];
+			hook->registered = false;
+			return;
+		}
+	}
 }
 
 void IHook::DestroyAll()
 {
-	for (auto &hook : hooks)
+	for (int i = 0; i < hookCount; i++)
+	{
+		hooks[i]->Destroy();
+		hooks[i]->registered = false;
+	}
+	hookCount = 0;
+}
+
+// Vtables are in read-only data, and often share a page with code. Other threads keep calling
+// through the slot while it changes, so the pointer is swapped in one atomic store. It's only
+// swapped if it still holds what this hook left there, so a hook someone else put in the same
+// slot since then is left alone.
+bool IHook::SwapVTableSlot(void **slot, void *expected, void *desired, const char *name)
+{
+	MEMORY_BASIC_INFORMATION info;
+	const DWORD executable = PAGE_EXECUTE | PAGE_EXECUTE_READ | PAGE_EXECUTE_READWRITE | PAGE_EXECUTE_WRITECOPY;
+	bool code = VirtualQuery(slot, &info, sizeof info) == sizeof info && (info.Protect & executable);
+
+	DWORD protection;
+	if (!VirtualProtect(slot, sizeof *slot, code ? PAGE_EXECUTE_READWRITE : PAGE_READWRITE, &protection))
+	{
+		LOG("Failed to unprotect the vtable slot of %s, error: %d", name, GetLastError());
+		return false;
+	}
+
+	void *previous = InterlockedCompareExchangePointer((PVOID volatile *) slot, desired, expected);
+	VirtualProtect(slot, sizeof *slot, protection, &protection);
+
+	if (previous != expected)
 	{
-		hook.second->Destroy();
+		LOG("The vtable slot of %s was changed by someone else, leaving it as it is", name);
+		return false;
 	}
-	hooks.clear();
+	return true;
 }
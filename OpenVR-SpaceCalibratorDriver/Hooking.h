@@ -2,35 +2,53 @@
 
 #include "Logging.h"
 #include <MinHook.h>
-#include <map>
-#include <string>
 
+// How a hook gets to its detour. Inline patches the target's first instructions to jump there,
+// and the original is called through a MinHook trampoline. VTableSlot points the object's
+// vtable entry at the detour instead, so the original is called directly and nothing is
+// patched in code, but only calls through that vtable are caught.
+enum class HookMethod
+{
+	Inline,
+	VTableSlot,
+};
+
+// Hooks are static objects, so they're tracked in a fixed table instead of by name.
 class IHook
 {
 public:
-	const std::string name;
+	const char *const name;
 
-	IHook(const std::string &name) : name(name) { }
+	IHook(const char *name) : name(name) { }
 	virtual ~IHook() { }
 
 	virtual void Destroy() = 0;
 
-	static bool Exists(const std::string &name);
+	bool IsRegistered() const { return registered; }
+
 	static void Register(IHook *hook);
 	static void Unregister(IHook *hook);
 	static void DestroyAll();
 
+protected:
+	static bool SwapVTableSlot(void **slot, void *expected, void *desired, const char *name);
+
 private:
-	static std::map<std::string, IHook *> hooks;
+	bool registered = false;
+
+	static const int MaxHooks = 8;
+	static IHook *hooks[MaxHooks];
+	static int hookCount;
 };
 
 template<class FuncType> class Hook : public IHook
 {
 public:
 	FuncType originalFunc = nullptr;
-	Hook(const std::string &name) : IHook(name) { }
+	Hook(const char *name) : IHook(name) { }
 
-	bool CreateHookInObjectVTable(void *object, int vtableOffset, void *detourFunction)
+	// A hook created without enabling it is in place for SetEnabled.
+	bool CreateHookInObjectVTable(void *object, int vtableOffset, void *detourFunction, bool enable = true, HookMethod method = HookMethod::Inline)
 	{
 		// For virtual objects, VC++ adds a pointer to the vtable as the first member.
 		// To access the vtable, we simply dereference the object.
@@ -40,36 +58,96 @@ public:
 		// in the order they were declared in.
 		targetFunc = vtable[vtableOffset];
 
+		if (method == HookMethod::VTableSlot)
+		{
+			slot = &vtable[vtableOffset];
+			detourFunc = detourFunction;
+			originalFunc = (FuncType) targetFunc;
+			created = true;
+			if (enable && !SetEnabled(true))
+			{
+				created = false;
+				slot = nullptr;
+				return false;
+			}
+
+			LOG("%s hook for %s in its vtable slot", enable ? "Enabled" : "Created", name);
+			return true;
+		}
+
 		auto err = MH_CreateHook(targetFunc, detourFunction, (LPVOID *)&originalFunc);
 		if (err != MH_OK)
 		{
-			LOG("Failed to create hook for %s, error: %s", name.c_str(), MH_StatusToString(err));
+			LOG("Failed to create hook for %s, error: %s", name, MH_StatusToString(err));
 			return false;
 		}
 
+		if (!enable)
+		{
+			LOG("Created hook for %s, disabled", name);
+			created = true;
+			return true;
+		}
+
 		err = MH_EnableHook(targetFunc);
 		if (err != MH_OK)
 		{
-			LOG("Failed to enable hook for %s, error: %s", name.c_str(), MH_StatusToString(err));
+			LOG("Failed to enable hook for %s, error: %s", name, MH_StatusToString(err));
 			MH_RemoveHook(targetFunc);
 			return false;
 		}
 
-		LOG("Enabled hook for %s", name.c_str());
-		enabled = true;
+		LOG("Enabled hook for %s", name);
+		created = enabled = true;
+		return true;
+	}
+
+	// Patches the target again or restores its original code. MinHook moves threads out of the
+	// patched bytes while it does, and the trampoline stays until Destroy, so a detour that is
+	// already running still reaches originalFunc afterwards. A vtable slot hook swaps the slot
+	// back and forth, and originalFunc is the target itself.
+	bool SetEnabled(bool enable)
+	{
+		if (!created || enable == enabled)
+			return true;
+
+		if (slot)
+		{
+			if (!SwapVTableSlot(slot, enable ? targetFunc : detourFunc, enable ? detourFunc : targetFunc, name))
+				return false;
+			enabled = enable;
+			return true;
+		}
+
+		auto err = enable ? MH_EnableHook(targetFunc) : MH_DisableHook(targetFunc);
+		if (err != MH_OK)
+		{
+			LOG("Failed to %s hook for %s, error: %s", enable ? "enable" : "disable", name, MH_StatusToString(err));
+			return false;
+		}
+
+		enabled = enable;
 		return true;
 	}
 
 	void Destroy()
 	{
-		if (enabled)
+		if (created && slot)
+		{
+			SetEnabled(false);
+			slot = nullptr;
+			created = enabled = false;
+		}
+		else if (created)
 		{
 			MH_RemoveHook(targetFunc);
-			enabled = false;
+			created = enabled = false;
 		}
 	}
 
 private:
-	bool enabled = false;
+	bool created = false, enabled = false;
 	void* targetFunc = nullptr;
+	void **slot = nullptr; // With HookMethod::VTableSlot.
+	void *detourFunc = nullptr;
 };
\ No newline at end of file
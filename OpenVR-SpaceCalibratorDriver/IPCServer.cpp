@@ -1,25 +1,134 @@
 #include "IPCServer.h"
 #include "Logging.h"
 #include "ServerTrackedDeviceProvider.h"
+#include "ThreadQoS.h"
+#include "../Instrumentation.h"
 
 void IPCServer::HandleRequest(const protocol::Request &request, protocol::Response &response)
 {
+	SPACECAL_ZONE("IPCServer::HandleRequest");
+
+	// The response buffer is reused per pipe, so don't let a previous result leak into this one.
+	response.type = protocol::ResponseInvalid;
+	response.id = request.id;
+	response.size = 0;
+
 	switch (request.type)
 	{
 	case protocol::RequestHandshake:
+		// The client only uses what both ends announce, so its capabilities are just logged.
+		if (request.size == sizeof request.protocol)
+			LOG("Client connected, protocol %d, capabilities 0x%x", request.protocol.version, request.protocol.capabilities);
+		driver->ClientConnected();
 		response.type = protocol::ResponseHandshake;
-		response.protocol.version = protocol::Version;
+		response.protocol = protocol::Protocol();
+		response.size = sizeof response.protocol;
 		break;
 
 	case protocol::RequestSetDeviceTransform:
+		if (request.size != sizeof request.setDeviceTransform)
+		{
+			LOG("Invalid transform request size: %d", request.size);
+			break;
+		}
 		driver->SetDeviceTransform(request.setDeviceTransform);
 		response.type = protocol::ResponseSuccess;
 		break;
 
+	case protocol::RequestSetDeviceTransformBatch:
+		if (request.size < sizeof request.setDeviceTransformBatch.count ||
+			request.setDeviceTransformBatch.count > protocol::MaxBatchTransforms ||
+			request.size != request.setDeviceTransformBatch.PayloadSize())
+		{
+			LOG("Invalid transform batch size: %d", request.size);
+			break;
+		}
+		driver->SetDeviceTransforms(request.setDeviceTransformBatch);
+		response.type = protocol::ResponseSuccess;
+		break;
+
+	case protocol::RequestSetTrackingSystemRules:
+		if (request.size < sizeof request.setTrackingSystemRules.count ||
+			request.setTrackingSystemRules.count > protocol::MaxTrackingSystemRules ||
+			request.size != request.setTrackingSystemRules.PayloadSize())
+		{
+			LOG("Invalid tracking system rules size: %d", request.size);
+			break;
+		}
+		driver->SetTrackingSystemRules(request.setTrackingSystemRules);
+		response.type = protocol::ResponseSuccess;
+		break;
+
+	case protocol::RequestSetContinuousCalibration:
+		if (request.size != sizeof request.setContinuousCalibration)
+		{
+			LOG("Invalid continuous calibration size: %d", request.size);
+			break;
+		}
+		driver->SetContinuousCalibration(request.setContinuousCalibration);
+		response.type = protocol::ResponseSuccess;
+		break;
+
+	case protocol::RequestContinuousCalibrationStatus:
+		driver->GetContinuousCalibrationStatus(response.continuousCalibrationStatus);
+		response.type = protocol::ResponseContinuousCalibrationStatus;
+		response.size = sizeof response.continuousCalibrationStatus;
+		break;
+
+	case protocol::RequestPoseHookStats:
+		driver->GetPoseHookStats(response.poseHookStats);
+		response.type = protocol::ResponsePoseHookStats;
+		response.size = sizeof response.poseHookStats;
+		break;
+
+	case protocol::RequestSetPoseFilters:
+		if (request.size != sizeof request.setPoseFilters || !driver->SetPoseFilters(request.setPoseFilters))
+		{
+			LOG("Invalid pose filter request, size %d", request.size);
+			break;
+		}
+		response.type = protocol::ResponseSuccess;
+		break;
+
+	case protocol::RequestSetPoseHookMode:
+		if (request.size != sizeof request.setPoseHookMode || request.setPoseHookMode.mode > protocol::PoseHookWhenNeeded)
+		{
+			LOG("Invalid pose hook mode request, size %d", request.size);
+			break;
+		}
+		driver->SetPoseHookMode(request.setPoseHookMode);
+		response.type = protocol::ResponseSuccess;
+		break;
+
+	case protocol::RequestGetDeviceTransforms:
+		driver->GetDeviceTransforms(response.deviceTransforms);
+		response.type = protocol::ResponseDeviceTransforms;
+		response.size = sizeof response.deviceTransforms;
+		break;
+
+	case protocol::RequestDriverStats:
+	{
+		auto &stats = response.driverStats;
+		driver->GetPoseHookStats(stats.poseHook);
+		stats.requestsHandled = requestsHandled.load(std::memory_order_relaxed) + 1; // Counting this one.
+		stats.invalidRequests = invalidRequests.load(std::memory_order_relaxed);
+		uint32_t clients = connectedClients.load(std::memory_order_relaxed);
+		stats.pipeInstances = clients + (clients < PipeInstanceCount ? 1 : 0);
+		stats.reserved = 0;
+		driver->GetPoseRates(stats.poseRates);
+		response.type = protocol::ResponseDriverStats;
+		response.size = sizeof response.driverStats;
+		break;
+	}
+
 	default:
 		LOG("Invalid IPC request: %d", request.type);
 		break;
 	}
+
+	requestsHandled.fetch_add(1, std::memory_order_relaxed);
+	if (response.type == protocol::ResponseInvalid)
+		invalidRequests.fetch_add(1, std::memory_order_relaxed);
 }
 
 IPCServer::~IPCServer()
@@ -29,192 +138,295 @@ IPCServer::~IPCServer()
 
 void IPCServer::Run()
 {
-	mainThread = std::thread(RunThread, this);
+	stop = false;
+
+	completionPort = CreateIoCompletionPort(INVALID_HANDLE_VALUE, nullptr, 0, 0);
+	if (!completionPort)
+	{
+		LOG("CreateIoCompletionPort failed in Run. Error: %d", GetLastError());
+		return;
+	}
+
+	unsigned workerCount = std::thread::hardware_concurrency() / 2;
+	workerCount = workerCount < 2 ? 2 : (workerCount > 4 ? 4 : workerCount);
+
+	if (!CreatePipeInstances())
+	{
+		CloseHandle(completionPort);
+		completionPort = nullptr;
+		return;
+	}
+
+	for (unsigned i = 0; i < workerCount; i++)
+		workers.push_back(std::thread(RunWorker, this));
+
+	running = true;
+	for (size_t i = 0; i < PipeInstanceCount; i++)
+		StartConnect(&pipes[i]);
 }
 
 void IPCServer::Stop()
 {
-	TRACE("IPCServer::Stop()");
+	TRACE(protocol::TraceIPC, "IPCServer::Stop()");
 	if (!running)
 		return;
 
 	stop = true;
-	SetEvent(connectEvent);
-	mainThread.join();
-	running = false;
-	TRACE("IPCServer::Stop() finished");
-}
 
-IPCServer::PipeInstance *IPCServer::CreatePipeInstance(HANDLE pipe)
-{
-	auto pipeInst = new PipeInstance;
-	pipeInst->pipe = pipe;
-	pipeInst->server = this;
-	pipes.insert(pipeInst);
-	return pipeInst;
-}
+	for (size_t i = 0; i < PipeInstanceCount; i++)
+	{
+		if (pipes[i].pipe != INVALID_HANDLE_VALUE)
+			CancelIoEx(pipes[i].pipe, nullptr);
+	}
 
-void IPCServer::ClosePipeInstance(PipeInstance *pipeInst)
-{
-	DisconnectNamedPipe(pipeInst->pipe);
-	CloseHandle(pipeInst->pipe);
-	pipes.erase(pipeInst);
-	delete pipeInst;
-}
+	// A null overlapped tells a worker to exit.
+	for (size_t i = 0; i < workers.size(); i++)
+		PostQueuedCompletionStatus(completionPort, 0, 0, nullptr);
 
-void IPCServer::RunThread(IPCServer *_this)
-{
-	_this->running = true;
-	LPTSTR pipeName = TEXT(OPENVR_SPACECALIBRATOR_PIPE_NAME);
+	for (auto &worker : workers)
+		worker.join();
+	workers.clear();
 
-	HANDLE connectEvent = _this->connectEvent = CreateEvent(0, TRUE, TRUE, 0);
-	if (!connectEvent)
+	// Whatever the workers didn't get to, wait for the cancelled I/O before closing the pipes.
+	// Cancel again in case a worker started an operation after the first pass. The instances'
+	// buffers are kept for the next Run.
+	for (size_t i = 0; i < PipeInstanceCount; i++)
 	{
-		LOG("CreateEvent failed in RunThread. Error: %d", GetLastError());
-		return;
+		auto &pipeInst = pipes[i];
+		if (pipeInst.pipe == INVALID_HANDLE_VALUE)
+			continue;
+
+		DWORD bytesTransferred;
+		CancelIoEx(pipeInst.pipe, nullptr);
+		GetOverlappedResult(pipeInst.pipe, &pipeInst.overlap, &bytesTransferred, TRUE);
+		DisconnectNamedPipe(pipeInst.pipe);
+		CloseHandle(pipeInst.pipe);
+		pipeInst.pipe = INVALID_HANDLE_VALUE;
+		pipeInst.connected = false;
 	}
+	connectedClients = 0;
 
-	OVERLAPPED connectOverlap;
-	connectOverlap.hEvent = connectEvent;
+	CloseHandle(completionPort);
+	completionPort = nullptr;
+	running = false;
+	TRACE(protocol::TraceIPC, "IPCServer::Stop() finished");
+}
 
-	HANDLE nextPipe;
-	BOOL connectPending = CreateAndConnectInstance(&connectOverlap, nextPipe);
+// All of the pool's pipes are created before any worker runs. If one can't be, the server
+// doesn't start rather than running with fewer instances than it listens on.
+bool IPCServer::CreatePipeInstances()
+{
+	if (!pipes)
+		pipes.reset(new PipeInstance[PipeInstanceCount]);
 
-	while (!_this->stop)
+	for (size_t i = 0; i < PipeInstanceCount; i++)
 	{
-		DWORD wait = WaitForSingleObjectEx(connectEvent, INFINITE, TRUE);
-
-		if (_this->stop)
+		HANDLE pipe = CreatePipeInstance();
+		if (pipe == INVALID_HANDLE_VALUE)
 		{
-			break;
-		}
-		else if (wait == 0)
-		{
-			// When connectPending is false, the last call to CreateAndConnectInstance
-			// picked up a connected client and triggered this event, so we can simply
-			// create a new pipe instance for it. If true, the client was still pending
-			// connection when CreateAndConnectInstance returned, so this event was triggered
-			// internally and we need to flush out the result, or something like that.
-			if (connectPending)
+			for (size_t j = 0; j < i; j++)
 			{
-				DWORD bytesConnect;
-				BOOL success = GetOverlappedResult(nextPipe, &connectOverlap, &bytesConnect, FALSE);
-				if (!success)
-				{
-					LOG("GetOverlappedResult failed in RunThread. Error: %d", GetLastError());
-					return;
-				}
+				CloseHandle(pipes[j].pipe);
+				pipes[j].pipe = INVALID_HANDLE_VALUE;
 			}
-
-			LOG("IPC client connected");
-
-			auto pipeInst = _this->CreatePipeInstance(nextPipe);
-			CompletedWriteCallback(0, sizeof protocol::Response, (LPOVERLAPPED) pipeInst);
-
-			connectPending = CreateAndConnectInstance(&connectOverlap, nextPipe);
-		}
-		else if (wait != WAIT_IO_COMPLETION)
-		{
-			printf("WaitForSingleObjectEx failed in RunThread. Error %d", GetLastError());
-			return;
+			return false;
 		}
-	}
 
-	for (auto &pipeInst : _this->pipes)
-	{
-		_this->ClosePipeInstance(pipeInst);
+		pipes[i].pipe = pipe;
+		pipes[i].connected = false;
 	}
-	_this->pipes.clear();
+	return true;
 }
 
-BOOL IPCServer::CreateAndConnectInstance(LPOVERLAPPED overlap, HANDLE &pipe)
+// One instance of the pipe on the completion port, INVALID_HANDLE_VALUE if it can't be made.
+HANDLE IPCServer::CreatePipeInstance()
 {
-	pipe = CreateNamedPipe(
+	HANDLE pipe = CreateNamedPipe(
 		TEXT(OPENVR_SPACECALIBRATOR_PIPE_NAME),
 		PIPE_ACCESS_DUPLEX | FILE_FLAG_OVERLAPPED,
 		PIPE_TYPE_MESSAGE | PIPE_READMODE_MESSAGE | PIPE_WAIT,
-		PIPE_UNLIMITED_INSTANCES,
-		sizeof protocol::Request,
-		sizeof protocol::Response,
+		PipeInstanceCount,
+		protocol::MaxMessageSize,
+		protocol::MaxMessageSize,
 		1000,
 		0
 	);
 
 	if (pipe == INVALID_HANDLE_VALUE)
-	{
 		LOG("CreateNamedPipe failed. Error: %d", GetLastError());
-		return FALSE;
+	else if (!CreateIoCompletionPort(pipe, completionPort, 0, 0))
+	{
+		LOG("CreateIoCompletionPort failed for pipe. Error: %d", GetLastError());
+		CloseHandle(pipe);
+		pipe = INVALID_HANDLE_VALUE;
 	}
+	return pipe;
+}
 
-	ConnectNamedPipe(pipe, overlap);
-
-	switch(GetLastError())
+// Disconnects the client, if any, and puts the instance back to listening for the next one.
+void IPCServer::ClosePipeInstance(PipeInstance *pipeInst)
+{
+	if (pipeInst->connected)
 	{
-	case ERROR_IO_PENDING:
-		// Mark a pending connection by returning true, and when the connection
-		// completes an event will trigger automatically.
-		return TRUE;
-
-	case ERROR_PIPE_CONNECTED:
-		// Signal the event loop that a client is connected.
-		if (SetEvent(overlap->hEvent))
-			return FALSE;
+		pipeInst->connected = false;
+		connectedClients.fetch_sub(1, std::memory_order_relaxed);
 	}
-
-	LOG("ConnectNamedPipe failed. Error: %d", GetLastError());
-	return FALSE;
+	DisconnectNamedPipe(pipeInst->pipe);
+	StartConnect(pipeInst);
 }
 
-void IPCServer::CompletedReadCallback(DWORD err, DWORD bytesRead, LPOVERLAPPED overlap)
+void IPCServer::RunWorker(IPCServer *_this)
 {
-	PipeInstance *pipeInst = (PipeInstance *) overlap;
-	BOOL success = FALSE;
+	SetCurrentThreadRole(L"SpaceCalibrator IPC worker", ThreadRole::IPC);
+
+	while (true)
+	{
+		DWORD bytesTransferred = 0;
+		ULONG_PTR key;
+		LPOVERLAPPED overlap = nullptr;
+
+		BOOL success = GetQueuedCompletionStatus(_this->completionPort, &bytesTransferred, &key, &overlap, INFINITE);
+		if (!overlap)
+		{
+			if (!success)
+				LOG("GetQueuedCompletionStatus failed in RunWorker. Error: %d", GetLastError());
+			return;
+		}
+
+		DWORD err = success ? 0 : GetLastError();
+		_this->HandleCompletion((PipeInstance *) overlap, err, bytesTransferred);
+	}
+}
 
-	if (err == 0 && bytesRead > 0)
+// Waits for a client on the instance, the connection completes on a worker. A client that came
+// and went before ConnectNamedPipe leaves the instance to be disconnected first. On any other
+// error the instance is replaced by a new one, so the pool keeps listening on all of them, and
+// only closed for good if the new one fails too.
+void IPCServer::StartConnect(PipeInstance *pipeInst)
+{
+	bool replaced = false;
+	while (!stop)
 	{
-		pipeInst->server->HandleRequest(pipeInst->request, pipeInst->response);
-		success = WriteFileEx(
-			pipeInst->pipe,
-			&pipeInst->response,
-			sizeof protocol::Response,
-			overlap,
-			(LPOVERLAPPED_COMPLETION_ROUTINE) CompletedWriteCallback
-		);
+		memset(&pipeInst->overlap, 0, sizeof pipeInst->overlap);
+		pipeInst->operation = PipeOperation::Connect;
+		ConnectNamedPipe(pipeInst->pipe, &pipeInst->overlap);
+
+		DWORD err = GetLastError();
+		switch (err)
+		{
+		case ERROR_IO_PENDING:
+			// The completion port is signaled when a client connects.
+			return;
+
+		case ERROR_PIPE_CONNECTED:
+			// A client connected before ConnectNamedPipe, no completion is queued for this case.
+			if (PostQueuedCompletionStatus(completionPort, 0, 0, &pipeInst->overlap))
+				return;
+			err = GetLastError();
+			break;
+
+		case ERROR_NO_DATA:
+			DisconnectNamedPipe(pipeInst->pipe);
+			continue;
+		}
+
+		// Nothing is pending on the old instance that Stop would have to wait for.
+		CloseHandle(pipeInst->pipe);
+		pipeInst->pipe = INVALID_HANDLE_VALUE;
+		if (replaced)
+		{
+			LOG("ConnectNamedPipe failed on a new pipe instance, closing it. Error: %d", err);
+			return;
+		}
+
+		LOG("ConnectNamedPipe failed, replacing the pipe instance. Error: %d", err);
+		pipeInst->pipe = CreatePipeInstance();
+		if (pipeInst->pipe == INVALID_HANDLE_VALUE)
+			return;
+		replaced = true;
 	}
+}
 
-	if (!success)
+void IPCServer::StartRead(PipeInstance *pipeInst)
+{
+	pipeInst->operation = PipeOperation::Read;
+	BOOL success = ReadFile(pipeInst->pipe, &pipeInst->request, sizeof protocol::Request, nullptr, &pipeInst->overlap);
+	if (!success && GetLastError() != ERROR_IO_PENDING)
 	{
-		if (err == ERROR_BROKEN_PIPE)
+		if (GetLastError() == ERROR_BROKEN_PIPE)
 		{
 			LOG("IPC client disconnecting normally");
 		}
 		else
 		{
-			LOG("IPC client disconnecting due to error (via CompletedReadCallback), error: %d, bytesRead: %d", err, bytesRead);
+			LOG("IPC client disconnecting due to error (via StartRead), error: %d", GetLastError());
 		}
-		pipeInst->server->ClosePipeInstance(pipeInst);
+		ClosePipeInstance(pipeInst);
 	}
 }
 
-void IPCServer::CompletedWriteCallback(DWORD err, DWORD bytesWritten, LPOVERLAPPED overlap)
+void IPCServer::StartWrite(PipeInstance *pipeInst)
 {
-	PipeInstance *pipeInst = (PipeInstance *) overlap;
-	BOOL success = FALSE;
-
-	if (err == 0 && bytesWritten == sizeof protocol::Response)
+	pipeInst->operation = PipeOperation::Write;
+	BOOL success = WriteFile(pipeInst->pipe, &pipeInst->response, pipeInst->response.MessageSize(), nullptr, &pipeInst->overlap);
+	if (!success && GetLastError() != ERROR_IO_PENDING)
 	{
-		success = ReadFileEx(
-			pipeInst->pipe,
-			&pipeInst->request,
-			sizeof protocol::Request,
-			overlap,
-			(LPOVERLAPPED_COMPLETION_ROUTINE) CompletedReadCallback
-		);
+		LOG("IPC client disconnecting due to error (via StartWrite), error: %d", GetLastError());
+		ClosePipeInstance(pipeInst);
 	}
+}
 
-	if (!success)
+void IPCServer::HandleCompletion(PipeInstance *pipeInst, DWORD err, DWORD bytesTransferred)
+{
+	// Stop closes the pipes once the workers are gone.
+	if (stop)
+		return;
+
+	switch (pipeInst->operation)
 	{
-		LOG("IPC client disconnecting due to error (via CompletedWriteCallback), error: %d, bytesWritten: %d", err, bytesWritten);
-		pipeInst->server->ClosePipeInstance(pipeInst);
+	case PipeOperation::Connect:
+		if (err != 0 && err != ERROR_PIPE_CONNECTED)
+		{
+			LOG("ConnectNamedPipe completed with error: %d", err);
+			ClosePipeInstance(pipeInst);
+		}
+		else
+		{
+			LOG("IPC client connected");
+			pipeInst->connected = true;
+			connectedClients.fetch_add(1, std::memory_order_relaxed);
+			StartRead(pipeInst);
+		}
+		break;
+
+	case PipeOperation::Read:
+		if (err == 0 && bytesTransferred >= protocol::MessageHeaderSize && bytesTransferred == pipeInst->request.MessageSize())
+		{
+			HandleRequest(pipeInst->request, pipeInst->response);
+			StartWrite(pipeInst);
+		}
+		else if (err == ERROR_BROKEN_PIPE)
+		{
+			LOG("IPC client disconnecting normally");
+			ClosePipeInstance(pipeInst);
+		}
+		else
+		{
+			LOG("IPC client disconnecting due to error (via read completion), error: %d, bytesRead: %d", err, bytesTransferred);
+			ClosePipeInstance(pipeInst);
+		}
+		break;
+
+	case PipeOperation::Write:
+		if (err == 0 && bytesTransferred == pipeInst->response.MessageSize())
+		{
+			StartRead(pipeInst);
+		}
+		else
+		{
+			LOG("IPC client disconnecting due to error (via write completion), error: %d, bytesWritten: %d", err, bytesTransferred);
+			ClosePipeInstance(pipeInst);
+		}
+		break;
 	}
 }
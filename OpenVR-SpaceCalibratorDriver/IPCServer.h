@@ -2,9 +2,10 @@
 
 #include "../Protocol.h"
 
+#include <atomic>
+#include <memory>
 #include <thread>
-#include <set>
-#include <mutex>
+#include <vector>
 
 #define WIN32_LEAN_AND_MEAN
 #include <windows.h>
@@ -23,31 +24,53 @@ public:
 private:
 	void HandleRequest(const protocol::Request &request, protocol::Response &response);
 
+	// Every pipe has exactly one operation in flight, so requests from one client are handled
+	// in order while different clients are served by different workers.
+	enum class PipeOperation
+	{
+		Connect,
+		Read,
+		Write,
+	};
+
+	// Run creates this many pipe instances, each listening for a client, and a client leaving
+	// puts its instance back to listening. Connection churn then allocates nothing and creates
+	// no kernel objects. Clients beyond this many wait in WaitNamedPipe until one disconnects.
+	static const size_t PipeInstanceCount = 8;
+
 	struct PipeInstance
 	{
 		OVERLAPPED overlap; // Used by the API
-		HANDLE pipe;
-		IPCServer *server;
+		HANDLE pipe = INVALID_HANDLE_VALUE; // Invalid if the instance couldn't listen again.
+		PipeOperation operation = PipeOperation::Connect;
+		bool connected = false;
 
 		protocol::Request request;
 		protocol::Response response;
 	};
 
-	PipeInstance *CreatePipeInstance(HANDLE pipe);
+	bool CreatePipeInstances();
+	HANDLE CreatePipeInstance();
 	void ClosePipeInstance(PipeInstance *pipeInst);
 
-	static void RunThread(IPCServer *_this);
-	static BOOL CreateAndConnectInstance(LPOVERLAPPED overlap, HANDLE &pipe);
-	static void WINAPI CompletedReadCallback(DWORD err, DWORD bytesRead, LPOVERLAPPED overlap);
-	static void WINAPI CompletedWriteCallback(DWORD err, DWORD bytesWritten, LPOVERLAPPED overlap);
+	void StartConnect(PipeInstance *pipeInst);
+	void StartRead(PipeInstance *pipeInst);
+	void StartWrite(PipeInstance *pipeInst);
+	void HandleCompletion(PipeInstance *pipeInst, DWORD err, DWORD bytesTransferred);
+
+	static void RunWorker(IPCServer *_this);
 
-	std::thread mainThread;
+	HANDLE completionPort = nullptr;
+	std::vector<std::thread> workers;
 
 	bool running = false;
-	bool stop = false;
+	std::atomic<bool> stop;
+
+	// PipeInstanceCount of them, allocated by the first Run.
+	std::unique_ptr<PipeInstance[]> pipes;
+	std::atomic<uint32_t> connectedClients { 0 };
 
-	std::set<PipeInstance *> pipes;
-	HANDLE connectEvent;
+	std::atomic<uint64_t> requestsHandled { 0 }, invalidRequests { 0 };
 
 	ServerTrackedDeviceProvider *driver;
 };
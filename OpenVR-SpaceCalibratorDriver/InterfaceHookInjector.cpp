@@ -3,58 +3,105 @@
 #include "InterfaceHookInjector.h"
 #include "ServerTrackedDeviceProvider.h"
 
+#include <cstring>
+#include <mutex>
+
 static ServerTrackedDeviceProvider *Driver = nullptr;
 
 static Hook<void*(*)(vr::IVRDriverContext *, const char *, vr::EVRInitError *)> 
 	GetGenericInterfaceHook("IVRDriverContext::GetGenericInterface");
 
-static Hook<void(*)(vr::IVRServerDriverHost *, uint32_t, const vr::DriverPose_t &, uint32_t)>
-	TrackedDevicePoseUpdatedHook005("IVRServerDriverHost005::TrackedDevicePoseUpdated");
-
-static Hook<void(*)(vr::IVRServerDriverHost *, uint32_t, const vr::DriverPose_t &, uint32_t)>
-	TrackedDevicePoseUpdatedHook006("IVRServerDriverHost006::TrackedDevicePoseUpdated");
+typedef Hook<void(*)(vr::IVRServerDriverHost *, uint32_t, const vr::DriverPose_t &, uint32_t)> TrackedDevicePoseUpdatedHook;
 
-static void DetourTrackedDevicePoseUpdated005(vr::IVRServerDriverHost *_this, uint32_t unWhichDevice, const vr::DriverPose_t &newPose, uint32_t unPoseStructSize)
+// One detour and hook object per interface version, all with the same vtable layout for
+// TrackedDevicePoseUpdated. Supporting another version only needs a traits struct and a table entry.
+template<class Interface> class TrackedDevicePoseUpdatedDetour
 {
-	//TRACE("ServerTrackedDeviceProvider::DetourTrackedDevicePoseUpdated(%d)", unWhichDevice);
-	auto pose = newPose;
-	if (Driver->HandleDevicePoseUpdated(unWhichDevice, pose))
+public:
+	static TrackedDevicePoseUpdatedHook hook;
+
+	static void Detour(vr::IVRServerDriverHost *_this, uint32_t unWhichDevice, const vr::DriverPose_t &newPose, uint32_t unPoseStructSize)
 	{
-		TrackedDevicePoseUpdatedHook005.originalFunc(_this, unWhichDevice, pose, unPoseStructSize);
+		TRACE(protocol::TracePose, "ServerTrackedDeviceProvider::DetourTrackedDevicePoseUpdated(%d)", unWhichDevice);
+		vr::DriverPose_t transformed;
+		hook.originalFunc(_this, unWhichDevice, *Driver->HandleDevicePoseUpdated(unWhichDevice, newPose, transformed), unPoseStructSize);
 	}
-}
+};
 
-static void DetourTrackedDevicePoseUpdated006(vr::IVRServerDriverHost *_this, uint32_t unWhichDevice, const vr::DriverPose_t &newPose, uint32_t unPoseStructSize)
+template<class Interface> TrackedDevicePoseUpdatedHook TrackedDevicePoseUpdatedDetour<Interface>::hook(Interface::HookName());
+
+struct ServerDriverHost005
 {
-	//TRACE("ServerTrackedDeviceProvider::DetourTrackedDevicePoseUpdated(%d)", unWhichDevice);
-	auto pose = newPose;
-	if (Driver->HandleDevicePoseUpdated(unWhichDevice, pose))
-	{
-		TrackedDevicePoseUpdatedHook006.originalFunc(_this, unWhichDevice, pose, unPoseStructSize);
-	}
+	static const char *Version() { return "IVRServerDriverHost_005"; }
+	static const char *HookName() { return "IVRServerDriverHost005::TrackedDevicePoseUpdated"; }
+};
+
+struct ServerDriverHost006
+{
+	static const char *Version() { return "IVRServerDriverHost_006"; }
+	static const char *HookName() { return "IVRServerDriverHost006::TrackedDevicePoseUpdated"; }
+};
+
+// Interfaces whose TrackedDevicePoseUpdated (vtable slot 1) gets hooked when SteamVR hands them out.
+struct HookedInterface
+{
+	const char *version;
+	TrackedDevicePoseUpdatedHook *hook;
+	void *detour;
+};
+
+#define HOOKED_INTERFACE(Interface) \
+	{ Interface::Version(), &TrackedDevicePoseUpdatedDetour<Interface>::hook, (void *) &TrackedDevicePoseUpdatedDetour<Interface>::Detour }
+
+static const HookedInterface HookedInterfaces[] = {
+	HOOKED_INTERFACE(ServerDriverHost005),
+	HOOKED_INTERFACE(ServerDriverHost006),
+};
+
+#undef HOOKED_INTERFACE
+
+static const char HookedInterfacePrefix[] = "IVRServerDriverHost_";
+
+// What SetPoseHooksEnabled last asked for, hooks created later start out that way. The mutex
+// keeps a hook being created from missing a change.
+static std::mutex PoseHooksMutex;
+static bool PoseHooksEnabled = true;
+
+// From "poseHookMethod" in the driver's settings, read once by InjectHooks. "vtable" makes the
+// pose hooks swap their interface's vtable slot, anything else patches the function inline.
+static HookMethod PoseHookMethod = HookMethod::Inline;
+
+static HookMethod ReadPoseHookMethod()
+{
+	char method[32] = { 0 };
+	auto err = vr::VRSettingsError_None;
+	vr::VRSettings()->GetString("driver_01spacecalibrator", "poseHookMethod", method, sizeof method, &err);
+	if (err != vr::VRSettingsError_None)
+		return HookMethod::Inline;
+	return strcmp(method, "vtable") == 0 ? HookMethod::VTableSlot : HookMethod::Inline;
 }
 
 static void *DetourGetGenericInterface(vr::IVRDriverContext *_this, const char *pchInterfaceVersion, vr::EVRInitError *peError)
 {
-	TRACE("ServerTrackedDeviceProvider::DetourGetGenericInterface(%s)", pchInterfaceVersion);
+	TRACE(protocol::TraceHooks, "ServerTrackedDeviceProvider::DetourGetGenericInterface(%s)", pchInterfaceVersion);
 	auto originalInterface = GetGenericInterfaceHook.originalFunc(_this, pchInterfaceVersion, peError);
 
-	std::string iface(pchInterfaceVersion);
-	if (iface == "IVRServerDriverHost_005")
-	{
-		if (!IHook::Exists(TrackedDevicePoseUpdatedHook005.name))
-		{
-			TrackedDevicePoseUpdatedHook005.CreateHookInObjectVTable(originalInterface, 1, &DetourTrackedDevicePoseUpdated005);
-			IHook::Register(&TrackedDevicePoseUpdatedHook005);
-		}
-	}
-	else if (iface == "IVRServerDriverHost_006")
+	// Most requests are for other interfaces, and fail on the first few characters here.
+	if (!originalInterface || strncmp(pchInterfaceVersion, HookedInterfacePrefix, sizeof HookedInterfacePrefix - 1) != 0)
+		return originalInterface;
+
+	for (auto &hooked : HookedInterfaces)
 	{
-		if (!IHook::Exists(TrackedDevicePoseUpdatedHook006.name))
+		if (strcmp(pchInterfaceVersion, hooked.version) != 0)
+			continue;
+
+		std::lock_guard<std::mutex> lock(PoseHooksMutex);
+		if (!hooked.hook->IsRegistered())
 		{
-			TrackedDevicePoseUpdatedHook006.CreateHookInObjectVTable(originalInterface, 1, &DetourTrackedDevicePoseUpdated006);
-			IHook::Register(&TrackedDevicePoseUpdatedHook006);
+			hooked.hook->CreateHookInObjectVTable(originalInterface, 1, hooked.detour, PoseHooksEnabled, PoseHookMethod);
+			IHook::Register(hooked.hook);
 		}
+		break;
 	}
 
 	return originalInterface;
@@ -63,6 +110,7 @@ static void *DetourGetGenericInterface(vr::IVRDriverContext *_this, const char *
 void InjectHooks(ServerTrackedDeviceProvider *driver, vr::IVRDriverContext *pDriverContext)
 {
 	Driver = driver;
+	PoseHookMethod = ReadPoseHookMethod();
 
 	auto err = MH_Initialize();
 	if (err == MH_OK)
@@ -76,6 +124,21 @@ void InjectHooks(ServerTrackedDeviceProvider *driver, vr::IVRDriverContext *pDri
 	}
 }
 
+void SetPoseHooksEnabled(bool enabled)
+{
+	std::lock_guard<std::mutex> lock(PoseHooksMutex);
+	if (enabled == PoseHooksEnabled)
+		return;
+
+	PoseHooksEnabled = enabled;
+	for (auto &hooked : HookedInterfaces)
+	{
+		if (hooked.hook->IsRegistered())
+			hooked.hook->SetEnabled(enabled);
+	}
+	LOG("Pose hooks %s", enabled ? "enabled" : "disabled");
+}
+
 void DisableHooks()
 {
 	IHook::DestroyAll();
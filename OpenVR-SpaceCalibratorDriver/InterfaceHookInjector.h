@@ -7,4 +7,8 @@ class ServerTrackedDeviceProvider;
 static void DetourTrackedDevicePoseUpdated(vr::IVRServerDriverHost * _this, uint32_t unWhichDevice, const vr::DriverPose_t & newPose, uint32_t unPoseStructSize);
 
 void InjectHooks(ServerTrackedDeviceProvider *driver, vr::IVRDriverContext *pDriverContext);
-void DisableHooks();
\ No newline at end of file
+void DisableHooks();
+
+// Patches the pose hooks in or out, including those created later. Off, poses reach SteamVR
+// without passing through the driver at all.
+void SetPoseHooksEnabled(bool enabled);
\ No newline at end of file
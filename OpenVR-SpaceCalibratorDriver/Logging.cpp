@@ -1,6 +1,14 @@
 #define _CRT_SECURE_NO_DEPRECATE
 #include "Logging.h"
-#include <chrono>
+#include "ThreadQoS.h"
+#include <intrin.h>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <cstdarg>
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
 
 FILE *LogFile;
 
@@ -13,16 +21,223 @@ void OpenLogFile()
 	}
 }
 
-tm TimeForLog()
+void LogFlush()
 {
-	auto now = std::chrono::system_clock::now();
-	auto nowTime = std::chrono::system_clock::to_time_t(now);
-	tm value;
-	auto tm = localtime_s(&value, &nowTime);
-	return value;
+	fflush(LogFile);
 }
 
-void LogFlush()
+// Bounded MPSC queue: producers claim a cell by advancing enqueuePos, and each cell's sequence
+// tells whether it's free for the producer of this lap or holds a message for the consumer.
+static const size_t LogRingSize = 1024; // Power of two.
+static const size_t LogMessageSize = 240;
+
+struct LogCell
 {
-	fflush(LogFile);
-}
\ No newline at end of file
+	std::atomic<size_t> sequence;
+	uint64_t fileTime; // When the message was logged, converted to local time by the writer.
+	char text[LogMessageSize];
+};
+
+static LogCell LogRing[LogRingSize];
+static std::atomic<size_t> LogEnqueuePos(0);
+static size_t LogDequeuePos = 0; // Only touched while holding LogDrainMutex.
+static std::atomic<uint64_t> LogDropped(0);
+static std::mutex LogDrainMutex;
+
+static std::thread LogThread;
+static std::atomic<bool> LogThreadRunning(false);
+static HANDLE LogStopEvent = nullptr;
+static std::atomic<uint32_t> LogFlushInterval(100);
+
+static struct LogRingInit
+{
+	LogRingInit()
+	{
+		for (size_t i = 0; i < LogRingSize; i++)
+			LogRing[i].sequence.store(i, std::memory_order_relaxed);
+	}
+} logRingInit;
+
+// Local time is only recomputed when the second changes.
+static void FormatLogTime(uint64_t fileTime, char (&out)[16])
+{
+	static uint64_t cachedSecond = 0;
+	static tm cachedTime;
+
+	uint64_t second = fileTime / 10000000ull;
+	if (second != cachedSecond)
+	{
+		// FILETIME counts 100 ns intervals since 1601, time_t counts seconds since 1970.
+		time_t unixTime = (time_t) (second - 11644473600ull);
+		localtime_s(&cachedTime, &unixTime);
+		cachedSecond = second;
+	}
+
+	snprintf(out, sizeof out, "%02d:%02d:%02d", cachedTime.tm_hour, cachedTime.tm_min, cachedTime.tm_sec);
+}
+
+// Writes out every queued message, the caller must hold LogDrainMutex.
+static bool DrainLogRing()
+{
+	bool wrote = false;
+	char timeText[16];
+
+	uint64_t dropped = LogDropped.exchange(0, std::memory_order_relaxed);
+	while (true)
+	{
+		auto &cell = LogRing[LogDequeuePos & (LogRingSize - 1)];
+		if (cell.sequence.load(std::memory_order_acquire) != LogDequeuePos + 1)
+			break;
+
+		FormatLogTime(cell.fileTime, timeText);
+		fprintf(LogFile, "[%s] %s\n", timeText, cell.text);
+		cell.sequence.store(LogDequeuePos + LogRingSize, std::memory_order_release);
+		LogDequeuePos++;
+		wrote = true;
+	}
+
+	if (dropped)
+	{
+		fprintf(LogFile, "[log] %llu messages dropped, log ring was full\n", (unsigned long long) dropped);
+		wrote = true;
+	}
+	return wrote;
+}
+
+void LogWrite(const char *fmt, ...)
+{
+	FILETIME now;
+	GetSystemTimeAsFileTime(&now);
+
+	size_t pos = LogEnqueuePos.load(std::memory_order_relaxed);
+	LogCell *cell;
+	while (true)
+	{
+		cell = &LogRing[pos & (LogRingSize - 1)];
+		size_t sequence = cell->sequence.load(std::memory_order_acquire);
+		intptr_t diff = (intptr_t) sequence - (intptr_t) pos;
+		if (diff == 0)
+		{
+			if (LogEnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+				break;
+		}
+		else if (diff < 0)
+		{
+			// Full, the writer hasn't caught up. Dropping beats blocking the pose or IPC thread.
+			LogDropped.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+		else
+		{
+			pos = LogEnqueuePos.load(std::memory_order_relaxed);
+		}
+	}
+
+	cell->fileTime = ((uint64_t) now.dwHighDateTime << 32) | now.dwLowDateTime;
+
+	va_list args;
+	va_start(args, fmt);
+	vsnprintf(cell->text, sizeof cell->text, fmt, args);
+	va_end(args);
+
+	cell->sequence.store(pos + 1, std::memory_order_release);
+
+	if (!LogThreadRunning.load(std::memory_order_acquire))
+	{
+		std::lock_guard<std::mutex> lock(LogDrainMutex);
+		DrainLogRing();
+		LogFlush();
+	}
+}
+
+static void RunLogThread()
+{
+	SetCurrentThreadRole(L"SpaceCalibrator log", ThreadRole::Background);
+
+	while (WaitForSingleObject(LogStopEvent, LogFlushInterval.load(std::memory_order_relaxed)) == WAIT_TIMEOUT)
+	{
+		std::lock_guard<std::mutex> lock(LogDrainMutex);
+		if (DrainLogRing())
+			LogFlush();
+	}
+}
+
+void StartLogThread()
+{
+	if (LogThreadRunning)
+		return;
+
+	LogStopEvent = CreateEvent(nullptr, FALSE, FALSE, nullptr);
+	if (!LogStopEvent)
+		return;
+
+	LogThreadRunning = true;
+	LogThread = std::thread(RunLogThread);
+}
+
+void StopLogThread()
+{
+	if (!LogThreadRunning)
+		return;
+
+	SetEvent(LogStopEvent);
+	LogThread.join();
+	LogThreadRunning = false;
+
+	CloseHandle(LogStopEvent);
+	LogStopEvent = nullptr;
+
+	std::lock_guard<std::mutex> lock(LogDrainMutex);
+	DrainLogRing();
+	LogFlush();
+}
+
+void SetLogFlushInterval(uint32_t milliseconds)
+{
+	LogFlushInterval = milliseconds;
+}
+
+static std::atomic<uint32_t> LocalTraceCategories(0);
+std::atomic<uint32_t> *TraceCategories = &LocalTraceCategories;
+
+void SetTraceCategoryFlags(std::atomic<uint32_t> *flags)
+{
+	TraceCategories = flags ? flags : &LocalTraceCategories;
+}
+
+static const uint32_t TraceMaxPerSecond = 20;
+
+// Fixed one second windows per category. Racing threads may let a few extra messages through
+// at a window boundary, which is fine for a debugging aid.
+struct TraceWindow
+{
+	std::atomic<uint64_t> second;
+	std::atomic<uint32_t> count;
+	std::atomic<uint32_t> suppressed;
+};
+
+static TraceWindow TraceWindows[32];
+
+bool TraceSample(protocol::TraceCategory category)
+{
+	unsigned long index;
+	_BitScanForward(&index, category);
+	auto &window = TraceWindows[index];
+
+	uint64_t second = GetTickCount64() / 1000;
+	if (window.second.load(std::memory_order_relaxed) != second)
+	{
+		window.second.store(second, std::memory_order_relaxed);
+		window.count.store(0, std::memory_order_relaxed);
+
+		uint32_t suppressed = window.suppressed.exchange(0, std::memory_order_relaxed);
+		if (suppressed)
+			LogWrite("[trace] %u messages in category 0x%x suppressed", suppressed, (uint32_t) category);
+	}
+
+	if (window.count.fetch_add(1, std::memory_order_relaxed) < TraceMaxPerSecond)
+		return true;
+
+	window.suppressed.fetch_add(1, std::memory_order_relaxed);
+	return false;
+}
@@ -1,24 +1,49 @@
 #pragma once
 
+#include "../Protocol.h"
+
 #include <cstdio>
 #include <ctime>
+#include <cstdint>
+#include <atomic>
 
 extern FILE *LogFile;
 
 void OpenLogFile();
-tm TimeForLog();
 void LogFlush();
 
+// Messages are queued in a fixed ring and written by a background thread while it runs,
+// so logging never waits on the file. Before StartLogThread and after StopLogThread every
+// message is written synchronously, which covers DllMain where threads can't be joined.
+void StartLogThread();
+void StopLogThread();
+void SetLogFlushInterval(uint32_t milliseconds);
+
+void LogWrite(const char *fmt, ...);
+
 #ifndef LOG
-#define LOG(fmt, ...) do { \
-	tm logNow = TimeForLog(); \
-	fprintf(LogFile, "[%02d:%02d:%02d] " fmt "\n", logNow.tm_hour, logNow.tm_min, logNow.tm_sec, __VA_ARGS__); \
-	LogFlush(); \
-} while (0)
+#define LOG(fmt, ...) LogWrite(fmt, __VA_ARGS__)
 #endif
 
-#define TRACE(...) {}
-
-#ifndef TRACE
-#define TRACE LOG
+// Categories compiled in, anything outside the mask costs nothing. Define SPACECAL_TRACE_CATEGORIES
+// to a protocol::TraceCategory mask to narrow it, 0 removes tracing entirely.
+#ifndef SPACECAL_TRACE_CATEGORIES
+#define SPACECAL_TRACE_CATEGORIES protocol::TraceAll
 #endif
+
+constexpr uint32_t CompiledTraceCategories = SPACECAL_TRACE_CATEGORIES;
+
+// Categories enabled at runtime, points into the shared memory section once it's open so the
+// client can switch tracing on without a rebuild. All off by default.
+extern std::atomic<uint32_t> *TraceCategories;
+void SetTraceCategoryFlags(std::atomic<uint32_t> *flags);
+
+// Rate limit per category, so tracing poses at tracking rate doesn't flood the log.
+bool TraceSample(protocol::TraceCategory category);
+
+#define TRACE(category, fmt, ...) do { \
+	if ((CompiledTraceCategories & (category)) && \
+		(TraceCategories->load(std::memory_order_relaxed) & (category)) && \
+		TraceSample(category)) \
+		LogWrite("[" #category "] " fmt, __VA_ARGS__); \
+} while (0)
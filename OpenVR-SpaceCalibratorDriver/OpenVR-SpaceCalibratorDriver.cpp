@@ -9,7 +9,7 @@
 
 OPENVRSPACECALIBRATORDRIVER_API void *HmdDriverFactory(const char *pInterfaceName, int *pReturnCode)
 {
-	TRACE("HmdDriverFactory(%s)", pInterfaceName);
+	TRACE(protocol::TraceLifecycle, "HmdDriverFactory(%s)", pInterfaceName);
 
 	static ServerTrackedDeviceProvider server;
 	static VRWatchdogProvider watchdog;
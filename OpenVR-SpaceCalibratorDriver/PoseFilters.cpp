@@ -0,0 +1,627 @@
+#include "PoseFilters.h"
+#include "Logging.h"
+#include "../QuaternionMath.h"
+
+#include <cmath>
+#include <cstring>
+
+// A device silent for longer than this starts its filters over instead of smoothing across the gap.
+static const double MaxFilterGap = 0.5;
+
+// Source poses older than this are not fused in, the device goes on with its own tracking alone.
+static const double MaxFusionSourceAge = 0.1;
+
+static const double Pi = 3.14159265358979323846;
+
+static vr::HmdQuaternion_t Conjugate(const vr::HmdQuaternion_t &q)
+{
+	return { q.w, -q.x, -q.y, -q.z };
+}
+
+static double AngleBetween(const vr::HmdQuaternion_t &a, const vr::HmdQuaternion_t &b)
+{
+	double dot = fabs(a.w * b.w + a.x * b.x + a.y * b.y + a.z * b.z);
+	return 2.0 * acos(dot > 1.0 ? 1.0 : dot);
+}
+
+// Smoothing factor of a first order low pass with the cutoff, for a step of dt.
+static double LowPassAlpha(double cutoff, double dt)
+{
+	double tau = 1.0 / (2.0 * Pi * cutoff);
+	return 1.0 / (1.0 + tau / dt);
+}
+
+static void WorldFromDriver(const vr::DriverPose_t &pose, double (&position)[3], vr::HmdQuaternion_t &rotation)
+{
+	auto rotated = quaternionRotateVector(pose.qWorldFromDriverRotation, pose.vecPosition);
+	for (int i = 0; i < 3; i++)
+		position[i] = rotated.v[i] + pose.vecWorldFromDriverTranslation[i];
+	rotation = pose.qWorldFromDriverRotation * pose.qRotation;
+}
+
+static void DriverFromWorld(vr::DriverPose_t &pose, const double (&position)[3], const vr::HmdQuaternion_t &rotation)
+{
+	auto driverFromWorld = Conjugate(pose.qWorldFromDriverRotation);
+	double offset[3];
+	for (int i = 0; i < 3; i++)
+		offset[i] = position[i] - pose.vecWorldFromDriverTranslation[i];
+
+	auto local = quaternionRotateVector(driverFromWorld, offset);
+	for (int i = 0; i < 3; i++)
+		pose.vecPosition[i] = local.v[i];
+	pose.qRotation = driverFromWorld * rotation;
+}
+
+static void RotateInPlace(const vr::HmdQuaternion_t &rotation, double (&vector)[3])
+{
+	auto rotated = quaternionRotateVector(rotation, vector);
+	for (int i = 0; i < 3; i++)
+		vector[i] = rotated.v[i];
+}
+
+// Kalman update of one axis of a constant velocity model with a position measurement of the
+// variance.
+static void KalmanUpdate(double &position, double &velocity, double (&covariance)[3], double measured, double variance)
+{
+	double residual = measured - position;
+	double innovation = covariance[0] + variance;
+	double positionGain = covariance[0] / innovation, velocityGain = covariance[1] / innovation;
+
+	position += positionGain * residual;
+	velocity += velocityGain * residual;
+	covariance[2] -= velocityGain * covariance[1];
+	covariance[1] -= positionGain * covariance[1];
+	covariance[0] -= positionGain * covariance[0];
+}
+
+// Marks a pose made up from another device's tracking as good, with velocities of the made up one.
+// The device's own are as stale as its pose, and SteamVR extrapolates with these.
+static void MarkCarried(vr::DriverPose_t &pose, const double (&velocity)[3])
+{
+	auto driverVelocity = quaternionRotateVector(Conjugate(pose.qWorldFromDriverRotation), velocity);
+	for (int i = 0; i < 3; i++)
+	{
+		pose.vecVelocity[i] = driverVelocity.v[i];
+		pose.vecAcceleration[i] = pose.vecAngularVelocity[i] = pose.vecAngularAcceleration[i] = 0;
+	}
+	pose.poseIsValid = true;
+	pose.result = vr::TrackingResult_Running_OK;
+}
+
+PoseFilters::PoseFilters() : activeMask(0), sourceMask(0)
+{
+	memset(configured, 0, sizeof configured);
+	memset(pending, 0, sizeof pending);
+	memset(chains, 0, sizeof chains);
+	for (auto &sequence : pendingSequence)
+		sequence = 0;
+	for (auto &source : sources)
+		source.sequence = 0;
+}
+
+// Whether the stage's parameters are in the ranges protocol::PoseFilterStage gives. NaN fails
+// every comparison, so it never passes, and infinities are rejected before. A cutoff of 0 would
+// divide by zero in LowPassAlpha.
+static bool ValidStage(const protocol::PoseFilterStage &stage, uint32_t openVRID)
+{
+	for (double param : stage.params)
+	{
+		if (!std::isfinite(param))
+			return false;
+	}
+
+	auto &params = stage.params;
+	switch (stage.type)
+	{
+	case protocol::PoseFilterOneEuro:
+		return params[0] > 0 && params[1] >= 0 && params[2] > 0;
+	case protocol::PoseFilterJitter:
+		return params[0] >= 0 && params[1] >= 0;
+	case protocol::PoseFilterPredict:
+		return fabs(params[0]) <= protocol::MaxPosePrediction;
+	case protocol::PoseFilterBlend:
+	case protocol::PoseFilterFusion:
+	case protocol::PoseFilterFallback:
+	case protocol::PoseFilterCompensate:
+		break;
+	default:
+		return false;
+	}
+
+	if (stage.sourceID >= vr::k_unMaxTrackedDeviceCount || stage.sourceID == openVRID)
+		return false;
+
+	switch (stage.type)
+	{
+	case protocol::PoseFilterBlend:
+		return params[0] >= 0 && params[0] <= 1 && params[1] > 0;
+	case protocol::PoseFilterFusion:
+		return params[0] > 0 && params[1] > 0 && params[2] >= 0;
+	case protocol::PoseFilterFallback:
+		return params[0] > 0 && params[1] >= 0 && params[1] <= 1;
+	default:
+		return params[0] > 0;
+	}
+}
+
+bool PoseFilters::Configure(const protocol::SetPoseFilters &config)
+{
+	if (config.openVRID >= vr::k_unMaxTrackedDeviceCount || config.count > protocol::MaxPoseFilterStages)
+		return false;
+
+	for (uint32_t i = 0; i < config.count; i++)
+	{
+		if (!ValidStage(config.stages[i], config.openVRID))
+		{
+			LOG("Pose filter %d of device %d has type %d or parameters out of range", i, config.openVRID, config.stages[i].type);
+			return false;
+		}
+	}
+
+	std::lock_guard<std::mutex> lock(configMutex);
+	configured[config.openVRID] = config;
+
+	// Into the buffer the pose thread isn't reading, then published.
+	auto &sequence = pendingSequence[config.openVRID];
+	uint32_t current = sequence.load(std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+	pending[config.openVRID][(current + 1) & 1] = config;
+	sequence.store(current + 1, std::memory_order_release);
+
+	uint64_t active = 0, recorded = 0;
+	for (uint32_t id = 0; id < vr::k_unMaxTrackedDeviceCount; id++)
+	{
+		if (!configured[id].count)
+			continue;
+
+		active |= 1ull << id;
+		for (uint32_t i = 0; i < configured[id].count; i++)
+		{
+			auto type = configured[id].stages[i].type;
+			if (type == protocol::PoseFilterBlend || type == protocol::PoseFilterFusion || type == protocol::PoseFilterFallback ||
+				type == protocol::PoseFilterCompensate)
+				recorded |= 1ull << configured[id].stages[i].sourceID;
+		}
+	}
+	activeMask.store(active, std::memory_order_relaxed);
+	sourceMask.store(recorded, std::memory_order_relaxed);
+
+	LOG("Device %d has %d pose filters", config.openVRID, config.count);
+	return true;
+}
+
+// A chain Configure published another over while it was copied may be torn, the device then
+// keeps its current chain and the pending one is taken with the next pose.
+void PoseFilters::TakeConfiguration(uint32_t openVRID, Chain &chain)
+{
+	uint32_t sequence = pendingSequence[openVRID].load(std::memory_order_acquire);
+	const auto &config = pending[openVRID][sequence & 1];
+	uint32_t count = config.count;
+	protocol::PoseFilterStage stages[protocol::MaxPoseFilterStages];
+	if (count <= protocol::MaxPoseFilterStages)
+		memcpy(stages, config.stages, count * sizeof stages[0]);
+	std::atomic_thread_fence(std::memory_order_acquire);
+
+	if (pendingSequence[openVRID].load(std::memory_order_relaxed) != sequence)
+		return;
+
+	chain.sequence = sequence;
+	chain.count = count;
+	for (uint32_t i = 0; i < count; i++)
+	{
+		chain.stages[i].config = stages[i];
+		chain.stages[i].state.initialized = false;
+	}
+}
+
+void PoseFilters::Apply(uint32_t openVRID, vr::DriverPose_t &pose, double time)
+{
+	auto &chain = chains[openVRID];
+	if (pendingSequence[openVRID].load(std::memory_order_acquire) != chain.sequence)
+		TakeConfiguration(openVRID, chain);
+
+	// Filters start over from the first good pose after tracking was lost, unless a fusion or
+	// fallback stage heading the chain carries the device on its source's tracking in the meantime.
+	uint32_t first = 0;
+	if (!pose.poseIsValid || pose.result != vr::TrackingResult_Running_OK)
+	{
+		if (chain.count && pose.deviceIsConnected && Carry(chain.stages[0], pose, time))
+		{
+			first = 1;
+		}
+		else
+		{
+			// A learned fallback offset stays, it is about the devices rather than recent poses.
+			for (uint32_t i = 0; i < chain.count; i++)
+			{
+				if (chain.stages[i].config.type != protocol::PoseFilterFallback)
+					chain.stages[i].state.initialized = false;
+			}
+			return;
+		}
+	}
+
+	if (chain.count == 1)
+	{
+		if (!first)
+			RunStage(chain.stages[0], pose, time);
+		return;
+	}
+
+	for (uint32_t i = first; i < chain.count; i++)
+		RunStage(chain.stages[i], pose, time);
+}
+
+void PoseFilters::RunStage(Stage &stage, vr::DriverPose_t &pose, double time)
+{
+	switch (stage.config.type)
+	{
+	case protocol::PoseFilterOneEuro:
+		OneEuro(stage, pose, time);
+		break;
+	case protocol::PoseFilterJitter:
+		Jitter(stage, pose);
+		break;
+	case protocol::PoseFilterBlend:
+		Blend(stage, pose, time);
+		break;
+	case protocol::PoseFilterFusion:
+		Fuse(stage, pose, time, true);
+		break;
+	case protocol::PoseFilterFallback:
+		Fallback(stage, pose, time, true);
+		break;
+	case protocol::PoseFilterPredict:
+		Predict(stage, pose);
+		break;
+	case protocol::PoseFilterCompensate:
+		Compensate(stage, pose, time);
+		break;
+	}
+}
+
+// Makes up the pose of a device that is not tracking, returns false when the stage can't.
+bool PoseFilters::Carry(Stage &stage, vr::DriverPose_t &pose, double time)
+{
+	switch (stage.config.type)
+	{
+	case protocol::PoseFilterFusion:
+		return Fuse(stage, pose, time, false);
+	case protocol::PoseFilterFallback:
+		return Fallback(stage, pose, time, false);
+	default:
+		return false;
+	}
+}
+
+// Casiez et al.'s 1 Euro filter: a low pass whose cutoff rises with the smoothed speed, on the
+// position per axis and on the rotation by slerp.
+void PoseFilters::OneEuro(Stage &stage, vr::DriverPose_t &pose, double time)
+{
+	auto &state = stage.state;
+	double minCutoff = stage.config.params[0], beta = stage.config.params[1], speedCutoff = stage.config.params[2];
+	double dt = time - state.time;
+
+	if (!state.initialized || dt > MaxFilterGap || dt < 0)
+	{
+		state.initialized = true;
+		state.time = time;
+		memcpy(state.position, pose.vecPosition, sizeof state.position);
+		state.rotation = state.lastRotation = pose.qRotation;
+		state.velocity[0] = state.velocity[1] = state.velocity[2] = 0;
+		state.angularSpeed = 0;
+		return;
+	}
+	if (dt == 0)
+	{
+		memcpy(pose.vecPosition, state.position, sizeof state.position);
+		pose.qRotation = state.rotation;
+		return;
+	}
+	state.time = time;
+
+	double speedAlpha = LowPassAlpha(speedCutoff, dt), speed = 0;
+	for (int i = 0; i < 3; i++)
+	{
+		double velocity = (pose.vecPosition[i] - state.position[i]) / dt;
+		state.velocity[i] += speedAlpha * (velocity - state.velocity[i]);
+		speed += state.velocity[i] * state.velocity[i];
+	}
+
+	double alpha = LowPassAlpha(minCutoff + beta * sqrt(speed), dt);
+	for (int i = 0; i < 3; i++)
+	{
+		state.position[i] += alpha * (pose.vecPosition[i] - state.position[i]);
+		pose.vecPosition[i] = state.position[i];
+	}
+
+	double angularSpeed = AngleBetween(state.lastRotation, pose.qRotation) / dt;
+	state.angularSpeed += speedAlpha * (angularSpeed - state.angularSpeed);
+	state.lastRotation = pose.qRotation;
+
+	state.rotation = quaternionSlerp(state.rotation, pose.qRotation, LowPassAlpha(minCutoff + beta * state.angularSpeed, dt));
+	pose.qRotation = state.rotation;
+}
+
+// The held pose is dragged along once the input leaves the deadband, so motion past it comes
+// through with a constant lag of the deadband and nothing smaller moves the device at all.
+void PoseFilters::Jitter(Stage &stage, vr::DriverPose_t &pose)
+{
+	auto &state = stage.state;
+	double positionBand = stage.config.params[0], rotationBand = stage.config.params[1];
+
+	if (!state.initialized)
+	{
+		state.initialized = true;
+		memcpy(state.position, pose.vecPosition, sizeof state.position);
+		state.rotation = pose.qRotation;
+		return;
+	}
+
+	double delta[3], distance = 0;
+	for (int i = 0; i < 3; i++)
+	{
+		delta[i] = pose.vecPosition[i] - state.position[i];
+		distance += delta[i] * delta[i];
+	}
+	distance = sqrt(distance);
+	if (distance > positionBand)
+	{
+		double t = 1.0 - positionBand / distance;
+		for (int i = 0; i < 3; i++)
+			state.position[i] += delta[i] * t;
+	}
+
+	double angle = AngleBetween(state.rotation, pose.qRotation);
+	if (angle > rotationBand)
+		state.rotation = quaternionSlerp(state.rotation, pose.qRotation, 1.0 - rotationBand / angle);
+
+	memcpy(pose.vecPosition, state.position, sizeof state.position);
+	pose.qRotation = state.rotation;
+}
+
+// SteamVR already extrapolates every pose from its time to the frame's with the pose's own
+// velocities, so claiming the pose is older by the prediction gets it moved ahead that much more,
+// by the same rule that covers all other motion.
+void PoseFilters::Predict(Stage &stage, vr::DriverPose_t &pose)
+{
+	pose.poseTimeOffset -= stage.config.params[0];
+}
+
+// Late fusion of two systems tracking one body part. The source's latest pose, moved by the
+// offset, is where this device should be, and the two are blended in world space.
+void PoseFilters::Blend(Stage &stage, vr::DriverPose_t &pose, double time)
+{
+	auto &config = stage.config;
+	double weight = config.params[0], maxAge = config.params[1];
+
+	double sourcePosition[3], sourceTime;
+	vr::HmdQuaternion_t sourceRotation;
+	if (!ReadSource(config.sourceID, sourcePosition, sourceRotation, sourceTime) || time - sourceTime > maxAge)
+		return;
+
+	double position[3];
+	vr::HmdQuaternion_t rotation;
+	WorldFromDriver(pose, position, rotation);
+
+	double offset[3] = { config.offsetTranslation.v[0], config.offsetTranslation.v[1], config.offsetTranslation.v[2] };
+	auto implied = quaternionRotateVector(sourceRotation, offset);
+	for (int i = 0; i < 3; i++)
+		position[i] += weight * (implied.v[i] + sourcePosition[i] - position[i]);
+	rotation = quaternionSlerp(rotation, sourceRotation * config.offsetRotation, weight);
+
+	DriverFromWorld(pose, position, rotation);
+}
+
+// Both systems measure the same body part, so each world axis gets a constant velocity Kalman
+// filter fed with this device's position and with the one the source's pose implies, weighted by
+// their noise. Rotations are blended by the same weights without smoothing over time. A source
+// that stops tracking leaves this device on its own measurements, and a device that stops
+// tracking is carried on the source's alone. Returns false when neither is tracking.
+bool PoseFilters::Fuse(Stage &stage, vr::DriverPose_t &pose, double time, bool tracked)
+{
+	auto &state = stage.state;
+	auto &config = stage.config;
+	double targetVariance = config.params[0] * config.params[0], sourceVariance = config.params[1] * config.params[1];
+	double accelerationVariance = config.params[2] * config.params[2];
+
+	double sourcePosition[3], sourceTime, implied[3];
+	vr::HmdQuaternion_t sourceRotation, impliedRotation;
+	bool sourced = ReadSource(config.sourceID, sourcePosition, sourceRotation, sourceTime) && time - sourceTime <= MaxFusionSourceAge;
+	if (!tracked && !sourced)
+		return false;
+
+	if (sourced)
+	{
+		double offset[3] = { config.offsetTranslation.v[0], config.offsetTranslation.v[1], config.offsetTranslation.v[2] };
+		auto rotated = quaternionRotateVector(sourceRotation, offset);
+		for (int i = 0; i < 3; i++)
+			implied[i] = rotated.v[i] + sourcePosition[i];
+		impliedRotation = sourceRotation * config.offsetRotation;
+	}
+
+	double measured[3];
+	vr::HmdQuaternion_t rotation;
+	if (tracked)
+		WorldFromDriver(pose, measured, rotation);
+
+	double dt = time - state.time;
+	if (!state.initialized || dt > MaxFilterGap || dt < 0)
+	{
+		state.initialized = true;
+		memcpy(state.position, tracked ? measured : implied, sizeof state.position);
+		for (int i = 0; i < 3; i++)
+		{
+			state.velocity[i] = 0;
+			state.covariance[i][0] = tracked ? targetVariance : sourceVariance;
+			state.covariance[i][1] = 0;
+			state.covariance[i][2] = 1.0; // (m/s)^2, the filter knows nothing about the speed yet.
+		}
+		state.sourceTime = sourced ? sourceTime : 0;
+	}
+	else
+	{
+		// Every source pose is fused in once, a device updating faster than its source would
+		// otherwise be pulled toward that system by the same measurement again and again.
+		bool sourceMeasured = sourced && sourceTime != state.sourceTime;
+		if (sourceMeasured)
+			state.sourceTime = sourceTime;
+
+		double dt2 = dt * dt;
+		for (int i = 0; i < 3; i++)
+		{
+			auto &covariance = state.covariance[i];
+			state.position[i] += state.velocity[i] * dt;
+			covariance[0] += dt * (2.0 * covariance[1] + dt * covariance[2]) + accelerationVariance * dt2 * dt2 / 4.0;
+			covariance[1] += dt * covariance[2] + accelerationVariance * dt2 * dt / 2.0;
+			covariance[2] += accelerationVariance * dt2;
+
+			if (tracked)
+				KalmanUpdate(state.position[i], state.velocity[i], covariance, measured[i], targetVariance);
+			if (sourceMeasured)
+				KalmanUpdate(state.position[i], state.velocity[i], covariance, implied[i], sourceVariance);
+		}
+	}
+	state.time = time;
+
+	if (!tracked)
+		rotation = impliedRotation;
+	else if (sourced)
+		rotation = quaternionSlerp(rotation, impliedRotation, targetVariance / (targetVariance + sourceVariance));
+	state.rotation = rotation;
+
+	DriverFromWorld(pose, state.position, rotation);
+	if (!tracked)
+		MarkCarried(pose, state.velocity);
+	return true;
+}
+
+// Keeps the offset from the source to this device in its frame, position and rotation of the
+// state, and while the device is not tracking stands in the source's latest pose moved by it. With
+// learning the offset follows the one measured whenever both track, starting from the first such
+// pose, so a device strapped on differently than it was calibrated still lands where it is. Both
+// are a few multiplies on the stage's own state, tracked poses pass unchanged.
+bool PoseFilters::Fallback(Stage &stage, vr::DriverPose_t &pose, double time, bool tracked)
+{
+	auto &state = stage.state;
+	auto &config = stage.config;
+	double maxAge = config.params[0], learning = config.params[1];
+
+	if (!state.initialized)
+	{
+		state.initialized = true;
+		state.offsetMeasured = false;
+		for (int i = 0; i < 3; i++)
+			state.position[i] = config.offsetTranslation.v[i];
+		state.rotation = config.offsetRotation;
+	}
+
+	double sourcePosition[3], sourceTime;
+	vr::HmdQuaternion_t sourceRotation;
+	bool sourced = ReadSource(config.sourceID, sourcePosition, sourceRotation, sourceTime) && time - sourceTime <= maxAge;
+
+	if (tracked)
+	{
+		if (sourced && learning > 0)
+		{
+			double position[3], delta[3];
+			vr::HmdQuaternion_t rotation;
+			WorldFromDriver(pose, position, rotation);
+			for (int i = 0; i < 3; i++)
+				delta[i] = position[i] - sourcePosition[i];
+
+			auto sourceFromWorld = Conjugate(sourceRotation);
+			auto offset = quaternionRotateVector(sourceFromWorld, delta);
+			double weight = state.offsetMeasured ? learning : 1.0;
+			for (int i = 0; i < 3; i++)
+				state.position[i] += weight * (offset.v[i] - state.position[i]);
+			state.rotation = quaternionSlerp(state.rotation, sourceFromWorld * rotation, weight);
+			state.offsetMeasured = true;
+		}
+		return true;
+	}
+
+	if (!sourced)
+		return false;
+
+	double position[3];
+	auto rotated = quaternionRotateVector(sourceRotation, state.position);
+	for (int i = 0; i < 3; i++)
+		position[i] = rotated.v[i] + sourcePosition[i];
+
+	DriverFromWorld(pose, position, sourceRotation * state.rotation);
+	double still[3] = { 0, 0, 0 };
+	MarkCarried(pose, still);
+	return true;
+}
+
+// The source rides the motion platform, so how it moved from its neutral pose is how the
+// platform moved. Taking that out of this device's world pose leaves only its motion against the
+// platform, e.g. the head of a seated player. The source's latest pose comes from the slot its own
+// pose hook fills, so this runs at the device's pose rate without waiting for anything. A source
+// that stops reporting leaves the last correction in place rather than snapping back.
+void PoseFilters::Compensate(Stage &stage, vr::DriverPose_t &pose, double time)
+{
+	auto &state = stage.state;
+	auto &config = stage.config;
+
+	double sourcePosition[3], sourceTime;
+	vr::HmdQuaternion_t sourceRotation;
+	if (ReadSource(config.sourceID, sourcePosition, sourceRotation, sourceTime) && time - sourceTime <= config.params[0])
+	{
+		// neutral * source^-1, mapping where the platform is now back to where it was.
+		state.rotation = config.offsetRotation * Conjugate(sourceRotation);
+		auto rotated = quaternionRotateVector(state.rotation, sourcePosition);
+		for (int i = 0; i < 3; i++)
+			state.position[i] = config.offsetTranslation.v[i] - rotated.v[i];
+		state.initialized = true;
+	}
+	if (!state.initialized)
+		return;
+
+	double position[3];
+	vr::HmdQuaternion_t rotation;
+	WorldFromDriver(pose, position, rotation);
+	auto moved = quaternionRotateVector(state.rotation, position);
+	for (int i = 0; i < 3; i++)
+		position[i] = moved.v[i] + state.position[i];
+	DriverFromWorld(pose, position, state.rotation * rotation);
+
+	// Velocities are in driver space and turn along. The platform's own motion stays in them,
+	// SteamVR only extrapolates a few ms with them.
+	auto turn = Conjugate(pose.qWorldFromDriverRotation) * state.rotation * pose.qWorldFromDriverRotation;
+	RotateInPlace(turn, pose.vecVelocity);
+	RotateInPlace(turn, pose.vecAcceleration);
+	RotateInPlace(turn, pose.vecAngularVelocity);
+	RotateInPlace(turn, pose.vecAngularAcceleration);
+}
+
+void PoseFilters::Record(uint32_t openVRID, const vr::DriverPose_t &pose, double time)
+{
+	if (!pose.poseIsValid || pose.result != vr::TrackingResult_Running_OK)
+		return;
+
+	auto &source = sources[openVRID];
+	uint32_t sequence = source.sequence.load(std::memory_order_relaxed);
+	source.sequence.store(sequence + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	source.time = time;
+	WorldFromDriver(pose, source.position, source.rotation);
+	source.sequence.store(sequence + 2, std::memory_order_release);
+}
+
+// Gives up instead of retrying when the source is being written, the next pose tries again.
+bool PoseFilters::ReadSource(uint32_t openVRID, double (&position)[3], vr::HmdQuaternion_t &rotation, double &time) const
+{
+	auto &source = sources[openVRID];
+	uint32_t before = source.sequence.load(std::memory_order_acquire);
+	if (before == 0 || (before & 1))
+		return false;
+
+	memcpy(position, source.position, sizeof position);
+	rotation = source.rotation;
+	time = source.time;
+	std::atomic_thread_fence(std::memory_order_acquire);
+	return source.sequence.load(std::memory_order_relaxed) == before;
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "../Protocol.h"
+
+#include <atomic>
+#include <mutex>
+
+/**
+ * Per-device filter chains run by the pose hook on poses that already have their transform.
+ * Every device has a fixed array of stages, so configuring a chain never allocates on the pose
+ * thread, and a stage is picked with a switch on its type rather than a virtual call. Devices
+ * without filters only cost a test of activeMask.
+ *
+ * Configure runs on an IPC thread and only publishes the device's pending chain. The pose
+ * thread takes it over with the next pose, starting the stages from that pose. It never waits
+ * for Configure: the pending chains are double buffered behind a sequence like the transform
+ * tables, see protocol::TransformBuffer, and one overtaken while it's copied is taken with a
+ * later pose.
+ */
+class PoseFilters
+{
+public:
+	PoseFilters();
+
+	// Returns false for an invalid configuration, which is ignored.
+	bool Configure(const protocol::SetPoseFilters &config);
+
+	bool Active(uint32_t openVRID) const { return (activeMask.load(std::memory_order_relaxed) >> openVRID) & 1; }
+	bool Any() const { return (activeMask.load(std::memory_order_relaxed) | sourceMask.load(std::memory_order_relaxed)) != 0; }
+
+	// time is in seconds on the QueryPerformanceCounter clock.
+	void Apply(uint32_t openVRID, vr::DriverPose_t &pose, double time);
+
+	// Keeps the world space pose of devices other chains blend in, call with every pose that
+	// goes back to SteamVR.
+	bool Recorded(uint32_t openVRID) const { return (sourceMask.load(std::memory_order_relaxed) >> openVRID) & 1; }
+	void Record(uint32_t openVRID, const vr::DriverPose_t &pose, double time);
+
+private:
+	struct StageState
+	{
+		bool initialized;
+		double time;
+		double position[3];
+		vr::HmdQuaternion_t rotation;
+		double velocity[3]; // OneEuro: smoothed, m/s.
+		double angularSpeed; // OneEuro: smoothed, rad/s.
+		vr::HmdQuaternion_t lastRotation; // OneEuro: the unfiltered one.
+		double covariance[3][3]; // Fusion: of position and velocity per axis, as p p, p v and v v.
+		double sourceTime; // Fusion: of the last source pose fused in.
+		bool offsetMeasured; // Fallback: position and rotation hold an offset learned from both tracking.
+		// Compensate: position and rotation hold the last correction, initialized once there is one.
+	};
+
+	struct Stage
+	{
+		protocol::PoseFilterStage config;
+		StageState state;
+	};
+
+	// Only touched by the pose thread.
+	struct Chain
+	{
+		uint32_t count;
+		uint32_t sequence; // Of the pending chain taken over last.
+		Stage stages[protocol::MaxPoseFilterStages];
+	};
+
+	struct WorldPose
+	{
+		std::atomic<uint32_t> sequence; // Odd while being written. Read by the threads of other devices.
+		double time;
+		double position[3];
+		vr::HmdQuaternion_t rotation;
+	};
+
+	void TakeConfiguration(uint32_t openVRID, Chain &chain);
+	void RunStage(Stage &stage, vr::DriverPose_t &pose, double time);
+	static void OneEuro(Stage &stage, vr::DriverPose_t &pose, double time);
+	static void Jitter(Stage &stage, vr::DriverPose_t &pose);
+	static void Predict(Stage &stage, vr::DriverPose_t &pose);
+	void Blend(Stage &stage, vr::DriverPose_t &pose, double time);
+	bool Fuse(Stage &stage, vr::DriverPose_t &pose, double time, bool tracked);
+	bool Fallback(Stage &stage, vr::DriverPose_t &pose, double time, bool tracked);
+	bool Carry(Stage &stage, vr::DriverPose_t &pose, double time);
+	void Compensate(Stage &stage, vr::DriverPose_t &pose, double time);
+	bool ReadSource(uint32_t openVRID, double (&position)[3], vr::HmdQuaternion_t &rotation, double &time) const;
+
+	std::atomic<uint64_t> activeMask, sourceMask;
+
+	std::mutex configMutex; // Between IPC threads, the pose thread never takes it.
+	protocol::SetPoseFilters configured[vr::k_unMaxTrackedDeviceCount]; // The latest of each device, under configMutex.
+	protocol::SetPoseFilters pending[vr::k_unMaxTrackedDeviceCount][2]; // Published as pendingSequence & 1.
+	std::atomic<uint32_t> pendingSequence[vr::k_unMaxTrackedDeviceCount];
+
+	alignas(64) Chain chains[vr::k_unMaxTrackedDeviceCount];
+	alignas(64) WorldPose sources[vr::k_unMaxTrackedDeviceCount];
+};
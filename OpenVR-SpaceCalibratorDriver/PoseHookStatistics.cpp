@@ -0,0 +1,164 @@
+#include "PoseHookStatistics.h"
+
+#include <intrin.h>
+#include <cstring>
+#include <cmath>
+
+#pragma intrinsic(_BitScanReverse64)
+
+PoseHookStatistics::PoseHookStatistics()
+{
+	for (auto &counters : threads)
+	{
+		counters.writers = 0;
+		counters.calls = 0;
+		counters.totalNanoseconds = 0;
+		counters.maxNanoseconds = 0;
+		counters.transformedPoses = 0;
+		for (auto &bucket : counters.latencyHistogram)
+			bucket = 0;
+		for (auto &updates : counters.deviceUpdates)
+			updates = 0;
+	}
+	threadCount = 0;
+
+	for (auto &timing : deviceTimings)
+	{
+		timing.lastTicks = 0;
+		timing.interval = 0.0;
+		timing.jitter = 0.0;
+		timing.padding = 0;
+	}
+
+	LARGE_INTEGER frequency;
+	QueryPerformanceFrequency(&frequency);
+	nanosecondsPerTick = 1e9 / (double) frequency.QuadPart;
+	secondsPerTick = 1.0 / (double) frequency.QuadPart;
+}
+
+PoseHookStatistics::ThreadCounters &PoseHookStatistics::CountersForThread()
+{
+	// Thread local index into threads, claimed the first time a thread records.
+	static thread_local int index = -1;
+	if (index < 0)
+	{
+		index = threadCount.fetch_add(1, std::memory_order_relaxed);
+		if (index >= MaxThreads)
+			index = MaxThreads - 1;
+		threads[index].writers.fetch_add(1, std::memory_order_relaxed);
+	}
+	return threads[index];
+}
+
+// A block with a single writer only needs a load and a store, a shared one falls back to a locked add.
+void PoseHookStatistics::Add(ThreadCounters &counters, std::atomic<uint64_t> &counter, uint64_t value)
+{
+	if (counters.writers.load(std::memory_order_relaxed) == 1)
+		counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+	else
+		counter.fetch_add(value, std::memory_order_relaxed);
+}
+
+void PoseHookStatistics::Record(uint32_t openVRID, bool transformed, uint64_t startTicks, uint64_t endTicks)
+{
+	auto &counters = CountersForThread();
+	uint64_t nanoseconds = (uint64_t) ((double) (endTicks - startTicks) * nanosecondsPerTick);
+
+	unsigned long bucket = 0;
+	if (nanoseconds > 0)
+		_BitScanReverse64(&bucket, nanoseconds);
+	if (bucket >= protocol::PoseHookLatencyBuckets)
+		bucket = protocol::PoseHookLatencyBuckets - 1;
+
+	Add(counters, counters.calls, 1);
+	Add(counters, counters.totalNanoseconds, nanoseconds);
+	Add(counters, counters.latencyHistogram[bucket], 1);
+	if (openVRID < vr::k_unMaxTrackedDeviceCount)
+	{
+		Add(counters, counters.deviceUpdates[openVRID], 1);
+		RecordInterval(deviceTimings[openVRID], startTicks);
+	}
+	if (transformed)
+		Add(counters, counters.transformedPoses, 1);
+
+	uint64_t max = counters.maxNanoseconds.load(std::memory_order_relaxed);
+	while (nanoseconds > max && !counters.maxNanoseconds.compare_exchange_weak(max, nanoseconds, std::memory_order_relaxed)) { }
+}
+
+void PoseHookStatistics::RecordInterval(DeviceTiming &timing, uint64_t ticks)
+{
+	uint64_t last = timing.lastTicks.load(std::memory_order_relaxed);
+	timing.lastTicks.store(ticks, std::memory_order_relaxed);
+	if (!last || ticks <= last)
+		return;
+
+	// A gap is tracking loss or a device waking up, the averages keep what they had before it.
+	double interval = (double) (ticks - last) * secondsPerTick;
+	if (interval > protocol::PoseRateMaxGap)
+		return;
+
+	double mean = timing.interval.load(std::memory_order_relaxed);
+	if (mean == 0.0)
+	{
+		timing.interval.store(interval, std::memory_order_relaxed);
+		return;
+	}
+
+	double deviation = interval - mean;
+	double jitter = timing.jitter.load(std::memory_order_relaxed);
+	timing.interval.store(mean + deviation * RateSmoothing, std::memory_order_relaxed);
+	timing.jitter.store(jitter + (std::abs(deviation) - jitter) * RateSmoothing, std::memory_order_relaxed);
+}
+
+void PoseHookStatistics::SnapshotRates(protocol::DevicePoseRate (&rates)[vr::k_unMaxTrackedDeviceCount]) const
+{
+	memset(rates, 0, sizeof rates);
+	uint64_t now = Now();
+
+	for (uint32_t i = 0; i < vr::k_unMaxTrackedDeviceCount; i++)
+	{
+		auto &timing = deviceTimings[i];
+		auto &rate = rates[i];
+		uint64_t last = timing.lastTicks.load(std::memory_order_relaxed);
+		double interval = timing.interval.load(std::memory_order_relaxed);
+		double jitter = timing.jitter.load(std::memory_order_relaxed);
+		if (!last)
+			continue;
+
+		double sinceLast = now > last ? (double) (now - last) * secondsPerTick : 0.0;
+		rate.interval = (float) interval;
+		rate.jitter = (float) jitter;
+		rate.sinceLast = (float) sinceLast;
+
+		if (sinceLast > std::max(protocol::PoseRateMaxGap, interval * protocol::PoseRateStallIntervals))
+			rate.rateClass = protocol::PoseRateStalled;
+		else if (interval == 0.0)
+			rate.rateClass = protocol::PoseRateUnknown;
+		else if (jitter > interval * protocol::PoseRateIrregularJitter)
+			rate.rateClass = protocol::PoseRateIrregular;
+		else
+			rate.rateClass = protocol::PoseRateSteady;
+	}
+}
+
+void PoseHookStatistics::Snapshot(protocol::PoseHookStats &stats) const
+{
+	memset(&stats, 0, sizeof stats);
+	stats.timestamp = (double) Now() * secondsPerTick;
+
+	for (auto &counters : threads)
+	{
+		stats.calls += counters.calls.load(std::memory_order_relaxed);
+		stats.totalNanoseconds += counters.totalNanoseconds.load(std::memory_order_relaxed);
+		stats.transformedPoses += counters.transformedPoses.load(std::memory_order_relaxed);
+
+		uint64_t max = counters.maxNanoseconds.load(std::memory_order_relaxed);
+		if (max > stats.maxNanoseconds)
+			stats.maxNanoseconds = max;
+
+		for (uint32_t i = 0; i < protocol::PoseHookLatencyBuckets; i++)
+			stats.latencyHistogram[i] += counters.latencyHistogram[i].load(std::memory_order_relaxed);
+		for (uint32_t i = 0; i < vr::k_unMaxTrackedDeviceCount; i++)
+			stats.deviceUpdates[i] += counters.deviceUpdates[i].load(std::memory_order_relaxed);
+	}
+}
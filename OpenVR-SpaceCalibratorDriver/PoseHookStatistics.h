@@ -0,0 +1,70 @@
+#pragma once
+
+#include "../Protocol.h"
+
+#include <atomic>
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+/**
+ * Timing and update counters for the pose hook. Each thread that calls Record gets its own
+ * cache-line aligned block of counters, so recording never contends with another thread and
+ * only needs relaxed stores. Snapshot sums all blocks and may run concurrently with Record.
+ *
+ * Record also keeps each device's pose interval and its jitter as exponential moving averages,
+ * a few multiplies per pose on a line shared with one other device. A device's poses come
+ * from one driver thread, so these are plain relaxed stores too. SnapshotRates classifies the
+ * devices from them, which is what the client's pairing and latency estimates can go by.
+ */
+class PoseHookStatistics
+{
+public:
+	PoseHookStatistics();
+
+	static uint64_t Now()
+	{
+		LARGE_INTEGER now;
+		QueryPerformanceCounter(&now);
+		return (uint64_t) now.QuadPart;
+	}
+
+	void Record(uint32_t openVRID, bool transformed, uint64_t startTicks, uint64_t endTicks);
+	void Snapshot(protocol::PoseHookStats &stats) const;
+	void SnapshotRates(protocol::DevicePoseRate (&rates)[vr::k_unMaxTrackedDeviceCount]) const;
+
+private:
+	// SteamVR calls the hook from a few driver threads, any beyond this share the last block.
+	static const int MaxThreads = 16;
+
+	struct alignas(64) ThreadCounters
+	{
+		std::atomic<int> writers;
+		std::atomic<uint64_t> calls;
+		std::atomic<uint64_t> totalNanoseconds;
+		std::atomic<uint64_t> maxNanoseconds;
+		std::atomic<uint64_t> transformedPoses;
+		std::atomic<uint64_t> latencyHistogram[protocol::PoseHookLatencyBuckets];
+		std::atomic<uint64_t> deviceUpdates[vr::k_unMaxTrackedDeviceCount];
+	};
+
+	// Weight of the newest interval in the averages.
+	static constexpr double RateSmoothing = 1.0 / 32.0;
+
+	struct DeviceTiming
+	{
+		std::atomic<uint64_t> lastTicks; // 0 before the first pose.
+		std::atomic<double> interval, jitter; // seconds
+		uint64_t padding;
+	};
+
+	ThreadCounters &CountersForThread();
+	void RecordInterval(DeviceTiming &timing, uint64_t ticks);
+	static void Add(ThreadCounters &counters, std::atomic<uint64_t> &counter, uint64_t value);
+
+	ThreadCounters threads[MaxThreads];
+	alignas(64) DeviceTiming deviceTimings[vr::k_unMaxTrackedDeviceCount];
+	std::atomic<int> threadCount;
+	double nanosecondsPerTick;
+	double secondsPerTick;
+};
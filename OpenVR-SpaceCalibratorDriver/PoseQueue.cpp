@@ -0,0 +1,64 @@
+#include "PoseQueue.h"
+
+static_assert((PoseQueue::Capacity & (PoseQueue::Capacity - 1)) == 0, "pose queue capacity must be a power of two");
+
+PoseQueue::PoseQueue()
+{
+	for (auto &ring : rings)
+	{
+		ring.head = 0;
+		ring.cachedTail = 0;
+		ring.pushed = 0;
+		ring.overflows = 0;
+		ring.tail = 0;
+	}
+	ringCount = 0;
+	unattached = 0;
+}
+
+PoseQueue::Ring *PoseQueue::RingForThread()
+{
+	// Thread local index into rings, claimed the first time a thread pushes.
+	static thread_local int index = -1;
+	if (index < 0)
+		index = ringCount.fetch_add(1, std::memory_order_acq_rel);
+	return index < MaxProducers ? &rings[index] : nullptr;
+}
+
+bool PoseQueue::Push(const protocol::PoseCaptureSample &sample)
+{
+	Ring *ring = RingForThread();
+	if (!ring)
+	{
+		unattached.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+
+	// The consumer's position is only read again once the ring looks full.
+	uint64_t head = ring->head.load(std::memory_order_relaxed);
+	if (head - ring->cachedTail >= Capacity)
+	{
+		ring->cachedTail = ring->tail.load(std::memory_order_acquire);
+		if (head - ring->cachedTail >= Capacity)
+		{
+			ring->overflows.store(ring->overflows.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+			return false;
+		}
+	}
+
+	ring->records[head & (Capacity - 1)] = sample;
+	ring->head.store(head + 1, std::memory_order_release);
+	ring->pushed.store(ring->pushed.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+	return true;
+}
+
+void PoseQueue::Snapshot(protocol::PoseHookStats &stats) const
+{
+	stats.queuedPoses = 0;
+	stats.queueOverflows = unattached.load(std::memory_order_relaxed);
+	for (auto &ring : rings)
+	{
+		stats.queuedPoses += ring.pushed.load(std::memory_order_relaxed);
+		stats.queueOverflows += ring.overflows.load(std::memory_order_relaxed);
+	}
+}
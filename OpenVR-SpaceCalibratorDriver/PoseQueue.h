@@ -0,0 +1,67 @@
+#pragma once
+
+#include "../Protocol.h"
+
+#include <atomic>
+
+/**
+ * Hands captured poses from the pose hook to a consumer inside the driver, such as the
+ * continuous calibrator. Each thread that pushes gets a fixed ring of its own, so every ring
+ * has a single producer and a single consumer and a push is a copy and a release store. It
+ * never blocks or allocates: a full ring drops the pose and counts it instead. Drain must only
+ * be called from one thread at a time.
+ */
+class PoseQueue
+{
+public:
+	static const uint32_t Capacity = 1024; // Per producer thread, a power of two.
+
+	PoseQueue();
+
+	// From the pose hook. Returns false when the pose was dropped.
+	bool Push(const protocol::PoseCaptureSample &sample);
+
+	// Calls fn with every queued pose, oldest first within each producer.
+	template<typename Fn>
+	void Drain(Fn fn)
+	{
+		int count = ringCount.load(std::memory_order_acquire);
+		for (int i = 0; i < count && i < MaxProducers; i++)
+		{
+			auto &ring = rings[i];
+			uint64_t tail = ring.tail.load(std::memory_order_relaxed);
+			uint64_t head = ring.head.load(std::memory_order_acquire);
+			for (; tail != head; tail++)
+				fn(ring.records[tail & (Capacity - 1)]);
+			ring.tail.store(tail, std::memory_order_release);
+		}
+	}
+
+	// Drops everything queued so far.
+	void Discard() { Drain([](const protocol::PoseCaptureSample &) { }); }
+
+	void Snapshot(protocol::PoseHookStats &stats) const;
+
+private:
+	// SteamVR calls the hook from a few driver threads, poses from any beyond this are dropped.
+	static const int MaxProducers = 8;
+
+	// head and tail live on separate cache lines, so the producer and the consumer only share
+	// a line when one of them actually needs the other's position.
+	struct Ring
+	{
+		alignas(64) std::atomic<uint64_t> head; // Written by the producer.
+		uint64_t cachedTail; // The producer's last look at tail.
+		std::atomic<uint64_t> pushed, overflows; // Only written by the producer.
+
+		alignas(64) std::atomic<uint64_t> tail; // Written by the consumer.
+
+		alignas(64) protocol::PoseCaptureSample records[Capacity];
+	};
+
+	Ring *RingForThread();
+
+	Ring rings[MaxProducers];
+	std::atomic<int> ringCount;
+	std::atomic<uint64_t> unattached; // Poses from threads that didn't get a ring.
+};
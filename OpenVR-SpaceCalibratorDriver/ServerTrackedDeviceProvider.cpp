@@ -1,75 +1,574 @@
 #include "ServerTrackedDeviceProvider.h"
 #include "Logging.h"
 #include "InterfaceHookInjector.h"
+#include "ThreadQoS.h"
+#include "../QuaternionMath.h"
+#include "../Instrumentation.h"
+
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <malloc.h>
 
 vr::EVRInitError ServerTrackedDeviceProvider::Init(vr::IVRDriverContext *pDriverContext)
 {
-	TRACE("ServerTrackedDeviceProvider::Init()");
+	TRACE(protocol::TraceLifecycle, "ServerTrackedDeviceProvider::Init()");
 	VR_INIT_SERVER_DRIVER_CONTEXT(pDriverContext);
+	StartLogThread();
+	SPACECAL_INSTRUMENTATION_START();
 
-	memset(transforms, 0, vr::k_unMaxTrackedDeviceCount * sizeof DeviceTransform);
+	memset(composedTransforms, 0, sizeof composedTransforms);
+	memset(nextCaptureTicks, 0, sizeof nextCaptureTicks);
+	devicesSeen = 0;
+	devicesDeactivated = 0;
+	clientConnected = false;
+	poseHookMode = protocol::PoseHookAlways;
+	poseHooksEnabled = true;
+	poseHooksIdleSince = 0;
 
+	OpenSharedMemory();
+	continuousCalibrator.Init(shared, &poseQueue);
+	transformCache.Load();
 	InjectHooks(this, pDriverContext);
-	server.Run();
+
+	// Only the hooks must be in place before SteamVR loads the next driver. The client keeps
+	// retrying until the pipe shows up.
+	serverStartup = std::thread([this] {
+		SetCurrentThreadRole(L"SpaceCalibrator IPC startup", ThreadRole::IPC);
+		server.Run();
+	});
 
 	return vr::VRInitError_None;
 }
 
 void ServerTrackedDeviceProvider::Cleanup()
 {
-	TRACE("ServerTrackedDeviceProvider::Cleanup()");
+	TRACE(protocol::TraceLifecycle, "ServerTrackedDeviceProvider::Cleanup()");
+	if (serverStartup.joinable())
+		serverStartup.join();
 	server.Stop();
+	continuousCalibrator.Stop();
 	DisableHooks();
+	transformCache.Flush(shared->transforms);
+	CloseSharedMemory();
+	SPACECAL_INSTRUMENTATION_STOP();
+	StopLogThread();
 	VR_CLEANUP_SERVER_DRIVER_CONTEXT();
 }
 
-inline vr::HmdQuaternion_t operator*(const vr::HmdQuaternion_t &lhs, const vr::HmdQuaternion_t &rhs) {
-	return {
-		(lhs.w * rhs.w) - (lhs.x * rhs.x) - (lhs.y * rhs.y) - (lhs.z * rhs.z),
-		(lhs.w * rhs.x) + (lhs.x * rhs.w) + (lhs.y * rhs.z) - (lhs.z * rhs.y),
-		(lhs.w * rhs.y) + (lhs.y * rhs.w) + (lhs.z * rhs.x) - (lhs.x * rhs.z),
-		(lhs.w * rhs.z) + (lhs.z * rhs.w) + (lhs.x * rhs.y) - (lhs.y * rhs.x)
-	};
+// SteamVR's frame loop never waits for writeLock: a client killed while it holds the lock
+// would stall it until the lock is broken. While someone else has it, the work below waits for
+// the next frame, deactivated devices keep their bits until then.
+void ServerTrackedDeviceProvider::RunFrame()
+{
+	uint64_t released = 0;
+	if (shared->transforms.TryLock())
+	{
+		DeactivateDevices();
+
+		uint64_t seen = devicesSeen.load(std::memory_order_relaxed);
+		transformCache.Update(shared->transforms, seen, !clientConnected);
+		trackingSystemRules.Update(shared->transforms, seen);
+		released = shared->transforms.ReleaseExpiredLocked(GetTickCount64());
+		shared->transforms.Unlock();
+
+		transformCache.WritePending();
+	}
+	UpdatePoseHooks();
+
+	for (uint32_t id = 0; released; id++, released >>= 1)
+	{
+		if (released & 1)
+			LOG("Device %d released, its writer stopped writing it", id);
+	}
+}
+
+// Whatever connects next under a disconnected device's ID is another device, as far as anyone
+// can tell, so it starts from nothing: no transform, no filters, and looked up again by rules
+// and the cache once it reports a pose. Transforms still on their way for the old device are
+// skipped by their generation, see protocol::TransformBuffer::DeactivateLocked. Called with
+// writeLock held.
+void ServerTrackedDeviceProvider::DeactivateDevices()
+{
+	uint64_t deactivated = devicesDeactivated.exchange(0, std::memory_order_relaxed);
+	for (uint32_t id = 0; deactivated; id++, deactivated >>= 1)
+	{
+		if (!(deactivated & 1))
+			continue;
+
+		transformCache.Forget(id, shared->transforms);
+		trackingSystemRules.Forget(id);
+		shared->transforms.DeactivateLocked(id);
+
+		protocol::SetPoseFilters noFilters = {};
+		noFilters.openVRID = id;
+		poseFilters.Configure(noFilters);
+		LOG("Device %d disconnected, its ID starts over as generation %d", id, (int) shared->transforms.Generation(id));
+	}
+}
+
+// Rules and restored transforms find new devices by their first pose, so they need the hooks
+// as much as the devices that are transformed, filtered or captured already.
+bool ServerTrackedDeviceProvider::PoseHooksNeeded() const
+{
+	return poseHookMode.load(std::memory_order_relaxed) != protocol::PoseHookWhenNeeded ||
+		shared->transforms.AnyEnabled() ||
+		!trackingSystemRules.Empty() ||
+		poseFilters.Any() ||
+		shared->poseCapture.deviceMask.load(std::memory_order_relaxed) != 0 ||
+		continuousCalibrator.CaptureMask() != 0;
+}
+
+// Patching stops every other thread of the server for a moment, so the hooks only come out
+// after a while without anything needing them, and go back in at once.
+static const double PoseHooksIdleDelay = 1.0; // seconds
+
+void ServerTrackedDeviceProvider::UpdatePoseHooks()
+{
+	if (PoseHooksNeeded())
+	{
+		poseHooksIdleSince = 0;
+		if (!poseHooksEnabled)
+		{
+			SetPoseHooksEnabled(true);
+			poseHooksEnabled = true;
+		}
+		return;
+	}
+
+	if (!poseHooksEnabled)
+		return;
+
+	uint64_t now = PoseHookStatistics::Now();
+	if (!poseHooksIdleSince)
+	{
+		poseHooksIdleSince = now;
+		return;
+	}
+
+	if ((double) (now - poseHooksIdleSince) >= PoseHooksIdleDelay * performanceFrequency)
+	{
+		SetPoseHooksEnabled(false);
+		poseHooksEnabled = false;
+	}
+}
+
+void ServerTrackedDeviceProvider::OpenSharedMemory()
+{
+	LARGE_INTEGER frequency;
+	QueryPerformanceFrequency(&frequency);
+	performanceFrequency = (double) frequency.QuadPart;
+	ticksPerMicrosecond = performanceFrequency / 1e6;
+
+	sharedMapping = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, 0, sizeof(protocol::SharedMemory), OPENVR_SPACECALIBRATOR_SHARED_MEMORY_NAME);
+	if (!sharedMapping)
+	{
+		LOG("CreateFileMapping failed for shared memory. Error: %d", GetLastError());
+	}
+	else
+	{
+		shared = (protocol::SharedMemory *) MapViewOfFile(sharedMapping, FILE_MAP_ALL_ACCESS, 0, 0, sizeof(protocol::SharedMemory));
+		if (!shared)
+		{
+			LOG("MapViewOfFile failed for shared memory. Error: %d", GetLastError());
+			CloseHandle(sharedMapping);
+			sharedMapping = nullptr;
+		}
+	}
+
+	if (!shared)
+	{
+		// Aligned like a mapped view would be, the buffers keep their members on separate cache lines.
+		shared = (protocol::SharedMemory *) _aligned_malloc(sizeof(protocol::SharedMemory), alignof(protocol::SharedMemory));
+		memset(shared, 0, sizeof(protocol::SharedMemory));
+		sharedIsLocal = true;
+	}
+
+	SetTraceCategoryFlags(&shared->traceCategories);
+	shared->layout.store(protocol::SharedMemoryLayout, std::memory_order_release);
+}
+
+void ServerTrackedDeviceProvider::CloseSharedMemory()
+{
+	SetTraceCategoryFlags(nullptr);
+
+	if (sharedIsLocal)
+		_aligned_free(shared);
+	else if (shared)
+		UnmapViewOfFile(shared);
+
+	if (sharedMapping)
+		CloseHandle(sharedMapping);
+
+	shared = nullptr;
+	sharedMapping = nullptr;
+	sharedIsLocal = false;
 }
 
-inline vr::HmdVector3d_t quaternionRotateVector(const vr::HmdQuaternion_t& quat, const double(&vector)[3]) {
-	vr::HmdQuaternion_t vectorQuat = { 0.0, vector[0], vector[1] , vector[2] };
-	vr::HmdQuaternion_t conjugate = { quat.w, -quat.x, -quat.y, -quat.z };
-	auto rotatedVectorQuat = quat * vectorQuat * conjugate;
-	return { rotatedVectorQuat.x, rotatedVectorQuat.y, rotatedVectorQuat.z };
+void ServerTrackedDeviceProvider::CapturePose(uint32_t openVRID, const vr::DriverPose_t &pose, uint64_t ticks)
+{
+	auto &poseCapture = shared->poseCapture;
+	uint64_t bit = 1ull << openVRID;
+	bool forClient = (poseCapture.deviceMask.load(std::memory_order_relaxed) & bit) != 0;
+	bool forCalibrator = (continuousCalibrator.CaptureMask() & bit) != 0;
+	if (!forClient && !forCalibrator)
+		return;
+
+	// Keeps to a steady grid of intervals, unless the device skipped one entirely.
+	uint32_t interval = poseCapture.minInterval[openVRID].load(std::memory_order_relaxed);
+	if (interval)
+	{
+		uint64_t &next = nextCaptureTicks[openVRID];
+		if (ticks < next)
+			return;
+
+		uint64_t step = (uint64_t) (interval * ticksPerMicrosecond);
+		next = ticks - next < step ? next + step : ticks + step;
+	}
+
+	protocol::PoseCaptureSample sample;
+	sample.openVRID = openVRID;
+	sample.valid = pose.poseIsValid;
+	sample.trackingResult = pose.result;
+
+	sample.timestamp = (double) ticks / performanceFrequency + pose.poseTimeOffset;
+
+	// world-from-driver * driver-from-device * device-from-head, matching what clients get as the raw pose.
+	double worldRotation[3][3], driverRotation[3][3], head[3], device[3];
+	quaternionToMatrix(pose.qWorldFromDriverRotation, worldRotation);
+	quaternionToMatrix(pose.qRotation, driverRotation);
+
+	matrixRotateVector(driverRotation, pose.vecDriverFromHeadTranslation, head);
+	for (int i = 0; i < 3; i++)
+		head[i] += pose.vecPosition[i];
+
+	matrixRotateVector(worldRotation, head, device);
+	for (int i = 0; i < 3; i++)
+		sample.position[i] = device[i] + pose.vecWorldFromDriverTranslation[i];
+
+	sample.rotation = pose.qWorldFromDriverRotation * pose.qRotation * pose.qDriverFromHeadRotation;
+
+	// Rotating into world space doesn't change magnitudes, which is all the client needs.
+	const double *v = pose.vecVelocity, *w = pose.vecAngularVelocity;
+	sample.linearSpeed = sqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+	sample.angularSpeed = sqrt(w[0] * w[0] + w[1] * w[1] + w[2] * w[2]);
+
+	if (forClient)
+		poseCapture.Publish(sample);
+	if (forCalibrator)
+		poseQueue.Push(sample);
 }
 
 void ServerTrackedDeviceProvider::SetDeviceTransform(const protocol::SetDeviceTransform &newTransform)
 {
-	auto &tf = transforms[newTransform.openVRID];
-	tf.enabled = newTransform.enabled;
+	TRACE(protocol::TraceTransforms, "SetDeviceTransform(%d) enabled %d", newTransform.openVRID, newTransform.enabled);
+	if (!shared->transforms.Write(&newTransform, 1))
+		LOG("SetDeviceTransform: invalid device id %d", newTransform.openVRID);
+}
+
+void ServerTrackedDeviceProvider::SetDeviceTransforms(const protocol::SetDeviceTransformBatch &batch)
+{
+	TRACE(protocol::TraceTransforms, "SetDeviceTransforms(%d transforms)", batch.count);
+	if (!shared->transforms.Write(batch.transforms, batch.count))
+		LOG("SetDeviceTransforms: batch of %d contained an invalid device id", batch.count);
+}
+
+void ServerTrackedDeviceProvider::GetPoseHookStats(protocol::PoseHookStats &stats) const
+{
+	poseHookStats.Snapshot(stats);
+	poseQueue.Snapshot(stats);
+}
+
+const vr::DriverPose_t *ServerTrackedDeviceProvider::HandleDevicePoseUpdated(uint32_t openVRID, const vr::DriverPose_t &pose, vr::DriverPose_t &transformed)
+{
+	if (openVRID >= vr::k_unMaxTrackedDeviceCount)
+		return &pose;
+
+	SPACECAL_ZONE("HandleDevicePoseUpdated");
+	uint64_t start = PoseHookStatistics::Now();
+	CapturePose(openVRID, pose, start);
+
+	uint64_t bit = 1ull << openVRID;
+	bool seen = (devicesSeen.load(std::memory_order_relaxed) & bit) != 0;
+	if (!pose.deviceIsConnected)
+	{
+		// Its ID may go to the next device that connects, RunFrame resets what it had.
+		if (seen)
+		{
+			devicesSeen.fetch_and(~bit, std::memory_order_relaxed);
+			shared->posedMask.fetch_and(~bit, std::memory_order_relaxed);
+			devicesDeactivated.fetch_or(bit, std::memory_order_relaxed);
+		}
+	}
+	else if (!seen)
+	{
+		devicesSeen.fetch_or(bit, std::memory_order_relaxed);
+		shared->posedMask.fetch_or(bit, std::memory_order_relaxed);
+	}
+
+	// Most devices have no transform, their pose is forwarded without a copy.
+	const vr::DriverPose_t *result = &pose;
+	vr::DriverPose_t *output = nullptr;
+	if (shared->transforms.IsEnabled(openVRID))
+	{
+#if SPACECAL_POSE_SLOTS
+		output = &poseSlots[openVRID];
+#else
+		output = &transformed;
+#endif
+		if (TransformPose(openVRID, pose, *output, start))
+			result = output;
+		else
+			output = nullptr;
+	}
+	else if (composedTransforms[openVRID].valid)
+	{
+		// Disabled, so whatever the device shows next starts from no transform.
+		composedTransforms[openVRID].valid = false;
+	}
 
-	if (newTransform.updateTranslation)
-		tf.translation = newTransform.translation;
+	if (poseFilters.Active(openVRID) || poseFilters.Recorded(openVRID))
+	{
+		double time = (double) start / performanceFrequency;
+		if (poseFilters.Active(openVRID))
+		{
+			if (!output)
+			{
+				transformed = pose;
+				output = &transformed;
+				result = output;
+			}
+			poseFilters.Apply(openVRID, *output, time);
+		}
+		if (poseFilters.Recorded(openVRID))
+			poseFilters.Record(openVRID, *result, time);
+	}
 
-	if (newTransform.updateRotation)
-		tf.rotation = newTransform.rotation;
+	poseHookStats.Record(openVRID, result != &pose, start, PoseHookStatistics::Now());
+	return result;
+}
+
+template<bool Scaled, bool Moved>
+void ServerTrackedDeviceProvider::ApplyComposed(const ComposedWorldFromDriver &composed, vr::DriverPose_t &pose)
+{
+	if (Scaled)
+	{
+		pose.vecPosition[0] *= composed.scale;
+		pose.vecPosition[1] *= composed.scale;
+		pose.vecPosition[2] *= composed.scale;
+	}
 
-	if (newTransform.updateScale)
-		tf.scale = newTransform.scale;
+	if (Moved)
+	{
+		pose.qWorldFromDriverRotation = composed.worldRotation;
+		memcpy(pose.vecWorldFromDriverTranslation, composed.worldTranslation, sizeof composed.worldTranslation);
+	}
 }
 
-bool ServerTrackedDeviceProvider::HandleDevicePoseUpdated(uint32_t openVRID, vr::DriverPose_t &pose)
+void ServerTrackedDeviceProvider::ComposeTransform(ComposedWorldFromDriver &composed, const protocol::DeviceTransform &tf, const vr::DriverPose_t &pose)
 {
-	auto &tf = transforms[openVRID];
-	if (tf.enabled)
+	composed.driverRotation = pose.qWorldFromDriverRotation;
+	memcpy(composed.driverTranslation, pose.vecWorldFromDriverTranslation, sizeof composed.driverTranslation);
+	composed.scale = tf.scale;
+
+	bool rotated = tf.rotation.w != 1.0 || tf.rotation.x != 0.0 || tf.rotation.y != 0.0 || tf.rotation.z != 0.0;
+	bool translated = tf.translation.v[0] != 0.0 || tf.translation.v[1] != 0.0 || tf.translation.v[2] != 0.0;
+	bool scaled = tf.scale != 1.0;
+
+	if (rotated)
 	{
-		pose.qWorldFromDriverRotation = tf.rotation * pose.qWorldFromDriverRotation;
+		composed.worldRotation = tf.rotation * pose.qWorldFromDriverRotation;
+
+		double rotationMatrix[3][3];
+		quaternionToMatrix(tf.rotation, rotationMatrix);
+		matrixRotateVector(rotationMatrix, pose.vecWorldFromDriverTranslation, composed.worldTranslation);
+	}
+	else
+	{
+		composed.worldRotation = pose.qWorldFromDriverRotation;
+		memcpy(composed.worldTranslation, pose.vecWorldFromDriverTranslation, sizeof composed.worldTranslation);
+	}
 
-		pose.vecPosition[0] *= tf.scale;
-		pose.vecPosition[1] *= tf.scale;
-		pose.vecPosition[2] *= tf.scale;
+	for (int i = 0; i < 3; i++)
+		composed.worldTranslation[i] += tf.translation.v[i];
 
-		vr::HmdVector3d_t rotatedTranslation = quaternionRotateVector(tf.rotation, pose.vecWorldFromDriverTranslation);
-		pose.vecWorldFromDriverTranslation[0] = rotatedTranslation.v[0] + tf.translation.v[0];
-		pose.vecWorldFromDriverTranslation[1] = rotatedTranslation.v[1] + tf.translation.v[1];
-		pose.vecWorldFromDriverTranslation[2] = rotatedTranslation.v[2] + tf.translation.v[2];
+	bool moved = rotated || translated;
+	composed.moved = tf.enabled && moved;
+	composed.scaled = tf.enabled && scaled;
+	if (!tf.enabled)
+		composed.apply = &ApplyComposed<false, false>;
+	else if (scaled)
+		composed.apply = moved ? &ApplyComposed<true, true> : &ApplyComposed<true, false>;
+	else
+		composed.apply = moved ? &ApplyComposed<false, true> : &ApplyComposed<false, false>;
+}
+
+static bool SameTransform(const protocol::DeviceTransform &a, const protocol::DeviceTransform &b)
+{
+	return a.enabled == b.enabled && a.scale == b.scale && a.driftEpoch == b.driftEpoch &&
+		memcmp(&a.translation, &b.translation, sizeof a.translation) == 0 &&
+		memcmp(&a.rotation, &b.rotation, sizeof a.rotation) == 0 &&
+		memcmp(&a.angularDrift, &b.angularDrift, sizeof a.angularDrift) == 0 &&
+		memcmp(&a.linearDrift, &b.linearDrift, sizeof a.linearDrift) == 0;
+}
+
+static bool HasDrift(const protocol::DeviceTransform &tf)
+{
+	for (int i = 0; i < 3; i++)
+	{
+		if (tf.angularDrift.v[i] != 0.0 || tf.linearDrift.v[i] != 0.0)
+			return true;
 	}
-	return true;
+	return false;
+}
+
+// The transform as predicted for time, in seconds on the QueryPerformanceCounter clock.
+static protocol::DeviceTransform ExtrapolateDrift(const protocol::DeviceTransform &tf, double time)
+{
+	double elapsed = time - tf.driftEpoch;
+	elapsed = elapsed < 0.0 ? 0.0 : elapsed > protocol::MaxDriftExtrapolation ? protocol::MaxDriftExtrapolation : elapsed;
+
+	double axis[3] = { tf.angularDrift.v[0], tf.angularDrift.v[1], tf.angularDrift.v[2] };
+	double rate = sqrt(axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2]);
+	vr::HmdQuaternion_t drift = { 1, 0, 0, 0 };
+	if (rate > 0.0)
+	{
+		double half = rate * elapsed * 0.5, s = sin(half) / rate;
+		drift = { cos(half), axis[0] * s, axis[1] * s, axis[2] * s };
+	}
+
+	protocol::DeviceTransform predicted = tf;
+	double translation[3] = { tf.translation.v[0], tf.translation.v[1], tf.translation.v[2] };
+	predicted.rotation = drift * tf.rotation;
+	predicted.translation = quaternionRotateVector(drift, translation);
+	for (int i = 0; i < 3; i++)
+		predicted.translation.v[i] += tf.linearDrift.v[i] * elapsed;
+	return predicted;
+}
+
+// Eases in and out, so the device doesn't start or stop moving abruptly either.
+static protocol::DeviceTransform BlendTransforms(const protocol::DeviceTransform &from, const protocol::DeviceTransform &to, double progress)
+{
+	double t = progress * progress * (3.0 - 2.0 * progress);
+
+	protocol::DeviceTransform blended = to;
+	for (int i = 0; i < 3; i++)
+		blended.translation.v[i] = from.translation.v[i] + (to.translation.v[i] - from.translation.v[i]) * t;
+	blended.rotation = quaternionSlerp(from.rotation, to.rotation, t);
+	blended.scale = from.scale + (to.scale - from.scale) * t;
+	return blended;
+}
+
+// Only blends between two enabled transforms. A device that just got its first transform
+// was shown uncalibrated until now, sliding it into place would only look stranger. Changes
+// of outer layers aren't blended, they're streamed by tools that follow something moving;
+// a blend already running heads for the new target instead.
+void ServerTrackedDeviceProvider::StartTransition(ComposedWorldFromDriver &composed, const protocol::DeviceTransform &tf, uint64_t ticks, bool blend)
+{
+	uint32_t duration = shared->transitionMilliseconds.load(std::memory_order_relaxed);
+	composed.target = tf;
+	composed.drifting = tf.enabled && HasDrift(tf);
+
+	if (!blend && composed.transitioning && tf.enabled)
+		return;
+
+	if (blend && composed.valid && duration && tf.enabled && composed.shown.enabled)
+	{
+		composed.from = composed.shown;
+		composed.transitioning = true;
+		composed.transitionStart = ticks;
+		composed.transitionTicks = duration * ticksPerMicrosecond * 1000.0;
+	}
+	else
+	{
+		composed.shown = tf;
+		composed.transitioning = false;
+	}
+}
+
+#if SPACECAL_POSE_SLOTS
+static_assert(offsetof(vr::DriverPose_t, qWorldFromDriverRotation) == sizeof(double) &&
+	offsetof(vr::DriverPose_t, qDriverFromHeadRotation) == offsetof(vr::DriverPose_t, vecWorldFromDriverTranslation) + sizeof(double[3]),
+	"the world-from-driver fields must be the only ones between poseTimeOffset and the rest of the pose");
+
+// Everything but the world-from-driver fields, which a slot keeps from the last composition.
+static void CopyPoseIntoSlot(vr::DriverPose_t &slot, const vr::DriverPose_t &pose)
+{
+	const size_t rest = offsetof(vr::DriverPose_t, qDriverFromHeadRotation);
+	slot.poseTimeOffset = pose.poseTimeOffset;
+	memcpy(reinterpret_cast<char *>(&slot) + rest, reinterpret_cast<const char *>(&pose) + rest, sizeof pose - rest);
 }
+#endif
+
+// Copies of the table overtaken by writers before a pose goes without the latest transform.
+static const int MaxTransformReadAttempts = 4;
+
+// Returns false when the device has no transform to show yet, pose is forwarded as it is.
+bool ServerTrackedDeviceProvider::TransformPose(uint32_t openVRID, const vr::DriverPose_t &pose, vr::DriverPose_t &out, uint64_t ticks)
+{
+	// Drivers almost always report a constant world-from-driver transform, so the composed
+	// result is reused until either the driver's input or our transform changes. While it's
+	// current the transform table isn't read at all.
+	auto &cache = composedTransforms[openVRID];
+	bool stale = !cache.valid ||
+		memcmp(&cache.driverRotation, &pose.qWorldFromDriverRotation, sizeof cache.driverRotation) != 0 ||
+		memcmp(cache.driverTranslation, pose.vecWorldFromDriverTranslation, sizeof cache.driverTranslation) != 0;
+
+	if (!cache.valid || cache.sequence != shared->transforms.Sequence())
+	{
+		// Other devices' updates bump the sequence too, only a change of our own starts a transition.
+		// A read that writers kept overtaking is retried with the next pose.
+		uint32_t sequence;
+		protocol::DeviceTransform tf;
+		if (shared->transforms.TryRead(openVRID, tf, sequence, MaxTransformReadAttempts))
+		{
+			if (!cache.valid || !SameTransform(tf, cache.target))
+			{
+				StartTransition(cache, tf, ticks, tf.calibrationWrites != cache.target.calibrationWrites);
+				stale = true;
+			}
+			cache.sequence = sequence;
+			cache.valid = true;
+		}
+		else if (!cache.valid)
+		{
+			return false;
+		}
+	}
+
+	// While blending or extrapolating drift the transform is composed again for every pose.
+	if (cache.transitioning || cache.drifting)
+	{
+		protocol::DeviceTransform target = cache.drifting ? ExtrapolateDrift(cache.target, (double) ticks / performanceFrequency) : cache.target;
+		double progress = cache.transitioning ? (double) (ticks - cache.transitionStart) / cache.transitionTicks : 1.0;
+		if (progress >= 1.0)
+		{
+			cache.shown = target;
+			cache.transitioning = false;
+		}
+		else
+		{
+			cache.shown = BlendTransforms(cache.from, target, progress);
+		}
+		stale = true;
+	}
 
+	if (stale)
+	{
+		ComposeTransform(cache, cache.shown, pose);
+#if SPACECAL_POSE_SLOTS
+		out.qWorldFromDriverRotation = cache.moved ? cache.worldRotation : pose.qWorldFromDriverRotation;
+		memcpy(out.vecWorldFromDriverTranslation, cache.moved ? cache.worldTranslation : pose.vecWorldFromDriverTranslation, sizeof out.vecWorldFromDriverTranslation);
+#endif
+	}
+
+#if SPACECAL_POSE_SLOTS
+	CopyPoseIntoSlot(out, pose);
+	if (cache.scaled)
+		ApplyComposed<true, false>(cache, out);
+#else
+	out = pose;
+	cache.apply(cache, out);
+#endif
+	return true;
+}
\ No newline at end of file
@@ -1,8 +1,23 @@
 #pragma once
 
 #include "IPCServer.h"
+#include "ContinuousCalibrator.h"
+#include "PoseHookStatistics.h"
+#include "PoseQueue.h"
+#include "TransformCache.h"
+#include "TrackingSystemRules.h"
+#include "PoseFilters.h"
 
 #include <openvr_driver.h>
+#include <atomic>
+#include <thread>
+
+// Transformed poses go to SteamVR from a slot per device that keeps its world-from-driver fields
+// until the composed transform changes, so a pose only copies what changes with every pose. Define
+// as 0 to build each transformed pose as a full copy on the detour's stack instead.
+#ifndef SPACECAL_POSE_SLOTS
+#define SPACECAL_POSE_SLOTS 1
+#endif
 
 class ServerTrackedDeviceProvider : public vr::IServerTrackedDeviceProvider
 {
@@ -19,7 +34,7 @@ public:
 	virtual const char * const *GetInterfaceVersions() { return vr::k_InterfaceVersions; }
 
 	/** Allows the driver do to some work in the main loop of the server. */
-	virtual void RunFrame() { }
+	virtual void RunFrame() override;
 
 	/** Returns true if the driver wants to block Standby mode. */
 	virtual bool ShouldBlockStandbyMode() { return false; }
@@ -36,18 +51,98 @@ public:
 
 	ServerTrackedDeviceProvider() : server(this) { }
 	void SetDeviceTransform(const protocol::SetDeviceTransform &newTransform);
-	bool HandleDevicePoseUpdated(uint32_t openVRID, vr::DriverPose_t &pose);
+	void SetDeviceTransforms(const protocol::SetDeviceTransformBatch &batch);
+	void GetDeviceTransforms(protocol::DeviceTransforms &transforms) const { shared->transforms.Snapshot(transforms); }
+	void SetTrackingSystemRules(const protocol::SetTrackingSystemRules &rules) { trackingSystemRules.Set(rules); }
+	void SetContinuousCalibration(const protocol::SetContinuousCalibration &config) { continuousCalibrator.Configure(config); }
+	void GetContinuousCalibrationStatus(protocol::ContinuousCalibrationStatus &status) { continuousCalibrator.TakeStatus(status); }
+	bool SetPoseFilters(const protocol::SetPoseFilters &config) { return poseFilters.Configure(config); }
+	void SetPoseHookMode(const protocol::SetPoseHookMode &mode) { poseHookMode = mode.mode; }
+
+	// Returns the pose to forward to SteamVR, either pose itself, the device's slot or transformed
+	// after filling it in. Wait-free towards the transform table's writers, the client and SDK
+	// tools included: no lock is taken and a read overtaken by writers is retried a bounded
+	// number of times, after which the device keeps the transform it had.
+	const vr::DriverPose_t *HandleDevicePoseUpdated(uint32_t openVRID, const vr::DriverPose_t &pose, vr::DriverPose_t &transformed);
+	void GetPoseHookStats(protocol::PoseHookStats &stats) const;
+	void GetPoseRates(protocol::DevicePoseRate (&rates)[vr::k_unMaxTrackedDeviceCount]) const { poseHookStats.SnapshotRates(rates); }
+
+	// The client's first complete update replaces the cached transforms, so nothing is restored after it connected.
+	void ClientConnected() { clientConnected = true; }
 
 private:
 	IPCServer server;
+	std::thread serverStartup; // Runs server.Run, so Init doesn't wait for the pipe and its workers.
+
+	// Section shared with the client, see protocol::SharedMemory. Falls back to a
+	// private allocation if the section can't be created, so pipe requests still work.
+	// Read by every pose, so kept off the cache lines of the IPC server's counters.
+	alignas(64) HANDLE sharedMapping = nullptr;
+	protocol::SharedMemory *shared = nullptr;
+	bool sharedIsLocal = false;
+	double performanceFrequency;
+	double ticksPerMicrosecond;
+
+	void OpenSharedMemory();
+	void CloseSharedMemory();
+	void CapturePose(uint32_t openVRID, const vr::DriverPose_t &pose, uint64_t ticks);
+	bool TransformPose(uint32_t openVRID, const vr::DriverPose_t &pose, vr::DriverPose_t &out, uint64_t ticks);
+	bool PoseHooksNeeded() const;
+	void UpdatePoseHooks();
+	void DeactivateDevices();
+
+	PoseHookStatistics poseHookStats;
+	PoseQueue poseQueue; // Poses for the continuous calibrator, shared->poseCapture has the client's.
 
-	struct DeviceTransform
+	TransformCache transformCache;
+	TrackingSystemRules trackingSystemRules;
+	ContinuousCalibrator continuousCalibrator;
+	PoseFilters poseFilters;
+	std::atomic<uint64_t> devicesSeen; // Bit per OpenVR ID that has reported a pose since it connected.
+	std::atomic<uint64_t> devicesDeactivated; // Bit per OpenVR ID whose device disconnected, for RunFrame to reset.
+	std::atomic<bool> clientConnected;
+
+	// protocol::PoseHookMode, set by the client. Whether the pose hooks are patched in follows it
+	// on the main thread, see UpdatePoseHooks.
+	std::atomic<uint32_t> poseHookMode;
+	bool poseHooksEnabled;
+	uint64_t poseHooksIdleSince; // QueryPerformanceCounter ticks, 0 while they're needed.
+
+	// World-from-driver transform composed with our transform, only touched by the pose thread.
+	// apply is picked when the cache is rebuilt, so a pose only pays for the parts that aren't identity.
+	struct ComposedWorldFromDriver
 	{
-		bool enabled = false;
-		vr::HmdVector3d_t translation;
-		vr::HmdQuaternion_t rotation;
+		bool valid;
+		uint32_t sequence;
+		vr::HmdQuaternion_t driverRotation;
+		double driverTranslation[3];
+		vr::HmdQuaternion_t worldRotation;
+		double worldTranslation[3];
 		double scale;
+		void (*apply)(const ComposedWorldFromDriver &composed, vr::DriverPose_t &pose);
+		bool moved, scaled; // What apply does, for poses written into a slot.
+
+		// target is the composed transform last published for the device, shown the one its poses get.
+		// They differ while a transition from the previously shown transform runs, and while
+		// target's drift is extrapolated.
+		protocol::DeviceTransform target, shown, from;
+		bool transitioning, drifting;
+		uint64_t transitionStart; // QueryPerformanceCounter ticks
+		double transitionTicks;
 	};
 
-	DeviceTransform transforms[vr::k_unMaxTrackedDeviceCount];
+	template<bool Scaled, bool Moved> static void ApplyComposed(const ComposedWorldFromDriver &composed, vr::DriverPose_t &pose);
+	static void ComposeTransform(ComposedWorldFromDriver &composed, const protocol::DeviceTransform &tf, const vr::DriverPose_t &pose);
+	void StartTransition(ComposedWorldFromDriver &composed, const protocol::DeviceTransform &tf, uint64_t ticks, bool blend);
+
+	alignas(64) ComposedWorldFromDriver composedTransforms[vr::k_unMaxTrackedDeviceCount];
+
+#if SPACECAL_POSE_SLOTS
+	// The transformed pose of each device, see SPACECAL_POSE_SLOTS. Only touched by the pose thread.
+	alignas(64) vr::DriverPose_t poseSlots[vr::k_unMaxTrackedDeviceCount];
+#endif
+
+	// QueryPerformanceCounter tick from which the next pose of each device may be captured,
+	// see PoseCaptureBuffer::minInterval. Only touched by the pose thread.
+	uint64_t nextCaptureTicks[vr::k_unMaxTrackedDeviceCount];
 };
\ No newline at end of file
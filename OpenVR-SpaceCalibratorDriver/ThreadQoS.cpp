@@ -0,0 +1,41 @@
+#include "ThreadQoS.h"
+#include "Logging.h"
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+// Only on Windows 10 1607 and later, looked up so the driver still loads without it.
+typedef HRESULT (WINAPI *SetThreadDescriptionProc)(HANDLE thread, PCWSTR description);
+
+static SetThreadDescriptionProc FindSetThreadDescription()
+{
+	HMODULE kernel = GetModuleHandleW(L"kernel32.dll");
+	return kernel ? (SetThreadDescriptionProc) GetProcAddress(kernel, "SetThreadDescription") : nullptr;
+}
+
+void SetCurrentThreadRole(const wchar_t *name, ThreadRole role)
+{
+	HANDLE thread = GetCurrentThread();
+
+	static const SetThreadDescriptionProc setThreadDescription = FindSetThreadDescription();
+	if (setThreadDescription)
+		setThreadDescription(thread, name);
+
+	// Threads start at normal priority, but a creator may have raised it. Background threads go
+	// without priority boosts, IPC keeps them: a request waking a worker should be answered soon.
+	int priority = role == ThreadRole::Background ? THREAD_PRIORITY_LOWEST : THREAD_PRIORITY_NORMAL;
+	if (!SetThreadPriority(thread, priority))
+		LOG("SetThreadPriority failed for %ls. Error: %d", name, GetLastError());
+
+	if (role != ThreadRole::Background)
+		return;
+	SetThreadPriorityBoost(thread, TRUE);
+
+	// EcoQoS, Windows 11 and later: the scheduler prefers efficient cores and clocks for the
+	// thread. Older releases reject the request, which leaves the priority alone doing the job.
+	THREAD_POWER_THROTTLING_STATE throttling = {};
+	throttling.Version = THREAD_POWER_THROTTLING_CURRENT_VERSION;
+	throttling.ControlMask = THREAD_POWER_THROTTLING_EXECUTION_SPEED;
+	throttling.StateMask = THREAD_POWER_THROTTLING_EXECUTION_SPEED;
+	SetThreadInformation(thread, ThreadPowerThrottling, &throttling, sizeof throttling);
+}
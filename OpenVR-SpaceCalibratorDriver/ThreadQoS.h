@@ -0,0 +1,14 @@
+#pragma once
+
+// How a driver thread is scheduled next to vrserver's own threads. None of ours ever runs
+// above normal priority, so the pose and compositor threads SteamVR raises, MMCSS ones
+// included, always preempt them.
+enum class ThreadRole
+{
+	IPC, // Answers the client's pipe requests. Normal priority, a transform shouldn't wait.
+	Background, // Solving, logging and other work without a deadline. Lowest priority, and EcoQoS where Windows has it.
+};
+
+// Names the calling thread for debuggers and profilers, and schedules it for its role. Whatever
+// the running Windows doesn't support is skipped.
+void SetCurrentThreadRole(const wchar_t *name, ThreadRole role);
@@ -0,0 +1,61 @@
+#include "TrackingSystemRules.h"
+#include "Logging.h"
+
+#include <cstring>
+
+void TrackingSystemRules::Set(const protocol::SetTrackingSystemRules &newRules)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	rules.assign(newRules.rules, newRules.rules + newRules.count);
+	for (auto &rule : rules)
+		rule.trackingSystem[protocol::MaxTrackingSystemNameLength - 1] = 0;
+	ruleCount.store((uint32_t) rules.size(), std::memory_order_relaxed);
+
+	TRACE(protocol::TraceTransforms, "SetTrackingSystemRules(%d rules)", newRules.count);
+}
+
+void TrackingSystemRules::Resolve(uint32_t openVRID, protocol::TransformBuffer &transforms)
+{
+	auto container = vr::VRProperties()->TrackedDeviceToPropertyContainer(openVRID);
+	vr::ETrackedPropertyError err = vr::TrackedProp_Success;
+
+	// Rule names are capped at this length, so a longer name can't match and needn't be read.
+	char trackingSystem[protocol::MaxTrackingSystemNameLength];
+	vr::VRProperties()->GetStringProperty(container, vr::Prop_TrackingSystemName_String, trackingSystem, sizeof trackingSystem, &err);
+	if (err == vr::TrackedProp_BufferTooSmall)
+		trackingSystem[0] = 0;
+	else if (err != vr::TrackedProp_Success)
+		return;
+
+	resolvedMask |= 1ull << openVRID;
+
+	// The HMD defines the reference space and is never transformed. Devices that already
+	// have a transform got it from the client, which knows better.
+	if (openVRID == vr::k_unTrackedDeviceIndex_Hmd || transforms.ReadLayerLocked(openVRID).enabled)
+		return;
+
+	std::lock_guard<std::mutex> lock(mutex);
+	for (auto &rule : rules)
+	{
+		if (!trackingSystem[0] || strcmp(trackingSystem, rule.trackingSystem) != 0)
+			continue;
+
+		protocol::SetDeviceTransform tf(openVRID, true, rule.translation, rule.rotation, rule.scale);
+		transforms.WriteLocked(&tf, 1);
+		LOG("Applied %s transform to device %d", rule.trackingSystem, openVRID);
+		return;
+	}
+}
+
+void TrackingSystemRules::Update(protocol::TransformBuffer &transforms, uint64_t seenMask)
+{
+	uint64_t unresolved = seenMask & ~resolvedMask;
+	for (uint32_t id = 0; unresolved && id < vr::k_unMaxTrackedDeviceCount; id++)
+	{
+		if (unresolved & (1ull << id))
+		{
+			Resolve(id, transforms);
+			unresolved &= ~(1ull << id);
+		}
+	}
+}
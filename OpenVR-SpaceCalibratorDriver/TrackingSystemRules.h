@@ -0,0 +1,35 @@
+#pragma once
+
+#include "../Protocol.h"
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+/**
+ * The client's per tracking system transforms, see protocol::TrackingSystemRule. Set from
+ * the IPC thread, applied from the server's main thread as devices report their first pose.
+ */
+class TrackingSystemRules
+{
+public:
+	void Set(const protocol::SetTrackingSystemRules &rules);
+
+	// Called every server frame with writeLock held. seenMask has a bit per OpenVR ID that has
+	// reported a pose.
+	void Update(protocol::TransformBuffer &transforms, uint64_t seenMask);
+
+	// The device with this ID disconnected, the next one is looked at again.
+	void Forget(uint32_t openVRID) { resolvedMask &= ~(1ull << openVRID); }
+
+	bool Empty() const { return ruleCount.load(std::memory_order_relaxed) == 0; }
+
+private:
+	std::mutex mutex;
+	std::vector<protocol::TrackingSystemRule> rules; // Guarded by mutex.
+	std::atomic<uint32_t> ruleCount{0};
+
+	uint64_t resolvedMask = 0; // Devices whose tracking system has been looked at, main thread only.
+
+	void Resolve(uint32_t openVRID, protocol::TransformBuffer &transforms);
+};
@@ -0,0 +1,310 @@
+#include "TransformCache.h"
+#include "Logging.h"
+
+#include <cstring>
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#include <shlobj.h>
+
+static const uint32_t CacheMagic = 0x43544353; // "SCTC"
+static const uint32_t CacheVersion = 1;
+static const uint64_t SaveDelay = 2000; // ms, collects a burst of updates into one write.
+static const uint32_t MaxSerialLength = 256;
+
+// File layout, little endian: magic, version, entry count, then per entry the serial's
+// length and bytes followed by a CachedTransform.
+#pragma pack(push, 1)
+struct CachedTransform
+{
+	double translation[3];
+	double rotation[4]; // w, x, y, z
+	double scale;
+};
+#pragma pack(pop)
+
+static std::string CachePath()
+{
+	char appData[MAX_PATH] = { 0 };
+	if (SHGetFolderPathA(nullptr, CSIDL_LOCAL_APPDATA, nullptr, SHGFP_TYPE_CURRENT, appData) != S_OK)
+		return "";
+
+	return std::string(appData) + "\\OpenVR-SpaceCalibrator\\driver_transforms.bin";
+}
+
+static void AppendBytes(std::vector<uint8_t> &out, const void *data, size_t size)
+{
+	auto bytes = static_cast<const uint8_t *>(data);
+	out.insert(out.end(), bytes, bytes + size);
+}
+
+void TransformCache::Load()
+{
+	entries.clear();
+	loading = std::async(std::launch::async, ReadEntries);
+}
+
+bool TransformCache::Loaded()
+{
+	if (!loading.valid())
+		return true;
+	if (loading.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+		return false;
+
+	entries = loading.get();
+	return true;
+}
+
+std::vector<TransformCache::Entry> TransformCache::ReadEntries()
+{
+	std::vector<Entry> entries;
+	auto path = CachePath();
+	HANDLE file = path.empty() ? INVALID_HANDLE_VALUE : CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+		return entries;
+
+	std::vector<uint8_t> data;
+	LARGE_INTEGER size;
+	if (GetFileSizeEx(file, &size) && size.QuadPart < 1024 * 1024)
+	{
+		data.resize((size_t) size.QuadPart);
+		DWORD bytesRead = 0;
+		if (!data.empty() && (!ReadFile(file, data.data(), (DWORD) data.size(), &bytesRead, nullptr) || bytesRead != data.size()))
+			data.clear();
+	}
+	CloseHandle(file);
+
+	size_t pos = 0;
+	auto read = [&](void *out, size_t length) {
+		if (pos + length > data.size())
+			return false;
+		memcpy(out, data.data() + pos, length);
+		pos += length;
+		return true;
+	};
+
+	uint32_t magic = 0, version = 0, count = 0;
+	if (!read(&magic, 4) || !read(&version, 4) || !read(&count, 4) || magic != CacheMagic || version != CacheVersion)
+	{
+		LOG("Ignoring transform cache %s, unknown format", path.c_str());
+		return entries;
+	}
+
+	for (uint32_t i = 0; i < count; i++)
+	{
+		uint32_t serialLength = 0;
+		CachedTransform cached;
+		if (!read(&serialLength, 4) || serialLength > MaxSerialLength || pos + serialLength > data.size())
+			break;
+
+		Entry entry;
+		entry.serial.assign((const char *) data.data() + pos, serialLength);
+		pos += serialLength;
+		if (!read(&cached, sizeof cached))
+			break;
+
+		entry.transform.enabled = true;
+		entry.transform.translation = { cached.translation[0], cached.translation[1], cached.translation[2] };
+		entry.transform.rotation = { cached.rotation[0], cached.rotation[1], cached.rotation[2], cached.rotation[3] };
+		entry.transform.scale = cached.scale;
+		entries.push_back(entry);
+	}
+
+	LOG("Loaded %d cached device transforms", (int) entries.size());
+	return entries;
+}
+
+TransformCache::Entry *TransformCache::Find(const std::string &serial)
+{
+	for (auto &entry : entries)
+	{
+		if (entry.serial == serial)
+			return &entry;
+	}
+	return nullptr;
+}
+
+void TransformCache::Resolve(uint32_t openVRID, protocol::TransformBuffer &transforms, bool restore)
+{
+	auto container = vr::VRProperties()->TrackedDeviceToPropertyContainer(openVRID);
+	vr::ETrackedPropertyError err = vr::TrackedProp_Success;
+
+	// Serials are short, only unusual ones need a second read at their reported size.
+	char buffer[64];
+	std::string serial;
+	uint32_t size = vr::VRProperties()->GetStringProperty(container, vr::Prop_SerialNumber_String, buffer, sizeof buffer, &err);
+	if (err == vr::TrackedProp_Success)
+		serial = buffer;
+	else if (err == vr::TrackedProp_BufferTooSmall && size > sizeof buffer)
+	{
+		serial.resize(size);
+		size = vr::VRProperties()->GetStringProperty(container, vr::Prop_SerialNumber_String, &serial[0], size, &err);
+		serial.resize(err == vr::TrackedProp_Success && size ? size - 1 : 0);
+	}
+	if (err != vr::TrackedProp_Success || serial.empty())
+		return;
+
+	serials[openVRID] = serial;
+	resolvedMask |= 1ull << openVRID;
+
+	auto entry = Find(serial);
+	if (!entry || !(restore || entry->departed) || transforms.ReadLayerLocked(openVRID).enabled)
+		return;
+	entry->departed = false;
+
+	const auto &tf = entry->transform;
+	protocol::SetDeviceTransform restored(openVRID, true, tf.translation, tf.rotation, tf.scale);
+	transforms.WriteLocked(&restored, 1);
+
+	// Our own write is already in the cache.
+	lastSequence = transforms.Sequence();
+	LOG("Restored cached transform for device %d (%s)", openVRID, serial.c_str());
+}
+
+void TransformCache::Update(protocol::TransformBuffer &transforms, uint64_t seenMask, bool restore)
+{
+	// Devices keep their place in the mask and table changes their sequence, both are picked up once loaded.
+	if (!Loaded())
+		return;
+
+	uint64_t unresolved = seenMask & ~resolvedMask;
+	for (uint32_t id = 0; unresolved && id < vr::k_unMaxTrackedDeviceCount; id++)
+	{
+		if (unresolved & (1ull << id))
+		{
+			Resolve(id, transforms, restore);
+			unresolved &= ~(1ull << id);
+		}
+	}
+
+	uint32_t sequence = transforms.Sequence();
+	if (sequence != lastSequence)
+	{
+		lastSequence = sequence;
+		if (!dirty)
+		{
+			dirty = true;
+			timeDirty = GetTickCount64();
+		}
+	}
+
+	if (dirty && GetTickCount64() - timeDirty >= SaveDelay)
+		Save(transforms);
+}
+
+void TransformCache::Flush(const protocol::TransformBuffer &transforms)
+{
+	if (loading.valid())
+		entries = loading.get();
+
+	if (dirty || transforms.Sequence() != lastSequence)
+	{
+		transforms.Lock();
+		Save(transforms);
+		transforms.Unlock();
+	}
+	WritePending();
+}
+
+void TransformCache::Record(const std::string &serial, const protocol::DeviceTransform &tf)
+{
+	auto entry = Find(serial);
+	if (tf.enabled && entry)
+	{
+		entry->transform = tf;
+	}
+	else if (tf.enabled)
+	{
+		entries.push_back({ serial, tf });
+	}
+	else if (entry)
+	{
+		*entry = entries.back();
+		entries.pop_back();
+	}
+}
+
+void TransformCache::Forget(uint32_t openVRID, const protocol::TransformBuffer &transforms)
+{
+	uint64_t bit = 1ull << openVRID;
+	if (!(resolvedMask & bit))
+		return;
+
+	Record(serials[openVRID], transforms.ReadLayerLocked(openVRID));
+	auto entry = Find(serials[openVRID]);
+	if (entry)
+		entry->departed = true;
+
+	resolvedMask &= ~bit;
+	serials[openVRID].clear();
+}
+
+void TransformCache::Save(const protocol::TransformBuffer &transforms)
+{
+	dirty = false;
+	lastSequence = transforms.Sequence();
+
+	// Devices that aren't around this session keep their entries.
+	for (uint32_t id = 0; id < vr::k_unMaxTrackedDeviceCount; id++)
+	{
+		if (!(resolvedMask & (1ull << id)))
+			continue;
+
+		Record(serials[id], transforms.ReadLayerLocked(id));
+	}
+
+	auto &data = pending;
+	data.clear();
+	uint32_t count = (uint32_t) entries.size();
+	AppendBytes(data, &CacheMagic, 4);
+	AppendBytes(data, &CacheVersion, 4);
+	AppendBytes(data, &count, 4);
+
+	for (auto &entry : entries)
+	{
+		const auto &tf = entry.transform;
+		CachedTransform cached = {
+			{ tf.translation.v[0], tf.translation.v[1], tf.translation.v[2] },
+			{ tf.rotation.w, tf.rotation.x, tf.rotation.y, tf.rotation.z },
+			tf.scale
+		};
+
+		uint32_t serialLength = (uint32_t) entry.serial.size();
+		AppendBytes(data, &serialLength, 4);
+		AppendBytes(data, entry.serial.data(), serialLength);
+		AppendBytes(data, &cached, sizeof cached);
+	}
+}
+
+void TransformCache::WritePending()
+{
+	if (pending.empty())
+		return;
+
+	std::vector<uint8_t> data;
+	data.swap(pending);
+	auto path = CachePath();
+	if (path.empty())
+		return;
+
+	CreateDirectoryA(path.substr(0, path.find_last_of('\\')).c_str(), nullptr);
+
+	// Written next to the old file and renamed over it, so a crash never leaves half a cache.
+	auto temporaryPath = path + ".tmp";
+	HANDLE file = CreateFileA(temporaryPath.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+	{
+		LOG("Couldn't create %s. Error: %d", temporaryPath.c_str(), GetLastError());
+		return;
+	}
+
+	DWORD bytesWritten = 0;
+	bool ok = WriteFile(file, data.data(), (DWORD) data.size(), &bytesWritten, nullptr) && bytesWritten == data.size();
+	CloseHandle(file);
+
+	if (!ok || !MoveFileExA(temporaryPath.c_str(), path.c_str(), MOVEFILE_REPLACE_EXISTING))
+	{
+		LOG("Couldn't write transform cache %s. Error: %d", path.c_str(), GetLastError());
+		DeleteFileA(temporaryPath.c_str());
+	}
+}
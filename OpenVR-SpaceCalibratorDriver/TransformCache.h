@@ -0,0 +1,62 @@
+#pragma once
+
+#include "../Protocol.h"
+
+#include <string>
+#include <vector>
+#include <future>
+
+/**
+ * The transforms last applied to each device, saved by serial number in the user's local app
+ * data. A device found in the cache gets its saved transform as soon as it reports a pose, so
+ * trackers are calibrated before the client has started. The client's first full update then
+ * replaces whatever was restored. Load reads the file on a thread of its own, so it doesn't
+ * hold up SteamVR's startup, everything else runs on the server's main thread.
+ */
+class TransformCache
+{
+public:
+	// Returns right away. Nothing is restored or saved until the file has been read.
+	void Load();
+
+	// Called every server frame with writeLock held. seenMask has a bit per OpenVR ID that has
+	// reported a pose. Devices are only restored while restore is set, i.e. before any client
+	// took over. A save only collects the file's bytes, see WritePending.
+	void Update(protocol::TransformBuffer &transforms, uint64_t seenMask, bool restore);
+
+	// Writes the file Update collected, once writeLock is released.
+	void WritePending();
+
+	// Saves pending changes right away. Takes writeLock.
+	void Flush(const protocol::TransformBuffer &transforms);
+
+	// With writeLock held, before the device's transforms are reset for the next device with
+	// its ID. Keeps its last transform under its serial, and restores it should the device come
+	// back this session, client or not.
+	void Forget(uint32_t openVRID, const protocol::TransformBuffer &transforms);
+
+private:
+	struct Entry
+	{
+		std::string serial;
+		protocol::DeviceTransform transform;
+		bool departed = false; // The device disconnected this session, see Forget.
+	};
+
+	std::vector<Entry> entries;
+	std::future<std::vector<Entry>> loading;
+	std::string serials[vr::k_unMaxTrackedDeviceCount]; // Of the devices in resolvedMask.
+	uint64_t resolvedMask = 0;
+
+	uint32_t lastSequence = 0;
+	bool dirty = false;
+	uint64_t timeDirty = 0; // GetTickCount64 when the first unsaved change was seen.
+	std::vector<uint8_t> pending; // The file's bytes from Save, for WritePending.
+
+	static std::vector<Entry> ReadEntries();
+	bool Loaded();
+	void Resolve(uint32_t openVRID, protocol::TransformBuffer &transforms, bool restore);
+	void Save(const protocol::TransformBuffer &transforms);
+	void Record(const std::string &serial, const protocol::DeviceTransform &tf);
+	Entry *Find(const std::string &serial);
+};
@@ -1,10 +1,13 @@
 #include "Logging.h"
 #include "../Version.h"
+#include "../Instrumentation.h"
 
 #define WIN32_LEAN_AND_MEAN
 #include <windows.h>
 #include <cstdio>
 
+SPACECAL_DEFINE_TRACE_PROVIDER
+
 BOOL APIENTRY DllMain(HMODULE hModule, DWORD ul_reason_for_call, LPVOID lpReserved)
 {
 	switch (ul_reason_for_call)
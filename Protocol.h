@@ -1,22 +1,68 @@
 #pragma once
 
 #include <cstdint>
+#include <cstddef>
+#include <atomic>
+#include <thread>
+#include <algorithm>
+
+#include <windows.h>
 
 #ifndef _OPENVR_API
 #include <openvr_driver.h>
 #endif
 
+#include "QuaternionMath.h"
+
 #define OPENVR_SPACECALIBRATOR_PIPE_NAME "\\\\.\\pipe\\OpenVRSpaceCalibratorDriver"
+#define OPENVR_SPACECALIBRATOR_SHARED_MEMORY_NAME "Local\\OpenVRSpaceCalibratorSharedMemory"
+#define OPENVR_SPACECALIBRATOR_STATUS_NAME "Local\\OpenVRSpaceCalibratorStatus"
 
 namespace protocol
 {
-	const uint32_t Version = 2;
+	// Covers the message framing, the handshake and RequestSetDeviceTransform, and only changes
+	// when one of those does. Everything else is announced with a Capability bit instead, so a
+	// client and driver of different releases still work together with what they both support.
+	const uint32_t Version = 21;
+
+	enum Capability : uint32_t
+	{
+		CapabilityTransformBatch = 1 << 0, // RequestSetDeviceTransformBatch
+		CapabilitySharedMemory = 1 << 1, // SharedMemory as laid out here. Changed once released, it gets a new bit.
+		CapabilityTrackingSystemRules = 1 << 2, // RequestSetTrackingSystemRules
+		CapabilityContinuousCalibration = 1 << 3, // RequestSetContinuousCalibration and its status.
+		CapabilityPoseHookStats = 1 << 4, // RequestPoseHookStats
+		CapabilityDriverStats = 1 << 5, // RequestDriverStats
+		CapabilityTransformReadback = 1 << 6, // RequestGetDeviceTransforms
+		CapabilityPoseFilters = 1 << 7, // RequestSetPoseFilters
+		CapabilityPoseFusion = 1 << 8, // PoseFilterFusion
+		CapabilityPoseFallback = 1 << 9, // PoseFilterFallback
+		CapabilityPosePrediction = 1 << 10, // PoseFilterPredict
+		CapabilityPoseHookMode = 1 << 11, // RequestSetPoseHookMode
+		CapabilityMotionCompensation = 1 << 12, // PoseFilterCompensate
+		CapabilityPoseRates = 1 << 13, // DriverStats::poseRates
+	};
+
+	// What this build implements, on either end.
+	const uint32_t Capabilities = CapabilityTransformBatch | CapabilitySharedMemory | CapabilityTrackingSystemRules |
+		CapabilityContinuousCalibration | CapabilityPoseHookStats | CapabilityDriverStats | CapabilityTransformReadback | CapabilityPoseFilters |
+		CapabilityPoseFusion | CapabilityPoseFallback | CapabilityPosePrediction | CapabilityPoseHookMode | CapabilityMotionCompensation |
+		CapabilityPoseRates;
 
 	enum RequestType
 	{
 		RequestInvalid,
 		RequestHandshake,
 		RequestSetDeviceTransform,
+		RequestSetDeviceTransformBatch,
+		RequestPoseHookStats,
+		RequestSetTrackingSystemRules,
+		RequestSetContinuousCalibration,
+		RequestContinuousCalibrationStatus,
+		RequestDriverStats,
+		RequestGetDeviceTransforms,
+		RequestSetPoseFilters,
+		RequestSetPoseHookMode,
 	};
 
 	enum ResponseType
@@ -24,64 +70,990 @@ namespace protocol
 		ResponseInvalid,
 		ResponseHandshake,
 		ResponseSuccess,
+		ResponsePoseHookStats,
+		ResponseContinuousCalibrationStatus,
+		ResponseDriverStats,
+		ResponseDeviceTransforms,
 	};
 
+	// Sent both ways in the handshake, each end with its own capabilities.
 	struct Protocol
 	{
 		uint32_t version = Version;
+		uint32_t capabilities = Capabilities;
 	};
 
 	struct SetDeviceTransform
 	{
 		uint32_t openVRID;
+
+		// The device generation the transform was meant for, see TransformBuffer::Generation. A
+		// transform for an earlier one is skipped, 0 goes to whichever device has the ID.
+		uint32_t generation = 0;
+
 		bool enabled;
 		bool updateTranslation;
 		bool updateRotation;
 		bool updateScale;
+		bool updateDrift;
 		vr::HmdVector3d_t translation;
 		vr::HmdQuaternion_t rotation;
 		double scale;
+		vr::HmdVector3d_t angularDrift, linearDrift; // See DeviceTransform.
+		double driftEpoch;
+
+		SetDeviceTransform() : SetDeviceTransform(0, false) { }
 
 		SetDeviceTransform(uint32_t id, bool enabled) :
-			openVRID(id), enabled(enabled), updateTranslation(false), updateRotation(false), updateScale(false) { }
+			openVRID(id), enabled(enabled), updateTranslation(false), updateRotation(false), updateScale(false), updateDrift(false) { }
 
 		SetDeviceTransform(uint32_t id, bool enabled, vr::HmdVector3d_t translation) :
-			openVRID(id), enabled(enabled), updateTranslation(true), updateRotation(false), updateScale(false), translation(translation) { }
+			openVRID(id), enabled(enabled), updateTranslation(true), updateRotation(false), updateScale(false), updateDrift(false), translation(translation) { }
 
 		SetDeviceTransform(uint32_t id, bool enabled, vr::HmdQuaternion_t rotation) :
-			openVRID(id), enabled(enabled), updateTranslation(false), updateRotation(true), updateScale(false), rotation(rotation) { }
+			openVRID(id), enabled(enabled), updateTranslation(false), updateRotation(true), updateScale(false), updateDrift(false), rotation(rotation) { }
 
 		SetDeviceTransform(uint32_t id, bool enabled, double scale) :
-			openVRID(id), enabled(enabled), updateTranslation(false), updateRotation(false), updateScale(true), scale(scale) { }
+			openVRID(id), enabled(enabled), updateTranslation(false), updateRotation(false), updateScale(true), updateDrift(false), scale(scale) { }
 
 		SetDeviceTransform(uint32_t id, bool enabled, vr::HmdVector3d_t translation, vr::HmdQuaternion_t rotation) :
-			openVRID(id), enabled(enabled), updateTranslation(true), updateRotation(true), updateScale(false), translation(translation), rotation(rotation) { }
+			openVRID(id), enabled(enabled), updateTranslation(true), updateRotation(true), updateScale(false), updateDrift(false), translation(translation), rotation(rotation) { }
 
 		SetDeviceTransform(uint32_t id, bool enabled, vr::HmdVector3d_t translation, vr::HmdQuaternion_t rotation, double scale) :
-			openVRID(id), enabled(enabled), updateTranslation(true), updateRotation(true), updateScale(true), translation(translation), rotation(rotation), scale(scale) { }
+			openVRID(id), enabled(enabled), updateTranslation(true), updateRotation(true), updateScale(true), updateDrift(false), translation(translation), rotation(rotation), scale(scale) { }
+	};
+
+	const uint32_t MaxBatchTransforms = vr::k_unMaxTrackedDeviceCount;
+
+	// Applied by the driver as a single update, readers see either none or all of it.
+	// Only the first count transforms are sent.
+	struct SetDeviceTransformBatch
+	{
+		uint32_t count;
+		SetDeviceTransform transforms[MaxBatchTransforms];
+
+		uint32_t PayloadSize() const
+		{
+			return (uint32_t) (offsetof(SetDeviceTransformBatch, transforms) + count * sizeof(SetDeviceTransform));
+		}
+	};
+
+	const uint32_t MaxTrackingSystemRules = 16;
+	const uint32_t MaxTrackingSystemNameLength = 64;
+
+	// Transform for every device of one tracking system. The driver applies it by itself to
+	// devices that show up after the rules were set, so they're calibrated before the client
+	// has looked at them. The client still sends each device its own complete transform.
+	struct TrackingSystemRule
+	{
+		char trackingSystem[MaxTrackingSystemNameLength]; // Null terminated.
+		vr::HmdVector3d_t translation;
+		vr::HmdQuaternion_t rotation;
+		double scale;
+	};
+
+	// Replaces all rules, count 0 clears them.
+	struct SetTrackingSystemRules
+	{
+		uint32_t count;
+		TrackingSystemRule rules[MaxTrackingSystemRules];
+
+		uint32_t PayloadSize() const
+		{
+			return (uint32_t) (offsetof(SetTrackingSystemRules, rules) + count * sizeof(TrackingSystemRule));
+		}
+	};
+
+	// Continuous calibration run by the driver itself instead of the client, so neither the
+	// poses nor the corrections cross the pipe. enabled false stops it.
+	struct SetContinuousCalibration
+	{
+		bool enabled;
+		uint32_t referenceID, targetID;
+		uint64_t correctMask; // Devices that get the corrections, normally every device of the target's system.
+		uint32_t windowSize; // Most recent samples each solve looks at.
+	};
+
+	// Corrections the driver applied since the last status request, composed into one. Every
+	// transform in correctMask went from x to rotation * x + translation in world space.
+	struct ContinuousCalibrationStatus
+	{
+		bool running;
+		uint32_t corrections;
+		uint32_t samples; // In the current window.
+		vr::HmdQuaternion_t rotation;
+		vr::HmdVector3d_t translation;
+	};
+
+	// Filters the driver runs on a device's poses after its transform, in order.
+	enum PoseFilterType : uint32_t
+	{
+		PoseFilterOneEuro = 1, // Smooths slow motion, follows fast motion closely.
+		PoseFilterJitter, // Holds the pose until it moves past a deadband.
+		PoseFilterBlend, // Blends in the pose another device implies for this one.
+		PoseFilterFusion, // Kalman filters the device's and the source's poses into one.
+		PoseFilterFallback, // Stands in the pose the source implies while the device is not tracking.
+		PoseFilterPredict, // Shifts the pose in time, for systems with more or less latency than the reference.
+		PoseFilterCompensate, // Takes out how the source moved from its neutral pose, for devices on a motion platform.
+	};
+
+	const uint32_t MaxPoseFilterStages = 4;
+	const double MaxPosePrediction = 0.1;
+
+	struct PoseFilterStage
+	{
+		uint32_t type; // PoseFilterType
+		uint32_t sourceID; // Blend, Fusion, Fallback: the other device, e.g. a tracker on the same hand as a controller. Compensate: a tracker on the platform.
+
+		// OneEuro: minimum cutoff in Hz, beta in s/m and s/rad, cutoff of the speed estimate in Hz.
+		// Jitter: position deadband in m, rotation deadband in rad.
+		// Blend: weight of the source's pose from 0 to 1, and the oldest source pose used, in seconds.
+		// Fusion: noise of this device's and of the source's positions in m, acceleration noise in m/s^2.
+		// Fallback: the oldest source pose used in seconds, and from 0 to 1 how far each pose with both
+		// tracking moves the offset toward the one measured, 0 keeps the offset given here.
+		// Predict: seconds to move the pose ahead by, negative holds it back, at most MaxPosePrediction.
+		// Compensate: the oldest source pose used in seconds, older ones keep the last correction.
+		double params[3];
+
+		// Blend, Fusion, Fallback: this device's pose in the source's frame, in world units.
+		// Compensate: the source's neutral pose in world space.
+		vr::HmdVector3d_t offsetTranslation;
+		vr::HmdQuaternion_t offsetRotation;
+	};
+
+	struct SetPoseFilters
+	{
+		uint32_t openVRID;
+		uint32_t count; // 0 removes the device's filters.
+		PoseFilterStage stages[MaxPoseFilterStages];
+	};
+
+	enum PoseHookMode : uint32_t
+	{
+		PoseHookAlways, // Until a client asks for anything else.
+		PoseHookWhenNeeded, // Removed while no device is transformed, filtered or captured, and no rules are set.
+	};
+
+	struct SetPoseHookMode
+	{
+		uint32_t mode; // PoseHookMode
+		uint32_t reserved;
+	};
+
+	// A drift prediction nobody has confirmed for this long is held where it is, in seconds.
+	const double MaxDriftExtrapolation = 30.0;
+
+	struct DeviceTransform
+	{
+		bool enabled;
+
+		// Counts the writes of the device's calibration layer, see TransformLayer. The pose hook
+		// only blends over to a transform whose count changed, other layers' changes show at once.
+		uint32_t calibrationWrites;
+
+		vr::HmdVector3d_t translation;
+		vr::HmdQuaternion_t rotation;
+		double scale;
+
+		// Predicted drift between the tracking systems, extrapolated by the pose hook. A pose at
+		// time t gets the world space rotation by angularDrift * (t - driftEpoch), in rad/s, and
+		// the offset linearDrift * (t - driftEpoch), in m/s, on top of the transform above.
+		// driftEpoch is in seconds on the QueryPerformanceCounter clock.
+		vr::HmdVector3d_t angularDrift, linearDrift;
+		double driftEpoch;
+
+		void Update(const SetDeviceTransform &tf)
+		{
+			enabled = tf.enabled;
+			if (tf.updateTranslation)
+				translation = tf.translation;
+			if (tf.updateRotation)
+				rotation = tf.rotation;
+			if (tf.updateScale)
+				scale = tf.scale;
+			if (tf.updateDrift)
+			{
+				angularDrift = tf.angularDrift;
+				linearDrift = tf.linearDrift;
+				driftEpoch = tf.driftEpoch;
+			}
+
+			// A transform that's enabled again starts without a prediction.
+			if (!enabled)
+				angularDrift = linearDrift = { 0, 0, 0 };
+		}
+	};
+
+	// Every device's transform in one layer, the calibration unless asked otherwise, as one
+	// consistent copy. The sequence grows with every write, so equal sequences mean nothing
+	// changed in between.
+	struct DeviceTransforms
+	{
+		uint32_t sequence;
+		uint32_t reserved;
+		uint64_t enabledMask;
+		DeviceTransform devices[vr::k_unMaxTrackedDeviceCount];
+	};
+
+	// Two cache lines per device, so no two devices share one.
+	static_assert(sizeof(DeviceTransform) == 128, "unexpected device transform layout");
+
+	// Writers of the transform table other than the calibrator get an id of their own from
+	// TransformBuffer::NewWriter, and hold the layers of the devices they transform. The calibrator's writes,
+	// pipe requests, rules and restored transforms included, are writer 0 and hold nothing.
+	const uint32_t CalibratorWriter = 0;
+
+	// A device whose holder hasn't written it for this long is free again, so a tool that
+	// crashed doesn't keep it. GetTickCount64 milliseconds.
+	const uint64_t WriterLeaseMilliseconds = 2000;
+
+	// A device's transform is a stack of layers, innermost first, each held and written on its
+	// own. Calibration is the calibrator's, the outer ones belong to tools that move a device on
+	// top of it, like an offset the user dialed in or a motion platform's compensation. Layers
+	// are composed whenever one changes, so the pose hook applies one transform however many are
+	// enabled.
+	enum TransformLayer : uint32_t
+	{
+		TransformLayerCalibration,
+		TransformLayerUserOffset,
+		TransformLayerPlatform,
+	};
+
+	// Room for one more layer past TransformLayerPlatform, outermost.
+	const uint32_t MaxTransformLayers = 4;
+
+	// Device transforms, written directly by the client and read by the driver's pose hook.
+	// Writers update a device's layers and compose them into its entry of the table the pose
+	// hook reads. The table is double buffered: a writer fills the inactive table and then
+	// publishes it by bumping the sequence, so the reader never waits and a batch becomes
+	// visible all at once. Writers (the client, and the driver's IPC thread for pipe requests)
+	// take writeLock, which holds the process ID and start time of its owner, so a lock left
+	// behind by a process that died holding it can be taken over, see BreakStaleLock. The lock,
+	// the words the pose hook reads with every pose and the tables each get their own cache lines, so a writer spinning on the lock or filling the inactive
+	// table doesn't evict what the pose hook reads.
+	//
+	// A device's layer only takes the transforms of the writer holding it, see CalibratorWriter,
+	// and the calibrator's while nobody does. Everyone else's are skipped. The calibrator's
+	// writes of the calibration layer are kept aside even when skipped, and put back once the
+	// holder lets go, since the client counts them as applied and won't send them again.
+	// Holders, leases, layers and the calibrator's writes are only touched under writeLock, the
+	// pose hook never reads them.
+	//
+	// OpenVR IDs outlive their devices: once one disconnects, the next to connect may get its ID.
+	// The driver then resets everything the ID had and counts up its generation, see DeactivateLocked,
+	// so a transform worked out for the old device can't land on the new one.
+	struct TransformBuffer
+	{
+		alignas(64) mutable std::atomic<uint64_t> writeLock; // OwnerToken of the holder, 0 for none.
+		std::atomic<uint32_t> lastWriter;
+		std::atomic<uint32_t> deactivations[vr::k_unMaxTrackedDeviceCount]; // Per OpenVR ID, only changed under writeLock.
+		std::atomic<uint32_t> holders[MaxTransformLayers][vr::k_unMaxTrackedDeviceCount]; // Writer per layer and OpenVR ID, CalibratorWriter for none.
+		std::atomic<uint64_t> leases[MaxTransformLayers][vr::k_unMaxTrackedDeviceCount]; // GetTickCount64 of the holder's last write.
+		DeviceTransform layers[MaxTransformLayers][vr::k_unMaxTrackedDeviceCount]; // As written, composed into the tables.
+		DeviceTransform calibrator[vr::k_unMaxTrackedDeviceCount]; // The calibrator's last write of the calibration layer.
+
+		alignas(64) std::atomic<uint32_t> sequence;
+		std::atomic<uint64_t> enabledMask; // Bit per OpenVR ID with an enabled transform, lets the pose hook skip the rest.
+
+		struct alignas(64) Table
+		{
+			DeviceTransform devices[vr::k_unMaxTrackedDeviceCount];
+		} tables[2];
+
+		void Lock() const
+		{
+			uint64_t self = OwnerToken();
+			for (uint32_t spins = 1; !Acquire(self); spins++)
+			{
+				// Looking up the owner is a system call, spinning is far cheaper while it lives.
+				if (spins % StaleLockSpins == 0)
+					BreakStaleLock();
+				std::this_thread::yield();
+			}
+		}
+
+		// Takes writeLock only if nobody holds it, or the process holding it is gone. For threads
+		// that can't wait on other processes, like SteamVR's frame loop.
+		bool TryLock() const
+		{
+			uint64_t self = OwnerToken();
+			if (Acquire(self))
+				return true;
+			BreakStaleLock();
+			return Acquire(self);
+		}
+
+		void Unlock() const
+		{
+			writeLock.store(0, std::memory_order_release);
+		}
+
+		// Returns false if any transform had an invalid device id, or the layer is invalid, those
+		// are skipped. Devices whose layer the writer doesn't hold are skipped too, with a bit in
+		// held if given. now renews the writer's leases on the layers it holds.
+		bool Write(const SetDeviceTransform *transforms, uint32_t count, uint32_t layer = TransformLayerCalibration,
+			uint32_t writer = CalibratorWriter, uint64_t now = 0, uint64_t *held = nullptr)
+		{
+			Lock();
+			bool ok = WriteLocked(transforms, count, layer, writer, now, held);
+			Unlock();
+			return ok;
+		}
+
+		// The ...Locked functions are for a caller that holds writeLock already, e.g. after
+		// TryLock, and otherwise do what the function without the suffix does.
+		bool WriteLocked(const SetDeviceTransform *transforms, uint32_t count, uint32_t layer = TransformLayerCalibration,
+			uint32_t writer = CalibratorWriter, uint64_t now = 0, uint64_t *held = nullptr)
+		{
+			if (layer >= MaxTransformLayers)
+				return false;
+
+			auto &next = BeginUpdate();
+
+			bool ok = true;
+			uint64_t mask = enabledMask.load(std::memory_order_relaxed);
+			for (uint32_t i = 0; i < count; i++)
+			{
+				uint32_t id = transforms[i].openVRID;
+				if (id < vr::k_unMaxTrackedDeviceCount)
+				{
+					uint32_t generation = transforms[i].generation;
+					if (generation && generation != Generation(id))
+						continue;
+
+					if (layer == TransformLayerCalibration && writer == CalibratorWriter)
+						calibrator[id].Update(transforms[i]);
+
+					uint32_t holder = holders[layer][id].load(std::memory_order_relaxed);
+					if (holder != writer)
+					{
+						if (held)
+							*held |= 1ull << id;
+						continue;
+					}
+					if (holder != CalibratorWriter)
+						leases[layer][id].store(now, std::memory_order_relaxed);
+
+					layers[layer][id].Update(transforms[i]);
+					if (layer == TransformLayerCalibration)
+						layers[layer][id].calibrationWrites++;
+					Compose(next, id, mask);
+				}
+				else
+				{
+					ok = false;
+				}
+			}
+
+			Publish(mask);
+			return ok;
+		}
+
+		uint32_t NewWriter()
+		{
+			uint32_t writer;
+			do
+				writer = lastWriter.fetch_add(1, std::memory_order_relaxed) + 1;
+			while (writer == CalibratorWriter);
+			return writer;
+		}
+
+		// Holds the device's layer for writer, unless a writer whose lease hasn't run out holds it.
+		bool Hold(uint32_t openVRID, uint32_t layer, uint32_t writer, uint64_t now)
+		{
+			Lock();
+			uint32_t holder = holders[layer][openVRID].load(std::memory_order_relaxed);
+			bool free = holder == CalibratorWriter || holder == writer ||
+				now - leases[layer][openVRID].load(std::memory_order_relaxed) > WriterLeaseMilliseconds;
+			if (free)
+			{
+				holders[layer][openVRID].store(writer, std::memory_order_relaxed);
+				leases[layer][openVRID].store(now, std::memory_order_relaxed);
+			}
+			Unlock();
+			return free;
+		}
+
+		// Puts the calibrator's last write back on the device's calibration layer. Any other layer
+		// is disabled, nobody is left to keep it current.
+		void Release(uint32_t openVRID, uint32_t layer, uint32_t writer)
+		{
+			Lock();
+			if (holders[layer][openVRID].load(std::memory_order_relaxed) == writer)
+				Drop(openVRID, layer);
+			Unlock();
+		}
+
+		// Returns a bit per OpenVR ID with a layer released, see Release. Under writeLock, the
+		// driver's frame loop calls it once it got the lock from TryLock.
+		uint64_t ReleaseExpiredLocked(uint64_t now)
+		{
+			uint64_t released = 0;
+			const auto *first = &holders[0][0], *last = first + MaxTransformLayers * vr::k_unMaxTrackedDeviceCount;
+			if (std::none_of(first, last, [](const std::atomic<uint32_t> &holder) { return holder.load(std::memory_order_relaxed) != CalibratorWriter; }))
+				return released;
+
+			for (uint32_t layer = 0; layer < MaxTransformLayers; layer++)
+			{
+				for (uint32_t id = 0; id < vr::k_unMaxTrackedDeviceCount; id++)
+				{
+					if (holders[layer][id].load(std::memory_order_relaxed) != CalibratorWriter &&
+						now - leases[layer][id].load(std::memory_order_relaxed) > WriterLeaseMilliseconds)
+					{
+						Drop(id, layer);
+						released |= 1ull << id;
+					}
+				}
+			}
+			return released;
+		}
+
+		// Called by the driver under writeLock once the device that had the ID disconnected. Every
+		// layer goes back to an identity transform that's disabled, nobody holds any, and
+		// transforms for the old generation are skipped from here on.
+		void DeactivateLocked(uint32_t openVRID)
+		{
+			auto &next = BeginUpdate();
+			uint64_t mask = enabledMask.load(std::memory_order_relaxed);
+			DeviceTransform identity = DeviceTransform();
+			identity.rotation = { 1, 0, 0, 0 };
+			identity.scale = 1.0;
+			for (uint32_t layer = 0; layer < MaxTransformLayers; layer++)
+			{
+				holders[layer][openVRID].store(CalibratorWriter, std::memory_order_relaxed);
+				layers[layer][openVRID] = identity;
+			}
+			calibrator[openVRID] = identity;
+			deactivations[openVRID].store(deactivations[openVRID].load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+			Compose(next, openVRID, mask);
+			Publish(mask);
+		}
+
+		// Counts the devices that had the ID from 1, see DeactivateLocked. Never 0, which stands for
+		// any generation in SetDeviceTransform.
+		uint32_t Generation(uint32_t openVRID) const
+		{
+			return deactivations[openVRID].load(std::memory_order_relaxed) + 1;
+		}
+
+		uint32_t Holder(uint32_t openVRID, uint32_t layer = TransformLayerCalibration) const
+		{
+			return holders[layer][openVRID].load(std::memory_order_relaxed);
+		}
+
+		uint32_t Sequence() const
+		{
+			return sequence.load(std::memory_order_acquire);
+		}
+
+		// Whether the composed transform the pose hook applies is enabled, see ReadLayer for one
+		// layer.
+		bool IsEnabled(uint32_t openVRID) const
+		{
+			return (enabledMask.load(std::memory_order_relaxed) >> openVRID) & 1;
+		}
+
+		bool AnyEnabled() const
+		{
+			return enabledMask.load(std::memory_order_relaxed) != 0;
+		}
+
+		// The layer as written, before composition. Takes writeLock, so not for the pose hook.
+		DeviceTransform ReadLayer(uint32_t openVRID, uint32_t layer = TransformLayerCalibration) const
+		{
+			Lock();
+			DeviceTransform tf = ReadLayerLocked(openVRID, layer);
+			Unlock();
+			return tf;
+		}
+
+		DeviceTransform ReadLayerLocked(uint32_t openVRID, uint32_t layer = TransformLayerCalibration) const
+		{
+			return layers[layer][openVRID];
+		}
+
+		// Every device's layer, as one consistent copy. Takes writeLock.
+		void Snapshot(DeviceTransforms &out, uint32_t layer = TransformLayerCalibration) const
+		{
+			Lock();
+			out.sequence = sequence.load(std::memory_order_relaxed);
+			std::copy(layers[layer], layers[layer] + vr::k_unMaxTrackedDeviceCount, out.devices);
+			Unlock();
+
+			out.enabledMask = 0;
+			for (uint32_t id = 0; id < vr::k_unMaxTrackedDeviceCount; id++)
+			{
+				if (out.devices[id].enabled)
+					out.enabledMask |= 1ull << id;
+			}
+			out.reserved = 0;
+		}
+
+		// The composed transform, read by the pose hook without taking writeLock.
+		DeviceTransform Read(uint32_t openVRID, uint32_t &readSequence) const
+		{
+			while (true)
+			{
+				readSequence = sequence.load(std::memory_order_acquire);
+				DeviceTransform tf = tables[readSequence & 1].devices[openVRID];
+				std::atomic_thread_fence(std::memory_order_acquire);
+
+				// The table we copied from is rewritten by the next writer as soon as another table is published.
+				if (sequence.load(std::memory_order_relaxed) == readSequence)
+					return tf;
+			}
+		}
+
+		// Like Read, but gives up after attempts copies that writers overtook, so it finishes in
+		// a bounded number of steps however fast they write. An attempt only fails when two
+		// tables were published while it copied one transform.
+		bool TryRead(uint32_t openVRID, DeviceTransform &tf, uint32_t &readSequence, int attempts) const
+		{
+			for (int i = 0; i < attempts; i++)
+			{
+				readSequence = sequence.load(std::memory_order_acquire);
+				tf = tables[readSequence & 1].devices[openVRID];
+				std::atomic_thread_fence(std::memory_order_acquire);
+
+				if (sequence.load(std::memory_order_relaxed) == readSequence)
+					return true;
+			}
+			return false;
+		}
+
+	private:
+		// How often Lock spins before it checks whether the owner still lives.
+		static const uint32_t StaleLockSpins = 1024;
+
+		// The process ID, with the low word of the process's creation time below it. IDs are
+		// reused once a process exits, the pair isn't in practice.
+		static uint64_t TokenOf(uint32_t processID, const FILETIME &created)
+		{
+			return ((uint64_t) processID << 32) | created.dwLowDateTime;
+		}
+
+		static uint64_t OwnerToken()
+		{
+			static const uint64_t token = [] {
+				FILETIME created = {}, exited, kernel, user;
+				GetProcessTimes(GetCurrentProcess(), &created, &exited, &kernel, &user);
+				return TokenOf(GetCurrentProcessId(), created);
+			}();
+			return token;
+		}
+
+		bool Acquire(uint64_t self) const
+		{
+			uint64_t free = 0;
+			return writeLock.load(std::memory_order_relaxed) == 0 &&
+				writeLock.compare_exchange_strong(free, self, std::memory_order_acquire, std::memory_order_relaxed);
+		}
+
+		// Frees writeLock if the process holding it has exited. A process that has the owner's ID
+		// but started at another time got the ID after the owner exited. One that can't be opened
+		// for another reason, like access, is taken to live. What the owner was writing may be
+		// half done, but only in its layers: the inactive table is copied over by the next
+		// BeginUpdate, so nothing torn gets published that wasn't already composed.
+		void BreakStaleLock() const
+		{
+			uint64_t owner = writeLock.load(std::memory_order_relaxed);
+			if (owner == 0 || owner == OwnerToken())
+				return;
+
+			bool exited;
+			uint32_t processID = (uint32_t) (owner >> 32);
+			HANDLE process = OpenProcess(SYNCHRONIZE | PROCESS_QUERY_LIMITED_INFORMATION, FALSE, processID);
+			if (process)
+			{
+				FILETIME created = {}, exitTime, kernel, user;
+				exited = WaitForSingleObject(process, 0) == WAIT_OBJECT_0 ||
+					(GetProcessTimes(process, &created, &exitTime, &kernel, &user) && TokenOf(processID, created) != owner);
+				CloseHandle(process);
+			}
+			else
+			{
+				exited = GetLastError() == ERROR_INVALID_PARAMETER; // No process has the ID.
+			}
+
+			if (exited)
+				writeLock.compare_exchange_strong(owner, 0, std::memory_order_relaxed);
+		}
+
+		// The inactive table, as a copy of the published one. Under writeLock, until Publish.
+		Table &BeginUpdate()
+		{
+			uint32_t current = sequence.load(std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_release);
+
+			auto &next = tables[(current + 1) & 1];
+			next = tables[current & 1];
+			return next;
+		}
+
+		void Publish(uint64_t mask)
+		{
+			enabledMask.store(mask, std::memory_order_relaxed);
+			sequence.store(sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+		}
+
+		// The device's enabled layers, innermost first: each maps the pose the layers below it
+		// produced. Scales multiply, since each scales the device's driver space position. The
+		// drift is the calibration layer's, the only one anyone predicts, turned and moved with
+		// the layers above it to first order.
+		void Compose(Table &next, uint32_t id, uint64_t &mask) const
+		{
+			DeviceTransform tf = layers[TransformLayerCalibration][id];
+			if (!tf.enabled)
+			{
+				tf.translation = { 0, 0, 0 };
+				tf.rotation = { 1, 0, 0, 0 };
+				tf.scale = 1.0;
+				tf.angularDrift = tf.linearDrift = { 0, 0, 0 };
+			}
+
+			for (uint32_t layer = TransformLayerCalibration + 1; layer < MaxTransformLayers; layer++)
+			{
+				const auto &outer = layers[layer][id];
+				if (!outer.enabled)
+					continue;
+
+				double translation[3] = { tf.translation.v[0], tf.translation.v[1], tf.translation.v[2] };
+				double angular[3] = { tf.angularDrift.v[0], tf.angularDrift.v[1], tf.angularDrift.v[2] };
+				double linear[3] = { tf.linearDrift.v[0], tf.linearDrift.v[1], tf.linearDrift.v[2] };
+				tf.translation = quaternionRotateVector(outer.rotation, translation);
+				tf.angularDrift = quaternionRotateVector(outer.rotation, angular);
+				tf.linearDrift = quaternionRotateVector(outer.rotation, linear);
+
+				// Turning about the world origin moves the outer translation along too.
+				const auto &t = outer.translation.v, &w = tf.angularDrift.v;
+				tf.linearDrift.v[0] += t[1] * w[2] - t[2] * w[1];
+				tf.linearDrift.v[1] += t[2] * w[0] - t[0] * w[2];
+				tf.linearDrift.v[2] += t[0] * w[1] - t[1] * w[0];
+
+				for (int i = 0; i < 3; i++)
+					tf.translation.v[i] += t[i];
+				tf.rotation = outer.rotation * tf.rotation;
+				tf.scale *= outer.scale;
+				tf.enabled = true;
+			}
+
+			next.devices[id] = tf;
+			mask = tf.enabled ? (mask | (1ull << id)) : (mask & ~(1ull << id));
+		}
+
+		// The calibration layer counts as written again, so the pose hook blends over to the
+		// calibrator's transform rather than jumping to it.
+		void Drop(uint32_t openVRID, uint32_t layer)
+		{
+			holders[layer][openVRID].store(CalibratorWriter, std::memory_order_relaxed);
+			auto &tf = layers[layer][openVRID];
+			if (layer == TransformLayerCalibration)
+			{
+				uint32_t writes = tf.calibrationWrites;
+				tf = calibrator[openVRID];
+				tf.calibrationWrites = writes + 1;
+			}
+			else if (tf.enabled)
+			{
+				tf.enabled = false;
+			}
+			else
+			{
+				return;
+			}
+
+			auto &next = BeginUpdate();
+			uint64_t mask = enabledMask.load(std::memory_order_relaxed);
+			Compose(next, openVRID, mask);
+			Publish(mask);
+		}
+	};
+
+	// Raw world-space device pose as seen by the driver's pose hook, before our transform is applied.
+	struct PoseCaptureSample
+	{
+		uint32_t openVRID;
+		bool valid;
+		int32_t trackingResult; // vr::ETrackingResult
+		double timestamp; // Seconds on the QueryPerformanceCounter clock, shifted by the pose's time offset.
+		double position[3];
+		vr::HmdQuaternion_t rotation;
+		double linearSpeed; // m/s
+		double angularSpeed; // rad/s
+	};
+
+	const uint32_t PoseCaptureCapacity = 4096;
+
+	static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "pose capture buffer needs lock-free 64-bit atomics");
+
+	// Shared memory ring filled by the driver at tracking rate and drained by the client.
+	// Writers claim a slot from writeIndex, and publish it by setting its sequence to
+	// 2 * index + 2. A slot whose sequence doesn't match is still being written or was overwritten.
+	struct PoseCaptureBuffer
+	{
+		// Read with every pose and only set now and then, apart from writeIndex, which every
+		// captured pose bumps.
+		alignas(64) std::atomic<uint64_t> deviceMask; // Bit per OpenVR ID, set by the client.
+		alignas(64) std::atomic<uint64_t> writeIndex;
+
+		// Per OpenVR ID, the least time between two captured poses of the device in microseconds.
+		// Faster devices are decimated to that rate for every consumer, 0 captures every pose.
+		alignas(64) std::atomic<uint32_t> minInterval[vr::k_unMaxTrackedDeviceCount];
+
+		struct Slot
+		{
+			std::atomic<uint64_t> sequence;
+			PoseCaptureSample sample;
+		} slots[PoseCaptureCapacity];
+
+		// Several drivers may report poses concurrently, so slots are claimed atomically.
+		void Publish(const PoseCaptureSample &sample)
+		{
+			uint64_t index = writeIndex.fetch_add(1, std::memory_order_relaxed);
+			auto &slot = slots[index % PoseCaptureCapacity];
+
+			slot.sequence.store(index * 2 + 1, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_release);
+			slot.sample = sample;
+			slot.sequence.store(index * 2 + 2, std::memory_order_release);
+		}
+
+		// Calls fn with every sample published since readIndex and advances it, returns how
+		// many were lost to overruns.
+		template<typename Fn>
+		uint64_t Drain(uint64_t &readIndex, Fn fn) const
+		{
+			uint64_t lost = 0;
+			uint64_t end = writeIndex.load(std::memory_order_acquire);
+			if (end - readIndex > PoseCaptureCapacity)
+			{
+				lost = end - readIndex - PoseCaptureCapacity;
+				readIndex = end - PoseCaptureCapacity;
+			}
+
+			for (; readIndex < end; readIndex++)
+			{
+				auto &slot = slots[readIndex % PoseCaptureCapacity];
+				uint64_t published = readIndex * 2 + 2;
+
+				uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+				if (sequence < published)
+					break; // Claimed but not written yet, pick it up next time.
+
+				if (sequence == published)
+				{
+					PoseCaptureSample sample = slot.sample;
+					std::atomic_thread_fence(std::memory_order_acquire);
+					if (slot.sequence.load(std::memory_order_relaxed) == published)
+					{
+						fn(sample);
+						continue;
+					}
+				}
+
+				lost++;
+			}
+
+			return lost;
+		}
+	};
+
+	// Driver trace categories, enabled at runtime through SharedMemory::traceCategories.
+	enum TraceCategory : uint32_t
+	{
+		TraceLifecycle = 1 << 0,
+		TracePose = 1 << 1,
+		TraceIPC = 1 << 2,
+		TraceHooks = 1 << 3,
+		TraceTransforms = 1 << 4,
+		TraceAll = 0xffffffff,
+	};
+
+	// Layout of the section created by the driver under OPENVR_SPACECALIBRATOR_SHARED_MEMORY_NAME.
+	// A new section is zero filled, which is a valid state for all members.
+	struct SharedMemory
+	{
+		TransformBuffer transforms;
+		PoseCaptureBuffer poseCapture;
+		alignas(64) std::atomic<uint32_t> traceCategories;
+
+		// Set by the client. When a device's transform changes, its poses blend from the old
+		// transform to the new one over this many milliseconds instead of snapping. 0 snaps.
+		std::atomic<uint32_t> transitionMilliseconds;
+
+		// Set by the driver, bit per OpenVR ID whose poses passed through the pose hook. Other
+		// devices, e.g. base stations reported some other way, can't use a transform.
+		std::atomic<uint64_t> posedMask;
+
+		// Set by the driver to SharedMemoryLayout once the section is ready. Tools that map the
+		// section without the pipe's handshake, like the SDK, check it instead of a capability.
+		std::atomic<uint32_t> layout;
+	};
+
+	const uint32_t SharedMemoryLayout = CapabilitySharedMemory;
+
+	// Calibration state for monitoring tools, see StatusBlock.
+	const uint32_t StatusVersion = 1;
+
+	enum StatusFlags : uint32_t
+	{
+		StatusEnabled = 1 << 0,
+		StatusValidProfile = 1 << 1,
+		StatusDriverConnected = 1 << 2,
+	};
+
+	struct CalibrationStatus
+	{
+		int64_t publishedTime; // Unix milliseconds, a client that stopped publishing is gone.
+		int64_t profileSavedTime; // Unix seconds the profile was last saved, 0 if unknown.
+		uint32_t state; // The client's CalibrationState, 0 when idle.
+		uint32_t flags; // StatusFlags
+		double positionError; // RMS error of the last accepted solve in meters, negative before one.
+		uint64_t presentMask; // Bit per OpenVR ID of the devices SteamVR reports.
+		uint64_t appliedMask; // Bit per OpenVR ID of the devices the driver transforms.
+		char referenceTrackingSystem[MaxTrackingSystemNameLength]; // Null terminated.
+		char targetTrackingSystem[MaxTrackingSystemNameLength];
+	};
+
+	// Layout of the read-only section the client publishes under OPENVR_SPACECALIBRATOR_STATUS_NAME.
+	// There is no handshake, a tool maps it with FILE_MAP_READ whenever it likes and checks
+	// version and size. Later versions only append to CalibrationStatus. Reading is a seqlock:
+	// copy the status between two loads of the sequence, and retry if it was odd or changed.
+	struct StatusBlock
+	{
+		uint32_t version;
+		uint32_t size; // sizeof(CalibrationStatus) of the writer.
+		std::atomic<uint32_t> sequence; // Odd while the status is being written.
+		uint32_t reserved;
+		CalibrationStatus status;
+
+		void Publish(const CalibrationStatus &next)
+		{
+			uint32_t current = sequence.load(std::memory_order_relaxed);
+			sequence.store(current + 1, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_release);
+			status = next;
+			sequence.store(current + 2, std::memory_order_release);
+		}
+
+		// Returns false if the writer was in the middle of an update, call again.
+		bool Read(CalibrationStatus &out) const
+		{
+			uint32_t before = sequence.load(std::memory_order_acquire);
+			if (before & 1)
+				return false;
+
+			out = status;
+			std::atomic_thread_fence(std::memory_order_acquire);
+			return sequence.load(std::memory_order_relaxed) == before;
+		}
+	};
+
+	const uint32_t PoseHookLatencyBuckets = 32;
+
+	// Counters for the driver's pose hook since it was loaded. Update rates come from
+	// comparing two snapshots against their timestamps.
+	struct PoseHookStats
+	{
+		double timestamp; // Seconds on the QueryPerformanceCounter clock.
+		uint64_t calls;
+		uint64_t totalNanoseconds;
+		uint64_t maxNanoseconds;
+		uint64_t latencyHistogram[PoseHookLatencyBuckets]; // Bucket i counts calls taking [2^i, 2^(i+1)) ns, bucket 0 also holds 0 ns.
+		uint64_t deviceUpdates[vr::k_unMaxTrackedDeviceCount];
+		uint64_t queuedPoses; // Handed to consumers inside the driver.
+		uint64_t queueOverflows; // Dropped because a consumer fell behind.
+		uint64_t transformedPoses; // Calls that applied a device transform.
+	};
+
+	enum PoseRateClass : uint8_t
+	{
+		PoseRateUnknown, // No two poses close enough together yet.
+		PoseRateSteady,
+		PoseRateIrregular, // jitter is over PoseRateIrregularJitter of the interval.
+		PoseRateStalled, // Nothing for PoseRateStallIntervals intervals, or PoseRateMaxGap.
 	};
 
+	const double PoseRateIrregularJitter = 0.25;
+	const double PoseRateStallIntervals = 4.0;
+	const double PoseRateMaxGap = 0.25; // seconds, longer gaps between poses are not averaged in.
+
+	// How often a device's poses reach the pose hook, as moving averages over roughly the last
+	// 32 poses.
+	struct DevicePoseRate
+	{
+		float interval; // seconds between poses, 0 while unknown.
+		float jitter; // seconds, mean absolute deviation of the interval.
+		float sinceLast; // seconds since the last pose, at the snapshot.
+		PoseRateClass rateClass;
+		uint8_t reserved[3];
+	};
+
+	// The pose hook's counters and the IPC server's, for watching the driver from the client.
+	struct DriverStats
+	{
+		PoseHookStats poseHook;
+		uint64_t requestsHandled;
+		uint64_t invalidRequests;
+		uint32_t pipeInstances; // Connected clients, plus the instance waiting for the next one.
+		uint32_t reserved;
+		DevicePoseRate poseRates[vr::k_unMaxTrackedDeviceCount]; // With CapabilityPoseRates, drivers without send the fields above only.
+	};
+
+	// Messages are framed as a fixed header followed by size bytes of payload, so only
+	// the payload that's actually used goes over the pipe. Both ends read into buffers of
+	// MaxMessageSize and access the payload in place through the union.
+	const uint32_t MaxMessageSize = 64 * 1024;
+	const uint32_t MessageHeaderSize = 16;
+	const uint32_t MaxPayloadSize = MaxMessageSize - MessageHeaderSize;
+
 	struct Request
 	{
 		RequestType type;
+		uint32_t id; // Chosen by the client, echoed back in the response.
+		uint32_t size;
+		uint32_t reserved;
 
 		union {
+			Protocol protocol;
 			SetDeviceTransform setDeviceTransform;
+			SetDeviceTransformBatch setDeviceTransformBatch;
+			SetTrackingSystemRules setTrackingSystemRules;
+			SetContinuousCalibration setContinuousCalibration;
+			SetPoseFilters setPoseFilters;
+			SetPoseHookMode setPoseHookMode;
+			uint8_t payload[MaxPayloadSize];
 		};
 
-		Request() : type(RequestInvalid) { }
-		Request(RequestType type) : type(type) { }
+		Request() : Request(RequestInvalid) { }
+		Request(RequestType type) : type(type), id(0), size(0), reserved(0) { }
+
+		uint32_t MessageSize() const { return MessageHeaderSize + size; }
 	};
 
 	struct Response
 	{
 		ResponseType type;
+		uint32_t id;
+		uint32_t size;
+		uint32_t reserved;
 
 		union {
 			Protocol protocol;
+			PoseHookStats poseHookStats;
+			DriverStats driverStats;
+			ContinuousCalibrationStatus continuousCalibrationStatus;
+			DeviceTransforms deviceTransforms;
+			uint8_t payload[MaxPayloadSize];
 		};
 
-		Response() : type(ResponseInvalid) { }
-		Response(ResponseType type) : type(type) { }
+		Response() : Response(ResponseInvalid) { }
+		Response(ResponseType type) : type(type), id(0), size(0), reserved(0) { }
+
+		uint32_t MessageSize() const { return MessageHeaderSize + size; }
 	};
+
+	static_assert(offsetof(Request, payload) == MessageHeaderSize && sizeof(Request) == MaxMessageSize, "unexpected request layout");
+	static_assert(offsetof(Response, payload) == MessageHeaderSize && sizeof(Response) == MaxMessageSize, "unexpected response layout");
 }
\ No newline at end of file
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cmath>
+
+#ifndef _OPENVR_API
+#include <openvr_driver.h>
+#endif
+
+// Quaternion and pose helpers shared by the client and the driver.
+// All quaternions are assumed to be unit quaternions.
+
+inline vr::HmdQuaternion_t operator*(const vr::HmdQuaternion_t &lhs, const vr::HmdQuaternion_t &rhs) {
+	return {
+		(lhs.w * rhs.w) - (lhs.x * rhs.x) - (lhs.y * rhs.y) - (lhs.z * rhs.z),
+		(lhs.w * rhs.x) + (lhs.x * rhs.w) + (lhs.y * rhs.z) - (lhs.z * rhs.y),
+		(lhs.w * rhs.y) + (lhs.y * rhs.w) + (lhs.z * rhs.x) - (lhs.x * rhs.z),
+		(lhs.w * rhs.z) + (lhs.z * rhs.w) + (lhs.x * rhs.y) - (lhs.y * rhs.x)
+	};
+}
+
+inline void quaternionToMatrix(const vr::HmdQuaternion_t &q, double (&m)[3][3])
+{
+	double xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+	double xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;
+	double wx = q.w * q.x, wy = q.w * q.y, wz = q.w * q.z;
+
+	m[0][0] = 1.0 - 2.0 * (yy + zz); m[0][1] = 2.0 * (xy - wz); m[0][2] = 2.0 * (xz + wy);
+	m[1][0] = 2.0 * (xy + wz); m[1][1] = 1.0 - 2.0 * (xx + zz); m[1][2] = 2.0 * (yz - wx);
+	m[2][0] = 2.0 * (xz - wy); m[2][1] = 2.0 * (yz + wx); m[2][2] = 1.0 - 2.0 * (xx + yy);
+}
+
+inline void matrixRotateVector(const double (&m)[3][3], const double (&vector)[3], double (&out)[3])
+{
+	out[0] = m[0][0] * vector[0] + m[0][1] * vector[1] + m[0][2] * vector[2];
+	out[1] = m[1][0] * vector[0] + m[1][1] * vector[1] + m[1][2] * vector[2];
+	out[2] = m[2][0] * vector[0] + m[2][1] * vector[1] + m[2][2] * vector[2];
+}
+
+inline vr::HmdVector3d_t quaternionRotateVector(const vr::HmdQuaternion_t &quat, const double (&vector)[3]) {
+	double m[3][3], out[3];
+	quaternionToMatrix(quat, m);
+	matrixRotateVector(m, vector, out);
+	return { out[0], out[1], out[2] };
+}
+
+// Shortest path from a at t = 0 to b at t = 1, falling back to a normalized lerp when they're close.
+inline vr::HmdQuaternion_t quaternionSlerp(const vr::HmdQuaternion_t &a, vr::HmdQuaternion_t b, double t)
+{
+	double dot = a.w * b.w + a.x * b.x + a.y * b.y + a.z * b.z;
+	if (dot < 0)
+	{
+		b = { -b.w, -b.x, -b.y, -b.z };
+		dot = -dot;
+	}
+
+	double wa = 1.0 - t, wb = t;
+	if (dot < 0.9995)
+	{
+		double theta = acos(dot), sinTheta = sin(theta);
+		wa = sin((1.0 - t) * theta) / sinTheta;
+		wb = sin(t * theta) / sinTheta;
+	}
+
+	vr::HmdQuaternion_t q = { wa * a.w + wb * b.w, wa * a.x + wb * b.x, wa * a.y + wb * b.y, wa * a.z + wb * b.z };
+	double norm = sqrt(q.w * q.w + q.x * q.x + q.y * q.y + q.z * q.z);
+	return { q.w / norm, q.x / norm, q.y / norm, q.z / norm };
+}
@@ -0,0 +1,144 @@
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+
+#include "SpaceCalibratorSDK.h"
+#include "../Protocol.h"
+
+#include <algorithm>
+#include <new>
+
+struct SpaceCalWriter
+{
+	HANDLE mapping = nullptr;
+	protocol::SharedMemory *shared = nullptr;
+	uint32_t id = protocol::CalibratorWriter;
+	uint64_t heldMasks[protocol::MaxTransformLayers] = {}; // Bit per OpenVR ID, per layer.
+};
+
+SpaceCalResult SpaceCalOpen(SpaceCalWriter **writer)
+{
+	if (!writer)
+		return SpaceCalInvalidArgument;
+	*writer = nullptr;
+
+	HANDLE mapping = OpenFileMappingA(FILE_MAP_ALL_ACCESS, FALSE, OPENVR_SPACECALIBRATOR_SHARED_MEMORY_NAME);
+	if (!mapping)
+		return SpaceCalNoDriver;
+
+	// The section of an older driver is smaller than this layout, and can't be mapped this large.
+	auto shared = (protocol::SharedMemory *) MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, sizeof(protocol::SharedMemory));
+	if (!shared || shared->layout.load(std::memory_order_acquire) != protocol::SharedMemoryLayout)
+	{
+		if (shared)
+			UnmapViewOfFile(shared);
+		CloseHandle(mapping);
+		return SpaceCalNoDriver;
+	}
+
+	auto opened = new (std::nothrow) SpaceCalWriter;
+	if (!opened)
+	{
+		UnmapViewOfFile(shared);
+		CloseHandle(mapping);
+		return SpaceCalNoDriver;
+	}
+
+	opened->mapping = mapping;
+	opened->shared = shared;
+	opened->id = shared->transforms.NewWriter();
+	*writer = opened;
+	return SpaceCalOK;
+}
+
+void SpaceCalClose(SpaceCalWriter *writer)
+{
+	if (!writer)
+		return;
+
+	for (uint32_t layer = 0; layer < protocol::MaxTransformLayers; layer++)
+	{
+		for (uint32_t id = 0; id < vr::k_unMaxTrackedDeviceCount; id++)
+		{
+			if (writer->heldMasks[layer] & (1ull << id))
+				writer->shared->transforms.Release(id, layer, writer->id);
+		}
+	}
+
+	UnmapViewOfFile(writer->shared);
+	CloseHandle(writer->mapping);
+	delete writer;
+}
+
+uint32_t SpaceCalWriterID(const SpaceCalWriter *writer)
+{
+	return writer ? writer->id : protocol::CalibratorWriter;
+}
+
+SpaceCalResult SpaceCalHold(SpaceCalWriter *writer, uint32_t openVRID, uint32_t layer)
+{
+	if (!writer || layer >= protocol::MaxTransformLayers)
+		return SpaceCalInvalidArgument;
+	if (openVRID >= vr::k_unMaxTrackedDeviceCount)
+		return SpaceCalInvalidDevice;
+
+	if (!writer->shared->transforms.Hold(openVRID, layer, writer->id, GetTickCount64()))
+		return SpaceCalHeld;
+	writer->heldMasks[layer] |= 1ull << openVRID;
+	return SpaceCalOK;
+}
+
+SpaceCalResult SpaceCalRelease(SpaceCalWriter *writer, uint32_t openVRID, uint32_t layer)
+{
+	if (!writer || layer >= protocol::MaxTransformLayers)
+		return SpaceCalInvalidArgument;
+	if (openVRID >= vr::k_unMaxTrackedDeviceCount)
+		return SpaceCalInvalidDevice;
+
+	writer->shared->transforms.Release(openVRID, layer, writer->id);
+	writer->heldMasks[layer] &= ~(1ull << openVRID);
+	return SpaceCalOK;
+}
+
+SpaceCalResult SpaceCalSetTransforms(SpaceCalWriter *writer, uint32_t layer, const SpaceCalTransform *transforms, uint32_t count)
+{
+	if (!writer || (!transforms && count) || layer >= protocol::MaxTransformLayers)
+		return SpaceCalInvalidArgument;
+
+	for (uint32_t i = 0; i < count; i++)
+	{
+		if (transforms[i].openVRID >= vr::k_unMaxTrackedDeviceCount)
+			return SpaceCalInvalidDevice;
+	}
+
+	protocol::SetDeviceTransform update[vr::k_unMaxTrackedDeviceCount];
+	uint64_t held = 0;
+	for (uint32_t first = 0; first < count; first += vr::k_unMaxTrackedDeviceCount)
+	{
+		uint32_t chunk = std::min(count - first, vr::k_unMaxTrackedDeviceCount);
+		for (uint32_t i = 0; i < chunk; i++)
+		{
+			const auto &tf = transforms[first + i];
+			vr::HmdVector3d_t translation = { tf.translation[0], tf.translation[1], tf.translation[2] };
+			vr::HmdQuaternion_t rotation = { tf.rotation[0], tf.rotation[1], tf.rotation[2], tf.rotation[3] };
+			auto &out = update[i];
+			out = protocol::SetDeviceTransform(tf.openVRID, tf.enabled != 0, translation, rotation, tf.scale);
+
+			// The calibrator's drift prediction doesn't carry over to a layer held by someone else,
+			// and only the calibration layer's drift is used at all.
+			out.updateDrift = true;
+			out.angularDrift = out.linearDrift = { 0, 0, 0 };
+			out.driftEpoch = 0;
+		}
+		writer->shared->transforms.Write(update, chunk, layer, writer->id, GetTickCount64(), &held);
+	}
+
+	// Whatever the driver released is no longer ours, though it may be held again.
+	writer->heldMasks[layer] &= ~held;
+	return held ? SpaceCalNotHeld : SpaceCalOK;
+}
+
+uint32_t SpaceCalSequence(const SpaceCalWriter *writer)
+{
+	return writer ? writer->shared->transforms.Sequence() : 0;
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+/*
+ * Lets other tools, e.g. motion platform or motion capture software, stream device transforms
+ * into the Space Calibrator driver at tracking rate. Transforms are written straight into the
+ * driver's shared memory table, there is no round trip through its pipe.
+ *
+ * A device's transform is a stack of layers, see SpaceCalLayer, which the driver composes
+ * into the one transform it applies. Tools write a layer of their own and coexist with the
+ * calibration and with each other.
+ *
+ * A writer holds the layers of the devices it transforms. While it does, the calibrator's
+ * transforms for them are skipped, and so are those of every other writer. A layer whose
+ * writer hasn't written it for two seconds is released, so a tool that crashed doesn't keep it.
+ *
+ * The driver's pose hook reads the table wait-free: it takes no lock and never waits for a
+ * writer, however fast writers write. Writers take a short spin lock among themselves.
+ *
+ * Functions may only be called from one thread at a time for the same writer.
+ */
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct SpaceCalWriter SpaceCalWriter;
+
+typedef enum SpaceCalResult
+{
+	SpaceCalOK = 0,
+	SpaceCalNoDriver = 1, // The driver isn't loaded, or is a release without this interface.
+	SpaceCalInvalidArgument = 2,
+	SpaceCalInvalidDevice = 3, // An OpenVR ID of 64 or more.
+	SpaceCalHeld = 4, // Another writer holds the device.
+	SpaceCalNotHeld = 5, // The writer doesn't hold the device, e.g. after its lease ran out.
+} SpaceCalResult;
+
+// Innermost first, each maps the pose the layers below it produced.
+typedef enum SpaceCalLayer
+{
+	SpaceCalLayerCalibration = 0, // The calibrator's, held it replaces the calibration.
+	SpaceCalLayerUserOffset = 1,
+	SpaceCalLayerPlatform = 2, // E.g. a motion platform's compensation.
+	SpaceCalLayerCount = 4, // Layer 3 is free for anything else, outermost.
+} SpaceCalLayer;
+
+// Maps a device's world space pose p to rotation * (scale * p) + translation.
+typedef struct SpaceCalTransform
+{
+	uint32_t openVRID;
+	int enabled; // 0 shows the device without any transform.
+	double translation[3]; // meters
+	double rotation[4]; // Unit quaternion, w x y z.
+	double scale;
+} SpaceCalTransform;
+
+// Connects to the driver's shared memory and gets a writer id of its own.
+SpaceCalResult SpaceCalOpen(SpaceCalWriter **writer);
+
+// Releases the writer's layers and disconnects, see SpaceCalRelease.
+void SpaceCalClose(SpaceCalWriter *writer);
+
+uint32_t SpaceCalWriterID(const SpaceCalWriter *writer);
+
+// Holds the device's layer for the writer, or renews its lease.
+SpaceCalResult SpaceCalHold(SpaceCalWriter *writer, uint32_t openVRID, uint32_t layer);
+
+// Hands the device's calibration layer back to the calibrator, whose last transform for it
+// applies again right away. Any other layer is disabled.
+SpaceCalResult SpaceCalRelease(SpaceCalWriter *writer, uint32_t openVRID, uint32_t layer);
+
+// Writes the transforms into the layer as one update, which the driver applies all at once.
+// Transforms of devices whose layer the writer doesn't hold are skipped and SpaceCalNotHeld is
+// returned, the others are still written. Renews the leases of the layers written.
+SpaceCalResult SpaceCalSetTransforms(SpaceCalWriter *writer, uint32_t layer, const SpaceCalTransform *transforms, uint32_t count);
+
+// Grows with every update of the table, by any writer. A pose reported after the sequence was
+// seen to reach a value uses every update up to it.
+uint32_t SpaceCalSequence(const SpaceCalWriter *writer);
+
+#ifdef __cplusplus
+}
+#endif